@@ -13,7 +13,7 @@ $times = @()
 for ($i = 0; $i -lt 5; $i++) {
     Remove-Item -Recurse -Force "benchmarks/bundler_test/dist-nova" -ErrorAction SilentlyContinue
     $start = Get-Date
-    & "./build/Release/nova.exe" -b "benchmarks/bundler_test/src/index.js" --outDir "benchmarks/bundler_test/dist-nova" 2>&1 | Out-Null
+    & "./build/Release/nova.exe" -b "benchmarks/bundler_test/src/index.js" --bundle --outDir "benchmarks/bundler_test/dist-nova" 2>&1 | Out-Null
     $elapsed = ((Get-Date) - $start).TotalMilliseconds
     $times += $elapsed
 }
@@ -0,0 +1,26 @@
+// Destructuring Benchmark - short-lived tuple and object literals
+// Run with NOVA_GC_STATS=1 to print allocation totals at exit.
+const iterations = 5000000;
+
+// Tuple swap: [a, b] = [b, a]
+const swapStart = Date.now();
+let a = 1;
+let b = 2;
+for (let i = 0; i < iterations; i++) {
+    [a, b] = [b, a + i];
+}
+const swapTime = Date.now() - swapStart;
+
+// Multi-value temporaries: const {x, y} = {...}
+const pointStart = Date.now();
+let sum = 0;
+for (let i = 0; i < iterations; i++) {
+    const {x, y} = {x: i, y: i * 2};
+    const [lo, hi] = [x, y + 1];
+    sum += lo + hi;
+}
+const pointTime = Date.now() - pointStart;
+
+console.log(`Tuple swap: ${a + b} in ${swapTime}ms`);
+console.log(`Point temporaries: ${sum} in ${pointTime}ms`);
+console.log(`Total: ${swapTime + pointTime}ms`);
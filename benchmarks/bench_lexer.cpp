@@ -0,0 +1,63 @@
+// Lexer throughput benchmark
+//
+// Tokenizes every .js/.ts file under a directory (default:
+// benchmarks/large_project/src) repeatedly and reports MB/s and tokens/s.
+//
+//   nova-bench-lexer [directory] [rounds]
+
+#include "nova/Frontend/Lexer.h"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace nova;
+
+int main(int argc, char** argv) {
+    std::filesystem::path root = argc > 1 ? argv[1] : "benchmarks/large_project/src";
+    int rounds = argc > 2 ? std::stoi(argv[2]) : 20;
+
+    std::vector<std::pair<std::string, std::string>> files;
+    size_t totalBytes = 0;
+    std::error_code ec;
+    for (auto it = std::filesystem::recursive_directory_iterator(root, ec);
+         !ec && it != std::filesystem::recursive_directory_iterator(); it.increment(ec)) {
+        if (!it->is_regular_file()) continue;
+        auto extension = it->path().extension().string();
+        if (extension != ".js" && extension != ".ts") continue;
+        std::ifstream input(it->path(), std::ios::binary);
+        std::stringstream buffer;
+        buffer << input.rdbuf();
+        totalBytes += buffer.str().size();
+        files.emplace_back(it->path().string(), buffer.str());
+    }
+    if (files.empty()) {
+        std::cerr << "No .js/.ts sources under " << root << std::endl;
+        return 1;
+    }
+
+    size_t tokenCount = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int round = 0; round < rounds; ++round) {
+        for (const auto& [name, source] : files) {
+            Lexer lexer(name, source);
+            tokenCount += lexer.getAllTokens().size();
+        }
+    }
+    double seconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start).count();
+
+    double megabytes = static_cast<double>(totalBytes) * rounds / (1024.0 * 1024.0);
+    std::cout << "Files: " << files.size() << ", " << totalBytes << " bytes x "
+              << rounds << " rounds" << std::endl;
+    std::cout << "Tokens: " << tokenCount << std::endl;
+    std::cout << "Time: " << seconds * 1000.0 << "ms" << std::endl;
+    std::cout << "Throughput: " << megabytes / seconds << " MB/s, "
+              << static_cast<double>(tokenCount) / seconds / 1e6 << " Mtokens/s"
+              << std::endl;
+    return 0;
+}
@@ -0,0 +1,118 @@
+// Parser and HIR generation benchmark
+//
+// Parses every .js/.ts file under a directory (default: tests/conformance)
+// repeatedly, lowers each tree that parsed cleanly to HIR, and reports the
+// time spent in each phase along with arena usage and peak RSS.
+//
+//   nova-bench-parse [directory] [rounds]
+
+#include "nova/Frontend/Lexer.h"
+#include "nova/Frontend/Parser.h"
+#include "nova/HIR/HIR.h"
+#include "nova/HIR/HIRGen.h"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
+using namespace nova;
+
+namespace {
+
+// Generator lowering still crashes HIRGen (both files fail in the
+// conformance suite); they are parsed but not lowered.
+const std::set<std::string> kNotLowered = {
+    "generators.ts",
+    "js_spec_iterators_generators.js",
+};
+
+double elapsedSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start).count();
+}
+
+long peakResidentKilobytes() {
+#ifndef _WIN32
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+#else
+    return 0;
+#endif
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::filesystem::path root = argc > 1 ? argv[1] : "tests/conformance";
+    int rounds = argc > 2 ? std::stoi(argv[2]) : 10;
+
+    std::vector<std::pair<std::string, std::string>> files;
+    size_t totalBytes = 0;
+    std::error_code ec;
+    for (auto it = std::filesystem::recursive_directory_iterator(root, ec);
+         !ec && it != std::filesystem::recursive_directory_iterator(); it.increment(ec)) {
+        if (!it->is_regular_file()) continue;
+        auto extension = it->path().extension().string();
+        if (extension != ".js" && extension != ".ts") continue;
+        std::ifstream input(it->path(), std::ios::binary);
+        std::stringstream buffer;
+        buffer << input.rdbuf();
+        totalBytes += buffer.str().size();
+        files.emplace_back(it->path().string(), buffer.str());
+    }
+    if (files.empty()) {
+        std::cerr << "No .js/.ts sources under " << root << std::endl;
+        return 1;
+    }
+
+    size_t nodeCount = 0;
+    size_t arenaBytes = 0;
+    size_t lowered = 0;
+    double parseSeconds = 0;
+    double hirSeconds = 0;
+    for (int round = 0; round < rounds; ++round) {
+        for (const auto& [name, source] : files) {
+            auto start = std::chrono::steady_clock::now();
+            Lexer lexer(name, source);
+            Parser parser(lexer);
+            auto program = parser.parseProgram();
+            parseSeconds += elapsedSince(start);
+            nodeCount += program->arena->nodeCount();
+            arenaBytes += program->arena->bytesAllocated();
+            if (lexer.hasErrors() || parser.hasErrors() ||
+                kNotLowered.count(std::filesystem::path(name).filename().string())) {
+                continue;
+            }
+
+            start = std::chrono::steady_clock::now();
+            delete hir::generateHIR(*program, "bench", name);
+            hirSeconds += elapsedSince(start);
+            ++lowered;
+        }
+    }
+
+    double megabytes = static_cast<double>(totalBytes) * rounds / (1024.0 * 1024.0);
+    std::cout << "Files: " << files.size() << ", " << totalBytes << " bytes x "
+              << rounds << " rounds" << std::endl;
+    std::cout << "Nodes: " << nodeCount / rounds << " per round, "
+              << arenaBytes / rounds / 1024 << " KiB of arena" << std::endl;
+    std::cout << "Parse: " << parseSeconds * 1000.0 << "ms ("
+              << megabytes / parseSeconds << " MB/s, "
+              << static_cast<double>(nodeCount) / parseSeconds / 1e6
+              << " Mnodes/s)" << std::endl;
+    std::cout << "HIRGen: " << hirSeconds * 1000.0 << "ms over "
+              << lowered / rounds << " files per round" << std::endl;
+    std::cout << "Peak RSS: " << peakResidentKilobytes() / 1024 << " MiB"
+              << std::endl;
+    return 0;
+}
@@ -0,0 +1,106 @@
+// TypeScript to JavaScript transpile benchmark
+//
+// Transpiles every .ts/.tsx file under a directory (default:
+// tests/conformance) repeatedly with the project transpiler, with source
+// maps and declarations enabled, and reports throughput and peak RSS.
+//
+//   nova-bench-transpile [directory] [rounds]
+
+#include "nova/Transpiler/Transpiler.h"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
+using namespace nova;
+
+namespace {
+
+double elapsedSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start).count();
+}
+
+long peakResidentKilobytes() {
+#ifndef _WIN32
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+#else
+    return 0;
+#endif
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::filesystem::path root = argc > 1 ? argv[1] : "tests/conformance";
+    int rounds = argc > 2 ? std::stoi(argv[2]) : 10;
+
+    std::vector<std::pair<std::string, std::string>> files;
+    size_t totalBytes = 0;
+    std::error_code ec;
+    for (auto it = std::filesystem::recursive_directory_iterator(root, ec);
+         !ec && it != std::filesystem::recursive_directory_iterator(); it.increment(ec)) {
+        if (!it->is_regular_file()) continue;
+        auto extension = it->path().extension().string();
+        if (extension != ".ts" && extension != ".tsx") continue;
+        if (it->path().string().size() > 5 &&
+            it->path().string().compare(it->path().string().size() - 5, 5, ".d.ts") == 0) {
+            continue;
+        }
+        std::ifstream input(it->path(), std::ios::binary);
+        std::stringstream buffer;
+        buffer << input.rdbuf();
+        totalBytes += buffer.str().size();
+        files.emplace_back(it->path().string(), buffer.str());
+    }
+    if (files.empty()) {
+        std::cerr << "No .ts/.tsx sources under " << root << std::endl;
+        return 1;
+    }
+
+    transpiler::Transpiler transpiler;
+    transpiler::CompilerOptions options;
+    options.jsx = "react-jsx";
+    options.sourceMap = true;
+    options.inlineSources = true;
+    options.declaration = true;
+    options.declarationMap = true;
+    transpiler.setOptions(options);
+
+    size_t outputBytes = 0;
+    size_t failures = 0;
+    double seconds = 0;
+    for (int round = 0; round < rounds; ++round) {
+        for (const auto& [name, source] : files) {
+            auto start = std::chrono::steady_clock::now();
+            auto result = transpiler.transpileString(source, name);
+            seconds += elapsedSince(start);
+            outputBytes += result.jsCode.size() + result.dtsCode.size() +
+                result.sourceMap.size();
+            if (!result.success) ++failures;
+        }
+    }
+
+    double megabytes = static_cast<double>(totalBytes) * rounds / (1024.0 * 1024.0);
+    std::cout << "Files: " << files.size() << ", " << totalBytes << " bytes x "
+              << rounds << " rounds" << std::endl;
+    std::cout << "Transpile: " << seconds * 1000.0 << "ms ("
+              << megabytes / seconds << " MB/s, "
+              << seconds * 1e6 / (static_cast<double>(files.size()) * rounds)
+              << " us/file)" << std::endl;
+    std::cout << "Output: " << outputBytes / rounds << " bytes per round, "
+              << failures / rounds << " failures" << std::endl;
+    std::cout << "Peak RSS: " << peakResidentKilobytes() / 1024 << " MiB"
+              << std::endl;
+    return 0;
+}
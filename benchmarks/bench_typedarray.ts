@@ -0,0 +1,58 @@
+// TypedArray Kernel Benchmark - dense numeric loops over typed arrays
+const size = 1000000;
+const rounds = 50;
+
+const xs = new Float64Array(size);
+const ys = new Float64Array(size);
+for (let i = 0; i < xs.length; i++) {
+    xs[i] = i * 0.001;
+}
+
+// daxpy: y = a * x + y
+const axpyStart = Date.now();
+for (let r = 0; r < rounds; r++) {
+    for (let i = 0; i < ys.length; i++) {
+        ys[i] = 1.5 * xs[i] + ys[i];
+    }
+}
+const axpyTime = Date.now() - axpyStart;
+
+// Dot product
+const dotStart = Date.now();
+let dot = 0;
+for (let r = 0; r < rounds; r++) {
+    for (let i = 0; i < xs.length; i++) {
+        dot += xs[i] * xs[i];
+    }
+}
+const dotTime = Date.now() - dotStart;
+
+// Integer histogram-style reduction over bytes
+const bytes = new Uint8Array(size);
+for (let i = 0; i < bytes.length; i++) {
+    bytes[i] = i * 31;
+}
+const byteStart = Date.now();
+let byteSum = 0;
+for (let r = 0; r < rounds; r++) {
+    for (let i = 0; i < bytes.length; i++) {
+        byteSum += bytes[i];
+    }
+}
+const byteTime = Date.now() - byteStart;
+
+// Int32 scale in place
+const ints = new Int32Array(size);
+const scaleStart = Date.now();
+for (let r = 0; r < rounds; r++) {
+    for (let i = 0; i < ints.length; i++) {
+        ints[i] = ints[i] * 3 + i;
+    }
+}
+const scaleTime = Date.now() - scaleStart;
+
+console.log(`Float64 axpy: ${ys[size - 1]} in ${axpyTime}ms`);
+console.log(`Float64 dot: ${dot} in ${dotTime}ms`);
+console.log(`Uint8 sum: ${byteSum} in ${byteTime}ms`);
+console.log(`Int32 scale: ${ints[1]} in ${scaleTime}ms`);
+console.log(`Total: ${axpyTime + dotTime + byteTime + scaleTime}ms`);
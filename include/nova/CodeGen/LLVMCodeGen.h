@@ -35,6 +35,15 @@ public:
     // Compile to native executable
     bool emitExecutable(const std::string& filename);
 
+    // Profile-guided optimization for emitExecutable: an instrumented build
+    // writes .profraw files at process exit (into `directory` if given), and
+    // a build with a profile applies it (.profraw inputs are merged first).
+    void setProfileGenerate(const std::string& directory = "") {
+        profileGenerate = true;
+        profileGenerateDir = directory;
+    }
+    void setProfileUse(const std::string& profile) { profileUseFile = profile; }
+
     // Optimization
     void runOptimizationPasses(unsigned optLevel = 2);
 
@@ -82,6 +91,11 @@ private:
     llvm::Value* currentReturnValue;    // The actual return value
     std::string currentDestinationName;  // Track destination place name for struct naming
     bool isAllocatingClosureEnv;        // Flag to indicate we're allocating a closure environment
+
+    // Profile-guided optimization settings
+    bool profileGenerate = false;
+    std::string profileGenerateDir;
+    std::string profileUseFile;
     
     // Helper methods
     llvm::Type* convertType(mir::MIRType* type);
@@ -111,6 +125,17 @@ private:
     llvm::Value* generateAggregate(mir::MIRAggregateRValue* aggOp);
     llvm::Value* generateGetElement(mir::MIRGetElementRValue* getElemOp);
 
+    // Inline nova_<kind>array_{get,set}_unchecked as typed loads/stores;
+    // returns nullptr when the call is left to the runtime.
+    llvm::Value* generateTypedArrayUncheckedAccess(
+        const std::string& calleeName, const std::vector<llvm::Value*>& args);
+    llvm::MDNode* typedArrayElementScope = nullptr;
+    llvm::MDNode* typedArrayHeaderScope = nullptr;
+
+    // Loop rotation plus loop/SLP vectorization against the host target;
+    // run by runOptimizationPasses at -O2 and above.
+    void runVectorizationPasses();
+
     // Runtime library functions
     void declareRuntimeFunctions();
     llvm::Function* getRuntimeFunction(const std::string& name);
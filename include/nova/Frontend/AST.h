@@ -1,7 +1,11 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <new>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -17,11 +21,132 @@ class Stmt;
 class Decl;
 class Pattern;
 
-using ExprPtr = std::shared_ptr<Expr>;
-using StmtPtr = std::shared_ptr<Stmt>;
-using DeclPtr = std::shared_ptr<Decl>;
+template <typename T> class ASTRef;
+
+using ExprPtr = ASTRef<Expr>;
+using StmtPtr = ASTRef<Stmt>;
+using DeclPtr = ASTRef<Decl>;
+using PatternPtr = ASTRef<Pattern>;
 using TypePtr = std::shared_ptr<Type>;
 
+// ==================== Node Kinds ====================
+
+// Every concrete node reports one of these tags, so type tests on the tree
+// are a virtual call and a compare instead of an RTTI walk. The kinds of
+// each abstract base are contiguous, which lets ast_cast<Expr> and friends
+// be range checks.
+enum class NodeKind : uint8_t {
+    // Expressions
+    NumberLiteral, BigIntLiteral, StringLiteral, RegexLiteralExpr,
+    BooleanLiteral, NullLiteral, UndefinedLiteral, Identifier, BinaryExpr,
+    UnaryExpr, UpdateExpr, CallExpr, MemberExpr, ConditionalExpr, ArrayExpr,
+    ObjectExpr, FunctionExpr, ArrowFunctionExpr, ClassExpr, NewExpr, ThisExpr,
+    SuperExpr, SpreadExpr, TemplateLiteralExpr, AwaitExpr, YieldExpr, AsExpr,
+    SatisfiesExpr, NonNullExpr, TaggedTemplateExpr, SequenceExpr,
+    AssignmentExpr, ParenthesizedExpr, MetaProperty, ImportExpr, JSXElement,
+    JSXFragment, JSXText, JSXExpressionContainer,
+    // Patterns
+    ObjectPattern, ArrayPattern, AssignmentPattern, RestElement,
+    IdentifierPattern,
+    // Statements
+    BlockStmt, ExprStmt, VarDeclStmt, UsingStmt, DeclStmt, IfStmt, WhileStmt,
+    DoWhileStmt, ForStmt, ForInStmt, ForOfStmt, ReturnStmt, BreakStmt,
+    ContinueStmt, ThrowStmt, TryStmt, SwitchStmt, LabeledStmt, WithStmt,
+    DebuggerStmt, EmptyStmt,
+    // Declarations
+    FunctionDecl, ClassDecl, InterfaceDecl, TypeAliasDecl, NamespaceDecl,
+    EnumDecl, ImportDecl, ExportDecl,
+    // Other nodes
+    Type, JSXAttribute, JSXSpreadAttribute, Decorator, Program
+};
+
+// Declares the kind tag of a concrete node class.
+#define NOVA_AST_NODE(Name) \
+    static constexpr NodeKind kNodeKind = NodeKind::Name; \
+    static bool classof(NodeKind kind) { return kind == kNodeKind; } \
+    NodeKind nodeKind() const override { return kNodeKind; }
+
+// ==================== Arena ====================
+
+class ASTNode;
+
+// Bump allocator that owns the nodes of one parsed file. Nodes are carved
+// out of 64 KiB blocks and are never freed one by one: the arena runs their
+// destructors and drops every block at once when it is destroyed, which
+// happens when the Program (or the Parser, for a tree never handed out)
+// that owns it goes away. Types are the exception; they are shared across
+// trees by the checker and stay on the heap.
+class ASTArena {
+public:
+    ASTArena() = default;
+    ~ASTArena();
+    ASTArena(const ASTArena&) = delete;
+    ASTArena& operator=(const ASTArena&) = delete;
+
+    template <typename T, typename... Args>
+    T* make(Args&&... args) {
+        static_assert(std::is_base_of_v<ASTNode, T>,
+                      "only AST nodes live in the arena");
+        static_assert(alignof(T) <= alignof(std::max_align_t));
+        // Grow before constructing so a failed push_back cannot strand a
+        // live node outside the destructor list.
+        if (nodes_.size() == nodes_.capacity()) {
+            nodes_.reserve(nodes_.empty() ? 1024 : nodes_.size() * 2);
+        }
+        T* node = new (allocate(sizeof(T))) T(std::forward<Args>(args)...);
+        nodes_.push_back(node);
+        return node;
+    }
+
+    size_t bytesAllocated() const { return bytesAllocated_; }
+    size_t nodeCount() const { return nodes_.size(); }
+
+private:
+    void* allocate(size_t size);
+
+    std::vector<std::unique_ptr<char[]>> blocks_;
+    std::vector<ASTNode*> nodes_;
+    char* cursor_ = nullptr;
+    char* end_ = nullptr;
+    size_t bytesAllocated_ = 0;
+};
+
+// Non-owning handle to an arena node. It keeps the shared_ptr surface the
+// front end and HIRGen were written against (get(), reset(), comparisons,
+// derived-to-base conversion) but carries no reference count.
+template <typename T>
+class ASTRef {
+public:
+    using element_type = T;
+
+    constexpr ASTRef() noexcept = default;
+    constexpr ASTRef(std::nullptr_t) noexcept {}
+    constexpr ASTRef(T* node) noexcept : node_(node) {}
+    template <typename U,
+              typename = std::enable_if_t<std::is_convertible_v<U*, T*>>>
+    constexpr ASTRef(const ASTRef<U>& other) noexcept : node_(other.get()) {}
+
+    T* get() const noexcept { return node_; }
+    T& operator*() const noexcept { return *node_; }
+    T* operator->() const noexcept { return node_; }
+    explicit operator bool() const noexcept { return node_ != nullptr; }
+    void reset() noexcept { node_ = nullptr; }
+
+    template <typename U>
+    bool operator==(const ASTRef<U>& other) const noexcept {
+        return node_ == other.get();
+    }
+    template <typename U>
+    bool operator!=(const ASTRef<U>& other) const noexcept {
+        return node_ != other.get();
+    }
+    bool operator==(std::nullptr_t) const noexcept { return !node_; }
+    bool operator!=(std::nullptr_t) const noexcept { return node_; }
+
+private:
+    T* node_ = nullptr;
+};
+
 // ==================== Base Classes ====================
 
 class ASTNode {
@@ -29,12 +154,28 @@ public:
     SourceLocation location;
     virtual ~ASTNode() = default;
     virtual void accept(class ASTVisitor& visitor) = 0;
+    virtual NodeKind nodeKind() const = 0;
 };
 
+// Checked downcast on the node kind tag; the AST counterpart of
+// dynamic_cast<T*>. Accepts null and returns null on mismatch.
+template <typename T, typename From>
+inline T* ast_cast(From* node) {
+    using Target = std::remove_cv_t<T>;
+    return node && Target::classof(node->nodeKind()) ? static_cast<T*>(node)
+                                                     : nullptr;
+}
+
+template <typename T, typename From>
+inline bool ast_isa(From* node) {
+    return node && std::remove_cv_t<T>::classof(node->nodeKind());
+}
+
 // ==================== Type System ====================
 
 class Type : public ASTNode {
 public:
+    NOVA_AST_NODE(Type)
     enum class Kind {
         Void, Any, Unknown, Never,
         Number, String, Boolean, BigInt, Symbol, Null, Undefined,
@@ -81,11 +222,16 @@ using TypeAnnotation = Type;// ==================== Expressions ================
 
 class Expr : public ASTNode {
 public:
+    static bool classof(NodeKind kind) {
+        return kind >= NodeKind::NumberLiteral &&
+               kind <= NodeKind::JSXExpressionContainer;
+    }
     TypePtr type;
 };
 
 class NumberLiteral : public Expr {
 public:
+    NOVA_AST_NODE(NumberLiteral)
     double value;
     std::string raw;
     explicit NumberLiteral(double v, const std::string& spelling = "")
@@ -95,6 +241,7 @@ public:
 
 class BigIntLiteral : public Expr {
 public:
+    NOVA_AST_NODE(BigIntLiteral)
     std::string value;  // Store as string for arbitrary precision
     explicit BigIntLiteral(const std::string& v) : value(v) {}
     void accept(ASTVisitor& visitor) override;
@@ -102,6 +249,7 @@ public:
 
 class StringLiteral : public Expr {
 public:
+    NOVA_AST_NODE(StringLiteral)
     std::string value;
     explicit StringLiteral(const std::string& v) : value(v) {}
     void accept(ASTVisitor& visitor) override;
@@ -109,6 +257,7 @@ public:
 
 class RegexLiteralExpr : public Expr {
 public:
+    NOVA_AST_NODE(RegexLiteralExpr)
     std::string pattern;
     std::string flags;
     RegexLiteralExpr(const std::string& p, const std::string& f) : pattern(p), flags(f) {}
@@ -117,6 +266,7 @@ public:
 
 class BooleanLiteral : public Expr {
 public:
+    NOVA_AST_NODE(BooleanLiteral)
     bool value;
     explicit BooleanLiteral(bool v) : value(v) {}
     void accept(ASTVisitor& visitor) override;
@@ -124,18 +274,21 @@ public:
 
 class NullLiteral : public Expr {
 public:
+    NOVA_AST_NODE(NullLiteral)
     NullLiteral() = default;
     void accept(ASTVisitor& visitor) override;
 };
 
 class UndefinedLiteral : public Expr {
 public:
+    NOVA_AST_NODE(UndefinedLiteral)
     UndefinedLiteral() = default;
     void accept(ASTVisitor& visitor) override;
 };
 
 class Identifier : public Expr {
 public:
+    NOVA_AST_NODE(Identifier)
     std::string name;
     explicit Identifier(const std::string& n) : name(n) {}
     void accept(ASTVisitor& visitor) override;
@@ -143,6 +296,7 @@ public:
 
 class BinaryExpr : public Expr {
 public:
+    NOVA_AST_NODE(BinaryExpr)
     enum class Op {
         Add, Sub, Mul, Div, Mod, Pow,
         BitAnd, BitOr, BitXor, LeftShift, RightShift, UnsignedRightShift,
@@ -162,6 +316,7 @@ public:
 
 class UnaryExpr : public Expr {
 public:
+    NOVA_AST_NODE(UnaryExpr)
     enum class Op {
         Plus, Minus, Not, BitNot, Typeof, Void, Delete, Await
     };
@@ -177,6 +332,7 @@ public:
 
 class UpdateExpr : public Expr {
 public:
+    NOVA_AST_NODE(UpdateExpr)
     enum class Op { Increment, Decrement };
     
     Op op;
@@ -190,6 +346,7 @@ public:
 
 class CallExpr : public Expr {
 public:
+    NOVA_AST_NODE(CallExpr)
     ExprPtr callee;
     std::vector<ExprPtr> arguments;
     
@@ -200,6 +357,7 @@ public:
 
 class MemberExpr : public Expr {
 public:
+    NOVA_AST_NODE(MemberExpr)
     ExprPtr object;
     ExprPtr property;
     bool isComputed;
@@ -212,6 +370,7 @@ public:
 
 class ConditionalExpr : public Expr {
 public:
+    NOVA_AST_NODE(ConditionalExpr)
     ExprPtr test;
     ExprPtr consequent;
     ExprPtr alternate;
@@ -223,6 +382,7 @@ public:
 
 class ArrayExpr : public Expr {
 public:
+    NOVA_AST_NODE(ArrayExpr)
     std::vector<ExprPtr> elements;
     
     explicit ArrayExpr(std::vector<ExprPtr> elems)
@@ -232,6 +392,7 @@ public:
 
 class ObjectExpr : public Expr {
 public:
+    NOVA_AST_NODE(ObjectExpr)
     struct Property {
         ExprPtr key;
         ExprPtr value;
@@ -249,9 +410,10 @@ public:
 
 class FunctionExpr : public Expr {
 public:
+    NOVA_AST_NODE(FunctionExpr)
     std::string name;  // optional for named function expressions
     std::vector<std::string> params;
-    std::vector<std::shared_ptr<Pattern>> paramPatterns;
+    std::vector<PatternPtr> paramPatterns;
     std::vector<ExprPtr> defaultValues;
     std::vector<TypePtr> paramTypes;  // Type annotations for parameters
     std::string restParam;  // Rest parameter name (empty if none)
@@ -266,8 +428,9 @@ public:
 
 class ArrowFunctionExpr : public Expr {
 public:
+    NOVA_AST_NODE(ArrowFunctionExpr)
     std::vector<std::string> params;
-    std::vector<std::shared_ptr<Pattern>> paramPatterns;
+    std::vector<PatternPtr> paramPatterns;
     std::vector<ExprPtr> defaultValues;
     std::vector<TypePtr> paramTypes;  // Type annotations for parameters
     std::string restParam;  // Rest parameter name (empty if none)
@@ -281,6 +444,7 @@ public:
 
 class ClassExpr : public Expr {
 public:
+    NOVA_AST_NODE(ClassExpr)
     struct Property {
         std::string name;
         TypePtr type;
@@ -314,6 +478,7 @@ public:
 
 class NewExpr : public Expr {
 public:
+    NOVA_AST_NODE(NewExpr)
     ExprPtr callee;
     std::vector<ExprPtr> arguments;
     
@@ -324,18 +489,21 @@ public:
 
 class ThisExpr : public Expr {
 public:
+    NOVA_AST_NODE(ThisExpr)
     ThisExpr() = default;
     void accept(ASTVisitor& visitor) override;
 };
 
 class SuperExpr : public Expr {
 public:
+    NOVA_AST_NODE(SuperExpr)
     SuperExpr() = default;
     void accept(ASTVisitor& visitor) override;
 };
 
 class SpreadExpr : public Expr {
 public:
+    NOVA_AST_NODE(SpreadExpr)
     ExprPtr argument;
     
     explicit SpreadExpr(ExprPtr arg) : argument(arg) {}
@@ -344,6 +512,7 @@ public:
 
 class TemplateLiteralExpr : public Expr {
 public:
+    NOVA_AST_NODE(TemplateLiteralExpr)
     std::vector<std::string> quasis;
     std::vector<ExprPtr> expressions;
     
@@ -354,6 +523,7 @@ public:
 
 class AwaitExpr : public Expr {
 public:
+    NOVA_AST_NODE(AwaitExpr)
     ExprPtr argument;
     
     explicit AwaitExpr(ExprPtr arg) : argument(arg) {}
@@ -362,6 +532,7 @@ public:
 
 class YieldExpr : public Expr {
 public:
+    NOVA_AST_NODE(YieldExpr)
     ExprPtr argument;
     bool isDelegate;
     
@@ -373,6 +544,7 @@ public:
 // TypeScript-specific expressions
 class AsExpr : public Expr {
 public:
+    NOVA_AST_NODE(AsExpr)
     ExprPtr expression;
     TypePtr targetType;
     
@@ -383,6 +555,7 @@ public:
 
 class SatisfiesExpr : public Expr {
 public:
+    NOVA_AST_NODE(SatisfiesExpr)
     ExprPtr expression;
     TypePtr targetType;
     
@@ -393,6 +566,7 @@ public:
 
 class NonNullExpr : public Expr {
 public:
+    NOVA_AST_NODE(NonNullExpr)
     ExprPtr expression;
     
     explicit NonNullExpr(ExprPtr expr) : expression(expr) {}
@@ -401,6 +575,7 @@ public:
 
 class TaggedTemplateExpr : public Expr {
 public:
+    NOVA_AST_NODE(TaggedTemplateExpr)
     ExprPtr tag;
     std::vector<std::string> quasis;
     std::vector<ExprPtr> expressions;
@@ -412,6 +587,7 @@ public:
 
 class SequenceExpr : public Expr {
 public:
+    NOVA_AST_NODE(SequenceExpr)
     std::vector<ExprPtr> expressions;
     
     explicit SequenceExpr(std::vector<ExprPtr> exprs)
@@ -421,6 +597,7 @@ public:
 
 class AssignmentExpr : public Expr {
 public:
+    NOVA_AST_NODE(AssignmentExpr)
     enum class Op {
         Assign, AddAssign, SubAssign, MulAssign, DivAssign, ModAssign, PowAssign,
         LeftShiftAssign, RightShiftAssign, UnsignedRightShiftAssign,
@@ -431,7 +608,7 @@ public:
     Op op;
     ExprPtr left;
     ExprPtr right;
-    std::shared_ptr<Pattern> pattern;
+    PatternPtr pattern;
     
     AssignmentExpr(Op o, ExprPtr l, ExprPtr r)
         : op(o), left(l), right(r) {}
@@ -440,6 +617,7 @@ public:
 
 class ParenthesizedExpr : public Expr {
 public:
+    NOVA_AST_NODE(ParenthesizedExpr)
     ExprPtr expression;
     
     explicit ParenthesizedExpr(ExprPtr expr) : expression(expr) {}
@@ -448,6 +626,7 @@ public:
 
 class MetaProperty : public Expr {
 public:
+    NOVA_AST_NODE(MetaProperty)
     std::string meta;  // "new" or "import"
     std::string property;  // "target" or "meta"
     
@@ -458,6 +637,7 @@ public:
 
 class ImportExpr : public Expr {
 public:
+    NOVA_AST_NODE(ImportExpr)
     ExprPtr source;
     
     explicit ImportExpr(ExprPtr src) : source(src) {}
@@ -468,6 +648,7 @@ public:
 
 class JSXAttribute : public ASTNode {
 public:
+    NOVA_AST_NODE(JSXAttribute)
     std::string name;
     ExprPtr value;  // can be null for boolean attributes
     
@@ -478,6 +659,7 @@ public:
 
 class JSXSpreadAttribute : public ASTNode {
 public:
+    NOVA_AST_NODE(JSXSpreadAttribute)
     ExprPtr expression;
     
     explicit JSXSpreadAttribute(ExprPtr expr) : expression(std::move(expr)) {}
@@ -486,9 +668,10 @@ public:
 
 class JSXElement : public Expr {
 public:
+    NOVA_AST_NODE(JSXElement)
     std::string tagName;
-    std::vector<std::unique_ptr<JSXAttribute>> attributes;
-    std::vector<std::unique_ptr<JSXSpreadAttribute>> spreadAttributes;
+    std::vector<ASTRef<JSXAttribute>> attributes;
+    std::vector<ASTRef<JSXSpreadAttribute>> spreadAttributes;
     std::vector<ExprPtr> children;
     bool selfClosing;
     
@@ -499,6 +682,7 @@ public:
 
 class JSXFragment : public Expr {
 public:
+    NOVA_AST_NODE(JSXFragment)
     std::vector<ExprPtr> children;
     
     explicit JSXFragment(std::vector<ExprPtr> kids = {})
@@ -508,6 +692,7 @@ public:
 
 class JSXText : public Expr {
 public:
+    NOVA_AST_NODE(JSXText)
     std::string value;
     
     explicit JSXText(const std::string& val) : value(val) {}
@@ -516,6 +701,7 @@ public:
 
 class JSXExpressionContainer : public Expr {
 public:
+    NOVA_AST_NODE(JSXExpressionContainer)
     ExprPtr expression;
     
     explicit JSXExpressionContainer(ExprPtr expr) : expression(std::move(expr)) {}
@@ -525,19 +711,24 @@ public:
 // ==================== Destructuring Patterns ====================
 
 class Pattern : public ASTNode {
+public:
+    static bool classof(NodeKind kind) {
+        return kind >= NodeKind::ObjectPattern && kind <= NodeKind::IdentifierPattern;
+    }
 };
 
 class ObjectPattern : public Pattern {
 public:
+    NOVA_AST_NODE(ObjectPattern)
     struct Property {
         std::string key;
-        std::unique_ptr<Pattern> value;
+        PatternPtr value;
         ExprPtr defaultValue;
         bool shorthand;
     };
     
     std::vector<Property> properties;
-    std::unique_ptr<Pattern> rest;  // rest pattern
+    PatternPtr rest;  // rest pattern
     
     ObjectPattern() = default;
     void accept(ASTVisitor& visitor) override;
@@ -545,8 +736,9 @@ public:
 
 class ArrayPattern : public Pattern {
 public:
-    std::vector<std::unique_ptr<Pattern>> elements;
-    std::unique_ptr<Pattern> rest;
+    NOVA_AST_NODE(ArrayPattern)
+    std::vector<PatternPtr> elements;
+    PatternPtr rest;
     
     ArrayPattern() = default;
     void accept(ASTVisitor& visitor) override;
@@ -554,25 +746,28 @@ public:
 
 class AssignmentPattern : public Pattern {
 public:
-    std::unique_ptr<Pattern> left;
+    NOVA_AST_NODE(AssignmentPattern)
+    PatternPtr left;
     ExprPtr right;  // default value
     
-    AssignmentPattern(std::unique_ptr<Pattern> l, ExprPtr r)
+    AssignmentPattern(PatternPtr l, ExprPtr r)
         : left(std::move(l)), right(std::move(r)) {}
     void accept(ASTVisitor& visitor) override;
 };
 
 class RestElement : public Pattern {
 public:
-    std::unique_ptr<Pattern> argument;
+    NOVA_AST_NODE(RestElement)
+    PatternPtr argument;
     
-    explicit RestElement(std::unique_ptr<Pattern> arg)
+    explicit RestElement(PatternPtr arg)
         : argument(std::move(arg)) {}
     void accept(ASTVisitor& visitor) override;
 };
 
 class IdentifierPattern : public Pattern {
 public:
+    NOVA_AST_NODE(IdentifierPattern)
     std::string name;
     TypePtr type;
     
@@ -585,6 +780,7 @@ public:
 
 class Decorator : public ASTNode {
 public:
+    NOVA_AST_NODE(Decorator)
     std::string name;
     std::vector<ExprPtr> arguments;
     
@@ -596,10 +792,15 @@ public:
 // ==================== Statements ====================
 
 class Stmt : public ASTNode {
+public:
+    static bool classof(NodeKind kind) {
+        return kind >= NodeKind::BlockStmt && kind <= NodeKind::EmptyStmt;
+    }
 };
 
 class BlockStmt : public Stmt {
 public:
+    NOVA_AST_NODE(BlockStmt)
     std::vector<StmtPtr> statements;
     
     explicit BlockStmt(std::vector<StmtPtr> stmts)
@@ -609,6 +810,7 @@ public:
 
 class ExprStmt : public Stmt {
 public:
+    NOVA_AST_NODE(ExprStmt)
     ExprPtr expression;
     
     explicit ExprStmt(ExprPtr expr) : expression(expr) {}
@@ -617,11 +819,12 @@ public:
 
 class VarDeclStmt : public Stmt {
 public:
+    NOVA_AST_NODE(VarDeclStmt)
     enum class Kind { Var, Let, Const };
     
     struct Declarator {
         std::string name;                    // Simple variable name (empty if using pattern)
-        std::unique_ptr<Pattern> pattern;    // Destructuring pattern (null for simple vars)
+        PatternPtr pattern;    // Destructuring pattern (null for simple vars)
         ExprPtr init;
         TypePtr type;
     };
@@ -638,6 +841,7 @@ public:
 // ES2024 Explicit Resource Management: using declaration
 class UsingStmt : public Stmt {
 public:
+    NOVA_AST_NODE(UsingStmt)
     bool isAwait;  // true for 'await using', false for 'using'
     std::string name;
     ExprPtr init;
@@ -650,6 +854,7 @@ public:
 
 class DeclStmt : public Stmt {
 public:
+    NOVA_AST_NODE(DeclStmt)
     DeclPtr declaration;
     
     explicit DeclStmt(DeclPtr decl) : declaration(decl) {}
@@ -658,6 +863,7 @@ public:
 
 class IfStmt : public Stmt {
 public:
+    NOVA_AST_NODE(IfStmt)
     ExprPtr test;
     StmtPtr consequent;
     StmtPtr alternate;  // nullptr if no else
@@ -669,6 +875,7 @@ public:
 
 class WhileStmt : public Stmt {
 public:
+    NOVA_AST_NODE(WhileStmt)
     ExprPtr test;
     StmtPtr body;
     
@@ -678,6 +885,7 @@ public:
 
 class DoWhileStmt : public Stmt {
 public:
+    NOVA_AST_NODE(DoWhileStmt)
     StmtPtr body;
     ExprPtr test;
     
@@ -687,6 +895,7 @@ public:
 
 class ForStmt : public Stmt {
 public:
+    NOVA_AST_NODE(ForStmt)
     StmtPtr init;  // can be null
     ExprPtr test;  // can be null
     ExprPtr update;  // can be null
@@ -699,6 +908,7 @@ public:
 
 class ForInStmt : public Stmt {
 public:
+    NOVA_AST_NODE(ForInStmt)
     std::string left;      // variable name
     std::string kind;      // "var", "let", "const", or "" for existing variable
     ExprPtr right;
@@ -711,6 +921,7 @@ public:
 
 class ForOfStmt : public Stmt {
 public:
+    NOVA_AST_NODE(ForOfStmt)
     std::string left;      // variable name
     std::string kind;      // "var", "let", "const", or "" for existing variable
     ExprPtr right;
@@ -724,6 +935,7 @@ public:
 
 class ReturnStmt : public Stmt {
 public:
+    NOVA_AST_NODE(ReturnStmt)
     ExprPtr argument;  // nullptr for bare return
     
     explicit ReturnStmt(ExprPtr arg = nullptr) : argument(arg) {}
@@ -732,6 +944,7 @@ public:
 
 class BreakStmt : public Stmt {
 public:
+    NOVA_AST_NODE(BreakStmt)
     std::string label;
     
     explicit BreakStmt(const std::string& l = "") : label(l) {}
@@ -740,6 +953,7 @@ public:
 
 class ContinueStmt : public Stmt {
 public:
+    NOVA_AST_NODE(ContinueStmt)
     std::string label;
     
     explicit ContinueStmt(const std::string& l = "") : label(l) {}
@@ -748,6 +962,7 @@ public:
 
 class ThrowStmt : public Stmt {
 public:
+    NOVA_AST_NODE(ThrowStmt)
     ExprPtr argument;
     
     explicit ThrowStmt(ExprPtr arg) : argument(arg) {}
@@ -756,6 +971,7 @@ public:
 
 class TryStmt : public Stmt {
 public:
+    NOVA_AST_NODE(TryStmt)
     struct CatchClause {
         std::string param;
         StmtPtr body;
@@ -773,6 +989,7 @@ public:
 
 class SwitchStmt : public Stmt {
 public:
+    NOVA_AST_NODE(SwitchStmt)
     struct Case {
         ExprPtr test;  // nullptr for default case
         std::vector<StmtPtr> consequent;
@@ -789,6 +1006,7 @@ public:
 
 class LabeledStmt : public Stmt {
 public:
+    NOVA_AST_NODE(LabeledStmt)
     std::string label;
     StmtPtr statement;
     
@@ -799,6 +1017,7 @@ public:
 
 class WithStmt : public Stmt {
 public:
+    NOVA_AST_NODE(WithStmt)
     ExprPtr object;
     StmtPtr body;
     
@@ -808,12 +1027,14 @@ public:
 
 class DebuggerStmt : public Stmt {
 public:
+    NOVA_AST_NODE(DebuggerStmt)
     DebuggerStmt() = default;
     void accept(ASTVisitor& visitor) override;
 };
 
 class EmptyStmt : public Stmt {
 public:
+    NOVA_AST_NODE(EmptyStmt)
     EmptyStmt() = default;
     void accept(ASTVisitor& visitor) override;
 };
@@ -840,16 +1061,21 @@ using CatchClause = TryStmt::CatchClause;
 // ==================== Declarations ====================
 
 class Decl : public ASTNode {
+public:
+    static bool classof(NodeKind kind) {
+        return kind >= NodeKind::FunctionDecl && kind <= NodeKind::ExportDecl;
+    }
 };
 
 class FunctionDecl : public Decl {
 public:
+    NOVA_AST_NODE(FunctionDecl)
     std::string name;
     std::vector<std::string> typeParams;
     std::vector<TypePtr> typeParamConstraints;
     std::vector<TypePtr> typeParamDefaults;
     std::vector<std::string> params;
-    std::vector<std::shared_ptr<Pattern>> paramPatterns;
+    std::vector<PatternPtr> paramPatterns;
     std::vector<TypePtr> paramTypes;  // Type annotations for parameters
     std::vector<ExprPtr> defaultValues;  // Default values for parameters (nullptr if no default)
     std::string restParam;  // Rest parameter name (empty if none), e.g., "args" in function(...args)
@@ -874,6 +1100,7 @@ public:
 
 class ClassDecl : public Decl {
 public:
+    NOVA_AST_NODE(ClassDecl)
     struct Method {
         std::string name;
         std::vector<std::string> params;
@@ -885,7 +1112,7 @@ public:
         bool isOverride = false;
         std::vector<TypePtr> paramTypes;
         TypePtr returnType;
-        std::vector<std::unique_ptr<Decorator>> decorators;
+        std::vector<ASTRef<Decorator>> decorators;
         bool isComputed = false;
         ExprPtr computedKey;
     };
@@ -897,7 +1124,7 @@ public:
         bool isStatic = false;
         bool isReadonly = false;
         bool isOptional = false;
-        std::vector<std::unique_ptr<Decorator>> decorators;
+        std::vector<ASTRef<Decorator>> decorators;
         bool isComputed = false;
         ExprPtr computedKey;
     };
@@ -910,7 +1137,7 @@ public:
     std::vector<TypePtr> typeParamDefaults;
     std::vector<Method> methods;
     std::vector<Property> properties;
-    std::vector<std::unique_ptr<Decorator>> decorators;
+    std::vector<ASTRef<Decorator>> decorators;
     bool isAbstract = false;
     bool isDeclare = false;
     
@@ -920,6 +1147,7 @@ public:
 
 class InterfaceDecl : public Decl {
 public:
+    NOVA_AST_NODE(InterfaceDecl)
     struct MethodSignature {
         std::string name;
         std::vector<std::string> params;
@@ -947,6 +1175,7 @@ public:
 
 class TypeAliasDecl : public Decl {
 public:
+    NOVA_AST_NODE(TypeAliasDecl)
     std::string name;
     std::vector<std::string> typeParams;
     std::vector<TypePtr> typeParamConstraints;
@@ -959,6 +1188,7 @@ public:
 
 class NamespaceDecl : public Decl {
 public:
+    NOVA_AST_NODE(NamespaceDecl)
     std::string name;
     std::vector<StmtPtr> body;
     bool isDeclare = false;
@@ -969,6 +1199,7 @@ public:
 
 class EnumDecl : public Decl {
 public:
+    NOVA_AST_NODE(EnumDecl)
     struct Member {
         std::string name;
         ExprPtr initializer;
@@ -983,6 +1214,7 @@ public:
 
 class ImportDecl : public Decl {
 public:
+    NOVA_AST_NODE(ImportDecl)
     struct Specifier {
         std::string imported;
         std::string local;
@@ -999,6 +1231,7 @@ public:
 
 class ExportDecl : public Decl {
 public:
+    NOVA_AST_NODE(ExportDecl)
     struct Specifier {
         std::string local;
         std::string exported;
@@ -1018,9 +1251,12 @@ public:
 
 class Program : public ASTNode {
 public:
+    NOVA_AST_NODE(Program)
+    std::unique_ptr<ASTArena> arena;  // Owns every node reachable from body
     std::vector<StmtPtr> body;
     
-    explicit Program(std::vector<StmtPtr> b) : body(std::move(b)) {}
+    explicit Program(std::vector<StmtPtr> b, std::unique_ptr<ASTArena> a = nullptr)
+        : arena(std::move(a)), body(std::move(b)) {}
     void accept(ASTVisitor& visitor) override;
 };
 
@@ -1,9 +1,10 @@
 #pragma once
 
 #include "Token.h"
+#include <deque>
 #include <string>
+#include <string_view>
 #include <vector>
-#include <unordered_map>
 
 namespace nova {
 
@@ -14,6 +15,10 @@ public:
     
     // Convenience constructor for testing (filename = "<input>")
     explicit Lexer(const std::string& source);
+
+    // Tokens point into this lexer's buffers, so it must stay put.
+    Lexer(const Lexer&) = delete;
+    Lexer& operator=(const Lexer&) = delete;
     
     Token nextToken();
     Token peekToken();
@@ -30,19 +35,21 @@ public:
     
 private:
     std::string filename_;
-    std::string source_;
+    uint32_t fileId_;
+    std::string source_;        // Retained; token values are slices of it
     size_t position_;
     uint32_t line_;
     uint32_t column_;
 
     std::vector<Token> tokens_;
     std::vector<std::string> errors_;
+    std::deque<std::string> cooked_;  // Decoded literal values (stable addresses)
 
     TokenType lastTokenType_ = TokenType::Invalid;  // Track last token for regex context
     
-    static std::unordered_map<std::string, TokenType> keywords_;
-    
-    void initializeKeywords();
+    static TokenType classifyKeyword(std::string_view word);
+    std::string_view slice(size_t start) const;
+    std::string_view cook(std::string&& value);
     
     char currentChar() const;
     char peekChar(size_t offset = 1) const;
@@ -6,12 +6,16 @@
 #include <memory>
 #include <vector>
 #include <string>
+#include <utility>
 
 namespace nova {
 
 class Parser {
 public:
     explicit Parser(Lexer& lexer);
+    ~Parser();
+    Parser(const Parser&) = delete;
+    Parser& operator=(const Parser&) = delete;
     
     // Parse the entire program
     std::unique_ptr<Program> parseProgram();
@@ -33,81 +37,81 @@ private:
     Token consumeBindingIdentifier(const std::string& message);
     
     // Statement parsing
-    std::unique_ptr<Stmt> parseStatement();
-    std::unique_ptr<Stmt> parseVariableDeclaration();
-    std::unique_ptr<Stmt> parseVariableDeclarationWithoutSemicolon();
-    std::unique_ptr<Stmt> parseFunctionDeclaration();
-    std::unique_ptr<Stmt> parseClassDeclaration();
-    std::unique_ptr<Stmt> parseInterfaceDeclaration();
-    std::unique_ptr<Stmt> parseTypeAliasDeclaration();
-    std::unique_ptr<Stmt> parseNamespaceDeclaration();
-    std::unique_ptr<Stmt> parseEnumDeclaration();
-    std::unique_ptr<Stmt> parseImportDeclaration();
-    std::unique_ptr<Stmt> parseExportDeclaration();
-    std::unique_ptr<Stmt> parseBlockStatement();
-    std::unique_ptr<Stmt> parseExpressionStatement();
-    std::unique_ptr<Stmt> parseIfStatement();
-    std::unique_ptr<Stmt> parseWhileStatement();
-    std::unique_ptr<Stmt> parseDoWhileStatement();
-    std::unique_ptr<Stmt> parseForStatement();
-    std::unique_ptr<Stmt> parseForInStatement();
-    std::unique_ptr<Stmt> parseForOfStatement();
-    std::unique_ptr<Stmt> parseForInStatementBody(const std::string& variable, const std::string& kind);
-    std::unique_ptr<Stmt> parseForOfStatementBody(const std::string& variable, const std::string& kind);
-    std::unique_ptr<Stmt> parseForAwaitOfStatement();
-    std::unique_ptr<Stmt> parseSwitchStatement();
-    std::unique_ptr<Stmt> parseTryStatement();
-    std::unique_ptr<Stmt> parseThrowStatement();
-    std::unique_ptr<Stmt> parseReturnStatement();
-    std::unique_ptr<Stmt> parseBreakStatement();
-    std::unique_ptr<Stmt> parseContinueStatement();
-    std::unique_ptr<Stmt> parseDebuggerStatement();
-    std::unique_ptr<Stmt> parseWithStatement();
-    std::unique_ptr<Stmt> parseUsingStatement(bool isAwait = false);
+    StmtPtr parseStatement();
+    StmtPtr parseVariableDeclaration();
+    StmtPtr parseVariableDeclarationWithoutSemicolon();
+    StmtPtr parseFunctionDeclaration();
+    StmtPtr parseClassDeclaration();
+    StmtPtr parseInterfaceDeclaration();
+    StmtPtr parseTypeAliasDeclaration();
+    StmtPtr parseNamespaceDeclaration();
+    StmtPtr parseEnumDeclaration();
+    StmtPtr parseImportDeclaration();
+    StmtPtr parseExportDeclaration();
+    StmtPtr parseBlockStatement();
+    StmtPtr parseExpressionStatement();
+    StmtPtr parseIfStatement();
+    StmtPtr parseWhileStatement();
+    StmtPtr parseDoWhileStatement();
+    StmtPtr parseForStatement();
+    StmtPtr parseForInStatement();
+    StmtPtr parseForOfStatement();
+    StmtPtr parseForInStatementBody(const std::string& variable, const std::string& kind);
+    StmtPtr parseForOfStatementBody(const std::string& variable, const std::string& kind);
+    StmtPtr parseForAwaitOfStatement();
+    StmtPtr parseSwitchStatement();
+    StmtPtr parseTryStatement();
+    StmtPtr parseThrowStatement();
+    StmtPtr parseReturnStatement();
+    StmtPtr parseBreakStatement();
+    StmtPtr parseContinueStatement();
+    StmtPtr parseDebuggerStatement();
+    StmtPtr parseWithStatement();
+    StmtPtr parseUsingStatement(bool isAwait = false);
     
     // Expression parsing (precedence climbing)
-    std::unique_ptr<Expr> parseExpression();
-    std::unique_ptr<Expr> parseAssignmentExpression();
-    std::unique_ptr<Expr> parseConditionalExpression();
-    std::unique_ptr<Expr> parseLogicalOrExpression();
-    std::unique_ptr<Expr> parseLogicalAndExpression();
-    std::unique_ptr<Expr> parseBitwiseOrExpression();
-    std::unique_ptr<Expr> parseBitwiseXorExpression();
-    std::unique_ptr<Expr> parseBitwiseAndExpression();
-    std::unique_ptr<Expr> parseEqualityExpression();
-    std::unique_ptr<Expr> parseRelationalExpression();
-    std::unique_ptr<Expr> parseShiftExpression();
-    std::unique_ptr<Expr> parseAdditiveExpression();
-    std::unique_ptr<Expr> parseMultiplicativeExpression();
-    std::unique_ptr<Expr> parseExponentiationExpression();
-    std::unique_ptr<Expr> parseUnaryExpression();
-    std::unique_ptr<Expr> parsePostfixExpression();
-    std::unique_ptr<Expr> parsePrimaryExpression();
+    ExprPtr parseExpression();
+    ExprPtr parseAssignmentExpression();
+    ExprPtr parseConditionalExpression();
+    ExprPtr parseLogicalOrExpression();
+    ExprPtr parseLogicalAndExpression();
+    ExprPtr parseBitwiseOrExpression();
+    ExprPtr parseBitwiseXorExpression();
+    ExprPtr parseBitwiseAndExpression();
+    ExprPtr parseEqualityExpression();
+    ExprPtr parseRelationalExpression();
+    ExprPtr parseShiftExpression();
+    ExprPtr parseAdditiveExpression();
+    ExprPtr parseMultiplicativeExpression();
+    ExprPtr parseExponentiationExpression();
+    ExprPtr parseUnaryExpression();
+    ExprPtr parsePostfixExpression();
+    ExprPtr parsePrimaryExpression();
     
     // Primary expression helpers
-    std::unique_ptr<Expr> parseIdentifier();
-    std::unique_ptr<Expr> parseLiteral();
-    std::unique_ptr<Expr> parseArrayLiteral();
-    std::unique_ptr<Expr> parseObjectLiteral();
-    std::unique_ptr<Expr> parseFunctionExpression();
-    std::unique_ptr<Expr> parseArrowFunction();
-    std::unique_ptr<Expr> parseClassExpression();
-    std::unique_ptr<Expr> parseTemplateLiteral();
-    std::unique_ptr<Expr> parseParenthesizedExpression();
+    ExprPtr parseIdentifier();
+    ExprPtr parseLiteral();
+    ExprPtr parseArrayLiteral();
+    ExprPtr parseObjectLiteral();
+    ExprPtr parseFunctionExpression();
+    ExprPtr parseArrowFunction();
+    ExprPtr parseClassExpression();
+    ExprPtr parseTemplateLiteral();
+    ExprPtr parseParenthesizedExpression();
     
     // Member/call expression helpers
-    std::unique_ptr<Expr> parseMemberExpression(std::unique_ptr<Expr> object);
-    std::unique_ptr<Expr> parseCallExpression(std::unique_ptr<Expr> callee);
-    std::unique_ptr<Expr> parseComputedMemberExpression(std::unique_ptr<Expr> object);
+    ExprPtr parseMemberExpression(ExprPtr object);
+    ExprPtr parseCallExpression(ExprPtr callee);
+    ExprPtr parseComputedMemberExpression(ExprPtr object);
     
     // JSX/TSX parsing
-    std::unique_ptr<Expr> parseJSXElement();
-    std::unique_ptr<Expr> parseJSXChild();
+    ExprPtr parseJSXElement();
+    ExprPtr parseJSXChild();
     
     // Destructuring pattern parsing
-    std::unique_ptr<Pattern> parseBindingPattern();
-    std::unique_ptr<Pattern> parseObjectPattern();
-    std::unique_ptr<Pattern> parseArrayPattern();
+    PatternPtr parseBindingPattern();
+    PatternPtr parseObjectPattern();
+    PatternPtr parseArrayPattern();
     
     // Type annotation parsing
     std::unique_ptr<TypeAnnotation> parseTypeAnnotation();
@@ -126,8 +130,8 @@ private:
     void consumeTypeArgumentClose(const std::string& message);
     
     // Decorator parsing
-    std::unique_ptr<Decorator> parseDecorator();
-    std::vector<std::unique_ptr<Decorator>> parseDecorators();
+    ASTRef<Decorator> parseDecorator();
+    std::vector<ASTRef<Decorator>> parseDecorators();
     
     // Helper functions
     bool isAtEnd() const;
@@ -139,10 +143,17 @@ private:
     // consumes the tokens on success; returns false and restores position
     // on failure (so callers can treat `<` as a comparison operator).
     bool tryParseTypeArguments();
+
+    // Allocates a node in the arena of the tree being parsed.
+    template <typename T, typename... Args>
+    ASTRef<T> make(Args&&... args) {
+        return arena_->make<T>(std::forward<Args>(args)...);
+    }
     
     Lexer& lexer_;
     std::vector<Token> tokens_;
     size_t current_;
+    std::unique_ptr<ASTArena> arena_;  // Owns nodes until handed to a Program
     std::vector<std::string> errors_;
     unsigned pendingTypeArgumentClosers_ = 0;
     unsigned ambientDepth_ = 0;
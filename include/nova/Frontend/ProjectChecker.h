@@ -0,0 +1,47 @@
+#pragma once
+
+#include "nova/Frontend/TypeChecker.h"
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace nova {
+
+struct ProjectCheckOptions {
+    // Per-file results are kept here between runs; empty disables the cache.
+    std::string cacheFile;
+    // Worker threads; 0 uses one per hardware thread.
+    unsigned jobs = 0;
+};
+
+struct ProjectCheckResult {
+    std::vector<std::string> files;        // Every module checked, sorted
+    std::vector<std::string> diagnostics;  // Grouped by file in `files` order
+    size_t checked = 0;                    // Modules type-checked this run
+    size_t reused = 0;                     // Modules answered from the cache
+    bool success() const { return diagnostics.empty(); }
+};
+
+// Type-checks a set of modules that import each other. The inputs are
+// files or directories (searched for .ts/.tsx, skipping node_modules and
+// dot directories), and relative imports pull in the files they name.
+//
+// A module is checked once everything it imports has been, and sees the
+// exported types of those modules; modules that do not depend on each other
+// are checked in parallel. Each module's exported types are reduced to a
+// signature (TypeChecker::exportSignature) and cached next to its content
+// hash and diagnostics, so a module whose text and whose imports'
+// signatures are unchanged keeps its cached diagnostics without being
+// parsed. Editing a function body therefore rechecks that file alone;
+// editing an exported type also rechecks its importers. Modules in an import
+// cycle are always checked, one after another, once the rest are done.
+class ProjectChecker {
+public:
+    explicit ProjectChecker(ProjectCheckOptions options = {});
+    ProjectCheckResult check(const std::vector<std::string>& inputs);
+
+private:
+    ProjectCheckOptions options_;
+};
+
+} // namespace nova
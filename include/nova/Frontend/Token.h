@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <vector>
 #include <memory>
 #include <cstdint>
@@ -162,27 +163,46 @@ enum class TokenType {
     Invalid
 };
 
+// Filenames are registered once per process and referenced by a 32-bit
+// ID, so copying a location (and with it every token and AST node) never
+// copies a path. ID 0 is the empty filename.
+class SourceFiles {
+public:
+    static uint32_t intern(const std::string& filename);
+    static const std::string& name(uint32_t id);
+};
+
 struct SourceLocation {
-    std::string filename;
+    uint32_t fileId;
     uint32_t line;
     uint32_t column;
     uint32_t offset;
     
-    SourceLocation() : line(0), column(0), offset(0) {}
+    SourceLocation() : fileId(0), line(0), column(0), offset(0) {}
+    SourceLocation(uint32_t file, uint32_t l, uint32_t c, uint32_t o)
+        : fileId(file), line(l), column(c), offset(o) {}
     SourceLocation(const std::string& file, uint32_t l, uint32_t c, uint32_t o)
-        : filename(file), line(l), column(c), offset(o) {}
+        : fileId(SourceFiles::intern(file)), line(l), column(c), offset(o) {}
+
+    const std::string& filename() const { return SourceFiles::name(fileId); }
 };
 
+// A token is a view into memory owned by the Lexer that produced it: the
+// retained source buffer for identifiers, numbers, operators and escape-free
+// literals, or the lexer's cooked-literal storage when escapes had to be
+// decoded. Tokens must not outlive their Lexer.
 class Token {
 public:
     TokenType type;
-    std::string value;
+    std::string_view value;
     SourceLocation location;
     
     Token() : type(TokenType::Invalid) {}
-    Token(TokenType t, const std::string& v, const SourceLocation& loc)
+    Token(TokenType t, std::string_view v, const SourceLocation& loc)
         : type(t), value(v), location(loc) {}
     
+    std::string text() const { return std::string(value); }
+
     bool is(TokenType t) const { return type == t; }
     bool isNot(TokenType t) const { return type != t; }
     bool isOneOf(TokenType t1, TokenType t2) const {
@@ -1,8 +1,10 @@
 #pragma once
 
 #include "nova/Frontend/AST.h"
+#include <functional>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 namespace nova {
@@ -35,12 +37,6 @@ struct TypeCheckerOptions {
 
 class TypeChecker {
 public:
-    explicit TypeChecker(TypeCheckerOptions opts = {});
-    bool check(Program& program);
-    const std::vector<std::string>& diagnostics() const { return diagnostics_; }
-    const TypeCheckerOptions& options() const { return options_; }
-
-private:
     struct FunctionSignature {
         std::vector<std::string> typeParameters;
         std::vector<TypePtr> typeParameterConstraints;
@@ -57,6 +53,37 @@ private:
         TypePtr body;
     };
 
+    // Everything a module makes visible to its importers, by exported name.
+    // Types in here belong to the checker (and Program) that produced them
+    // and are only read by importers.
+    struct ModuleExports {
+        std::unordered_map<std::string, TypePtr> values;
+        std::unordered_map<std::string, TypePtr> types;
+        std::unordered_map<std::string, GenericTypeDeclaration> genericTypes;
+        std::unordered_map<std::string, FunctionSignature> functions;
+        std::unordered_map<std::string, std::vector<FunctionSignature>> overloads;
+        std::unordered_map<std::string, std::vector<TypePtr>> constructors;
+    };
+
+    // Maps an import specifier to the exports of the module it names, or to
+    // null when that module is not being checked (its bindings stay `any`).
+    using ImportResolver =
+        std::function<const ModuleExports*(const std::string& specifier)>;
+
+    explicit TypeChecker(TypeCheckerOptions opts = {});
+    bool check(Program& program);
+    const std::vector<std::string>& diagnostics() const { return diagnostics_; }
+    const TypeCheckerOptions& options() const { return options_; }
+
+    void setImportResolver(ImportResolver resolver) {
+        importResolver_ = std::move(resolver);
+    }
+    const ModuleExports& exports() const { return exports_; }
+    // Canonical text of every exported type and signature. Two checks of a
+    // module with the same signature look identical to its importers.
+    std::string exportSignature() const;
+
+private:
     std::vector<std::unordered_map<std::string, TypePtr>> scopes_;
     std::unordered_map<std::string, FunctionSignature> functions_;
     std::unordered_map<std::string, std::vector<FunctionSignature>> overloads_;
@@ -66,6 +93,8 @@ private:
     std::vector<std::string> diagnostics_;
     TypePtr expectedReturnType_;
     TypeCheckerOptions options_;
+    ImportResolver importResolver_;
+    ModuleExports exports_;
 
     void pushScope();
     void popScope();
@@ -74,6 +103,9 @@ private:
     void checkStatement(Stmt* statement);
     void checkDeclaration(Decl* declaration);
     void checkFunction(FunctionDecl& function);
+    void bindImport(const ImportDecl& import,
+                    const std::unordered_set<std::string>& declared);
+    void collectExports(Program& program);
     TypePtr inferExpression(Expr* expression);
     TypePtr resolveType(const TypePtr& type) const;
     TypePtr evaluateType(
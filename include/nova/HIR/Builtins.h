@@ -0,0 +1,186 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace nova::hir::builtins {
+
+// Parameter and return types of a builtin, spelled as in Builtins.def.
+enum class Type : char {
+    Void = 'v', I64 = 'i', F64 = 'd', Pointer = 'p', String = 's', Any = 'a'
+};
+
+// Memory and control-flow effects, attached to the declaration by codegen.
+enum Effects : unsigned {
+    None = 0,
+    Reads = 1,   // readonly nounwind willreturn
+    Pure = 2,    // readnone nounwind willreturn
+};
+
+struct Builtin {
+    std::string_view name;
+    std::string_view symbol;
+    std::string_view signature;
+    Effects effects;
+    std::string_view intrinsic;
+
+    constexpr Type returnType() const { return static_cast<Type>(signature[0]); }
+    constexpr size_t paramCount() const { return signature.size() - 3; }
+    constexpr Type paramType(size_t i) const {
+        return static_cast<Type>(signature[2 + i]);
+    }
+};
+
+inline constexpr Builtin kBuiltins[] = {
+#define NOVA_BUILTIN(NAME, SYMBOL, SIGNATURE, EFFECTS, INTRINSIC) \
+    {NAME, SYMBOL, SIGNATURE, EFFECTS, INTRINSIC},
+#include "nova/HIR/Builtins.def"
+#undef NOVA_BUILTIN
+};
+
+inline constexpr size_t kBuiltinCount = sizeof(kBuiltins) / sizeof(kBuiltins[0]);
+
+namespace detail {
+
+constexpr uint64_t hash(std::string_view key, uint64_t seed) {
+    uint64_t h = 0xcbf29ce484222325ull ^ (seed * 0x9e3779b97f4a7c15ull);
+    for (char c : key) {
+        h ^= static_cast<unsigned char>(c);
+        h *= 0x100000001b3ull;
+    }
+    return h ^ (h >> 29);
+}
+
+constexpr bool validSignature(std::string_view s) {
+    constexpr std::string_view types = "vidpsa";
+    if (s.size() < 3 || s[1] != '(' || s.back() != ')') return false;
+    if (types.find(s[0]) == std::string_view::npos) return false;
+    for (size_t i = 2; i + 1 < s.size(); ++i) {
+        if (s[i] == 'v' || types.find(s[i]) == std::string_view::npos) return false;
+    }
+    return true;
+}
+
+// Hash-and-displace perfect hash over one field of kBuiltins: a key's first
+// hash picks a bucket, and the bucket's seed rehashes it into a slot no
+// other key occupies. Buckets are placed largest first while slots are
+// still free. Entries with an empty key are left out, and a key repeated
+// later in the table (several names sharing a symbol) keeps its first
+// entry.
+struct Index {
+    static constexpr size_t kBuckets = kBuiltinCount / 2 + 1;
+    static constexpr uint16_t kEmpty = 0xffff;
+
+    std::array<uint32_t, kBuckets> seeds{};
+    std::array<uint16_t, kBuiltinCount> slots{};
+    bool ok = false;
+    bool unique = true;
+
+    constexpr explicit Index(std::string_view Builtin::*field) {
+        for (auto& slot : slots) slot = kEmpty;
+
+        std::array<bool, kBuiltinCount> included{};
+        std::array<size_t, kBuiltinCount> bucketOf{};
+        std::array<size_t, kBuckets> bucketSize{};
+        for (size_t i = 0; i < kBuiltinCount; ++i) {
+            std::string_view key = kBuiltins[i].*field;
+            if (key.empty()) continue;
+            bool repeated = false;
+            for (size_t j = 0; j < i; ++j) {
+                if (kBuiltins[j].*field == key) repeated = true;
+            }
+            if (repeated) {
+                unique = false;
+                continue;
+            }
+            included[i] = true;
+            bucketOf[i] = hash(key, 0) % kBuckets;
+            ++bucketSize[bucketOf[i]];
+        }
+
+        std::array<bool, kBuckets> placed{};
+        for (size_t round = 0; round < kBuckets; ++round) {
+            size_t bucket = kBuckets;
+            for (size_t b = 0; b < kBuckets; ++b) {
+                if (!placed[b] && (bucket == kBuckets || bucketSize[b] > bucketSize[bucket])) {
+                    bucket = b;
+                }
+            }
+            placed[bucket] = true;
+            if (bucketSize[bucket] == 0) continue;
+
+            bool found = false;
+            for (uint32_t seed = 1; seed < 100000 && !found; ++seed) {
+                std::array<size_t, kBuiltinCount> taken{};
+                size_t count = 0;
+                bool fits = true;
+                for (size_t i = 0; i < kBuiltinCount && fits; ++i) {
+                    if (!included[i] || bucketOf[i] != bucket) continue;
+                    size_t slot = hash(kBuiltins[i].*field, seed) % kBuiltinCount;
+                    if (slots[slot] != kEmpty) fits = false;
+                    for (size_t k = 0; k < count && fits; ++k) {
+                        if (taken[k] == slot) fits = false;
+                    }
+                    taken[count++] = slot;
+                }
+                if (!fits) continue;
+                size_t k = 0;
+                for (size_t i = 0; i < kBuiltinCount; ++i) {
+                    if (included[i] && bucketOf[i] == bucket) {
+                        slots[taken[k++]] = static_cast<uint16_t>(i);
+                    }
+                }
+                seeds[bucket] = seed;
+                found = true;
+            }
+            if (!found) return;
+        }
+        ok = true;
+    }
+
+    constexpr const Builtin* find(std::string_view Builtin::*field,
+                                  std::string_view key) const {
+        if (key.empty()) return nullptr;
+        uint32_t seed = seeds[hash(key, 0) % kBuckets];
+        if (seed == 0) return nullptr;
+        uint16_t index = slots[hash(key, seed) % kBuiltinCount];
+        if (index == kEmpty || kBuiltins[index].*field != key) return nullptr;
+        return &kBuiltins[index];
+    }
+};
+
+inline constexpr Index kByName{&Builtin::name};
+inline constexpr Index kBySymbol{&Builtin::symbol};
+
+constexpr bool validTable() {
+    for (const auto& builtin : kBuiltins) {
+        if (builtin.symbol.empty() || !validSignature(builtin.signature)) return false;
+    }
+    return true;
+}
+
+static_assert(kBuiltinCount < Index::kEmpty, "builtin table too large for the index");
+static_assert(validTable(), "malformed entry in Builtins.def");
+static_assert(kByName.ok && kBySymbol.ok, "no perfect hash found for Builtins.def");
+static_assert(kByName.unique, "duplicate name in Builtins.def");
+
+} // namespace detail
+
+// Looks a builtin up by its JavaScript name ("Math.sqrt",
+// "String.prototype.indexOf", "nova:fs.readFileSync").
+constexpr const Builtin* lookup(std::string_view name) {
+    return detail::kByName.find(&Builtin::name, name);
+}
+
+// Looks a builtin up by the runtime or libc symbol it calls.
+constexpr const Builtin* lookupSymbol(std::string_view symbol) {
+    return detail::kBySymbol.find(&Builtin::symbol, symbol);
+}
+
+static_assert(lookup("Math.sqrt") && lookup("Math.sqrt")->symbol == "sqrt");
+static_assert(lookupSymbol("nova_string_trimStart")->name == "String.prototype.trimStart");
+static_assert(!lookup("Math.nope") && !lookupSymbol(""));
+
+} // namespace nova::hir::builtins
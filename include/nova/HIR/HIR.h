@@ -44,6 +44,11 @@ public:
     
     explicit HIRType(Kind k) : kind(k) {}
     virtual ~HIRType() = default;
+
+    // Shared, immutable instance of the plain type of `kind`. Plain types
+    // carry nothing beyond their kind, so every use of e.g. I64 can point
+    // at the same object instead of allocating its own.
+    static HIRTypePtr get(Kind kind);
     
     bool isInteger() const;
     bool isFloat() const;
@@ -139,6 +144,20 @@ public:
     virtual std::string toString() const;
 };
 
+// Non-owning shared_ptr to an HIR object whose lifetime is managed
+// elsewhere (values by their block or builder, blocks and functions by
+// their parent, struct types by the module). It aliases an empty owner, so
+// it allocates no control block and copies never touch a reference count.
+template <typename T>
+inline std::shared_ptr<T> unownedRef(T* object) {
+    return std::shared_ptr<T>(std::shared_ptr<T>(), object);
+}
+
+// Non-owning operand reference; see unownedRef.
+inline HIRValuePtr unownedValue(HIRValue* value) {
+    return unownedRef(value);
+}
+
 class HIRConstant : public HIRValue {
 public:
     enum class Kind {
@@ -178,6 +178,33 @@ private:
         const std::unordered_map<std::string, HIRValue*>& enclosingLocals,
         const std::string& childFunction);
     HIRValue* applyDestructuringDefault(HIRValue* value, Expr* defaultValue);
+    // Inline expansion (passes/InlineExpansion.cpp). Each returns true when
+    // the call was expanded in place and lastValue_ holds its result.
+    bool tryInlineArrayCallback(CallExpr& node, const std::string& methodName,
+                                HIRValue* array);
+    bool tryInlineDirectCall(CallExpr& node);
+    bool isInlinableIntegerBinding(const std::string& name);
+    // Scalar replacement of destructured literals
+    // (passes/ScalarReplacement.cpp).
+    struct ScalarReplacedBinding {
+        Pattern* pattern;
+        HIRValue* value;
+        Expr* defaultValue;
+    };
+    bool canScalarReplace(Pattern* pattern, Expr* init);
+    void evaluateScalarReplaced(Pattern* pattern, Expr* init,
+                                std::vector<ScalarReplacedBinding>& bindings);
+    bool tryScalarReplaceDestructuring(Pattern* pattern, Expr* init,
+                                       bool assignToExisting);
+    // Bounds-check elimination (passes/BoundsCheckElimination.cpp).
+    bool matchCanonicalArrayLoop(ForStmt& node, std::string& array,
+                                 std::string& index);
+    void beginCanonicalArrayLoop(const std::string& array,
+                                 const std::string& index);
+    void endCanonicalArrayLoop();
+    HIRValue* loadCanonicalLoopArray(const std::string& array);
+    bool tryCanonicalLoopAccess(MemberExpr& node);
+    bool isCanonicalTypedArrayElement(const std::string& array, Expr* index) const;
     void bindDestructuringPattern(Pattern* pattern, HIRValue* value,
                                   Expr* defaultValue = nullptr);
     void assignDestructuringPattern(Pattern* pattern, HIRValue* value);
@@ -258,7 +285,7 @@ private:
     HIRValue* pendingBoundThis_ = nullptr;
     std::string lastFunctionName_;  // Tracks the last created arrow function name
     std::unordered_map<std::string, const std::vector<ExprPtr>*> functionDefaultValues_;  // Maps function names to default values
-    std::unordered_map<std::string, std::vector<std::shared_ptr<Pattern>>>
+    std::unordered_map<std::string, std::vector<PatternPtr>>
         functionParameterPatterns_;
     std::unordered_map<std::string, std::unordered_set<size_t>>
         dynamicObjectParameterIndices_;
@@ -285,6 +312,9 @@ private:
     std::unordered_map<std::string, hir::HIRStructType*> classStructTypes_;  // Maps className -> struct type
     std::unordered_map<std::string, std::unordered_set<std::string>> classOwnMethods_;  // Maps className -> method names defined in that class (for inheritance resolution)
     std::unordered_map<std::string, FunctionDecl*> functionDeclarations_;
+    // Trees of imported modules. The maps above hold non-owning links into
+    // them, so their arenas live as long as the generator.
+    std::vector<std::unique_ptr<Program>> importedPrograms_;
     std::unordered_map<std::string, int64_t>
         legacyDecoratedMethodResultMultipliers_;
 
@@ -414,6 +444,15 @@ private:
     // Runtime array tracking
     std::unordered_set<std::string> runtimeArrayVars_;
     std::unordered_set<std::string> taggedRuntimeArrayVars_;
+    // Canonical `for (i < a.length)` loops whose bounds checks were hoisted
+    // (passes/BoundsCheckElimination.cpp), innermost last.
+    struct CanonicalArrayLoop {
+        std::string array;
+        std::string index;
+        HIRValue* length;
+        bool typedArray;
+    };
+    std::vector<CanonicalArrayLoop> canonicalArrayLoops_;
     std::unordered_set<std::string> intlPartsVars_;
     std::unordered_set<std::string> regexVars_;
     std::unordered_set<std::string> regexMatchVars_;
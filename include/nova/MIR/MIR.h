@@ -39,6 +39,9 @@ public:
     
     explicit MIRType(Kind k) : kind(k), sizeInBytes(0), alignment(0) {}
     virtual ~MIRType() = default;
+
+    // Interned instance of `kind`, shared by every place that uses it.
+    static MIRTypePtr get(Kind kind);
     
     virtual std::string toString() const;
 };
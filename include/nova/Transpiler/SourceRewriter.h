@@ -0,0 +1,128 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace nova {
+namespace transpiler {
+
+// What the single-pass emitter should do with one file. The Transpiler
+// derives this from CompilerOptions; specifier rewriting (paths, baseUrl,
+// rewriteRelativeImportExtensions) stays with the Transpiler because it
+// needs the project layout.
+struct EmitOptions {
+    bool commonJS = true;
+    bool esModuleInterop = true;
+    bool verbatimModuleSyntax = false;  // keep unused value imports
+    bool downlevelES5 = false;          // let/const, arrows, templates
+    bool removeComments = false;
+    bool minify = false;
+    bool sourceMap = false;             // collect VLQ mappings
+
+    bool transformJSX = false;
+    bool jsxAutomatic = false;          // react-jsx: _jsx/_jsxs calls
+    std::string jsxFactory = "React.createElement";
+    std::string jsxFragmentFactory = "React.Fragment";
+
+    std::function<std::string(const std::string&)> rewriteSpecifier;
+};
+
+struct EmitResult {
+    std::string code;
+    std::string mappings;        // source map "mappings" field
+    bool usesJSXRuntime = false; // automatic runtime import required
+    std::vector<std::string> imports; // specifiers the output loads, as
+                                      // written, in first-use order
+};
+
+// Top-level shape of an emitted ES module, as the bundler needs it: where
+// each statement starts and ends, what it declares and whether it can be
+// dropped, the module's imports and exports, and every identifier that
+// names a binding (as opposed to a property key or member name). Offsets
+// are byte offsets into the scanned code.
+struct ModuleScan {
+    enum class StatementKind { Import, Export, Declaration, Other };
+
+    struct Statement {
+        StatementKind kind = StatementKind::Other;
+        uint32_t begin = 0;
+        uint32_t end = 0;
+        uint32_t code = 0;               // past `export` / `export default`
+        std::vector<std::string> declares;
+        bool pure = false;               // no side effects when evaluated
+        bool defaultExpression = false;  // `export default <expression>`
+        uint32_t anonymous = UINT32_MAX; // where an anonymous default
+                                         // function or class needs a name
+    };
+
+    struct Name {
+        uint32_t begin = 0;
+        uint32_t end = 0;
+        bool shorthand = false;          // `{ name }` property
+        uint32_t memberEnd = 0;          // end of a `.property` after it
+        std::string member;
+    };
+
+    struct Import {
+        std::string specifier;
+        std::string imported;            // name, "default", "*", or "" for
+                                         // `import "m"`
+        std::string local;
+    };
+
+    struct Export {
+        std::string exported;            // "*" for `export * from`
+        std::string local;               // binding, or the imported name
+                                         // when re-exporting ("*" for all)
+        std::string from;                // re-export specifier
+    };
+
+    std::vector<Statement> statements;
+    std::vector<Import> imports;
+    std::vector<Export> exports;
+    std::vector<std::string> requests;   // specifiers in source order
+    std::vector<Name> names;             // sorted by offset
+    std::vector<std::string> warnings;
+};
+
+// Export default of an expression or anonymous declaration binds this.
+constexpr const char* kDefaultExportLocal = "*default*";
+
+class TokenStream;
+
+// TypeScript to JavaScript rewriter. The source is lexed once; type syntax,
+// TS-only declarations and module syntax are turned into a sorted list of
+// edits against the token stream, and the output is printed in one forward
+// pass that copies the untouched source between edits. Source maps fall out
+// of the print: every copied run and inserted edit records where it came
+// from.
+class SourceRewriter {
+public:
+    SourceRewriter(const std::string& source, const std::string& filename);
+    ~SourceRewriter();
+
+    SourceRewriter(const SourceRewriter&) = delete;
+    SourceRewriter& operator=(const SourceRewriter&) = delete;
+
+    EmitResult emitJavaScript(const EmitOptions& options) const;
+
+    // Public surface of the module as a .d.ts file: interfaces, type
+    // aliases and enums verbatim, signatures of exported functions,
+    // classes and variables. Mappings are per declaration.
+    EmitResult emitDeclarations() const;
+
+    // Module structure for bundling. Expects JavaScript, i.e. the output
+    // of emitJavaScript with ES module syntax.
+    ModuleScan scanModule() const;
+
+private:
+    const std::string& source_;
+    std::string filename_;
+    std::unique_ptr<TokenStream> tokens_;
+};
+
+} // namespace transpiler
+} // namespace nova
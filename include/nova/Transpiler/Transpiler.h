@@ -8,6 +8,8 @@
 #include <functional>
 #include <set>
 
+#include "nova/Transpiler/SourceRewriter.h"
+
 namespace nova {
 namespace transpiler {
 
@@ -204,6 +206,7 @@ struct TranspileResult {
     bool success;
     std::vector<std::string> errors;
     std::vector<std::string> warnings;
+    std::vector<std::string> imports;  // project files the output loads
 
     // Stats
     size_t inputSize;
@@ -225,6 +228,25 @@ struct BuildResult {
     size_t totalOutputSize;
 };
 
+// Bundle result
+struct BundleResult {
+    std::string outFile;
+    std::string code;
+    std::string sourceMap;
+    bool success = false;
+    std::vector<std::string> modules;     // in output order
+    std::map<std::string, std::vector<std::string>> imports;  // module graph
+    std::vector<std::string> errors;
+    std::vector<std::string> warnings;
+
+    // Stats
+    size_t totalInputSize = 0;
+    size_t outputSize = 0;
+    int keptStatements = 0;
+    int droppedStatements = 0;            // tree-shaken declarations
+    double totalTimeMs = 0;
+};
+
 class Transpiler {
 public:
     Transpiler();
@@ -246,6 +268,12 @@ public:
     // Build entire project (using tsconfig.json)
     BuildResult build(const std::string& projectPath = ".");
 
+    // Bundle everything reachable from `entries` into `outFile`: modules
+    // are loaded and resolved on a pool of workers, hoisted into one scope
+    // in a deterministic order, and declarations nothing uses are dropped.
+    // Bare specifiers stay external.
+    BundleResult bundle(const std::vector<std::string>& entries, const std::string& outFile);
+
     // Watch mode
     void watch(const std::string& projectPath, std::function<void(const TranspileResult&)> callback);
 
@@ -254,32 +282,34 @@ private:
     std::string projectRoot_;
     std::string configDir_;  // Directory containing tsconfig.json
 
-    // Build cache for incremental builds
+    // Build cache for incremental builds. Saved to the build info file, so
+    // it also makes a cold start incremental; fileImports is the module
+    // graph (edges from a file to the project files it loads).
     struct BuildCache {
         std::map<std::string, std::filesystem::file_time_type> fileModTimes;
         std::map<std::string, std::string> fileHashes;
+        std::map<std::string, std::vector<std::string>> fileImports;
         bool isValid = false;
     } buildCache_;
 
+    // Transpiled modules kept by the bundler between builds (Bundler.cpp)
+    std::shared_ptr<struct BundleModuleCache> bundleCache_;
+
     // Internal methods
-    std::string transformTypeScript(const std::string& source, const std::string& filename);
-    std::string removeTypeAnnotations(const std::string& source);
-    std::string transformImports(const std::string& source);
-    std::string transformExports(const std::string& source);
-    std::string transformJSX(const std::string& source);
-    std::string transformPaths(
-        const std::string& source, const std::string& filename);
-    std::string downlevelToTarget(const std::string& source);
-    std::string minifyCode(const std::string& source);
-    std::string generateSourceMap(const std::string& source, const std::string& output, const std::string& filename);
-    std::string generateDeclaration(const std::string& source);
-    std::string generateDeclarationMap(const std::string& source, const std::string& dtsCode, const std::string& filename);
+    EmitResult transformTypeScript(const SourceRewriter& rewriter, const std::string& filename);
+    EmitOptions emitOptionsFor(const std::string& filename) const;
+    std::string rewriteModuleSpecifier(const std::string& specifier, const std::string& filename) const;
+    std::string generateSourceMap(const std::string& source, const std::string& mappings, const std::string& filename);
+    std::string generateDeclarationMap(const std::string& mappings, const std::string& filename);
 
     std::vector<std::string> findSourceFiles(const std::string& projectPath);
     bool matchesGlob(const std::string& path, const std::string& pattern);
-    std::string resolveOutputPath(const std::string& inputPath, const std::string& ext);
+    std::string resolveOutputPath(const std::string& inputPath, const std::string& ext) const;
     std::string resolveConfigRelativePath(const std::string& path) const;
 
+    // Bundler helpers (Bundler.cpp)
+    std::string resolveImport(const std::string& specifier, const std::string& importer) const;
+
     // Config helpers
     bool loadConfigRecursive(const std::string& configPath, std::set<std::string>& visited);
     void mergeConfig(const TSConfig& base);
@@ -287,8 +317,15 @@ private:
 
     // Incremental build helpers
     bool needsRebuild(const std::string& filePath);
+    void recordBuilt(const TranspileResult& fileResult);
+    std::set<std::string> dependentsOf(const std::set<std::string>& files) const;
+    std::string buildInfoPath() const;
     void saveBuildInfo();
     void loadBuildInfo();
+
+    // Transpile on the worker pool; results keep the input order.
+    std::vector<TranspileResult> transpileFiles(const std::vector<std::string>& files);
+    void writeOutputs(const TranspileResult& fileResult);
 };
 
 // Utility functions
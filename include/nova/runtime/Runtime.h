@@ -104,6 +104,8 @@ void* allocate(size_t size, TypeId type_id);
 void deallocate(void* ptr);
 size_t get_object_size(void* ptr);
 TypeId get_object_type(void* ptr);
+size_t get_allocation_count();
+size_t get_lifetime_allocation_count();
 
 // Garbage collection functions
 void initialize_gc(size_t heap_size = 1024 * 1024);
@@ -21,6 +21,7 @@
 #include <llvm/IR/LegacyPassManager.h>
 #include <llvm/IR/IRBuilder.h>
 #include <llvm/IR/Intrinsics.h>
+#include <llvm/IR/MDBuilder.h>
 #include <llvm/Transforms/Scalar.h>
 #include <llvm/Transforms/IPO.h>
 #include <llvm/Transforms/Utils.h>
@@ -30,12 +31,19 @@
 #include <llvm/Transforms/Scalar/SimplifyCFG.h>
 #include <llvm/Transforms/Scalar/DCE.h>
 #include <llvm/Transforms/IPO/AlwaysInliner.h>
+#include <llvm/Transforms/Vectorize.h>
+#include <llvm/Analysis/TargetTransformInfo.h>
 #include <llvm/Support/FileSystem.h>
 #include <llvm/Support/raw_ostream.h>
 #include <llvm/Support/TargetSelect.h>
 #include <llvm/Target/TargetMachine.h>
 #include <llvm/Target/TargetOptions.h>
 #include <llvm/MC/TargetRegistry.h>
+#if __has_include(<llvm/TargetParser/Host.h>)
+#include <llvm/TargetParser/Host.h>
+#else
+#include <llvm/Support/Host.h>
+#endif
 #include <llvm/ExecutionEngine/GenericValue.h>
 #include <llvm/ExecutionEngine/ExecutionEngine.h>
 #include <llvm/ExecutionEngine/SectionMemoryManager.h>
@@ -345,7 +353,48 @@ bool LLVMCodeGen::emitExecutable(const std::string& filename) {
     novacoreLib = "build/Release/libnovacore.a";
 #endif
 
-    // Step 3: Compile IR to executable using clang++ with runtime library
+    // Step 3: Profile-guided optimization flags. Instrumentation and profile
+    // use run inside clang's optimization pipeline, and the profile is keyed
+    // by CFG hashes taken at the same point of that pipeline, so both the
+    // instrumented and the optimized build must use the same -O level.
+    std::string optFlags = " -O0 -g";
+    std::string profileFlags;
+    std::string mergedProfile;  // temporary .profdata, removed after linking
+    if (profileGenerate) {
+        optFlags = " -O2 -g";
+        profileFlags = profileGenerateDir.empty()
+            ? std::string(" -fprofile-generate")
+            : " -fprofile-generate=\"" + profileGenerateDir + "\"";
+    } else if (!profileUseFile.empty()) {
+        std::string profile = profileUseFile;
+        if (profile.size() > 8 &&
+            profile.compare(profile.size() - 8, 8, ".profraw") == 0) {
+            // clang only reads indexed profiles; merge a raw one first.
+            llvm::SmallString<128> indexed;
+            if (llvm::sys::fs::createTemporaryFile("nova-pgo", "profdata", indexed)) {
+                std::cerr << "[NOVA_PGO_FAILURE] could not create a temporary profile"
+                          << std::endl;
+                return false;
+            }
+            mergedProfile = indexed.str().str();
+            std::string mergeCmd = "llvm-profdata merge -o \"" + mergedProfile +
+                "\" \"" + profile + "\" 2>&1";
+            if(NOVA_DEBUG) std::cerr << "DEBUG LLVM: Merge command: " << mergeCmd << std::endl;
+            if (system(mergeCmd.c_str()) != 0) {
+                std::cerr << "[NOVA_PGO_FAILURE] could not merge profile "
+                          << profile << std::endl;
+                llvm::sys::fs::remove(mergedProfile);
+                return false;
+            }
+            profile = mergedProfile;
+        }
+        optFlags = " -O2 -g";
+        profileFlags = " -fprofile-use=\"" + profile + "\"" +
+            " -Wno-profile-instr-unprofiled -Wno-profile-instr-out-of-date" +
+            " -mllvm -hot-cold-split=true";
+    }
+
+    // Step 4: Compile IR to executable using clang++ with runtime library
     std::string compileCmd;
 #ifdef NOVA_ENABLE_ASAN
     const std::string sanitizerLinkFlags = " -fsanitize=address";
@@ -353,17 +402,20 @@ bool LLVMCodeGen::emitExecutable(const std::string& filename) {
     const std::string sanitizerLinkFlags;
 #endif
 #ifdef _WIN32
-    compileCmd = "clang++ -O0 -g \"" + irFile + "\" \"" + novacoreLib +
+    compileCmd = "clang++" + optFlags + profileFlags + " \"" + irFile + "\" \"" + novacoreLib +
         "\" -o \"" + filename + "\"" + sanitizerLinkFlags +
         " -lmsvcrt -lkernel32 -lWs2_32 -lAdvapi32 -Wno-override-module 2>&1";
 #else
-    compileCmd = "clang++ -O0 -g \"" + irFile + "\" \"" + novacoreLib +
+    compileCmd = "clang++" + optFlags + profileFlags + " \"" + irFile + "\" \"" + novacoreLib +
         "\" -o \"" + filename + "\"" + sanitizerLinkFlags +
         " -lc -lstdc++ 2>&1";
 #endif
     if(NOVA_DEBUG) std::cerr << "DEBUG LLVM: Compile command: " << compileCmd << std::endl;
 
     int result = system(compileCmd.c_str());
+    if (!mergedProfile.empty()) {
+        llvm::sys::fs::remove(mergedProfile);
+    }
 
     // TEMP: Copy IR to debug_output.ll before cleaning up
     #ifdef _WIN32
@@ -488,10 +540,62 @@ void LLVMCodeGen::runOptimizationPasses(unsigned optLevel) {
     }
     
     FPM->doFinalization();
+
+    if (optLevel >= 2) {
+        runVectorizationPasses();
+    }
     
     if(NOVA_DEBUG) std::cerr << "DEBUG LLVM: Optimization passes completed" << std::endl;
 }
 
+// Loop and SLP vectorization need target cost information, which the
+// scalar pipeline above does without, and bottom-tested loops. Rotation is
+// therefore confined to this stage: it runs on the already-promoted SSA
+// form, immediately before the vectorizers, so the break/continue lowering
+// the scalar pipeline avoids rotating is never seen in its raw shape.
+void LLVMCodeGen::runVectorizationPasses() {
+    std::string triple = llvm::sys::getDefaultTargetTriple();
+    std::string error;
+    const llvm::Target* target = llvm::TargetRegistry::lookupTarget(triple, error);
+    if (!target) {
+        if(NOVA_DEBUG) std::cerr << "DEBUG LLVM: No target for vectorization: " << error << std::endl;
+        return;
+    }
+
+    std::string features;
+    llvm::StringMap<bool> hostFeatures;
+    if (llvm::sys::getHostCPUFeatures(hostFeatures)) {
+        for (auto& feature : hostFeatures) {
+            if (!features.empty()) features += ',';
+            features += (feature.second ? '+' : '-');
+            features += feature.first().str();
+        }
+    }
+    std::unique_ptr<llvm::TargetMachine> targetMachine(
+        target->createTargetMachine(triple, llvm::sys::getHostCPUName(),
+                                    features, llvm::TargetOptions(), {}));
+    if (!targetMachine) return;
+
+    auto VPM = std::make_unique<llvm::legacy::FunctionPassManager>(module.get());
+    VPM->add(llvm::createTargetTransformInfoWrapperPass(
+        targetMachine->getTargetIRAnalysis()));
+    VPM->add(llvm::createLoopRotatePass());
+    VPM->add(llvm::createLICMPass());
+    VPM->add(llvm::createLoopVectorizePass());
+    VPM->add(llvm::createSLPVectorizerPass());
+    VPM->add(llvm::createInstructionCombiningPass());
+    VPM->add(llvm::createCFGSimplificationPass());
+
+    VPM->doInitialization();
+    for (auto& func : module->functions()) {
+        if (!func.isDeclaration()) {
+            VPM->run(func);
+        }
+    }
+    VPM->doFinalization();
+    if(NOVA_DEBUG) std::cerr << "DEBUG LLVM: Vectorization passes completed for " << targetMachine->getTargetCPU().str() << std::endl;
+}
+
 int LLVMCodeGen::executeMain() {
     // Initialize LLVM Execution Engine
     if(NOVA_DEBUG) std::cerr << "DEBUG LLVM: Initializing JIT execution engine" << std::endl;
@@ -5530,7 +5634,33 @@ void LLVMCodeGen::generateTerminator(mir::MIRTerminator* terminator) {
                     builder->GetInsertBlock()->printAsOperand(llvm::errs(), false);
                     std::cerr << std::endl;
                 }
-                llvm::Value* result = builder->CreateCall(callee, args);
+                llvm::Value* result = nullptr;
+                if (calleeName == "nova_value_array_at_unchecked" &&
+                    args.size() == 2 && args[0]->getType()->isPointerTy() &&
+                    args[1]->getType()->isIntegerTy(64)) {
+                    // HIR only emits this for indices proven to be inside
+                    // [0, length) (see BoundsCheckElimination.cpp), so the
+                    // access is a plain load through the metadata `elements`
+                    // pointer at byte offset 40.
+                    llvm::Type* i8Type = llvm::Type::getInt8Ty(*context);
+                    llvm::Type* i64Type = llvm::Type::getInt64Ty(*context);
+                    llvm::Value* elementsField = builder->CreateInBoundsGEP(
+                        i8Type, args[0],
+                        llvm::ConstantInt::get(i64Type, 40),
+                        "loop_elements_field");
+                    llvm::Value* elements = builder->CreateLoad(
+                        llvm::PointerType::getUnqual(*context), elementsField,
+                        "loop_elements");
+                    llvm::Value* elementPtr = builder->CreateInBoundsGEP(
+                        i64Type, elements, args[1], "loop_elem_ptr");
+                    result = builder->CreateLoad(i64Type, elementPtr, "loop_elem");
+                }
+                if (!result) {
+                    result = generateTypedArrayUncheckedAccess(calleeName, args);
+                }
+                if (!result) {
+                    result = builder->CreateCall(callee, args);
+                }
                 if(NOVA_DEBUG) {
                     std::cerr << "DEBUG LLVM: [CRITICAL] CreateCall succeeded, result = " << result << std::endl;
                     std::cerr << "DEBUG LLVM: [CRITICAL] LLVM IR of call instruction:" << std::endl;
@@ -7728,6 +7858,129 @@ llvm::Value* LLVMCodeGen::generateGetElement(mir::MIRGetElementRValue* getElemOp
     return elementValue;
 }
 
+// ==================== TypedArray Element Access ====================
+
+llvm::Value* LLVMCodeGen::generateTypedArrayUncheckedAccess(
+    const std::string& calleeName, const std::vector<llvm::Value*>& args) {
+    struct ElementKind {
+        const char* name;
+        unsigned bits;
+        bool isFloat;
+        bool isSigned;
+    };
+    static const ElementKind kinds[] = {
+        {"int8", 8, false, true},     {"uint8", 8, false, false},
+        {"uint8clamped", 8, false, false},
+        {"int16", 16, false, true},   {"uint16", 16, false, false},
+        {"int32", 32, false, true},   {"uint32", 32, false, false},
+        {"float32", 32, true, true},  {"float64", 64, true, true},
+        {"bigint64", 64, false, true}, {"biguint64", 64, false, false},
+    };
+
+    // nova_<kind>array_get_unchecked / nova_<kind>array_set_unchecked
+    const std::string prefix = "nova_";
+    const std::string getSuffix = "array_get_unchecked";
+    const std::string setSuffix = "array_set_unchecked";
+    bool isStore;
+    if (calleeName.size() > prefix.size() + getSuffix.size() &&
+        calleeName.compare(calleeName.size() - getSuffix.size(),
+                           getSuffix.size(), getSuffix) == 0) {
+        isStore = false;
+    } else if (calleeName.size() > prefix.size() + setSuffix.size() &&
+               calleeName.compare(calleeName.size() - setSuffix.size(),
+                                  setSuffix.size(), setSuffix) == 0) {
+        isStore = true;
+    } else {
+        return nullptr;
+    }
+    const std::string kindName = calleeName.substr(
+        prefix.size(), calleeName.size() - prefix.size() - getSuffix.size());
+    const ElementKind* kind = nullptr;
+    for (const auto& candidate : kinds) {
+        if (kindName == candidate.name) kind = &candidate;
+    }
+    if (!kind || args.size() != (isStore ? 3u : 2u) ||
+        !args[0]->getType()->isPointerTy() ||
+        !args[1]->getType()->isIntegerTy(64)) {
+        return nullptr;
+    }
+
+    llvm::Type* i8Type = llvm::Type::getInt8Ty(*context);
+    llvm::Type* i64Type = llvm::Type::getInt64Ty(*context);
+    llvm::Type* doubleType = llvm::Type::getDoubleTy(*context);
+    llvm::Type* elementType = kind->isFloat
+        ? (kind->bits == 32 ? llvm::Type::getFloatTy(*context) : doubleType)
+        : llvm::Type::getIntNTy(*context, kind->bits);
+    llvm::Type* valueType = kind->isFloat ? doubleType : i64Type;
+    if (isStore && args[2]->getType() != valueType) return nullptr;
+
+    // Element memory and NovaTypedArray headers never overlap: headers are
+    // separate allocations and `data` points into an ArrayBuffer store.
+    // Two scopes in one domain let LICM/GVN keep the header's `data` load
+    // out of loops that store elements; element accesses share a scope
+    // because distinct views may alias the same buffer.
+    if (!typedArrayElementScope) {
+        llvm::MDBuilder mdBuilder(*context);
+        llvm::MDNode* domain =
+            mdBuilder.createAnonymousAliasScopeDomain("nova.typedarray");
+        typedArrayElementScope = llvm::MDNode::get(
+            *context, {mdBuilder.createAnonymousAliasScope(domain, "elements")});
+        typedArrayHeaderScope = llvm::MDNode::get(
+            *context, {mdBuilder.createAnonymousAliasScope(domain, "header")});
+    }
+
+    // NovaTypedArray::data sits at byte offset 8 and is never reassigned
+    // after construction.
+    llvm::Value* dataField = builder->CreateInBoundsGEP(
+        i8Type, args[0], llvm::ConstantInt::get(i64Type, 8), "typed_data_field");
+    llvm::LoadInst* data = builder->CreateLoad(
+        llvm::PointerType::getUnqual(*context), dataField, "typed_data");
+    data->setMetadata(llvm::LLVMContext::MD_alias_scope, typedArrayHeaderScope);
+    data->setMetadata(llvm::LLVMContext::MD_noalias, typedArrayElementScope);
+    data->setMetadata(llvm::LLVMContext::MD_invariant_load,
+                      llvm::MDNode::get(*context, {}));
+
+    llvm::Value* elementPtr = builder->CreateInBoundsGEP(
+        elementType, data, args[1], "typed_elem_ptr");
+
+    if (isStore) {
+        llvm::Value* stored = args[2];
+        if (kind->isFloat) {
+            if (kind->bits == 32) {
+                stored = builder->CreateFPTrunc(stored, elementType, "typed_narrow");
+            }
+        } else {
+            if (kindName == "uint8clamped") {
+                llvm::Value* zero = llvm::ConstantInt::get(i64Type, 0);
+                llvm::Value* max = llvm::ConstantInt::get(i64Type, 255);
+                stored = builder->CreateSelect(
+                    builder->CreateICmpSLT(stored, zero), zero, stored);
+                stored = builder->CreateSelect(
+                    builder->CreateICmpSGT(stored, max), max, stored, "typed_clamp");
+            }
+            if (kind->bits < 64) {
+                stored = builder->CreateTrunc(stored, elementType, "typed_narrow");
+            }
+        }
+        llvm::StoreInst* store = builder->CreateStore(stored, elementPtr);
+        store->setMetadata(llvm::LLVMContext::MD_alias_scope, typedArrayElementScope);
+        store->setMetadata(llvm::LLVMContext::MD_noalias, typedArrayHeaderScope);
+        return store;
+    }
+
+    llvm::LoadInst* load = builder->CreateLoad(elementType, elementPtr, "typed_elem");
+    load->setMetadata(llvm::LLVMContext::MD_alias_scope, typedArrayElementScope);
+    load->setMetadata(llvm::LLVMContext::MD_noalias, typedArrayHeaderScope);
+    if (kind->isFloat) {
+        return kind->bits == 32
+            ? builder->CreateFPExt(load, doubleType, "typed_widen")
+            : static_cast<llvm::Value*>(load);
+    }
+    if (kind->bits == 64) return load;
+    return kind->isSigned ? builder->CreateSExt(load, i64Type, "typed_widen")
+                          : builder->CreateZExt(load, i64Type, "typed_widen");
+}
+
 // ==================== Runtime Functions ====================
 
 void LLVMCodeGen::declareRuntimeFunctions() {
@@ -1,7 +1,45 @@
 #include "nova/Frontend/AST.h"
 
+#include <new>
+
 namespace nova {
 
+// ==================== Arena ====================
+
+namespace {
+
+constexpr size_t kArenaBlockSize = 64 * 1024;
+constexpr size_t kArenaAlignment = alignof(std::max_align_t);
+
+} // namespace
+
+ASTArena::~ASTArena() {
+    // Nodes only hold non-owning links to one another, so no destructor
+    // reaches into a node that is already gone.
+    for (auto it = nodes_.rbegin(); it != nodes_.rend(); ++it) {
+        (*it)->~ASTNode();
+    }
+}
+
+void* ASTArena::allocate(size_t size) {
+    size = (size + kArenaAlignment - 1) & ~(kArenaAlignment - 1);
+    bytesAllocated_ += size;
+    if (size > kArenaBlockSize / 4) {
+        // Oversized requests get a block of their own so the current block
+        // keeps filling up.
+        blocks_.emplace_back(new char[size]);
+        return blocks_.back().get();
+    }
+    if (static_cast<size_t>(end_ - cursor_) < size) {
+        blocks_.emplace_back(new char[kArenaBlockSize]);
+        cursor_ = blocks_.back().get();
+        end_ = cursor_ + kArenaBlockSize;
+    }
+    void* result = cursor_;
+    cursor_ += size;
+    return result;
+}
+
 // Implement accept methods for all AST nodes
 void NumberLiteral::accept(ASTVisitor& visitor) { visitor.visit(*this); }
 void BigIntLiteral::accept(ASTVisitor& visitor) { visitor.visit(*this); }
@@ -5,15 +5,16 @@
 #include <fstream>
 #include <sstream>
 
-namespace nova {
+#if defined(__SSE2__) || defined(_M_X64)
+    #define NOVA_LEXER_SSE2 1
+    #include <emmintrin.h>
+#endif
 
-std::unordered_map<std::string, TokenType> Lexer::keywords_;
+namespace nova {
 
 Lexer::Lexer(const std::string& filename, const std::string& source)
-    : filename_(filename), source_(source), position_(0), line_(1), column_(1) {
-    if (keywords_.empty()) {
-        initializeKeywords();
-    }
+    : filename_(filename), fileId_(SourceFiles::intern(filename)),
+      source_(source), position_(0), line_(1), column_(1) {
 }
 
 Lexer::Lexer(const std::string& source)
@@ -30,79 +31,222 @@ bool Lexer::isJSXMode() const {
     return endsWith(".tsx") || endsWith(".jsx");
 }
 
-void Lexer::initializeKeywords() {
-    keywords_ = {
-        // JavaScript Keywords
-        {"break", TokenType::KeywordBreak},
-        {"case", TokenType::KeywordCase},
-        {"catch", TokenType::KeywordCatch},
-        {"class", TokenType::KeywordClass},
-        {"const", TokenType::KeywordConst},
-        {"continue", TokenType::KeywordContinue},
-        {"debugger", TokenType::KeywordDebugger},
-        {"default", TokenType::KeywordDefault},
-        {"delete", TokenType::KeywordDelete},
-        {"do", TokenType::KeywordDo},
-        {"else", TokenType::KeywordElse},
-        {"export", TokenType::KeywordExport},
-        {"extends", TokenType::KeywordExtends},
-        {"finally", TokenType::KeywordFinally},
-        {"for", TokenType::KeywordFor},
-        {"function", TokenType::KeywordFunction},
-        {"if", TokenType::KeywordIf},
-        {"import", TokenType::KeywordImport},
-        {"in", TokenType::KeywordIn},
-        {"instanceof", TokenType::KeywordInstanceof},
-        {"let", TokenType::KeywordLet},
-        {"new", TokenType::KeywordNew},
-        {"return", TokenType::KeywordReturn},
-        {"super", TokenType::KeywordSuper},
-        {"switch", TokenType::KeywordSwitch},
-        {"this", TokenType::KeywordThis},
-        {"throw", TokenType::KeywordThrow},
-        {"try", TokenType::KeywordTry},
-        {"typeof", TokenType::KeywordTypeof},
-        {"var", TokenType::KeywordVar},
-        {"void", TokenType::KeywordVoid},
-        {"while", TokenType::KeywordWhile},
-        {"with", TokenType::KeywordWith},
-        {"yield", TokenType::KeywordYield},
-        {"await", TokenType::KeywordAwait},
-        {"async", TokenType::KeywordAsync},
-        {"from", TokenType::KeywordFrom},
-        {"as", TokenType::KeywordAs},
-        {"of", TokenType::KeywordOf},
-        
-        // TypeScript Keywords
-        {"type", TokenType::KeywordType},
-        {"interface", TokenType::KeywordInterface},
-        {"namespace", TokenType::KeywordNamespace},
-        {"declare", TokenType::KeywordDeclare},
-        {"abstract", TokenType::KeywordAbstract},
-        {"public", TokenType::KeywordPublic},
-        {"private", TokenType::KeywordPrivate},
-        {"protected", TokenType::KeywordProtected},
-        {"readonly", TokenType::KeywordReadonly},
-        {"static", TokenType::KeywordStatic},
-        {"get", TokenType::KeywordGet},
-        {"set", TokenType::KeywordSet},
-        {"implements", TokenType::KeywordImplements},
-        {"override", TokenType::KeywordOverride},
-        {"satisfies", TokenType::KeywordSatisfies},
-        {"keyof", TokenType::KeywordKeyof},
-        {"infer", TokenType::KeywordInfer},
-        {"is", TokenType::KeywordIs},
-        {"asserts", TokenType::KeywordAsserts},
-        {"enum", TokenType::KeywordEnum},
-        {"unique", TokenType::KeywordUnique},
-        {"using", TokenType::KeywordUsing},
-
-        // Literals
-        {"true", TokenType::TrueLiteral},
-        {"false", TokenType::FalseLiteral},
-        {"null", TokenType::NullLiteral},
-        {"undefined", TokenType::UndefinedLiteral}
-    };
+// Keywords are classified without hashing or allocating: dispatch on the
+// length and first character, then compare the remaining bytes. Most
+// identifiers are rejected by the two switches alone.
+TokenType Lexer::classifyKeyword(std::string_view word) {
+    switch (word.size()) {
+        case 2:
+            switch (word[0]) {
+                case 'a':
+                    if (word == "as") return TokenType::KeywordAs;
+                    break;
+                case 'd':
+                    if (word == "do") return TokenType::KeywordDo;
+                    break;
+                case 'i':
+                    if (word == "if") return TokenType::KeywordIf;
+                    if (word == "in") return TokenType::KeywordIn;
+                    if (word == "is") return TokenType::KeywordIs;
+                    break;
+                case 'o':
+                    if (word == "of") return TokenType::KeywordOf;
+                    break;
+            }
+            break;
+        case 3:
+            switch (word[0]) {
+                case 'f':
+                    if (word == "for") return TokenType::KeywordFor;
+                    break;
+                case 'g':
+                    if (word == "get") return TokenType::KeywordGet;
+                    break;
+                case 'l':
+                    if (word == "let") return TokenType::KeywordLet;
+                    break;
+                case 'n':
+                    if (word == "new") return TokenType::KeywordNew;
+                    break;
+                case 's':
+                    if (word == "set") return TokenType::KeywordSet;
+                    break;
+                case 't':
+                    if (word == "try") return TokenType::KeywordTry;
+                    break;
+                case 'v':
+                    if (word == "var") return TokenType::KeywordVar;
+                    break;
+            }
+            break;
+        case 4:
+            switch (word[0]) {
+                case 'c':
+                    if (word == "case") return TokenType::KeywordCase;
+                    break;
+                case 'e':
+                    if (word == "else") return TokenType::KeywordElse;
+                    if (word == "enum") return TokenType::KeywordEnum;
+                    break;
+                case 'f':
+                    if (word == "from") return TokenType::KeywordFrom;
+                    break;
+                case 'n':
+                    if (word == "null") return TokenType::NullLiteral;
+                    break;
+                case 't':
+                    if (word == "this") return TokenType::KeywordThis;
+                    if (word == "type") return TokenType::KeywordType;
+                    if (word == "true") return TokenType::TrueLiteral;
+                    break;
+                case 'v':
+                    if (word == "void") return TokenType::KeywordVoid;
+                    break;
+                case 'w':
+                    if (word == "with") return TokenType::KeywordWith;
+                    break;
+            }
+            break;
+        case 5:
+            switch (word[0]) {
+                case 'a':
+                    if (word == "await") return TokenType::KeywordAwait;
+                    if (word == "async") return TokenType::KeywordAsync;
+                    break;
+                case 'b':
+                    if (word == "break") return TokenType::KeywordBreak;
+                    break;
+                case 'c':
+                    if (word == "catch") return TokenType::KeywordCatch;
+                    if (word == "class") return TokenType::KeywordClass;
+                    if (word == "const") return TokenType::KeywordConst;
+                    break;
+                case 'f':
+                    if (word == "false") return TokenType::FalseLiteral;
+                    break;
+                case 'i':
+                    if (word == "infer") return TokenType::KeywordInfer;
+                    break;
+                case 'k':
+                    if (word == "keyof") return TokenType::KeywordKeyof;
+                    break;
+                case 's':
+                    if (word == "super") return TokenType::KeywordSuper;
+                    break;
+                case 't':
+                    if (word == "throw") return TokenType::KeywordThrow;
+                    break;
+                case 'u':
+                    if (word == "using") return TokenType::KeywordUsing;
+                    break;
+                case 'w':
+                    if (word == "while") return TokenType::KeywordWhile;
+                    break;
+                case 'y':
+                    if (word == "yield") return TokenType::KeywordYield;
+                    break;
+            }
+            break;
+        case 6:
+            switch (word[0]) {
+                case 'd':
+                    if (word == "delete") return TokenType::KeywordDelete;
+                    break;
+                case 'e':
+                    if (word == "export") return TokenType::KeywordExport;
+                    break;
+                case 'i':
+                    if (word == "import") return TokenType::KeywordImport;
+                    break;
+                case 'p':
+                    if (word == "public") return TokenType::KeywordPublic;
+                    break;
+                case 'r':
+                    if (word == "return") return TokenType::KeywordReturn;
+                    break;
+                case 's':
+                    if (word == "switch") return TokenType::KeywordSwitch;
+                    if (word == "static") return TokenType::KeywordStatic;
+                    break;
+                case 't':
+                    if (word == "typeof") return TokenType::KeywordTypeof;
+                    break;
+                case 'u':
+                    if (word == "unique") return TokenType::KeywordUnique;
+                    break;
+            }
+            break;
+        case 7:
+            switch (word[0]) {
+                case 'a':
+                    if (word == "asserts") return TokenType::KeywordAsserts;
+                    break;
+                case 'd':
+                    if (word == "default") return TokenType::KeywordDefault;
+                    if (word == "declare") return TokenType::KeywordDeclare;
+                    break;
+                case 'e':
+                    if (word == "extends") return TokenType::KeywordExtends;
+                    break;
+                case 'f':
+                    if (word == "finally") return TokenType::KeywordFinally;
+                    break;
+                case 'p':
+                    if (word == "private") return TokenType::KeywordPrivate;
+                    break;
+            }
+            break;
+        case 8:
+            switch (word[0]) {
+                case 'a':
+                    if (word == "abstract") return TokenType::KeywordAbstract;
+                    break;
+                case 'c':
+                    if (word == "continue") return TokenType::KeywordContinue;
+                    break;
+                case 'd':
+                    if (word == "debugger") return TokenType::KeywordDebugger;
+                    break;
+                case 'f':
+                    if (word == "function") return TokenType::KeywordFunction;
+                    break;
+                case 'o':
+                    if (word == "override") return TokenType::KeywordOverride;
+                    break;
+                case 'r':
+                    if (word == "readonly") return TokenType::KeywordReadonly;
+                    break;
+            }
+            break;
+        case 9:
+            switch (word[0]) {
+                case 'i':
+                    if (word == "interface") return TokenType::KeywordInterface;
+                    break;
+                case 'n':
+                    if (word == "namespace") return TokenType::KeywordNamespace;
+                    break;
+                case 'p':
+                    if (word == "protected") return TokenType::KeywordProtected;
+                    break;
+                case 's':
+                    if (word == "satisfies") return TokenType::KeywordSatisfies;
+                    break;
+                case 'u':
+                    if (word == "undefined") return TokenType::UndefinedLiteral;
+                    break;
+            }
+            break;
+        case 10:
+            switch (word[0]) {
+                case 'i':
+                    if (word == "instanceof") return TokenType::KeywordInstanceof;
+                    if (word == "implements") return TokenType::KeywordImplements;
+                    break;
+            }
+            break;
+    }
+    return TokenType::Identifier;
 }
 
 // Helper to check if last token type allows regex to follow
@@ -284,90 +428,97 @@ void Lexer::skipBlockComment() {
 
 Token Lexer::lexNumber() {
     SourceLocation loc = currentLocation();
-    std::string value;
+    size_t start = position_;
+    bool separators = false;
     
     // Handle binary, octal, hex
     if (currentChar() == '0') {
-        value += currentChar();
         advance();
         
         if (currentChar() == 'b' || currentChar() == 'B') {
-            value += currentChar();
             advance();
             while (isBinaryDigit(currentChar())) {
-                value += currentChar();
                 advance();
             }
-            return Token(TokenType::NumberLiteral, value, loc);
+            return Token(TokenType::NumberLiteral, slice(start), loc);
         }
         else if (currentChar() == 'o' || currentChar() == 'O') {
-            value += currentChar();
             advance();
             while (isOctalDigit(currentChar())) {
-                value += currentChar();
                 advance();
             }
-            return Token(TokenType::NumberLiteral, value, loc);
+            return Token(TokenType::NumberLiteral, slice(start), loc);
         }
         else if (currentChar() == 'x' || currentChar() == 'X') {
-            value += currentChar();
             advance();
             while (isHexDigit(currentChar())) {
-                value += currentChar();
                 advance();
             }
-            return Token(TokenType::NumberLiteral, value, loc);
+            return Token(TokenType::NumberLiteral, slice(start), loc);
         }
     }
     
     // Decimal number
     while (isDigit(currentChar()) || currentChar() == '_') {
-        if (currentChar() != '_') {
-            value += currentChar();
-        }
+        separators |= currentChar() == '_';
         advance();
     }
     
     // Fractional part
     if (currentChar() == '.' && isDigit(peekChar())) {
-        value += currentChar();
         advance();
         while (isDigit(currentChar()) || currentChar() == '_') {
-            if (currentChar() != '_') {
-                value += currentChar();
-            }
+            separators |= currentChar() == '_';
             advance();
         }
     }
     
     // Exponent
     if (currentChar() == 'e' || currentChar() == 'E') {
-        value += currentChar();
         advance();
         if (currentChar() == '+' || currentChar() == '-') {
-            value += currentChar();
             advance();
         }
         while (isDigit(currentChar())) {
-            value += currentChar();
             advance();
         }
     }
     
     // BigInt suffix
     if (currentChar() == 'n') {
-        value += currentChar();
         advance();
     }
     
-    return Token(TokenType::NumberLiteral, value, loc);
+    if (!separators) {
+        return Token(TokenType::NumberLiteral, slice(start), loc);
+    }
+    // Numeric separators (1_000) are dropped from the value.
+    std::string value;
+    for (char c : slice(start)) {
+        if (c != '_') value += c;
+    }
+    return Token(TokenType::NumberLiteral, cook(std::move(value)), loc);
 }
 
 Token Lexer::lexString(char quote) {
     SourceLocation loc = currentLocation();
-    std::string value;
     advance();  // skip opening quote
 
+    // Escape-free literals (the common case) are a slice of the source.
+    size_t end = position_;
+    while (end < source_.length() && source_[end] != quote &&
+           source_[end] != '\\') {
+        ++end;
+    }
+    if (end < source_.length() && source_[end] == quote) {
+        std::string_view value(source_.data() + position_, end - position_);
+        column_ += static_cast<uint32_t>(end + 1 - position_);
+        position_ = end + 1;
+        return Token(TokenType::StringLiteral, value, loc);
+    }
+
+    std::string value;
+
     while (position_ < source_.length() && currentChar() != quote) {
         if (currentChar() == '\\') {
             advance();
@@ -498,7 +649,7 @@ Token Lexer::lexString(char quote) {
         reportError("Unterminated string");
     }
 
-    return Token(TokenType::StringLiteral, value, loc);
+    return Token(TokenType::StringLiteral, cook(std::move(value)), loc);
 }
 
 Token Lexer::lexTemplateLiteral() {
@@ -578,24 +729,56 @@ Token Lexer::lexTemplateLiteral() {
         advance();  // skip closing `
     }
 
-    return Token(TokenType::TemplateLiteral, value, loc);
+    return Token(TokenType::TemplateLiteral, cook(std::move(value)), loc);
 }
 
 Token Lexer::lexIdentifierOrKeyword() {
     SourceLocation loc = currentLocation();
-    std::string value;
-    
-    while (position_ < source_.length() && isIdentifierPart(currentChar())) {
-        value += currentChar();
-        advance();
+    size_t start = position_;
+    size_t end = position_;
+    const size_t length = source_.length();
+
+#ifdef NOVA_LEXER_SSE2
+    // Classify 16 bytes at a time: [A-Za-z0-9_$]. The first byte that is
+    // not an identifier character ends the run; non-ASCII bytes stop it
+    // too and are left to the scalar loop below.
+    const char* data = source_.data();
+    while (end + 16 <= length) {
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + end));
+        // Setting bit 0x20 folds A-Z onto a-z for the letter test.
+        __m128i lower = _mm_or_si128(bytes, _mm_set1_epi8(0x20));
+        __m128i letter = _mm_and_si128(
+            _mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)),
+            _mm_cmplt_epi8(lower, _mm_set1_epi8('z' + 1)));
+        __m128i digit = _mm_and_si128(
+            _mm_cmpgt_epi8(bytes, _mm_set1_epi8('0' - 1)),
+            _mm_cmplt_epi8(bytes, _mm_set1_epi8('9' + 1)));
+        __m128i other = _mm_or_si128(
+            _mm_cmpeq_epi8(bytes, _mm_set1_epi8('_')),
+            _mm_cmpeq_epi8(bytes, _mm_set1_epi8('$')));
+        unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(
+            _mm_or_si128(_mm_or_si128(letter, digit), other)));
+        if (mask != 0xFFFF) {
+            unsigned stop = ~mask & 0xFFFF;
+            size_t run = 0;
+            while (!(stop & 1u)) {
+                stop >>= 1;
+                ++run;
+            }
+            end += run;
+            break;
+        }
+        end += 16;
     }
-    
-    auto it = keywords_.find(value);
-    if (it != keywords_.end()) {
-        return Token(it->second, value, loc);
+#endif
+    while (end < length && isIdentifierPart(source_[end])) {
+        ++end;
     }
-    
-    return Token(TokenType::Identifier, value, loc);
+    column_ += static_cast<uint32_t>(end - start);
+    position_ = end;
+
+    std::string_view value = slice(start);
+    return Token(classifyKeyword(value), value, loc);
 }
 
 Token Lexer::lexOperator() {
@@ -723,7 +906,7 @@ Token Lexer::lexOperator() {
         case '~': return Token(TokenType::Tilde, "~", loc);
         
         default:
-            return Token(TokenType::Invalid, std::string(1, current), loc);
+            return Token(TokenType::Invalid, slice(position_ - 1), loc);
     }
 }
 
@@ -744,7 +927,16 @@ void Lexer::advance() {
 }
 
 SourceLocation Lexer::currentLocation() const {
-    return SourceLocation(filename_, line_, column_, static_cast<uint32_t>(position_));
+    return SourceLocation(fileId_, line_, column_, static_cast<uint32_t>(position_));
+}
+
+std::string_view Lexer::slice(size_t start) const {
+    return std::string_view(source_.data() + start, position_ - start);
+}
+
+std::string_view Lexer::cook(std::string&& value) {
+    cooked_.push_back(std::move(value));
+    return cooked_.back();
 }
 
 void Lexer::reportError(const std::string& message) {
@@ -784,72 +976,64 @@ bool Lexer::isWhitespace(char c) const {
 
 Token Lexer::lexRegex() {
     SourceLocation loc = currentLocation();
-    std::string pattern;
+    size_t start = position_;
     
     advance();  // skip initial '/'
     
     // Lex pattern
     while (position_ < source_.length() && currentChar() != '/') {
         if (currentChar() == '\\') {
-            pattern += currentChar();
             advance();
             if (position_ < source_.length()) {
-                pattern += currentChar();
                 advance();
             }
         } else if (currentChar() == '\n') {
             reportError("Unterminated regular expression");
-            return Token(TokenType::Invalid, pattern, loc);
+            return Token(TokenType::Invalid, slice(start + 1), loc);
         } else if (currentChar() == '[') {
             // Character class - don't treat / inside [] as end
-            pattern += currentChar();
             advance();
             while (position_ < source_.length() && currentChar() != ']') {
                 if (currentChar() == '\\') {
-                    pattern += currentChar();
                     advance();
                     if (position_ < source_.length()) {
-                        pattern += currentChar();
                         advance();
                     }
                 } else {
-                    pattern += currentChar();
                     advance();
                 }
             }
             if (currentChar() == ']') {
-                pattern += currentChar();
                 advance();
             }
         } else {
-            pattern += currentChar();
             advance();
         }
     }
     
     if (currentChar() != '/') {
         reportError("Unterminated regular expression");
-        return Token(TokenType::Invalid, pattern, loc);
+        return Token(TokenType::Invalid, slice(start + 1), loc);
     }
     
     advance();  // skip closing '/'
     
     // Lex flags (g, i, m, s, u, y, d)
-    std::string flags;
     while (position_ < source_.length() && 
            (currentChar() == 'g' || currentChar() == 'i' || currentChar() == 'm' || 
             currentChar() == 's' || currentChar() == 'u' || currentChar() == 'y' || 
             currentChar() == 'd')) {
-        flags += currentChar();
         advance();
     }
     
-    std::string value = "/" + pattern + "/" + flags;
-    return Token(TokenType::RegexLiteral, value, loc);
+    // The value is the literal exactly as written: /pattern/flags
+    return Token(TokenType::RegexLiteral, slice(start), loc);
 }
 
 const std::vector<Token>& Lexer::getAllTokens() {
     if (tokens_.empty()) {
+        // Roughly one token per five source bytes in typical code.
+        tokens_.reserve(source_.size() / 5 + 1);
         Token token;
         do {
             token = nextToken();
@@ -1,8 +1,72 @@
 #include "nova/Frontend/Token.h"
+#include <array>
+#include <atomic>
+#include <mutex>
 #include <sstream>
+#include <unordered_map>
 
 namespace nova {
 
+namespace {
+
+// Names live in fixed-size chunks that are never moved or freed, and a
+// slot is written exactly once before `count` publishes it. Readers
+// therefore only need an acquire load of `count` and of the chunk pointer;
+// the mutex serializes interning alone.
+constexpr uint32_t kSourceFileChunkBits = 8;
+constexpr uint32_t kSourceFileChunkSize = 1u << kSourceFileChunkBits;
+constexpr uint32_t kSourceFileMaxChunks = 4096;
+
+struct SourceFileTable {
+    std::mutex mutex;
+    std::unordered_map<std::string, uint32_t> ids;
+    std::array<std::atomic<std::string*>, kSourceFileMaxChunks> chunks{};
+    std::atomic<uint32_t> count{0};
+    const std::string empty;
+
+    SourceFileTable() { append(std::string()); }
+
+    // Caller holds `mutex`.
+    uint32_t append(const std::string& filename) {
+        uint32_t id = count.load(std::memory_order_relaxed);
+        uint32_t chunk = id >> kSourceFileChunkBits;
+        if (chunk >= kSourceFileMaxChunks) return 0;
+        std::string* names = chunks[chunk].load(std::memory_order_relaxed);
+        if (!names) {
+            names = new std::string[kSourceFileChunkSize];
+            chunks[chunk].store(names, std::memory_order_release);
+        }
+        names[id & (kSourceFileChunkSize - 1)] = filename;
+        ids.emplace(filename, id);
+        count.store(id + 1, std::memory_order_release);
+        return id;
+    }
+};
+
+SourceFileTable& sourceFileTable() {
+    // Leaked on purpose: locations may be printed from static destructors.
+    static SourceFileTable* table = new SourceFileTable();
+    return *table;
+}
+
+} // namespace
+
+uint32_t SourceFiles::intern(const std::string& filename) {
+    auto& table = sourceFileTable();
+    std::lock_guard<std::mutex> lock(table.mutex);
+    auto found = table.ids.find(filename);
+    if (found != table.ids.end()) return found->second;
+    return table.append(filename);
+}
+
+const std::string& SourceFiles::name(uint32_t id) {
+    auto& table = sourceFileTable();
+    if (id >= table.count.load(std::memory_order_acquire)) return table.empty;
+    const std::string* names =
+        table.chunks[id >> kSourceFileChunkBits].load(std::memory_order_acquire);
+    return names[id & (kSourceFileChunkSize - 1)];
+}
+
 bool Token::isKeyword() const {
     return (type >= TokenType::KeywordBreak && type <= TokenType::KeywordUnique);
 }
@@ -140,7 +204,7 @@ std::string Token::toString() const {
         ss << ", \"" << value << "\"";
     }
     
-    ss << ", " << location.filename << ":" << location.line << ":" << location.column;
+    ss << ", " << location.filename() << ":" << location.line << ":" << location.column;
     ss << ")";
     
     return ss.str();
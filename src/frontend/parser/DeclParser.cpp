@@ -74,7 +74,7 @@ void Parser::parseTypeParameterList(std::vector<std::string>& names,
     do {
         Token parameter = consumeBindingIdentifier(
             "Expected type parameter name");
-        names.push_back(parameter.value);
+        names.push_back(parameter.text());
 
         TypePtr constraint;
         if (match(TokenType::KeywordExtends)) {
@@ -97,7 +97,7 @@ std::unique_ptr<TypeAnnotation> Parser::parseTypeAnnotation() {
         Token parameter = consumeBindingIdentifier(
             "Expected parameter name after 'asserts'");
         auto predicate = std::make_unique<TypeAnnotation>(
-            Type::Kind::TypePredicate, parameter.value);
+            Type::Kind::TypePredicate, parameter.text());
         predicate->location = location;
         predicate->isAssertion = true;
         if (match(TokenType::KeywordIs)) {
@@ -149,11 +149,11 @@ std::unique_ptr<TypeAnnotation> Parser::parsePrimaryType() {
     if (match(TokenType::KeywordTypeof)) {
         Token name = consumeBindingIdentifier(
             "Expected value name after 'typeof'");
-        std::string qualifiedName = name.value;
+        std::string qualifiedName = name.text();
         while (match(TokenType::Dot)) {
             qualifiedName += "." +
                 consumeIdentifierName(
-                    "Expected name after '.' in type query").value;
+                    "Expected name after '.' in type query").text();
         }
         auto query = std::make_unique<TypeAnnotation>(
             Type::Kind::TypeQuery, qualifiedName);
@@ -171,7 +171,7 @@ std::unique_ptr<TypeAnnotation> Parser::parsePrimaryType() {
         // infer T at type level (only valid inside conditional extends)
         const Token nameTok = consumeBindingIdentifier(
             "Expected identifier after 'infer'");
-        auto inf = std::make_unique<TypeAnnotation>(Type::Kind::Infer, nameTok.value);
+        auto inf = std::make_unique<TypeAnnotation>(Type::Kind::Infer, nameTok.text());
         inf->location = location;
         return inf;
     }
@@ -215,7 +215,7 @@ std::unique_ptr<TypeAnnotation> Parser::parsePrimaryType() {
     if (check(TokenType::TemplateLiteral)) {
         Token literal = advance();
         auto templateType = std::make_unique<TypeAnnotation>(
-            Type::Kind::TemplateLiteral, literal.value);
+            Type::Kind::TemplateLiteral, literal.text());
         templateType->location = literal.location;
         return templateType;
     }
@@ -248,7 +248,7 @@ std::unique_ptr<TypeAnnotation> Parser::parsePrimaryType() {
     while (match(TokenType::Dot)) {
         type->name += "." +
             consumeIdentifierName(
-                "Expected type name after '.'").value;
+                "Expected type name after '.'").text();
     }
 
     if (check(TokenType::Less)) {
@@ -421,10 +421,10 @@ std::unique_ptr<TypeAnnotation> Parser::parseObjectType() {
             memberType = share(parseTypeAnnotation());
         }
 
-        object->properties[member.value] = memberType;
-        if (optional) object->optionalProperties.insert(member.value);
+        object->properties[member.text()] = memberType;
+        if (optional) object->optionalProperties.insert(member.text());
         if (readonlyModifier > 0) {
-            object->readonlyProperties.insert(member.value);
+            object->readonlyProperties.insert(member.text());
         }
         if (!match(TokenType::Semicolon)) match(TokenType::Comma);
     }
@@ -82,33 +82,34 @@ bool Parser::tryParseTypeArguments() {
 }
 
 namespace {
-std::unique_ptr<Pattern> expressionToAssignmentPattern(const ExprPtr& expression) {
+PatternPtr expressionToAssignmentPattern(ASTArena& arena,
+                                         const ExprPtr& expression) {
     if (!expression) return nullptr;
-    if (auto* identifier = dynamic_cast<Identifier*>(expression.get())) {
-        return std::make_unique<IdentifierPattern>(identifier->name);
+    if (auto* identifier = ast_cast<Identifier>(expression.get())) {
+        return arena.make<IdentifierPattern>(identifier->name);
     }
-    if (auto* assignment = dynamic_cast<AssignmentExpr*>(expression.get());
+    if (auto* assignment = ast_cast<AssignmentExpr>(expression.get());
         assignment && assignment->op == AssignmentExpr::Op::Assign) {
-        auto left = expressionToAssignmentPattern(assignment->left);
+        auto left = expressionToAssignmentPattern(arena, assignment->left);
         if (!left) return nullptr;
-        return std::make_unique<AssignmentPattern>(
+        return arena.make<AssignmentPattern>(
             std::move(left), assignment->right);
     }
-    if (auto* spread = dynamic_cast<SpreadExpr*>(expression.get())) {
-        auto argument = expressionToAssignmentPattern(spread->argument);
+    if (auto* spread = ast_cast<SpreadExpr>(expression.get())) {
+        auto argument = expressionToAssignmentPattern(arena, spread->argument);
         return argument
-            ? std::make_unique<RestElement>(std::move(argument)) : nullptr;
+            ? arena.make<RestElement>(std::move(argument)) : nullptr;
     }
-    if (auto* array = dynamic_cast<ArrayExpr*>(expression.get())) {
-        auto pattern = std::make_unique<ArrayPattern>();
+    if (auto* array = ast_cast<ArrayExpr>(expression.get())) {
+        auto pattern = arena.make<ArrayPattern>();
         for (const auto& element : array->elements) {
             if (!element) {
                 pattern->elements.push_back(nullptr);
                 continue;
             }
-            auto converted = expressionToAssignmentPattern(element);
+            auto converted = expressionToAssignmentPattern(arena, element);
             if (!converted) return nullptr;
-            if (auto* rest = dynamic_cast<RestElement*>(converted.get())) {
+            if (auto* rest = ast_cast<RestElement>(converted.get())) {
                 pattern->rest = std::move(rest->argument);
             } else {
                 pattern->elements.push_back(std::move(converted));
@@ -116,23 +117,23 @@ std::unique_ptr<Pattern> expressionToAssignmentPattern(const ExprPtr& expression
         }
         return pattern;
     }
-    if (auto* object = dynamic_cast<ObjectExpr*>(expression.get())) {
-        auto pattern = std::make_unique<ObjectPattern>();
+    if (auto* object = ast_cast<ObjectExpr>(expression.get())) {
+        auto pattern = arena.make<ObjectPattern>();
         for (const auto& property : object->properties) {
-            if (auto* spread = dynamic_cast<SpreadExpr*>(property.value.get())) {
-                pattern->rest = expressionToAssignmentPattern(spread->argument);
+            if (auto* spread = ast_cast<SpreadExpr>(property.value.get())) {
+                pattern->rest = expressionToAssignmentPattern(arena, spread->argument);
                 if (!pattern->rest) return nullptr;
                 continue;
             }
             std::string key;
-            if (auto* identifier = dynamic_cast<Identifier*>(property.key.get())) {
+            if (auto* identifier = ast_cast<Identifier>(property.key.get())) {
                 key = identifier->name;
             } else if (auto* literal =
-                           dynamic_cast<StringLiteral*>(property.key.get())) {
+                           ast_cast<StringLiteral>(property.key.get())) {
                 key = literal->value;
             }
             if (key.empty()) return nullptr;
-            auto value = expressionToAssignmentPattern(property.value);
+            auto value = expressionToAssignmentPattern(arena, property.value);
             if (!value) return nullptr;
             ObjectPattern::Property converted;
             converted.key = key;
@@ -153,7 +154,7 @@ UpdateExpr::Op tokenToUpdateOp(TokenType type);
 AssignmentExpr::Op tokenToAssignmentOp(TokenType type);
 
 // Expression parsing with precedence climbing
-std::unique_ptr<Expr> Parser::parseExpression() {
+ExprPtr Parser::parseExpression() {
     auto expr = parseAssignmentExpression();
     
     // Sequence expression (comma operator)
@@ -165,7 +166,7 @@ std::unique_ptr<Expr> Parser::parseExpression() {
             expressions.push_back(parseAssignmentExpression());
         } while (match(TokenType::Comma));
         
-        auto seqExpr = std::make_unique<SequenceExpr>(std::move(expressions));
+        auto seqExpr = make<SequenceExpr>(std::move(expressions));
         seqExpr->location = getCurrentLocation();
         return seqExpr;
     }
@@ -173,7 +174,7 @@ std::unique_ptr<Expr> Parser::parseExpression() {
     return expr;
 }
 
-std::unique_ptr<Expr> Parser::parseAssignmentExpression() {
+ExprPtr Parser::parseAssignmentExpression() {
     // Check for async arrow function: async (params) => body or async x => body
     if (check(TokenType::KeywordAsync)) {
         size_t savedPos = current_;
@@ -184,7 +185,7 @@ std::unique_ptr<Expr> Parser::parseAssignmentExpression() {
             advance(); // consume '('
 
             std::vector<std::string> params;
-            std::vector<std::shared_ptr<Pattern>> paramPatterns;
+            std::vector<PatternPtr> paramPatterns;
             std::vector<ExprPtr> defaultValues;
             std::vector<TypePtr> paramTypes;
             std::string restParam;
@@ -202,7 +203,7 @@ std::unique_ptr<Expr> Parser::parseAssignmentExpression() {
 
                 if (check(TokenType::Arrow)) {
                     advance(); // consume '=>'
-                    auto arrow = std::make_unique<ArrowFunctionExpr>();
+                    auto arrow = make<ArrowFunctionExpr>();
                     arrow->location = getCurrentLocation();
                     arrow->isAsync = true;
                     arrow->returnType = std::move(returnType);
@@ -211,7 +212,7 @@ std::unique_ptr<Expr> Parser::parseAssignmentExpression() {
                         arrow->body = parseBlockStatement();
                     } else {
                         auto expr = parseAssignmentExpression();
-                        auto exprStmt = std::make_unique<ExprStmt>(std::move(expr));
+                        auto exprStmt = make<ExprStmt>(std::move(expr));
                         arrow->body = std::move(exprStmt);
                     }
                     return arrow;
@@ -239,14 +240,14 @@ std::unique_ptr<Expr> Parser::parseAssignmentExpression() {
                                check(TokenType::LeftBrace) ||
                                check(TokenType::LeftBracket)) {
                         if (checkBindingIdentifier()) {
-                            params.push_back(advance().value);
+                            params.push_back(advance().text());
                             paramPatterns.push_back(nullptr);
                         } else {
                             auto pattern = parseBindingPattern();
                             params.push_back(
                                 "__pattern_param_" + std::to_string(params.size()));
                             paramPatterns.push_back(
-                                std::shared_ptr<Pattern>(std::move(pattern)));
+                                PatternPtr(std::move(pattern)));
                         }
 
                         // Optional type annotation
@@ -282,7 +283,7 @@ std::unique_ptr<Expr> Parser::parseAssignmentExpression() {
 
                     if (check(TokenType::Arrow)) {
                         advance(); // consume '=>'
-                        auto arrow = std::make_unique<ArrowFunctionExpr>();
+                        auto arrow = make<ArrowFunctionExpr>();
                         arrow->location = getCurrentLocation();
                         arrow->isAsync = true;
                         arrow->params = std::move(params);
@@ -296,7 +297,7 @@ std::unique_ptr<Expr> Parser::parseAssignmentExpression() {
                             arrow->body = parseBlockStatement();
                         } else {
                             auto expr = parseAssignmentExpression();
-                            auto exprStmt = std::make_unique<ExprStmt>(std::move(expr));
+                            auto exprStmt = make<ExprStmt>(std::move(expr));
                             arrow->body = std::move(exprStmt);
                         }
                         return arrow;
@@ -311,17 +312,17 @@ std::unique_ptr<Expr> Parser::parseAssignmentExpression() {
             Token id = advance();
             if (check(TokenType::Arrow)) {
                 advance(); // consume '=>'
-                auto arrow = std::make_unique<ArrowFunctionExpr>();
+                auto arrow = make<ArrowFunctionExpr>();
                 arrow->location = id.location;
                 arrow->isAsync = true;
-                arrow->params.push_back(id.value);
+                arrow->params.push_back(id.text());
                 arrow->paramTypes.push_back(nullptr);
 
                 if (check(TokenType::LeftBrace)) {
                     arrow->body = parseBlockStatement();
                 } else {
                     auto expr = parseAssignmentExpression();
-                    auto exprStmt = std::make_unique<ExprStmt>(std::move(expr));
+                    auto exprStmt = make<ExprStmt>(std::move(expr));
                     arrow->body = std::move(exprStmt);
                 }
                 return arrow;
@@ -340,9 +341,9 @@ std::unique_ptr<Expr> Parser::parseAssignmentExpression() {
         Token id = advance();
 
         if (match(TokenType::Arrow)) {
-            auto arrow = std::make_unique<ArrowFunctionExpr>();
+            auto arrow = make<ArrowFunctionExpr>();
             arrow->location = id.location;
-            arrow->params.push_back(id.value);
+            arrow->params.push_back(id.text());
             arrow->paramTypes.push_back(nullptr);  // No type annotation for single param
 
             // Parse body
@@ -350,7 +351,7 @@ std::unique_ptr<Expr> Parser::parseAssignmentExpression() {
                 arrow->body = parseBlockStatement();
             } else {
                 auto expr = parseAssignmentExpression();
-                auto exprStmt = std::make_unique<ExprStmt>(std::move(expr));
+                auto exprStmt = make<ExprStmt>(std::move(expr));
                 arrow->body = std::move(exprStmt);
             }
 
@@ -384,19 +385,19 @@ std::unique_ptr<Expr> Parser::parseAssignmentExpression() {
         Token op = advance();
         auto right = parseAssignmentExpression();
         
-        auto assign = std::make_unique<AssignmentExpr>(
+        auto assign = make<AssignmentExpr>(
             tokenToAssignmentOp(op.type),
             std::move(expr),
             std::move(right)
         );
         if (assign->op == AssignmentExpr::Op::Assign &&
-            (dynamic_cast<ArrayExpr*>(assign->left.get()) ||
-             dynamic_cast<ObjectExpr*>(assign->left.get()))) {
-            auto pattern = expressionToAssignmentPattern(assign->left);
+            (ast_cast<ArrayExpr>(assign->left.get()) ||
+             ast_cast<ObjectExpr>(assign->left.get()))) {
+            auto pattern = expressionToAssignmentPattern(*arena_, assign->left);
             if (!pattern) {
                 reportError("Invalid destructuring assignment target");
             } else {
-                assign->pattern = std::shared_ptr<Pattern>(std::move(pattern));
+                assign->pattern = PatternPtr(std::move(pattern));
             }
         }
         assign->location = op.location;
@@ -407,7 +408,7 @@ std::unique_ptr<Expr> Parser::parseAssignmentExpression() {
     return expr;
 }
 
-std::unique_ptr<Expr> Parser::parseConditionalExpression() {
+ExprPtr Parser::parseConditionalExpression() {
     auto expr = parseLogicalOrExpression();
     
     if (match(TokenType::Question)) {
@@ -416,7 +417,7 @@ std::unique_ptr<Expr> Parser::parseConditionalExpression() {
         consume(TokenType::Colon, "Expected ':' in ternary expression");
         auto alternate = parseAssignmentExpression();
         
-        auto conditional = std::make_unique<ConditionalExpr>(
+        auto conditional = make<ConditionalExpr>(
             std::move(test),
             std::move(consequent),
             std::move(alternate)
@@ -428,14 +429,14 @@ std::unique_ptr<Expr> Parser::parseConditionalExpression() {
     return expr;
 }
 
-std::unique_ptr<Expr> Parser::parseLogicalOrExpression() {
+ExprPtr Parser::parseLogicalOrExpression() {
     auto left = parseLogicalAndExpression();
     
     while (match(TokenType::PipePipe) || match(TokenType::QuestionQuestion)) {
         Token op = peek(-1);
         auto right = parseLogicalAndExpression();
         
-        auto binary = std::make_unique<BinaryExpr>(
+        auto binary = make<BinaryExpr>(
             tokenToBinaryOp(op.type),
             std::move(left),
             std::move(right)
@@ -448,14 +449,14 @@ std::unique_ptr<Expr> Parser::parseLogicalOrExpression() {
     return left;
 }
 
-std::unique_ptr<Expr> Parser::parseLogicalAndExpression() {
+ExprPtr Parser::parseLogicalAndExpression() {
     auto left = parseBitwiseOrExpression();
     
     while (match(TokenType::AmpersandAmpersand)) {
         Token op = peek(-1);
         auto right = parseBitwiseOrExpression();
         
-        auto binary = std::make_unique<BinaryExpr>(
+        auto binary = make<BinaryExpr>(
             tokenToBinaryOp(op.type),
             std::move(left),
             std::move(right)
@@ -468,14 +469,14 @@ std::unique_ptr<Expr> Parser::parseLogicalAndExpression() {
     return left;
 }
 
-std::unique_ptr<Expr> Parser::parseBitwiseOrExpression() {
+ExprPtr Parser::parseBitwiseOrExpression() {
     auto left = parseBitwiseXorExpression();
     
     while (match(TokenType::Pipe)) {
         Token op = peek(-1);
         auto right = parseBitwiseXorExpression();
         
-        auto binary = std::make_unique<BinaryExpr>(tokenToBinaryOp(op.type), std::move(left), std::move(right));
+        auto binary = make<BinaryExpr>(tokenToBinaryOp(op.type), std::move(left), std::move(right));
         
         binary->location = op.location;
         
@@ -485,14 +486,14 @@ std::unique_ptr<Expr> Parser::parseBitwiseOrExpression() {
     return left;
 }
 
-std::unique_ptr<Expr> Parser::parseBitwiseXorExpression() {
+ExprPtr Parser::parseBitwiseXorExpression() {
     auto left = parseBitwiseAndExpression();
     
     while (match(TokenType::Caret)) {
         Token op = peek(-1);
         auto right = parseBitwiseAndExpression();
         
-        auto binary = std::make_unique<BinaryExpr>(tokenToBinaryOp(op.type), std::move(left), std::move(right));
+        auto binary = make<BinaryExpr>(tokenToBinaryOp(op.type), std::move(left), std::move(right));
         
         binary->location = op.location;
         
@@ -502,14 +503,14 @@ std::unique_ptr<Expr> Parser::parseBitwiseXorExpression() {
     return left;
 }
 
-std::unique_ptr<Expr> Parser::parseBitwiseAndExpression() {
+ExprPtr Parser::parseBitwiseAndExpression() {
     auto left = parseEqualityExpression();
     
     while (match(TokenType::Ampersand)) {
         Token op = peek(-1);
         auto right = parseEqualityExpression();
         
-        auto binary = std::make_unique<BinaryExpr>(tokenToBinaryOp(op.type), std::move(left), std::move(right));
+        auto binary = make<BinaryExpr>(tokenToBinaryOp(op.type), std::move(left), std::move(right));
         
         binary->location = op.location;
         
@@ -519,7 +520,7 @@ std::unique_ptr<Expr> Parser::parseBitwiseAndExpression() {
     return left;
 }
 
-std::unique_ptr<Expr> Parser::parseEqualityExpression() {
+ExprPtr Parser::parseEqualityExpression() {
     auto left = parseRelationalExpression();
     
     while (match(TokenType::EqualEqual) || 
@@ -529,7 +530,7 @@ std::unique_ptr<Expr> Parser::parseEqualityExpression() {
         Token op = peek(-1);
         auto right = parseRelationalExpression();
         
-        auto binary = std::make_unique<BinaryExpr>(tokenToBinaryOp(op.type), std::move(left), std::move(right));
+        auto binary = make<BinaryExpr>(tokenToBinaryOp(op.type), std::move(left), std::move(right));
         
         binary->location = op.location;
         
@@ -539,7 +540,7 @@ std::unique_ptr<Expr> Parser::parseEqualityExpression() {
     return left;
 }
 
-std::unique_ptr<Expr> Parser::parseRelationalExpression() {
+ExprPtr Parser::parseRelationalExpression() {
     auto left = parseShiftExpression();
 
     while (true) {
@@ -555,7 +556,7 @@ std::unique_ptr<Expr> Parser::parseRelationalExpression() {
         Token op = peek(-1);
         auto right = parseShiftExpression();
         
-        auto binary = std::make_unique<BinaryExpr>(tokenToBinaryOp(op.type), std::move(left), std::move(right));
+        auto binary = make<BinaryExpr>(tokenToBinaryOp(op.type), std::move(left), std::move(right));
         
         binary->location = op.location;
         
@@ -565,7 +566,7 @@ std::unique_ptr<Expr> Parser::parseRelationalExpression() {
     return left;
 }
 
-std::unique_ptr<Expr> Parser::parseShiftExpression() {
+ExprPtr Parser::parseShiftExpression() {
     auto left = parseAdditiveExpression();
     
     while (match(TokenType::LessLess) || 
@@ -574,7 +575,7 @@ std::unique_ptr<Expr> Parser::parseShiftExpression() {
         Token op = peek(-1);
         auto right = parseAdditiveExpression();
         
-        auto binary = std::make_unique<BinaryExpr>(tokenToBinaryOp(op.type), std::move(left), std::move(right));
+        auto binary = make<BinaryExpr>(tokenToBinaryOp(op.type), std::move(left), std::move(right));
         
         binary->location = op.location;
         
@@ -584,14 +585,14 @@ std::unique_ptr<Expr> Parser::parseShiftExpression() {
     return left;
 }
 
-std::unique_ptr<Expr> Parser::parseAdditiveExpression() {
+ExprPtr Parser::parseAdditiveExpression() {
     auto left = parseMultiplicativeExpression();
     
     while (match(TokenType::Plus) || match(TokenType::Minus)) {
         Token op = peek(-1);
         auto right = parseMultiplicativeExpression();
         
-        auto binary = std::make_unique<BinaryExpr>(tokenToBinaryOp(op.type), std::move(left), std::move(right));
+        auto binary = make<BinaryExpr>(tokenToBinaryOp(op.type), std::move(left), std::move(right));
         
         binary->location = op.location;
         
@@ -601,7 +602,7 @@ std::unique_ptr<Expr> Parser::parseAdditiveExpression() {
     return left;
 }
 
-std::unique_ptr<Expr> Parser::parseMultiplicativeExpression() {
+ExprPtr Parser::parseMultiplicativeExpression() {
     auto left = parseExponentiationExpression();
     
     while (match(TokenType::Star) || 
@@ -610,7 +611,7 @@ std::unique_ptr<Expr> Parser::parseMultiplicativeExpression() {
         Token op = peek(-1);
         auto right = parseExponentiationExpression();
         
-        auto binary = std::make_unique<BinaryExpr>(tokenToBinaryOp(op.type), std::move(left), std::move(right));
+        auto binary = make<BinaryExpr>(tokenToBinaryOp(op.type), std::move(left), std::move(right));
         
         binary->location = op.location;
         
@@ -620,7 +621,7 @@ std::unique_ptr<Expr> Parser::parseMultiplicativeExpression() {
     return left;
 }
 
-std::unique_ptr<Expr> Parser::parseExponentiationExpression() {
+ExprPtr Parser::parseExponentiationExpression() {
     auto left = parseUnaryExpression();
     
     if (match(TokenType::StarStar)) {
@@ -628,7 +629,7 @@ std::unique_ptr<Expr> Parser::parseExponentiationExpression() {
         // Right associative
         auto right = parseExponentiationExpression();
         
-        auto binary = std::make_unique<BinaryExpr>(tokenToBinaryOp(op.type), std::move(left), std::move(right));
+        auto binary = make<BinaryExpr>(tokenToBinaryOp(op.type), std::move(left), std::move(right));
         
         binary->location = op.location;
         
@@ -638,7 +639,7 @@ std::unique_ptr<Expr> Parser::parseExponentiationExpression() {
     return left;
 }
 
-std::unique_ptr<Expr> Parser::parseUnaryExpression() {
+ExprPtr Parser::parseUnaryExpression() {
     // Yield expression
     if (match(TokenType::KeywordYield)) {
         bool isDelegate = false;
@@ -655,7 +656,7 @@ std::unique_ptr<Expr> Parser::parseUnaryExpression() {
             argument = parseAssignmentExpression();
         }
         
-        auto yieldExpr = std::make_unique<YieldExpr>(std::move(argument), isDelegate);
+        auto yieldExpr = make<YieldExpr>(std::move(argument), isDelegate);
         yieldExpr->location = getCurrentLocation();
         return yieldExpr;
     }
@@ -665,7 +666,7 @@ std::unique_ptr<Expr> Parser::parseUnaryExpression() {
         Token op = peek(-1);
         auto argument = parseUnaryExpression();
 
-        auto awaitExpr = std::make_unique<AwaitExpr>(std::move(argument));
+        auto awaitExpr = make<AwaitExpr>(std::move(argument));
         awaitExpr->location = op.location;
 
         return awaitExpr;
@@ -682,7 +683,7 @@ std::unique_ptr<Expr> Parser::parseUnaryExpression() {
         Token op = peek(-1);
         auto argument = parseUnaryExpression();
 
-        auto unary = std::make_unique<UnaryExpr>(
+        auto unary = make<UnaryExpr>(
             tokenToUnaryOp(op.type),
             std::move(argument),
             true
@@ -697,7 +698,7 @@ std::unique_ptr<Expr> Parser::parseUnaryExpression() {
         Token op = peek(-1);
         auto argument = parsePostfixExpression();
         
-        auto update = std::make_unique<UpdateExpr>(
+        auto update = make<UpdateExpr>(
             tokenToUpdateOp(op.type),
             std::move(argument),
             true
@@ -710,7 +711,7 @@ std::unique_ptr<Expr> Parser::parseUnaryExpression() {
     return parsePostfixExpression();
 }
 
-std::unique_ptr<Expr> Parser::parsePostfixExpression() {
+ExprPtr Parser::parsePostfixExpression() {
     auto expr = parsePrimaryExpression();
     
     while (true) {
@@ -724,7 +725,7 @@ std::unique_ptr<Expr> Parser::parsePostfixExpression() {
                 // Private field: #fieldName
                 if (check(TokenType::Identifier)) {
                     Token fieldName = advance();
-                    propName = "#" + fieldName.value;
+                    propName = "#" + fieldName.text();
                     prop = Token(TokenType::Identifier, propName, fieldName.location);
                 } else {
                     reportError("Expected private field name after #");
@@ -740,10 +741,10 @@ std::unique_ptr<Expr> Parser::parsePostfixExpression() {
                 propName = "";
             }
 
-            auto propExpr = std::make_unique<Identifier>(propName);
+            auto propExpr = make<Identifier>(propName);
             propExpr->location = prop.location;
             
-            auto member = std::make_unique<MemberExpr>(
+            auto member = make<MemberExpr>(
                 std::move(expr),
                 std::move(propExpr),
                 false, // isComputed
@@ -758,7 +759,7 @@ std::unique_ptr<Expr> Parser::parsePostfixExpression() {
             auto property = parseExpression();
             consume(TokenType::RightBracket, "Expected ']'");
             
-            auto member = std::make_unique<MemberExpr>(
+            auto member = make<MemberExpr>(
                 std::move(expr),
                 std::move(property),
                 true,  // isComputed
@@ -781,7 +782,7 @@ std::unique_ptr<Expr> Parser::parsePostfixExpression() {
                 std::vector<ExprPtr> arguments;
                 while (!check(TokenType::RightParen) && !isAtEnd()) {
                     if (match(TokenType::DotDotDot)) {
-                        auto spread = std::make_unique<SpreadExpr>(parseAssignmentExpression());
+                        auto spread = make<SpreadExpr>(parseAssignmentExpression());
                         spread->location = getCurrentLocation();
                         arguments.push_back(std::move(spread));
                     } else {
@@ -792,7 +793,7 @@ std::unique_ptr<Expr> Parser::parsePostfixExpression() {
                     }
                 }
                 consume(TokenType::RightParen, "Expected ')' after arguments");
-                auto call = std::make_unique<CallExpr>(std::move(expr), std::move(arguments));
+                auto call = make<CallExpr>(std::move(expr), std::move(arguments));
                 call->location = getCurrentLocation();
                 expr = std::move(call);
             } else {
@@ -808,7 +809,7 @@ std::unique_ptr<Expr> Parser::parsePostfixExpression() {
             while (!check(TokenType::RightParen) && !isAtEnd()) {
                 // Check for spread argument: fn(...arr)
                 if (match(TokenType::DotDotDot)) {
-                    auto spread = std::make_unique<SpreadExpr>(parseAssignmentExpression());
+                    auto spread = make<SpreadExpr>(parseAssignmentExpression());
                     spread->location = getCurrentLocation();
                     arguments.push_back(std::move(spread));
                 } else {
@@ -820,7 +821,7 @@ std::unique_ptr<Expr> Parser::parsePostfixExpression() {
             }
             consume(TokenType::RightParen, "Expected ')' after arguments");
 
-            auto call = std::make_unique<CallExpr>(std::move(expr), std::move(arguments));
+            auto call = make<CallExpr>(std::move(expr), std::move(arguments));
             call->location = getCurrentLocation();
 
             expr = std::move(call);
@@ -834,10 +835,10 @@ std::unique_ptr<Expr> Parser::parsePostfixExpression() {
                 prop = consume(TokenType::Identifier, "Expected property name");
             }
             
-            auto propExpr = std::make_unique<Identifier>(prop.value);
+            auto propExpr = make<Identifier>(prop.text());
             propExpr->location = prop.location;
             
-            auto member = std::make_unique<MemberExpr>(
+            auto member = make<MemberExpr>(
                 std::move(expr),
                 std::move(propExpr),
                 false, // isComputed
@@ -851,7 +852,7 @@ std::unique_ptr<Expr> Parser::parsePostfixExpression() {
         else if (match(TokenType::PlusPlus) || match(TokenType::MinusMinus)) {
             Token op = peek(-1);
             
-            auto update = std::make_unique<UpdateExpr>(
+            auto update = make<UpdateExpr>(
                 tokenToUpdateOp(op.type),
                 std::move(expr),
                 false
@@ -862,19 +863,19 @@ std::unique_ptr<Expr> Parser::parsePostfixExpression() {
         }
         // Non-null assertion: expr!
         else if (match(TokenType::Exclamation)) {
-            auto nonNull = std::make_unique<NonNullExpr>(std::move(expr));
+            auto nonNull = make<NonNullExpr>(std::move(expr));
             nonNull->location = getCurrentLocation();
             expr = std::move(nonNull);
         }
         // Type assertion: expr as Type
         else if (match(TokenType::KeywordAs)) {
-            auto asExpr = std::make_unique<AsExpr>(std::move(expr), parseTypeAnnotation());
+            auto asExpr = make<AsExpr>(std::move(expr), parseTypeAnnotation());
             asExpr->location = getCurrentLocation();
             expr = std::move(asExpr);
         }
         // Satisfies: expr satisfies Type
         else if (match(TokenType::KeywordSatisfies)) {
-            auto satisfies = std::make_unique<SatisfiesExpr>(std::move(expr), parseTypeAnnotation());
+            auto satisfies = make<SatisfiesExpr>(std::move(expr), parseTypeAnnotation());
             satisfies->location = getCurrentLocation();
             expr = std::move(satisfies);
         }
@@ -883,9 +884,9 @@ std::unique_ptr<Expr> Parser::parsePostfixExpression() {
             auto templateLit = parseTemplateLiteral();
             
             // Extract quasis and expressions from template literal
-            auto* tempLit = dynamic_cast<TemplateLiteralExpr*>(templateLit.get());
+            auto* tempLit = ast_cast<TemplateLiteralExpr>(templateLit.get());
             if (tempLit) {
-                auto tagged = std::make_unique<TaggedTemplateExpr>(
+                auto tagged = make<TaggedTemplateExpr>(
                     std::move(expr),
                     std::move(tempLit->quasis),
                     std::move(tempLit->expressions)
@@ -904,7 +905,7 @@ std::unique_ptr<Expr> Parser::parsePostfixExpression() {
     return expr;
 }
 
-std::unique_ptr<Expr> Parser::parsePrimaryExpression() {
+ExprPtr Parser::parsePrimaryExpression() {
     // JSX is selected by the source extension. In .ts files the same token
     // sequence is an angle-bracket type assertion; TypeScript deliberately
     // forbids that assertion form in .tsx files to remove the ambiguity.
@@ -920,7 +921,7 @@ std::unique_ptr<Expr> Parser::parsePrimaryExpression() {
             auto targetType = parseTypeAnnotation();
             consumeTypeArgumentClose(
                 "Expected '>' after type assertion");
-            auto assertion = std::make_unique<AsExpr>(
+            auto assertion = make<AsExpr>(
                 parseUnaryExpression(), std::move(targetType));
             assertion->location = opening.location;
             return assertion;
@@ -960,7 +961,7 @@ std::unique_ptr<Expr> Parser::parsePrimaryExpression() {
         // Try to detect arrow function: (a, b) => body
         size_t savedPos = current_;
         std::vector<std::string> params;
-        std::vector<std::shared_ptr<Pattern>> paramPatterns;
+        std::vector<PatternPtr> paramPatterns;
         std::vector<ExprPtr> defaultValues;
         std::string restParam;
         bool couldBeArrow = true;
@@ -974,7 +975,7 @@ std::unique_ptr<Expr> Parser::parsePrimaryExpression() {
             }
             if (check(TokenType::Arrow)) {
                 advance();
-                auto arrow = std::make_unique<ArrowFunctionExpr>();
+                auto arrow = make<ArrowFunctionExpr>();
                 arrow->location = getCurrentLocation();
                 arrow->returnType = std::move(returnType);
                 // Empty params and paramTypes (no parameters)
@@ -983,7 +984,7 @@ std::unique_ptr<Expr> Parser::parsePrimaryExpression() {
                     arrow->body = parseBlockStatement();
                 } else {
                     auto expr = parseAssignmentExpression();
-                    auto exprStmt = std::make_unique<ExprStmt>(std::move(expr));
+                    auto exprStmt = make<ExprStmt>(std::move(expr));
                     arrow->body = std::move(exprStmt);
                 }
                 return arrow;
@@ -1016,14 +1017,14 @@ std::unique_ptr<Expr> Parser::parsePrimaryExpression() {
                        check(TokenType::LeftBrace) ||
                        check(TokenType::LeftBracket)) {
                 if (checkBindingIdentifier()) {
-                    params.push_back(advance().value);
+                    params.push_back(advance().text());
                     paramPatterns.push_back(nullptr);
                 } else {
                     auto pattern = parseBindingPattern();
                     params.push_back(
                         "__pattern_param_" + std::to_string(params.size()));
                     paramPatterns.push_back(
-                        std::shared_ptr<Pattern>(std::move(pattern)));
+                        PatternPtr(std::move(pattern)));
                 }
 
                 // Optional type annotation
@@ -1059,7 +1060,7 @@ std::unique_ptr<Expr> Parser::parsePrimaryExpression() {
 
             if (check(TokenType::Arrow)) {
                 advance(); // consume '=>'
-                auto arrow = std::make_unique<ArrowFunctionExpr>();
+                auto arrow = make<ArrowFunctionExpr>();
                 arrow->location = getCurrentLocation();
                 arrow->params = std::move(params);
                 arrow->paramPatterns = std::move(paramPatterns);
@@ -1072,7 +1073,7 @@ std::unique_ptr<Expr> Parser::parsePrimaryExpression() {
                     arrow->body = parseBlockStatement();
                 } else {
                     auto expr = parseAssignmentExpression();
-                    auto exprStmt = std::make_unique<ExprStmt>(std::move(expr));
+                    auto exprStmt = make<ExprStmt>(std::move(expr));
                     arrow->body = std::move(exprStmt);
                 }
                 return arrow;
@@ -1109,14 +1110,14 @@ std::unique_ptr<Expr> Parser::parsePrimaryExpression() {
     
     // This
     if (match(TokenType::KeywordThis)) {
-        auto thisExpr = std::make_unique<ThisExpr>();
+        auto thisExpr = make<ThisExpr>();
         thisExpr->location = getCurrentLocation();
         return thisExpr;
     }
     
     // Super
     if (match(TokenType::KeywordSuper)) {
-        auto superExpr = std::make_unique<SuperExpr>();
+        auto superExpr = make<SuperExpr>();
         superExpr->location = getCurrentLocation();
         return superExpr;
     }
@@ -1127,7 +1128,7 @@ std::unique_ptr<Expr> Parser::parsePrimaryExpression() {
         if (match(TokenType::Dot)) {
             Token target = consume(TokenType::Identifier, "Expected 'target' after 'new.'");
             if (target.value == "target") {
-                auto meta = std::make_unique<MetaProperty>("new", "target");
+                auto meta = make<MetaProperty>("new", "target");
                 meta->location = getCurrentLocation();
                 return meta;
             } else {
@@ -1152,9 +1153,9 @@ std::unique_ptr<Expr> Parser::parsePrimaryExpression() {
                         "Expected constructor property name");
                 }
                 auto propertyExpr =
-                    std::make_unique<Identifier>(property.value);
+                    make<Identifier>(property.text());
                 propertyExpr->location = property.location;
-                auto member = std::make_unique<MemberExpr>(
+                auto member = make<MemberExpr>(
                     std::move(callee), std::move(propertyExpr),
                     false, false);
                 member->location = property.location;
@@ -1164,7 +1165,7 @@ std::unique_ptr<Expr> Parser::parsePrimaryExpression() {
             if (match(TokenType::LeftBracket)) {
                 auto property = parseExpression();
                 consume(TokenType::RightBracket, "Expected ']'");
-                auto member = std::make_unique<MemberExpr>(
+                auto member = make<MemberExpr>(
                     std::move(callee), std::move(property),
                     true, false);
                 member->location = getCurrentLocation();
@@ -1204,7 +1205,7 @@ std::unique_ptr<Expr> Parser::parsePrimaryExpression() {
             consume(TokenType::RightParen, "Expected ')' after arguments");
         }
         
-        auto newExpr = std::make_unique<NewExpr>(std::move(callee), std::move(arguments));
+        auto newExpr = make<NewExpr>(std::move(callee), std::move(arguments));
         newExpr->location = getCurrentLocation();
         
         return newExpr;
@@ -1217,7 +1218,7 @@ std::unique_ptr<Expr> Parser::parsePrimaryExpression() {
             auto source = parseAssignmentExpression();
             consume(TokenType::RightParen, "Expected ')' after import source");
             
-            auto importExpr = std::make_unique<ImportExpr>(std::move(source));
+            auto importExpr = make<ImportExpr>(std::move(source));
             importExpr->location = getCurrentLocation();
             return importExpr;
         }
@@ -1225,7 +1226,7 @@ std::unique_ptr<Expr> Parser::parsePrimaryExpression() {
         else if (match(TokenType::Dot)) {
             Token meta = consume(TokenType::Identifier, "Expected 'meta' after 'import.'");
             if (meta.value == "meta") {
-                auto metaProp = std::make_unique<MetaProperty>("import", "meta");
+                auto metaProp = make<MetaProperty>("import", "meta");
                 metaProp->location = getCurrentLocation();
                 return metaProp;
             } else {
@@ -1238,16 +1239,16 @@ std::unique_ptr<Expr> Parser::parsePrimaryExpression() {
     throw std::runtime_error("Unexpected token");
 }
 
-std::unique_ptr<Expr> Parser::parseIdentifier() {
+ExprPtr Parser::parseIdentifier() {
     Token id = consumeBindingIdentifier("Expected identifier");
     
-    auto identifier = std::make_unique<Identifier>(id.value);
+    auto identifier = make<Identifier>(id.text());
     identifier->location = id.location;
     
     return identifier;
 }
 
-std::unique_ptr<Expr> Parser::parseLiteral() {
+ExprPtr Parser::parseLiteral() {
     Token lit = advance();
     
     switch (lit.type) {
@@ -1255,23 +1256,23 @@ std::unique_ptr<Expr> Parser::parseLiteral() {
             // Check if it's a BigInt literal (ends with 'n')
             if (!lit.value.empty() && lit.value.back() == 'n') {
                 // BigInt literal - remove the 'n' suffix
-                std::string bigintValue = lit.value.substr(0, lit.value.length() - 1);
-                auto bigintLit = std::make_unique<BigIntLiteral>(bigintValue);
+                std::string bigintValue(lit.value.substr(0, lit.value.length() - 1));
+                auto bigintLit = make<BigIntLiteral>(bigintValue);
                 bigintLit->location = lit.location;
                 return bigintLit;
             }
-            auto numLit = std::make_unique<NumberLiteral>(std::stod(lit.value), lit.value);
+            auto numLit = make<NumberLiteral>(std::stod(lit.text()), lit.text());
             numLit->location = lit.location;
             return numLit;
         }
         case TokenType::StringLiteral: {
-            auto strLit = std::make_unique<StringLiteral>(lit.value);
+            auto strLit = make<StringLiteral>(lit.text());
             strLit->location = lit.location;
             return strLit;
         }
         case TokenType::RegexLiteral: {
             // Parse regex literal: /pattern/flags
-            std::string value = lit.value;
+            std::string value = lit.text();
             // Remove leading /
             if (value.length() > 0 && value[0] == '/') {
                 value = value.substr(1);
@@ -1285,27 +1286,27 @@ std::unique_ptr<Expr> Parser::parseLiteral() {
             } else {
                 pattern = value;
             }
-            auto regexLit = std::make_unique<RegexLiteralExpr>(pattern, flags);
+            auto regexLit = make<RegexLiteralExpr>(pattern, flags);
             regexLit->location = lit.location;
             return regexLit;
         }
         case TokenType::TrueLiteral: {
-            auto boolLit = std::make_unique<BooleanLiteral>(true);
+            auto boolLit = make<BooleanLiteral>(true);
             boolLit->location = lit.location;
             return boolLit;
         }
         case TokenType::FalseLiteral: {
-            auto boolLit = std::make_unique<BooleanLiteral>(false);
+            auto boolLit = make<BooleanLiteral>(false);
             boolLit->location = lit.location;
             return boolLit;
         }
         case TokenType::NullLiteral: {
-            auto nullLit = std::make_unique<NullLiteral>();
+            auto nullLit = make<NullLiteral>();
             nullLit->location = lit.location;
             return nullLit;
         }
         case TokenType::UndefinedLiteral: {
-            auto undefLit = std::make_unique<UndefinedLiteral>();
+            auto undefLit = make<UndefinedLiteral>();
             undefLit->location = lit.location;
             return undefLit;
         }
@@ -1315,7 +1316,7 @@ std::unique_ptr<Expr> Parser::parseLiteral() {
     }
 }
 
-std::unique_ptr<Expr> Parser::parseArrayLiteral() {
+ExprPtr Parser::parseArrayLiteral() {
     consume(TokenType::LeftBracket, "Expected '['");
     
     std::vector<ExprPtr> elements;
@@ -1327,7 +1328,7 @@ std::unique_ptr<Expr> Parser::parseArrayLiteral() {
         } 
         // Spread element: [...arr]
         else if (match(TokenType::DotDotDot)) {
-            auto spread = std::make_unique<SpreadExpr>(parseAssignmentExpression());
+            auto spread = make<SpreadExpr>(parseAssignmentExpression());
             spread->location = getCurrentLocation();
             elements.push_back(std::move(spread));
         } 
@@ -1342,13 +1343,13 @@ std::unique_ptr<Expr> Parser::parseArrayLiteral() {
     
     consume(TokenType::RightBracket, "Expected ']'");
     
-    auto array = std::make_unique<ArrayExpr>(std::move(elements));
+    auto array = make<ArrayExpr>(std::move(elements));
     array->location = getCurrentLocation();
     
     return array;
 }
 
-std::unique_ptr<Expr> Parser::parseObjectLiteral() {
+ExprPtr Parser::parseObjectLiteral() {
     consume(TokenType::LeftBrace, "Expected '{'");
 
     std::vector<ObjectExpr::Property> properties;
@@ -1356,7 +1357,7 @@ std::unique_ptr<Expr> Parser::parseObjectLiteral() {
     auto parseMethod = [this](const SourceLocation& location,
                               bool isAsync,
                               bool isGenerator) {
-        auto function = std::make_unique<FunctionExpr>();
+        auto function = make<FunctionExpr>();
         function->location = location;
         function->isAsync = isAsync;
         function->isGenerator = isGenerator;
@@ -1382,11 +1383,11 @@ std::unique_ptr<Expr> Parser::parseObjectLiteral() {
                     "__pattern_param_" +
                     std::to_string(function->params.size()));
                 function->paramPatterns.push_back(
-                    std::shared_ptr<Pattern>(std::move(pattern)));
+                    PatternPtr(std::move(pattern)));
             } else {
                 Token parameter = consumeBindingIdentifier(
                     "Expected parameter name");
-                function->params.push_back(parameter.value);
+                function->params.push_back(parameter.text());
                 function->paramPatterns.push_back(nullptr);
             }
 
@@ -1419,11 +1420,11 @@ std::unique_ptr<Expr> Parser::parseObjectLiteral() {
     while (!check(TokenType::RightBrace) && !isAtEnd()) {
         // Spread property: { ...obj }
         if (match(TokenType::DotDotDot)) {
-            auto spread = std::make_unique<SpreadExpr>(parseAssignmentExpression());
+            auto spread = make<SpreadExpr>(parseAssignmentExpression());
             spread->location = getCurrentLocation();
 
             ObjectExpr::Property prop;
-            auto keyIdent = std::make_unique<StringLiteral>("...");
+            auto keyIdent = make<StringLiteral>("...");
             prop.key = std::move(keyIdent);
             prop.value = std::move(spread);
             prop.isComputed = false;
@@ -1480,22 +1481,22 @@ std::unique_ptr<Expr> Parser::parseObjectLiteral() {
             consume(TokenType::RightBracket, "Expected ']' after computed property");
         } else if (check(TokenType::StringLiteral)) {
             Token key = advance();
-            auto keyStr = std::make_unique<StringLiteral>(key.value);
+            auto keyStr = make<StringLiteral>(key.text());
             keyStr->location = key.location;
             property.key = std::move(keyStr);
             property.isComputed = false;
             keyLocation = key.location;
         } else if (check(TokenType::NumberLiteral)) {
             Token key = advance();
-            auto keyNumber = std::make_unique<NumberLiteral>(
-                std::stod(key.value), key.value);
+            auto keyNumber = make<NumberLiteral>(
+                std::stod(key.text()), key.text());
             keyNumber->location = key.location;
             property.key = std::move(keyNumber);
             property.isComputed = false;
             keyLocation = key.location;
         } else if (checkIdentifierName()) {
             Token key = consumeIdentifierName("Expected property name");
-            auto keyIdent = std::make_unique<Identifier>(key.value);
+            auto keyIdent = make<Identifier>(key.text());
             keyIdent->location = key.location;
             property.key = std::move(keyIdent);
             property.isComputed = false;
@@ -1521,8 +1522,8 @@ std::unique_ptr<Expr> Parser::parseObjectLiteral() {
                 (check(TokenType::Comma) || check(TokenType::RightBrace))) {
                 property.isShorthand = true;
                 const auto* identifier =
-                    dynamic_cast<Identifier*>(property.key.get());
-                auto value = std::make_unique<Identifier>(
+                    ast_cast<Identifier>(property.key.get());
+                auto value = make<Identifier>(
                     identifier ? identifier->name : "");
                 value->location = keyLocation;
                 property.value = std::move(value);
@@ -1544,15 +1545,15 @@ std::unique_ptr<Expr> Parser::parseObjectLiteral() {
 
     consume(TokenType::RightBrace, "Expected '}'");
 
-    auto object = std::make_unique<ObjectExpr>(std::move(properties));
+    auto object = make<ObjectExpr>(std::move(properties));
     object->location = getCurrentLocation();
 
     return object;
 }
 
 // Placeholder implementations
-std::unique_ptr<Expr> Parser::parseFunctionExpression() {
-    auto func = std::make_unique<FunctionExpr>();
+ExprPtr Parser::parseFunctionExpression() {
+    auto func = make<FunctionExpr>();
     func->location = getCurrentLocation();
     
     // Generator? (function*)
@@ -1586,11 +1587,11 @@ std::unique_ptr<Expr> Parser::parseFunctionExpression() {
             func->params.push_back(
                 "__pattern_param_" + std::to_string(func->params.size()));
             func->paramPatterns.push_back(
-                std::shared_ptr<Pattern>(std::move(pattern)));
+                PatternPtr(std::move(pattern)));
         } else {
             Token param = consumeBindingIdentifier(
                 "Expected parameter name");
-            func->params.push_back(param.value);
+            func->params.push_back(param.text());
             func->paramPatterns.push_back(nullptr);
         }
         
@@ -1625,8 +1626,8 @@ std::unique_ptr<Expr> Parser::parseFunctionExpression() {
     return func;
 }
 
-std::unique_ptr<Expr> Parser::parseArrowFunction() {
-    auto arrow = std::make_unique<ArrowFunctionExpr>();
+ExprPtr Parser::parseArrowFunction() {
+    auto arrow = make<ArrowFunctionExpr>();
     arrow->location = getCurrentLocation();
     
     // Parameters - already parsed by caller
@@ -1640,8 +1641,8 @@ std::unique_ptr<Expr> Parser::parseArrowFunction() {
     return nullptr;
 }
 
-std::unique_ptr<Expr> Parser::parseClassExpression() {
-    auto classExpr = std::make_unique<ClassExpr>();
+ExprPtr Parser::parseClassExpression() {
+    auto classExpr = make<ClassExpr>();
     classExpr->location = getCurrentLocation();
 
     // Optional name
@@ -1738,7 +1739,7 @@ std::unique_ptr<Expr> Parser::parseClassExpression() {
             while (!check(TokenType::RightParen) && !isAtEnd()) {
                 Token param = consumeBindingIdentifier(
                     "Expected parameter name");
-                method.params.push_back(param.value);
+                method.params.push_back(param.text());
 
                 match(TokenType::Question);
                 if (match(TokenType::Colon)) {
@@ -1794,9 +1795,9 @@ std::unique_ptr<Expr> Parser::parseClassExpression() {
     return classExpr;
 }
 
-std::unique_ptr<Expr> Parser::parseTemplateLiteral() {
+ExprPtr Parser::parseTemplateLiteral() {
     Token lit = advance();
-    std::string templateStr = lit.value;
+    std::string templateStr = lit.text();
 
     // Parse template literal with ${} expressions
     std::vector<std::string> quasis;
@@ -1827,7 +1828,7 @@ std::unique_ptr<Expr> Parser::parseTemplateLiteral() {
         std::string exprStr = templateStr.substr(pos + 2, end - pos - 3);
         
         // Create a mini-lexer for the expression
-        Lexer exprLexer(lit.location.filename, exprStr);
+        Lexer exprLexer(lit.location.filename(), exprStr);
         
         // Save current parser state
         size_t savedPos = current_;
@@ -1849,7 +1850,7 @@ std::unique_ptr<Expr> Parser::parseTemplateLiteral() {
     // Add the final string part
     quasis.push_back(templateStr.substr(start));
     
-    auto templateLit = std::make_unique<TemplateLiteralExpr>(
+    auto templateLit = make<TemplateLiteralExpr>(
         std::move(quasis),
         std::move(expressions)
     );
@@ -1857,7 +1858,7 @@ std::unique_ptr<Expr> Parser::parseTemplateLiteral() {
     return templateLit;
 }
 
-std::unique_ptr<Expr> Parser::parseParenthesizedExpression() {
+ExprPtr Parser::parseParenthesizedExpression() {
     auto expr = parseExpression();
     consume(TokenType::RightParen, "Expected ')'");
     return expr;
@@ -1865,14 +1866,14 @@ std::unique_ptr<Expr> Parser::parseParenthesizedExpression() {
 
 // ==================== JSX/TSX Parsing ====================
 
-std::unique_ptr<Expr> Parser::parseJSXElement() {
+ExprPtr Parser::parseJSXElement() {
     const SourceLocation location = getCurrentLocation();
     consume(TokenType::Less, "Expected '<'");
     
     // JSX Fragment: <>...</>
     if (check(TokenType::Greater)) {
         advance(); // consume '>'
-        auto fragment = std::make_unique<JSXFragment>();
+        auto fragment = make<JSXFragment>();
         fragment->location = getCurrentLocation();
         
         // Parse children until </>
@@ -1892,19 +1893,19 @@ std::unique_ptr<Expr> Parser::parseJSXElement() {
     // JSX Element: <TagName ...>
     if (!checkIdentifierName()) {
         reportError("Expected JSX tag name");
-        return std::make_unique<NullLiteral>();
+        return make<NullLiteral>();
     }
 
     std::string tagName = consumeIdentifierName(
-        "Expected JSX tag name").value;
+        "Expected JSX tag name").text();
     while (check(TokenType::Dot) || check(TokenType::Colon) ||
            check(TokenType::Minus)) {
-        const std::string separator = advance().value;
+        const std::string separator = advance().text();
         tagName += separator +
             consumeIdentifierName(
-                "Expected JSX name after separator").value;
+                "Expected JSX name after separator").text();
     }
-    auto element = std::make_unique<JSXElement>(tagName);
+    auto element = make<JSXElement>(tagName);
     element->location = location;
     
     // Parse attributes
@@ -1919,7 +1920,7 @@ std::unique_ptr<Expr> Parser::parseJSXElement() {
             if (match(TokenType::DotDotDot)) {
                 auto expr = parseExpression();
                 element->spreadAttributes.push_back(
-                    std::make_unique<JSXSpreadAttribute>(std::move(expr)));
+                    make<JSXSpreadAttribute>(std::move(expr)));
                 consume(TokenType::RightBrace, "Expected '}' after spread");
                 continue;
             }
@@ -1930,13 +1931,13 @@ std::unique_ptr<Expr> Parser::parseJSXElement() {
         if (checkIdentifierName()) {
             std::string attrName =
                 consumeIdentifierName(
-                    "Expected JSX attribute name").value;
+                    "Expected JSX attribute name").text();
             while (check(TokenType::Colon) ||
                    check(TokenType::Minus)) {
-                const std::string separator = advance().value;
+                const std::string separator = advance().text();
                 attrName += separator +
                     consumeIdentifierName(
-                        "Expected JSX attribute name after separator").value;
+                        "Expected JSX attribute name after separator").text();
             }
             ExprPtr attrValue = nullptr;
             
@@ -1950,7 +1951,7 @@ std::unique_ptr<Expr> Parser::parseJSXElement() {
             }
             
             element->attributes.push_back(
-                std::make_unique<JSXAttribute>(attrName, std::move(attrValue)));
+                make<JSXAttribute>(attrName, std::move(attrValue)));
         } else {
             break;
         }
@@ -1978,13 +1979,13 @@ std::unique_ptr<Expr> Parser::parseJSXElement() {
     consume(TokenType::Less, "Expected closing tag");
     consume(TokenType::Slash, "Expected '/' in closing tag");
     std::string closingName =
-        consumeIdentifierName("Expected JSX closing tag name").value;
+        consumeIdentifierName("Expected JSX closing tag name").text();
     while (check(TokenType::Dot) || check(TokenType::Colon) ||
            check(TokenType::Minus)) {
-        const std::string separator = advance().value;
+        const std::string separator = advance().text();
         closingName += separator +
             consumeIdentifierName(
-                "Expected JSX closing name after separator").value;
+                "Expected JSX closing name after separator").text();
     }
     if (closingName != tagName) {
         reportError("Mismatched JSX closing tag");
@@ -1994,18 +1995,18 @@ std::unique_ptr<Expr> Parser::parseJSXElement() {
     return element;
 }
 
-std::unique_ptr<Expr> Parser::parseJSXChild() {
+ExprPtr Parser::parseJSXChild() {
     // JSX Expression: {expr}
     if (match(TokenType::LeftBrace)) {
         if (match(TokenType::RightBrace)) {
-            auto empty = std::make_unique<JSXExpressionContainer>(
-                std::make_unique<NullLiteral>());
+            auto empty = make<JSXExpressionContainer>(
+                make<NullLiteral>());
             empty->location = getCurrentLocation();
             return empty;
         }
         auto expr = parseAssignmentExpression();
         consume(TokenType::RightBrace, "Expected '}'");
-        auto container = std::make_unique<JSXExpressionContainer>(
+        auto container = make<JSXExpressionContainer>(
             std::move(expr));
         container->location = getCurrentLocation();
         return container;
@@ -2031,37 +2032,37 @@ std::unique_ptr<Expr> Parser::parseJSXChild() {
     }
     
     if (!text.empty()) {
-        return std::make_unique<JSXText>(text);
+        return make<JSXText>(text);
     }
     
     reportError("Unexpected JSX child");
-    return std::make_unique<NullLiteral>();
+    return make<NullLiteral>();
 }
 
 // ==================== Destructuring Patterns ====================
 
-std::unique_ptr<Pattern> Parser::parseBindingPattern() {
+PatternPtr Parser::parseBindingPattern() {
     if (check(TokenType::LeftBrace)) {
         return parseObjectPattern();
     } else if (check(TokenType::LeftBracket)) {
         return parseArrayPattern();
     } else if (checkBindingIdentifier()) {
-        auto name = advance().value;
+        auto name = advance().text();
         TypePtr type = nullptr;
         if (match(TokenType::Colon)) {
             type = parseTypeAnnotation();
         }
-        return std::make_unique<IdentifierPattern>(name, std::move(type));
+        return make<IdentifierPattern>(name, std::move(type));
     }
     
     reportError("Expected binding pattern");
     return nullptr;
 }
 
-std::unique_ptr<Pattern> Parser::parseObjectPattern() {
+PatternPtr Parser::parseObjectPattern() {
     consume(TokenType::LeftBrace, "Expected '{'");
     
-    auto pattern = std::make_unique<ObjectPattern>();
+    auto pattern = make<ObjectPattern>();
     
     while (!check(TokenType::RightBrace) && !isAtEnd()) {
         // Rest pattern: ...rest
@@ -2076,7 +2077,7 @@ std::unique_ptr<Pattern> Parser::parseObjectPattern() {
             break;
         }
         
-        std::string key = advance().value;
+        std::string key = advance().text();
         ObjectPattern::Property prop;
         prop.key = key;
         prop.shorthand = true;
@@ -2087,7 +2088,7 @@ std::unique_ptr<Pattern> Parser::parseObjectPattern() {
             prop.value = parseBindingPattern();
         } else {
             // Shorthand: {x} means {x: x}
-            prop.value = std::make_unique<IdentifierPattern>(key);
+            prop.value = make<IdentifierPattern>(key);
         }
         
         // Default value: = expr
@@ -2106,10 +2107,10 @@ std::unique_ptr<Pattern> Parser::parseObjectPattern() {
     return pattern;
 }
 
-std::unique_ptr<Pattern> Parser::parseArrayPattern() {
+PatternPtr Parser::parseArrayPattern() {
     consume(TokenType::LeftBracket, "Expected '['");
     
-    auto pattern = std::make_unique<ArrayPattern>();
+    auto pattern = make<ArrayPattern>();
     
     while (!check(TokenType::RightBracket) && !isAtEnd()) {
         // Rest pattern: ...rest
@@ -2127,7 +2128,7 @@ std::unique_ptr<Pattern> Parser::parseArrayPattern() {
             // Default value: = expr
             if (match(TokenType::Equal)) {
                 auto defaultValue = parseAssignmentExpression();
-                element = std::make_unique<AssignmentPattern>(
+                element = make<AssignmentPattern>(
                     std::move(element), std::move(defaultValue));
             }
             
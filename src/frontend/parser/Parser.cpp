@@ -1,11 +1,13 @@
 #include "nova/Frontend/Parser.h"
 #include <sstream>
 #include <unordered_map>
+#include <utility>
 
 namespace nova {
 
 Parser::Parser(Lexer& lexer) 
-    : lexer_(lexer), current_(0), jsxMode_(lexer.isJSXMode()) {
+    : lexer_(lexer), current_(0), arena_(std::make_unique<ASTArena>()),
+      jsxMode_(lexer.isJSXMode()) {
     // Pre-fetch all tokens for easier lookahead
     Token token;
     do {
@@ -21,6 +23,8 @@ Parser::Parser(Lexer& lexer)
     }
 }
 
+Parser::~Parser() = default;
+
 std::unique_ptr<Program> Parser::parseProgram() {
     std::vector<StmtPtr> statements;
     
@@ -42,9 +46,9 @@ std::unique_ptr<Program> Parser::parseProgram() {
     std::unordered_map<std::string, FunctionDecl*> implementations;
     for (auto& statement : statements) {
         auto* declarationStatement =
-            dynamic_cast<DeclStmt*>(statement.get());
+            ast_cast<DeclStmt>(statement.get());
         auto* function = declarationStatement
-            ? dynamic_cast<FunctionDecl*>(
+            ? ast_cast<FunctionDecl>(
                   declarationStatement->declaration.get())
             : nullptr;
         if (!function || function->isDeclare) continue;
@@ -63,7 +67,10 @@ std::unique_ptr<Program> Parser::parseProgram() {
         }
     }
 
-    auto program = std::make_unique<Program>(std::move(statements));
+    // The program takes the arena with it; the parser starts a fresh one in
+    // case it is asked for another tree.
+    auto program = std::make_unique<Program>(
+        std::move(statements), std::exchange(arena_, std::make_unique<ASTArena>()));
     program->location = getCurrentLocation();
     
     return program;
@@ -191,7 +198,7 @@ void Parser::synchronize() {
 void Parser::reportError(const std::string& message) {
     auto loc = getCurrentLocation();
     std::stringstream ss;
-    ss << loc.filename << ":" << loc.line << ":" << loc.column
+    ss << loc.filename() << ":" << loc.line << ":" << loc.column
        << ": error SyntaxError: " << message;
     errors_.push_back(ss.str());
 }
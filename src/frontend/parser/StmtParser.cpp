@@ -2,15 +2,15 @@
 
 namespace nova {
 
-std::unique_ptr<Stmt> Parser::parseStatement() {
+StmtPtr Parser::parseStatement() {
     // Decorators (for classes and methods)
-    std::vector<std::unique_ptr<Decorator>> decorators;
+    std::vector<ASTRef<Decorator>> decorators;
     if (check(TokenType::At)) {
         decorators = parseDecorators();
     }
 
     if (match(TokenType::Semicolon)) {
-        auto empty = std::make_unique<EmptyStmt>();
+        auto empty = make<EmptyStmt>();
         empty->location = peek(-1).location;
         return empty;
     }
@@ -54,9 +54,9 @@ std::unique_ptr<Stmt> Parser::parseStatement() {
         consume(TokenType::KeywordClass,
                 "Expected 'class' after 'abstract'");
         auto classDecl = parseClassDeclaration();
-        if (auto* statement = dynamic_cast<DeclStmt*>(classDecl.get())) {
+        if (auto* statement = ast_cast<DeclStmt>(classDecl.get())) {
             if (auto* cls =
-                    dynamic_cast<ClassDecl*>(statement->declaration.get())) {
+                    ast_cast<ClassDecl>(statement->declaration.get())) {
                 cls->decorators = std::move(decorators);
             }
         }
@@ -145,7 +145,7 @@ std::unique_ptr<Stmt> Parser::parseStatement() {
         consume(TokenType::Colon, "Expected ':' after label");
         auto stmt = parseStatement();
         
-        auto labeled = std::make_unique<LabeledStmt>(label.value, std::move(stmt));
+        auto labeled = make<LabeledStmt>(label.text(), std::move(stmt));
         labeled->location = label.location;
         return labeled;
     }
@@ -154,7 +154,7 @@ std::unique_ptr<Stmt> Parser::parseStatement() {
     return parseExpressionStatement();
 }
 
-std::unique_ptr<Stmt> Parser::parseVariableDeclaration() {
+StmtPtr Parser::parseVariableDeclaration() {
     // Kind already consumed (var/let/const)
     Token kindToken = peek(-1);
     VarDeclStmt::Kind kind;
@@ -201,14 +201,14 @@ std::unique_ptr<Stmt> Parser::parseVariableDeclaration() {
 
     consume(TokenType::Semicolon, "Expected ';' after variable declaration");
 
-    auto decl = std::make_unique<VarDeclStmt>(kind, std::move(declarators));
+    auto decl = make<VarDeclStmt>(kind, std::move(declarators));
     decl->location = getCurrentLocation();
     decl->isDeclare = ambientDepth_ > 0;
 
     return decl;
 }
 
-std::unique_ptr<Stmt> Parser::parseVariableDeclarationWithoutSemicolon() {
+StmtPtr Parser::parseVariableDeclarationWithoutSemicolon() {
     // Kind already consumed (var/let/const)
     Token kindToken = peek(-1);
     VarDeclStmt::Kind kind;
@@ -255,15 +255,15 @@ std::unique_ptr<Stmt> Parser::parseVariableDeclarationWithoutSemicolon() {
     
     // Note: Don't consume semicolon - this is for for loop initialization
     
-    auto decl = std::make_unique<VarDeclStmt>(kind, std::move(declarators));
+    auto decl = make<VarDeclStmt>(kind, std::move(declarators));
     decl->location = getCurrentLocation();
     decl->isDeclare = ambientDepth_ > 0;
     
     return decl;
 }
 
-std::unique_ptr<Stmt> Parser::parseFunctionDeclaration() {
-    auto func = std::make_unique<FunctionDecl>();
+StmtPtr Parser::parseFunctionDeclaration() {
+    auto func = make<FunctionDecl>();
     func->location = getCurrentLocation();
     
     // Async?
@@ -291,7 +291,7 @@ std::unique_ptr<Stmt> Parser::parseFunctionDeclaration() {
     
     // Parameters
     std::vector<std::string> params;
-    std::vector<std::shared_ptr<Pattern>> paramPatterns;
+    std::vector<PatternPtr> paramPatterns;
     std::vector<TypePtr> paramTypes;
     std::vector<ExprPtr> defaultValues;
     std::string restParam;
@@ -314,11 +314,11 @@ std::unique_ptr<Stmt> Parser::parseFunctionDeclaration() {
         if (check(TokenType::LeftBrace) || check(TokenType::LeftBracket)) {
             auto pattern = parseBindingPattern();
             params.push_back("__pattern_param_" + std::to_string(params.size()));
-            paramPatterns.push_back(std::shared_ptr<Pattern>(std::move(pattern)));
+            paramPatterns.push_back(PatternPtr(std::move(pattern)));
         } else {
             Token paramName = consumeBindingIdentifier(
                 "Expected parameter name");
-            params.push_back(paramName.value);
+            params.push_back(paramName.text());
             paramPatterns.push_back(nullptr);
         }
 
@@ -364,13 +364,13 @@ std::unique_ptr<Stmt> Parser::parseFunctionDeclaration() {
     }
     
     // Wrap in DeclStmt
-    auto declStmt = std::make_unique<DeclStmt>(std::move(func));
+    auto declStmt = make<DeclStmt>(std::move(func));
     declStmt->location = getCurrentLocation();
     
     return declStmt;
 }
 
-std::unique_ptr<Stmt> Parser::parseBlockStatement() {
+StmtPtr Parser::parseBlockStatement() {
     consume(TokenType::LeftBrace, "Expected '{'");
     
     std::vector<StmtPtr> statements;
@@ -383,13 +383,13 @@ std::unique_ptr<Stmt> Parser::parseBlockStatement() {
     
     consume(TokenType::RightBrace, "Expected '}'");
     
-    auto block = std::make_unique<BlockStmt>(std::move(statements));
+    auto block = make<BlockStmt>(std::move(statements));
     block->location = getCurrentLocation();
     
     return block;
 }
 
-std::unique_ptr<Stmt> Parser::parseExpressionStatement() {
+StmtPtr Parser::parseExpressionStatement() {
     auto expr = parseExpression();
     
     // Semicolon insertion
@@ -397,13 +397,13 @@ std::unique_ptr<Stmt> Parser::parseExpressionStatement() {
         match(TokenType::Semicolon);
     }
     
-    auto stmt = std::make_unique<ExpressionStatement>(std::move(expr));
+    auto stmt = make<ExpressionStatement>(std::move(expr));
     stmt->location = getCurrentLocation();
     
     return stmt;
 }
 
-std::unique_ptr<Stmt> Parser::parseIfStatement() {
+StmtPtr Parser::parseIfStatement() {
     consume(TokenType::LeftParen, "Expected '(' after 'if'");
     auto test = parseExpression();
     consume(TokenType::RightParen, "Expected ')' after if condition");
@@ -415,14 +415,14 @@ std::unique_ptr<Stmt> Parser::parseIfStatement() {
         alternate = parseStatement();
     }
     
-    auto ifStmt = std::make_unique<IfStatement>(std::move(test), std::move(consequent), std::move(alternate));
+    auto ifStmt = make<IfStatement>(std::move(test), std::move(consequent), std::move(alternate));
     ifStmt->location = getCurrentLocation();
     
     return ifStmt;
 }
 
-std::unique_ptr<Stmt> Parser::parseReturnStatement() {
-    auto ret = std::make_unique<ReturnStatement>();
+StmtPtr Parser::parseReturnStatement() {
+    auto ret = make<ReturnStatement>();
     ret->location = getCurrentLocation();
     
     if (!check(TokenType::Semicolon) && !isAtEnd()) {
@@ -434,21 +434,21 @@ std::unique_ptr<Stmt> Parser::parseReturnStatement() {
     return ret;
 }
 
-std::unique_ptr<Stmt> Parser::parseWhileStatement() {
+StmtPtr Parser::parseWhileStatement() {
     consume(TokenType::LeftParen, "Expected '(' after 'while'");
     auto test = parseExpression();
     consume(TokenType::RightParen, "Expected ')' after condition");
     
     auto body = parseStatement();
     
-    auto whileStmt = std::make_unique<WhileStatement>(std::move(test), std::move(body));
+    auto whileStmt = make<WhileStatement>(std::move(test), std::move(body));
     whileStmt->location = getCurrentLocation();
     
     return whileStmt;
 }
 
-std::unique_ptr<Stmt> Parser::parseBreakStatement() {
-    auto brk = std::make_unique<BreakStatement>();
+StmtPtr Parser::parseBreakStatement() {
+    auto brk = make<BreakStatement>();
     brk->location = getCurrentLocation();
 
     // Check for optional label (identifier on the same line, before semicolon)
@@ -461,8 +461,8 @@ std::unique_ptr<Stmt> Parser::parseBreakStatement() {
     return brk;
 }
 
-std::unique_ptr<Stmt> Parser::parseContinueStatement() {
-    auto cont = std::make_unique<ContinueStatement>();
+StmtPtr Parser::parseContinueStatement() {
+    auto cont = make<ContinueStatement>();
     cont->location = getCurrentLocation();
 
     // Check for optional label (identifier on the same line, before semicolon)
@@ -476,8 +476,8 @@ std::unique_ptr<Stmt> Parser::parseContinueStatement() {
 }
 
 // Placeholder implementations for remaining statements
-std::unique_ptr<Stmt> Parser::parseClassDeclaration() {
-    auto classDecl = std::make_unique<ClassDecl>();
+StmtPtr Parser::parseClassDeclaration() {
+    auto classDecl = make<ClassDecl>();
     classDecl->location = getCurrentLocation();
     classDecl->isAbstract =
         peek(-2).type == TokenType::KeywordAbstract;
@@ -512,7 +512,7 @@ std::unique_ptr<Stmt> Parser::parseClassDeclaration() {
         do {
             Token iface = consumeBindingIdentifier(
                 "Expected interface name");
-            classDecl->interfaces.push_back(iface.value);
+            classDecl->interfaces.push_back(iface.text());
             if (check(TokenType::Less)) {
                 parseTypeArgumentList();
             }
@@ -597,7 +597,7 @@ std::unique_ptr<Stmt> Parser::parseClassDeclaration() {
         }
 
         // Add # prefix if it's a private field
-        std::string finalName = isPrivateField ? "#" + memberName.value : memberName.value;
+        std::string finalName = isPrivateField ? "#" + memberName.text() : memberName.text();
 
         // Check if it's a method (has parentheses) or property
         if (check(TokenType::LeftParen)) {
@@ -633,7 +633,7 @@ std::unique_ptr<Stmt> Parser::parseClassDeclaration() {
                 match(TokenType::KeywordReadonly);
                 Token param = consumeBindingIdentifier(
                     "Expected parameter name");
-                method.params.push_back(param.value);
+                method.params.push_back(param.text());
 
                 match(TokenType::Question);
                 if (match(TokenType::Colon)) {
@@ -704,14 +704,14 @@ std::unique_ptr<Stmt> Parser::parseClassDeclaration() {
     consume(TokenType::RightBrace, "Expected '}' after class body");
     
     // Wrap in DeclStmt
-    auto declStmt = std::make_unique<DeclStmt>(std::move(classDecl));
+    auto declStmt = make<DeclStmt>(std::move(classDecl));
     declStmt->location = getCurrentLocation();
     
     return declStmt;
 }
 
-std::unique_ptr<Stmt> Parser::parseInterfaceDeclaration() {
-    auto iface = std::make_unique<InterfaceDecl>();
+StmtPtr Parser::parseInterfaceDeclaration() {
+    auto iface = make<InterfaceDecl>();
     iface->location = getCurrentLocation();
     
     // Interface name
@@ -731,7 +731,7 @@ std::unique_ptr<Stmt> Parser::parseInterfaceDeclaration() {
         do {
             Token parent = consumeBindingIdentifier(
                 "Expected interface name");
-            iface->extends.push_back(parent.value);
+            iface->extends.push_back(parent.text());
             if (check(TokenType::Less)) {
                 parseTypeArgumentList();
             }
@@ -755,7 +755,7 @@ std::unique_ptr<Stmt> Parser::parseInterfaceDeclaration() {
             while (!check(TokenType::RightParen) && !isAtEnd()) {
                 Token param = consumeBindingIdentifier(
                     "Expected parameter name");
-                method.params.push_back(param.value);
+                method.params.push_back(param.text());
 
                 match(TokenType::Question);
                 if (match(TokenType::Colon)) {
@@ -799,14 +799,14 @@ std::unique_ptr<Stmt> Parser::parseInterfaceDeclaration() {
     consume(TokenType::RightBrace, "Expected '}' after interface body");
     
     // Wrap in DeclStmt
-    auto declStmt = std::make_unique<DeclStmt>(std::move(iface));
+    auto declStmt = make<DeclStmt>(std::move(iface));
     declStmt->location = getCurrentLocation();
     
     return declStmt;
 }
 
-std::unique_ptr<Stmt> Parser::parseTypeAliasDeclaration() {
-    auto typeAlias = std::make_unique<TypeAliasDecl>();
+StmtPtr Parser::parseTypeAliasDeclaration() {
+    auto typeAlias = make<TypeAliasDecl>();
     typeAlias->location = getCurrentLocation();
     
     // Type name
@@ -829,15 +829,15 @@ std::unique_ptr<Stmt> Parser::parseTypeAliasDeclaration() {
     match(TokenType::Semicolon);
     
     // Wrap in DeclStmt
-    auto declStmt = std::make_unique<DeclStmt>(std::move(typeAlias));
+    auto declStmt = make<DeclStmt>(std::move(typeAlias));
     declStmt->location = getCurrentLocation();
     
     return declStmt;
 }
 
-std::unique_ptr<Stmt> Parser::parseNamespaceDeclaration() {
+StmtPtr Parser::parseNamespaceDeclaration() {
     auto name = consumeBindingIdentifier("Expected namespace name");
-    auto namespaceDecl = std::make_unique<NamespaceDecl>();
+    auto namespaceDecl = make<NamespaceDecl>();
     namespaceDecl->location = name.location;
     namespaceDecl->name = name.value;
     namespaceDecl->isDeclare = ambientDepth_ > 0;
@@ -845,7 +845,7 @@ std::unique_ptr<Stmt> Parser::parseNamespaceDeclaration() {
     while (match(TokenType::Dot)) {
         namespaceDecl->name += "." +
             consumeIdentifierName(
-                "Expected namespace name after '.'").value;
+                "Expected namespace name after '.'").text();
     }
 
     consume(TokenType::LeftBrace, "Expected '{' before namespace body");
@@ -865,14 +865,14 @@ std::unique_ptr<Stmt> Parser::parseNamespaceDeclaration() {
     }
     match(TokenType::Semicolon);
 
-    auto statement = std::make_unique<DeclStmt>(
+    auto statement = make<DeclStmt>(
         std::move(namespaceDecl));
     statement->location = getCurrentLocation();
     return statement;
 }
 
-std::unique_ptr<Stmt> Parser::parseEnumDeclaration() {
-    auto enumDecl = std::make_unique<EnumDecl>();
+StmtPtr Parser::parseEnumDeclaration() {
+    auto enumDecl = make<EnumDecl>();
     enumDecl->location = getCurrentLocation();
     
     // Enum name
@@ -904,21 +904,21 @@ std::unique_ptr<Stmt> Parser::parseEnumDeclaration() {
     consume(TokenType::RightBrace, "Expected '}' after enum body");
     
     // Wrap in DeclStmt
-    auto declStmt = std::make_unique<DeclStmt>(std::move(enumDecl));
+    auto declStmt = make<DeclStmt>(std::move(enumDecl));
     declStmt->location = getCurrentLocation();
     
     return declStmt;
 }
 
-std::unique_ptr<Stmt> Parser::parseImportDeclaration() {
-    auto import = std::make_unique<ImportDecl>();
+StmtPtr Parser::parseImportDeclaration() {
+    auto import = make<ImportDecl>();
     import->location = getCurrentLocation();
 
     auto parseNamedImports = [&]() {
         while (!check(TokenType::RightBrace) && !isAtEnd()) {
             Token imported = consumeIdentifierName(
                 "Expected import name");
-            std::string local = imported.value;
+            std::string local = imported.text();
             if (match(TokenType::KeywordAs)) {
                 Token localName = consumeBindingIdentifier(
                     "Expected local name");
@@ -945,7 +945,7 @@ std::unique_ptr<Stmt> Parser::parseImportDeclaration() {
         import->source = source.value;
         match(TokenType::Semicolon);
         
-        auto declStmt = std::make_unique<DeclStmt>(std::move(import));
+        auto declStmt = make<DeclStmt>(std::move(import));
         declStmt->location = getCurrentLocation();
         return declStmt;
     }
@@ -978,14 +978,14 @@ std::unique_ptr<Stmt> Parser::parseImportDeclaration() {
     match(TokenType::Semicolon);
     
     // Wrap in DeclStmt
-    auto declStmt = std::make_unique<DeclStmt>(std::move(import));
+    auto declStmt = make<DeclStmt>(std::move(import));
     declStmt->location = getCurrentLocation();
     
     return declStmt;
 }
 
-std::unique_ptr<Stmt> Parser::parseExportDeclaration() {
-    auto exportDecl = std::make_unique<ExportDecl>();
+StmtPtr Parser::parseExportDeclaration() {
+    auto exportDecl = make<ExportDecl>();
     exportDecl->location = getCurrentLocation();
     
     // export default
@@ -994,7 +994,7 @@ std::unique_ptr<Stmt> Parser::parseExportDeclaration() {
         exportDecl->declaration = parseExpression();
         match(TokenType::Semicolon);
         
-        auto declStmt = std::make_unique<DeclStmt>(std::move(exportDecl));
+        auto declStmt = make<DeclStmt>(std::move(exportDecl));
         declStmt->location = getCurrentLocation();
         return declStmt;
     }
@@ -1003,7 +1003,7 @@ std::unique_ptr<Stmt> Parser::parseExportDeclaration() {
     if (match(TokenType::LeftBrace)) {
         while (!check(TokenType::RightBrace) && !isAtEnd()) {
             Token local = consume(TokenType::Identifier, "Expected export name");
-            std::string exported = local.value;
+            std::string exported = local.text();
             
             if (match(TokenType::KeywordAs)) {
                 Token exportedName = consume(TokenType::Identifier, "Expected exported name");
@@ -1028,7 +1028,7 @@ std::unique_ptr<Stmt> Parser::parseExportDeclaration() {
         
         match(TokenType::Semicolon);
         
-        auto declStmt = std::make_unique<DeclStmt>(std::move(exportDecl));
+        auto declStmt = make<DeclStmt>(std::move(exportDecl));
         declStmt->location = getCurrentLocation();
         return declStmt;
     }
@@ -1044,7 +1044,7 @@ std::unique_ptr<Stmt> Parser::parseExportDeclaration() {
         exportDecl->source = source.value;
         match(TokenType::Semicolon);
         
-        auto declStmt = std::make_unique<DeclStmt>(std::move(exportDecl));
+        auto declStmt = make<DeclStmt>(std::move(exportDecl));
         declStmt->location = getCurrentLocation();
         return declStmt;
     }
@@ -1052,18 +1052,18 @@ std::unique_ptr<Stmt> Parser::parseExportDeclaration() {
     // export declaration
     auto stmt = parseStatement();
     // Extract the declaration from the statement
-    if (auto* declStmt = dynamic_cast<DeclStmt*>(stmt.get())) {
+    if (auto* declStmt = ast_cast<DeclStmt>(stmt.get())) {
         exportDecl->exportedDecl = std::move(declStmt->declaration);
     } else {
         exportDecl->exportedStmt = std::move(stmt);
     }
     
-    auto resultDeclStmt = std::make_unique<DeclStmt>(std::move(exportDecl));
+    auto resultDeclStmt = make<DeclStmt>(std::move(exportDecl));
     resultDeclStmt->location = getCurrentLocation();
     return resultDeclStmt;
 }
 
-std::unique_ptr<Stmt> Parser::parseDoWhileStatement() {
+StmtPtr Parser::parseDoWhileStatement() {
     auto body = parseStatement();
     
     consume(TokenType::KeywordWhile, "Expected 'while' after do-while body");
@@ -1072,13 +1072,13 @@ std::unique_ptr<Stmt> Parser::parseDoWhileStatement() {
     consume(TokenType::RightParen, "Expected ')' after condition");
     match(TokenType::Semicolon);
     
-    auto doWhile = std::make_unique<DoWhileStatement>(std::move(body), std::move(test));
+    auto doWhile = make<DoWhileStatement>(std::move(body), std::move(test));
     doWhile->location = getCurrentLocation();
     
     return doWhile;
 }
 
-std::unique_ptr<Stmt> Parser::parseForStatement() {
+StmtPtr Parser::parseForStatement() {
     consume(TokenType::LeftParen, "Expected '(' after 'for'");
     
     // Check for for-in or for-of by looking ahead
@@ -1161,22 +1161,22 @@ std::unique_ptr<Stmt> Parser::parseForStatement() {
 
             if (match(TokenType::KeywordIn)) {
                 auto loop = parseForInStatementBody(
-                    id.value, isConst ? "const" : (isLet ? "let" : "var"));
+                    id.text(), isConst ? "const" : (isLet ? "let" : "var"));
                 if (initializer) {
                     std::vector<StmtPtr> stmts;
-                    stmts.push_back(std::make_unique<ExprStmt>(std::move(initializer)));
+                    stmts.push_back(make<ExprStmt>(std::move(initializer)));
                     stmts.push_back(std::move(loop));
-                    return std::make_unique<BlockStmt>(std::move(stmts));
+                    return make<BlockStmt>(std::move(stmts));
                 }
                 return loop;
             } else if (match(TokenType::KeywordOf)) {
                 auto loop = parseForOfStatementBody(
-                    id.value, isConst ? "const" : (isLet ? "let" : "var"));
+                    id.text(), isConst ? "const" : (isLet ? "let" : "var"));
                 if (initializer) {
                     std::vector<StmtPtr> stmts;
-                    stmts.push_back(std::make_unique<ExprStmt>(std::move(initializer)));
+                    stmts.push_back(make<ExprStmt>(std::move(initializer)));
                     stmts.push_back(std::move(loop));
-                    return std::make_unique<BlockStmt>(std::move(stmts));
+                    return make<BlockStmt>(std::move(stmts));
                 }
                 return loop;
             }
@@ -1184,9 +1184,9 @@ std::unique_ptr<Stmt> Parser::parseForStatement() {
             Token id = consume(TokenType::Identifier, "Expected variable name");
 
             if (match(TokenType::KeywordIn)) {
-                return parseForInStatementBody(id.value, "");
+                return parseForInStatementBody(id.text(), "");
             } else if (match(TokenType::KeywordOf)) {
-                return parseForOfStatementBody(id.value, "");
+                return parseForOfStatementBody(id.text(), "");
             }
         }
     }
@@ -1201,11 +1201,11 @@ std::unique_ptr<Stmt> Parser::parseForStatement() {
     if (!check(TokenType::Semicolon)) {
         if (check(TokenType::KeywordVar) || check(TokenType::KeywordLet) || check(TokenType::KeywordConst)) {
             // Consume the keyword before calling parseVariableDeclarationWithoutSemicolon
-            Token kindToken = advance();
+            advance();
             init = parseVariableDeclarationWithoutSemicolon();
         } else {
             auto expr = parseExpression();
-            init = std::make_unique<ExpressionStatement>(std::move(expr));
+            init = make<ExpressionStatement>(std::move(expr));
         }
     }
     consume(TokenType::Semicolon, "Expected ';' after for loop initializer");
@@ -1225,49 +1225,49 @@ std::unique_ptr<Stmt> Parser::parseForStatement() {
     
     auto body = parseStatement();
     
-    auto forStmt = std::make_unique<ForStatement>(std::move(init), std::move(test), std::move(update), std::move(body));
+    auto forStmt = make<ForStatement>(std::move(init), std::move(test), std::move(update), std::move(body));
     forStmt->location = getCurrentLocation();
     
     return forStmt;
 }
 
-std::unique_ptr<Stmt> Parser::parseForInStatement() {
+StmtPtr Parser::parseForInStatement() {
     // This is called from parseForStatement
     reportError("Internal error: parseForInStatement called directly");
     return nullptr;
 }
 
-std::unique_ptr<Stmt> Parser::parseForOfStatement() {
+StmtPtr Parser::parseForOfStatement() {
     // This is called from parseForStatement
     reportError("Internal error: parseForOfStatement called directly");
     return nullptr;
 }
 
-std::unique_ptr<Stmt> Parser::parseForInStatementBody(const std::string& variable, const std::string& kind) {
+StmtPtr Parser::parseForInStatementBody(const std::string& variable, const std::string& kind) {
     auto right = parseExpression();
     
     consume(TokenType::RightParen, "Expected ')' after for-in");
     auto body = parseStatement();
     
-    auto forIn = std::make_unique<ForInStatement>(variable, kind, std::move(right), std::move(body));
+    auto forIn = make<ForInStatement>(variable, kind, std::move(right), std::move(body));
     forIn->location = getCurrentLocation();
     
     return forIn;
 }
 
-std::unique_ptr<Stmt> Parser::parseForOfStatementBody(const std::string& variable, const std::string& kind) {
+StmtPtr Parser::parseForOfStatementBody(const std::string& variable, const std::string& kind) {
     auto right = parseExpression();
 
     consume(TokenType::RightParen, "Expected ')' after for-of");
     auto body = parseStatement();
 
-    auto forOf = std::make_unique<ForOfStatement>(variable, kind, std::move(right), std::move(body), false);
+    auto forOf = make<ForOfStatement>(variable, kind, std::move(right), std::move(body), false);
     forOf->location = getCurrentLocation();
 
     return forOf;
 }
 
-std::unique_ptr<Stmt> Parser::parseForAwaitOfStatement() {
+StmtPtr Parser::parseForAwaitOfStatement() {
     // for await (const x of asyncIterable) { ... }
     // 'for' and 'await' already consumed
 
@@ -1281,7 +1281,7 @@ std::unique_ptr<Stmt> Parser::parseForAwaitOfStatement() {
     }
 
     Token id = consume(TokenType::Identifier, "Expected variable name");
-    std::string variable = id.value;
+    std::string variable = id.text();
 
     consume(TokenType::KeywordOf, "Expected 'of' in for await...of");
 
@@ -1290,13 +1290,13 @@ std::unique_ptr<Stmt> Parser::parseForAwaitOfStatement() {
     auto body = parseStatement();
 
     // Create ForOfStatement with isAwait = true
-    auto forAwaitOf = std::make_unique<ForOfStatement>(variable, kind, std::move(right), std::move(body), true);
+    auto forAwaitOf = make<ForOfStatement>(variable, kind, std::move(right), std::move(body), true);
     forAwaitOf->location = getCurrentLocation();
 
     return forAwaitOf;
 }
 
-std::unique_ptr<Stmt> Parser::parseSwitchStatement() {
+StmtPtr Parser::parseSwitchStatement() {
     consume(TokenType::LeftParen, "Expected '(' after 'switch'");
     auto discriminant = parseExpression();
     consume(TokenType::RightParen, "Expected ')' after switch expression");
@@ -1352,13 +1352,13 @@ std::unique_ptr<Stmt> Parser::parseSwitchStatement() {
     
     consume(TokenType::RightBrace, "Expected '}' after switch body");
     
-    auto switchStmt = std::make_unique<SwitchStatement>(std::move(discriminant), std::move(cases));
+    auto switchStmt = make<SwitchStatement>(std::move(discriminant), std::move(cases));
     switchStmt->location = getCurrentLocation();
     
     return switchStmt;
 }
 
-std::unique_ptr<Stmt> Parser::parseTryStatement() {
+StmtPtr Parser::parseTryStatement() {
     // Try block
     auto block = parseBlockStatement();
     
@@ -1390,31 +1390,31 @@ std::unique_ptr<Stmt> Parser::parseTryStatement() {
         reportError("Missing catch or finally after try");
     }
     
-    auto tryStmt = std::make_unique<TryStatement>(std::move(block), std::move(handler), std::move(finalizer));
+    auto tryStmt = make<TryStatement>(std::move(block), std::move(handler), std::move(finalizer));
     tryStmt->location = getCurrentLocation();
     
     return tryStmt;
 }
 
-std::unique_ptr<Stmt> Parser::parseThrowStatement() {
+StmtPtr Parser::parseThrowStatement() {
     auto argument = parseExpression();
     match(TokenType::Semicolon);
     
-    auto throwStmt = std::make_unique<ThrowStatement>(std::move(argument));
+    auto throwStmt = make<ThrowStatement>(std::move(argument));
     throwStmt->location = getCurrentLocation();
     
     return throwStmt;
 }
 
-std::unique_ptr<Stmt> Parser::parseDebuggerStatement() {
-    auto debugger = std::make_unique<DebuggerStmt>();
+StmtPtr Parser::parseDebuggerStatement() {
+    auto debugger = make<DebuggerStmt>();
     debugger->location = getCurrentLocation();
     match(TokenType::Semicolon);
     return debugger;
 }
 
-std::unique_ptr<Stmt> Parser::parseWithStatement() {
-    auto withStmt = std::make_unique<WithStmt>(nullptr, nullptr);
+StmtPtr Parser::parseWithStatement() {
+    auto withStmt = make<WithStmt>(nullptr, nullptr);
     withStmt->location = getCurrentLocation();
     
     consume(TokenType::LeftParen, "Expected '(' after 'with'");
@@ -1426,7 +1426,7 @@ std::unique_ptr<Stmt> Parser::parseWithStatement() {
     return withStmt;
 }
 
-std::unique_ptr<Decorator> Parser::parseDecorator() {
+ASTRef<Decorator> Parser::parseDecorator() {
     // Expect @ to be already consumed
     Token name = consume(TokenType::Identifier, "Expected decorator name");
     
@@ -1443,13 +1443,13 @@ std::unique_ptr<Decorator> Parser::parseDecorator() {
         consume(TokenType::RightParen, "Expected ')' after decorator arguments");
     }
     
-    auto decorator = std::make_unique<Decorator>(name.value, std::move(args));
+    auto decorator = make<Decorator>(name.text(), std::move(args));
     decorator->location = name.location;
     return decorator;
 }
 
-std::vector<std::unique_ptr<Decorator>> Parser::parseDecorators() {
-    std::vector<std::unique_ptr<Decorator>> decorators;
+std::vector<ASTRef<Decorator>> Parser::parseDecorators() {
+    std::vector<ASTRef<Decorator>> decorators;
 
     while (match(TokenType::At)) {
         decorators.push_back(parseDecorator());
@@ -1458,12 +1458,12 @@ std::vector<std::unique_ptr<Decorator>> Parser::parseDecorators() {
     return decorators;
 }
 
-std::unique_ptr<Stmt> Parser::parseUsingStatement(bool isAwait) {
+StmtPtr Parser::parseUsingStatement(bool isAwait) {
     // using name = expression;
     // await using name = expression;
 
     Token nameToken = consume(TokenType::Identifier, "Expected variable name after 'using'");
-    std::string name = nameToken.value;
+    std::string name = nameToken.text();
 
     // Optional type annotation
     TypePtr type = nullptr;
@@ -1477,7 +1477,7 @@ std::unique_ptr<Stmt> Parser::parseUsingStatement(bool isAwait) {
 
     match(TokenType::Semicolon);
 
-    auto usingStmt = std::make_unique<UsingStmt>(isAwait, name, std::move(init), std::move(type));
+    auto usingStmt = make<UsingStmt>(isAwait, name, std::move(init), std::move(type));
     usingStmt->location = nameToken.location;
 
     return usingStmt;
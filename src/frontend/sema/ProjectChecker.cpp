@@ -0,0 +1,562 @@
+#include "nova/Frontend/ProjectChecker.h"
+#include "nova/Frontend/Lexer.h"
+#include "nova/Frontend/Parser.h"
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <unordered_map>
+
+namespace nova {
+
+namespace fs = std::filesystem;
+
+namespace {
+
+// FNV-1a; only compared against itself, so any stable hash will do.
+std::string hashText(const std::string& text) {
+    uint64_t hash = 14695981039346656037ull;
+    for (unsigned char c : text) {
+        hash ^= c;
+        hash *= 1099511628211ull;
+    }
+    std::ostringstream out;
+    out << std::hex << std::setw(16) << std::setfill('0') << hash;
+    return out.str();
+}
+
+std::string canonicalPath(const std::string& path) {
+    std::error_code error;
+    fs::path canonical = fs::weakly_canonical(path, error);
+    return error ? path : canonical.string();
+}
+
+bool endsWith(const std::string& text, const std::string& suffix) {
+    return text.size() >= suffix.size() &&
+        text.compare(text.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+bool isSourceFile(const fs::path& path) {
+    const std::string name = path.filename().string();
+    return endsWith(name, ".ts") || endsWith(name, ".tsx");
+}
+
+// Files named on the command line are taken as they are; directories are
+// searched the way a project glob would be.
+std::vector<std::string> sourceFiles(const std::vector<std::string>& inputs) {
+    std::vector<std::string> files;
+    for (const std::string& input : inputs) {
+        std::error_code error;
+        if (!fs::is_directory(input, error)) {
+            files.push_back(input);
+            continue;
+        }
+        std::vector<std::string> found;
+        fs::recursive_directory_iterator it(
+            input, fs::directory_options::skip_permission_denied, error);
+        for (; !error && it != fs::recursive_directory_iterator(); it.increment(error)) {
+            const std::string name = it->path().filename().string();
+            if (it->is_directory(error)) {
+                if (name == "node_modules" || (!name.empty() && name[0] == '.')) {
+                    it.disable_recursion_pending();
+                }
+            } else if (isSourceFile(it->path())) {
+                found.push_back(it->path().lexically_normal().string());
+            }
+        }
+        std::sort(found.begin(), found.end());
+        files.insert(files.end(), found.begin(), found.end());
+    }
+    return files;
+}
+
+// Relative specifiers only: bare and URL imports name modules outside the
+// project, whose bindings the checker leaves as `any`.
+std::string resolveModule(const std::string& from, const std::string& specifier) {
+    if (specifier.empty() || (specifier[0] != '.' && specifier[0] != '/')) {
+        return std::string();
+    }
+    const fs::path base = (specifier[0] == '/'
+        ? fs::path(specifier)
+        : fs::path(from).parent_path() / specifier).lexically_normal();
+    const std::string text = base.string();
+    std::vector<fs::path> candidates = {base};
+    if (endsWith(text, ".js")) {
+        // `./util.js` names the `./util.ts` it is compiled from.
+        const std::string stem = text.substr(0, text.size() - 3);
+        candidates.push_back(stem + ".ts");
+        candidates.push_back(stem + ".tsx");
+    }
+    for (const char* extension : {".ts", ".tsx", ".d.ts"}) {
+        candidates.push_back(text + extension);
+    }
+    for (const char* index : {"index.ts", "index.tsx", "index.d.ts"}) {
+        candidates.push_back(base / index);
+    }
+    for (const fs::path& candidate : candidates) {
+        std::error_code error;
+        if (isSourceFile(candidate) && fs::is_regular_file(candidate, error)) {
+            return candidate.string();
+        }
+    }
+    return std::string();
+}
+
+template <typename Body>
+void parallelFor(size_t count, unsigned jobs, Body body) {
+    std::atomic<size_t> next{0};
+    const auto run = [&]() {
+        for (size_t index; (index = next.fetch_add(1)) < count;) body(index);
+    };
+    std::vector<std::thread> threads;
+    for (size_t thread = 1; thread < std::min<size_t>(jobs, count); ++thread) {
+        threads.emplace_back(run);
+    }
+    run();
+    for (auto& thread : threads) thread.join();
+}
+
+// ==================== Cache ====================
+
+struct CacheEntry {
+    std::string hash;                     // Content hash
+    std::string dependencies;             // Hash of the imports' signatures
+    std::string signature;                // Hash of this module's exports
+    std::vector<std::string> imports;     // Relative specifiers, as written
+    std::vector<std::string> diagnostics;
+};
+
+using Cache = std::unordered_map<std::string, CacheEntry>;
+
+constexpr const char* kCacheVersion = "nova-check-1";
+
+std::string jsonEscape(const std::string& text) {
+    std::string out;
+    for (unsigned char c : text) {
+        switch (c) {
+            case '"': out += "\\\""; break;
+            case '\\': out += "\\\\"; break;
+            case '\n': out += "\\n"; break;
+            case '\r': out += "\\r"; break;
+            case '\t': out += "\\t"; break;
+            default:
+                if (c < 0x20) {
+                    char escaped[8];
+                    std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+                    out += escaped;
+                } else {
+                    out += static_cast<char>(c);
+                }
+        }
+    }
+    return out;
+}
+
+// Reads back exactly what saveCache writes; anything else (an older
+// version, a damaged file) yields an empty cache and a full check.
+class CacheReader {
+public:
+    explicit CacheReader(const std::string& text) : text_(text) {}
+
+    bool read(Cache& cache) {
+        std::string key;
+        std::string version;
+        if (!expect('{') || !string(key) || key != "version" || !expect(':') ||
+            !string(version) || version != kCacheVersion || !expect(',') ||
+            !string(key) || key != "files" || !expect(':') || !expect('{')) {
+            return false;
+        }
+        while (!expect('}')) {
+            std::string path;
+            CacheEntry entry;
+            if (!string(path) || !expect(':') || !expect('{')) return false;
+            while (!expect('}')) {
+                if (!string(key) || !expect(':')) return false;
+                bool ok = key == "hash" ? string(entry.hash)
+                    : key == "dependencies" ? string(entry.dependencies)
+                    : key == "signature" ? string(entry.signature)
+                    : key == "imports" ? strings(entry.imports)
+                    : key == "diagnostics" ? strings(entry.diagnostics)
+                    : false;
+                if (!ok) return false;
+                expect(',');
+            }
+            cache[path] = std::move(entry);
+            expect(',');
+        }
+        return true;
+    }
+
+private:
+    const std::string& text_;
+    size_t pos_ = 0;
+
+    bool expect(char c) {
+        while (pos_ < text_.size() &&
+               std::isspace(static_cast<unsigned char>(text_[pos_]))) {
+            ++pos_;
+        }
+        if (pos_ < text_.size() && text_[pos_] == c) {
+            ++pos_;
+            return true;
+        }
+        return false;
+    }
+
+    bool string(std::string& out) {
+        if (!expect('"')) return false;
+        out.clear();
+        for (; pos_ < text_.size() && text_[pos_] != '"'; ++pos_) {
+            if (text_[pos_] != '\\' || pos_ + 1 >= text_.size()) {
+                out += text_[pos_];
+                continue;
+            }
+            const char escaped = text_[++pos_];
+            switch (escaped) {
+                case 'n': out += '\n'; break;
+                case 'r': out += '\r'; break;
+                case 't': out += '\t'; break;
+                case 'u':
+                    if (pos_ + 4 >= text_.size()) return false;
+                    out += static_cast<char>(
+                        std::stoi(text_.substr(pos_ + 1, 4), nullptr, 16));
+                    pos_ += 4;
+                    break;
+                default: out += escaped;
+            }
+        }
+        return expect('"');
+    }
+
+    bool strings(std::vector<std::string>& out) {
+        if (!expect('[')) return false;
+        while (!expect(']')) {
+            std::string item;
+            if (!string(item)) return false;
+            out.push_back(std::move(item));
+            expect(',');
+        }
+        return true;
+    }
+};
+
+Cache loadCache(const std::string& path) {
+    Cache cache;
+    if (path.empty()) return cache;
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) return cache;
+    const std::string text((std::istreambuf_iterator<char>(file)),
+                           std::istreambuf_iterator<char>());
+    try {
+        if (!CacheReader(text).read(cache)) cache.clear();
+    } catch (const std::exception&) {
+        cache.clear();
+    }
+    return cache;
+}
+
+void saveCache(const std::string& path, const Cache& cache) {
+    std::vector<const Cache::value_type*> entries;
+    for (const auto& entry : cache) entries.push_back(&entry);
+    std::sort(entries.begin(), entries.end(),
+              [](const auto* left, const auto* right) {
+                  return left->first < right->first;
+              });
+    const auto list = [](std::ostream& out, const std::vector<std::string>& items) {
+        out << '[';
+        for (size_t index = 0; index < items.size(); ++index) {
+            out << (index ? ", " : "") << '"' << jsonEscape(items[index]) << '"';
+        }
+        out << ']';
+    };
+
+    std::error_code error;
+    if (fs::path(path).has_parent_path()) {
+        fs::create_directories(fs::path(path).parent_path(), error);
+    }
+    // Written aside and renamed so an interrupted run never leaves a
+    // truncated cache behind.
+    const std::string temporary = path + ".tmp";
+    {
+        std::ofstream file(temporary, std::ios::binary);
+        if (!file.is_open()) return;
+        file << "{\n  \"version\": \"" << kCacheVersion << "\",\n  \"files\": {\n";
+        for (size_t index = 0; index < entries.size(); ++index) {
+            const auto& [key, entry] = *entries[index];
+            file << (index ? ",\n" : "") << "    \"" << jsonEscape(key) << "\": {"
+                 << " \"hash\": \"" << entry.hash << "\","
+                 << " \"dependencies\": \"" << entry.dependencies << "\","
+                 << " \"signature\": \"" << entry.signature << "\","
+                 << " \"imports\": ";
+            list(file, entry.imports);
+            file << ", \"diagnostics\": ";
+            list(file, entry.diagnostics);
+            file << " }";
+        }
+        file << "\n  }\n}\n";
+        if (!file) return;
+    }
+    fs::rename(temporary, path, error);
+    if (error) fs::remove(temporary, error);
+}
+
+// ==================== Modules ====================
+
+struct Module {
+    std::string path;    // As found or imported; diagnostics report this
+    std::string key;     // Canonical path; the cache is keyed by this
+    std::string source;
+    std::string hash;    // Empty when the file could not be read
+    const CacheEntry* cached = nullptr;  // Entry for this exact content
+    std::vector<std::string> specifiers; // Relative import/export sources
+    std::unordered_map<std::string, size_t> resolved;
+    std::vector<size_t> dependencies;
+    std::vector<size_t> importers;
+    bool cyclic = false;
+
+    std::unique_ptr<Program> program;
+    std::vector<std::string> errors;     // Read and parse errors
+
+    // A module is checked at most once: either for its own result or,
+    // when the cache answered for it, because an importer needs its types.
+    std::once_flag checkedOnce;
+    std::unique_ptr<TypeChecker> checker;
+    std::vector<std::string> checkDiagnostics;
+    std::string checkSignature;
+
+    std::string dependencySignature;
+    std::vector<std::string> diagnostics;
+    std::string signature;
+    bool reused = false;
+};
+
+void parse(Module& module) {
+    try {
+        Lexer lexer(module.path, module.source);
+        Parser parser(lexer);
+        module.program = parser.parseProgram();
+        module.errors = parser.getErrors();
+    } catch (const std::exception& error) {
+        module.errors.push_back(module.path + ": error: " + error.what());
+    }
+}
+
+void load(Module& module, const Cache& cache) {
+    std::ifstream file(module.path, std::ios::binary);
+    if (!file.is_open()) {
+        module.errors.push_back("Cannot open file: " + module.path);
+        return;
+    }
+    module.source.assign(std::istreambuf_iterator<char>(file),
+                         std::istreambuf_iterator<char>());
+    module.hash = hashText(module.source);
+
+    // Same text, same imports: a module the cache knows is not parsed
+    // unless something it imports changed shape.
+    auto found = cache.find(module.key);
+    if (found != cache.end() && found->second.hash == module.hash) {
+        module.cached = &found->second;
+        module.specifiers = found->second.imports;
+        return;
+    }
+    parse(module);
+    if (!module.program) return;
+    for (const auto& statement : module.program->body) {
+        auto* declaration = ast_cast<DeclStmt>(statement.get());
+        Decl* decl = declaration ? declaration->declaration.get() : nullptr;
+        std::string source;
+        if (auto* import = ast_cast<ImportDecl>(decl)) source = import->source;
+        else if (auto* exported = ast_cast<ExportDecl>(decl)) source = exported->source;
+        if (!source.empty() && (source[0] == '.' || source[0] == '/') &&
+            std::find(module.specifiers.begin(), module.specifiers.end(),
+                      source) == module.specifiers.end()) {
+            module.specifiers.push_back(source);
+        }
+    }
+}
+
+} // namespace
+
+ProjectChecker::ProjectChecker(ProjectCheckOptions options)
+    : options_(std::move(options)) {}
+
+ProjectCheckResult ProjectChecker::check(const std::vector<std::string>& inputs) {
+    ProjectCheckResult result;
+    Cache cache = loadCache(options_.cacheFile);
+    const unsigned jobs = options_.jobs
+        ? options_.jobs : std::max(1u, std::thread::hardware_concurrency());
+
+    std::vector<std::unique_ptr<Module>> modules;
+    std::unordered_map<std::string, size_t> byKey;
+    const auto add = [&](const std::string& path) {
+        const std::string key = canonicalPath(path);
+        auto [found, inserted] = byKey.emplace(key, modules.size());
+        if (inserted) {
+            modules.push_back(std::make_unique<Module>());
+            modules.back()->path = path;
+            modules.back()->key = key;
+        }
+        return found->second;
+    };
+    for (const std::string& file : sourceFiles(inputs)) add(file);
+
+    // Load breadth-first: each round reads (and, unless cached, parses) the
+    // modules the previous round's imports named.
+    for (size_t loaded = 0; loaded < modules.size();) {
+        const size_t end = modules.size();
+        parallelFor(end - loaded, jobs, [&](size_t index) {
+            load(*modules[loaded + index], cache);
+        });
+        for (size_t index = loaded; index < end; ++index) {
+            for (const std::string& specifier : modules[index]->specifiers) {
+                const std::string path = resolveModule(modules[index]->path, specifier);
+                if (!path.empty()) modules[index]->resolved[specifier] = add(path);
+            }
+        }
+        loaded = end;
+    }
+    for (size_t index = 0; index < modules.size(); ++index) {
+        Module& module = *modules[index];
+        for (const auto& [specifier, dependency] : module.resolved) {
+            if (dependency != index) module.dependencies.push_back(dependency);
+        }
+        std::sort(module.dependencies.begin(), module.dependencies.end());
+        module.dependencies.erase(
+            std::unique(module.dependencies.begin(), module.dependencies.end()),
+            module.dependencies.end());
+        for (size_t dependency : module.dependencies) {
+            modules[dependency]->importers.push_back(index);
+        }
+    }
+
+    std::function<void(Module&)> ensureChecked = [&](Module& module) {
+        std::call_once(module.checkedOnce, [&]() {
+            if (!module.program && module.errors.empty()) parse(module);
+            // Modules in a cycle are checked one after another at the end,
+            // so only acyclic imports can be (and need to be) forced here.
+            for (size_t dependency : module.dependencies) {
+                if (!modules[dependency]->cyclic) ensureChecked(*modules[dependency]);
+            }
+            if (!module.errors.empty() || !module.program) {
+                module.checkDiagnostics = module.errors;
+                module.checkSignature = hashText(std::string());
+                return;
+            }
+            try {
+                module.checker = std::make_unique<TypeChecker>(
+                    parseCompilerDirectives(module.source));
+                module.checker->setImportResolver(
+                    [&](const std::string& specifier) -> const TypeChecker::ModuleExports* {
+                        auto found = module.resolved.find(specifier);
+                        if (found == module.resolved.end()) return nullptr;
+                        const Module& dependency = *modules[found->second];
+                        return dependency.checker ? &dependency.checker->exports() : nullptr;
+                    });
+                module.checker->check(*module.program);
+                module.checkDiagnostics = module.checker->diagnostics();
+                module.checkSignature = hashText(module.checker->exportSignature());
+            } catch (const std::exception& error) {
+                module.checker.reset();
+                module.checkDiagnostics = {module.path + ": error: " + error.what()};
+                module.checkSignature = hashText(std::string());
+            }
+        });
+    };
+    const auto process = [&](Module& module) {
+        std::string signatures;
+        for (size_t dependency : module.dependencies) {
+            signatures += modules[dependency]->key + '\0' +
+                modules[dependency]->signature + '\n';
+        }
+        module.dependencySignature = hashText(signatures);
+        if (!module.cyclic && module.cached &&
+            module.cached->dependencies == module.dependencySignature) {
+            module.diagnostics = module.cached->diagnostics;
+            module.signature = module.cached->signature;
+            module.reused = true;
+            return;
+        }
+        ensureChecked(module);
+        module.diagnostics = module.checkDiagnostics;
+        module.signature = module.checkSignature;
+    };
+
+    // A module becomes ready when the last module it imports is done.
+    std::vector<size_t> waiting(modules.size());
+    std::deque<size_t> ready;
+    for (size_t index = 0; index < modules.size(); ++index) {
+        waiting[index] = modules[index]->dependencies.size();
+        if (waiting[index] == 0) ready.push_back(index);
+    }
+    std::mutex mutex;
+    std::condition_variable wake;
+    size_t running = 0;
+    const auto worker = [&]() {
+        std::unique_lock<std::mutex> lock(mutex);
+        for (;;) {
+            wake.wait(lock, [&]() { return !ready.empty() || running == 0; });
+            if (ready.empty()) return;
+            const size_t index = ready.front();
+            ready.pop_front();
+            ++running;
+            lock.unlock();
+            process(*modules[index]);
+            lock.lock();
+            --running;
+            for (size_t importer : modules[index]->importers) {
+                if (--waiting[importer] == 0) ready.push_back(importer);
+            }
+            wake.notify_all();
+        }
+    };
+    std::vector<std::thread> threads;
+    for (size_t thread = 1; thread < std::min<size_t>(jobs, modules.size()); ++thread) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : threads) thread.join();
+
+    std::vector<size_t> order(modules.size());
+    for (size_t index = 0; index < order.size(); ++index) order[index] = index;
+    std::sort(order.begin(), order.end(), [&](size_t left, size_t right) {
+        return modules[left]->path < modules[right]->path;
+    });
+    for (size_t index : order) {
+        if (waiting[index] != 0) modules[index]->cyclic = true;
+    }
+    for (size_t index : order) {
+        if (modules[index]->cyclic) process(*modules[index]);
+    }
+
+    for (size_t index : order) {
+        Module& module = *modules[index];
+        result.files.push_back(module.path);
+        result.diagnostics.insert(result.diagnostics.end(),
+                                  module.diagnostics.begin(),
+                                  module.diagnostics.end());
+        ++(module.reused ? result.reused : result.checked);
+        if (module.hash.empty()) continue;
+        CacheEntry& entry = cache[module.key];
+        entry.hash = module.hash;
+        entry.dependencies = module.dependencySignature;
+        entry.signature = module.signature;
+        entry.imports = module.specifiers;
+        entry.diagnostics = module.diagnostics;
+    }
+    if (!options_.cacheFile.empty()) saveCache(options_.cacheFile, cache);
+    return result;
+}
+
+} // namespace nova
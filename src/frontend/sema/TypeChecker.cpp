@@ -1,5 +1,6 @@
 #include "nova/Frontend/TypeChecker.h"
 #include <algorithm>
+#include <array>
 #include <cctype>
 #include <cstring>
 #include <functional>
@@ -93,7 +94,30 @@ TypeCheckerOptions parseCompilerDirectives(const std::string& source) {
     return opts;
 }
 
+namespace {
+
+// Void through Undefined: kinds that, unnamed, carry nothing but the kind.
+bool isPrimitiveKind(Type::Kind kind) {
+    return kind <= Type::Kind::Undefined;
+}
+
+} // namespace
+
 TypePtr TypeChecker::makeType(Type::Kind kind, const std::string& name) {
+    // Unnamed primitives are interned, one shared instance per kind, so
+    // comparing them is a pointer comparison. They are shared by every
+    // checker on every thread and must never be modified.
+    if (name.empty() && isPrimitiveKind(kind)) {
+        static const auto primitives = [] {
+            std::array<TypePtr, static_cast<size_t>(Type::Kind::Undefined) + 1> types;
+            for (size_t index = 0; index < types.size(); ++index) {
+                types[index] =
+                    std::make_shared<Type>(static_cast<Type::Kind>(index));
+            }
+            return types;
+        }();
+        return primitives[static_cast<size_t>(kind)];
+    }
     return std::make_shared<Type>(kind, name);
 }
 
@@ -166,7 +190,8 @@ TypePtr TypeChecker::lookup(const std::string& name) const {
 }
 
 bool TypeChecker::sameType(const TypePtr& left, const TypePtr& right) {
-    if (!left || !right) return left == right;
+    if (left == right) return true;
+    if (!left || !right) return false;
     if (left->kind != right->kind || left->name != right->name) return false;
     if (!sameType(left->elementType, right->elementType) ||
         left->types.size() != right->types.size() ||
@@ -548,6 +573,9 @@ TypePtr TypeChecker::evaluateType(
             ? value : makeType(Type::Kind::Unknown);
     }
 
+    if (type->name.empty() && isPrimitiveKind(type->kind)) {
+        return makeType(type->kind);
+    }
     TypePtr result = makeType(type->kind, type->name);
     result->elementType =
         type->elementType
@@ -624,6 +652,9 @@ TypePtr TypeChecker::substituteType(
         if (replacement != substitutions.end()) return replacement->second;
     }
 
+    if (type->name.empty() && isPrimitiveKind(type->kind)) {
+        return makeType(type->kind);
+    }
     TypePtr result = makeType(type->kind, type->name);
     if (type->elementType) {
         result->elementType = substituteType(type->elementType, substitutions);
@@ -805,7 +836,7 @@ TypePtr TypeChecker::narrowTypeForCondition(
         ? resolved->types : std::vector<TypePtr>{resolved};
     std::function<bool(const TypePtr&)> matches;
 
-    if (auto* binary = dynamic_cast<const BinaryExpr*>(condition)) {
+    if (auto* binary = ast_cast<const BinaryExpr>(condition)) {
         using Op = BinaryExpr::Op;
         const bool equality =
             binary->op == Op::Equal || binary->op == Op::StrictEqual;
@@ -820,14 +851,14 @@ TypePtr TypeChecker::narrowTypeForCondition(
         if (equality || inequality) {
             const bool positive = equality ? whenTrue : !whenTrue;
             const auto* member =
-                dynamic_cast<const MemberExpr*>(binary->left.get());
+                ast_cast<const MemberExpr>(binary->left.get());
             const auto* literal =
-                dynamic_cast<const StringLiteral*>(binary->right.get());
+                ast_cast<const StringLiteral>(binary->right.get());
             if (member && literal) {
                 const auto* base =
-                    dynamic_cast<const Identifier*>(member->object.get());
+                    ast_cast<const Identifier>(member->object.get());
                 const auto* property =
-                    dynamic_cast<const Identifier*>(member->property.get());
+                    ast_cast<const Identifier>(member->property.get());
                 if (base && property && base->name == variable) {
                     const std::string expected = literal->value;
                     const std::string propertyName = property->name;
@@ -841,9 +872,9 @@ TypePtr TypeChecker::narrowTypeForCondition(
                 }
             }
             const auto* identifier =
-                dynamic_cast<const Identifier*>(binary->left.get());
+                ast_cast<const Identifier>(binary->left.get());
             if (!matches && identifier && identifier->name == variable &&
-                dynamic_cast<const NullLiteral*>(binary->right.get())) {
+                ast_cast<const NullLiteral>(binary->right.get())) {
                 matches = [](const TypePtr& candidate) {
                     return candidate &&
                         candidate->kind == Type::Kind::Null;
@@ -851,11 +882,11 @@ TypePtr TypeChecker::narrowTypeForCondition(
                 whenTrue = positive;
             }
             const auto* unary =
-                dynamic_cast<const UnaryExpr*>(binary->left.get());
+                ast_cast<const UnaryExpr>(binary->left.get());
             if (!matches && unary && literal &&
                 unary->op == UnaryExpr::Op::Typeof) {
                 const auto* operand =
-                    dynamic_cast<const Identifier*>(unary->operand.get());
+                    ast_cast<const Identifier>(unary->operand.get());
                 if (operand && operand->name == variable) {
                     Type::Kind expectedKind = Type::Kind::Unknown;
                     if (literal->value == "string") {
@@ -877,9 +908,9 @@ TypePtr TypeChecker::narrowTypeForCondition(
             }
         } else if (binary->op == Op::In) {
             const auto* property =
-                dynamic_cast<const StringLiteral*>(binary->left.get());
+                ast_cast<const StringLiteral>(binary->left.get());
             const auto* object =
-                dynamic_cast<const Identifier*>(binary->right.get());
+                ast_cast<const Identifier>(binary->right.get());
             if (property && object && object->name == variable) {
                 const std::string name = property->value;
                 matches = [=, this](const TypePtr& candidate) {
@@ -887,12 +918,12 @@ TypePtr TypeChecker::narrowTypeForCondition(
                 };
             }
         }
-    } else if (auto* call = dynamic_cast<const CallExpr*>(condition)) {
+    } else if (auto* call = ast_cast<const CallExpr>(condition)) {
         const auto* callee =
-            dynamic_cast<const Identifier*>(call->callee.get());
+            ast_cast<const Identifier>(call->callee.get());
         if (callee && !call->arguments.empty()) {
             const auto* argument =
-                dynamic_cast<const Identifier*>(call->arguments[0].get());
+                ast_cast<const Identifier>(call->arguments[0].get());
             auto signature = functions_.find(callee->name);
             if (argument && argument->name == variable &&
                 signature != functions_.end() &&
@@ -907,7 +938,7 @@ TypePtr TypeChecker::narrowTypeForCondition(
             }
         }
     } else if (auto* identifier =
-                   dynamic_cast<const Identifier*>(condition)) {
+                   ast_cast<const Identifier>(condition)) {
         // Truthiness narrowing: `if (x)` removes falsy types (null, undefined,
         // false) from the union in the true branch; `else` / negation keeps
         // only them. This is the primary enabler for strictNullChecks guard
@@ -925,7 +956,7 @@ TypePtr TypeChecker::narrowTypeForCondition(
             };
         }
     } else if (auto* unary =
-                   dynamic_cast<const UnaryExpr*>(condition)) {
+                   ast_cast<const UnaryExpr>(condition)) {
         // `if (!x)` narrows the same way as truthiness but inverted.
         if (unary->op == UnaryExpr::Op::Not) {
             return narrowTypeForCondition(original, unary->operand.get(),
@@ -988,7 +1019,7 @@ void TypeChecker::validateTypeArguments(const TypePtr& type,
 void TypeChecker::report(const ASTNode& node, const std::string& code,
                          const std::string& message) {
     std::ostringstream output;
-    if (!node.location.filename.empty()) output << node.location.filename;
+    if (!node.location.filename().empty()) output << node.location.filename();
     else output << "<input>";
     output << ':' << node.location.line << ':' << node.location.column
            << ": error " << code << ": " << message;
@@ -997,29 +1028,29 @@ void TypeChecker::report(const ASTNode& node, const std::string& code,
 
 TypePtr TypeChecker::inferExpression(Expr* expression) {
     if (!expression) return makeType(Type::Kind::Undefined);
-    if (auto* number = dynamic_cast<NumberLiteral*>(expression)) {
+    if (auto* number = ast_cast<NumberLiteral>(expression)) {
         TypePtr literal = makeType(
             Type::Kind::Literal,
             number->raw.empty() ? std::to_string(number->value) : number->raw);
         literal->elementType = makeType(Type::Kind::Number);
         return literal;
     }
-    if (dynamic_cast<BigIntLiteral*>(expression)) return makeType(Type::Kind::BigInt);
-    if (auto* string = dynamic_cast<StringLiteral*>(expression)) {
+    if (ast_cast<BigIntLiteral>(expression)) return makeType(Type::Kind::BigInt);
+    if (auto* string = ast_cast<StringLiteral>(expression)) {
         TypePtr literal = makeType(Type::Kind::Literal, string->value);
         literal->elementType = makeType(Type::Kind::String);
         return literal;
     }
-    if (dynamic_cast<TemplateLiteralExpr*>(expression)) return makeType(Type::Kind::String);
-    if (auto* boolean = dynamic_cast<BooleanLiteral*>(expression)) {
+    if (ast_cast<TemplateLiteralExpr>(expression)) return makeType(Type::Kind::String);
+    if (auto* boolean = ast_cast<BooleanLiteral>(expression)) {
         TypePtr literal = makeType(
             Type::Kind::Literal, boolean->value ? "true" : "false");
         literal->elementType = makeType(Type::Kind::Boolean);
         return literal;
     }
-    if (dynamic_cast<NullLiteral*>(expression)) return makeType(Type::Kind::Null);
-    if (dynamic_cast<UndefinedLiteral*>(expression)) return makeType(Type::Kind::Undefined);
-    if (auto* array = dynamic_cast<ArrayExpr*>(expression)) {
+    if (ast_cast<NullLiteral>(expression)) return makeType(Type::Kind::Null);
+    if (ast_cast<UndefinedLiteral>(expression)) return makeType(Type::Kind::Undefined);
+    if (auto* array = ast_cast<ArrayExpr>(expression)) {
         TypePtr result = makeType(Type::Kind::Array);
         for (auto& element : array->elements) {
             TypePtr elementType = inferExpression(element.get());
@@ -1029,11 +1060,11 @@ TypePtr TypeChecker::inferExpression(Expr* expression) {
         }
         return result;
     }
-    if (auto* object = dynamic_cast<ObjectExpr*>(expression)) {
+    if (auto* object = ast_cast<ObjectExpr>(expression)) {
         TypePtr result = makeType(Type::Kind::Object);
         for (auto& property : object->properties) {
             TypePtr valueType = inferExpression(property.value.get());
-            if (auto* spread = dynamic_cast<SpreadExpr*>(property.value.get())) {
+            if (auto* spread = ast_cast<SpreadExpr>(property.value.get())) {
                 TypePtr spreadType = resolveType(inferExpression(spread->argument.get()));
                 if (spreadType && spreadType->kind == Type::Kind::Object) {
                     for (const auto& [name, type] : spreadType->properties) {
@@ -1043,19 +1074,19 @@ TypePtr TypeChecker::inferExpression(Expr* expression) {
                 continue;
             }
             std::string key;
-            if (auto* identifier = dynamic_cast<Identifier*>(property.key.get())) {
+            if (auto* identifier = ast_cast<Identifier>(property.key.get())) {
                 key = identifier->name;
-            } else if (auto* string = dynamic_cast<StringLiteral*>(property.key.get())) {
+            } else if (auto* string = ast_cast<StringLiteral>(property.key.get())) {
                 key = string->value;
-            } else if (auto* number = dynamic_cast<NumberLiteral*>(property.key.get())) {
+            } else if (auto* number = ast_cast<NumberLiteral>(property.key.get())) {
                 key = number->raw.empty() ? std::to_string(number->value) : number->raw;
             }
             if (!key.empty()) result->properties[key] = valueType;
         }
         return result;
     }
-    if (auto* created = dynamic_cast<NewExpr*>(expression)) {
-        if (auto* identifier = dynamic_cast<Identifier*>(created->callee.get())) {
+    if (auto* created = ast_cast<NewExpr>(expression)) {
+        if (auto* identifier = ast_cast<Identifier>(created->callee.get())) {
             auto constructor = constructors_.find(identifier->name);
             if (constructor != constructors_.end()) {
                 const size_t count = std::min(
@@ -1088,10 +1119,10 @@ TypePtr TypeChecker::inferExpression(Expr* expression) {
         }
         return makeType(Type::Kind::Object);
     }
-    if (dynamic_cast<RegexLiteralExpr*>(expression)) {
+    if (ast_cast<RegexLiteralExpr>(expression)) {
         return makeType(Type::Kind::Object);
     }
-    if (auto* arrow = dynamic_cast<ArrowFunctionExpr*>(expression)) {
+    if (auto* arrow = ast_cast<ArrowFunctionExpr>(expression)) {
         TypePtr result = makeType(Type::Kind::Function);
         result->types = arrow->paramTypes;
         while (result->types.size() < arrow->params.size()) {
@@ -1100,7 +1131,7 @@ TypePtr TypeChecker::inferExpression(Expr* expression) {
         result->elementType = arrow->returnType ? arrow->returnType : makeType(Type::Kind::Any);
         return result;
     }
-    if (auto* function = dynamic_cast<FunctionExpr*>(expression)) {
+    if (auto* function = ast_cast<FunctionExpr>(expression)) {
         TypePtr result = makeType(Type::Kind::Function);
         result->types = function->paramTypes;
         while (result->types.size() < function->params.size()) {
@@ -1110,17 +1141,17 @@ TypePtr TypeChecker::inferExpression(Expr* expression) {
             ? function->returnType : makeType(Type::Kind::Any);
         return result;
     }
-    if (auto* identifier = dynamic_cast<Identifier*>(expression)) {
+    if (auto* identifier = ast_cast<Identifier>(expression)) {
         return lookup(identifier->name);
     }
-    if (auto* parenthesized = dynamic_cast<ParenthesizedExpr*>(expression)) {
+    if (auto* parenthesized = ast_cast<ParenthesizedExpr>(expression)) {
         return inferExpression(parenthesized->expression.get());
     }
-    if (auto* assertion = dynamic_cast<AsExpr*>(expression)) {
+    if (auto* assertion = ast_cast<AsExpr>(expression)) {
         inferExpression(assertion->expression.get());
         return assertion->targetType ? assertion->targetType : makeType(Type::Kind::Any);
     }
-    if (auto* satisfies = dynamic_cast<SatisfiesExpr*>(expression)) {
+    if (auto* satisfies = ast_cast<SatisfiesExpr>(expression)) {
         TypePtr source = inferExpression(satisfies->expression.get());
         if (!isAssignable(source, satisfies->targetType)) {
             report(*satisfies, "TS1360", "Type '" + typeName(source) +
@@ -1129,10 +1160,10 @@ TypePtr TypeChecker::inferExpression(Expr* expression) {
         }
         return source;
     }
-    if (auto* nonNull = dynamic_cast<NonNullExpr*>(expression)) {
+    if (auto* nonNull = ast_cast<NonNullExpr>(expression)) {
         return inferExpression(nonNull->expression.get());
     }
-    if (auto* unary = dynamic_cast<UnaryExpr*>(expression)) {
+    if (auto* unary = ast_cast<UnaryExpr>(expression)) {
         TypePtr operand = inferExpression(unary->operand.get());
         if (unary->op == UnaryExpr::Op::Not) return makeType(Type::Kind::Boolean);
         if (unary->op == UnaryExpr::Op::Typeof) return makeType(Type::Kind::String);
@@ -1148,7 +1179,7 @@ TypePtr TypeChecker::inferExpression(Expr* expression) {
         if (operand->kind == Type::Kind::BigInt) return makeType(Type::Kind::BigInt);
         return makeType(Type::Kind::Number);
     }
-    if (auto* update = dynamic_cast<UpdateExpr*>(expression)) {
+    if (auto* update = ast_cast<UpdateExpr>(expression)) {
         TypePtr operand = inferExpression(update->argument.get());
         if (operand->kind == Type::Kind::Symbol) {
             report(*update, "TS2356", "An arithmetic operand must be of type 'number' or 'bigint'.");
@@ -1157,7 +1188,7 @@ TypePtr TypeChecker::inferExpression(Expr* expression) {
         return operand->kind == Type::Kind::BigInt
             ? makeType(Type::Kind::BigInt) : makeType(Type::Kind::Number);
     }
-    if (auto* binary = dynamic_cast<BinaryExpr*>(expression)) {
+    if (auto* binary = ast_cast<BinaryExpr>(expression)) {
         TypePtr left = inferExpression(binary->left.get());
         TypePtr right = inferExpression(binary->right.get());
         using Op = BinaryExpr::Op;
@@ -1198,24 +1229,24 @@ TypePtr TypeChecker::inferExpression(Expr* expression) {
         }
         return makeType(Type::Kind::Number);
     }
-    if (auto* conditional = dynamic_cast<ConditionalExpr*>(expression)) {
+    if (auto* conditional = ast_cast<ConditionalExpr>(expression)) {
         inferExpression(conditional->test.get());
         TypePtr consequent = inferExpression(conditional->consequent.get());
         TypePtr alternate = inferExpression(conditional->alternate.get());
         return consequent->kind == alternate->kind
             ? consequent : makeType(Type::Kind::Any);
     }
-    if (auto* assignment = dynamic_cast<AssignmentExpr*>(expression)) {
+    if (auto* assignment = ast_cast<AssignmentExpr>(expression)) {
         TypePtr value = inferExpression(assignment->right.get());
         if (assignment->pattern) return value;
         TypePtr target = inferExpression(assignment->left.get());
-        if (auto* member = dynamic_cast<MemberExpr*>(assignment->left.get())) {
+        if (auto* member = ast_cast<MemberExpr>(assignment->left.get())) {
             std::string property;
             if (auto* identifier =
-                    dynamic_cast<Identifier*>(member->property.get())) {
+                    ast_cast<Identifier>(member->property.get())) {
                 property = identifier->name;
             } else if (auto* string =
-                           dynamic_cast<StringLiteral*>(member->property.get())) {
+                           ast_cast<StringLiteral>(member->property.get())) {
                 property = string->value;
             }
             TypePtr object = resolveType(inferExpression(member->object.get()));
@@ -1231,8 +1262,8 @@ TypePtr TypeChecker::inferExpression(Expr* expression) {
         }
         return value;
     }
-    if (auto* call = dynamic_cast<CallExpr*>(expression)) {
-        if (auto* identifier = dynamic_cast<Identifier*>(call->callee.get())) {
+    if (auto* call = ast_cast<CallExpr>(expression)) {
+        if (auto* identifier = ast_cast<Identifier>(call->callee.get())) {
             if (identifier->name == "BigInt") {
                 for (auto& argument : call->arguments) inferExpression(argument.get());
                 return makeType(Type::Kind::BigInt);
@@ -1332,12 +1363,12 @@ TypePtr TypeChecker::inferExpression(Expr* expression) {
         }
         return makeType(Type::Kind::Any);
     }
-    if (auto* sequence = dynamic_cast<SequenceExpr*>(expression)) {
+    if (auto* sequence = ast_cast<SequenceExpr>(expression)) {
         TypePtr result = makeType(Type::Kind::Undefined);
         for (auto& item : sequence->expressions) result = inferExpression(item.get());
         return result;
     }
-    if (auto* member = dynamic_cast<MemberExpr*>(expression)) {
+    if (auto* member = ast_cast<MemberExpr>(expression)) {
         TypePtr object = inferExpression(member->object.get());
         if (member->isComputed) {
             TypePtr index = inferExpression(member->property.get());
@@ -1355,7 +1386,7 @@ TypePtr TypeChecker::inferExpression(Expr* expression) {
                         : makeType(Type::Kind::Unknown);
                 }
             }
-            if (dynamic_cast<Identifier*>(member->property.get())) {
+            if (ast_cast<Identifier>(member->property.get())) {
                 TypePtr indexed = makeType(Type::Kind::IndexedAccess);
                 indexed->elementType = object;
                 indexed->indexType = index;
@@ -1363,11 +1394,11 @@ TypePtr TypeChecker::inferExpression(Expr* expression) {
             }
         }
         std::string property;
-        if (auto* identifier = dynamic_cast<Identifier*>(member->property.get())) {
+        if (auto* identifier = ast_cast<Identifier>(member->property.get())) {
             property = identifier->name;
-        } else if (auto* string = dynamic_cast<StringLiteral*>(member->property.get())) {
+        } else if (auto* string = ast_cast<StringLiteral>(member->property.get())) {
             property = string->value;
-        } else if (auto* number = dynamic_cast<NumberLiteral*>(member->property.get())) {
+        } else if (auto* number = ast_cast<NumberLiteral>(member->property.get())) {
             property = number->raw.empty() ? std::to_string(number->value) : number->raw;
         } else if (member->isComputed) {
             inferExpression(member->property.get());
@@ -1388,13 +1419,13 @@ TypePtr TypeChecker::inferExpression(Expr* expression) {
 
 void TypeChecker::checkStatement(Stmt* statement) {
     if (!statement) return;
-    if (auto* block = dynamic_cast<BlockStmt*>(statement)) {
+    if (auto* block = ast_cast<BlockStmt>(statement)) {
         pushScope();
         for (auto& item : block->statements) checkStatement(item.get());
         popScope();
-    } else if (auto* expression = dynamic_cast<ExprStmt*>(statement)) {
+    } else if (auto* expression = ast_cast<ExprStmt>(statement)) {
         inferExpression(expression->expression.get());
-    } else if (auto* variables = dynamic_cast<VarDeclStmt*>(statement)) {
+    } else if (auto* variables = ast_cast<VarDeclStmt>(statement)) {
         for (auto& declarator : variables->declarations) {
             TypePtr initializer = variables->isDeclare && declarator.type
                 ? evaluateType(declarator.type)
@@ -1414,16 +1445,16 @@ void TypeChecker::checkStatement(Stmt* statement) {
                 bind(declarator.name, declared);
             }
         }
-    } else if (auto* declaration = dynamic_cast<DeclStmt*>(statement)) {
+    } else if (auto* declaration = ast_cast<DeclStmt>(statement)) {
         checkDeclaration(declaration->declaration.get());
-    } else if (auto* returnStatement = dynamic_cast<ReturnStmt*>(statement)) {
+    } else if (auto* returnStatement = ast_cast<ReturnStmt>(statement)) {
         TypePtr actual = returnStatement->argument
             ? inferExpression(returnStatement->argument.get()) : makeType(Type::Kind::Void);
         if (expectedReturnType_ && !isAssignable(actual, expectedReturnType_)) {
             report(*returnStatement, "TS2322", "Type '" + typeName(actual) +
                 "' is not assignable to return type '" + typeName(expectedReturnType_) + "'.");
         }
-    } else if (auto* conditional = dynamic_cast<IfStmt*>(statement)) {
+    } else if (auto* conditional = ast_cast<IfStmt>(statement)) {
         inferExpression(conditional->test.get());
         std::unordered_map<std::string, TypePtr> visible;
         for (const auto& scope : scopes_) {
@@ -1446,10 +1477,10 @@ void TypeChecker::checkStatement(Stmt* statement) {
         checkStatement(conditional->alternate.get());
         popScope();
         const auto definitelyReturns = [](const Stmt* branch) {
-            if (dynamic_cast<const ReturnStmt*>(branch)) return true;
-            const auto* block = dynamic_cast<const BlockStmt*>(branch);
+            if (ast_cast<const ReturnStmt>(branch)) return true;
+            const auto* block = ast_cast<const BlockStmt>(branch);
             return block && !block->statements.empty() &&
-                dynamic_cast<const ReturnStmt*>(
+                ast_cast<const ReturnStmt>(
                     block->statements.back().get()) != nullptr;
         };
         if (!conditional->alternate &&
@@ -1462,25 +1493,25 @@ void TypeChecker::checkStatement(Stmt* statement) {
                 }
             }
         }
-    } else if (auto* whileLoop = dynamic_cast<WhileStmt*>(statement)) {
+    } else if (auto* whileLoop = ast_cast<WhileStmt>(statement)) {
         inferExpression(whileLoop->test.get()); checkStatement(whileLoop->body.get());
-    } else if (auto* doWhileLoop = dynamic_cast<DoWhileStmt*>(statement)) {
+    } else if (auto* doWhileLoop = ast_cast<DoWhileStmt>(statement)) {
         checkStatement(doWhileLoop->body.get()); inferExpression(doWhileLoop->test.get());
-    } else if (auto* forLoop = dynamic_cast<ForStmt*>(statement)) {
+    } else if (auto* forLoop = ast_cast<ForStmt>(statement)) {
         pushScope(); checkStatement(forLoop->init.get()); inferExpression(forLoop->test.get());
         inferExpression(forLoop->update.get()); checkStatement(forLoop->body.get()); popScope();
-    } else if (auto* thrown = dynamic_cast<ThrowStmt*>(statement)) {
+    } else if (auto* thrown = ast_cast<ThrowStmt>(statement)) {
         inferExpression(thrown->argument.get());
     } else if (auto* switchStatement =
-                   dynamic_cast<SwitchStmt*>(statement)) {
+                   ast_cast<SwitchStmt>(statement)) {
         TypePtr discriminant =
             inferExpression(switchStatement->discriminant.get());
-        const auto* member = dynamic_cast<MemberExpr*>(
+        const auto* member = ast_cast<MemberExpr>(
             switchStatement->discriminant.get());
         const auto* base = member
-            ? dynamic_cast<Identifier*>(member->object.get()) : nullptr;
+            ? ast_cast<Identifier>(member->object.get()) : nullptr;
         const auto* property = member
-            ? dynamic_cast<Identifier*>(member->property.get()) : nullptr;
+            ? ast_cast<Identifier>(member->property.get()) : nullptr;
         TypePtr original = base ? lookup(base->name) : nullptr;
         std::vector<std::string> covered;
         for (const auto& switchCase : switchStatement->cases) {
@@ -1492,7 +1523,7 @@ void TypeChecker::checkStatement(Stmt* statement) {
                     : std::vector<TypePtr>{resolveType(original)};
                 std::string expected;
                 if (auto* string =
-                        dynamic_cast<StringLiteral*>(switchCase->test.get())) {
+                        ast_cast<StringLiteral>(switchCase->test.get())) {
                     expected = string->value;
                     covered.push_back(expected);
                 }
@@ -1515,7 +1546,7 @@ void TypeChecker::checkStatement(Stmt* statement) {
             popScope();
         }
         (void)discriminant;
-    } else if (auto* labeled = dynamic_cast<LabeledStmt*>(statement)) {
+    } else if (auto* labeled = ast_cast<LabeledStmt>(statement)) {
         checkStatement(labeled->statement.get());
     }
 }
@@ -1556,37 +1587,65 @@ void TypeChecker::checkFunction(FunctionDecl& function) {
 
 void TypeChecker::checkDeclaration(Decl* declaration) {
     if (!declaration) return;
-    if (auto* function = dynamic_cast<FunctionDecl*>(declaration)) {
+    if (auto* function = ast_cast<FunctionDecl>(declaration)) {
         checkFunction(*function);
-    } else if (auto* exported = dynamic_cast<ExportDecl*>(declaration)) {
+    } else if (auto* exported = ast_cast<ExportDecl>(declaration)) {
         checkDeclaration(exported->exportedDecl.get());
         checkStatement(exported->exportedStmt.get());
-        inferExpression(exported->declaration.get());
+        TypePtr value = inferExpression(exported->declaration.get());
+        if (exported->isDefault && exported->declaration) {
+            exports_.values["default"] = value;
+        }
     }
 }
 
 bool TypeChecker::check(Program& program) {
     diagnostics_.clear(); scopes_.clear(); functions_.clear();
     overloads_.clear(); namedTypes_.clear(); genericTypes_.clear();
-    constructors_.clear();
+    constructors_.clear(); exports_ = ModuleExports();
     expectedReturnType_.reset();
     pushScope();
 
     std::vector<Decl*> declarations;
     for (auto& statement : program.body) {
-        auto* declarationStatement = dynamic_cast<DeclStmt*>(statement.get());
+        auto* declarationStatement = ast_cast<DeclStmt>(statement.get());
         Decl* declaration = declarationStatement
             ? declarationStatement->declaration.get() : nullptr;
-        if (auto* exported = dynamic_cast<ExportDecl*>(declaration)) {
+        if (auto* exported = ast_cast<ExportDecl>(declaration)) {
             if (exported->exportedDecl) declarations.push_back(exported->exportedDecl.get());
         } else if (declaration) {
             declarations.push_back(declaration);
         }
     }
 
+    // Imported bindings go in first so local declarations can refer to
+    // them; a local declaration of the same name wins, and imported types
+    // are never merged into (they belong to another module's checker).
+    if (importResolver_) {
+        std::unordered_set<std::string> declared;
+        for (Decl* declaration : declarations) {
+            if (auto* function = ast_cast<FunctionDecl>(declaration)) {
+                declared.insert(function->name);
+            } else if (auto* klass = ast_cast<ClassDecl>(declaration)) {
+                declared.insert(klass->name);
+            } else if (auto* interface = ast_cast<InterfaceDecl>(declaration)) {
+                declared.insert(interface->name);
+            } else if (auto* alias = ast_cast<TypeAliasDecl>(declaration)) {
+                declared.insert(alias->name);
+            } else if (auto* nameSpace = ast_cast<NamespaceDecl>(declaration)) {
+                declared.insert(nameSpace->name);
+            }
+        }
+        for (Decl* declaration : declarations) {
+            if (auto* import = ast_cast<ImportDecl>(declaration)) {
+                bindImport(*import, declared);
+            }
+        }
+    }
+
     // Binder pass: create type-space identities before resolving members.
     for (Decl* declaration : declarations) {
-        if (auto* interface = dynamic_cast<InterfaceDecl*>(declaration)) {
+        if (auto* interface = ast_cast<InterfaceDecl>(declaration)) {
             if (interface->typeParams.empty()) {
                 auto existing = namedTypes_.find(interface->name);
                 if (existing == namedTypes_.end()) {
@@ -1601,13 +1660,13 @@ bool TypeChecker::check(Program& program) {
                 generic.body = makeType(Type::Kind::Object);
                 genericTypes_[interface->name] = std::move(generic);
             }
-        } else if (auto* klass = dynamic_cast<ClassDecl*>(declaration)) {
+        } else if (auto* klass = ast_cast<ClassDecl>(declaration)) {
             namedTypes_[klass->name] =
                 makeType(Type::Kind::Object, klass->name);
         }
     }
     for (Decl* declaration : declarations) {
-        if (auto* alias = dynamic_cast<TypeAliasDecl*>(declaration)) {
+        if (auto* alias = ast_cast<TypeAliasDecl>(declaration)) {
             if (alias->typeParams.empty()) {
                 namedTypes_[alias->name] = alias->type;
             } else {
@@ -1621,12 +1680,12 @@ bool TypeChecker::check(Program& program) {
         }
     }
     for (Decl* declaration : declarations) {
-        if (auto* alias = dynamic_cast<TypeAliasDecl*>(declaration)) {
+        if (auto* alias = ast_cast<TypeAliasDecl>(declaration)) {
             validateTypeArguments(alias->type, *alias);
         }
     }
     for (Decl* declaration : declarations) {
-        auto* interface = dynamic_cast<InterfaceDecl*>(declaration);
+        auto* interface = ast_cast<InterfaceDecl>(declaration);
         if (!interface) continue;
         TypePtr type = interface->typeParams.empty()
             ? namedTypes_[interface->name]
@@ -1648,7 +1707,7 @@ bool TypeChecker::check(Program& program) {
     // Class instance shapes, inheritance and constructor signatures.
     for (size_t pass = 0; pass <= declarations.size(); ++pass) {
         for (Decl* declaration : declarations) {
-            auto* klass = dynamic_cast<ClassDecl*>(declaration);
+            auto* klass = ast_cast<ClassDecl>(declaration);
             if (!klass) continue;
             TypePtr type = namedTypes_[klass->name];
             if (!klass->superclass.empty()) {
@@ -1703,7 +1762,7 @@ bool TypeChecker::check(Program& program) {
         }
     }
     for (Decl* declaration : declarations) {
-        auto* klass = dynamic_cast<ClassDecl*>(declaration);
+        auto* klass = ast_cast<ClassDecl>(declaration);
         if (!klass) continue;
         for (const std::string& interfaceName : klass->interfaces) {
             auto implemented = namedTypes_.find(interfaceName);
@@ -1720,7 +1779,7 @@ bool TypeChecker::check(Program& program) {
     // Merge inherited members after every interface has its own members.
     for (size_t pass = 0; pass < declarations.size(); ++pass) {
         for (Decl* declaration : declarations) {
-            auto* interface = dynamic_cast<InterfaceDecl*>(declaration);
+            auto* interface = ast_cast<InterfaceDecl>(declaration);
             if (!interface) continue;
             TypePtr type = interface->typeParams.empty()
                 ? namedTypes_[interface->name]
@@ -1756,13 +1815,13 @@ bool TypeChecker::check(Program& program) {
 
             for (const auto& statement : nameSpace.body) {
                 auto* declarationStatement =
-                    dynamic_cast<DeclStmt*>(statement.get());
+                    ast_cast<DeclStmt>(statement.get());
                 Decl* member = declarationStatement
                     ? declarationStatement->declaration.get() : nullptr;
-                if (auto* exported = dynamic_cast<ExportDecl*>(member)) {
+                if (auto* exported = ast_cast<ExportDecl>(member)) {
                     member = exported->exportedDecl.get();
                 }
-                if (auto* interface = dynamic_cast<InterfaceDecl*>(member)) {
+                if (auto* interface = ast_cast<InterfaceDecl>(member)) {
                     const std::string memberName = qualified == "global"
                         ? interface->name
                         : qualified + "." + interface->name;
@@ -1797,11 +1856,11 @@ bool TypeChecker::check(Program& program) {
                         type->properties[method.name] = methodType;
                     }
                 } else if (auto* alias =
-                               dynamic_cast<TypeAliasDecl*>(member)) {
+                               ast_cast<TypeAliasDecl>(member)) {
                     namedTypes_[qualified + "." + alias->name] =
                         alias->type;
                 } else if (auto* function =
-                               dynamic_cast<FunctionDecl*>(member)) {
+                               ast_cast<FunctionDecl>(member)) {
                     TypePtr method = makeType(Type::Kind::Function);
                     method->types = function->paramTypes;
                     while (method->types.size() < function->params.size()) {
@@ -1813,7 +1872,7 @@ bool TypeChecker::check(Program& program) {
                         : makeType(Type::Kind::Void);
                     namespaceValue->properties[function->name] = method;
                 } else if (auto* nested =
-                               dynamic_cast<NamespaceDecl*>(member)) {
+                               ast_cast<NamespaceDecl>(member)) {
                     bindNamespace(*nested, qualified);
                     namespaceValue->properties[nested->name] =
                         namedTypes_["$namespace:" + qualified + "." +
@@ -1825,13 +1884,13 @@ bool TypeChecker::check(Program& program) {
             }
         };
     for (Decl* declaration : declarations) {
-        if (auto* nameSpace = dynamic_cast<NamespaceDecl*>(declaration)) {
+        if (auto* nameSpace = ast_cast<NamespaceDecl>(declaration)) {
             bindNamespace(*nameSpace, "");
         }
     }
 
     for (Decl* declaration : declarations) {
-        auto* function = dynamic_cast<FunctionDecl*>(declaration);
+        auto* function = ast_cast<FunctionDecl>(declaration);
         if (!function) continue;
         FunctionSignature signature;
         signature.typeParameters = function->typeParams;
@@ -1852,8 +1911,318 @@ bool TypeChecker::check(Program& program) {
         bind(function->name, makeType(Type::Kind::Function));
     }
     for (auto& statement : program.body) checkStatement(statement.get());
+    collectExports(program);
     popScope();
     return diagnostics_.empty();
 }
 
+void TypeChecker::bindImport(const ImportDecl& import,
+                             const std::unordered_set<std::string>& declared) {
+    const ModuleExports* module = importResolver_(import.source);
+    if (!module) return;
+    const auto bindName = [&](const std::string& imported,
+                              const std::string& local) {
+        if (declared.count(local) != 0) return;
+        auto value = module->values.find(imported);
+        if (value != module->values.end()) bind(local, value->second);
+        auto type = module->types.find(imported);
+        if (type != module->types.end()) namedTypes_[local] = type->second;
+        auto generic = module->genericTypes.find(imported);
+        if (generic != module->genericTypes.end()) {
+            genericTypes_[local] = generic->second;
+        }
+        auto function = module->functions.find(imported);
+        if (function != module->functions.end()) {
+            functions_[local] = function->second;
+        }
+        auto overloads = module->overloads.find(imported);
+        if (overloads != module->overloads.end()) {
+            overloads_[local] = overloads->second;
+        }
+        auto constructor = module->constructors.find(imported);
+        if (constructor != module->constructors.end()) {
+            constructors_[local] = constructor->second;
+        }
+    };
+    if (!import.defaultImport.empty()) bindName("default", import.defaultImport);
+    for (const auto& specifier : import.specifiers) {
+        bindName(specifier.imported, specifier.local);
+    }
+    const std::string& nameSpace = import.namespaceImport;
+    if (!nameSpace.empty() && declared.count(nameSpace) == 0) {
+        TypePtr object = makeType(Type::Kind::Object);
+        for (const auto& [name, value] : module->values) {
+            object->properties[name] = value;
+        }
+        for (const auto& [name, type] : module->types) {
+            namedTypes_[nameSpace + "." + name] = type;
+        }
+        bind(nameSpace, object);
+    }
+}
+
+void TypeChecker::collectExports(Program& program) {
+    const auto exportLocal = [&](const std::string& local,
+                                 const std::string& exported) {
+        auto function = functions_.find(local);
+        if (function != functions_.end()) {
+            exports_.functions[exported] = function->second;
+            TypePtr value = makeType(Type::Kind::Function);
+            value->types = function->second.parameters;
+            value->elementType = function->second.returnType;
+            exports_.values[exported] = value;
+        }
+        auto overloads = overloads_.find(local);
+        if (overloads != overloads_.end()) {
+            exports_.overloads[exported] = overloads->second;
+            exports_.values.emplace(exported, makeType(Type::Kind::Function));
+        }
+        auto type = namedTypes_.find(local);
+        if (type != namedTypes_.end()) exports_.types[exported] = type->second;
+        auto generic = genericTypes_.find(local);
+        if (generic != genericTypes_.end()) {
+            exports_.genericTypes[exported] = generic->second;
+        }
+        auto constructor = constructors_.find(local);
+        if (constructor != constructors_.end()) {
+            exports_.constructors[exported] = constructor->second;
+        }
+        auto nameSpace = namedTypes_.find("$namespace:" + local);
+        if (nameSpace != namedTypes_.end()) {
+            exports_.values[exported] = nameSpace->second;
+        }
+        auto value = scopes_.front().find(local);
+        if (value != scopes_.front().end()) {
+            exports_.values.emplace(exported, value->second);
+        }
+    };
+    // Copies a re-exported name across every table it appears in.
+    const auto reexport = [&](const ModuleExports& module,
+                              const std::string& name,
+                              const std::string& exported) {
+        const auto copy = [&](const auto& from, auto& to) {
+            auto found = from.find(name);
+            if (found != from.end()) to[exported] = found->second;
+        };
+        copy(module.values, exports_.values);
+        copy(module.types, exports_.types);
+        copy(module.genericTypes, exports_.genericTypes);
+        copy(module.functions, exports_.functions);
+        copy(module.overloads, exports_.overloads);
+        copy(module.constructors, exports_.constructors);
+    };
+
+    for (auto& statement : program.body) {
+        auto* declarationStatement = ast_cast<DeclStmt>(statement.get());
+        auto* exported = declarationStatement
+            ? ast_cast<ExportDecl>(declarationStatement->declaration.get())
+            : nullptr;
+        if (!exported) continue;
+        if (!exported->source.empty()) {
+            const ModuleExports* module = importResolver_
+                ? importResolver_(exported->source) : nullptr;
+            if (!module) continue;
+            if (!exported->namespaceExport.empty()) {
+                TypePtr object = makeType(Type::Kind::Object);
+                for (const auto& [name, value] : module->values) {
+                    object->properties[name] = value;
+                }
+                exports_.values[exported->namespaceExport] = object;
+            } else if (exported->specifiers.empty()) {
+                std::unordered_set<std::string> names;
+                for (const auto& [name, ignored] : module->values) names.insert(name);
+                for (const auto& [name, ignored] : module->types) names.insert(name);
+                for (const auto& [name, ignored] : module->genericTypes) names.insert(name);
+                names.erase("default");
+                for (const std::string& name : names) reexport(*module, name, name);
+            } else {
+                for (const auto& specifier : exported->specifiers) {
+                    reexport(*module, specifier.local, specifier.exported);
+                }
+            }
+            continue;
+        }
+        for (const auto& specifier : exported->specifiers) {
+            exportLocal(specifier.local, specifier.exported);
+        }
+        if (auto* identifier = ast_cast<Identifier>(exported->declaration.get())) {
+            exportLocal(identifier->name, "default");
+        }
+        Decl* declaration = exported->exportedDecl.get();
+        if (auto* function = ast_cast<FunctionDecl>(declaration)) {
+            exportLocal(function->name, function->name);
+        } else if (auto* klass = ast_cast<ClassDecl>(declaration)) {
+            exportLocal(klass->name, klass->name);
+        } else if (auto* interface = ast_cast<InterfaceDecl>(declaration)) {
+            exportLocal(interface->name, interface->name);
+        } else if (auto* alias = ast_cast<TypeAliasDecl>(declaration)) {
+            exportLocal(alias->name, alias->name);
+        } else if (auto* nameSpace = ast_cast<NamespaceDecl>(declaration)) {
+            exportLocal(nameSpace->name, nameSpace->name);
+        }
+        if (auto* variables = ast_cast<VarDeclStmt>(exported->exportedStmt.get())) {
+            for (const auto& declarator : variables->declarations) {
+                if (!declarator.name.empty()) {
+                    exportLocal(declarator.name, declarator.name);
+                }
+            }
+        }
+    }
+}
+
+namespace {
+
+// Writes a type's full structure; a type met again while it is being
+// written (a self-referential interface) is written by kind and name only.
+void describeType(const TypePtr& type, std::string& out,
+                  std::vector<const Type*>& active) {
+    if (!type) {
+        out += '?';
+        return;
+    }
+    out += std::to_string(static_cast<int>(type->kind));
+    if (!type->name.empty()) out += ':' + type->name;
+    if (std::find(active.begin(), active.end(), type.get()) != active.end()) {
+        return;
+    }
+    active.push_back(type.get());
+    const auto child = [&](const char* tag, const TypePtr& member) {
+        if (!member) return;
+        out += tag;
+        describeType(member, out, active);
+    };
+    const auto list = [&](char open, char close,
+                          const std::vector<TypePtr>& members) {
+        if (members.empty()) return;
+        out += open;
+        for (const auto& member : members) {
+            describeType(member, out, active);
+            out += ',';
+        }
+        out += close;
+    };
+    list('<', '>', type->typeArguments);
+    list('(', ')', type->types);
+    child(" elem ", type->elementType);
+    child(" index ", type->indexType);
+    child(" check ", type->checkType);
+    child(" extends ", type->extendsType);
+    child(" true ", type->trueType);
+    child(" false ", type->falseType);
+    child(" source ", type->mappedSource);
+    child(" value ", type->mappedValue);
+    child(" as ", type->mappedNameType);
+    if (!type->mappedVar.empty()) out += " in " + type->mappedVar;
+    if (type->mappedReadonlyModifier || type->mappedOptionalModifier) {
+        out += " mod " + std::to_string(type->mappedReadonlyModifier) + ',' +
+               std::to_string(type->mappedOptionalModifier);
+    }
+    if (type->isReadonly) out += " readonly";
+    if (type->isAssertion) out += " asserts";
+    if (!type->properties.empty()) {
+        std::vector<std::string> names;
+        for (const auto& [name, ignored] : type->properties) names.push_back(name);
+        std::sort(names.begin(), names.end());
+        out += '{';
+        for (const std::string& name : names) {
+            if (type->readonlyProperties.count(name)) out += "readonly ";
+            out += name;
+            if (type->optionalProperties.count(name)) out += '?';
+            out += ':';
+            describeType(type->properties.at(name), out, active);
+            out += ';';
+        }
+        out += '}';
+    }
+    active.pop_back();
+}
+
+template <typename Map>
+std::vector<std::string> sortedNames(const Map& map) {
+    std::vector<std::string> names;
+    for (const auto& [name, ignored] : map) names.push_back(name);
+    std::sort(names.begin(), names.end());
+    return names;
+}
+
+} // namespace
+
+std::string TypeChecker::exportSignature() const {
+    std::string out;
+    std::vector<const Type*> active;
+    const auto describeList = [&](const std::vector<TypePtr>& types) {
+        out += '(';
+        for (const auto& type : types) {
+            describeType(type, out, active);
+            out += ',';
+        }
+        out += ')';
+    };
+    const auto describeParameters = [&](const std::vector<std::string>& names,
+                                        const std::vector<TypePtr>& constraints,
+                                        const std::vector<TypePtr>& defaults) {
+        if (names.empty()) return;
+        out += '<';
+        for (size_t index = 0; index < names.size(); ++index) {
+            out += names[index];
+            if (index < constraints.size()) {
+                out += " extends ";
+                describeType(constraints[index], out, active);
+            }
+            if (index < defaults.size()) {
+                out += " = ";
+                describeType(defaults[index], out, active);
+            }
+            out += ',';
+        }
+        out += '>';
+    };
+    const auto describeFunction = [&](const FunctionSignature& signature) {
+        describeParameters(signature.typeParameters,
+                           signature.typeParameterConstraints,
+                           signature.typeParameterDefaults);
+        describeList(signature.parameters);
+        out += " => ";
+        describeType(signature.returnType, out, active);
+    };
+
+    for (const std::string& name : sortedNames(exports_.values)) {
+        out += "value " + name + ": ";
+        describeType(exports_.values.at(name), out, active);
+        out += '\n';
+    }
+    for (const std::string& name : sortedNames(exports_.types)) {
+        out += "type " + name + " = ";
+        describeType(exports_.types.at(name), out, active);
+        out += '\n';
+    }
+    for (const std::string& name : sortedNames(exports_.genericTypes)) {
+        const GenericTypeDeclaration& generic = exports_.genericTypes.at(name);
+        out += "type " + name;
+        describeParameters(generic.typeParameters, generic.constraints,
+                           generic.defaults);
+        out += " = ";
+        describeType(generic.body, out, active);
+        out += '\n';
+    }
+    for (const std::string& name : sortedNames(exports_.functions)) {
+        out += "function " + name;
+        describeFunction(exports_.functions.at(name));
+        out += '\n';
+    }
+    for (const std::string& name : sortedNames(exports_.overloads)) {
+        for (const auto& signature : exports_.overloads.at(name)) {
+            out += "overload " + name;
+            describeFunction(signature);
+            out += '\n';
+        }
+    }
+    for (const std::string& name : sortedNames(exports_.constructors)) {
+        out += "new " + name;
+        describeList(exports_.constructors.at(name));
+        out += '\n';
+    }
+    return out;
+}
+
 } // namespace nova
@@ -31,7 +31,7 @@ HIRInstruction* HIRBuilder::createAdd(HIRValue* lhs, HIRValue* rhs, const std::s
     // String concatenation: if either operand is a string, result is string
     if ((lhs->type && lhs->type->kind == HIRType::Kind::String) ||
         (rhs->type && rhs->type->kind == HIRType::Kind::String)) {
-        resultType = std::make_shared<HIRType>(HIRType::Kind::String);
+        resultType = HIRType::get(HIRType::Kind::String);
     }
     // Numeric addition: promote to larger type
     else {
@@ -47,10 +47,10 @@ HIRInstruction* HIRBuilder::createAdd(HIRValue* lhs, HIRValue* rhs, const std::s
 
         if (lhsIsFloat || rhsIsFloat) {
             // Promote to F64 for floating-point arithmetic
-            resultType = std::make_shared<HIRType>(HIRType::Kind::F64);
+            resultType = HIRType::get(HIRType::Kind::F64);
         } else {
             // Integer arithmetic: always use I64 (JavaScript's default)
-            resultType = std::make_shared<HIRType>(HIRType::Kind::I64);
+            resultType = HIRType::get(HIRType::Kind::I64);
         }
     }
 
@@ -61,8 +61,8 @@ HIRInstruction* HIRBuilder::createAdd(HIRValue* lhs, HIRValue* rhs, const std::s
     if(NOVA_DEBUG) std::cerr << "DEBUG HIR: createAdd - result type kind="
               << (inst->type ? static_cast<int>(inst->type->kind) : -1) << std::endl;
 
-    inst->addOperand(std::shared_ptr<HIRValue>(lhs, [](HIRValue*){}));
-    inst->addOperand(std::shared_ptr<HIRValue>(rhs, [](HIRValue*){}));
+    inst->addOperand(unownedValue(lhs));
+    inst->addOperand(unownedValue(rhs));
 
     if (currentBlock_) {
         currentBlock_->addInstruction(inst);
@@ -79,15 +79,15 @@ HIRInstruction* HIRBuilder::createSub(HIRValue* lhs, HIRValue* rhs, const std::s
                                      rhs->type->kind == HIRType::Kind::F32));
 
     if (lhsIsFloat || rhsIsFloat) {
-        resultType = std::make_shared<HIRType>(HIRType::Kind::F64);
+        resultType = HIRType::get(HIRType::Kind::F64);
     } else {
-        resultType = std::make_shared<HIRType>(HIRType::Kind::I64);
+        resultType = HIRType::get(HIRType::Kind::I64);
     }
 
     auto inst = std::make_shared<HIRInstruction>(
         HIRInstruction::Opcode::Sub, resultType, generateName(name));
-    inst->addOperand(std::shared_ptr<HIRValue>(lhs, [](HIRValue*){}));
-    inst->addOperand(std::shared_ptr<HIRValue>(rhs, [](HIRValue*){}));
+    inst->addOperand(unownedValue(lhs));
+    inst->addOperand(unownedValue(rhs));
 
     if (currentBlock_) {
         currentBlock_->addInstruction(inst);
@@ -104,15 +104,15 @@ HIRInstruction* HIRBuilder::createMul(HIRValue* lhs, HIRValue* rhs, const std::s
                                      rhs->type->kind == HIRType::Kind::F32));
 
     if (lhsIsFloat || rhsIsFloat) {
-        resultType = std::make_shared<HIRType>(HIRType::Kind::F64);
+        resultType = HIRType::get(HIRType::Kind::F64);
     } else {
-        resultType = std::make_shared<HIRType>(HIRType::Kind::I64);
+        resultType = HIRType::get(HIRType::Kind::I64);
     }
 
     auto inst = std::make_shared<HIRInstruction>(
         HIRInstruction::Opcode::Mul, resultType, generateName(name));
-    inst->addOperand(std::shared_ptr<HIRValue>(lhs, [](HIRValue*){}));
-    inst->addOperand(std::shared_ptr<HIRValue>(rhs, [](HIRValue*){}));
+    inst->addOperand(unownedValue(lhs));
+    inst->addOperand(unownedValue(rhs));
 
     if (currentBlock_) {
         currentBlock_->addInstruction(inst);
@@ -123,12 +123,12 @@ HIRInstruction* HIRBuilder::createMul(HIRValue* lhs, HIRValue* rhs, const std::s
 HIRInstruction* HIRBuilder::createDiv(HIRValue* lhs, HIRValue* rhs, const std::string& name) {
     // JavaScript Number division is floating-point even when both source
     // literals happen to be integral (for example, 5 / 2 === 2.5).
-    HIRTypePtr resultType = std::make_shared<HIRType>(HIRType::Kind::F64);
+    HIRTypePtr resultType = HIRType::get(HIRType::Kind::F64);
 
     auto inst = std::make_shared<HIRInstruction>(
         HIRInstruction::Opcode::Div, resultType, generateName(name));
-    inst->addOperand(std::shared_ptr<HIRValue>(lhs, [](HIRValue*){}));
-    inst->addOperand(std::shared_ptr<HIRValue>(rhs, [](HIRValue*){}));
+    inst->addOperand(unownedValue(lhs));
+    inst->addOperand(unownedValue(rhs));
 
     if (currentBlock_) {
         currentBlock_->addInstruction(inst);
@@ -145,15 +145,15 @@ HIRInstruction* HIRBuilder::createRem(HIRValue* lhs, HIRValue* rhs, const std::s
                                      rhs->type->kind == HIRType::Kind::F32));
 
     if (lhsIsFloat || rhsIsFloat) {
-        resultType = std::make_shared<HIRType>(HIRType::Kind::F64);
+        resultType = HIRType::get(HIRType::Kind::F64);
     } else {
-        resultType = std::make_shared<HIRType>(HIRType::Kind::I64);
+        resultType = HIRType::get(HIRType::Kind::I64);
     }
 
     auto inst = std::make_shared<HIRInstruction>(
         HIRInstruction::Opcode::Rem, resultType, generateName(name));
-    inst->addOperand(std::shared_ptr<HIRValue>(lhs, [](HIRValue*){}));
-    inst->addOperand(std::shared_ptr<HIRValue>(rhs, [](HIRValue*){}));
+    inst->addOperand(unownedValue(lhs));
+    inst->addOperand(unownedValue(rhs));
 
     if (currentBlock_) {
         currentBlock_->addInstruction(inst);
@@ -170,15 +170,15 @@ HIRInstruction* HIRBuilder::createPow(HIRValue* lhs, HIRValue* rhs, const std::s
                                      rhs->type->kind == HIRType::Kind::F32));
 
     if (lhsIsFloat || rhsIsFloat) {
-        resultType = std::make_shared<HIRType>(HIRType::Kind::F64);
+        resultType = HIRType::get(HIRType::Kind::F64);
     } else {
-        resultType = std::make_shared<HIRType>(HIRType::Kind::I64);
+        resultType = HIRType::get(HIRType::Kind::I64);
     }
 
     auto inst = std::make_shared<HIRInstruction>(
         HIRInstruction::Opcode::Pow, resultType, generateName(name));
-    inst->addOperand(std::shared_ptr<HIRValue>(lhs, [](HIRValue*){}));
-    inst->addOperand(std::shared_ptr<HIRValue>(rhs, [](HIRValue*){}));
+    inst->addOperand(unownedValue(lhs));
+    inst->addOperand(unownedValue(rhs));
 
     if (currentBlock_) {
         currentBlock_->addInstruction(inst);
@@ -193,12 +193,12 @@ HIRInstruction* HIRBuilder::createAnd(HIRValue* lhs, HIRValue* rhs, const std::s
     const bool booleanOperands = lhs && rhs && lhs->type && rhs->type &&
         lhs->type->kind == HIRType::Kind::Bool &&
         rhs->type->kind == HIRType::Kind::Bool;
-    auto resultType = std::make_shared<HIRType>(
+    auto resultType = HIRType::get(
         booleanOperands ? HIRType::Kind::Bool : HIRType::Kind::I64);
     auto inst = std::make_shared<HIRInstruction>(
         HIRInstruction::Opcode::And, resultType, generateName(name));
-    inst->addOperand(std::shared_ptr<HIRValue>(lhs, [](HIRValue*){}));
-    inst->addOperand(std::shared_ptr<HIRValue>(rhs, [](HIRValue*){}));
+    inst->addOperand(unownedValue(lhs));
+    inst->addOperand(unownedValue(rhs));
 
     if (currentBlock_) {
         currentBlock_->addInstruction(inst);
@@ -210,12 +210,12 @@ HIRInstruction* HIRBuilder::createOr(HIRValue* lhs, HIRValue* rhs, const std::st
     const bool booleanOperands = lhs && rhs && lhs->type && rhs->type &&
         lhs->type->kind == HIRType::Kind::Bool &&
         rhs->type->kind == HIRType::Kind::Bool;
-    auto resultType = std::make_shared<HIRType>(
+    auto resultType = HIRType::get(
         booleanOperands ? HIRType::Kind::Bool : HIRType::Kind::I64);
     auto inst = std::make_shared<HIRInstruction>(
         HIRInstruction::Opcode::Or, resultType, generateName(name));
-    inst->addOperand(std::shared_ptr<HIRValue>(lhs, [](HIRValue*){}));
-    inst->addOperand(std::shared_ptr<HIRValue>(rhs, [](HIRValue*){}));
+    inst->addOperand(unownedValue(lhs));
+    inst->addOperand(unownedValue(rhs));
 
     if (currentBlock_) {
         currentBlock_->addInstruction(inst);
@@ -225,11 +225,11 @@ HIRInstruction* HIRBuilder::createOr(HIRValue* lhs, HIRValue* rhs, const std::st
 
 HIRInstruction* HIRBuilder::createXor(HIRValue* lhs, HIRValue* rhs, const std::string& name) {
     // Bitwise operations always return I64 in JavaScript
-    auto resultType = std::make_shared<HIRType>(HIRType::Kind::I64);
+    auto resultType = HIRType::get(HIRType::Kind::I64);
     auto inst = std::make_shared<HIRInstruction>(
         HIRInstruction::Opcode::Xor, resultType, generateName(name));
-    inst->addOperand(std::shared_ptr<HIRValue>(lhs, [](HIRValue*){}));
-    inst->addOperand(std::shared_ptr<HIRValue>(rhs, [](HIRValue*){}));
+    inst->addOperand(unownedValue(lhs));
+    inst->addOperand(unownedValue(rhs));
 
     if (currentBlock_) {
         currentBlock_->addInstruction(inst);
@@ -239,11 +239,11 @@ HIRInstruction* HIRBuilder::createXor(HIRValue* lhs, HIRValue* rhs, const std::s
 
 HIRInstruction* HIRBuilder::createShl(HIRValue* lhs, HIRValue* rhs, const std::string& name) {
     // Bitwise operations always return I64 in JavaScript
-    auto resultType = std::make_shared<HIRType>(HIRType::Kind::I64);
+    auto resultType = HIRType::get(HIRType::Kind::I64);
     auto inst = std::make_shared<HIRInstruction>(
         HIRInstruction::Opcode::Shl, resultType, generateName(name));
-    inst->addOperand(std::shared_ptr<HIRValue>(lhs, [](HIRValue*){}));
-    inst->addOperand(std::shared_ptr<HIRValue>(rhs, [](HIRValue*){}));
+    inst->addOperand(unownedValue(lhs));
+    inst->addOperand(unownedValue(rhs));
 
     if (currentBlock_) {
         currentBlock_->addInstruction(inst);
@@ -253,11 +253,11 @@ HIRInstruction* HIRBuilder::createShl(HIRValue* lhs, HIRValue* rhs, const std::s
 
 HIRInstruction* HIRBuilder::createShr(HIRValue* lhs, HIRValue* rhs, const std::string& name) {
     // Bitwise operations always return I64 in JavaScript
-    auto resultType = std::make_shared<HIRType>(HIRType::Kind::I64);
+    auto resultType = HIRType::get(HIRType::Kind::I64);
     auto inst = std::make_shared<HIRInstruction>(
         HIRInstruction::Opcode::Shr, resultType, generateName(name));
-    inst->addOperand(std::shared_ptr<HIRValue>(lhs, [](HIRValue*){}));
-    inst->addOperand(std::shared_ptr<HIRValue>(rhs, [](HIRValue*){}));
+    inst->addOperand(unownedValue(lhs));
+    inst->addOperand(unownedValue(rhs));
 
     if (currentBlock_) {
         currentBlock_->addInstruction(inst);
@@ -267,11 +267,11 @@ HIRInstruction* HIRBuilder::createShr(HIRValue* lhs, HIRValue* rhs, const std::s
 
 HIRInstruction* HIRBuilder::createUShr(HIRValue* lhs, HIRValue* rhs, const std::string& name) {
     // Bitwise operations always return I64 in JavaScript
-    auto resultType = std::make_shared<HIRType>(HIRType::Kind::I64);
+    auto resultType = HIRType::get(HIRType::Kind::I64);
     auto inst = std::make_shared<HIRInstruction>(
         HIRInstruction::Opcode::UShr, resultType, generateName(name));
-    inst->addOperand(std::shared_ptr<HIRValue>(lhs, [](HIRValue*){}));
-    inst->addOperand(std::shared_ptr<HIRValue>(rhs, [](HIRValue*){}));
+    inst->addOperand(unownedValue(lhs));
+    inst->addOperand(unownedValue(rhs));
 
     if (currentBlock_) {
         currentBlock_->addInstruction(inst);
@@ -283,7 +283,7 @@ HIRInstruction* HIRBuilder::createNot(HIRValue* operand, const std::string& name
     auto resultType = operand->type;
     auto inst = std::make_shared<HIRInstruction>(
         HIRInstruction::Opcode::Not, resultType, generateName(name));
-    inst->addOperand(std::shared_ptr<HIRValue>(operand, [](HIRValue*){}));
+    inst->addOperand(unownedValue(operand));
 
     if (currentBlock_) {
         currentBlock_->addInstruction(inst);
@@ -294,10 +294,10 @@ HIRInstruction* HIRBuilder::createNot(HIRValue* operand, const std::string& name
 HIRInstruction* HIRBuilder::createNeg(HIRValue* operand, const std::string& name) {
     auto resultType = operand && operand->type
         ? operand->type
-        : std::make_shared<HIRType>(HIRType::Kind::I64);
+        : HIRType::get(HIRType::Kind::I64);
     auto inst = std::make_shared<HIRInstruction>(
         HIRInstruction::Opcode::Neg, resultType, generateName(name));
-    inst->addOperand(std::shared_ptr<HIRValue>(operand, [](HIRValue*){}));
+    inst->addOperand(unownedValue(operand));
 
     if (currentBlock_) {
         currentBlock_->addInstruction(inst);
@@ -307,11 +307,11 @@ HIRInstruction* HIRBuilder::createNeg(HIRValue* operand, const std::string& name
 
 // Comparison Operations
 HIRInstruction* HIRBuilder::createEq(HIRValue* lhs, HIRValue* rhs, const std::string& name) {
-    auto boolType = std::make_shared<HIRType>(HIRType::Kind::Bool);
+    auto boolType = HIRType::get(HIRType::Kind::Bool);
     auto inst = std::make_shared<HIRInstruction>(
         HIRInstruction::Opcode::Eq, boolType, generateName(name));
-    inst->addOperand(std::shared_ptr<HIRValue>(lhs, [](HIRValue*){}));
-    inst->addOperand(std::shared_ptr<HIRValue>(rhs, [](HIRValue*){}));
+    inst->addOperand(unownedValue(lhs));
+    inst->addOperand(unownedValue(rhs));
     
     if (currentBlock_) {
         currentBlock_->addInstruction(inst);
@@ -320,11 +320,11 @@ HIRInstruction* HIRBuilder::createEq(HIRValue* lhs, HIRValue* rhs, const std::st
 }
 
 HIRInstruction* HIRBuilder::createNe(HIRValue* lhs, HIRValue* rhs, const std::string& name) {
-    auto boolType = std::make_shared<HIRType>(HIRType::Kind::Bool);
+    auto boolType = HIRType::get(HIRType::Kind::Bool);
     auto inst = std::make_shared<HIRInstruction>(
         HIRInstruction::Opcode::Ne, boolType, generateName(name));
-    inst->addOperand(std::shared_ptr<HIRValue>(lhs, [](HIRValue*){}));
-    inst->addOperand(std::shared_ptr<HIRValue>(rhs, [](HIRValue*){}));
+    inst->addOperand(unownedValue(lhs));
+    inst->addOperand(unownedValue(rhs));
     
     if (currentBlock_) {
         currentBlock_->addInstruction(inst);
@@ -333,11 +333,11 @@ HIRInstruction* HIRBuilder::createNe(HIRValue* lhs, HIRValue* rhs, const std::st
 }
 
 HIRInstruction* HIRBuilder::createLt(HIRValue* lhs, HIRValue* rhs, const std::string& name) {
-    auto boolType = std::make_shared<HIRType>(HIRType::Kind::Bool);
+    auto boolType = HIRType::get(HIRType::Kind::Bool);
     auto inst = std::make_shared<HIRInstruction>(
         HIRInstruction::Opcode::Lt, boolType, generateName(name));
-    inst->addOperand(std::shared_ptr<HIRValue>(lhs, [](HIRValue*){}));
-    inst->addOperand(std::shared_ptr<HIRValue>(rhs, [](HIRValue*){}));
+    inst->addOperand(unownedValue(lhs));
+    inst->addOperand(unownedValue(rhs));
     
     if (currentBlock_) {
         currentBlock_->addInstruction(inst);
@@ -346,11 +346,11 @@ HIRInstruction* HIRBuilder::createLt(HIRValue* lhs, HIRValue* rhs, const std::st
 }
 
 HIRInstruction* HIRBuilder::createLe(HIRValue* lhs, HIRValue* rhs, const std::string& name) {
-    auto boolType = std::make_shared<HIRType>(HIRType::Kind::Bool);
+    auto boolType = HIRType::get(HIRType::Kind::Bool);
     auto inst = std::make_shared<HIRInstruction>(
         HIRInstruction::Opcode::Le, boolType, generateName(name));
-    inst->addOperand(std::shared_ptr<HIRValue>(lhs, [](HIRValue*){}));
-    inst->addOperand(std::shared_ptr<HIRValue>(rhs, [](HIRValue*){}));
+    inst->addOperand(unownedValue(lhs));
+    inst->addOperand(unownedValue(rhs));
     
     if (currentBlock_) {
         currentBlock_->addInstruction(inst);
@@ -359,11 +359,11 @@ HIRInstruction* HIRBuilder::createLe(HIRValue* lhs, HIRValue* rhs, const std::st
 }
 
 HIRInstruction* HIRBuilder::createGt(HIRValue* lhs, HIRValue* rhs, const std::string& name) {
-    auto boolType = std::make_shared<HIRType>(HIRType::Kind::Bool);
+    auto boolType = HIRType::get(HIRType::Kind::Bool);
     auto inst = std::make_shared<HIRInstruction>(
         HIRInstruction::Opcode::Gt, boolType, generateName(name));
-    inst->addOperand(std::shared_ptr<HIRValue>(lhs, [](HIRValue*){}));
-    inst->addOperand(std::shared_ptr<HIRValue>(rhs, [](HIRValue*){}));
+    inst->addOperand(unownedValue(lhs));
+    inst->addOperand(unownedValue(rhs));
     
     if (currentBlock_) {
         currentBlock_->addInstruction(inst);
@@ -372,11 +372,11 @@ HIRInstruction* HIRBuilder::createGt(HIRValue* lhs, HIRValue* rhs, const std::st
 }
 
 HIRInstruction* HIRBuilder::createGe(HIRValue* lhs, HIRValue* rhs, const std::string& name) {
-    auto boolType = std::make_shared<HIRType>(HIRType::Kind::Bool);
+    auto boolType = HIRType::get(HIRType::Kind::Bool);
     auto inst = std::make_shared<HIRInstruction>(
         HIRInstruction::Opcode::Ge, boolType, generateName(name));
-    inst->addOperand(std::shared_ptr<HIRValue>(lhs, [](HIRValue*){}));
-    inst->addOperand(std::shared_ptr<HIRValue>(rhs, [](HIRValue*){}));
+    inst->addOperand(unownedValue(lhs));
+    inst->addOperand(unownedValue(rhs));
     
     if (currentBlock_) {
         currentBlock_->addInstruction(inst);
@@ -391,9 +391,9 @@ HIRInstruction* HIRBuilder::createAlloca(HIRType* type, const std::string& name)
     HIRTypePtr typePtr;
     if (type) {
         // Create non-owning shared_ptr (types are managed elsewhere)
-        typePtr = std::shared_ptr<HIRType>(type, [](HIRType*){});
+        typePtr = unownedRef<HIRType>(type);
     } else {
-        typePtr = std::make_shared<HIRType>(HIRType::Kind::Any);
+        typePtr = HIRType::get(HIRType::Kind::Any);
     }
 
     auto ptrType = std::make_shared<HIRPointerType>(typePtr, true);
@@ -408,7 +408,7 @@ HIRInstruction* HIRBuilder::createAlloca(HIRType* type, const std::string& name)
 
 HIRInstruction* HIRBuilder::createLoad(HIRValue* ptr, const std::string& name) {
     // Extract pointee type from pointer
-    HIRTypePtr resultType = std::make_shared<HIRType>(HIRType::Kind::Any);
+    HIRTypePtr resultType = HIRType::get(HIRType::Kind::Any);
 
     if(NOVA_DEBUG) std::cerr << "DEBUG HIR: createLoad - ptr=" << ptr
               << ", ptr->type=" << (ptr ? ptr->type.get() : nullptr) << std::endl;
@@ -464,7 +464,7 @@ HIRInstruction* HIRBuilder::createLoad(HIRValue* ptr, const std::string& name) {
     HIRPointerType* checkPtr = dynamic_cast<HIRPointerType*>(inst->type.get());
     if(NOVA_DEBUG) std::cerr << "DEBUG HIR: createLoad - dynamic_cast to HIRPointerType=" << checkPtr << std::endl;
 
-    inst->addOperand(std::shared_ptr<HIRValue>(ptr, [](HIRValue*){}));
+    inst->addOperand(unownedValue(ptr));
 
     if (currentBlock_) {
         currentBlock_->addInstruction(inst);
@@ -473,11 +473,11 @@ HIRInstruction* HIRBuilder::createLoad(HIRValue* ptr, const std::string& name) {
 }
 
 HIRInstruction* HIRBuilder::createStore(HIRValue* value, HIRValue* ptr) {
-    auto voidType = std::make_shared<HIRType>(HIRType::Kind::Void);
+    auto voidType = HIRType::get(HIRType::Kind::Void);
     auto inst = std::make_shared<HIRInstruction>(
         HIRInstruction::Opcode::Store, voidType, "");
-    inst->addOperand(std::shared_ptr<HIRValue>(value, [](HIRValue*){}));
-    inst->addOperand(std::shared_ptr<HIRValue>(ptr, [](HIRValue*){}));
+    inst->addOperand(unownedValue(value));
+    inst->addOperand(unownedValue(ptr));
 
     if (currentBlock_) {
         currentBlock_->addInstruction(inst);
@@ -487,46 +487,46 @@ HIRInstruction* HIRBuilder::createStore(HIRValue* value, HIRValue* ptr) {
 
 // Control Flow
 HIRInstruction* HIRBuilder::createBr(HIRBasicBlock* dest) {
-    auto voidType = std::make_shared<HIRType>(HIRType::Kind::Void);
+    auto voidType = HIRType::get(HIRType::Kind::Void);
     auto inst = std::make_shared<HIRInstruction>(
         HIRInstruction::Opcode::Br, voidType, "");
     
     if (currentBlock_) {
         currentBlock_->addInstruction(inst);
         currentBlock_->successors.push_back(
-            std::shared_ptr<HIRBasicBlock>(dest, [](HIRBasicBlock*){}));
+            unownedRef<HIRBasicBlock>(dest));
         dest->predecessors.push_back(
-            std::shared_ptr<HIRBasicBlock>(currentBlock_, [](HIRBasicBlock*){}));
+            unownedRef<HIRBasicBlock>(currentBlock_));
     }
     return inst.get();
 }
 
 HIRInstruction* HIRBuilder::createCondBr(HIRValue* cond, HIRBasicBlock* thenBlock, HIRBasicBlock* elseBlock) {
-    auto voidType = std::make_shared<HIRType>(HIRType::Kind::Void);
+    auto voidType = HIRType::get(HIRType::Kind::Void);
     auto inst = std::make_shared<HIRInstruction>(
         HIRInstruction::Opcode::CondBr, voidType, "");
-    inst->addOperand(std::shared_ptr<HIRValue>(cond, [](HIRValue*){}));
+    inst->addOperand(unownedValue(cond));
     
     if (currentBlock_) {
         currentBlock_->addInstruction(inst);
         currentBlock_->successors.push_back(
-            std::shared_ptr<HIRBasicBlock>(thenBlock, [](HIRBasicBlock*){}));
+            unownedRef<HIRBasicBlock>(thenBlock));
         currentBlock_->successors.push_back(
-            std::shared_ptr<HIRBasicBlock>(elseBlock, [](HIRBasicBlock*){}));
+            unownedRef<HIRBasicBlock>(elseBlock));
         thenBlock->predecessors.push_back(
-            std::shared_ptr<HIRBasicBlock>(currentBlock_, [](HIRBasicBlock*){}));
+            unownedRef<HIRBasicBlock>(currentBlock_));
         elseBlock->predecessors.push_back(
-            std::shared_ptr<HIRBasicBlock>(currentBlock_, [](HIRBasicBlock*){}));
+            unownedRef<HIRBasicBlock>(currentBlock_));
     }
     return inst.get();
 }
 
 HIRInstruction* HIRBuilder::createReturn(HIRValue* value) {
-    auto voidType = std::make_shared<HIRType>(HIRType::Kind::Void);
+    auto voidType = HIRType::get(HIRType::Kind::Void);
     auto inst = std::make_shared<HIRInstruction>(
         HIRInstruction::Opcode::Return, voidType, "");
     if (value) {
-        inst->addOperand(std::shared_ptr<HIRValue>(value, [](HIRValue*){}));
+        inst->addOperand(unownedValue(value));
     }
     
     if (currentBlock_) {
@@ -543,14 +543,14 @@ HIRInstruction* HIRBuilder::createCall(HIRFunction* callee, const std::vector<HI
     
     // Add callee function name as first operand (string constant)
     // Create a temporary string constant for the function name
-    auto funcNameType = std::make_shared<HIRType>(HIRType::Kind::I64); // Placeholder type
+    auto funcNameType = HIRType::get(HIRType::Kind::I64); // Placeholder type
     auto funcNameConst = std::make_shared<HIRConstant>(
         funcNameType, HIRConstant::Kind::String, callee->name);
     inst->addOperand(funcNameConst);
     
     // Add arguments as remaining operands
     for (auto* arg : args) {
-        inst->addOperand(std::shared_ptr<HIRValue>(arg, [](HIRValue*){}));
+        inst->addOperand(unownedValue(arg));
     }
     
     if (currentBlock_) {
@@ -561,17 +561,17 @@ HIRInstruction* HIRBuilder::createCall(HIRFunction* callee, const std::vector<HI
 
 // Type Conversions
 HIRInstruction* HIRBuilder::createCast(HIRValue* value, HIRType* destType, const std::string& name) {
-    // Create a properly owned copy of the type
+    // Owned reference to the (interned) plain type of the same kind
     HIRTypePtr ownedDestType;
     if (destType) {
-        ownedDestType = std::make_shared<HIRType>(*destType);
+        ownedDestType = HIRType::get(destType->kind);
     } else {
-        ownedDestType = std::make_shared<HIRType>(HIRType::Kind::Any);
+        ownedDestType = HIRType::get(HIRType::Kind::Any);
     }
 
     auto inst = std::make_shared<HIRInstruction>(
         HIRInstruction::Opcode::Cast, ownedDestType, generateName(name));
-    inst->addOperand(std::shared_ptr<HIRValue>(value, [](HIRValue*){}));
+    inst->addOperand(unownedValue(value));
 
     if (currentBlock_) {
         currentBlock_->addInstruction(inst);
@@ -582,7 +582,7 @@ HIRInstruction* HIRBuilder::createCast(HIRValue* value, HIRType* destType, const
 // Aggregate Operations
 HIRInstruction* HIRBuilder::createGetField(HIRValue* struct_, uint32_t fieldIndex, const std::string& name) {
     // Determine the result type from the struct type
-    HIRTypePtr resultType = std::make_shared<HIRType>(HIRType::Kind::Any);
+    HIRTypePtr resultType = HIRType::get(HIRType::Kind::Any);
 
     if (struct_ && struct_->type) {
         // Check if it's a direct struct type
@@ -610,7 +610,7 @@ HIRInstruction* HIRBuilder::createGetField(HIRValue* struct_, uint32_t fieldInde
                 // Field 3: elements (ptr)
                 if (fieldIndex == 1 || fieldIndex == 2) {
                     // length or capacity - both are I64
-                    resultType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                    resultType = HIRType::get(HIRType::Kind::I64);
                     if (NOVA_DEBUG) std::cerr << "  DEBUG GetField: Array field " << fieldIndex << " is I64 (length/capacity)" << std::endl;
                 } else if (fieldIndex == 3) {
                     // elements pointer
@@ -619,11 +619,11 @@ HIRInstruction* HIRBuilder::createGetField(HIRValue* struct_, uint32_t fieldInde
                         resultType = std::make_shared<HIRPointerType>(arrayType->elementType, true);
                         if (NOVA_DEBUG) std::cerr << "  DEBUG GetField: Array field 3 is pointer to elements" << std::endl;
                     } else {
-                        resultType = std::make_shared<HIRPointerType>(std::make_shared<HIRType>(HIRType::Kind::Any), true);
+                        resultType = std::make_shared<HIRPointerType>(HIRType::get(HIRType::Kind::Any), true);
                     }
                 } else if (fieldIndex == 0) {
                     // type tag - treat as I64 array
-                    resultType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                    resultType = HIRType::get(HIRType::Kind::I64);
                     if (NOVA_DEBUG) std::cerr << "  DEBUG GetField: Array field 0 is type tag" << std::endl;
                 }
             }
@@ -637,11 +637,11 @@ HIRInstruction* HIRBuilder::createGetField(HIRValue* struct_, uint32_t fieldInde
 
     auto inst = std::make_shared<HIRInstruction>(
         HIRInstruction::Opcode::GetField, resultType, generateName(name));
-    inst->addOperand(std::shared_ptr<HIRValue>(struct_, [](HIRValue*){}));
+    inst->addOperand(unownedValue(struct_));
 
     // Store the field index as a constant operand
     auto indexConstant = createIntConstant(fieldIndex);
-    inst->addOperand(std::shared_ptr<HIRValue>(indexConstant, [](HIRValue*){}));
+    inst->addOperand(unownedValue(indexConstant));
 
     if (currentBlock_) {
         currentBlock_->addInstruction(inst);
@@ -650,17 +650,17 @@ HIRInstruction* HIRBuilder::createGetField(HIRValue* struct_, uint32_t fieldInde
 }
 
 HIRInstruction* HIRBuilder::createSetField(HIRValue* struct_, uint32_t fieldIndex, HIRValue* value, const std::string& name) {
-    auto voidType = std::make_shared<HIRType>(HIRType::Kind::Void);
+    auto voidType = HIRType::get(HIRType::Kind::Void);
     auto inst = std::make_shared<HIRInstruction>(
         HIRInstruction::Opcode::SetField, voidType, generateName(name));
-    inst->addOperand(std::shared_ptr<HIRValue>(struct_, [](HIRValue*){}));
+    inst->addOperand(unownedValue(struct_));
 
     // Add field index as a constant
     auto indexConstant = createIntConstant(fieldIndex);
-    inst->addOperand(std::shared_ptr<HIRValue>(indexConstant, [](HIRValue*){}));
+    inst->addOperand(unownedValue(indexConstant));
 
     // Add value to store
-    inst->addOperand(std::shared_ptr<HIRValue>(value, [](HIRValue*){}));
+    inst->addOperand(unownedValue(value));
 
     if (currentBlock_) {
         currentBlock_->addInstruction(inst);
@@ -669,7 +669,7 @@ HIRInstruction* HIRBuilder::createSetField(HIRValue* struct_, uint32_t fieldInde
 }
 
 HIRInstruction* HIRBuilder::createGetElement(HIRValue* array, HIRValue* index, const std::string& name) {
-    HIRTypePtr elementType = std::make_shared<HIRType>(HIRType::Kind::Any);
+    HIRTypePtr elementType = HIRType::get(HIRType::Kind::Any);
     if (array && array->type) {
         if (auto* pointerType = dynamic_cast<HIRPointerType*>(array->type.get())) {
             if (auto* arrayType = dynamic_cast<HIRArrayType*>(pointerType->pointeeType.get())) {
@@ -685,8 +685,8 @@ HIRInstruction* HIRBuilder::createGetElement(HIRValue* array, HIRValue* index, c
     }
     auto inst = std::make_shared<HIRInstruction>(
         HIRInstruction::Opcode::GetElement, elementType, generateName(name));
-    inst->addOperand(std::shared_ptr<HIRValue>(array, [](HIRValue*){}));
-    inst->addOperand(std::shared_ptr<HIRValue>(index, [](HIRValue*){}));
+    inst->addOperand(unownedValue(array));
+    inst->addOperand(unownedValue(index));
 
     if (currentBlock_) {
         currentBlock_->addInstruction(inst);
@@ -695,12 +695,12 @@ HIRInstruction* HIRBuilder::createGetElement(HIRValue* array, HIRValue* index, c
 }
 
 HIRInstruction* HIRBuilder::createSetElement(HIRValue* array, HIRValue* index, HIRValue* value) {
-    auto voidType = std::make_shared<HIRType>(HIRType::Kind::Void);
+    auto voidType = HIRType::get(HIRType::Kind::Void);
     auto inst = std::make_shared<HIRInstruction>(
         HIRInstruction::Opcode::SetElement, voidType, "");
-    inst->addOperand(std::shared_ptr<HIRValue>(array, [](HIRValue*){}));
-    inst->addOperand(std::shared_ptr<HIRValue>(index, [](HIRValue*){}));
-    inst->addOperand(std::shared_ptr<HIRValue>(value, [](HIRValue*){}));
+    inst->addOperand(unownedValue(array));
+    inst->addOperand(unownedValue(index));
+    inst->addOperand(unownedValue(value));
 
     if (currentBlock_) {
         currentBlock_->addInstruction(inst);
@@ -711,7 +711,7 @@ HIRInstruction* HIRBuilder::createSetElement(HIRValue* array, HIRValue* index, H
 HIRInstruction* HIRBuilder::createArrayConstruct(const std::vector<HIRValue*>& elements, const std::string& name) {
     // Preserve homogeneous element types. Heterogeneous arrays use the unified
     // tagged JavaScript value representation rather than ambiguous raw i64 bits.
-    HIRTypePtr elementType = std::make_shared<HIRType>(HIRType::Kind::I64);
+    HIRTypePtr elementType = HIRType::get(HIRType::Kind::I64);
     if (!elements.empty() && elements.front() && elements.front()->type) {
         elementType = elements.front()->type;
         // Null and undefined literals carry the internal Unknown type. Arrays
@@ -719,14 +719,14 @@ HIRInstruction* HIRBuilder::createArrayConstruct(const std::vector<HIRValue*>& e
         // survives storage and later default-value checks.
         if (elementType->kind == HIRType::Kind::Unknown ||
             elementType->kind == HIRType::Kind::Any) {
-            elementType = std::make_shared<HIRType>(HIRType::Kind::JSValue);
+            elementType = HIRType::get(HIRType::Kind::JSValue);
         }
         for (const auto* element : elements) {
             if (!element || !element->type ||
                 element->type->kind == HIRType::Kind::Unknown ||
                 element->type->kind == HIRType::Kind::Any ||
                 element->type->kind != elementType->kind) {
-                elementType = std::make_shared<HIRType>(HIRType::Kind::JSValue);
+                elementType = HIRType::get(HIRType::Kind::JSValue);
                 break;
             }
         }
@@ -741,7 +741,7 @@ HIRInstruction* HIRBuilder::createArrayConstruct(const std::vector<HIRValue*>& e
 
     // Add all elements as operands
     for (auto* elem : elements) {
-        inst->addOperand(std::shared_ptr<HIRValue>(elem, [](HIRValue*){}));
+        inst->addOperand(unownedValue(elem));
     }
 
     if (currentBlock_) {
@@ -753,7 +753,7 @@ HIRInstruction* HIRBuilder::createArrayConstruct(const std::vector<HIRValue*>& e
 HIRInstruction* HIRBuilder::createStructConstruct(HIRStructType* structType, const std::vector<HIRValue*>& fieldValues, const std::string& name) {
     // Create a pointer-to-struct type (struct construction returns a pointer)
     auto ptrToStruct = std::make_shared<HIRPointerType>(
-        std::shared_ptr<HIRStructType>(structType, [](HIRStructType*){}),
+        unownedRef<HIRStructType>(structType),
         true
     );
 
@@ -762,7 +762,7 @@ HIRInstruction* HIRBuilder::createStructConstruct(HIRStructType* structType, con
 
     // Add all field values as operands
     for (auto* fieldValue : fieldValues) {
-        inst->addOperand(std::shared_ptr<HIRValue>(fieldValue, [](HIRValue*){}));
+        inst->addOperand(unownedValue(fieldValue));
     }
 
     if (currentBlock_) {
@@ -774,32 +774,32 @@ HIRInstruction* HIRBuilder::createStructConstruct(HIRStructType* structType, con
 // Constants
 HIRConstant* HIRBuilder::createIntConstant(int64_t value, uint32_t bitWidth) {
     (void)bitWidth;
-    auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+    auto intType = HIRType::get(HIRType::Kind::I64);
     return new HIRConstant(intType, HIRConstant::Kind::Integer, value);
 }
 
 HIRConstant* HIRBuilder::createFloatConstant(double value) {
-    auto floatType = std::make_shared<HIRType>(HIRType::Kind::F64);
+    auto floatType = HIRType::get(HIRType::Kind::F64);
     return new HIRConstant(floatType, HIRConstant::Kind::Float, value);
 }
 
 HIRConstant* HIRBuilder::createBoolConstant(bool value) {
-    auto boolType = std::make_shared<HIRType>(HIRType::Kind::Bool);
+    auto boolType = HIRType::get(HIRType::Kind::Bool);
     return new HIRConstant(boolType, HIRConstant::Kind::Boolean, value);
 }
 
 HIRConstant* HIRBuilder::createStringConstant(const std::string& value) {
-    auto strType = std::make_shared<HIRType>(HIRType::Kind::String);
+    auto strType = HIRType::get(HIRType::Kind::String);
     return new HIRConstant(strType, HIRConstant::Kind::String, value);
 }
 
 HIRConstant* HIRBuilder::createNullConstant(HIRType* type) {
-    // Create a properly owned copy of the type
+    // Owned reference to the (interned) plain type of the same kind
     HIRTypePtr ownedType;
     if (type) {
-        ownedType = std::make_shared<HIRType>(*type);
+        ownedType = HIRType::get(type->kind);
     } else {
-        ownedType = std::make_shared<HIRType>(HIRType::Kind::Any);
+        ownedType = HIRType::get(HIRType::Kind::Any);
     }
 
     return new HIRConstant(ownedType, HIRConstant::Kind::Null, 0);
@@ -807,8 +807,8 @@ HIRConstant* HIRBuilder::createNullConstant(HIRType* type) {
 
 HIRConstant* HIRBuilder::createUndefinedConstant(HIRType* type) {
     HIRTypePtr ownedType = type
-        ? std::make_shared<HIRType>(*type)
-        : std::make_shared<HIRType>(HIRType::Kind::Unknown);
+        ? HIRType::get(type->kind)
+        : HIRType::get(HIRType::Kind::Unknown);
     return new HIRConstant(ownedType, HIRConstant::Kind::Undefined, 0);
 }
 
@@ -150,7 +150,7 @@ hir::HIRStructType* HIRGenerator::createClosureEnvironment(const std::string& fu
                                      << " (type kind: " << static_cast<int>(varValue->type->kind) << ")" << std::endl;
         } else {
             // Default to i64 if we can't determine type
-            field.type = std::make_shared<HIRType>(HIRType::Kind::I64);
+            field.type = HIRType::get(HIRType::Kind::I64);
             if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Environment field: " << varName
                                      << " (default i64)" << std::endl;
         }
@@ -221,8 +221,8 @@ HIRValue* HIRGenerator::materializeClosureEnvironment(
                 initialValue = builder_->createLoad(
                     storage, variableName + ".closure.initial");
             }
-            auto sizeType = std::make_shared<HIRType>(HIRType::Kind::I64);
-            auto opaqueType = std::make_shared<HIRType>(HIRType::Kind::Any);
+            auto sizeType = HIRType::get(HIRType::Kind::I64);
+            auto opaqueType = HIRType::get(HIRType::Kind::Any);
             auto opaquePointer = std::make_shared<HIRPointerType>(
                 opaqueType, true);
             auto allocator = module_->getFunction("nova_alloc_closure_env");
@@ -310,7 +310,7 @@ void HIRGenerator::visit(Identifier& node) {
         return;
     }
     if (node.name == "undefined") {
-        auto undefType = std::make_shared<HIRType>(HIRType::Kind::Unknown);
+        auto undefType = HIRType::get(HIRType::Kind::Unknown);
         lastValue_ = builder_->createUndefinedConstant(undefType.get());
         return;
     }
@@ -320,9 +320,9 @@ void HIRGenerator::visit(Identifier& node) {
     };
     if (errorConstructors.count(node.name) > 0) {
         auto stringType =
-            std::make_shared<HIRType>(HIRType::Kind::String);
+            HIRType::get(HIRType::Kind::String);
         auto jsValueType =
-            std::make_shared<HIRType>(HIRType::Kind::JSValue);
+            HIRType::get(HIRType::Kind::JSValue);
         HIRFunction* boxer = nullptr;
         if (auto existing =
                 module_->getFunction("nova_value_from_string")) {
@@ -343,9 +343,9 @@ void HIRGenerator::visit(Identifier& node) {
     }
     if (node.name == "escape" || node.name == "unescape") {
         auto stringType =
-            std::make_shared<HIRType>(HIRType::Kind::String);
+            HIRType::get(HIRType::Kind::String);
         auto jsValueType =
-            std::make_shared<HIRType>(HIRType::Kind::JSValue);
+            HIRType::get(HIRType::Kind::JSValue);
         HIRFunction* getter = nullptr;
         if (auto existing =
                 module_->getFunction(
@@ -388,7 +388,7 @@ void HIRGenerator::visit(Identifier& node) {
 
     if (auto nullish = staticNullishVariables_.find(node.name);
         nullish != staticNullishVariables_.end()) {
-        auto valueType = std::make_shared<HIRType>(HIRType::Kind::Unknown);
+        auto valueType = HIRType::get(HIRType::Kind::Unknown);
         lastValue_ = nullish->second == HIRConstant::Kind::Null
             ? builder_->createNullConstant(valueType.get())
             : builder_->createUndefinedConstant(valueType.get());
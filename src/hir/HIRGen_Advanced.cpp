@@ -24,10 +24,10 @@ void HIRGenerator::visit(SpreadExpr& node) {
         if (node.argument) {
             node.argument->accept(*this);
             if (auto* identifier =
-                    dynamic_cast<Identifier*>(node.argument.get());
+                    ast_cast<Identifier>(node.argument.get());
                 identifier && setVars_.count(identifier->name) > 0) {
                 auto pointerType =
-                    std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                    HIRType::get(HIRType::Kind::Pointer);
                 auto existing = module_->getFunction("nova_set_values");
                 HIRFunction* function =
                     existing ? existing.get() : nullptr;
@@ -47,20 +47,20 @@ void HIRGenerator::visit(SpreadExpr& node) {
             }
             bool generatorSpread = false;
             if (auto* call =
-                    dynamic_cast<CallExpr*>(node.argument.get())) {
+                    ast_cast<CallExpr>(node.argument.get())) {
                 if (auto* callee =
-                        dynamic_cast<Identifier*>(call->callee.get())) {
+                        ast_cast<Identifier>(call->callee.get())) {
                     generatorSpread =
                         generatorFuncs_.count(callee->name) > 0;
                 }
             } else if (auto* identifier =
-                           dynamic_cast<Identifier*>(node.argument.get())) {
+                           ast_cast<Identifier>(node.argument.get())) {
                 generatorSpread =
                     generatorVars_.count(identifier->name) > 0;
             }
             if (generatorSpread) {
                 auto pointerType =
-                    std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                    HIRType::get(HIRType::Kind::Pointer);
                 auto existing =
                     module_->getFunction("nova_generator_to_array");
                 HIRFunction* function =
@@ -121,8 +121,8 @@ void HIRGenerator::visit(TemplateLiteralExpr& node) {
                     exprValue->type->kind == HIRType::Kind::I32) {
                     if(NOVA_DEBUG) std::cerr << "  Converting number to string" << std::endl;
                     // Convert number to string using nova_i64_to_string
-                    auto stringType = std::make_shared<HIRType>(HIRType::Kind::String);
-                    auto i64Type = std::make_shared<HIRType>(HIRType::Kind::I64);
+                    auto stringType = HIRType::get(HIRType::Kind::String);
+                    auto i64Type = HIRType::get(HIRType::Kind::I64);
                     std::vector<HIRTypePtr> paramTypes = {i64Type};
 
                     HIRFunction* toStringFunc = nullptr;
@@ -150,8 +150,8 @@ void HIRGenerator::visit(TemplateLiteralExpr& node) {
                 } else if (exprValue->type->kind == HIRType::Kind::F64 ||
                            exprValue->type->kind == HIRType::Kind::F32) {
                     if(NOVA_DEBUG) std::cerr << "  Converting float to string" << std::endl;
-                    auto stringType = std::make_shared<HIRType>(HIRType::Kind::String);
-                    auto f64Type = std::make_shared<HIRType>(HIRType::Kind::F64);
+                    auto stringType = HIRType::get(HIRType::Kind::String);
+                    auto f64Type = HIRType::get(HIRType::Kind::F64);
                     std::vector<HIRTypePtr> paramTypes = {f64Type};
 
                     HIRFunction* toStringFunc = nullptr;
@@ -172,8 +172,8 @@ void HIRGenerator::visit(TemplateLiteralExpr& node) {
                     exprValue = lastValue_;
                 } else if (exprValue->type->kind == HIRType::Kind::Bool) {
                     // Convert boolean to "true" / "false" string via runtime.
-                    auto stringType = std::make_shared<HIRType>(HIRType::Kind::String);
-                    auto i64Type = std::make_shared<HIRType>(HIRType::Kind::I64);
+                    auto stringType = HIRType::get(HIRType::Kind::String);
+                    auto i64Type = HIRType::get(HIRType::Kind::I64);
 
                     // Widen bool to i64 for the C ABI.
                     HIRValue* boolAsI64 = builder_->createCast(exprValue, i64Type.get());
@@ -204,8 +204,8 @@ void HIRGenerator::visit(TemplateLiteralExpr& node) {
                             isObjectPointer = true;
                         }
                     }
-                    auto stringType = std::make_shared<HIRType>(HIRType::Kind::String);
-                    auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                    auto stringType = HIRType::get(HIRType::Kind::String);
+                    auto ptrType = HIRType::get(HIRType::Kind::Pointer);
 
                     if (isObjectPointer) {
                         std::vector<HIRTypePtr> paramTypes = {ptrType};
@@ -246,8 +246,8 @@ void HIRGenerator::visit(TemplateLiteralExpr& node) {
                 } else if (exprValue->type->kind == HIRType::Kind::Struct ||
                            exprValue->type->kind == HIRType::Kind::Reference) {
                     // Object literals become "[object Object]".
-                    auto stringType = std::make_shared<HIRType>(HIRType::Kind::String);
-                    auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                    auto stringType = HIRType::get(HIRType::Kind::String);
+                    auto ptrType = HIRType::get(HIRType::Kind::Pointer);
                     std::vector<HIRTypePtr> paramTypes = {ptrType};
 
                     HIRFunction* toStringFunc = nullptr;
@@ -270,7 +270,7 @@ void HIRGenerator::visit(TemplateLiteralExpr& node) {
             }
 
             // Concatenate result with the expression using nova_string_concat
-            auto stringType = std::make_shared<HIRType>(HIRType::Kind::String);
+            auto stringType = HIRType::get(HIRType::Kind::String);
             std::vector<HIRTypePtr> concatParamTypes = {stringType, stringType};
 
             HIRFunction* concatFunc = nullptr;
@@ -301,8 +301,8 @@ void HIRGenerator::visit(TemplateLiteralExpr& node) {
     }
     
 HIRValue* HIRGenerator::createResolvedPromise(HIRValue* value) {
-        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-        auto jsValueType = std::make_shared<HIRType>(HIRType::Kind::JSValue);
+        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+        auto jsValueType = HIRType::get(HIRType::Kind::JSValue);
         HIRValue* payload = toJSValue(value);
 
         HIRFunction* resolveFunction = nullptr;
@@ -329,8 +329,8 @@ void HIRGenerator::visit(AwaitExpr& node) {
         lastWasPromise_ = false;
         if (!isPromise || !awaited) return;
 
-        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-        auto jsValueType = std::make_shared<HIRType>(HIRType::Kind::JSValue);
+        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+        auto jsValueType = HIRType::get(HIRType::Kind::JSValue);
         HIRFunction* awaitFunction = nullptr;
         if (auto existing = module_->getFunction("nova_promise_await")) {
             awaitFunction = existing.get();
@@ -366,9 +366,9 @@ void HIRGenerator::visit(YieldExpr& node) {
             auto* genPtr = builder_->createLoad(currentGeneratorPtr_);
 
             // Get or create nova_generator_yield function
-            auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-            auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
-            auto voidType = std::make_shared<HIRType>(HIRType::Kind::Void);
+            auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+            auto intType = HIRType::get(HIRType::Kind::I64);
+            auto voidType = HIRType::get(HIRType::Kind::Void);
             std::vector<HIRTypePtr> paramTypes = {ptrType, intType};
 
             std::string runtimeFuncName = "nova_generator_yield";
@@ -450,9 +450,9 @@ void HIRGenerator::generateYieldDelegate(YieldExpr& node) {
         auto* outerGenPtr = builder_->createLoad(currentGeneratorPtr_);
 
         // Create types
-        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-        auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
-        auto voidType = std::make_shared<HIRType>(HIRType::Kind::Void);
+        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+        auto intType = HIRType::get(HIRType::Kind::I64);
+        auto voidType = HIRType::get(HIRType::Kind::Void);
 
         // Get or create nova_generator_store_local function
         std::vector<HIRTypePtr> storeLocalParamTypes = {ptrType, intType, intType};
@@ -638,9 +638,8 @@ void HIRGenerator::visit(AsExpr& node) {
                           << ", total entries=" << classStructTypes_.size() << std::endl;
             }
             if (structIt != classStructTypes_.end()) {
-                auto jsValueType = std::make_shared<HIRType>(HIRType::Kind::JSValue);
-                auto structTypePtr = std::shared_ptr<HIRType>(
-                    structIt->second, [](HIRType*){});
+                auto jsValueType = HIRType::get(HIRType::Kind::JSValue);
+                auto structTypePtr = unownedRef<HIRType>(structIt->second);
                 auto ptrType = std::make_shared<HIRPointerType>(
                     structTypePtr, true);
                 auto* function = [&]() -> HIRFunction* {
@@ -697,7 +696,7 @@ void HIRGenerator::visit(TaggedTemplateExpr& node) {
         // expressions into a single runtime array. Otherwise pass them as
         // individual arguments.
         std::string calleeName;
-        if (auto* ident = dynamic_cast<Identifier*>(node.tag.get())) {
+        if (auto* ident = ast_cast<Identifier>(node.tag.get())) {
             calleeName = ident->name;
         }
         bool hasRest = false;
@@ -720,7 +719,7 @@ void HIRGenerator::visit(TaggedTemplateExpr& node) {
         }
 
         // Call the tag function with (strings, ...values)
-        if (auto* ident = dynamic_cast<Identifier*>(node.tag.get())) {
+        if (auto* ident = ast_cast<Identifier>(node.tag.get())) {
             auto func = module_->getFunction(ident->name);
             if (func) {
                 lastValue_ = builder_->createCall(func.get(), args, "tagged_template");
@@ -760,7 +759,7 @@ void HIRGenerator::visit(MetaProperty& node) {
 
         if (node.meta == "new" && node.property == "target") {
             // new.target - returns undefined outside constructors, constructor function inside
-            auto undefinedType = std::make_shared<HIRType>(HIRType::Kind::Unknown);
+            auto undefinedType = HIRType::get(HIRType::Kind::Unknown);
             lastValue_ = builder_->createUndefinedConstant(undefinedType.get());
         } else if (node.meta == "import" && node.property == "meta") {
             // import.meta - return an object with url property
@@ -846,9 +845,9 @@ void HIRGenerator::visit(JSXElement& node) {
             auto existing = module_->getFunction(factoryName);
             HIRFunction* factory = existing ? existing.get() : nullptr;
             if (!factory) {
-                auto stringType = std::make_shared<HIRType>(
+                auto stringType = HIRType::get(
                     HIRType::Kind::String);
-                auto anyType = std::make_shared<HIRType>(
+                auto anyType = HIRType::get(
                     HIRType::Kind::Any);
                 auto* factoryType = new HIRFunctionType(
                     {stringType, props->type, childArray->type}, anyType);
@@ -973,12 +972,12 @@ void HIRGenerator::visit(EnumDecl& node) {
 
             // If member has explicit initializer, evaluate it
             if (member.initializer) {
-                if (auto* strLit = dynamic_cast<StringLiteral*>(member.initializer.get())) {
+                if (auto* strLit = ast_cast<StringLiteral>(member.initializer.get())) {
                     ev.kind = EnumValue::Kind::String;
                     ev.stringValue = strLit->value;
                     hasStringMember = true;
                     if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: StringLiteral value = \"" << ev.stringValue << "\"" << std::endl;
-                } else if (auto* numLit = dynamic_cast<NumberLiteral*>(member.initializer.get())) {
+                } else if (auto* numLit = ast_cast<NumberLiteral>(member.initializer.get())) {
                     ev.kind = EnumValue::Kind::Number;
                     ev.numberValue = static_cast<int64_t>(numLit->value);
                     nextValue = ev.numberValue + 1;
@@ -1143,7 +1142,8 @@ void HIRGenerator::visit(ImportDecl& node) {
         }
 
         nova::Parser parser(lexer);
-        auto ast = parser.parseProgram();
+        Program* ast =
+            importedPrograms_.emplace_back(parser.parseProgram()).get();
         if (parser.hasErrors()) {
             if (NOVA_DEBUG) std::cerr << "ERROR HIRGen: Parser errors in imported module: " << resolvedPath << std::endl;
             return;
@@ -1171,13 +1171,13 @@ void HIRGenerator::visit(ImportDecl& node) {
                 continue;
             }
 
-            auto* declarationStatement = dynamic_cast<DeclStmt*>(stmt.get());
+            auto* declarationStatement = ast_cast<DeclStmt>(stmt.get());
             auto* exported = declarationStatement
-                ? dynamic_cast<ExportDecl*>(declarationStatement->declaration.get())
+                ? ast_cast<ExportDecl>(declarationStatement->declaration.get())
                 : nullptr;
             if (!exported) {
                 if (declarationStatement && declarationStatement->declaration &&
-                    dynamic_cast<FunctionDecl*>(declarationStatement->declaration.get())) {
+                    ast_cast<FunctionDecl>(declarationStatement->declaration.get())) {
                     declarationStatement->declaration->accept(*this);
                 }
                 continue;
@@ -1199,35 +1199,35 @@ void HIRGenerator::visit(ImportDecl& node) {
             if (exported->exportedDecl) {
                 exported->exportedDecl->accept(*this);
                 if (auto* function =
-                        dynamic_cast<FunctionDecl*>(exported->exportedDecl.get())) {
+                        ast_cast<FunctionDecl>(exported->exportedDecl.get())) {
                     moduleFunctions[function->name] = function->name;
                 }
             }
             if (exported->isDefault && exported->declaration) {
                 if (auto* number =
-                        dynamic_cast<NumberLiteral*>(exported->declaration.get())) {
+                        ast_cast<NumberLiteral>(exported->declaration.get())) {
                     importedNumberConstants_["default"] = number->value;
                 } else if (auto* string =
-                               dynamic_cast<StringLiteral*>(exported->declaration.get())) {
+                               ast_cast<StringLiteral>(exported->declaration.get())) {
                     importedStringConstants_["default"] = string->value;
                 } else if (auto* boolean =
-                               dynamic_cast<BooleanLiteral*>(exported->declaration.get())) {
+                               ast_cast<BooleanLiteral>(exported->declaration.get())) {
                     importedBooleanConstants_["default"] = boolean->value;
                 }
             }
             auto* variables = exported->exportedStmt
-                ? dynamic_cast<VarDeclStmt*>(exported->exportedStmt.get()) : nullptr;
+                ? ast_cast<VarDeclStmt>(exported->exportedStmt.get()) : nullptr;
             if (!variables) continue;
             for (auto& declarator : variables->declarations) {
-                if (auto* number = dynamic_cast<NumberLiteral*>(declarator.init.get())) {
+                if (auto* number = ast_cast<NumberLiteral>(declarator.init.get())) {
                     importedNumberConstants_[declarator.name] = number->value;
                     moduleNumbers[declarator.name] = number->value;
                 } else if (auto* string =
-                               dynamic_cast<StringLiteral*>(declarator.init.get())) {
+                               ast_cast<StringLiteral>(declarator.init.get())) {
                     importedStringConstants_[declarator.name] = string->value;
                     moduleStrings[declarator.name] = string->value;
                 } else if (auto* boolean =
-                               dynamic_cast<BooleanLiteral*>(declarator.init.get())) {
+                               ast_cast<BooleanLiteral>(declarator.init.get())) {
                     importedBooleanConstants_[declarator.name] = boolean->value;
                     moduleBooleans[declarator.name] = boolean->value;
                 }
@@ -1377,15 +1377,15 @@ void HIRGenerator::visit(Program& node) {
             // Check if this is a DeclStmt containing a function or class declaration
             bool isImport = false;
             bool isDeclaration = false;
-            if (auto* declStmt = dynamic_cast<DeclStmt*>(stmt.get())) {
+            if (auto* declStmt = ast_cast<DeclStmt>(stmt.get())) {
                 if (declStmt->declaration) {
-                    isImport = dynamic_cast<ImportDecl*>(
+                    isImport = ast_cast<ImportDecl>(
                         declStmt->declaration.get()) != nullptr;
-                    if (dynamic_cast<FunctionDecl*>(declStmt->declaration.get()) ||
-                        dynamic_cast<ClassDecl*>(declStmt->declaration.get()) ||
-                        dynamic_cast<InterfaceDecl*>(declStmt->declaration.get()) ||
-                        dynamic_cast<TypeAliasDecl*>(declStmt->declaration.get()) ||
-                        dynamic_cast<EnumDecl*>(declStmt->declaration.get())) {
+                    if (ast_cast<FunctionDecl>(declStmt->declaration.get()) ||
+                        ast_cast<ClassDecl>(declStmt->declaration.get()) ||
+                        ast_cast<InterfaceDecl>(declStmt->declaration.get()) ||
+                        ast_cast<TypeAliasDecl>(declStmt->declaration.get()) ||
+                        ast_cast<EnumDecl>(declStmt->declaration.get())) {
                         isDeclaration = true;
                     }
                 }
@@ -1409,12 +1409,12 @@ void HIRGenerator::visit(Program& node) {
             std::vector<std::string> parts;
             Expr* cursor = expression;
             while (auto* member =
-                       dynamic_cast<MemberExpr*>(cursor)) {
+                       ast_cast<MemberExpr>(cursor)) {
                 if (member->isComputed) {
                     parts.clear();
                     break;
                 }
-                auto* property = dynamic_cast<Identifier*>(
+                auto* property = ast_cast<Identifier>(
                     member->property.get());
                 if (!property) {
                     parts.clear();
@@ -1423,7 +1423,7 @@ void HIRGenerator::visit(Program& node) {
                 parts.push_back(property->name);
                 cursor = member->object.get();
             }
-            if (auto* base = dynamic_cast<Identifier*>(cursor)) {
+            if (auto* base = ast_cast<Identifier>(cursor)) {
                 parts.push_back(base->name);
             } else {
                 parts.clear();
@@ -1437,15 +1437,15 @@ void HIRGenerator::visit(Program& node) {
             return path;
         };
         auto pointerType =
-            std::make_shared<HIRType>(HIRType::Kind::Pointer);
+            HIRType::get(HIRType::Kind::Pointer);
         auto stringType =
-            std::make_shared<HIRType>(HIRType::Kind::String);
+            HIRType::get(HIRType::Kind::String);
         auto integerType =
-            std::make_shared<HIRType>(HIRType::Kind::I64);
+            HIRType::get(HIRType::Kind::I64);
         auto booleanType =
-            std::make_shared<HIRType>(HIRType::Kind::Bool);
+            HIRType::get(HIRType::Kind::Bool);
         auto jsValueType =
-            std::make_shared<HIRType>(HIRType::Kind::JSValue);
+            HIRType::get(HIRType::Kind::JSValue);
         auto registerPrimordial =
             [&](const std::string& alias,
                 const std::string& runtimeName,
@@ -1463,7 +1463,7 @@ void HIRGenerator::visit(Program& node) {
             };
         for (const auto& statement : node.body) {
             auto* variables =
-                dynamic_cast<VarDeclStmt*>(statement.get());
+                ast_cast<VarDeclStmt>(statement.get());
             if (!variables) continue;
             for (const auto& declaration : variables->declarations) {
                 if (declaration.name.empty() || !declaration.init) {
@@ -1493,7 +1493,7 @@ void HIRGenerator::visit(Program& node) {
                         "nova_value_is_array",
                         {jsValueType}, booleanType);
                 } else if (auto* bind =
-                               dynamic_cast<CallExpr*>(
+                               ast_cast<CallExpr>(
                                    declaration.init.get())) {
                     if (memberPath(bind->callee.get()) !=
                             "Function.prototype.call.bind" ||
@@ -1546,9 +1546,9 @@ void HIRGenerator::visit(Program& node) {
         std::unordered_map<std::string, size_t> functionIndexByName;
         for (size_t idx : functionDeclIndices) {
             auto* statement =
-                dynamic_cast<DeclStmt*>(node.body[idx].get());
+                ast_cast<DeclStmt>(node.body[idx].get());
             auto* function = statement
-                ? dynamic_cast<FunctionDecl*>(
+                ? ast_cast<FunctionDecl>(
                       statement->declaration.get())
                 : nullptr;
             if (function) {
@@ -1571,9 +1571,9 @@ void HIRGenerator::visit(Program& node) {
                 std::unordered_set<std::string>& dependencies) {
                 if (!expression) return;
                 if (auto* call =
-                        dynamic_cast<CallExpr*>(expression)) {
+                        ast_cast<CallExpr>(expression)) {
                     if (auto* identifier =
-                            dynamic_cast<Identifier*>(
+                            ast_cast<Identifier>(
                                 call->callee.get())) {
                         if (functionIndexByName.count(
                                 identifier->name) > 0) {
@@ -1585,57 +1585,57 @@ void HIRGenerator::visit(Program& node) {
                         scanExpression(argument.get(), dependencies);
                     }
                 } else if (auto* binary =
-                               dynamic_cast<BinaryExpr*>(expression)) {
+                               ast_cast<BinaryExpr>(expression)) {
                     scanExpression(binary->left.get(), dependencies);
                     scanExpression(binary->right.get(), dependencies);
                 } else if (auto* unary =
-                               dynamic_cast<UnaryExpr*>(expression)) {
+                               ast_cast<UnaryExpr>(expression)) {
                     scanExpression(unary->operand.get(), dependencies);
                 } else if (auto* assignment =
-                               dynamic_cast<AssignmentExpr*>(expression)) {
+                               ast_cast<AssignmentExpr>(expression)) {
                     scanExpression(assignment->left.get(), dependencies);
                     scanExpression(assignment->right.get(), dependencies);
                 } else if (auto* update =
-                               dynamic_cast<UpdateExpr*>(expression)) {
+                               ast_cast<UpdateExpr>(expression)) {
                     scanExpression(update->argument.get(), dependencies);
                 } else if (auto* member =
-                               dynamic_cast<MemberExpr*>(expression)) {
+                               ast_cast<MemberExpr>(expression)) {
                     scanExpression(member->object.get(), dependencies);
                     scanExpression(member->property.get(), dependencies);
                 } else if (auto* conditional =
-                               dynamic_cast<ConditionalExpr*>(expression)) {
+                               ast_cast<ConditionalExpr>(expression)) {
                     scanExpression(conditional->test.get(), dependencies);
                     scanExpression(
                         conditional->consequent.get(), dependencies);
                     scanExpression(
                         conditional->alternate.get(), dependencies);
                 } else if (auto* array =
-                               dynamic_cast<ArrayExpr*>(expression)) {
+                               ast_cast<ArrayExpr>(expression)) {
                     for (auto& element : array->elements) {
                         scanExpression(element.get(), dependencies);
                     }
                 } else if (auto* object =
-                               dynamic_cast<ObjectExpr*>(expression)) {
+                               ast_cast<ObjectExpr>(expression)) {
                     for (auto& property : object->properties) {
                         scanExpression(
                             property.value.get(), dependencies);
                     }
                 } else if (auto* parenthesized =
-                               dynamic_cast<ParenthesizedExpr*>(
+                               ast_cast<ParenthesizedExpr>(
                                    expression)) {
                     scanExpression(
                         parenthesized->expression.get(),
                         dependencies);
                 } else if (auto* sequence =
-                               dynamic_cast<SequenceExpr*>(expression)) {
+                               ast_cast<SequenceExpr>(expression)) {
                     for (auto& item : sequence->expressions) {
                         scanExpression(item.get(), dependencies);
                     }
                 } else if (auto* awaited =
-                               dynamic_cast<AwaitExpr*>(expression)) {
+                               ast_cast<AwaitExpr>(expression)) {
                     scanExpression(awaited->argument.get(), dependencies);
                 } else if (auto* yielded =
-                               dynamic_cast<YieldExpr*>(expression)) {
+                               ast_cast<YieldExpr>(expression)) {
                     scanExpression(yielded->argument.get(), dependencies);
                 }
             };
@@ -1643,22 +1643,22 @@ void HIRGenerator::visit(Program& node) {
             [&](Stmt* statement,
                 std::unordered_set<std::string>& dependencies) {
                 if (!statement) return;
-                if (auto* block = dynamic_cast<BlockStmt*>(statement)) {
+                if (auto* block = ast_cast<BlockStmt>(statement)) {
                     for (auto& item : block->statements) {
                         scanStatement(item.get(), dependencies);
                     }
                 } else if (auto* expression =
-                               dynamic_cast<ExprStmt*>(statement)) {
+                               ast_cast<ExprStmt>(statement)) {
                     scanExpression(
                         expression->expression.get(), dependencies);
                 } else if (auto* variables =
-                               dynamic_cast<VarDeclStmt*>(statement)) {
+                               ast_cast<VarDeclStmt>(statement)) {
                     for (auto& declaration : variables->declarations) {
                         scanExpression(
                             declaration.init.get(), dependencies);
                     }
                 } else if (auto* conditional =
-                               dynamic_cast<IfStmt*>(statement)) {
+                               ast_cast<IfStmt>(statement)) {
                     scanExpression(
                         conditional->test.get(), dependencies);
                     scanStatement(
@@ -1666,13 +1666,13 @@ void HIRGenerator::visit(Program& node) {
                     scanStatement(
                         conditional->alternate.get(), dependencies);
                 } else if (auto* whileLoop =
-                               dynamic_cast<WhileStmt*>(statement)) {
+                               ast_cast<WhileStmt>(statement)) {
                     scanExpression(
                         whileLoop->test.get(), dependencies);
                     scanStatement(
                         whileLoop->body.get(), dependencies);
                 } else if (auto* forLoop =
-                               dynamic_cast<ForStmt*>(statement)) {
+                               ast_cast<ForStmt>(statement)) {
                     scanStatement(
                         forLoop->init.get(), dependencies);
                     scanExpression(
@@ -1682,14 +1682,14 @@ void HIRGenerator::visit(Program& node) {
                     scanStatement(
                         forLoop->body.get(), dependencies);
                 } else if (auto* returned =
-                               dynamic_cast<ReturnStmt*>(statement)) {
+                               ast_cast<ReturnStmt>(statement)) {
                     scanExpression(
                         returned->argument.get(), dependencies);
                 } else if (auto* thrown =
-                               dynamic_cast<ThrowStmt*>(statement)) {
+                               ast_cast<ThrowStmt>(statement)) {
                     scanExpression(thrown->argument.get(), dependencies);
                 } else if (auto* attempted =
-                               dynamic_cast<TryStmt*>(statement)) {
+                               ast_cast<TryStmt>(statement)) {
                     scanStatement(attempted->block.get(), dependencies);
                     if (attempted->handler) {
                         scanStatement(
@@ -1701,10 +1701,10 @@ void HIRGenerator::visit(Program& node) {
                 }
             };
         for (const auto& entry : functionIndexByName) {
-            auto* declaration = dynamic_cast<DeclStmt*>(
+            auto* declaration = ast_cast<DeclStmt>(
                 node.body[entry.second].get());
             auto* function = declaration
-                ? dynamic_cast<FunctionDecl*>(
+                ? ast_cast<FunctionDecl>(
                       declaration->declaration.get())
                 : nullptr;
             if (function) {
@@ -1719,9 +1719,9 @@ void HIRGenerator::visit(Program& node) {
         // in the ordinary-function dependency graph.
         for (size_t idx : functionDeclIndices) {
             auto* declaration =
-                dynamic_cast<DeclStmt*>(node.body[idx].get());
+                ast_cast<DeclStmt>(node.body[idx].get());
             if (!declaration ||
-                !dynamic_cast<FunctionDecl*>(
+                !ast_cast<FunctionDecl>(
                     declaration->declaration.get())) {
                 orderedFunctionDeclIndices.push_back(idx);
             }
@@ -1766,7 +1766,7 @@ void HIRGenerator::visit(Program& node) {
         if (!topLevelIndices.empty()) {
             // Create main function signature: int __nova_main()
             std::vector<HIRTypePtr> paramTypes;
-            auto returnType = std::make_shared<HIRType>(HIRType::Kind::I32);
+            auto returnType = HIRType::get(HIRType::Kind::I32);
 
             HIRFunctionType* funcType = new HIRFunctionType(paramTypes, returnType);
             HIRFunctionPtr mainFunc = module_->createFunction("__nova_main", funcType);
@@ -25,7 +25,7 @@ void HIRGenerator::visit(ArrayExpr& node) {
         // Check if any elements are spread expressions
         bool hasSpread = false;
         for (const auto& elem : node.elements) {
-            if (dynamic_cast<SpreadExpr*>(elem.get())) {
+            if (ast_cast<SpreadExpr>(elem.get())) {
                 hasSpread = true;
                 break;
             }
@@ -48,7 +48,7 @@ void HIRGenerator::visit(ArrayExpr& node) {
         // Special case: single spread element (e.g., [...arr])
         // This is the most common case and can use simple array copy
         if (node.elements.size() == 1) {
-            auto* spreadExpr = dynamic_cast<SpreadExpr*>(node.elements[0].get());
+            auto* spreadExpr = ast_cast<SpreadExpr>(node.elements[0].get());
             if (spreadExpr) {
                 // Evaluate the source array
                 spreadExpr->accept(*this);
@@ -65,10 +65,10 @@ void HIRGenerator::visit(ArrayExpr& node) {
                 }
 
                 // Get or create nova_array_copy function
-                auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                auto ptrType = HIRType::get(HIRType::Kind::Pointer);
 
                 // Create proper Pointer-to-Array type for the result
-                auto arrayElementType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                auto arrayElementType = HIRType::get(HIRType::Kind::I64);
                 auto arrayType = std::make_shared<HIRArrayType>(arrayElementType, 0); // Dynamic size
                 auto ptrToArrayType = std::make_shared<HIRPointerType>(arrayType, true);
 
@@ -99,8 +99,8 @@ void HIRGenerator::visit(ArrayExpr& node) {
 
         // Array with spread operators - need dynamic construction
         // Step 1: Calculate total length needed
-        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-        auto i64Type = std::make_shared<HIRType>(HIRType::Kind::I64);
+        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+        auto i64Type = HIRType::get(HIRType::Kind::I64);
 
         // Get or create value_array_length function
         std::vector<HIRTypePtr> lengthParamTypes = {ptrType};
@@ -119,7 +119,7 @@ void HIRGenerator::visit(ArrayExpr& node) {
         HIRValue* totalLength = builder_->createIntConstant(0);
 
         for (const auto& elem : node.elements) {
-            if (auto* spreadExpr = dynamic_cast<SpreadExpr*>(elem.get())) {
+            if (auto* spreadExpr = ast_cast<SpreadExpr>(elem.get())) {
                 // Spread element - get its length
                 spreadExpr->argument->accept(*this);
                 HIRValue* spreadArray = lastValue_;
@@ -139,7 +139,7 @@ void HIRGenerator::visit(ArrayExpr& node) {
 
         // Step 2: Create new array with calculated total length
         // Create proper Pointer-to-Array type for the result
-        auto arrayElementType = std::make_shared<HIRType>(HIRType::Kind::I64);
+        auto arrayElementType = HIRType::get(HIRType::Kind::I64);
         auto arrayType = std::make_shared<HIRArrayType>(arrayElementType, 0); // Dynamic size
         auto ptrToArrayType = std::make_shared<HIRPointerType>(arrayType, true);
 
@@ -172,7 +172,7 @@ void HIRGenerator::visit(ArrayExpr& node) {
         if (existingSetLengthFunc) {
             setLengthFunc = existingSetLengthFunc.get();
         } else {
-            auto voidType = std::make_shared<HIRType>(HIRType::Kind::Void);
+            auto voidType = HIRType::get(HIRType::Kind::Void);
             HIRFunctionType* funcType = new HIRFunctionType(setLengthParams, voidType);
             HIRFunctionPtr funcPtr = module_->createFunction("nova_array_set_length", funcType);
             funcPtr->linkage = HIRFunction::Linkage::External;
@@ -196,7 +196,7 @@ void HIRGenerator::visit(ArrayExpr& node) {
         }
 
         std::vector<HIRTypePtr> setParamTypes = {ptrType, i64Type, i64Type};
-        auto voidType = std::make_shared<HIRType>(HIRType::Kind::Void);
+        auto voidType = HIRType::get(HIRType::Kind::Void);
         HIRFunction* setFunc = nullptr;
         auto existingSetFunc = module_->getFunction("value_array_set");
         if (existingSetFunc) {
@@ -215,7 +215,7 @@ void HIRGenerator::visit(ArrayExpr& node) {
         builder_->createStore(initialDestIndex, destIndexAlloca);
 
         for (const auto& elem : node.elements) {
-            if (auto* spreadExpr = dynamic_cast<SpreadExpr*>(elem.get())) {
+            if (auto* spreadExpr = ast_cast<SpreadExpr>(elem.get())) {
                 // Spread element - copy all elements from source array
                 // Evaluate the spread source array
                 spreadExpr->argument->accept(*this);
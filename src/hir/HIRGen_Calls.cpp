@@ -79,20 +79,20 @@ bool isPromiseProducingExpression(
         Expr* expression,
         const std::unordered_set<std::string>& promiseVariables) {
     if (!expression) return false;
-    if (auto* identifier = dynamic_cast<Identifier*>(expression)) {
+    if (auto* identifier = ast_cast<Identifier>(expression)) {
         return promiseVariables.count(identifier->name) != 0;
     }
-    if (auto* construct = dynamic_cast<NewExpr*>(expression)) {
-        auto* callee = dynamic_cast<Identifier*>(construct->callee.get());
+    if (auto* construct = ast_cast<NewExpr>(expression)) {
+        auto* callee = ast_cast<Identifier>(construct->callee.get());
         return callee && callee->name == "Promise";
     }
-    auto* call = dynamic_cast<CallExpr*>(expression);
+    auto* call = ast_cast<CallExpr>(expression);
     if (!call) return false;
-    auto* member = dynamic_cast<MemberExpr*>(call->callee.get());
+    auto* member = ast_cast<MemberExpr>(call->callee.get());
     if (!member || member->isComputed) return false;
-    auto* property = dynamic_cast<Identifier*>(member->property.get());
+    auto* property = ast_cast<Identifier>(member->property.get());
     if (!property) return false;
-    if (auto* object = dynamic_cast<Identifier*>(member->object.get())) {
+    if (auto* object = ast_cast<Identifier>(member->object.get())) {
         if (object->name == "Promise") {
             return property->name == "resolve" || property->name == "reject" ||
                    property->name == "all" || property->name == "race" ||
@@ -131,6 +131,10 @@ void HIRGenerator::visit(CallExpr& node) {
         PollGuard guard{this, currentCatchBlock_,
             currentCatchBlock_ != nullptr};
 
+        if (tryInlineDirectCall(node)) {
+            return;
+        }
+
         auto recordReturnedClosure = [&](const std::string& functionName) {
             auto returned = module_->closureReturnedBy.find(functionName);
             if (returned != module_->closureReturnedBy.end()) {
@@ -138,17 +142,17 @@ void HIRGenerator::visit(CallExpr& node) {
             }
         };
 
-        if (auto* identifier = dynamic_cast<Identifier*>(node.callee.get());
+        if (auto* identifier = ast_cast<Identifier>(node.callee.get());
             identifier &&
             evalAliasVars_.count(identifier->name) > 0 &&
             !node.arguments.empty()) {
             if (auto* source =
-                    dynamic_cast<StringLiteral*>(
+                    ast_cast<StringLiteral>(
                         node.arguments.front().get())) {
                 auto stringType =
-                    std::make_shared<HIRType>(HIRType::Kind::String);
+                    HIRType::get(HIRType::Kind::String);
                 auto jsValueType =
-                    std::make_shared<HIRType>(HIRType::Kind::JSValue);
+                    HIRType::get(HIRType::Kind::JSValue);
                 HIRFunction* function = nullptr;
                 if (auto existing = module_->getFunction(
                         "nova_global_object_get_tagged")) {
@@ -169,21 +173,21 @@ void HIRGenerator::visit(CallExpr& node) {
             }
         }
 
-        if (auto* member = dynamic_cast<MemberExpr*>(node.callee.get())) {
+        if (auto* member = ast_cast<MemberExpr>(node.callee.get())) {
             auto* receiver =
-                dynamic_cast<Identifier*>(member->object.get());
+                ast_cast<Identifier>(member->object.get());
             auto* method =
-                dynamic_cast<Identifier*>(member->property.get());
+                ast_cast<Identifier>(member->property.get());
             bool callsArraySymbolIterator = false;
             if (member->isComputed && receiver &&
                 (runtimeArrayVars_.count(receiver->name) > 0 ||
                  taggedRuntimeArrayVars_.count(receiver->name) > 0)) {
                 if (auto* symbolMember =
-                        dynamic_cast<MemberExpr*>(member->property.get())) {
+                        ast_cast<MemberExpr>(member->property.get())) {
                     auto* symbolBase =
-                        dynamic_cast<Identifier*>(symbolMember->object.get());
+                        ast_cast<Identifier>(symbolMember->object.get());
                     auto* symbolName =
-                        dynamic_cast<Identifier*>(symbolMember->property.get());
+                        ast_cast<Identifier>(symbolMember->property.get());
                     callsArraySymbolIterator =
                         symbolBase && symbolName &&
                         symbolBase->name == "Symbol" &&
@@ -193,7 +197,7 @@ void HIRGenerator::visit(CallExpr& node) {
             if (callsArraySymbolIterator) {
                 member->object->accept(*this);
                 HIRValue* array = lastValue_;
-                auto pointerType = std::make_shared<HIRType>(
+                auto pointerType = HIRType::get(
                     HIRType::Kind::Pointer);
                 HIRFunction* iteratorFrom = nullptr;
                 if (auto existing =
@@ -226,9 +230,9 @@ void HIRGenerator::visit(CallExpr& node) {
                 lastFunctionName_ = savedFunction;
 
                 auto pointerType =
-                    std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                    HIRType::get(HIRType::Kind::Pointer);
                 auto integerType =
-                    std::make_shared<HIRType>(HIRType::Kind::I64);
+                    HIRType::get(HIRType::Kind::I64);
                 HIRFunction* function = nullptr;
                 if (auto existing =
                         module_->getFunction("nova_value_array_some")) {
@@ -248,7 +252,7 @@ void HIRGenerator::visit(CallExpr& node) {
             }
         }
 
-        if (auto* identifier = dynamic_cast<Identifier*>(node.callee.get());
+        if (auto* identifier = ast_cast<Identifier>(node.callee.get());
             identifier &&
             dynamicFunctionOps_.count(identifier->name) > 0 &&
             node.arguments.size() >= 2) {
@@ -270,7 +274,7 @@ void HIRGenerator::visit(CallExpr& node) {
         // Resolver aliases produced by
         // `const { resolve, reject } = Promise.withResolvers()` carry the
         // opaque capability as their invocation context.
-        if (auto* identifier = dynamic_cast<Identifier*>(node.callee.get())) {
+        if (auto* identifier = ast_cast<Identifier>(node.callee.get())) {
             auto resolveIt = promiseResolverBindings_.find(identifier->name);
             auto rejectIt = promiseRejecterBindings_.find(identifier->name);
             if (resolveIt != promiseResolverBindings_.end() ||
@@ -287,11 +291,11 @@ void HIRGenerator::visit(CallExpr& node) {
                     payload = toJSValue(nullptr);
                 }
                 auto ptrType =
-                    std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                    HIRType::get(HIRType::Kind::Pointer);
                 auto jsValueType =
-                    std::make_shared<HIRType>(HIRType::Kind::JSValue);
+                    HIRType::get(HIRType::Kind::JSValue);
                 auto voidType =
-                    std::make_shared<HIRType>(HIRType::Kind::Void);
+                    HIRType::get(HIRType::Kind::Void);
                 const std::string helper = rejects
                     ? "nova_promise_withResolvers_reject"
                     : "nova_promise_withResolvers_resolve";
@@ -332,11 +336,11 @@ void HIRGenerator::visit(CallExpr& node) {
         // Resolve Function.prototype call/apply/bind for statically named
         // functions before the generic member-expression machinery turns the
         // function identifier into a non-callable placeholder.
-        if (auto* member = dynamic_cast<MemberExpr*>(node.callee.get())) {
+        if (auto* member = ast_cast<MemberExpr>(node.callee.get())) {
             auto* targetIdentifier =
-                dynamic_cast<Identifier*>(member->object.get());
+                ast_cast<Identifier>(member->object.get());
             auto* methodIdentifier =
-                dynamic_cast<Identifier*>(member->property.get());
+                ast_cast<Identifier>(member->property.get());
             if (targetIdentifier && methodIdentifier && !member->isComputed) {
                 auto target = module_->getFunction(targetIdentifier->name);
                 const std::string& method = methodIdentifier->name;
@@ -354,7 +358,7 @@ void HIRGenerator::visit(CallExpr& node) {
                             forwarded.push_back(lastValue_);
                         }
                     } else if (node.arguments.size() > 1) {
-                        if (auto* literal = dynamic_cast<ArrayExpr*>(
+                        if (auto* literal = ast_cast<ArrayExpr>(
                                 node.arguments[1].get())) {
                             for (auto& element : literal->elements) {
                                 if (!element) {
@@ -364,7 +368,7 @@ void HIRGenerator::visit(CallExpr& node) {
                                 element->accept(*this);
                                 forwarded.push_back(lastValue_);
                             }
-                        } else if (dynamic_cast<Identifier*>(
+                        } else if (ast_cast<Identifier>(
                                        node.arguments[1].get())) {
                             node.arguments[1]->accept(*this);
                             HIRValue* arrayValue = lastValue_;
@@ -404,9 +408,9 @@ void HIRGenerator::visit(CallExpr& node) {
                             } else {
                                 target.reset();
                             }
-                        } else if (!dynamic_cast<NullLiteral*>(
+                        } else if (!ast_cast<NullLiteral>(
                                        node.arguments[1].get()) &&
-                                   !dynamic_cast<UndefinedLiteral*>(
+                                   !ast_cast<UndefinedLiteral>(
                                        node.arguments[1].get())) {
                             // Non-literal iterables require the dynamic callable
                             // ABI; leave them to the later runtime path.
@@ -456,13 +460,13 @@ void HIRGenerator::visit(CallExpr& node) {
         }
 
         if (forcePromiseExecutorABI_) {
-            if (auto* identifier = dynamic_cast<Identifier*>(node.callee.get())) {
+            if (auto* identifier = ast_cast<Identifier>(node.callee.get())) {
                 const bool resolves = !promiseExecutorResolveName_.empty() &&
                     identifier->name == promiseExecutorResolveName_;
                 const bool rejects = !promiseExecutorRejectName_.empty() &&
                     identifier->name == promiseExecutorRejectName_;
                 if (resolves || rejects) {
-                    auto jsValueType = std::make_shared<HIRType>(HIRType::Kind::JSValue);
+                    auto jsValueType = HIRType::get(HIRType::Kind::JSValue);
                     HIRValue* payload = nullptr;
                     if (!node.arguments.empty()) {
                         node.arguments[0]->accept(*this);
@@ -497,13 +501,13 @@ void HIRGenerator::visit(CallExpr& node) {
             }
         }
 
-        if (auto* member = dynamic_cast<MemberExpr*>(node.callee.get())) {
+        if (auto* member = ast_cast<MemberExpr>(node.callee.get())) {
             // Promise-producing expressions are valid receivers directly, e.g.
             // Promise.resolve(1).then(...).catch(...). The older path below only
             // recognized identifiers recorded in promiseVars_.
             auto* chainedProperty = member->isComputed ? nullptr
-                : dynamic_cast<Identifier*>(member->property.get());
-            if (!dynamic_cast<Identifier*>(member->object.get()) &&
+                : ast_cast<Identifier>(member->property.get());
+            if (!ast_cast<Identifier>(member->object.get()) &&
                 chainedProperty &&
                 (chainedProperty->name == "then" ||
                  chainedProperty->name == "catch" ||
@@ -511,8 +515,8 @@ void HIRGenerator::visit(CallExpr& node) {
                 isPromiseProducingExpression(member->object.get(), promiseVars_)) {
                 member->object->accept(*this);
                 HIRValue* objectValue = lastValue_;
-                auto pointerType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                auto integerType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                auto pointerType = HIRType::get(HIRType::Kind::Pointer);
+                auto integerType = HIRType::get(HIRType::Kind::I64);
                 const std::string& methodName = chainedProperty->name;
                 const bool hasRejectionHandler =
                     methodName == "then" && node.arguments.size() > 1;
@@ -542,8 +546,8 @@ void HIRGenerator::visit(CallExpr& node) {
                 const size_t callbackCount = hasRejectionHandler ? 2 : 1;
                 for (size_t index = 0; index < callbackCount; ++index) {
                     if (index >= node.arguments.size() ||
-                        dynamic_cast<NullLiteral*>(node.arguments[index].get()) ||
-                        dynamic_cast<UndefinedLiteral*>(node.arguments[index].get())) {
+                        ast_cast<NullLiteral>(node.arguments[index].get()) ||
+                        ast_cast<UndefinedLiteral>(node.arguments[index].get())) {
                         arguments.push_back(
                             builder_->createNullConstant(pointerType.get()));
                         arguments.push_back(
@@ -582,8 +586,8 @@ void HIRGenerator::visit(CallExpr& node) {
                 lastWasPromise_ = true;
                 return;
             }
-            auto* object = dynamic_cast<Identifier*>(member->object.get());
-            auto* property = dynamic_cast<Identifier*>(member->property.get());
+            auto* object = ast_cast<Identifier>(member->object.get());
+            auto* property = ast_cast<Identifier>(member->property.get());
             if (object && property) {
                 auto namespaceIt = moduleNamespaceFunctions_.find(object->name);
                 if (namespaceIt != moduleNamespaceFunctions_.end()) {
@@ -617,7 +621,7 @@ void HIRGenerator::visit(CallExpr& node) {
         }
 
         // Handle super() constructor calls
-        if (dynamic_cast<SuperExpr*>(node.callee.get())) {
+        if (ast_cast<SuperExpr>(node.callee.get())) {
             if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected super() constructor call" << std::endl;
 
             // Find the parent class name from current class
@@ -674,8 +678,8 @@ void HIRGenerator::visit(CallExpr& node) {
 
                         HIRFunction* mallocFunc = module_->getFunction("malloc").get();
                         if (!mallocFunc) {
-                            auto i64Type = std::make_shared<HIRType>(HIRType::Kind::I64);
-                            auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                            auto i64Type = HIRType::get(HIRType::Kind::I64);
+                            auto ptrType = HIRType::get(HIRType::Kind::Pointer);
                             HIRFunctionType* mft = new HIRFunctionType({i64Type}, ptrType);
                             auto mfp = module_->createFunction("malloc", mft);
                             mfp->linkage = HIRFunction::Linkage::External;
@@ -774,9 +778,9 @@ void HIRGenerator::visit(CallExpr& node) {
         }
 
         // Handle super.method() calls
-        if (auto* memberExpr = dynamic_cast<MemberExpr*>(node.callee.get())) {
-            if (dynamic_cast<SuperExpr*>(memberExpr->object.get())) {
-                if (auto* propIdent = dynamic_cast<Identifier*>(memberExpr->property.get())) {
+        if (auto* memberExpr = ast_cast<MemberExpr>(node.callee.get())) {
+            if (ast_cast<SuperExpr>(memberExpr->object.get())) {
+                if (auto* propIdent = ast_cast<Identifier>(memberExpr->property.get())) {
                     std::string methodName = propIdent->name;
                     if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected super." << methodName << "() call" << std::endl;
 
@@ -833,7 +837,7 @@ void HIRGenerator::visit(CallExpr& node) {
         }
 
         // Check for built-in module function calls (nova:fs, nova:test, etc.)
-        if (auto* ident = dynamic_cast<Identifier*>(node.callee.get())) {
+        if (auto* ident = ast_cast<Identifier>(node.callee.get())) {
             auto builtinIt = builtinFunctionImports_.find(ident->name);
             if (builtinIt != builtinFunctionImports_.end()) {
                 std::string runtimeFuncName = builtinIt->second;
@@ -847,8 +851,8 @@ void HIRGenerator::visit(CallExpr& node) {
                 }
 
                 // Determine function signature based on the function name
-                auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                auto i64Type = std::make_shared<HIRType>(HIRType::Kind::I64);
+                auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                auto i64Type = HIRType::get(HIRType::Kind::I64);
 
                 std::vector<HIRTypePtr> paramTypes;
                 HIRTypePtr returnType = ptrType;  // Default to pointer return
@@ -929,7 +933,7 @@ void HIRGenerator::visit(CallExpr& node) {
                     returnType = i64Type;
                 } else if (runtimeFuncName == "nova_os_exit") {
                     paramTypes = {i64Type};
-                    returnType = std::make_shared<HIRType>(HIRType::Kind::Void);
+                    returnType = HIRType::get(HIRType::Kind::Void);
                 }
                 // Default - assume all pointer params and pointer return
                 else {
@@ -966,7 +970,7 @@ void HIRGenerator::visit(CallExpr& node) {
         }
 
         // Check for global functions (parseInt, parseFloat, etc.)
-        if (auto* ident = dynamic_cast<Identifier*>(node.callee.get())) {
+        if (auto* ident = ast_cast<Identifier>(node.callee.get())) {
             if (ident->name == "parseInt") {
                 // parseInt() - for integer type system, just returns the argument value
                 if (node.arguments.size() < 1) {
@@ -1005,8 +1009,8 @@ void HIRGenerator::visit(CallExpr& node) {
                 // Setup function signature
                 std::string runtimeFuncName = "nova_global_isNaN";
                 std::vector<HIRTypePtr> paramTypes;
-                paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::F64));
-                auto returnType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                paramTypes.push_back(HIRType::get(HIRType::Kind::F64));
+                auto returnType = HIRType::get(HIRType::Kind::I64);
 
                 // Find or create runtime function
                 HIRFunction* runtimeFunc = nullptr;
@@ -1046,8 +1050,8 @@ void HIRGenerator::visit(CallExpr& node) {
                 // Setup function signature
                 std::string runtimeFuncName = "nova_global_isFinite";
                 std::vector<HIRTypePtr> paramTypes;
-                paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::F64));
-                auto returnType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                paramTypes.push_back(HIRType::get(HIRType::Kind::F64));
+                auto returnType = HIRType::get(HIRType::Kind::I64);
 
                 // Find or create runtime function
                 HIRFunction* runtimeFunc = nullptr;
@@ -1096,9 +1100,9 @@ void HIRGenerator::visit(CallExpr& node) {
                 // Setup function signature
                 std::string runtimeFuncName = "nova_global_parseInt";
                 std::vector<HIRTypePtr> paramTypes;
-                paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));
-                auto returnType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                paramTypes.push_back(HIRType::get(HIRType::Kind::I64));
+                auto returnType = HIRType::get(HIRType::Kind::I64);
 
                 // Find or create runtime function
                 HIRFunction* runtimeFunc = nullptr;
@@ -1138,8 +1142,8 @@ void HIRGenerator::visit(CallExpr& node) {
                 // Setup function signature
                 std::string runtimeFuncName = "nova_global_parseFloat";
                 std::vector<HIRTypePtr> paramTypes;
-                paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                auto returnType = std::make_shared<HIRType>(HIRType::Kind::F64);
+                paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                auto returnType = HIRType::get(HIRType::Kind::F64);
 
                 // Find or create runtime function
                 HIRFunction* runtimeFunc = nullptr;
@@ -1179,8 +1183,8 @@ void HIRGenerator::visit(CallExpr& node) {
                 // Setup function signature
                 std::string runtimeFuncName = "nova_encodeURIComponent";
                 std::vector<HIRTypePtr> paramTypes;
-                paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                auto returnType = std::make_shared<HIRType>(HIRType::Kind::String);
+                paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                auto returnType = HIRType::get(HIRType::Kind::String);
 
                 // Find or create runtime function
                 HIRFunction* runtimeFunc = nullptr;
@@ -1220,8 +1224,8 @@ void HIRGenerator::visit(CallExpr& node) {
                 // Setup function signature
                 std::string runtimeFuncName = "nova_decodeURIComponent";
                 std::vector<HIRTypePtr> paramTypes;
-                paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                auto returnType = std::make_shared<HIRType>(HIRType::Kind::String);
+                paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                auto returnType = HIRType::get(HIRType::Kind::String);
 
                 // Find or create runtime function
                 HIRFunction* runtimeFunc = nullptr;
@@ -1261,8 +1265,8 @@ void HIRGenerator::visit(CallExpr& node) {
                 // Setup function signature
                 std::string runtimeFuncName = "nova_btoa";
                 std::vector<HIRTypePtr> paramTypes;
-                paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                auto returnType = std::make_shared<HIRType>(HIRType::Kind::String);
+                paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                auto returnType = HIRType::get(HIRType::Kind::String);
 
                 // Find or create runtime function
                 HIRFunction* runtimeFunc = nullptr;
@@ -1302,8 +1306,8 @@ void HIRGenerator::visit(CallExpr& node) {
                 // Setup function signature
                 std::string runtimeFuncName = "nova_atob";
                 std::vector<HIRTypePtr> paramTypes;
-                paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                auto returnType = std::make_shared<HIRType>(HIRType::Kind::String);
+                paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                auto returnType = HIRType::get(HIRType::Kind::String);
 
                 // Find or create runtime function
                 HIRFunction* runtimeFunc = nullptr;
@@ -1352,9 +1356,9 @@ void HIRGenerator::visit(CallExpr& node) {
                 // Setup function signature: (void*, int64_t) -> int64_t
                 std::string runtimeFuncName = "nova_setTimeout";
                 std::vector<HIRTypePtr> paramTypes;
-                paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer));
-                paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));
-                auto returnType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer));
+                paramTypes.push_back(HIRType::get(HIRType::Kind::I64));
+                auto returnType = HIRType::get(HIRType::Kind::I64);
 
                 HIRFunction* runtimeFunc = nullptr;
                 auto& functions = module_->functions;
@@ -1391,9 +1395,9 @@ void HIRGenerator::visit(CallExpr& node) {
 
                 std::string runtimeFuncName = "nova_setInterval";
                 std::vector<HIRTypePtr> paramTypes;
-                paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer));
-                paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));
-                auto returnType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer));
+                paramTypes.push_back(HIRType::get(HIRType::Kind::I64));
+                auto returnType = HIRType::get(HIRType::Kind::I64);
 
                 HIRFunction* runtimeFunc = nullptr;
                 auto& functions = module_->functions;
@@ -1428,8 +1432,8 @@ void HIRGenerator::visit(CallExpr& node) {
 
                 std::string runtimeFuncName = "nova_clearTimeout";
                 std::vector<HIRTypePtr> paramTypes;
-                paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));
-                auto returnType = std::make_shared<HIRType>(HIRType::Kind::Void);
+                paramTypes.push_back(HIRType::get(HIRType::Kind::I64));
+                auto returnType = HIRType::get(HIRType::Kind::Void);
 
                 HIRFunction* runtimeFunc = nullptr;
                 auto& functions = module_->functions;
@@ -1464,8 +1468,8 @@ void HIRGenerator::visit(CallExpr& node) {
 
                 std::string runtimeFuncName = "nova_clearInterval";
                 std::vector<HIRTypePtr> paramTypes;
-                paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));
-                auto returnType = std::make_shared<HIRType>(HIRType::Kind::Void);
+                paramTypes.push_back(HIRType::get(HIRType::Kind::I64));
+                auto returnType = HIRType::get(HIRType::Kind::Void);
 
                 HIRFunction* runtimeFunc = nullptr;
                 auto& functions = module_->functions;
@@ -1500,8 +1504,8 @@ void HIRGenerator::visit(CallExpr& node) {
 
                 std::string runtimeFuncName = "nova_queueMicrotask";
                 std::vector<HIRTypePtr> paramTypes;
-                paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer));
-                auto returnType = std::make_shared<HIRType>(HIRType::Kind::Void);
+                paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer));
+                auto returnType = HIRType::get(HIRType::Kind::Void);
 
                 HIRFunction* runtimeFunc = nullptr;
                 auto& functions = module_->functions;
@@ -1536,8 +1540,8 @@ void HIRGenerator::visit(CallExpr& node) {
 
                 std::string runtimeFuncName = "nova_requestAnimationFrame";
                 std::vector<HIRTypePtr> paramTypes;
-                paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer));
-                auto returnType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer));
+                auto returnType = HIRType::get(HIRType::Kind::I64);
 
                 HIRFunction* runtimeFunc = nullptr;
                 auto& functions = module_->functions;
@@ -1572,8 +1576,8 @@ void HIRGenerator::visit(CallExpr& node) {
 
                 std::string runtimeFuncName = "nova_cancelAnimationFrame";
                 std::vector<HIRTypePtr> paramTypes;
-                paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));
-                auto returnType = std::make_shared<HIRType>(HIRType::Kind::Void);
+                paramTypes.push_back(HIRType::get(HIRType::Kind::I64));
+                auto returnType = HIRType::get(HIRType::Kind::Void);
 
                 HIRFunction* runtimeFunc = nullptr;
                 auto& functions = module_->functions;
@@ -1608,8 +1612,8 @@ void HIRGenerator::visit(CallExpr& node) {
 
                 std::string runtimeFuncName = "nova_fetch";
                 std::vector<HIRTypePtr> paramTypes;
-                paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                auto returnType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                auto returnType = HIRType::get(HIRType::Kind::Pointer);
 
                 HIRFunction* runtimeFunc = nullptr;
                 auto& functions = module_->functions;
@@ -1647,8 +1651,8 @@ void HIRGenerator::visit(CallExpr& node) {
                 // Setup function signature
                 std::string runtimeFuncName = "nova_encodeURI";
                 std::vector<HIRTypePtr> paramTypes;
-                paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                auto returnType = std::make_shared<HIRType>(HIRType::Kind::String);
+                paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                auto returnType = HIRType::get(HIRType::Kind::String);
 
                 // Find or create runtime function
                 HIRFunction* runtimeFunc = nullptr;
@@ -1688,8 +1692,8 @@ void HIRGenerator::visit(CallExpr& node) {
                 // Setup function signature
                 std::string runtimeFuncName = "nova_decodeURI";
                 std::vector<HIRTypePtr> paramTypes;
-                paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                auto returnType = std::make_shared<HIRType>(HIRType::Kind::String);
+                paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                auto returnType = HIRType::get(HIRType::Kind::String);
 
                 // Find or create runtime function
                 HIRFunction* runtimeFunc = nullptr;
@@ -1724,7 +1728,7 @@ void HIRGenerator::visit(CallExpr& node) {
                 }
 
                 // Check if argument is a string literal (compile-time constant)
-                if (auto* strLit = dynamic_cast<StringLiteral*>(node.arguments[0].get())) {
+                if (auto* strLit = ast_cast<StringLiteral>(node.arguments[0].get())) {
                     std::string code = strLit->value;
                     if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: eval() with constant string: \"" << code << "\"" << std::endl;
 
@@ -1888,8 +1892,8 @@ void HIRGenerator::visit(CallExpr& node) {
                 // Setup function signature
                 std::string runtimeFuncName = "nova_eval";
                 std::vector<HIRTypePtr> paramTypes;
-                paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                auto returnType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                auto returnType = HIRType::get(HIRType::Kind::I64);
 
                 // Find or create runtime function
                 HIRFunction* runtimeFunc = nullptr;
@@ -1941,15 +1945,15 @@ void HIRGenerator::visit(CallExpr& node) {
                      arg->type->kind == HIRType::Kind::I32 ||
                      arg->type->kind == HIRType::Kind::F64)) {
                     // Already numeric — normalize to f64.
-                    auto f64Type = std::make_shared<HIRType>(HIRType::Kind::F64);
+                    auto f64Type = HIRType::get(HIRType::Kind::F64);
                     if (arg->type->kind != HIRType::Kind::F64) {
                         lastValue_ = builder_->createCast(arg, f64Type.get(), "number.cast");
                     }
                     return;
                 }
                 auto* jsArg = toJSValue(arg);
-                auto f64Type = std::make_shared<HIRType>(HIRType::Kind::F64);
-                auto jsType = std::make_shared<HIRType>(HIRType::Kind::JSValue);
+                auto f64Type = HIRType::get(HIRType::Kind::F64);
+                auto jsType = HIRType::get(HIRType::Kind::JSValue);
                 auto existing = module_->getFunction("nova_value_to_number");
                 HIRFunction* function = existing ? existing.get() : nullptr;
                 if (!function) {
@@ -1996,8 +2000,8 @@ void HIRGenerator::visit(CallExpr& node) {
                                 auto existing = module_->getFunction(fnName);
                                 HIRFunction* fn = existing ? existing.get() : nullptr;
                                 if (!fn) {
-                                    auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                                    auto retType = std::make_shared<HIRType>(HIRType::Kind::Any);
+                                    auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                                    auto retType = HIRType::get(HIRType::Kind::Any);
                                     std::vector<HIRTypePtr> paramVec = {ptrType};
                                     HIRFunctionType* ft = new HIRFunctionType(paramVec, retType);
                                     HIRFunctionPtr created = module_->createFunction(fnName, ft);
@@ -2011,9 +2015,9 @@ void HIRGenerator::visit(CallExpr& node) {
                     }
                 }
                 auto* jsArg = toJSValue(arg);
-                auto jsType = std::make_shared<HIRType>(HIRType::Kind::JSValue);
-                auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                auto strType = std::make_shared<HIRType>(HIRType::Kind::String);
+                auto jsType = HIRType::get(HIRType::Kind::JSValue);
+                auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                auto strType = HIRType::get(HIRType::Kind::String);
                 auto existing = module_->getFunction("nova_value_to_string_alloc");
                 HIRFunction* function = existing ? existing.get() : nullptr;
                 if (!function) {
@@ -2039,7 +2043,7 @@ void HIRGenerator::visit(CallExpr& node) {
                     descArg = builder_->createIntConstant(0);  // nullptr for no description
                 }
 
-                auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                auto ptrType = HIRType::get(HIRType::Kind::Pointer);
                 std::vector<HIRTypePtr> paramTypes = {ptrType};
 
                 HIRFunction* runtimeFunc = nullptr;
@@ -2073,14 +2077,14 @@ void HIRGenerator::visit(CallExpr& node) {
 
                 // Check if argument is a string literal
                 bool isStringArg = false;
-                if (auto* strLit = dynamic_cast<StringLiteral*>(node.arguments[0].get())) {
+                if (ast_isa<StringLiteral>(node.arguments[0].get())) {
                     isStringArg = true;
                 }
 
                 std::string runtimeFuncName;
                 std::vector<HIRTypePtr> paramTypes;
-                auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                auto intType = HIRType::get(HIRType::Kind::I64);
 
                 if (isStringArg || (argValue && argValue->type && argValue->type->kind == HIRType::Kind::String)) {
                     // BigInt from string
@@ -2112,9 +2116,9 @@ void HIRGenerator::visit(CallExpr& node) {
         }
 
         // Check if this is a console method call (console.log, console.error, etc.)
-        if (auto* memberExpr = dynamic_cast<MemberExpr*>(node.callee.get())) {
-            if (auto* objIdent = dynamic_cast<Identifier*>(memberExpr->object.get())) {
-                if (auto* propIdent = dynamic_cast<Identifier*>(memberExpr->property.get())) {
+        if (auto* memberExpr = ast_cast<MemberExpr>(node.callee.get())) {
+            if (auto* objIdent = ast_cast<Identifier>(memberExpr->object.get())) {
+                if (auto* propIdent = ast_cast<Identifier>(memberExpr->property.get())) {
                     if (objIdent->name == "console") {
                         if (propIdent->name == "clear") {
                             // console.clear() - clears the console (no arguments)
@@ -2122,7 +2126,7 @@ void HIRGenerator::visit(CallExpr& node) {
 
                             std::string runtimeFuncName = "nova_console_clear";
                             std::vector<HIRTypePtr> paramTypes; // No parameters
-                            auto returnType = std::make_shared<HIRType>(HIRType::Kind::Void);
+                            auto returnType = HIRType::get(HIRType::Kind::Void);
 
                             // Find or create runtime function
                             HIRFunction* runtimeFunc = nullptr;
@@ -2166,8 +2170,8 @@ void HIRGenerator::visit(CallExpr& node) {
 
                             // Setup function signature (string parameter)
                             std::vector<HIRTypePtr> paramTypes;
-                            paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                            auto returnType = std::make_shared<HIRType>(HIRType::Kind::Void);
+                            paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                            auto returnType = HIRType::get(HIRType::Kind::Void);
 
                             // Find or create runtime function
                             HIRFunction* runtimeFunc = nullptr;
@@ -2212,9 +2216,9 @@ void HIRGenerator::visit(CallExpr& node) {
                             // Setup function signature (condition and message)
                             std::string runtimeFuncName = "nova_console_assert";
                             std::vector<HIRTypePtr> paramTypes;
-                            paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));    // Condition
-                            paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String)); // Message
-                            auto returnType = std::make_shared<HIRType>(HIRType::Kind::Void);
+                            paramTypes.push_back(HIRType::get(HIRType::Kind::I64));    // Condition
+                            paramTypes.push_back(HIRType::get(HIRType::Kind::String)); // Message
+                            auto returnType = HIRType::get(HIRType::Kind::Void);
 
                             // Find or create runtime function
                             HIRFunction* runtimeFunc = nullptr;
@@ -2258,8 +2262,8 @@ void HIRGenerator::visit(CallExpr& node) {
 
                             // Setup function signature (string parameter)
                             std::vector<HIRTypePtr> paramTypes;
-                            paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                            auto returnType = std::make_shared<HIRType>(HIRType::Kind::Void);
+                            paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                            auto returnType = HIRType::get(HIRType::Kind::Void);
 
                             // Find or create runtime function
                             HIRFunction* runtimeFunc = nullptr;
@@ -2300,8 +2304,8 @@ void HIRGenerator::visit(CallExpr& node) {
                             // Setup function signature (pointer to ValueArray)
                             std::string runtimeFuncName = "nova_console_table_array";
                             std::vector<HIRTypePtr> paramTypes;
-                            paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer));  // ValueArray* pointer
-                            auto returnType = std::make_shared<HIRType>(HIRType::Kind::Void);
+                            paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer));  // ValueArray* pointer
+                            auto returnType = HIRType::get(HIRType::Kind::Void);
 
                             // Find or create runtime function
                             HIRFunction* runtimeFunc = nullptr;
@@ -2340,7 +2344,7 @@ void HIRGenerator::visit(CallExpr& node) {
                                     auto* labelArg = lastValue_;
 
                                     runtimeFuncName = "nova_console_group_string";
-                                    paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
+                                    paramTypes.push_back(HIRType::get(HIRType::Kind::String));
 
                                     // Find or create runtime function
                                     HIRFunction* runtimeFunc = nullptr;
@@ -2353,7 +2357,7 @@ void HIRGenerator::visit(CallExpr& node) {
                                     }
 
                                     if (!runtimeFunc) {
-                                        HIRFunctionType* funcType = new HIRFunctionType(paramTypes, std::make_shared<HIRType>(HIRType::Kind::Void));
+                                        HIRFunctionType* funcType = new HIRFunctionType(paramTypes, HIRType::get(HIRType::Kind::Void));
                                         HIRFunctionPtr funcPtr = module_->createFunction(runtimeFuncName, funcType);
                                         funcPtr->linkage = HIRFunction::Linkage::External;
                                         runtimeFunc = funcPtr.get();
@@ -2373,7 +2377,7 @@ void HIRGenerator::visit(CallExpr& node) {
                             }
 
                             // Setup function signature for no-argument versions
-                            auto returnType = std::make_shared<HIRType>(HIRType::Kind::Void);
+                            auto returnType = HIRType::get(HIRType::Kind::Void);
 
                             // Find or create runtime function
                             HIRFunction* runtimeFunc = nullptr;
@@ -2410,7 +2414,7 @@ void HIRGenerator::visit(CallExpr& node) {
                                 auto* messageArg = lastValue_;
 
                                 runtimeFuncName = "nova_console_trace_string";
-                                paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
+                                paramTypes.push_back(HIRType::get(HIRType::Kind::String));
 
                                 // Find or create runtime function
                                 HIRFunction* runtimeFunc = nullptr;
@@ -2423,7 +2427,7 @@ void HIRGenerator::visit(CallExpr& node) {
                                 }
 
                                 if (!runtimeFunc) {
-                                    HIRFunctionType* funcType = new HIRFunctionType(paramTypes, std::make_shared<HIRType>(HIRType::Kind::Void));
+                                    HIRFunctionType* funcType = new HIRFunctionType(paramTypes, HIRType::get(HIRType::Kind::Void));
                                     HIRFunctionPtr funcPtr = module_->createFunction(runtimeFuncName, funcType);
                                     funcPtr->linkage = HIRFunction::Linkage::External;
                                     runtimeFunc = funcPtr.get();
@@ -2448,7 +2452,7 @@ void HIRGenerator::visit(CallExpr& node) {
                                 }
 
                                 if (!runtimeFunc) {
-                                    HIRFunctionType* funcType = new HIRFunctionType(paramTypes, std::make_shared<HIRType>(HIRType::Kind::Void));
+                                    HIRFunctionType* funcType = new HIRFunctionType(paramTypes, HIRType::get(HIRType::Kind::Void));
                                     HIRFunctionPtr funcPtr = module_->createFunction(runtimeFuncName, funcType);
                                     funcPtr->linkage = HIRFunction::Linkage::External;
                                     runtimeFunc = funcPtr.get();
@@ -2482,18 +2486,18 @@ void HIRGenerator::visit(CallExpr& node) {
 
                             if (isString) {
                                 runtimeFuncName = "nova_console_dir_string";
-                                paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
+                                paramTypes.push_back(HIRType::get(HIRType::Kind::String));
                             } else if (isPointer) {
                                 // Pointer type (could be array, object, etc.)
                                 runtimeFuncName = "nova_console_dir_array";
-                                paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer));
+                                paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer));
                             } else {
                                 // Number or other primitive type
                                 runtimeFuncName = "nova_console_dir_number";
-                                paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));
+                                paramTypes.push_back(HIRType::get(HIRType::Kind::I64));
                             }
 
-                            auto returnType = std::make_shared<HIRType>(HIRType::Kind::Void);
+                            auto returnType = HIRType::get(HIRType::Kind::Void);
 
                             // Find or create runtime function
                             HIRFunction* runtimeFunc = nullptr;
@@ -2528,8 +2532,8 @@ void HIRGenerator::visit(CallExpr& node) {
                                 // No arguments - just print a newline
                                 std::string runtimeFuncName = "nova_console_log_string";
                                 std::vector<HIRTypePtr> paramTypes;
-                                paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                                auto returnType = std::make_shared<HIRType>(HIRType::Kind::Void);
+                                paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                                auto returnType = HIRType::get(HIRType::Kind::Void);
 
                                 HIRFunction* runtimeFunc = nullptr;
                                 auto& functions = module_->functions;
@@ -2668,19 +2672,19 @@ void HIRGenerator::visit(CallExpr& node) {
 
                                 // Setup function signature based on argument type
                                 if (isString) {
-                                    paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
+                                    paramTypes.push_back(HIRType::get(HIRType::Kind::String));
                                 } else if (isPointer) {
-                                    paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer));
+                                    paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer));
                                 } else if (isBool) {
-                                    paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Bool));
+                                    paramTypes.push_back(HIRType::get(HIRType::Kind::Bool));
                                 } else if (isDouble) {
-                                    paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::F64));
+                                    paramTypes.push_back(HIRType::get(HIRType::Kind::F64));
                                 } else if (isJSValue) {
-                                    paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::JSValue));
+                                    paramTypes.push_back(HIRType::get(HIRType::Kind::JSValue));
                                 } else {
-                                    paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));
+                                    paramTypes.push_back(HIRType::get(HIRType::Kind::I64));
                                 }
-                                auto returnType = std::make_shared<HIRType>(HIRType::Kind::Void);
+                                auto returnType = HIRType::get(HIRType::Kind::Void);
 
                                 // Find or create runtime function
                                 HIRFunction* runtimeFunc = nullptr;
@@ -2713,7 +2717,7 @@ void HIRGenerator::visit(CallExpr& node) {
 
                                     if (!spaceFuncPtr) {
                                         std::vector<HIRTypePtr> emptyParams;
-                                        auto voidType = std::make_shared<HIRType>(HIRType::Kind::Void);
+                                        auto voidType = HIRType::get(HIRType::Kind::Void);
                                         HIRFunctionType* spaceFuncType = new HIRFunctionType(emptyParams, voidType);
                                         HIRFunctionPtr spacePtr = module_->createFunction(spaceFunc, spaceFuncType);
                                         spacePtr->linkage = HIRFunction::Linkage::External;
@@ -2752,7 +2756,7 @@ void HIRGenerator::visit(CallExpr& node) {
                             // Create if doesn't exist
                             if (!newlineFuncPtr) {
                                 std::vector<HIRTypePtr> params;
-                                auto voidType = std::make_shared<HIRType>(HIRType::Kind::Void);
+                                auto voidType = HIRType::get(HIRType::Kind::Void);
                                 HIRFunctionType* funcType = new HIRFunctionType(params, voidType);
                                 HIRFunctionPtr funcPtr = module_->createFunction(newlineFunc, funcType);
                                 funcPtr->linkage = HIRFunction::Linkage::External;
@@ -2771,9 +2775,9 @@ void HIRGenerator::visit(CallExpr& node) {
         }
 
         // Check if this is a Math.abs() call
-        if (auto* memberExpr = dynamic_cast<MemberExpr*>(node.callee.get())) {
-            if (auto* objIdent = dynamic_cast<Identifier*>(memberExpr->object.get())) {
-                if (auto* propIdent = dynamic_cast<Identifier*>(memberExpr->property.get())) {
+        if (auto* memberExpr = ast_cast<MemberExpr>(node.callee.get())) {
+            if (auto* objIdent = ast_cast<Identifier>(memberExpr->object.get())) {
+                if (auto* propIdent = ast_cast<Identifier>(memberExpr->property.get())) {
                     if (objIdent->name == "Math" && propIdent->name == "abs") {
                         // Generate inline absolute value: abs(x) = (x < 0) ? -x : x
                         if (node.arguments.size() != 1) {
@@ -3079,8 +3083,8 @@ void HIRGenerator::visit(CallExpr& node) {
                         }
 
                         // Float input: call nova_math_trunc(double) -> i64
-                        std::vector<HIRTypePtr> paramTypes = {std::make_shared<HIRType>(HIRType::Kind::F64)};
-                        auto returnType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        std::vector<HIRTypePtr> paramTypes = {HIRType::get(HIRType::Kind::F64)};
+                        auto returnType = HIRType::get(HIRType::Kind::I64);
                         HIRFunction* runtimeFunc = nullptr;
                         for (auto& func : module_->functions) {
                             if (func->name == "nova_math_trunc") {
@@ -3117,8 +3121,8 @@ void HIRGenerator::visit(CallExpr& node) {
                         }
 
                         // Float input: call nova_math_round(double) -> i64
-                        std::vector<HIRTypePtr> paramTypes = {std::make_shared<HIRType>(HIRType::Kind::F64)};
-                        auto returnType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        std::vector<HIRTypePtr> paramTypes = {HIRType::get(HIRType::Kind::F64)};
+                        auto returnType = HIRType::get(HIRType::Kind::I64);
                         HIRFunction* runtimeFunc = nullptr;
                         for (auto& func : module_->functions) {
                             if (func->name == "nova_math_round") {
@@ -3153,8 +3157,8 @@ void HIRGenerator::visit(CallExpr& node) {
                             return;
                         }
 
-                        std::vector<HIRTypePtr> paramTypes = {std::make_shared<HIRType>(HIRType::Kind::F64)};
-                        auto returnType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        std::vector<HIRTypePtr> paramTypes = {HIRType::get(HIRType::Kind::F64)};
+                        auto returnType = HIRType::get(HIRType::Kind::I64);
                         HIRFunction* runtimeFunc = nullptr;
                         for (auto& func : module_->functions) {
                             if (func->name == "nova_math_floor") {
@@ -3189,8 +3193,8 @@ void HIRGenerator::visit(CallExpr& node) {
                             return;
                         }
 
-                        std::vector<HIRTypePtr> paramTypes = {std::make_shared<HIRType>(HIRType::Kind::F64)};
-                        auto returnType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        std::vector<HIRTypePtr> paramTypes = {HIRType::get(HIRType::Kind::F64)};
+                        auto returnType = HIRType::get(HIRType::Kind::I64);
                         HIRFunction* runtimeFunc = nullptr;
                         for (auto& func : module_->functions) {
                             if (func->name == "nova_math_ceil") {
@@ -3232,8 +3236,8 @@ void HIRGenerator::visit(CallExpr& node) {
                         }
 
                         // Declare and call C library sqrt(double) -> double
-                        std::vector<HIRTypePtr> paramTypes = {std::make_shared<HIRType>(HIRType::Kind::F64)};
-                        auto returnType = std::make_shared<HIRType>(HIRType::Kind::F64);
+                        std::vector<HIRTypePtr> paramTypes = {HIRType::get(HIRType::Kind::F64)};
+                        auto returnType = HIRType::get(HIRType::Kind::F64);
                         HIRFunction* runtimeFunc = nullptr;
                         for (auto& func : module_->functions) {
                             if (func->name == "sqrt") {
@@ -3284,9 +3288,9 @@ void HIRGenerator::visit(CallExpr& node) {
                             }
 
                             std::vector<HIRTypePtr> paramTypes = {
-                                std::make_shared<HIRType>(HIRType::Kind::F64)
+                                HIRType::get(HIRType::Kind::F64)
                             };
-                            auto returnType = std::make_shared<HIRType>(HIRType::Kind::F64);
+                            auto returnType = HIRType::get(HIRType::Kind::F64);
 
                             HIRFunction* runtimeFunc = module_->getFunction(propIdent->name).get();
                             if (!runtimeFunc) {
@@ -3329,10 +3333,10 @@ void HIRGenerator::visit(CallExpr& node) {
                         };
 
                         std::vector<HIRTypePtr> paramTypes = {
-                            std::make_shared<HIRType>(HIRType::Kind::F64),
-                            std::make_shared<HIRType>(HIRType::Kind::F64)
+                            HIRType::get(HIRType::Kind::F64),
+                            HIRType::get(HIRType::Kind::F64)
                         };
-                        auto returnType = std::make_shared<HIRType>(HIRType::Kind::F64);
+                        auto returnType = HIRType::get(HIRType::Kind::F64);
 
                         HIRFunction* runtimeFunc = module_->getFunction("atan2").get();
                         if (!runtimeFunc) {
@@ -3380,9 +3384,9 @@ void HIRGenerator::visit(CallExpr& node) {
 
                         // Call C sqrt() on the f64 sum-of-squares.
                         std::vector<HIRTypePtr> paramTypes = {
-                            std::make_shared<HIRType>(HIRType::Kind::F64)
+                            HIRType::get(HIRType::Kind::F64)
                         };
-                        auto returnType = std::make_shared<HIRType>(HIRType::Kind::F64);
+                        auto returnType = HIRType::get(HIRType::Kind::F64);
                         HIRFunction* sqrtFunc = module_->getFunction("sqrt").get();
                         if (!sqrtFunc) {
                             HIRFunctionType* funcType = new HIRFunctionType(paramTypes, returnType);
@@ -3408,9 +3412,9 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Setup runtime function
                         std::string runtimeFuncName = "nova_math_min";
                         std::vector<HIRTypePtr> paramTypes;
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));
-                        auto returnType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::I64));
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::I64));
+                        auto returnType = HIRType::get(HIRType::Kind::I64);
 
                         HIRFunction* runtimeFunc = nullptr;
                         auto& functions = module_->functions;
@@ -3441,7 +3445,7 @@ void HIRGenerator::visit(CallExpr& node) {
                         }
 
                         // Inline: min(a, b) = a < b ? a : b
-                        auto i64Type = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        auto i64Type = HIRType::get(HIRType::Kind::I64);
                         auto* resultAlloca = builder_->createAlloca(i64Type.get(), "min_result");
                         auto* accValue = argValues[0];
 
@@ -3486,9 +3490,9 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Setup runtime function (kept for backward compat)
                         std::string runtimeFuncName = "nova_math_max";
                         std::vector<HIRTypePtr> paramTypes;
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));
-                        auto returnType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::I64));
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::I64));
+                        auto returnType = HIRType::get(HIRType::Kind::I64);
                         HIRFunction* runtimeFunc = nullptr;
                         for (auto& func : module_->functions) {
                             if (func->name == runtimeFuncName) {
@@ -3516,7 +3520,7 @@ void HIRGenerator::visit(CallExpr& node) {
                         }
 
                         // Inline: max(a, b) = a > b ? a : b
-                        auto i64Type = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        auto i64Type = HIRType::get(HIRType::Kind::I64);
                         auto* resultAlloca = builder_->createAlloca(i64Type.get(), "max_result");
                         auto* accValue = argValues[0];
 
@@ -3572,7 +3576,7 @@ void HIRGenerator::visit(CallExpr& node) {
                                     return existing.get();
                                 }
 
-                                auto returnType = std::make_shared<HIRType>(HIRType::Kind::String);
+                                auto returnType = HIRType::get(HIRType::Kind::String);
                                 HIRFunctionType* functionType = new HIRFunctionType(params, returnType);
                                 HIRFunctionPtr function = module_->createFunction(name, functionType);
                                 function->linkage = HIRFunction::Linkage::External;
@@ -3581,20 +3585,20 @@ void HIRGenerator::visit(CallExpr& node) {
 
                             auto callRuntimeStringify = [&](HIRValue* field) -> HIRValue* {
                                 std::string functionName = "nova_json_stringify_number";
-                                HIRTypePtr parameterType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                                HIRTypePtr parameterType = HIRType::get(HIRType::Kind::I64);
 
                                 if (field && field->type) {
                                     if (field->type->kind == HIRType::Kind::String) {
                                         functionName = "nova_json_stringify_string";
-                                        parameterType = std::make_shared<HIRType>(HIRType::Kind::String);
+                                        parameterType = HIRType::get(HIRType::Kind::String);
                                     } else if (field->type->kind == HIRType::Kind::Bool) {
                                         functionName = "nova_json_stringify_bool";
                                     } else if (field->type->kind == HIRType::Kind::F64 ||
                                                field->type->kind == HIRType::Kind::F32) {
                                         functionName = "nova_json_stringify_float";
-                                        parameterType = std::make_shared<HIRType>(HIRType::Kind::F64);
+                                        parameterType = HIRType::get(HIRType::Kind::F64);
                                     } else if (field->type->kind == HIRType::Kind::Pointer) {
-                                        parameterType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                                        parameterType = HIRType::get(HIRType::Kind::Pointer);
                                         if (getStaticArrayType(field)) {
                                             functionName = "nova_json_stringify_array";
                                         } else {
@@ -3660,27 +3664,27 @@ void HIRGenerator::visit(CallExpr& node) {
 
                         std::string runtimeFuncName;
                         std::vector<HIRTypePtr> paramTypes;
-                        auto returnType = std::make_shared<HIRType>(HIRType::Kind::String);
+                        auto returnType = HIRType::get(HIRType::Kind::String);
 
                         if (isString) {
                             runtimeFuncName = "nova_json_stringify_string";
-                            paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
+                            paramTypes.push_back(HIRType::get(HIRType::Kind::String));
                             if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: JSON.stringify() with string argument" << std::endl;
                         } else if (isBool) {
                             runtimeFuncName = "nova_json_stringify_bool";
-                            paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));
+                            paramTypes.push_back(HIRType::get(HIRType::Kind::I64));
                             if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: JSON.stringify() with boolean argument" << std::endl;
                         } else if (isPointer) {
                             runtimeFuncName = "nova_json_stringify_array";
-                            paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer));
+                            paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer));
                             if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: JSON.stringify() with array/object argument" << std::endl;
                         } else if (isFloat) {
                             runtimeFuncName = "nova_json_stringify_float";
-                            paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::F64));
+                            paramTypes.push_back(HIRType::get(HIRType::Kind::F64));
                             if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: JSON.stringify() with float argument" << std::endl;
                         } else {
                             runtimeFuncName = "nova_json_stringify_number";
-                            paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));
+                            paramTypes.push_back(HIRType::get(HIRType::Kind::I64));
                             if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: JSON.stringify() with number argument" << std::endl;
                         }
 
@@ -3721,7 +3725,7 @@ void HIRGenerator::visit(CallExpr& node) {
                         node.arguments[0]->accept(*this);
                         auto* textArg = lastValue_;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
                         std::vector<HIRTypePtr> paramTypes = {ptrType};
 
                         HIRFunction* func = nullptr;
@@ -3757,8 +3761,8 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Create call to sinh() C library function
                         std::string runtimeFuncName = "sinh";
                         std::vector<HIRTypePtr> paramTypes;
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));
-                        auto returnType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::I64));
+                        auto returnType = HIRType::get(HIRType::Kind::I64);
 
                         // Find or create runtime function
                         HIRFunction* runtimeFunc = nullptr;
@@ -3800,8 +3804,8 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Create call to cosh() C library function
                         std::string runtimeFuncName = "cosh";
                         std::vector<HIRTypePtr> paramTypes;
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));
-                        auto returnType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::I64));
+                        auto returnType = HIRType::get(HIRType::Kind::I64);
 
                         // Find or create runtime function
                         HIRFunction* runtimeFunc = nullptr;
@@ -3843,8 +3847,8 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Create call to tanh() C library function
                         std::string runtimeFuncName = "tanh";
                         std::vector<HIRTypePtr> paramTypes;
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));
-                        auto returnType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::I64));
+                        auto returnType = HIRType::get(HIRType::Kind::I64);
 
                         // Find or create runtime function
                         HIRFunction* runtimeFunc = nullptr;
@@ -3886,8 +3890,8 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Create call to asinh() C library function
                         std::string runtimeFuncName = "asinh";
                         std::vector<HIRTypePtr> paramTypes;
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));
-                        auto returnType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::I64));
+                        auto returnType = HIRType::get(HIRType::Kind::I64);
 
                         // Find or create runtime function
                         HIRFunction* runtimeFunc = nullptr;
@@ -3929,8 +3933,8 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Create call to acosh() C library function
                         std::string runtimeFuncName = "acosh";
                         std::vector<HIRTypePtr> paramTypes;
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));
-                        auto returnType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::I64));
+                        auto returnType = HIRType::get(HIRType::Kind::I64);
 
                         // Find or create runtime function
                         HIRFunction* runtimeFunc = nullptr;
@@ -3972,8 +3976,8 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Create call to atanh() C library function
                         std::string runtimeFuncName = "atanh";
                         std::vector<HIRTypePtr> paramTypes;
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));
-                        auto returnType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::I64));
+                        auto returnType = HIRType::get(HIRType::Kind::I64);
 
                         // Find or create runtime function
                         HIRFunction* runtimeFunc = nullptr;
@@ -4015,8 +4019,8 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Create call to expm1() C library function
                         std::string runtimeFuncName = "expm1";
                         std::vector<HIRTypePtr> paramTypes;
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));
-                        auto returnType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::I64));
+                        auto returnType = HIRType::get(HIRType::Kind::I64);
 
                         // Find or create runtime function
                         HIRFunction* runtimeFunc = nullptr;
@@ -4058,8 +4062,8 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Create call to log1p() C library function
                         std::string runtimeFuncName = "log1p";
                         std::vector<HIRTypePtr> paramTypes;
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));
-                        auto returnType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::I64));
+                        auto returnType = HIRType::get(HIRType::Kind::I64);
 
                         // Find or create runtime function
                         HIRFunction* runtimeFunc = nullptr;
@@ -4295,7 +4299,7 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Create call to nova_random() runtime function
                         std::string runtimeFuncName = "nova_random";
                         std::vector<HIRTypePtr> paramTypes;  // No parameters
-                        auto returnType = std::make_shared<HIRType>(HIRType::Kind::F64);
+                        auto returnType = HIRType::get(HIRType::Kind::F64);
 
                         // Find or create runtime function
                         HIRFunction* runtimeFunc = nullptr;
@@ -4427,9 +4431,9 @@ void HIRGenerator::visit(CallExpr& node) {
         }
 
         // Check if this is Array.isArray() call
-        if (auto* memberExpr = dynamic_cast<MemberExpr*>(node.callee.get())) {
-            if (auto* objIdent = dynamic_cast<Identifier*>(memberExpr->object.get())) {
-                if (auto* propIdent = dynamic_cast<Identifier*>(memberExpr->property.get())) {
+        if (auto* memberExpr = ast_cast<MemberExpr>(node.callee.get())) {
+            if (auto* objIdent = ast_cast<Identifier>(memberExpr->object.get())) {
+                if (auto* propIdent = ast_cast<Identifier>(memberExpr->property.get())) {
                     if (objIdent->name == "Array" && propIdent->name == "isArray") {
                         // Array.isArray() - compile-time type check
                         if (node.arguments.size() != 1) {
@@ -4503,7 +4507,7 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Setup function signature based on whether we have a mapper
                         bool usesIteratorProtocol = false;
                         if (auto* sourceIdent =
-                                dynamic_cast<Identifier*>(node.arguments[0].get())) {
+                                ast_cast<Identifier>(node.arguments[0].get())) {
                             usesIteratorProtocol =
                                 dynamicObjectVars_.count(sourceIdent->name) > 0 &&
                                 runtimeArrayVars_.count(sourceIdent->name) == 0 &&
@@ -4516,15 +4520,15 @@ void HIRGenerator::visit(CallExpr& node) {
                                     ? "nova_array_from_map"
                                     : "nova_array_from");
                         std::vector<HIRTypePtr> paramTypes;
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // array pointer
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // array pointer
 
                         if (hasMapperFn) {
                             // Add function pointer parameter: (i64, i64) -> i64
-                            paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // function pointer
+                            paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // function pointer
                         }
 
                         // Return type: pointer to array of i64
-                        auto elementType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        auto elementType = HIRType::get(HIRType::Kind::I64);
                         auto arrayType = std::make_shared<HIRArrayType>(elementType, 0);
                         auto returnType = std::make_shared<HIRPointerType>(arrayType, true);
 
@@ -4571,14 +4575,14 @@ void HIRGenerator::visit(CallExpr& node) {
                         // nova_array_of takes count and then elements as varargs
                         std::string runtimeFuncName = "nova_array_of";
                         std::vector<HIRTypePtr> paramTypes;
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64)); // count
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::I64)); // count
                         // Add parameter type for each element
                         for (size_t i = 0; i < elementValues.size(); i++) {
-                            paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));
+                            paramTypes.push_back(HIRType::get(HIRType::Kind::I64));
                         }
 
                         // Return type: pointer to array of i64
-                        auto elementType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        auto elementType = HIRType::get(HIRType::Kind::I64);
                         auto arrayType = std::make_shared<HIRArrayType>(elementType, 0);
                         auto returnType = std::make_shared<HIRPointerType>(arrayType, true);
 
@@ -4644,8 +4648,8 @@ void HIRGenerator::visit(CallExpr& node) {
                         else if (objIdent->name == "BigUint64Array") runtimeFuncName = "nova_biguint64array_from";
                         else runtimeFuncName = "nova_int32array_from";  // default
 
-                        std::vector<HIRTypePtr> paramTypes = {std::make_shared<HIRType>(HIRType::Kind::Pointer)};
-                        auto returnType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                        std::vector<HIRTypePtr> paramTypes = {HIRType::get(HIRType::Kind::Pointer)};
+                        auto returnType = HIRType::get(HIRType::Kind::Pointer);
 
                         HIRFunction* runtimeFunc = nullptr;
                         auto existingFunc = module_->getFunction(runtimeFuncName);
@@ -4690,11 +4694,11 @@ void HIRGenerator::visit(CallExpr& node) {
 
                         // Parameters: count + up to 8 values
                         std::vector<HIRTypePtr> paramTypes;
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));  // count
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::I64));  // count
                         for (int i = 0; i < 8; i++) {
-                            paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));
+                            paramTypes.push_back(HIRType::get(HIRType::Kind::I64));
                         }
-                        auto returnType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                        auto returnType = HIRType::get(HIRType::Kind::Pointer);
 
                         HIRFunction* runtimeFunc = nullptr;
                         auto existingFunc = module_->getFunction(runtimeFuncName);
@@ -4727,9 +4731,9 @@ void HIRGenerator::visit(CallExpr& node) {
         }
 
         // Check if this is Number static method call
-        if (auto* memberExpr = dynamic_cast<MemberExpr*>(node.callee.get())) {
-            if (auto* objIdent = dynamic_cast<Identifier*>(memberExpr->object.get())) {
-                if (auto* propIdent = dynamic_cast<Identifier*>(memberExpr->property.get())) {
+        if (auto* memberExpr = ast_cast<MemberExpr>(node.callee.get())) {
+            if (auto* objIdent = ast_cast<Identifier>(memberExpr->object.get())) {
+                if (auto* propIdent = ast_cast<Identifier>(memberExpr->property.get())) {
                     if (objIdent->name == "Number") {
                         if (propIdent->name == "isNaN" ||
                             propIdent->name == "isInteger" ||
@@ -4762,8 +4766,8 @@ void HIRGenerator::visit(CallExpr& node) {
                             HIRFunction* runtimeFunc = existingFunc
                                 ? existingFunc.get() : nullptr;
                             if (!runtimeFunc) {
-                                auto floatType = std::make_shared<HIRType>(HIRType::Kind::F64);
-                                auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                                auto floatType = HIRType::get(HIRType::Kind::F64);
+                                auto intType = HIRType::get(HIRType::Kind::I64);
                                 HIRFunctionType* funcType = new HIRFunctionType(
                                     {floatType}, intType);
                                 HIRFunctionPtr funcPtr = module_->createFunction(
@@ -4793,9 +4797,9 @@ void HIRGenerator::visit(CallExpr& node) {
                             // Setup function signature
                             std::string runtimeFuncName = "nova_number_parseInt";
                             std::vector<HIRTypePtr> paramTypes;
-                            paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                            paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));
-                            auto returnType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                            paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                            paramTypes.push_back(HIRType::get(HIRType::Kind::I64));
+                            auto returnType = HIRType::get(HIRType::Kind::I64);
 
                             // Find or create runtime function
                             HIRFunction* runtimeFunc = nullptr;
@@ -4835,8 +4839,8 @@ void HIRGenerator::visit(CallExpr& node) {
                             // Setup function signature
                             std::string runtimeFuncName = "nova_number_parseFloat";
                             std::vector<HIRTypePtr> paramTypes;
-                            paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                            auto returnType = std::make_shared<HIRType>(HIRType::Kind::F64);
+                            paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                            auto returnType = HIRType::get(HIRType::Kind::F64);
 
                             // Find or create runtime function
                             HIRFunction* runtimeFunc = nullptr;
@@ -4867,9 +4871,9 @@ void HIRGenerator::visit(CallExpr& node) {
         }
 
         // Check if this is String static method call (e.g., String.fromCharCode())
-        if (auto* memberExpr = dynamic_cast<MemberExpr*>(node.callee.get())) {
-            if (auto* objIdent = dynamic_cast<Identifier*>(memberExpr->object.get())) {
-                if (auto* propIdent = dynamic_cast<Identifier*>(memberExpr->property.get())) {
+        if (auto* memberExpr = ast_cast<MemberExpr>(node.callee.get())) {
+            if (auto* objIdent = ast_cast<Identifier>(memberExpr->object.get())) {
+                if (auto* propIdent = ast_cast<Identifier>(memberExpr->property.get())) {
                     if (objIdent->name == "String" && propIdent->name == "fromCharCode") {
                         // String.fromCharCode(...codes) — concat char(s) from each code.
                         // JS spec accepts any number of arguments; we build a string
@@ -4884,8 +4888,8 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Setup function signature for the per-code runtime helper.
                         std::string runtimeFuncName = "nova_string_fromCharCode";
                         std::vector<HIRTypePtr> paramTypes;
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));
-                        auto returnType = std::make_shared<HIRType>(HIRType::Kind::String);
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::I64));
+                        auto returnType = HIRType::get(HIRType::Kind::String);
 
                         HIRFunction* runtimeFunc = nullptr;
                         auto& functions = module_->functions;
@@ -4913,8 +4917,8 @@ void HIRGenerator::visit(CallExpr& node) {
                         }
                         if (!concatFunc) {
                             std::vector<HIRTypePtr> concatParams;
-                            concatParams.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                            concatParams.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
+                            concatParams.push_back(HIRType::get(HIRType::Kind::String));
+                            concatParams.push_back(HIRType::get(HIRType::Kind::String));
                             HIRFunctionType* concatType = new HIRFunctionType(concatParams, returnType);
                             HIRFunctionPtr concatPtr = module_->createFunction(concatName, concatType);
                             concatPtr->linkage = HIRFunction::Linkage::External;
@@ -4957,8 +4961,8 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Setup function signature
                         std::string runtimeFuncName = "nova_string_fromCodePoint";
                         std::vector<HIRTypePtr> paramTypes;
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));
-                        auto returnType = std::make_shared<HIRType>(HIRType::Kind::String);
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::I64));
+                        auto returnType = HIRType::get(HIRType::Kind::String);
 
                         // Find or create runtime function
                         HIRFunction* runtimeFunc = nullptr;
@@ -4991,9 +4995,9 @@ void HIRGenerator::visit(CallExpr& node) {
                         // which are handled at compile time. For direct calls, return empty string.
                         std::string runtimeFuncName = "nova_string_raw";
                         std::vector<HIRTypePtr> paramTypes;
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Any));  // strings array
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Any));  // substitutions
-                        auto returnType = std::make_shared<HIRType>(HIRType::Kind::String);
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Any));  // strings array
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Any));  // substitutions
+                        auto returnType = HIRType::get(HIRType::Kind::String);
 
                         // Find or create runtime function
                         HIRFunction* runtimeFunc = nullptr;
@@ -5033,7 +5037,7 @@ void HIRGenerator::visit(CallExpr& node) {
                             keyArg = builder_->createStringConstant("");
                         }
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
                         std::vector<HIRTypePtr> paramTypes = {ptrType};
 
                         HIRFunction* runtimeFunc = nullptr;
@@ -5065,8 +5069,8 @@ void HIRGenerator::visit(CallExpr& node) {
                             symArg = builder_->createIntConstant(0);
                         }
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                        auto strType = std::make_shared<HIRType>(HIRType::Kind::String);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                        auto strType = HIRType::get(HIRType::Kind::String);
                         std::vector<HIRTypePtr> paramTypes = {ptrType};
 
                         HIRFunction* runtimeFunc = nullptr;
@@ -5105,7 +5109,7 @@ void HIRGenerator::visit(CallExpr& node) {
                             std::vector<HIRValue*> values;
                             values.reserve(structType->fields.size());
                             auto* sourceIdentifier =
-                                dynamic_cast<Identifier*>(node.arguments[0].get());
+                                ast_cast<Identifier>(node.arguments[0].get());
                             for (size_t i = 0; i < structType->fields.size(); ++i) {
                                 if (sourceIdentifier) {
                                     auto objectAttributes =
@@ -5129,10 +5133,10 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Setup function signature
                         std::string runtimeFuncName = "nova_object_values";
                         std::vector<HIRTypePtr> paramTypes;
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // object pointer
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // object pointer
 
                         // Return type is array (pointer to array)
-                        auto elementType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        auto elementType = HIRType::get(HIRType::Kind::I64);
                         auto arrayType = std::make_shared<HIRArrayType>(elementType, 0);
                         auto returnType = std::make_shared<HIRPointerType>(arrayType, true);
 
@@ -5177,7 +5181,7 @@ void HIRGenerator::visit(CallExpr& node) {
                             std::vector<HIRValue*> keys;
                             keys.reserve(structType->fields.size());
                             auto* sourceIdentifier =
-                                dynamic_cast<Identifier*>(node.arguments[0].get());
+                                ast_cast<Identifier>(node.arguments[0].get());
                             for (const auto& field : structType->fields) {
                                 if (sourceIdentifier) {
                                     auto objectAttributes =
@@ -5200,11 +5204,11 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Setup function signature
                         std::string runtimeFuncName = "nova_object_keys";
                         std::vector<HIRTypePtr> paramTypes;
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // object pointer
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // object pointer
 
                         // Return type is array (pointer to array)
                         // Object.keys returns array of strings (property names)
-                        auto elementType = std::make_shared<HIRType>(HIRType::Kind::String);
+                        auto elementType = HIRType::get(HIRType::Kind::String);
                         auto arrayType = std::make_shared<HIRArrayType>(elementType, 0);
                         auto returnType = std::make_shared<HIRPointerType>(arrayType, true);
 
@@ -5251,7 +5255,7 @@ void HIRGenerator::visit(CallExpr& node) {
                             std::vector<HIRValue*> entries;
                             entries.reserve(structType->fields.size());
                             auto* sourceIdentifier =
-                                dynamic_cast<Identifier*>(node.arguments[0].get());
+                                ast_cast<Identifier>(node.arguments[0].get());
                             for (size_t i = 0; i < structType->fields.size(); ++i) {
                                 if (sourceIdentifier) {
                                     auto objectAttributes =
@@ -5278,11 +5282,11 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Setup function signature
                         std::string runtimeFuncName = "nova_object_entries";
                         std::vector<HIRTypePtr> paramTypes;
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // object pointer
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // object pointer
 
                         // Return type is array of arrays (array of [key, value] pairs)
                         // For simplicity, return array of int64 (will store pointers to sub-arrays)
-                        auto elementType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        auto elementType = HIRType::get(HIRType::Kind::I64);
                         auto arrayType = std::make_shared<HIRArrayType>(elementType, 0);
                         auto returnType = std::make_shared<HIRPointerType>(arrayType, true);
 
@@ -5329,7 +5333,7 @@ void HIRGenerator::visit(CallExpr& node) {
                         // hand the C function a raw struct pointer it can't
                         // dereference as a PropertyStorage.
                         auto* sourceObjectExpr =
-                            dynamic_cast<ObjectExpr*>(node.arguments[1].get());
+                            ast_cast<ObjectExpr>(node.arguments[1].get());
                         if (sourceObjectExpr) {
                             // Tentatively evaluate normally so the static
                             // fast-path below can still fire when target is also
@@ -5357,9 +5361,9 @@ void HIRGenerator::visit(CallExpr& node) {
                         auto* sourceStruct = getStaticObjectStructType(source);
                         if (targetStruct && sourceStruct) {
                             auto* targetIdentifier =
-                                dynamic_cast<Identifier*>(node.arguments[0].get());
+                                ast_cast<Identifier>(node.arguments[0].get());
                             auto* sourceIdentifier =
-                                dynamic_cast<Identifier*>(node.arguments[1].get());
+                                ast_cast<Identifier>(node.arguments[1].get());
                             if (targetIdentifier &&
                                 frozenObjectVars_.count(targetIdentifier->name) > 0) {
                                 currentObjectName_.clear();
@@ -5424,11 +5428,11 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Setup function signature
                         std::string runtimeFuncName = "nova_object_assign";
                         std::vector<HIRTypePtr> paramTypes;
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // target object
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // source object
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // target object
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // source object
 
                         // Return type is pointer to the modified target object
-                        auto returnType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                        auto returnType = HIRType::get(HIRType::Kind::Pointer);
 
                         // Find or create runtime function
                         HIRFunction* runtimeFunc = nullptr;
@@ -5476,7 +5480,7 @@ void HIRGenerator::visit(CallExpr& node) {
                         // struct to the incompatible runtime Object map layout.
                         if (auto* structType = getStaticObjectStructType(obj)) {
                             if (auto* keyLiteral =
-                                    dynamic_cast<StringLiteral*>(node.arguments[1].get())) {
+                                    ast_cast<StringLiteral>(node.arguments[1].get())) {
                                 bool found = false;
                                 for (const auto& field : structType->fields) {
                                     if (field.name == keyLiteral->value) {
@@ -5492,11 +5496,11 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Setup function signature
                         std::string runtimeFuncName = "nova_object_hasOwn";
                         std::vector<HIRTypePtr> paramTypes;
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // object pointer
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));  // key (string)
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // object pointer
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::String));  // key (string)
 
                         // Return type is boolean (i64)
-                        auto returnType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        auto returnType = HIRType::get(HIRType::Kind::I64);
 
                         // Find or create runtime function
                         HIRFunction* runtimeFunc = nullptr;
@@ -5533,7 +5537,7 @@ void HIRGenerator::visit(CallExpr& node) {
                         node.arguments[0]->accept(*this);
                         auto* obj = lastValue_;
 
-                        if (auto* identifier = dynamic_cast<Identifier*>(node.arguments[0].get());
+                        if (auto* identifier = ast_cast<Identifier>(node.arguments[0].get());
                             identifier && getStaticObjectStructType(obj)) {
                             frozenObjectVars_.insert(identifier->name);
                             sealedObjectVars_.insert(identifier->name);
@@ -5546,10 +5550,10 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Setup function signature
                         std::string runtimeFuncName = "nova_object_freeze";
                         std::vector<HIRTypePtr> paramTypes;
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // object pointer
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // object pointer
 
                         // Return type is pointer to the frozen object
-                        auto returnType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                        auto returnType = HIRType::get(HIRType::Kind::Pointer);
 
                         // Find or create runtime function
                         HIRFunction* runtimeFunc = nullptr;
@@ -5586,7 +5590,7 @@ void HIRGenerator::visit(CallExpr& node) {
                         node.arguments[0]->accept(*this);
                         auto* obj = lastValue_;
 
-                        if (auto* identifier = dynamic_cast<Identifier*>(node.arguments[0].get());
+                        if (auto* identifier = ast_cast<Identifier>(node.arguments[0].get());
                             identifier && getStaticObjectStructType(obj)) {
                             lastValue_ = builder_->createBoolConstant(
                                 frozenObjectVars_.count(identifier->name) > 0);
@@ -5596,10 +5600,10 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Setup function signature
                         std::string runtimeFuncName = "nova_object_isFrozen";
                         std::vector<HIRTypePtr> paramTypes;
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // object pointer
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // object pointer
 
                         // Return type is boolean (i64)
-                        auto returnType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        auto returnType = HIRType::get(HIRType::Kind::I64);
 
                         // Find or create runtime function
                         HIRFunction* runtimeFunc = nullptr;
@@ -5636,7 +5640,7 @@ void HIRGenerator::visit(CallExpr& node) {
                         node.arguments[0]->accept(*this);
                         auto* obj = lastValue_;
 
-                        if (auto* identifier = dynamic_cast<Identifier*>(node.arguments[0].get());
+                        if (auto* identifier = ast_cast<Identifier>(node.arguments[0].get());
                             identifier && getStaticObjectStructType(obj)) {
                             sealedObjectVars_.insert(identifier->name);
                             nonExtensibleObjectVars_.insert(identifier->name);
@@ -5648,10 +5652,10 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Setup function signature
                         std::string runtimeFuncName = "nova_object_seal";
                         std::vector<HIRTypePtr> paramTypes;
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // object pointer
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // object pointer
 
                         // Return type is pointer to the sealed object
-                        auto returnType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                        auto returnType = HIRType::get(HIRType::Kind::Pointer);
 
                         // Find or create runtime function
                         HIRFunction* runtimeFunc = nullptr;
@@ -5688,7 +5692,7 @@ void HIRGenerator::visit(CallExpr& node) {
                         node.arguments[0]->accept(*this);
                         auto* obj = lastValue_;
 
-                        if (auto* identifier = dynamic_cast<Identifier*>(node.arguments[0].get());
+                        if (auto* identifier = ast_cast<Identifier>(node.arguments[0].get());
                             identifier && getStaticObjectStructType(obj)) {
                             bool isSealed = sealedObjectVars_.count(identifier->name) > 0 ||
                                             frozenObjectVars_.count(identifier->name) > 0;
@@ -5699,10 +5703,10 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Setup function signature
                         std::string runtimeFuncName = "nova_object_isSealed";
                         std::vector<HIRTypePtr> paramTypes;
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // object pointer
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // object pointer
 
                         // Return type is boolean (i64)
-                        auto returnType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        auto returnType = HIRType::get(HIRType::Kind::I64);
 
                         // Find or create runtime function
                         HIRFunction* runtimeFunc = nullptr;
@@ -5760,7 +5764,7 @@ void HIRGenerator::visit(CallExpr& node) {
                             // signed-zero (Object.is(0, -0) === false) and NaN
                             // (Object.is(NaN, NaN) === true) match spec, even when
                             // both operands happen to be integer-typed.
-                            auto f64Type = std::make_shared<HIRType>(HIRType::Kind::F64);
+                            auto f64Type = HIRType::get(HIRType::Kind::F64);
                             HIRValue* lhsF64 = value1;
                             HIRValue* rhsF64 = value2;
                             if (!value1->type->isFloat()) {
@@ -5772,7 +5776,7 @@ void HIRGenerator::visit(CallExpr& node) {
 
                             const std::string runtimeFuncName = "nova_object_is_number";
                             std::vector<HIRTypePtr> paramTypes = {f64Type, f64Type};
-                            auto returnType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                            auto returnType = HIRType::get(HIRType::Kind::I64);
                             auto existingFunc = module_->getFunction(runtimeFuncName);
                             HIRFunction* runtimeFunc = existingFunc ? existingFunc.get() : nullptr;
                             if (!runtimeFunc) {
@@ -5785,8 +5789,8 @@ void HIRGenerator::visit(CallExpr& node) {
                                 runtimeFunc, {lhsF64, rhsF64}, "object_is_number_result");
                             // Box the int64 result (0/1) as a Boolean JSValue.
                             {
-                                auto i64Type = std::make_shared<HIRType>(HIRType::Kind::I64);
-                                auto jsValueType = std::make_shared<HIRType>(HIRType::Kind::JSValue);
+                                auto i64Type = HIRType::get(HIRType::Kind::I64);
+                                auto jsValueType = HIRType::get(HIRType::Kind::JSValue);
                                 HIRFunction* boolBox = nullptr;
                                 if (auto existing = module_->getFunction("nova_value_from_bool")) {
                                     boolBox = existing.get();
@@ -5835,9 +5839,9 @@ void HIRGenerator::visit(CallExpr& node) {
                             }
 
                             const std::string runtimeFuncName = "nova_object_is_identity";
-                            auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                            auto ptrType = HIRType::get(HIRType::Kind::Pointer);
                             std::vector<HIRTypePtr> paramTypes = {ptrType, ptrType};
-                            auto returnType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                            auto returnType = HIRType::get(HIRType::Kind::I64);
                             auto existingFunc = module_->getFunction(runtimeFuncName);
                             HIRFunction* runtimeFunc = existingFunc ? existingFunc.get() : nullptr;
                             if (!runtimeFunc) {
@@ -5850,8 +5854,8 @@ void HIRGenerator::visit(CallExpr& node) {
                                 runtimeFunc, {value1, value2}, "object_is_identity_result");
                             // Box the int64 result (0/1) as a Boolean JSValue.
                             {
-                                auto i64Type = std::make_shared<HIRType>(HIRType::Kind::I64);
-                                auto jsValueType = std::make_shared<HIRType>(HIRType::Kind::JSValue);
+                                auto i64Type = HIRType::get(HIRType::Kind::I64);
+                                auto jsValueType = HIRType::get(HIRType::Kind::JSValue);
                                 HIRFunction* boolBox = nullptr;
                                 if (auto existing = module_->getFunction("nova_value_from_bool")) {
                                     boolBox = existing.get();
@@ -5870,11 +5874,11 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Setup function signature
                         std::string runtimeFuncName = "nova_object_is";
                         std::vector<HIRTypePtr> paramTypes;
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64)); // value1
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64)); // value2
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::I64)); // value1
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::I64)); // value2
 
                         // Return type is boolean (i64)
-                        auto returnType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        auto returnType = HIRType::get(HIRType::Kind::I64);
 
                         // Find or create runtime function
                         HIRFunction* runtimeFunc = nullptr;
@@ -5900,8 +5904,8 @@ void HIRGenerator::visit(CallExpr& node) {
                         // `Object.is(x, y) === true` holds (the official harness
                         // compares against literal true/false).
                         {
-                            auto i64Type = std::make_shared<HIRType>(HIRType::Kind::I64);
-                            auto jsValueType = std::make_shared<HIRType>(HIRType::Kind::JSValue);
+                            auto i64Type = HIRType::get(HIRType::Kind::I64);
+                            auto jsValueType = HIRType::get(HIRType::Kind::JSValue);
                             HIRFunction* boolBox = nullptr;
                             if (auto existing = module_->getFunction("nova_value_from_bool")) {
                                 boolBox = existing.get();
@@ -5921,7 +5925,7 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Object.create(proto) - creates new object with specified prototype (ES5)
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected static method call: Object.create" << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
 
                         HIRValue* protoArg = nullptr;
                         if (node.arguments.size() >= 1) {
@@ -5958,8 +5962,8 @@ void HIRGenerator::visit(CallExpr& node) {
                         // runtime Object*. Static struct lowering would produce a
                         // fixed-layout struct that nova_dynamic_object_get_tagged
                         // cannot dereference.
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                        auto strType = std::make_shared<HIRType>(HIRType::Kind::String);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                        auto strType = HIRType::get(HIRType::Kind::String);
 
                         HIRValue* iterableArg = nullptr;
                         if (node.arguments.size() >= 1) {
@@ -5991,7 +5995,7 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Object.getOwnPropertyNames(obj) - returns array of property names (ES5)
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected static method call: Object.getOwnPropertyNames" << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
 
                         HIRValue* objArg = nullptr;
                         if (node.arguments.size() >= 1) {
@@ -6019,7 +6023,7 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Return type is pointer-to-array-of-strings so subsequent
                         // .join()/.length/.at() dispatch through the value-array
                         // runtime path (matches Object.keys behavior).
-                        auto elementType = std::make_shared<HIRType>(HIRType::Kind::String);
+                        auto elementType = HIRType::get(HIRType::Kind::String);
                         auto arrayType = std::make_shared<HIRArrayType>(elementType, 0);
                         auto returnType = std::make_shared<HIRPointerType>(arrayType, true);
 
@@ -6045,7 +6049,7 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Object.getOwnPropertySymbols(obj) - returns array of symbol properties (ES2015)
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected static method call: Object.getOwnPropertySymbols" << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
 
                         HIRValue* objArg = nullptr;
                         if (node.arguments.size() >= 1) {
@@ -6085,7 +6089,7 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Object.getPrototypeOf(obj) - returns prototype of object (ES5)
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected static method call: Object.getPrototypeOf" << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
 
                         HIRValue* objArg = nullptr;
                         if (node.arguments.size() >= 1) {
@@ -6116,7 +6120,7 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Object.setPrototypeOf(obj, proto) - sets prototype of object (ES2015)
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected static method call: Object.setPrototypeOf" << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
 
                         HIRValue* objArg = nullptr;
                         HIRValue* protoArg = nullptr;
@@ -6151,8 +6155,8 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Object.isExtensible(obj) - checks if object is extensible (ES5)
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected static method call: Object.isExtensible" << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                        auto intType = std::make_shared<HIRType>(HIRType::Kind::JSValue);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                        auto intType = HIRType::get(HIRType::Kind::JSValue);
 
                         HIRValue* objArg = nullptr;
                         if (node.arguments.size() >= 1) {
@@ -6164,7 +6168,7 @@ void HIRGenerator::visit(CallExpr& node) {
 
                         if (!node.arguments.empty()) {
                             if (auto* identifier =
-                                    dynamic_cast<Identifier*>(node.arguments[0].get());
+                                    ast_cast<Identifier>(node.arguments[0].get());
                                 identifier && getStaticObjectStructType(objArg)) {
                                 bool isExtensible =
                                     nonExtensibleObjectVars_.count(identifier->name) == 0 &&
@@ -6196,7 +6200,7 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Object.preventExtensions(obj) - prevents extensions (ES5)
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected static method call: Object.preventExtensions" << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
 
                         HIRValue* objArg = nullptr;
                         if (node.arguments.size() >= 1) {
@@ -6208,7 +6212,7 @@ void HIRGenerator::visit(CallExpr& node) {
 
                         if (!node.arguments.empty()) {
                             if (auto* identifier =
-                                    dynamic_cast<Identifier*>(node.arguments[0].get());
+                                    ast_cast<Identifier>(node.arguments[0].get());
                                 identifier && getStaticObjectStructType(objArg)) {
                                 nonExtensibleObjectVars_.insert(identifier->name);
                                 lastIntegrityObjectName_ = identifier->name;
@@ -6238,7 +6242,7 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Object.defineProperty(obj, prop, descriptor) - defines property (ES5)
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected static method call: Object.defineProperty" << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
 
                         HIRValue* objArg = builder_->createIntConstant(0);
                         HIRValue* propArg = builder_->createIntConstant(0);
@@ -6247,10 +6251,10 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Detect descriptor-literal-as-object-literal early so we
                         // can decide whether to materialize it as a runtime Object.
                         auto* descriptorLiteralEarly = node.arguments.size() >= 3
-                            ? dynamic_cast<ObjectExpr*>(node.arguments[2].get())
+                            ? ast_cast<ObjectExpr>(node.arguments[2].get())
                             : nullptr;
                         auto* targetIdentifierEarly = !node.arguments.empty()
-                            ? dynamic_cast<Identifier*>(node.arguments[0].get())
+                            ? ast_cast<Identifier>(node.arguments[0].get())
                             : nullptr;
                         bool targetIsDynamicVar = targetIdentifierEarly &&
                             dynamicObjectVars_.count(targetIdentifierEarly->name) > 0;
@@ -6282,13 +6286,13 @@ void HIRGenerator::visit(CallExpr& node) {
                         auto* targetStruct = getStaticObjectStructType(objArg);
                         auto* descriptorStruct = getStaticObjectStructType(descArg);
                         auto* propertyLiteral = node.arguments.size() >= 2
-                            ? dynamic_cast<StringLiteral*>(node.arguments[1].get())
+                            ? ast_cast<StringLiteral>(node.arguments[1].get())
                             : nullptr;
                         auto* descriptorLiteral = node.arguments.size() >= 3
-                            ? dynamic_cast<ObjectExpr*>(node.arguments[2].get())
+                            ? ast_cast<ObjectExpr>(node.arguments[2].get())
                             : nullptr;
                         auto* targetIdentifier = !node.arguments.empty()
-                            ? dynamic_cast<Identifier*>(node.arguments[0].get())
+                            ? ast_cast<Identifier>(node.arguments[0].get())
                             : nullptr;
 
                         if (targetStruct && descriptorStruct && propertyLiteral &&
@@ -6316,10 +6320,10 @@ void HIRGenerator::visit(CallExpr& node) {
                                 for (const auto& property : descriptorLiteral->properties) {
                                     std::string propertyName;
                                     if (auto* identifier =
-                                            dynamic_cast<Identifier*>(property.key.get())) {
+                                            ast_cast<Identifier>(property.key.get())) {
                                         propertyName = identifier->name;
                                     } else if (auto* stringKey =
-                                            dynamic_cast<StringLiteral*>(property.key.get())) {
+                                            ast_cast<StringLiteral>(property.key.get())) {
                                         propertyName = stringKey->value;
                                     }
 
@@ -6335,19 +6339,19 @@ void HIRGenerator::visit(CallExpr& node) {
                                         }
                                     } else if (propertyName == "writable") {
                                         if (auto* boolean =
-                                                dynamic_cast<BooleanLiteral*>(property.value.get())) {
+                                                ast_cast<BooleanLiteral>(property.value.get())) {
                                             hasWritable = true;
                                             requestedWritable = boolean->value;
                                         }
                                     } else if (propertyName == "enumerable") {
                                         if (auto* boolean =
-                                                dynamic_cast<BooleanLiteral*>(property.value.get())) {
+                                                ast_cast<BooleanLiteral>(property.value.get())) {
                                             hasEnumerable = true;
                                             requestedEnumerable = boolean->value;
                                         }
                                     } else if (propertyName == "configurable") {
                                         if (auto* boolean =
-                                                dynamic_cast<BooleanLiteral*>(property.value.get())) {
+                                                ast_cast<BooleanLiteral>(property.value.get())) {
                                             hasConfigurable = true;
                                             requestedConfigurable = boolean->value;
                                         }
@@ -6433,7 +6437,7 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Object.defineProperties(obj, props) - defines multiple properties (ES5)
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected static method call: Object.defineProperties" << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
 
                         HIRValue* objArg = builder_->createIntConstant(0);
                         HIRValue* propsArg = builder_->createIntConstant(0);
@@ -6466,7 +6470,7 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Object.getOwnPropertyDescriptor(obj, prop) - gets property descriptor (ES5)
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected static method call: Object.getOwnPropertyDescriptor" << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
 
                         HIRValue* objArg = builder_->createIntConstant(0);
                         HIRValue* propArg = builder_->createIntConstant(0);
@@ -6474,11 +6478,11 @@ void HIRGenerator::visit(CallExpr& node) {
                         std::function<std::string(Expr*)> builtinPath =
                             [&](Expr* expression) -> std::string {
                             if (!expression) return {};
-                            if (dynamic_cast<ThisExpr*>(expression)) {
+                            if (ast_cast<ThisExpr>(expression)) {
                                 return "global";
                             }
                             if (auto* identifier =
-                                    dynamic_cast<Identifier*>(expression)) {
+                                    ast_cast<Identifier>(expression)) {
                                 if (identifier->name == "Date" ||
                                     identifier->name == "RegExp") {
                                     return identifier->name;
@@ -6486,10 +6490,10 @@ void HIRGenerator::visit(CallExpr& node) {
                                 return {};
                             }
                             auto* member =
-                                dynamic_cast<MemberExpr*>(expression);
+                                ast_cast<MemberExpr>(expression);
                             if (!member || member->isComputed) return {};
                             auto* property =
-                                dynamic_cast<Identifier*>(
+                                ast_cast<Identifier>(
                                     member->property.get());
                             if (!property) return {};
                             std::string base =
@@ -6513,7 +6517,7 @@ void HIRGenerator::visit(CallExpr& node) {
                         }
 
                         if (!intrinsicOwner.empty()) {
-                            auto stringType = std::make_shared<HIRType>(
+                            auto stringType = HIRType::get(
                                 HIRType::Kind::String);
                             auto existingFunc = module_->getFunction(
                                 "nova_builtin_getOwnPropertyDescriptor");
@@ -6542,7 +6546,7 @@ void HIRGenerator::visit(CallExpr& node) {
 
                         auto* structType = getStaticObjectStructType(objArg);
                         auto* keyLiteral = node.arguments.size() >= 2
-                            ? dynamic_cast<StringLiteral*>(node.arguments[1].get())
+                            ? ast_cast<StringLiteral>(node.arguments[1].get())
                             : nullptr;
                         if (structType && keyLiteral) {
                             size_t fieldIndex = structType->fields.size();
@@ -6555,7 +6559,7 @@ void HIRGenerator::visit(CallExpr& node) {
 
                             if (fieldIndex == structType->fields.size()) {
                                 // undefined for a missing own property.
-                                auto undefinedType = std::make_shared<HIRType>(
+                                auto undefinedType = HIRType::get(
                                     HIRType::Kind::Unknown);
                                 lastValue_ = builder_->createUndefinedConstant(
                                     undefinedType.get());
@@ -6565,7 +6569,7 @@ void HIRGenerator::visit(CallExpr& node) {
                             bool writable = true;
                             bool configurable = true;
                             if (auto* identifier =
-                                    dynamic_cast<Identifier*>(node.arguments[0].get())) {
+                                    ast_cast<Identifier>(node.arguments[0].get())) {
                                 writable = frozenObjectVars_.count(identifier->name) == 0;
                                 configurable =
                                     frozenObjectVars_.count(identifier->name) == 0 &&
@@ -6590,7 +6594,7 @@ void HIRGenerator::visit(CallExpr& node) {
 
                             bool enumerable = true;
                             if (auto* identifier =
-                                    dynamic_cast<Identifier*>(node.arguments[0].get())) {
+                                    ast_cast<Identifier>(node.arguments[0].get())) {
                                 auto enumerableObject = propertyEnumerable_.find(identifier->name);
                                 if (enumerableObject != propertyEnumerable_.end()) {
                                     auto attribute =
@@ -6634,7 +6638,7 @@ void HIRGenerator::visit(CallExpr& node) {
                             objArg->type->kind ==
                                 HIRType::Kind::JSValue) {
                             auto jsValueType =
-                                std::make_shared<HIRType>(
+                                HIRType::get(
                                     HIRType::Kind::JSValue);
                             HIRFunction* unbox = nullptr;
                             if (auto existing =
@@ -6684,7 +6688,7 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Object.getOwnPropertyDescriptors(obj) - gets all property descriptors (ES2017)
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected static method call: Object.getOwnPropertyDescriptors" << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
 
                         HIRValue* objArg = builder_->createIntConstant(0);
                         if (node.arguments.size() >= 1) {
@@ -6697,7 +6701,7 @@ void HIRGenerator::visit(CallExpr& node) {
                             bool configurable = true;
                             if (!node.arguments.empty()) {
                                 if (auto* identifier =
-                                        dynamic_cast<Identifier*>(node.arguments[0].get())) {
+                                        ast_cast<Identifier>(node.arguments[0].get())) {
                                     writable = frozenObjectVars_.count(identifier->name) == 0;
                                     configurable =
                                         frozenObjectVars_.count(identifier->name) == 0 &&
@@ -6722,7 +6726,7 @@ void HIRGenerator::visit(CallExpr& node) {
                                 bool fieldEnumerable = true;
                                 bool fieldConfigurable = configurable;
                                 if (!node.arguments.empty()) {
-                                    if (auto* identifier = dynamic_cast<Identifier*>(
+                                    if (auto* identifier = ast_cast<Identifier>(
                                             node.arguments[0].get())) {
                                         auto writableObject =
                                             propertyWritable_.find(identifier->name);
@@ -6814,7 +6818,7 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Object.groupBy(items, callbackFn) - groups items by key (ES2024)
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected static method call: Object.groupBy" << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
 
                         HIRValue* itemsArg = builder_->createIntConstant(0);
                         HIRValue* callbackArg = builder_->createIntConstant(0);
@@ -6853,7 +6857,7 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Map.groupBy(items, callbackFn) - ES2024
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected static method call: Map.groupBy" << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
 
                         HIRValue* itemsArg = builder_->createIntConstant(0);
                         HIRValue* callbackArg = builder_->createIntConstant(0);
@@ -6891,8 +6895,8 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Promise.resolve(value) - creates a resolved promise
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected static method call: Promise.resolve" << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                        auto intType = std::make_shared<HIRType>(HIRType::Kind::JSValue);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                        auto intType = HIRType::get(HIRType::Kind::JSValue);
 
                         HIRValue* resolvedValue = nullptr;
                         if (!node.arguments.empty()) {
@@ -6937,8 +6941,8 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Promise.reject(reason) - creates a rejected promise
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected static method call: Promise.reject" << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                        auto intType = std::make_shared<HIRType>(HIRType::Kind::JSValue);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                        auto intType = HIRType::get(HIRType::Kind::JSValue);
 
                         std::vector<HIRTypePtr> paramTypes = {intType};
                         auto existingFunc = module_->getFunction("nova_promise_reject");
@@ -6970,7 +6974,7 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Promise.all(iterable) - waits for all promises to resolve
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected static method call: Promise.all" << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
 
                         std::vector<HIRTypePtr> paramTypes = {ptrType};
                         auto existingFunc = module_->getFunction("nova_promise_all");
@@ -7002,7 +7006,7 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Promise.race(iterable) - resolves/rejects with the first settled promise
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected static method call: Promise.race" << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
 
                         std::vector<HIRTypePtr> paramTypes = {ptrType};
                         auto existingFunc = module_->getFunction("nova_promise_race");
@@ -7034,7 +7038,7 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Promise.allSettled(iterable) - waits for all promises to settle
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected static method call: Promise.allSettled" << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
 
                         std::vector<HIRTypePtr> paramTypes = {ptrType};
                         auto existingFunc = module_->getFunction("nova_promise_allSettled");
@@ -7066,7 +7070,7 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Promise.any(iterable) - resolves when any promise fulfills
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected static method call: Promise.any" << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
 
                         std::vector<HIRTypePtr> paramTypes = {ptrType};
                         auto existingFunc = module_->getFunction("nova_promise_any");
@@ -7098,7 +7102,7 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Promise.withResolvers() - returns { promise, resolve, reject }
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected static method call: Promise.withResolvers" << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
 
                         std::vector<HIRTypePtr> paramTypes = {};
                         auto existingFunc = module_->getFunction("nova_promise_withResolvers");
@@ -7126,7 +7130,7 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Proxy.revocable(target, handler) - creates revocable proxy
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected static method call: Proxy.revocable" << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
 
                         std::vector<HIRTypePtr> paramTypes = {ptrType, ptrType};
                         auto existingFunc = module_->getFunction("nova_proxy_revocable");
@@ -7197,8 +7201,8 @@ void HIRGenerator::visit(CallExpr& node) {
                         // i64 argsArrayMetaPtr) and returns i64. The first arg is typed as
                         // ptr so the codegen auto-resolves string-constant function names
                         // (e.g. "add") to function pointers (see LLVMCodeGen.cpp:5353).
-                        auto i64Type = std::make_shared<HIRType>(HIRType::Kind::I64);
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                        auto i64Type = HIRType::get(HIRType::Kind::I64);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
                         std::vector<HIRTypePtr> paramTypes = {ptrType, i64Type, i64Type};
 
                         auto existingFunc = module_->getFunction("nova_reflect_apply");
@@ -7288,7 +7292,7 @@ void HIRGenerator::visit(CallExpr& node) {
                         // as JSValue so subsequent operators route through
                         // nova_value_add / nova_value_strict_equal rather than
                         // raw integer arithmetic.
-                        lastValue_->type = std::make_shared<HIRType>(HIRType::Kind::JSValue);
+                        lastValue_->type = HIRType::get(HIRType::Kind::JSValue);
                         return;
                     }
 
@@ -7296,7 +7300,7 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Reflect.construct(target, argumentsList[, newTarget])
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected static method call: Reflect.construct" << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
                         std::vector<HIRTypePtr> paramTypes = {ptrType, ptrType, ptrType};
 
                         auto existingFunc = module_->getFunction("nova_reflect_construct");
@@ -7319,7 +7323,7 @@ void HIRGenerator::visit(CallExpr& node) {
                                     argument->type->kind ==
                                         HIRType::Kind::JSValue) {
                                     auto jsValueType =
-                                        std::make_shared<HIRType>(
+                                        HIRType::get(
                                             HIRType::Kind::JSValue);
                                     HIRFunction* unbox = nullptr;
                                     if (auto existing =
@@ -7358,9 +7362,9 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Reflect.defineProperty(target, propertyKey, attributes)
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected static method call: Reflect.defineProperty" << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                        auto strType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                        auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                        auto strType = HIRType::get(HIRType::Kind::Pointer);
+                        auto intType = HIRType::get(HIRType::Kind::I64);
                         std::vector<HIRTypePtr> paramTypes = {ptrType, strType, ptrType};
 
                         auto existingFunc = module_->getFunction("nova_reflect_defineProperty");
@@ -7407,7 +7411,7 @@ void HIRGenerator::visit(CallExpr& node) {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected static method call: Reflect.deleteProperty" << std::endl;
 
                         // Phase 2.4: nova_reflect_deleteProperty takes (i64 targetJs, i64 keyJs) -> i64.
-                        auto i64Type = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        auto i64Type = HIRType::get(HIRType::Kind::I64);
                         std::vector<HIRTypePtr> paramTypes = {i64Type, i64Type};
 
                         auto existingFunc = module_->getFunction("nova_reflect_deleteProperty");
@@ -7456,8 +7460,8 @@ void HIRGenerator::visit(CallExpr& node) {
 
                         // Phase 2.4: nova_reflect_get takes (i64, i64, i64) -> JSValue.
                         // Return type is JSValue so callers don't re-box the result.
-                        auto i64Type = std::make_shared<HIRType>(HIRType::Kind::I64);
-                        auto jsType = std::make_shared<HIRType>(HIRType::Kind::JSValue);
+                        auto i64Type = HIRType::get(HIRType::Kind::I64);
+                        auto jsType = HIRType::get(HIRType::Kind::JSValue);
                         std::vector<HIRTypePtr> paramTypes = {i64Type, i64Type, i64Type};
 
                         auto existingFunc = module_->getFunction("nova_reflect_get");
@@ -7510,8 +7514,8 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Reflect.getOwnPropertyDescriptor(target, propertyKey)
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected static method call: Reflect.getOwnPropertyDescriptor" << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                        auto strType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                        auto strType = HIRType::get(HIRType::Kind::Pointer);
                         std::vector<HIRTypePtr> paramTypes = {ptrType, strType};
 
                         auto existingFunc = module_->getFunction("nova_reflect_getOwnPropertyDescriptor");
@@ -7548,7 +7552,7 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Reflect.getPrototypeOf(target)
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected static method call: Reflect.getPrototypeOf" << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
                         std::vector<HIRTypePtr> paramTypes = {ptrType};
 
                         auto existingFunc = module_->getFunction("nova_reflect_getPrototypeOf");
@@ -7580,7 +7584,7 @@ void HIRGenerator::visit(CallExpr& node) {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected static method call: Reflect.has" << std::endl;
 
                         // Phase 2.4: nova_reflect_has takes (i64 targetJs, i64 keyJs).
-                        auto i64Type = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        auto i64Type = HIRType::get(HIRType::Kind::I64);
                         std::vector<HIRTypePtr> paramTypes = {i64Type, i64Type};
 
                         auto existingFunc = module_->getFunction("nova_reflect_has");
@@ -7627,8 +7631,8 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Reflect.isExtensible(target)
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected static method call: Reflect.isExtensible" << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                        auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                        auto intType = HIRType::get(HIRType::Kind::I64);
                         std::vector<HIRTypePtr> paramTypes = {ptrType};
 
                         auto existingFunc = module_->getFunction("nova_reflect_isExtensible");
@@ -7659,7 +7663,7 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Reflect.ownKeys(target)
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected static method call: Reflect.ownKeys" << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
                         std::vector<HIRTypePtr> paramTypes = {ptrType};
 
                         auto existingFunc = module_->getFunction("nova_reflect_ownKeys");
@@ -7690,8 +7694,8 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Reflect.preventExtensions(target)
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected static method call: Reflect.preventExtensions" << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                        auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                        auto intType = HIRType::get(HIRType::Kind::I64);
                         std::vector<HIRTypePtr> paramTypes = {ptrType};
 
                         auto existingFunc = module_->getFunction("nova_reflect_preventExtensions");
@@ -7723,7 +7727,7 @@ void HIRGenerator::visit(CallExpr& node) {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected static method call: Reflect.set" << std::endl;
 
                         // Phase 2.4: nova_reflect_set takes (i64, i64, i64, i64) -> i64.
-                        auto i64Type = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        auto i64Type = HIRType::get(HIRType::Kind::I64);
                         std::vector<HIRTypePtr> paramTypes = {i64Type, i64Type, i64Type, i64Type};
 
                         auto existingFunc = module_->getFunction("nova_reflect_set");
@@ -7786,8 +7790,8 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Reflect.setPrototypeOf(target, prototype)
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected static method call: Reflect.setPrototypeOf" << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                        auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                        auto intType = HIRType::get(HIRType::Kind::I64);
                         std::vector<HIRTypePtr> paramTypes = {ptrType, ptrType};
 
                         auto existingFunc = module_->getFunction("nova_reflect_setPrototypeOf");
@@ -7833,7 +7837,7 @@ void HIRGenerator::visit(CallExpr& node) {
                         std::vector<HIRTypePtr> paramTypes; // empty - no params
 
                         // Return type is i64 (timestamp in milliseconds)
-                        auto returnType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        auto returnType = HIRType::get(HIRType::Kind::I64);
 
                         // Find or create runtime function
                         HIRFunction* runtimeFunc = nullptr;
@@ -7871,8 +7875,8 @@ void HIRGenerator::visit(CallExpr& node) {
                         auto* strArg = lastValue_;
 
                         std::string runtimeFuncName = "nova_date_parse";
-                        std::vector<HIRTypePtr> paramTypes = {std::make_shared<HIRType>(HIRType::Kind::Pointer)};
-                        auto returnType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        std::vector<HIRTypePtr> paramTypes = {HIRType::get(HIRType::Kind::Pointer)};
+                        auto returnType = HIRType::get(HIRType::Kind::I64);
 
                         HIRFunction* runtimeFunc = nullptr;
                         auto existingFunc = module_->getFunction(runtimeFuncName);
@@ -7902,9 +7906,9 @@ void HIRGenerator::visit(CallExpr& node) {
                         std::string runtimeFuncName = "nova_date_UTC";
                         std::vector<HIRTypePtr> paramTypes;
                         for (int i = 0; i < 7; i++) {
-                            paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));
+                            paramTypes.push_back(HIRType::get(HIRType::Kind::I64));
                         }
-                        auto returnType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        auto returnType = HIRType::get(HIRType::Kind::I64);
 
                         HIRFunction* runtimeFunc = nullptr;
                         auto existingFunc = module_->getFunction(runtimeFuncName);
@@ -7940,7 +7944,7 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Intl.getCanonicalLocales(locales) - canonicalize locale identifiers
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected static method call: Intl.getCanonicalLocales" << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
 
                         HIRValue* localesArg = nullptr;
                         if (node.arguments.size() >= 1) {
@@ -7971,7 +7975,7 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Intl.supportedValuesOf(key) - get supported values for a key
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected static method call: Intl.supportedValuesOf" << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
 
                         HIRValue* keyArg = nullptr;
                         if (node.arguments.size() >= 1) {
@@ -8002,7 +8006,7 @@ void HIRGenerator::visit(CallExpr& node) {
                     if (objIdent->name == "Iterator" && propIdent->name == "from") {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected static method call: Iterator.from" << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
 
                         HIRValue* iterableArg = nullptr;
                         if (node.arguments.size() >= 1) {
@@ -8043,7 +8047,7 @@ void HIRGenerator::visit(CallExpr& node) {
                         std::vector<HIRTypePtr> paramTypes; // empty - no params
 
                         // Return type is F64 (high-resolution time in milliseconds)
-                        auto returnType = std::make_shared<HIRType>(HIRType::Kind::F64);
+                        auto returnType = HIRType::get(HIRType::Kind::F64);
 
                         // Find or create runtime function
                         HIRFunction* runtimeFunc = nullptr;
@@ -8087,8 +8091,8 @@ void HIRGenerator::visit(CallExpr& node) {
                             HIRValue* sizeArg = lastValue_;
 
                             std::string runtimeFuncName = "nova_atomics_isLockFree";
-                            std::vector<HIRTypePtr> paramTypes = {std::make_shared<HIRType>(HIRType::Kind::I64)};
-                            auto returnType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                            std::vector<HIRTypePtr> paramTypes = {HIRType::get(HIRType::Kind::I64)};
+                            auto returnType = HIRType::get(HIRType::Kind::I64);
 
                             HIRFunction* runtimeFunc = nullptr;
                             auto existingFunc = module_->getFunction(runtimeFuncName);
@@ -8122,10 +8126,10 @@ void HIRGenerator::visit(CallExpr& node) {
                             // Default to i32 version (Int32Array is most common for atomics)
                             std::string runtimeFuncName = "nova_atomics_load_i32";
                             std::vector<HIRTypePtr> paramTypes = {
-                                std::make_shared<HIRType>(HIRType::Kind::Pointer),
-                                std::make_shared<HIRType>(HIRType::Kind::I64)
+                                HIRType::get(HIRType::Kind::Pointer),
+                                HIRType::get(HIRType::Kind::I64)
                             };
-                            auto returnType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                            auto returnType = HIRType::get(HIRType::Kind::I64);
 
                             HIRFunction* runtimeFunc = nullptr;
                             auto existingFunc = module_->getFunction(runtimeFuncName);
@@ -8160,11 +8164,11 @@ void HIRGenerator::visit(CallExpr& node) {
 
                             std::string runtimeFuncName = "nova_atomics_store_i32";
                             std::vector<HIRTypePtr> paramTypes = {
-                                std::make_shared<HIRType>(HIRType::Kind::Pointer),
-                                std::make_shared<HIRType>(HIRType::Kind::I64),
-                                std::make_shared<HIRType>(HIRType::Kind::I64)
+                                HIRType::get(HIRType::Kind::Pointer),
+                                HIRType::get(HIRType::Kind::I64),
+                                HIRType::get(HIRType::Kind::I64)
                             };
-                            auto returnType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                            auto returnType = HIRType::get(HIRType::Kind::I64);
 
                             HIRFunction* runtimeFunc = nullptr;
                             auto existingFunc = module_->getFunction(runtimeFuncName);
@@ -8199,11 +8203,11 @@ void HIRGenerator::visit(CallExpr& node) {
 
                             std::string runtimeFuncName = "nova_atomics_add_i32";
                             std::vector<HIRTypePtr> paramTypes = {
-                                std::make_shared<HIRType>(HIRType::Kind::Pointer),
-                                std::make_shared<HIRType>(HIRType::Kind::I64),
-                                std::make_shared<HIRType>(HIRType::Kind::I64)
+                                HIRType::get(HIRType::Kind::Pointer),
+                                HIRType::get(HIRType::Kind::I64),
+                                HIRType::get(HIRType::Kind::I64)
                             };
-                            auto returnType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                            auto returnType = HIRType::get(HIRType::Kind::I64);
 
                             HIRFunction* runtimeFunc = nullptr;
                             auto existingFunc = module_->getFunction(runtimeFuncName);
@@ -8238,11 +8242,11 @@ void HIRGenerator::visit(CallExpr& node) {
 
                             std::string runtimeFuncName = "nova_atomics_sub_i32";
                             std::vector<HIRTypePtr> paramTypes = {
-                                std::make_shared<HIRType>(HIRType::Kind::Pointer),
-                                std::make_shared<HIRType>(HIRType::Kind::I64),
-                                std::make_shared<HIRType>(HIRType::Kind::I64)
+                                HIRType::get(HIRType::Kind::Pointer),
+                                HIRType::get(HIRType::Kind::I64),
+                                HIRType::get(HIRType::Kind::I64)
                             };
-                            auto returnType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                            auto returnType = HIRType::get(HIRType::Kind::I64);
 
                             HIRFunction* runtimeFunc = nullptr;
                             auto existingFunc = module_->getFunction(runtimeFuncName);
@@ -8277,11 +8281,11 @@ void HIRGenerator::visit(CallExpr& node) {
 
                             std::string runtimeFuncName = "nova_atomics_and_i32";
                             std::vector<HIRTypePtr> paramTypes = {
-                                std::make_shared<HIRType>(HIRType::Kind::Pointer),
-                                std::make_shared<HIRType>(HIRType::Kind::I64),
-                                std::make_shared<HIRType>(HIRType::Kind::I64)
+                                HIRType::get(HIRType::Kind::Pointer),
+                                HIRType::get(HIRType::Kind::I64),
+                                HIRType::get(HIRType::Kind::I64)
                             };
-                            auto returnType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                            auto returnType = HIRType::get(HIRType::Kind::I64);
 
                             HIRFunction* runtimeFunc = nullptr;
                             auto existingFunc = module_->getFunction(runtimeFuncName);
@@ -8316,11 +8320,11 @@ void HIRGenerator::visit(CallExpr& node) {
 
                             std::string runtimeFuncName = "nova_atomics_or_i32";
                             std::vector<HIRTypePtr> paramTypes = {
-                                std::make_shared<HIRType>(HIRType::Kind::Pointer),
-                                std::make_shared<HIRType>(HIRType::Kind::I64),
-                                std::make_shared<HIRType>(HIRType::Kind::I64)
+                                HIRType::get(HIRType::Kind::Pointer),
+                                HIRType::get(HIRType::Kind::I64),
+                                HIRType::get(HIRType::Kind::I64)
                             };
-                            auto returnType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                            auto returnType = HIRType::get(HIRType::Kind::I64);
 
                             HIRFunction* runtimeFunc = nullptr;
                             auto existingFunc = module_->getFunction(runtimeFuncName);
@@ -8355,11 +8359,11 @@ void HIRGenerator::visit(CallExpr& node) {
 
                             std::string runtimeFuncName = "nova_atomics_xor_i32";
                             std::vector<HIRTypePtr> paramTypes = {
-                                std::make_shared<HIRType>(HIRType::Kind::Pointer),
-                                std::make_shared<HIRType>(HIRType::Kind::I64),
-                                std::make_shared<HIRType>(HIRType::Kind::I64)
+                                HIRType::get(HIRType::Kind::Pointer),
+                                HIRType::get(HIRType::Kind::I64),
+                                HIRType::get(HIRType::Kind::I64)
                             };
-                            auto returnType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                            auto returnType = HIRType::get(HIRType::Kind::I64);
 
                             HIRFunction* runtimeFunc = nullptr;
                             auto existingFunc = module_->getFunction(runtimeFuncName);
@@ -8394,11 +8398,11 @@ void HIRGenerator::visit(CallExpr& node) {
 
                             std::string runtimeFuncName = "nova_atomics_exchange_i32";
                             std::vector<HIRTypePtr> paramTypes = {
-                                std::make_shared<HIRType>(HIRType::Kind::Pointer),
-                                std::make_shared<HIRType>(HIRType::Kind::I64),
-                                std::make_shared<HIRType>(HIRType::Kind::I64)
+                                HIRType::get(HIRType::Kind::Pointer),
+                                HIRType::get(HIRType::Kind::I64),
+                                HIRType::get(HIRType::Kind::I64)
                             };
-                            auto returnType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                            auto returnType = HIRType::get(HIRType::Kind::I64);
 
                             HIRFunction* runtimeFunc = nullptr;
                             auto existingFunc = module_->getFunction(runtimeFuncName);
@@ -8435,12 +8439,12 @@ void HIRGenerator::visit(CallExpr& node) {
 
                             std::string runtimeFuncName = "nova_atomics_compareExchange_i32";
                             std::vector<HIRTypePtr> paramTypes = {
-                                std::make_shared<HIRType>(HIRType::Kind::Pointer),
-                                std::make_shared<HIRType>(HIRType::Kind::I64),
-                                std::make_shared<HIRType>(HIRType::Kind::I64),
-                                std::make_shared<HIRType>(HIRType::Kind::I64)
+                                HIRType::get(HIRType::Kind::Pointer),
+                                HIRType::get(HIRType::Kind::I64),
+                                HIRType::get(HIRType::Kind::I64),
+                                HIRType::get(HIRType::Kind::I64)
                             };
-                            auto returnType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                            auto returnType = HIRType::get(HIRType::Kind::I64);
 
                             HIRFunction* runtimeFunc = nullptr;
                             auto existingFunc = module_->getFunction(runtimeFuncName);
@@ -8483,12 +8487,12 @@ void HIRGenerator::visit(CallExpr& node) {
 
                             std::string runtimeFuncName = "nova_atomics_wait_i32";
                             std::vector<HIRTypePtr> paramTypes = {
-                                std::make_shared<HIRType>(HIRType::Kind::Pointer),
-                                std::make_shared<HIRType>(HIRType::Kind::I64),
-                                std::make_shared<HIRType>(HIRType::Kind::I64),
-                                std::make_shared<HIRType>(HIRType::Kind::I64)
+                                HIRType::get(HIRType::Kind::Pointer),
+                                HIRType::get(HIRType::Kind::I64),
+                                HIRType::get(HIRType::Kind::I64),
+                                HIRType::get(HIRType::Kind::I64)
                             };
-                            auto returnType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                            auto returnType = HIRType::get(HIRType::Kind::I64);
 
                             HIRFunction* runtimeFunc = nullptr;
                             auto existingFunc = module_->getFunction(runtimeFuncName);
@@ -8529,11 +8533,11 @@ void HIRGenerator::visit(CallExpr& node) {
 
                             std::string runtimeFuncName = "nova_atomics_notify";
                             std::vector<HIRTypePtr> paramTypes = {
-                                std::make_shared<HIRType>(HIRType::Kind::Pointer),
-                                std::make_shared<HIRType>(HIRType::Kind::I64),
-                                std::make_shared<HIRType>(HIRType::Kind::I64)
+                                HIRType::get(HIRType::Kind::Pointer),
+                                HIRType::get(HIRType::Kind::I64),
+                                HIRType::get(HIRType::Kind::I64)
                             };
-                            auto returnType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                            auto returnType = HIRType::get(HIRType::Kind::I64);
 
                             HIRFunction* runtimeFunc = nullptr;
                             auto existingFunc = module_->getFunction(runtimeFuncName);
@@ -8576,12 +8580,12 @@ void HIRGenerator::visit(CallExpr& node) {
 
                             std::string runtimeFuncName = "nova_atomics_waitAsync_i32";
                             std::vector<HIRTypePtr> paramTypes = {
-                                std::make_shared<HIRType>(HIRType::Kind::Pointer),
-                                std::make_shared<HIRType>(HIRType::Kind::I64),
-                                std::make_shared<HIRType>(HIRType::Kind::I64),
-                                std::make_shared<HIRType>(HIRType::Kind::I64)
+                                HIRType::get(HIRType::Kind::Pointer),
+                                HIRType::get(HIRType::Kind::I64),
+                                HIRType::get(HIRType::Kind::I64),
+                                HIRType::get(HIRType::Kind::I64)
                             };
-                            auto returnType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                            auto returnType = HIRType::get(HIRType::Kind::I64);
 
                             HIRFunction* runtimeFunc = nullptr;
                             auto existingFunc = module_->getFunction(runtimeFuncName);
@@ -8630,10 +8634,10 @@ void HIRGenerator::visit(CallExpr& node) {
 
                             std::string runtimeFuncName = "nova_bigint_asIntN";
                             std::vector<HIRTypePtr> paramTypes = {
-                                std::make_shared<HIRType>(HIRType::Kind::I64),
-                                std::make_shared<HIRType>(HIRType::Kind::Pointer)
+                                HIRType::get(HIRType::Kind::I64),
+                                HIRType::get(HIRType::Kind::Pointer)
                             };
-                            auto returnType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                            auto returnType = HIRType::get(HIRType::Kind::Pointer);
 
                             HIRFunction* runtimeFunc = nullptr;
                             auto existingFunc = module_->getFunction(runtimeFuncName);
@@ -8667,10 +8671,10 @@ void HIRGenerator::visit(CallExpr& node) {
 
                             std::string runtimeFuncName = "nova_bigint_asUintN";
                             std::vector<HIRTypePtr> paramTypes = {
-                                std::make_shared<HIRType>(HIRType::Kind::I64),
-                                std::make_shared<HIRType>(HIRType::Kind::Pointer)
+                                HIRType::get(HIRType::Kind::I64),
+                                HIRType::get(HIRType::Kind::Pointer)
                             };
-                            auto returnType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                            auto returnType = HIRType::get(HIRType::Kind::Pointer);
 
                             HIRFunction* runtimeFunc = nullptr;
                             auto existingFunc = module_->getFunction(runtimeFuncName);
@@ -8699,9 +8703,9 @@ void HIRGenerator::visit(CallExpr& node) {
 
         // Check if this is a STATIC class method call: ClassName.method(...)
         // Must check BEFORE string/number methods to avoid evaluating class names as objects
-        if (auto* memberExpr = dynamic_cast<MemberExpr*>(node.callee.get())) {
-            if (auto* objIdent = dynamic_cast<Identifier*>(memberExpr->object.get())) {
-                if (auto* propIdent = dynamic_cast<Identifier*>(memberExpr->property.get())) {
+        if (auto* memberExpr = ast_cast<MemberExpr>(node.callee.get())) {
+            if (auto* objIdent = ast_cast<Identifier>(memberExpr->object.get())) {
+                if (auto* propIdent = ast_cast<Identifier>(memberExpr->property.get())) {
                     // Check if object identifier is a known class name
                     if (classNames_.find(objIdent->name) != classNames_.end()) {
                         std::string className = objIdent->name;
@@ -8737,7 +8741,7 @@ void HIRGenerator::visit(CallExpr& node) {
         }
 
         // Check if this is a string method call: str.substring(...)
-        if (auto* memberExpr = dynamic_cast<MemberExpr*>(node.callee.get())) {
+        if (auto* memberExpr = ast_cast<MemberExpr>(node.callee.get())) {
             // Extract object identifier and method name FIRST, before visiting the object.
             // This is critical: Map/Set/WeakMap/WeakSet checks must run BEFORE
             // memberExpr->object->accept(*this) to avoid corrupting lastValue_ with
@@ -8746,15 +8750,15 @@ void HIRGenerator::visit(CallExpr& node) {
             // Extract the base variable from potentially chained calls like mySet.add(1).add(2)
             // In such chains, memberExpr->object is a CallExpr, not an Identifier.
             Expr* baseExpr = memberExpr->object.get();
-            while (auto* callExpr = dynamic_cast<CallExpr*>(baseExpr)) {
-                if (auto* innerMemberExpr = dynamic_cast<MemberExpr*>(callExpr->callee.get())) {
+            while (auto* callExpr = ast_cast<CallExpr>(baseExpr)) {
+                if (auto* innerMemberExpr = ast_cast<MemberExpr>(callExpr->callee.get())) {
                     baseExpr = innerMemberExpr->object.get();
                 } else {
                     break;
                 }
             }
-            if (auto* objIdent = dynamic_cast<Identifier*>(baseExpr)) {
-                if (auto* propExpr = dynamic_cast<Identifier*>(memberExpr->property.get())) {
+            if (auto* objIdent = ast_cast<Identifier>(baseExpr)) {
+                if (auto* propExpr = ast_cast<Identifier>(memberExpr->property.get())) {
                     std::string methodName = propExpr->name;
                     // Dynamic runtime Object method call: `dynObj.method(args...)`
                     // where dynObj is a plain runtime Object (a variable registered
@@ -8781,16 +8785,16 @@ void HIRGenerator::visit(CallExpr& node) {
                         HIRValue* dynObj = lastValue_;
                         if (dynObj && dynObj->type &&
                             dynObj->type->kind != HIRType::Kind::Pointer) {
-                            auto ptrCoerce = std::make_shared<HIRType>(
+                            auto ptrCoerce = HIRType::get(
                                 HIRType::Kind::Pointer);
                             dynObj = builder_->createCast(
                                 dynObj, ptrCoerce.get(),
                                 "dyn_obj_method.cast");
                         }
                         auto ptrType =
-                            std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                            HIRType::get(HIRType::Kind::Pointer);
                         auto i64Type =
-                            std::make_shared<HIRType>(HIRType::Kind::I64);
+                            HIRType::get(HIRType::Kind::I64);
                         const size_t argc = node.arguments.size();
                         std::string runtimeName =
                             "nova_dynamic_call_method_" +
@@ -8825,8 +8829,8 @@ void HIRGenerator::visit(CallExpr& node) {
                     }
                     if (mapVars_.count(objIdent->name) > 0) {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected Map method call: " << methodName << std::endl;
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                        auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                        auto intType = HIRType::get(HIRType::Kind::I64);
                         memberExpr->object->accept(*this);
                         HIRValue* mapObj = lastValue_;
                         if (methodName == "set") {
@@ -8835,8 +8839,8 @@ void HIRGenerator::visit(CallExpr& node) {
                             bool keyIsString = false;
                             bool valueIsString = false;
                             if (node.arguments.size() >= 1) {
-                                if (dynamic_cast<StringLiteral*>(node.arguments[0].get())) keyIsString = true;
-                                auto* keyIdentifier = dynamic_cast<Identifier*>(
+                                if (ast_cast<StringLiteral>(node.arguments[0].get())) keyIsString = true;
+                                auto* keyIdentifier = ast_cast<Identifier>(
                                     node.arguments[0].get());
                                 if (keyIdentifier &&
                                     keyIdentifier->name == "NaN") {
@@ -8848,7 +8852,7 @@ void HIRGenerator::visit(CallExpr& node) {
                                 }
                             } else { keyArg = builder_->createIntConstant(0); }
                             if (node.arguments.size() >= 2) {
-                                if (dynamic_cast<StringLiteral*>(node.arguments[1].get())) valueIsString = true;
+                                if (ast_cast<StringLiteral>(node.arguments[1].get())) valueIsString = true;
                                 node.arguments[1]->accept(*this);
                                 valueArg = lastValue_;
                             } else { valueArg = builder_->createIntConstant(0); }
@@ -8873,8 +8877,8 @@ void HIRGenerator::visit(CallExpr& node) {
                             HIRValue* keyArg = nullptr;
                             bool keyIsString = false;
                             if (node.arguments.size() >= 1) {
-                                if (dynamic_cast<StringLiteral*>(node.arguments[0].get())) keyIsString = true;
-                                auto* keyIdentifier = dynamic_cast<Identifier*>(
+                                if (ast_cast<StringLiteral>(node.arguments[0].get())) keyIsString = true;
+                                auto* keyIdentifier = ast_cast<Identifier>(
                                     node.arguments[0].get());
                                 if (keyIdentifier &&
                                     keyIdentifier->name == "NaN") {
@@ -8890,7 +8894,7 @@ void HIRGenerator::visit(CallExpr& node) {
                             // (returns JS_VALUE_UNDEFINED) and value-type polymorphism (number/string)
                             // in one call. Tagged as JSValue so equality checks against undefined / null
                             // go through the proper JSValue path.
-                            auto jsType = std::make_shared<HIRType>(HIRType::Kind::JSValue);
+                            auto jsType = HIRType::get(HIRType::Kind::JSValue);
                             std::string runtimeFunc = keyIsString ? "nova_map_get_str_jsvalue" : "nova_map_get_num_jsvalue";
                             std::vector<HIRTypePtr> paramTypes = keyIsString ? std::vector<HIRTypePtr>{ptrType, ptrType} : std::vector<HIRTypePtr>{ptrType, intType};
                             HIRFunction* func = nullptr;
@@ -8910,8 +8914,8 @@ void HIRGenerator::visit(CallExpr& node) {
                             HIRValue* keyArg = nullptr;
                             bool keyIsString = false;
                             if (node.arguments.size() >= 1) {
-                                if (dynamic_cast<StringLiteral*>(node.arguments[0].get())) keyIsString = true;
-                                auto* keyIdentifier = dynamic_cast<Identifier*>(
+                                if (ast_cast<StringLiteral>(node.arguments[0].get())) keyIsString = true;
+                                auto* keyIdentifier = ast_cast<Identifier>(
                                     node.arguments[0].get());
                                 if (keyIdentifier &&
                                     keyIdentifier->name == "NaN") {
@@ -8935,8 +8939,8 @@ void HIRGenerator::visit(CallExpr& node) {
                             HIRValue* keyArg = nullptr;
                             bool keyIsString = false;
                             if (node.arguments.size() >= 1) {
-                                if (dynamic_cast<StringLiteral*>(node.arguments[0].get())) keyIsString = true;
-                                auto* keyIdentifier = dynamic_cast<Identifier*>(
+                                if (ast_cast<StringLiteral>(node.arguments[0].get())) keyIsString = true;
+                                auto* keyIdentifier = ast_cast<Identifier>(
                                     node.arguments[0].get());
                                 if (keyIdentifier &&
                                     keyIdentifier->name == "NaN") {
@@ -8960,7 +8964,7 @@ void HIRGenerator::visit(CallExpr& node) {
                             HIRFunction* func = nullptr;
                             auto existingFunc = module_->getFunction("nova_map_clear");
                             if (existingFunc) func = existingFunc.get();
-                            else { std::vector<HIRTypePtr> paramTypes = {ptrType}; HIRFunctionType* funcType = new HIRFunctionType(paramTypes, std::make_shared<HIRType>(HIRType::Kind::Void)); HIRFunctionPtr funcPtr = module_->createFunction("nova_map_clear", funcType); funcPtr->linkage = HIRFunction::Linkage::External; func = funcPtr.get(); }
+                            else { std::vector<HIRTypePtr> paramTypes = {ptrType}; HIRFunctionType* funcType = new HIRFunctionType(paramTypes, HIRType::get(HIRType::Kind::Void)); HIRFunctionPtr funcPtr = module_->createFunction("nova_map_clear", funcType); funcPtr->linkage = HIRFunction::Linkage::External; func = funcPtr.get(); }
                             std::vector<HIRValue*> args = {mapObj};
                             builder_->createCall(func, args, "map_clear");
                             lastValue_ = mapObj;
@@ -9005,8 +9009,8 @@ void HIRGenerator::visit(CallExpr& node) {
                     }
                     if (objIdent && setVars_.count(objIdent->name) > 0) {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected Set method call: " << methodName << std::endl;
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                        auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                        auto intType = HIRType::get(HIRType::Kind::I64);
 
                         // Lower an add() chain iteratively. Recursively visiting
                         // each receiver builds a deeply nested HIR call graph
@@ -9016,10 +9020,10 @@ void HIRGenerator::visit(CallExpr& node) {
                             std::vector<CallExpr*> addCalls;
                             CallExpr* currentCall = &node;
                             while (currentCall) {
-                                auto* currentMember = dynamic_cast<MemberExpr*>(
+                                auto* currentMember = ast_cast<MemberExpr>(
                                     currentCall->callee.get());
                                 auto* currentMethod = currentMember
-                                    ? dynamic_cast<Identifier*>(
+                                    ? ast_cast<Identifier>(
                                           currentMember->property.get())
                                     : nullptr;
                                 if (!currentMember || !currentMethod ||
@@ -9027,14 +9031,14 @@ void HIRGenerator::visit(CallExpr& node) {
                                     break;
                                 }
                                 addCalls.push_back(currentCall);
-                                currentCall = dynamic_cast<CallExpr*>(
+                                currentCall = ast_cast<CallExpr>(
                                     currentMember->object.get());
                             }
                             std::reverse(addCalls.begin(), addCalls.end());
 
                             objIdent->accept(*this);
                             HIRValue* chainedSet = lastValue_;
-                            auto jsType = std::make_shared<HIRType>(
+                            auto jsType = HIRType::get(
                                 HIRType::Kind::JSValue);
                             HIRFunction* addFunction = nullptr;
                             if (auto existing =
@@ -9106,7 +9110,7 @@ void HIRGenerator::visit(CallExpr& node) {
                             HIRFunction* func = nullptr;
                             auto existingFunc = module_->getFunction("nova_set_add");
                             if (existingFunc) func = existingFunc.get();
-                            else { HIRFunctionType* funcType = new HIRFunctionType(std::vector<HIRTypePtr>{ptrType, std::make_shared<HIRType>(HIRType::Kind::JSValue)}, ptrType); HIRFunctionPtr funcPtr = module_->createFunction("nova_set_add", funcType); funcPtr->linkage = HIRFunction::Linkage::External; func = funcPtr.get(); }
+                            else { HIRFunctionType* funcType = new HIRFunctionType(std::vector<HIRTypePtr>{ptrType, HIRType::get(HIRType::Kind::JSValue)}, ptrType); HIRFunctionPtr funcPtr = module_->createFunction("nova_set_add", funcType); funcPtr->linkage = HIRFunction::Linkage::External; func = funcPtr.get(); }
                             std::vector<HIRValue*> args = {setObj, valueArg};
                             lastValue_ = builder_->createCall(func, args, "set_add");
                             return;
@@ -9119,7 +9123,7 @@ void HIRGenerator::visit(CallExpr& node) {
                             HIRFunction* func = nullptr;
                             auto existingFunc = module_->getFunction("nova_set_has");
                             if (existingFunc) func = existingFunc.get();
-                            else { HIRFunctionType* funcType = new HIRFunctionType(std::vector<HIRTypePtr>{ptrType, std::make_shared<HIRType>(HIRType::Kind::JSValue)}, intType); HIRFunctionPtr funcPtr = module_->createFunction("nova_set_has", funcType); funcPtr->linkage = HIRFunction::Linkage::External; func = funcPtr.get(); }
+                            else { HIRFunctionType* funcType = new HIRFunctionType(std::vector<HIRTypePtr>{ptrType, HIRType::get(HIRType::Kind::JSValue)}, intType); HIRFunctionPtr funcPtr = module_->createFunction("nova_set_has", funcType); funcPtr->linkage = HIRFunction::Linkage::External; func = funcPtr.get(); }
                             std::vector<HIRValue*> args = {setObj, valueArg};
                             lastValue_ = builder_->createCall(func, args, "set_has");
                             return;
@@ -9132,7 +9136,7 @@ void HIRGenerator::visit(CallExpr& node) {
                             HIRFunction* func = nullptr;
                             auto existingFunc = module_->getFunction("nova_set_delete");
                             if (existingFunc) func = existingFunc.get();
-                            else { HIRFunctionType* funcType = new HIRFunctionType(std::vector<HIRTypePtr>{ptrType, std::make_shared<HIRType>(HIRType::Kind::JSValue)}, intType); HIRFunctionPtr funcPtr = module_->createFunction("nova_set_delete", funcType); funcPtr->linkage = HIRFunction::Linkage::External; func = funcPtr.get(); }
+                            else { HIRFunctionType* funcType = new HIRFunctionType(std::vector<HIRTypePtr>{ptrType, HIRType::get(HIRType::Kind::JSValue)}, intType); HIRFunctionPtr funcPtr = module_->createFunction("nova_set_delete", funcType); funcPtr->linkage = HIRFunction::Linkage::External; func = funcPtr.get(); }
                             std::vector<HIRValue*> args = {setObj, valueArg};
                             lastValue_ = builder_->createCall(func, args, "set_delete");
                             return;
@@ -9140,7 +9144,7 @@ void HIRGenerator::visit(CallExpr& node) {
                             HIRFunction* func = nullptr;
                             auto existingFunc = module_->getFunction("nova_set_clear");
                             if (existingFunc) func = existingFunc.get();
-                            else { std::vector<HIRTypePtr> paramTypes = {ptrType}; HIRFunctionType* funcType = new HIRFunctionType(paramTypes, std::make_shared<HIRType>(HIRType::Kind::Void)); HIRFunctionPtr funcPtr = module_->createFunction("nova_set_clear", funcType); funcPtr->linkage = HIRFunction::Linkage::External; func = funcPtr.get(); }
+                            else { std::vector<HIRTypePtr> paramTypes = {ptrType}; HIRFunctionType* funcType = new HIRFunctionType(paramTypes, HIRType::get(HIRType::Kind::Void)); HIRFunctionPtr funcPtr = module_->createFunction("nova_set_clear", funcType); funcPtr->linkage = HIRFunction::Linkage::External; func = funcPtr.get(); }
                             std::vector<HIRValue*> args = {setObj};
                             builder_->createCall(func, args, "set_clear");
                             lastValue_ = setObj;
@@ -9157,8 +9161,8 @@ void HIRGenerator::visit(CallExpr& node) {
                     }
                     if (weakMapVars_.count(objIdent->name) > 0) {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected WeakMap method call: " << methodName << std::endl;
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                        auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                        auto intType = HIRType::get(HIRType::Kind::I64);
                         memberExpr->object->accept(*this);
                         HIRValue* weakMapObj = lastValue_;
                         if (methodName == "set") {
@@ -9169,7 +9173,7 @@ void HIRGenerator::visit(CallExpr& node) {
                             HIRFunction* func = nullptr;
                             auto existingFunc = module_->getFunction("nova_weakmap_set_obj_jsvalue");
                             if (existingFunc) func = existingFunc.get();
-                            else { HIRFunctionType* funcType = new HIRFunctionType(std::vector<HIRTypePtr>{ptrType, ptrType, std::make_shared<HIRType>(HIRType::Kind::JSValue)}, ptrType); HIRFunctionPtr funcPtr = module_->createFunction("nova_weakmap_set_obj_jsvalue", funcType); funcPtr->linkage = HIRFunction::Linkage::External; func = funcPtr.get(); }
+                            else { HIRFunctionType* funcType = new HIRFunctionType(std::vector<HIRTypePtr>{ptrType, ptrType, HIRType::get(HIRType::Kind::JSValue)}, ptrType); HIRFunctionPtr funcPtr = module_->createFunction("nova_weakmap_set_obj_jsvalue", funcType); funcPtr->linkage = HIRFunction::Linkage::External; func = funcPtr.get(); }
                             std::vector<HIRValue*> args = {weakMapObj, keyArg, valueArg};
                             lastValue_ = builder_->createCall(func, args, "weakmap_set");
                             return;
@@ -9179,10 +9183,10 @@ void HIRGenerator::visit(CallExpr& node) {
                             HIRFunction* func = nullptr;
                             auto existingFunc = module_->getFunction("nova_weakmap_get_jsvalue");
                             if (existingFunc) func = existingFunc.get();
-                            else { HIRFunctionType* funcType = new HIRFunctionType(std::vector<HIRTypePtr>{ptrType, ptrType}, std::make_shared<HIRType>(HIRType::Kind::JSValue)); HIRFunctionPtr funcPtr = module_->createFunction("nova_weakmap_get_jsvalue", funcType); funcPtr->linkage = HIRFunction::Linkage::External; func = funcPtr.get(); }
+                            else { HIRFunctionType* funcType = new HIRFunctionType(std::vector<HIRTypePtr>{ptrType, ptrType}, HIRType::get(HIRType::Kind::JSValue)); HIRFunctionPtr funcPtr = module_->createFunction("nova_weakmap_get_jsvalue", funcType); funcPtr->linkage = HIRFunction::Linkage::External; func = funcPtr.get(); }
                             std::vector<HIRValue*> args = {weakMapObj, keyArg};
                             lastValue_ = builder_->createCall(func, args, "weakmap_get");
-                            lastValue_->type = std::make_shared<HIRType>(HIRType::Kind::JSValue);
+                            lastValue_->type = HIRType::get(HIRType::Kind::JSValue);
                             return;
                         } else if (methodName == "has") {
                             HIRValue* keyArg = nullptr;
@@ -9208,8 +9212,8 @@ void HIRGenerator::visit(CallExpr& node) {
                     }
                     if (weakSetVars_.count(objIdent->name) > 0) {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected WeakSet method call: " << methodName << std::endl;
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                        auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                        auto intType = HIRType::get(HIRType::Kind::I64);
                         memberExpr->object->accept(*this);
                         HIRValue* weakSetObj = lastValue_;
                         if (methodName == "add") {
@@ -9250,7 +9254,7 @@ void HIRGenerator::visit(CallExpr& node) {
             memberExpr->object->accept(*this);
             HIRValue* object = lastValue_;
 
-            if (auto* propExpr = dynamic_cast<Identifier*>(memberExpr->property.get())) {
+            if (auto* propExpr = ast_cast<Identifier>(memberExpr->property.get())) {
                 std::string methodName = propExpr->name;
 
                 // Check if object is a string type
@@ -9275,142 +9279,142 @@ void HIRGenerator::visit(CallExpr& node) {
 
                     if (methodName == "substring") {
                         runtimeFuncName = "nova_string_substring";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));
-                        returnType = std::make_shared<HIRType>(HIRType::Kind::String);
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::I64));
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::I64));
+                        returnType = HIRType::get(HIRType::Kind::String);
                     } else if (methodName == "substr") {
                         // substr(start, length) — legacy but supported.
                         // Dispatch on argument count: 2 args → substr(start,len);
                         // 1 arg → substr_from(start) (start to end of string).
                         if (node.arguments.size() >= 2) {
                             runtimeFuncName = "nova_string_substr";
-                            paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                            paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));
-                            paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));
+                            paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                            paramTypes.push_back(HIRType::get(HIRType::Kind::I64));
+                            paramTypes.push_back(HIRType::get(HIRType::Kind::I64));
                         } else {
                             runtimeFuncName = "nova_string_substr_from";
-                            paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                            paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));
+                            paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                            paramTypes.push_back(HIRType::get(HIRType::Kind::I64));
                         }
-                        returnType = std::make_shared<HIRType>(HIRType::Kind::String);
+                        returnType = HIRType::get(HIRType::Kind::String);
                     } else if (methodName == "indexOf") {
                         runtimeFuncName = "nova_string_indexOf";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                        returnType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                        returnType = HIRType::get(HIRType::Kind::I64);
                     } else if (methodName == "lastIndexOf") {
                         // str.lastIndexOf(searchString)
                         // Searches from end to start, returns last occurrence index
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected string method call: lastIndexOf" << std::endl;
                         runtimeFuncName = "nova_string_lastIndexOf";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                        returnType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                        returnType = HIRType::get(HIRType::Kind::I64);
                     } else if (methodName == "charAt") {
                         runtimeFuncName = "nova_string_charAt";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));
-                        returnType = std::make_shared<HIRType>(HIRType::Kind::String);
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::I64));
+                        returnType = HIRType::get(HIRType::Kind::String);
                     } else if (methodName == "charCodeAt") {
                         // str.charCodeAt(index)
                         // Returns character code (ASCII/Unicode value) at index
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected string method call: charCodeAt" << std::endl;
                         runtimeFuncName = "nova_string_charCodeAt";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));
-                        returnType = std::make_shared<HIRType>(HIRType::Kind::I64);  // Returns character code as i64
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::I64));
+                        returnType = HIRType::get(HIRType::Kind::I64);  // Returns character code as i64
                     } else if (methodName == "codePointAt") {
                         // str.codePointAt(index)
                         // Returns Unicode code point at index (ES2015)
                         // Like charCodeAt but handles full Unicode including surrogate pairs
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected string method call: codePointAt" << std::endl;
                         runtimeFuncName = "nova_string_codePointAt";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));
-                        returnType = std::make_shared<HIRType>(HIRType::Kind::I64);  // Returns code point as i64
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::I64));
+                        returnType = HIRType::get(HIRType::Kind::I64);  // Returns code point as i64
                     } else if (methodName == "at") {
                         // str.at(index)
                         // Returns single-character string at index (supports negative indices)
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected string method call: at" << std::endl;
                         runtimeFuncName = "nova_string_at";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));
-                        returnType = std::make_shared<HIRType>(HIRType::Kind::String);  // Returns single-char string
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::I64));
+                        returnType = HIRType::get(HIRType::Kind::String);  // Returns single-char string
                     } else if (methodName == "concat") {
                         // str.concat(otherStr)
                         // Concatenates two strings together
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected string method call: concat" << std::endl;
                         runtimeFuncName = "nova_string_concat";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                        returnType = std::make_shared<HIRType>(HIRType::Kind::String);
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                        returnType = HIRType::get(HIRType::Kind::String);
                     } else if (methodName == "toLowerCase") {
                         runtimeFuncName = "nova_string_toLowerCase";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                        returnType = std::make_shared<HIRType>(HIRType::Kind::String);
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                        returnType = HIRType::get(HIRType::Kind::String);
                     } else if (methodName == "toUpperCase") {
                         runtimeFuncName = "nova_string_toUpperCase";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                        returnType = std::make_shared<HIRType>(HIRType::Kind::String);
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                        returnType = HIRType::get(HIRType::Kind::String);
                     } else if (methodName == "trim") {
                         runtimeFuncName = "nova_string_trim";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                        returnType = std::make_shared<HIRType>(HIRType::Kind::String);
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                        returnType = HIRType::get(HIRType::Kind::String);
                     } else if (methodName == "trimStart" || methodName == "trimLeft") {
                         // str.trimStart() or str.trimLeft()
                         // Removes whitespace from the beginning of the string
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected string method call: " << methodName << std::endl;
                         runtimeFuncName = "nova_string_trimStart";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                        returnType = std::make_shared<HIRType>(HIRType::Kind::String);
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                        returnType = HIRType::get(HIRType::Kind::String);
                     } else if (methodName == "trimEnd" || methodName == "trimRight") {
                         // str.trimEnd() or str.trimRight()
                         // Removes whitespace from the end of the string
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected string method call: " << methodName << std::endl;
                         runtimeFuncName = "nova_string_trimEnd";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                        returnType = std::make_shared<HIRType>(HIRType::Kind::String);
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                        returnType = HIRType::get(HIRType::Kind::String);
                     } else if (methodName == "startsWith") {
                         runtimeFuncName = "nova_string_startsWith";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                        returnType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                        returnType = HIRType::get(HIRType::Kind::I64);
                     } else if (methodName == "endsWith") {
                         runtimeFuncName = "nova_string_endsWith";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                        returnType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                        returnType = HIRType::get(HIRType::Kind::I64);
                     } else if (methodName == "repeat") {
                         runtimeFuncName = "nova_string_repeat";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));
-                        returnType = std::make_shared<HIRType>(HIRType::Kind::String);
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::I64));
+                        returnType = HIRType::get(HIRType::Kind::String);
                     } else if (methodName == "includes") {
                         runtimeFuncName = "nova_string_includes";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                        returnType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                        returnType = HIRType::get(HIRType::Kind::I64);
                     } else if (methodName == "slice") {
                         // Dispatch on argument count: 2 args → slice(start, end);
                         // 1 arg → slice_from(start) (start to end of string).
                         if (node.arguments.size() >= 2) {
                             runtimeFuncName = "nova_string_slice";
-                            paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                            paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));
-                            paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));
+                            paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                            paramTypes.push_back(HIRType::get(HIRType::Kind::I64));
+                            paramTypes.push_back(HIRType::get(HIRType::Kind::I64));
                         } else {
                             runtimeFuncName = "nova_string_slice_from";
-                            paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                            paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));
+                            paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                            paramTypes.push_back(HIRType::get(HIRType::Kind::I64));
                         }
-                        returnType = std::make_shared<HIRType>(HIRType::Kind::String);
+                        returnType = HIRType::get(HIRType::Kind::String);
                     } else if (methodName == "replace") {
                         // Dispatch on first-arg shape: regex → nova_string_replace_regex,
                         // plain string → nova_string_replace.
                         bool patIsRegex = false;
                         if (node.arguments.size() >= 1 &&
-                            dynamic_cast<RegexLiteralExpr*>(node.arguments[0].get())) {
+                            ast_cast<RegexLiteralExpr>(node.arguments[0].get())) {
                             patIsRegex = true;
                         }
                         // NOTE: do not re-evaluate the argument here to inspect
@@ -9420,53 +9424,53 @@ void HIRGenerator::visit(CallExpr& node) {
                         // `args`, dropping the call arguments entirely.
                         if (patIsRegex) {
                             runtimeFuncName = "nova_string_replace_regex";
-                            paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                            paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Any));
-                            paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
+                            paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                            paramTypes.push_back(HIRType::get(HIRType::Kind::Any));
+                            paramTypes.push_back(HIRType::get(HIRType::Kind::String));
                         } else {
                             runtimeFuncName = "nova_string_replace";
-                            paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                            paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                            paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
+                            paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                            paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                            paramTypes.push_back(HIRType::get(HIRType::Kind::String));
                         }
-                        returnType = std::make_shared<HIRType>(HIRType::Kind::String);
+                        returnType = HIRType::get(HIRType::Kind::String);
                     } else if (methodName == "replaceAll") {
                         // str.replaceAll(search, replace) - ES2021
                         // Replaces ALL occurrences (not just first like replace())
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected string method call: replaceAll" << std::endl;
                         runtimeFuncName = "nova_string_replaceAll";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                        returnType = std::make_shared<HIRType>(HIRType::Kind::String);
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                        returnType = HIRType::get(HIRType::Kind::String);
                     } else if (methodName == "padStart") {
                         runtimeFuncName = "nova_string_padStart";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                        returnType = std::make_shared<HIRType>(HIRType::Kind::String);
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::I64));
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                        returnType = HIRType::get(HIRType::Kind::String);
                     } else if (methodName == "padEnd") {
                         runtimeFuncName = "nova_string_padEnd";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                        returnType = std::make_shared<HIRType>(HIRType::Kind::String);
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::I64));
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                        returnType = HIRType::get(HIRType::Kind::String);
                     } else if (methodName == "split") {
                         const bool separatorIsRegex =
                             !node.arguments.empty() &&
-                            dynamic_cast<RegexLiteralExpr*>(
+                            ast_cast<RegexLiteralExpr>(
                                 node.arguments[0].get()) != nullptr;
                         runtimeFuncName = separatorIsRegex
                             ? "nova_string_split_regex"
                             : "nova_string_split";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                        paramTypes.push_back(std::make_shared<HIRType>(
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                        paramTypes.push_back(HIRType::get(
                             separatorIsRegex ? HIRType::Kind::Any
                                              : HIRType::Kind::String));
                         // Return pointer to array of strings so .length and
                         // element access use the string-array code paths.
                         {
-                            auto elemType = std::make_shared<HIRType>(HIRType::Kind::String);
+                            auto elemType = HIRType::get(HIRType::Kind::String);
                             auto arrTy = std::make_shared<hir::HIRArrayType>(elemType, 0);
                             returnType = std::make_shared<hir::HIRPointerType>(arrTy, true);
                         }
@@ -9476,7 +9480,7 @@ void HIRGenerator::visit(CallExpr& node) {
                         //   plain string         → nova_string_match_substring (count)
                         bool patternIsRegex = false;
                         if (node.arguments.size() >= 1 &&
-                            dynamic_cast<RegexLiteralExpr*>(node.arguments[0].get())) {
+                            ast_cast<RegexLiteralExpr>(node.arguments[0].get())) {
                             patternIsRegex = true;
                         }
                         // Heuristic: nova regex literals surface as pointer-typed
@@ -9496,87 +9500,87 @@ void HIRGenerator::visit(CallExpr& node) {
                         }
                         if (patternIsRegex) {
                             runtimeFuncName = "nova_string_match_array";
-                            paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                            paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Any));
+                            paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                            paramTypes.push_back(HIRType::get(HIRType::Kind::Any));
                             // Pointer to string array so .length and element
                             // access use the string-array code paths.
                             {
-                                auto elemType = std::make_shared<HIRType>(HIRType::Kind::String);
+                                auto elemType = HIRType::get(HIRType::Kind::String);
                                 auto arrTy = std::make_shared<hir::HIRArrayType>(elemType, 0);
                                 returnType = std::make_shared<hir::HIRPointerType>(arrTy, true);
                             }
                         } else {
                             runtimeFuncName = "nova_string_match_substring";
-                            paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                            paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                            returnType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                            paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                            paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                            returnType = HIRType::get(HIRType::Kind::I64);
                         }
                     } else if (methodName == "matchAll") {
                         runtimeFuncName = "nova_string_matchAll";
-                        paramTypes.push_back(std::make_shared<HIRType>(
+                        paramTypes.push_back(HIRType::get(
                             HIRType::Kind::String));
-                        paramTypes.push_back(std::make_shared<HIRType>(
+                        paramTypes.push_back(HIRType::get(
                             HIRType::Kind::Any));
-                        returnType = std::make_shared<HIRType>(
+                        returnType = HIRType::get(
                             HIRType::Kind::Pointer);
                     } else if (methodName == "localeCompare") {
                         // str.localeCompare(other) - compare strings
                         // Returns: -1 if str < other, 0 if equal, 1 if str > other
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected string method call: localeCompare" << std::endl;
                         runtimeFuncName = "nova_string_localeCompare";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                        returnType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                        returnType = HIRType::get(HIRType::Kind::I64);
                     } else if (methodName == "search") {
                         // str.search(regex) - find first match index
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected string method call: search" << std::endl;
                         runtimeFuncName = "nova_string_search";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Any));  // regex object
-                        returnType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Any));  // regex object
+                        returnType = HIRType::get(HIRType::Kind::I64);
                     } else if (methodName == "toString") {
                         // str.toString() - returns the string itself (ES1)
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected string method call: toString" << std::endl;
                         runtimeFuncName = "nova_string_toString";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                        returnType = std::make_shared<HIRType>(HIRType::Kind::String);
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                        returnType = HIRType::get(HIRType::Kind::String);
                     } else if (methodName == "valueOf") {
                         // str.valueOf() - returns primitive string value (ES1)
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected string method call: valueOf" << std::endl;
                         runtimeFuncName = "nova_string_valueOf";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                        returnType = std::make_shared<HIRType>(HIRType::Kind::String);
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                        returnType = HIRType::get(HIRType::Kind::String);
                     } else if (methodName == "toLocaleLowerCase") {
                         // str.toLocaleLowerCase() - locale-aware lowercase (ES1)
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected string method call: toLocaleLowerCase" << std::endl;
                         runtimeFuncName = "nova_string_toLocaleLowerCase";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                        returnType = std::make_shared<HIRType>(HIRType::Kind::String);
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                        returnType = HIRType::get(HIRType::Kind::String);
                     } else if (methodName == "toLocaleUpperCase") {
                         // str.toLocaleUpperCase() - locale-aware uppercase (ES1)
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected string method call: toLocaleUpperCase" << std::endl;
                         runtimeFuncName = "nova_string_toLocaleUpperCase";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                        returnType = std::make_shared<HIRType>(HIRType::Kind::String);
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                        returnType = HIRType::get(HIRType::Kind::String);
                     } else if (methodName == "normalize") {
                         // str.normalize(form) - Unicode normalization (ES2015)
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected string method call: normalize" << std::endl;
                         runtimeFuncName = "nova_string_normalize";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));  // form parameter
-                        returnType = std::make_shared<HIRType>(HIRType::Kind::String);
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::String));  // form parameter
+                        returnType = HIRType::get(HIRType::Kind::String);
                     } else if (methodName == "isWellFormed") {
                         // str.isWellFormed() - check if well-formed Unicode (ES2024)
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected string method call: isWellFormed" << std::endl;
                         runtimeFuncName = "nova_string_isWellFormed";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                        returnType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                        returnType = HIRType::get(HIRType::Kind::I64);
                     } else if (methodName == "toWellFormed") {
                         // str.toWellFormed() - convert to well-formed Unicode (ES2024)
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected string method call: toWellFormed" << std::endl;
                         runtimeFuncName = "nova_string_toWellFormed";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-                        returnType = std::make_shared<HIRType>(HIRType::Kind::String);
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+                        returnType = HIRType::get(HIRType::Kind::String);
                     } else {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Unknown string method: " << methodName << std::endl;
                         lastValue_ = nullptr;
@@ -9651,52 +9655,52 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Returns string representation
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected number method call: toFixed" << std::endl;
                         runtimeFuncName = "nova_number_toFixed";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::F64));  // number (as F64)
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));  // digits (i64)
-                        returnType = std::make_shared<HIRType>(HIRType::Kind::String);  // returns string
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::F64));  // number (as F64)
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::I64));  // digits (i64)
+                        returnType = HIRType::get(HIRType::Kind::String);  // returns string
                     } else if (methodName == "toExponential") {
                         // num.toExponential(fractionDigits)
                         // Formats number in exponential notation (scientific notation)
                         // Returns string representation
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected number method call: toExponential" << std::endl;
                         runtimeFuncName = "nova_number_toExponential";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::F64));  // number (as F64)
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));  // fractionDigits (i64)
-                        returnType = std::make_shared<HIRType>(HIRType::Kind::String);  // returns string
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::F64));  // number (as F64)
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::I64));  // fractionDigits (i64)
+                        returnType = HIRType::get(HIRType::Kind::String);  // returns string
                     } else if (methodName == "toPrecision") {
                         // num.toPrecision(precision)
                         // Formats number with specified precision (total significant digits)
                         // Returns string representation
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected number method call: toPrecision" << std::endl;
                         runtimeFuncName = "nova_number_toPrecision";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::F64));  // number (as F64)
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));  // precision (i64)
-                        returnType = std::make_shared<HIRType>(HIRType::Kind::String);  // returns string
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::F64));  // number (as F64)
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::I64));  // precision (i64)
+                        returnType = HIRType::get(HIRType::Kind::String);  // returns string
                     } else if (methodName == "toString") {
                         // num.toString(radix)
                         // Converts number to string with optional radix (base 2-36)
                         // Returns string representation
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected number method call: toString" << std::endl;
                         runtimeFuncName = "nova_number_toString";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::F64));  // number (as F64)
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));  // radix (i64)
-                        returnType = std::make_shared<HIRType>(HIRType::Kind::String);  // returns string
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::F64));  // number (as F64)
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::I64));  // radix (i64)
+                        returnType = HIRType::get(HIRType::Kind::String);  // returns string
                     } else if (methodName == "valueOf") {
                         // num.valueOf()
                         // Returns the primitive value of a Number object
                         // No parameters beyond the number itself
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected number method call: valueOf" << std::endl;
                         runtimeFuncName = "nova_number_valueOf";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::F64));  // number (as F64)
-                        returnType = std::make_shared<HIRType>(HIRType::Kind::F64);  // returns F64
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::F64));  // number (as F64)
+                        returnType = HIRType::get(HIRType::Kind::F64);  // returns F64
                     } else if (methodName == "toLocaleString") {
                         // num.toLocaleString()
                         // Formats number with locale-specific separators (e.g., 1,234.56)
                         // Returns string representation
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected number method call: toLocaleString" << std::endl;
                         runtimeFuncName = "nova_number_toLocaleString";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::F64));  // number (as F64)
-                        returnType = std::make_shared<HIRType>(HIRType::Kind::String);  // returns string
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::F64));  // number (as F64)
+                        returnType = HIRType::get(HIRType::Kind::String);  // returns string
                     } else {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Unknown number method: " << methodName << std::endl;
                         lastValue_ = builder_->createIntConstant(0);
@@ -9748,15 +9752,15 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Returns "true" or "false"
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected boolean method call: toString" << std::endl;
                         runtimeFuncName = "nova_boolean_toString";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));  // boolean as i64
-                        returnType = std::make_shared<HIRType>(HIRType::Kind::String);  // returns string
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::I64));  // boolean as i64
+                        returnType = HIRType::get(HIRType::Kind::String);  // returns string
                     } else if (methodName == "valueOf") {
                         // bool.valueOf()
                         // Returns the primitive boolean value (0 or 1)
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected boolean method call: valueOf" << std::endl;
                         runtimeFuncName = "nova_boolean_valueOf";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));  // boolean as i64
-                        returnType = std::make_shared<HIRType>(HIRType::Kind::I64);  // returns i64
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::I64));  // boolean as i64
+                        returnType = HIRType::get(HIRType::Kind::I64);  // returns i64
                     } else {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Unknown boolean method: " << methodName << std::endl;
                         lastValue_ = builder_->createIntConstant(0);
@@ -9788,13 +9792,13 @@ void HIRGenerator::visit(CallExpr& node) {
                 }
 
                 // Check if object is a BigInt (ES2020)
-                if (auto* objIdent = dynamic_cast<Identifier*>(memberExpr->object.get())) {
+                if (auto* objIdent = ast_cast<Identifier>(memberExpr->object.get())) {
                     if (bigIntVars_.count(objIdent->name) > 0) {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected BigInt method call: " << methodName << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                        auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
-                        auto strType = std::make_shared<HIRType>(HIRType::Kind::String);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                        auto intType = HIRType::get(HIRType::Kind::I64);
+                        auto strType = HIRType::get(HIRType::Kind::String);
 
                         std::string runtimeFuncName;
                         std::vector<HIRTypePtr> paramTypes;
@@ -9864,15 +9868,15 @@ void HIRGenerator::visit(CallExpr& node) {
                 }
 
                 // Check if object is a Date (ES1)
-                if (auto* objIdent = dynamic_cast<Identifier*>(memberExpr->object.get())) {
+                if (auto* objIdent = ast_cast<Identifier>(memberExpr->object.get())) {
                     if (dateVars_.count(objIdent->name) > 0) {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected Date method call: " << methodName << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                        auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
-                        auto strType = std::make_shared<HIRType>(HIRType::Kind::String);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                        auto intType = HIRType::get(HIRType::Kind::I64);
+                        auto strType = HIRType::get(HIRType::Kind::String);
                         auto jsValueType =
-                            std::make_shared<HIRType>(
+                            HIRType::get(
                                 HIRType::Kind::JSValue);
 
                         std::string runtimeFuncName;
@@ -10152,12 +10156,12 @@ void HIRGenerator::visit(CallExpr& node) {
                 }
 
                 // Check if object is an Error (ES1)
-                if (auto* objIdent = dynamic_cast<Identifier*>(memberExpr->object.get())) {
+                if (auto* objIdent = ast_cast<Identifier>(memberExpr->object.get())) {
                     if (errorVars_.count(objIdent->name) > 0) {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected Error method call: " << methodName << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                        auto strType = std::make_shared<HIRType>(HIRType::Kind::String);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                        auto strType = HIRType::get(HIRType::Kind::String);
 
                         if (methodName == "toString") {
                             // Get the Error variable
@@ -10196,12 +10200,12 @@ void HIRGenerator::visit(CallExpr& node) {
                 }
 
                 // Check if object is a SuppressedError (ES2024)
-                if (auto* objIdent = dynamic_cast<Identifier*>(memberExpr->object.get())) {
+                if (auto* objIdent = ast_cast<Identifier>(memberExpr->object.get())) {
                     if (suppressedErrorVars_.count(objIdent->name) > 0) {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected SuppressedError method/property call: " << methodName << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                        auto strType = std::make_shared<HIRType>(HIRType::Kind::String);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                        auto strType = HIRType::get(HIRType::Kind::String);
 
                         // Get the SuppressedError variable
                         HIRValue* errObj = nullptr;
@@ -10246,12 +10250,12 @@ void HIRGenerator::visit(CallExpr& node) {
                 }
 
                 // Check if object is a Symbol (ES2015)
-                if (auto* objIdent = dynamic_cast<Identifier*>(memberExpr->object.get())) {
+                if (auto* objIdent = ast_cast<Identifier>(memberExpr->object.get())) {
                     if (symbolVars_.count(objIdent->name) > 0) {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected Symbol method call: " << methodName << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                        auto strType = std::make_shared<HIRType>(HIRType::Kind::String);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                        auto strType = HIRType::get(HIRType::Kind::String);
 
                         // Get the Symbol variable
                         HIRValue* symObj = nullptr;
@@ -10299,13 +10303,13 @@ void HIRGenerator::visit(CallExpr& node) {
                 }
 
                 // Check if object is an Intl.NumberFormat
-                if (auto* objIdent = dynamic_cast<Identifier*>(memberExpr->object.get())) {
+                if (auto* objIdent = ast_cast<Identifier>(memberExpr->object.get())) {
                     if (numberFormatVars_.count(objIdent->name) > 0) {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected NumberFormat method call: " << methodName << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                        auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
-                        auto dblType = std::make_shared<HIRType>(HIRType::Kind::F64);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                        auto intType = HIRType::get(HIRType::Kind::I64);
+                        auto dblType = HIRType::get(HIRType::Kind::F64);
 
                         // Get the NumberFormat object
                         memberExpr->object->accept(*this);
@@ -10381,12 +10385,12 @@ void HIRGenerator::visit(CallExpr& node) {
                 }
 
                 // Check if object is an Intl.DateTimeFormat
-                if (auto* objIdent = dynamic_cast<Identifier*>(memberExpr->object.get())) {
+                if (auto* objIdent = ast_cast<Identifier>(memberExpr->object.get())) {
                     if (dateTimeFormatVars_.count(objIdent->name) > 0) {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected DateTimeFormat method call: " << methodName << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                        auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                        auto intType = HIRType::get(HIRType::Kind::I64);
 
                         // Get the DateTimeFormat object
                         memberExpr->object->accept(*this);
@@ -10497,12 +10501,12 @@ void HIRGenerator::visit(CallExpr& node) {
                 }
 
                 // Check if object is an Intl.Collator
-                if (auto* objIdent = dynamic_cast<Identifier*>(memberExpr->object.get())) {
+                if (auto* objIdent = ast_cast<Identifier>(memberExpr->object.get())) {
                     if (collatorVars_.count(objIdent->name) > 0) {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected Collator method call: " << methodName << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                        auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                        auto intType = HIRType::get(HIRType::Kind::I64);
 
                         memberExpr->object->accept(*this);
                         HIRValue* collObj = lastValue_;
@@ -10556,12 +10560,12 @@ void HIRGenerator::visit(CallExpr& node) {
                 }
 
                 // Check if object is an Intl.PluralRules
-                if (auto* objIdent = dynamic_cast<Identifier*>(memberExpr->object.get())) {
+                if (auto* objIdent = ast_cast<Identifier>(memberExpr->object.get())) {
                     if (pluralRulesVars_.count(objIdent->name) > 0) {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected PluralRules method call: " << methodName << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                        auto dblType = std::make_shared<HIRType>(HIRType::Kind::F64);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                        auto dblType = HIRType::get(HIRType::Kind::F64);
 
                         memberExpr->object->accept(*this);
                         HIRValue* prObj = lastValue_;
@@ -10639,12 +10643,12 @@ void HIRGenerator::visit(CallExpr& node) {
                 }
 
                 // Check if object is an Intl.RelativeTimeFormat
-                if (auto* objIdent = dynamic_cast<Identifier*>(memberExpr->object.get())) {
+                if (auto* objIdent = ast_cast<Identifier>(memberExpr->object.get())) {
                     if (relativeTimeFormatVars_.count(objIdent->name) > 0) {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected RelativeTimeFormat method call: " << methodName << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                        auto dblType = std::make_shared<HIRType>(HIRType::Kind::F64);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                        auto dblType = HIRType::get(HIRType::Kind::F64);
 
                         memberExpr->object->accept(*this);
                         HIRValue* rtfObj = lastValue_;
@@ -10726,11 +10730,11 @@ void HIRGenerator::visit(CallExpr& node) {
                 }
 
                 // Check if object is an Intl.ListFormat
-                if (auto* objIdent = dynamic_cast<Identifier*>(memberExpr->object.get())) {
+                if (auto* objIdent = ast_cast<Identifier>(memberExpr->object.get())) {
                     if (listFormatVars_.count(objIdent->name) > 0) {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected ListFormat method call: " << methodName << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
 
                         memberExpr->object->accept(*this);
                         HIRValue* lfObj = lastValue_;
@@ -10804,11 +10808,11 @@ void HIRGenerator::visit(CallExpr& node) {
                 }
 
                 // Check if object is an Intl.DisplayNames
-                if (auto* objIdent = dynamic_cast<Identifier*>(memberExpr->object.get())) {
+                if (auto* objIdent = ast_cast<Identifier>(memberExpr->object.get())) {
                     if (displayNamesVars_.count(objIdent->name) > 0) {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected DisplayNames method call: " << methodName << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
 
                         memberExpr->object->accept(*this);
                         HIRValue* dnObj = lastValue_;
@@ -10858,11 +10862,11 @@ void HIRGenerator::visit(CallExpr& node) {
                 }
 
                 // Check if object is an Intl.Locale
-                if (auto* objIdent = dynamic_cast<Identifier*>(memberExpr->object.get())) {
+                if (auto* objIdent = ast_cast<Identifier>(memberExpr->object.get())) {
                     if (localeVars_.count(objIdent->name) > 0) {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected Locale method call or property: " << methodName << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
 
                         memberExpr->object->accept(*this);
                         HIRValue* locObj = lastValue_;
@@ -10923,11 +10927,11 @@ void HIRGenerator::visit(CallExpr& node) {
                 }
 
                 // Check if object is an Intl.Segmenter
-                if (auto* objIdent = dynamic_cast<Identifier*>(memberExpr->object.get())) {
+                if (auto* objIdent = ast_cast<Identifier>(memberExpr->object.get())) {
                     if (segmenterVars_.count(objIdent->name) > 0) {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected Segmenter method call: " << methodName << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
 
                         memberExpr->object->accept(*this);
                         HIRValue* segObj = lastValue_;
@@ -10977,12 +10981,12 @@ void HIRGenerator::visit(CallExpr& node) {
                 }
 
                                 // Check if object is an Iterator (ES2025 Iterator Helpers)
-                if (auto* objIdent = dynamic_cast<Identifier*>(memberExpr->object.get())) {
+                if (auto* objIdent = ast_cast<Identifier>(memberExpr->object.get())) {
                     if (iteratorVars_.count(objIdent->name) > 0) {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected Iterator method call: " << methodName << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                        auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                        auto intType = HIRType::get(HIRType::Kind::I64);
 
                         // Get the Iterator object
                         memberExpr->object->accept(*this);
@@ -11187,7 +11191,7 @@ void HIRGenerator::visit(CallExpr& node) {
                             }
 
                             std::vector<HIRTypePtr> paramTypes = {ptrType, ptrType};
-                            auto voidType = std::make_shared<HIRType>(HIRType::Kind::Void);
+                            auto voidType = HIRType::get(HIRType::Kind::Void);
                             HIRFunction* func = nullptr;
                             auto existingFunc = module_->getFunction("nova_iterator_foreach");
                             if (existingFunc) {
@@ -11279,12 +11283,12 @@ void HIRGenerator::visit(CallExpr& node) {
                 }
 
                 // Check if object is a Map (ES2015)
-                if (auto* objIdent = dynamic_cast<Identifier*>(memberExpr->object.get())) {
+                if (auto* objIdent = ast_cast<Identifier>(memberExpr->object.get())) {
                     if (mapVars_.count(objIdent->name) > 0) {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected Map method call: " << methodName << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                        auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                        auto intType = HIRType::get(HIRType::Kind::I64);
 
                         // Get the Map object
                         memberExpr->object->accept(*this);
@@ -11298,10 +11302,10 @@ void HIRGenerator::visit(CallExpr& node) {
                             bool valueIsString = false;
 
                             if (node.arguments.size() >= 1) {
-                                if (auto* strLit = dynamic_cast<StringLiteral*>(node.arguments[0].get())) {
+                                if (ast_isa<StringLiteral>(node.arguments[0].get())) {
                                     keyIsString = true;
                                 }
-                                auto* keyIdentifier = dynamic_cast<Identifier*>(
+                                auto* keyIdentifier = ast_cast<Identifier>(
                                     node.arguments[0].get());
                                 if (keyIdentifier &&
                                     keyIdentifier->name == "NaN") {
@@ -11316,7 +11320,7 @@ void HIRGenerator::visit(CallExpr& node) {
                             }
 
                             if (node.arguments.size() >= 2) {
-                                if (auto* strLit = dynamic_cast<StringLiteral*>(node.arguments[1].get())) {
+                                if (ast_isa<StringLiteral>(node.arguments[1].get())) {
                                     valueIsString = true;
                                 }
                                 node.arguments[1]->accept(*this);
@@ -11365,10 +11369,10 @@ void HIRGenerator::visit(CallExpr& node) {
                             bool keyIsString = false;
 
                             if (node.arguments.size() >= 1) {
-                                if (auto* strLit = dynamic_cast<StringLiteral*>(node.arguments[0].get())) {
+                                if (ast_isa<StringLiteral>(node.arguments[0].get())) {
                                     keyIsString = true;
                                 }
-                                auto* keyIdentifier = dynamic_cast<Identifier*>(
+                                auto* keyIdentifier = ast_cast<Identifier>(
                                     node.arguments[0].get());
                                 if (keyIdentifier &&
                                     keyIdentifier->name == "NaN") {
@@ -11382,7 +11386,7 @@ void HIRGenerator::visit(CallExpr& node) {
                                 keyArg = builder_->createIntConstant(0);
                             }
 
-                            auto jsType = std::make_shared<HIRType>(HIRType::Kind::JSValue);
+                            auto jsType = HIRType::get(HIRType::Kind::JSValue);
                             std::string runtimeFunc = keyIsString ?
                                 "nova_map_get_str_jsvalue" : "nova_map_get_num_jsvalue";
                             std::vector<HIRTypePtr> paramTypes = keyIsString ?
@@ -11410,10 +11414,10 @@ void HIRGenerator::visit(CallExpr& node) {
                             bool keyIsString = false;
 
                             if (node.arguments.size() >= 1) {
-                                if (auto* strLit = dynamic_cast<StringLiteral*>(node.arguments[0].get())) {
+                                if (ast_isa<StringLiteral>(node.arguments[0].get())) {
                                     keyIsString = true;
                                 }
-                                auto* keyIdentifier = dynamic_cast<Identifier*>(
+                                auto* keyIdentifier = ast_cast<Identifier>(
                                     node.arguments[0].get());
                                 if (keyIdentifier &&
                                     keyIdentifier->name == "NaN") {
@@ -11452,10 +11456,10 @@ void HIRGenerator::visit(CallExpr& node) {
                             bool keyIsString = false;
 
                             if (node.arguments.size() >= 1) {
-                                if (auto* strLit = dynamic_cast<StringLiteral*>(node.arguments[0].get())) {
+                                if (ast_isa<StringLiteral>(node.arguments[0].get())) {
                                     keyIsString = true;
                                 }
-                                auto* keyIdentifier = dynamic_cast<Identifier*>(
+                                auto* keyIdentifier = ast_cast<Identifier>(
                                     node.arguments[0].get());
                                 if (keyIdentifier &&
                                     keyIdentifier->name == "NaN") {
@@ -11491,7 +11495,7 @@ void HIRGenerator::visit(CallExpr& node) {
                         } else if (methodName == "clear") {
                             // map.clear() - returns undefined
                             std::vector<HIRTypePtr> paramTypes = {ptrType};
-                            auto voidType = std::make_shared<HIRType>(HIRType::Kind::Void);
+                            auto voidType = HIRType::get(HIRType::Kind::Void);
                             HIRFunction* func = nullptr;
                             auto existingFunc = module_->getFunction("nova_map_clear");
                             if (existingFunc) {
@@ -11571,7 +11575,7 @@ void HIRGenerator::visit(CallExpr& node) {
                             }
 
                             std::vector<HIRTypePtr> paramTypes = {ptrType, ptrType};
-                            auto voidType = std::make_shared<HIRType>(HIRType::Kind::Void);
+                            auto voidType = HIRType::get(HIRType::Kind::Void);
                             HIRFunction* func = nullptr;
                             auto existingFunc = module_->getFunction("nova_map_foreach");
                             if (existingFunc) {
@@ -11593,19 +11597,19 @@ void HIRGenerator::visit(CallExpr& node) {
                 // Check if object is a Set (ES2015)
                 // Extract base variable from potentially chained calls like mySet.add(1).add(2)
                 Expr* setBaseExpr = memberExpr->object.get();
-                while (auto* callExpr = dynamic_cast<CallExpr*>(setBaseExpr)) {
-                    if (auto* innerMemberExpr = dynamic_cast<MemberExpr*>(callExpr->callee.get())) {
+                while (auto* callExpr = ast_cast<CallExpr>(setBaseExpr)) {
+                    if (auto* innerMemberExpr = ast_cast<MemberExpr>(callExpr->callee.get())) {
                         setBaseExpr = innerMemberExpr->object.get();
                     } else {
                         break;
                     }
                 }
-                if (auto* objIdent = dynamic_cast<Identifier*>(setBaseExpr)) {
+                if (auto* objIdent = ast_cast<Identifier>(setBaseExpr)) {
                     if (setVars_.count(objIdent->name) > 0) {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected Set method call: " << methodName << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                        auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                        auto intType = HIRType::get(HIRType::Kind::I64);
 
                         // Visit the full memberExpr->object (not just extracted setBaseExpr)
                         // so chained calls generate HIR for every call in the chain.
@@ -11630,7 +11634,7 @@ void HIRGenerator::visit(CallExpr& node) {
                             }
 
                             auto jsType =
-                                std::make_shared<HIRType>(HIRType::Kind::JSValue);
+                                HIRType::get(HIRType::Kind::JSValue);
                             std::vector<HIRTypePtr> paramTypes = {ptrType, jsType};
                             HIRFunction* func = nullptr;
                             auto existingFunc = module_->getFunction("nova_set_add");
@@ -11657,7 +11661,7 @@ void HIRGenerator::visit(CallExpr& node) {
                             }
 
                             auto jsType =
-                                std::make_shared<HIRType>(HIRType::Kind::JSValue);
+                                HIRType::get(HIRType::Kind::JSValue);
                             std::vector<HIRTypePtr> paramTypes = {ptrType, jsType};
                             HIRFunction* func = nullptr;
                             auto existingFunc = module_->getFunction("nova_set_has");
@@ -11684,7 +11688,7 @@ void HIRGenerator::visit(CallExpr& node) {
                             }
 
                             auto jsType =
-                                std::make_shared<HIRType>(HIRType::Kind::JSValue);
+                                HIRType::get(HIRType::Kind::JSValue);
                             std::vector<HIRTypePtr> paramTypes = {ptrType, jsType};
                             HIRFunction* func = nullptr;
                             auto existingFunc = module_->getFunction("nova_set_delete");
@@ -11703,7 +11707,7 @@ void HIRGenerator::visit(CallExpr& node) {
                         } else if (methodName == "clear") {
                             // set.clear() - returns undefined
                             std::vector<HIRTypePtr> paramTypes = {ptrType};
-                            auto voidType = std::make_shared<HIRType>(HIRType::Kind::Void);
+                            auto voidType = HIRType::get(HIRType::Kind::Void);
                             HIRFunction* func = nullptr;
                             auto existingFunc = module_->getFunction("nova_set_clear");
                             if (existingFunc) {
@@ -11765,7 +11769,7 @@ void HIRGenerator::visit(CallExpr& node) {
                             }
 
                             std::vector<HIRTypePtr> paramTypes = {ptrType, ptrType};
-                            auto voidType = std::make_shared<HIRType>(HIRType::Kind::Void);
+                            auto voidType = HIRType::get(HIRType::Kind::Void);
                             HIRFunction* func = nullptr;
                             auto existingFunc = module_->getFunction("nova_set_forEach");
                             if (existingFunc) {
@@ -11964,12 +11968,12 @@ void HIRGenerator::visit(CallExpr& node) {
                 }
 
                 // Check if object is a WeakMap (ES2015)
-                if (auto* objIdent = dynamic_cast<Identifier*>(memberExpr->object.get())) {
+                if (auto* objIdent = ast_cast<Identifier>(memberExpr->object.get())) {
                     if (weakMapVars_.count(objIdent->name) > 0) {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected WeakMap method call: " << methodName << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                        auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                        auto intType = HIRType::get(HIRType::Kind::I64);
 
                         // Get the WeakMap object
                         memberExpr->object->accept(*this);
@@ -11989,7 +11993,7 @@ void HIRGenerator::visit(CallExpr& node) {
                             }
 
                             if (node.arguments.size() >= 2) {
-                                if (auto* strLit = dynamic_cast<StringLiteral*>(node.arguments[1].get())) {
+                                if (ast_isa<StringLiteral>(node.arguments[1].get())) {
                                     valueIsString = true;
                                 }
                                 node.arguments[1]->accept(*this);
@@ -12052,7 +12056,7 @@ void HIRGenerator::visit(CallExpr& node) {
                             std::vector<HIRValue*> args = {weakMapObj, keyArg};
                             HIRValue* getValue = builder_->createCall(func, args, "weakmap_get");
 
-                            auto jsType = std::make_shared<HIRType>(HIRType::Kind::JSValue);
+                            auto jsType = HIRType::get(HIRType::Kind::JSValue);
                             HIRValue* undefBits = builder_->createIntConstant(
                                 static_cast<int64_t>(0x7ff9000000000000ULL));
                             HIRValue* undefBoxed = builder_->createCast(undefBits, jsType.get(), "undef_as_js");
@@ -12128,11 +12132,11 @@ void HIRGenerator::visit(CallExpr& node) {
                 }
 
                 // Check if object is a WeakRef (ES2021)
-                if (auto* objIdent = dynamic_cast<Identifier*>(memberExpr->object.get())) {
+                if (auto* objIdent = ast_cast<Identifier>(memberExpr->object.get())) {
                     if (weakRefVars_.count(objIdent->name) > 0) {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected WeakRef method call: " << methodName << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
 
                         // Get the WeakRef object
                         memberExpr->object->accept(*this);
@@ -12162,12 +12166,12 @@ void HIRGenerator::visit(CallExpr& node) {
                 }
 
                 // Check if object is a WeakSet (ES2015)
-                if (auto* objIdent = dynamic_cast<Identifier*>(memberExpr->object.get())) {
+                if (auto* objIdent = ast_cast<Identifier>(memberExpr->object.get())) {
                     if (weakSetVars_.count(objIdent->name) > 0) {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected WeakSet method call: " << methodName << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                        auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                        auto intType = HIRType::get(HIRType::Kind::I64);
 
                         // Get the WeakSet object
                         memberExpr->object->accept(*this);
@@ -12259,12 +12263,12 @@ void HIRGenerator::visit(CallExpr& node) {
                 }
 
                 // Check if object is a URL (Web API)
-                if (auto* objIdent = dynamic_cast<Identifier*>(memberExpr->object.get())) {
+                if (auto* objIdent = ast_cast<Identifier>(memberExpr->object.get())) {
                     if (urlVars_.count(objIdent->name) > 0) {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected URL method/property call: " << methodName << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                        auto strType = std::make_shared<HIRType>(HIRType::Kind::String);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                        auto strType = HIRType::get(HIRType::Kind::String);
 
                         memberExpr->object->accept(*this);
                         HIRValue* urlObj = lastValue_;
@@ -12292,13 +12296,13 @@ void HIRGenerator::visit(CallExpr& node) {
                 }
 
                 // Check if object is a URLSearchParams (Web API)
-                if (auto* objIdent = dynamic_cast<Identifier*>(memberExpr->object.get())) {
+                if (auto* objIdent = ast_cast<Identifier>(memberExpr->object.get())) {
                     if (urlSearchParamsVars_.count(objIdent->name) > 0) {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected URLSearchParams method call: " << methodName << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                        auto strType = std::make_shared<HIRType>(HIRType::Kind::String);
-                        auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                        auto strType = HIRType::get(HIRType::Kind::String);
+                        auto intType = HIRType::get(HIRType::Kind::I64);
 
                         memberExpr->object->accept(*this);
                         HIRValue* paramsObj = lastValue_;
@@ -12318,7 +12322,7 @@ void HIRGenerator::visit(CallExpr& node) {
 
                             std::string runtimeFunc = "nova_urlsearchparams_append";
                             std::vector<HIRTypePtr> paramTypes = {ptrType, strType, strType};
-                            auto voidType = std::make_shared<HIRType>(HIRType::Kind::Void);
+                            auto voidType = HIRType::get(HIRType::Kind::Void);
 
                             HIRFunction* func = nullptr;
                             auto existingFunc = module_->getFunction(runtimeFunc);
@@ -12401,7 +12405,7 @@ void HIRGenerator::visit(CallExpr& node) {
 
                             std::string runtimeFunc = "nova_urlsearchparams_set";
                             std::vector<HIRTypePtr> paramTypes = {ptrType, strType, strType};
-                            auto voidType = std::make_shared<HIRType>(HIRType::Kind::Void);
+                            auto voidType = HIRType::get(HIRType::Kind::Void);
 
                             HIRFunction* func = nullptr;
                             auto existingFunc = module_->getFunction(runtimeFunc);
@@ -12428,7 +12432,7 @@ void HIRGenerator::visit(CallExpr& node) {
 
                             std::string runtimeFunc = "nova_urlsearchparams_delete";
                             std::vector<HIRTypePtr> paramTypes = {ptrType, strType};
-                            auto voidType = std::make_shared<HIRType>(HIRType::Kind::Void);
+                            auto voidType = HIRType::get(HIRType::Kind::Void);
 
                             HIRFunction* func = nullptr;
                             auto existingFunc = module_->getFunction(runtimeFunc);
@@ -12465,7 +12469,7 @@ void HIRGenerator::visit(CallExpr& node) {
                         } else if (methodName == "sort") {
                             std::string runtimeFunc = "nova_urlsearchparams_sort";
                             std::vector<HIRTypePtr> paramTypes = {ptrType};
-                            auto voidType = std::make_shared<HIRType>(HIRType::Kind::Void);
+                            auto voidType = HIRType::get(HIRType::Kind::Void);
 
                             HIRFunction* func = nullptr;
                             auto existingFunc = module_->getFunction(runtimeFunc);
@@ -12486,12 +12490,12 @@ void HIRGenerator::visit(CallExpr& node) {
                 }
 
                 // Check if object is a TextEncoder (Web API)
-                if (auto* objIdent = dynamic_cast<Identifier*>(memberExpr->object.get())) {
+                if (auto* objIdent = ast_cast<Identifier>(memberExpr->object.get())) {
                     if (textEncoderVars_.count(objIdent->name) > 0) {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected TextEncoder method call: " << methodName << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                        auto strType = std::make_shared<HIRType>(HIRType::Kind::String);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                        auto strType = HIRType::get(HIRType::Kind::String);
 
                         memberExpr->object->accept(*this);
                         HIRValue* encoderObj = lastValue_;
@@ -12527,13 +12531,13 @@ void HIRGenerator::visit(CallExpr& node) {
                 }
 
                 // Check if object is a TextDecoder (Web API)
-                if (auto* objIdent = dynamic_cast<Identifier*>(memberExpr->object.get())) {
+                if (auto* objIdent = ast_cast<Identifier>(memberExpr->object.get())) {
                     if (textDecoderVars_.count(objIdent->name) > 0) {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected TextDecoder method call: " << methodName << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                        auto strType = std::make_shared<HIRType>(HIRType::Kind::String);
-                        auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                        auto strType = HIRType::get(HIRType::Kind::String);
+                        auto intType = HIRType::get(HIRType::Kind::I64);
 
                         memberExpr->object->accept(*this);
                         HIRValue* decoderObj = lastValue_;
@@ -12572,13 +12576,13 @@ void HIRGenerator::visit(CallExpr& node) {
                 }
 
                 // Check if object is a Headers (Web API)
-                if (auto* objIdent = dynamic_cast<Identifier*>(memberExpr->object.get())) {
+                if (auto* objIdent = ast_cast<Identifier>(memberExpr->object.get())) {
                     if (headersVars_.count(objIdent->name) > 0) {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected Headers method call: " << methodName << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                        auto strType = std::make_shared<HIRType>(HIRType::Kind::String);
-                        auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                        auto strType = HIRType::get(HIRType::Kind::String);
+                        auto intType = HIRType::get(HIRType::Kind::I64);
 
                         memberExpr->object->accept(*this);
                         HIRValue* headersObj = lastValue_;
@@ -12599,7 +12603,7 @@ void HIRGenerator::visit(CallExpr& node) {
                             std::string runtimeFunc = methodName == "append" ?
                                 "nova_headers_append" : "nova_headers_set";
                             std::vector<HIRTypePtr> paramTypes = {ptrType, strType, strType};
-                            auto voidType = std::make_shared<HIRType>(HIRType::Kind::Void);
+                            auto voidType = HIRType::get(HIRType::Kind::Void);
 
                             HIRFunction* func = nullptr;
                             auto existingFunc = module_->getFunction(runtimeFunc);
@@ -12678,7 +12682,7 @@ void HIRGenerator::visit(CallExpr& node) {
 
                             std::string runtimeFunc = "nova_headers_delete";
                             std::vector<HIRTypePtr> paramTypes = {ptrType, strType};
-                            auto voidType = std::make_shared<HIRType>(HIRType::Kind::Void);
+                            auto voidType = HIRType::get(HIRType::Kind::Void);
 
                             HIRFunction* func = nullptr;
                             auto existingFunc = module_->getFunction(runtimeFunc);
@@ -12699,12 +12703,12 @@ void HIRGenerator::visit(CallExpr& node) {
                 }
 
                 // Check if object is a Response (Web API)
-                if (auto* objIdent = dynamic_cast<Identifier*>(memberExpr->object.get())) {
+                if (auto* objIdent = ast_cast<Identifier>(memberExpr->object.get())) {
                     if (responseVars_.count(objIdent->name) > 0) {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected Response method call: " << methodName << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                        auto strType = std::make_shared<HIRType>(HIRType::Kind::String);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                        auto strType = HIRType::get(HIRType::Kind::String);
 
                         memberExpr->object->accept(*this);
                         HIRValue* responseObj = lastValue_;
@@ -12752,13 +12756,13 @@ void HIRGenerator::visit(CallExpr& node) {
                 }
 
 // Check if object is a TypedArray
-                if (auto* objIdent = dynamic_cast<Identifier*>(memberExpr->object.get())) {
+                if (auto* objIdent = ast_cast<Identifier>(memberExpr->object.get())) {
                     auto typeIt = typedArrayTypes_.find(objIdent->name);
                     if (typeIt != typedArrayTypes_.end()) {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected TypedArray method call: " << methodName << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                        auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                        auto intType = HIRType::get(HIRType::Kind::I64);
 
                         std::string runtimeFuncName;
                         std::vector<HIRTypePtr> paramTypes;
@@ -12811,7 +12815,7 @@ void HIRGenerator::visit(CallExpr& node) {
                         } else if (methodName == "set") {
                             runtimeFuncName = "nova_typedarray_set_array";
                             paramTypes = {ptrType, ptrType, intType};
-                            returnType = std::make_shared<HIRType>(HIRType::Kind::Void);
+                            returnType = HIRType::get(HIRType::Kind::Void);
                             hasReturnValue = false;
                             expectedArgs = 2;
                         } else if (methodName == "at") {
@@ -12846,15 +12850,15 @@ void HIRGenerator::visit(CallExpr& node) {
                             expectedArgs = 0;
                         } else if (methodName == "join") {
                             runtimeFuncName = "nova_typedarray_join";
-                            paramTypes = {ptrType, std::make_shared<HIRType>(HIRType::Kind::String)};
-                            returnType = std::make_shared<HIRType>(HIRType::Kind::String);
+                            paramTypes = {ptrType, HIRType::get(HIRType::Kind::String)};
+                            returnType = HIRType::get(HIRType::Kind::String);
                             hasReturnValue = true;
                             expectedArgs = 1;
                         } else if (methodName == "keys") {
                             runtimeFuncName = "nova_typedarray_keys";
                             paramTypes = {ptrType};
                             // Return proper array type so .length works
-                            auto elementType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                            auto elementType = HIRType::get(HIRType::Kind::I64);
                             auto arrayType = std::make_shared<HIRArrayType>(elementType, 0);
                             returnType = std::make_shared<HIRPointerType>(arrayType, true);
                             hasReturnValue = true;
@@ -12864,7 +12868,7 @@ void HIRGenerator::visit(CallExpr& node) {
                             runtimeFuncName = "nova_typedarray_values";
                             paramTypes = {ptrType};
                             // Return proper array type so .length works
-                            auto elementType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                            auto elementType = HIRType::get(HIRType::Kind::I64);
                             auto arrayType = std::make_shared<HIRArrayType>(elementType, 0);
                             returnType = std::make_shared<HIRPointerType>(arrayType, true);
                             hasReturnValue = true;
@@ -12874,7 +12878,7 @@ void HIRGenerator::visit(CallExpr& node) {
                             runtimeFuncName = "nova_typedarray_entries";
                             paramTypes = {ptrType};
                             // Return proper array type so .length works (array of pairs)
-                            auto elementType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                            auto elementType = HIRType::get(HIRType::Kind::Pointer);
                             auto arrayType = std::make_shared<HIRArrayType>(elementType, 0);
                             returnType = std::make_shared<HIRPointerType>(arrayType, true);
                             hasReturnValue = true;
@@ -12883,13 +12887,13 @@ void HIRGenerator::visit(CallExpr& node) {
                         } else if (methodName == "toString") {
                             runtimeFuncName = "nova_typedarray_toString";
                             paramTypes = {ptrType};
-                            returnType = std::make_shared<HIRType>(HIRType::Kind::String);
+                            returnType = HIRType::get(HIRType::Kind::String);
                             hasReturnValue = true;
                             expectedArgs = 0;
                         } else if (methodName == "toLocaleString") {
                             runtimeFuncName = "nova_typedarray_toLocaleString";
                             paramTypes = {ptrType};
-                            returnType = std::make_shared<HIRType>(HIRType::Kind::String);
+                            returnType = HIRType::get(HIRType::Kind::String);
                             hasReturnValue = true;
                             expectedArgs = 0;
                         } else if (methodName == "with") {
@@ -12932,7 +12936,7 @@ void HIRGenerator::visit(CallExpr& node) {
                             if (methodName == "map" || methodName == "filter") {
                                 callbackReturnType = ptrType;  // returns new TypedArray
                             } else if (methodName == "forEach") {
-                                callbackReturnType = std::make_shared<HIRType>(HIRType::Kind::Void);
+                                callbackReturnType = HIRType::get(HIRType::Kind::Void);
                                 callbackHasReturn = false;
                             } else if (methodName == "reduce" || methodName == "reduceRight") {
                                 callbackParamTypes.push_back(intType);  // initial value
@@ -13048,7 +13052,7 @@ void HIRGenerator::visit(CallExpr& node) {
                                 } else if (methodName == "join") {
                                     if (args.size() == 1) {
                                         // Default separator is ","
-                                        auto strType = std::make_shared<HIRType>(HIRType::Kind::String);
+                                        auto strType = HIRType::get(HIRType::Kind::String);
                                         auto comma = builder_->createStringConstant(",");
                                         args.push_back(comma);
                                     } else {
@@ -13102,8 +13106,8 @@ void HIRGenerator::visit(CallExpr& node) {
                     if (arrayBufferVars_.count(objIdent->name) > 0) {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected ArrayBuffer method call: " << methodName << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                        auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                        auto intType = HIRType::get(HIRType::Kind::I64);
 
                         std::string runtimeFuncName;
                         std::vector<HIRTypePtr> paramTypes;
@@ -13155,9 +13159,9 @@ void HIRGenerator::visit(CallExpr& node) {
                     if (dataViewVars_.count(objIdent->name) > 0) {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected DataView method call: " << methodName << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                        auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
-                        auto floatType = std::make_shared<HIRType>(HIRType::Kind::F64);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                        auto intType = HIRType::get(HIRType::Kind::I64);
+                        auto floatType = HIRType::get(HIRType::Kind::F64);
 
                         std::string runtimeFuncName;
                         std::vector<HIRTypePtr> paramTypes;
@@ -13187,20 +13191,20 @@ void HIRGenerator::visit(CallExpr& node) {
                         else if (methodName == "setInt8" || methodName == "setUint8") {
                             runtimeFuncName = "nova_dataview_" + methodName;
                             paramTypes = {ptrType, intType, intType};
-                            returnType = std::make_shared<HIRType>(HIRType::Kind::Void);
+                            returnType = HIRType::get(HIRType::Kind::Void);
                             expectedArgs = 2;  // byteOffset, value
                             isGetter = false;
                         } else if (methodName == "setInt16" || methodName == "setUint16" ||
                                    methodName == "setInt32" || methodName == "setUint32") {
                             runtimeFuncName = "nova_dataview_" + methodName;
                             paramTypes = {ptrType, intType, intType, intType};
-                            returnType = std::make_shared<HIRType>(HIRType::Kind::Void);
+                            returnType = HIRType::get(HIRType::Kind::Void);
                             expectedArgs = 3;  // byteOffset, value, littleEndian (optional)
                             isGetter = false;
                         } else if (methodName == "setFloat32" || methodName == "setFloat64") {
                             runtimeFuncName = "nova_dataview_" + methodName;
                             paramTypes = {ptrType, intType, floatType, intType};
-                            returnType = std::make_shared<HIRType>(HIRType::Kind::Void);
+                            returnType = HIRType::get(HIRType::Kind::Void);
                             expectedArgs = 3;
                             isGetter = false;
                         }
@@ -13213,7 +13217,7 @@ void HIRGenerator::visit(CallExpr& node) {
                         } else if (methodName == "setBigInt64" || methodName == "setBigUint64") {
                             runtimeFuncName = "nova_dataview_" + methodName;
                             paramTypes = {ptrType, intType, intType, intType};
-                            returnType = std::make_shared<HIRType>(HIRType::Kind::Void);
+                            returnType = HIRType::get(HIRType::Kind::Void);
                             expectedArgs = 3;  // byteOffset, value, littleEndian (optional)
                             isGetter = false;
                         }
@@ -13259,9 +13263,9 @@ void HIRGenerator::visit(CallExpr& node) {
                     if (disposableStackVars_.count(objIdent->name) > 0) {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected DisposableStack method call: " << methodName << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                        auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
-                        auto voidType = std::make_shared<HIRType>(HIRType::Kind::Void);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                        auto intType = HIRType::get(HIRType::Kind::I64);
+                        auto voidType = HIRType::get(HIRType::Kind::Void);
 
                         std::string runtimeFuncName;
                         std::vector<HIRTypePtr> paramTypes;
@@ -13375,9 +13379,9 @@ void HIRGenerator::visit(CallExpr& node) {
                     if (asyncDisposableStackVars_.count(objIdent->name) > 0) {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected AsyncDisposableStack method call: " << methodName << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                        auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
-                        auto voidType = std::make_shared<HIRType>(HIRType::Kind::Void);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                        auto intType = HIRType::get(HIRType::Kind::I64);
+                        auto voidType = HIRType::get(HIRType::Kind::Void);
 
                         std::string runtimeFuncName;
                         std::vector<HIRTypePtr> paramTypes;
@@ -13482,9 +13486,9 @@ void HIRGenerator::visit(CallExpr& node) {
                     if (finalizationRegistryVars_.count(objIdent->name) > 0) {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected FinalizationRegistry method call: " << methodName << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                        auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
-                        auto voidType = std::make_shared<HIRType>(HIRType::Kind::Void);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                        auto intType = HIRType::get(HIRType::Kind::I64);
+                        auto voidType = HIRType::get(HIRType::Kind::Void);
 
                         std::string runtimeFuncName;
                         std::vector<HIRTypePtr> paramTypes;
@@ -13566,9 +13570,9 @@ void HIRGenerator::visit(CallExpr& node) {
                     if (promiseVars_.count(objIdent->name) > 0) {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected Promise method call: " << methodName << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                        auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
-                        auto voidType = std::make_shared<HIRType>(HIRType::Kind::Void);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                        auto intType = HIRType::get(HIRType::Kind::I64);
+                        auto voidType = HIRType::get(HIRType::Kind::Void);
 
                         std::string runtimeFuncName;
                         std::vector<HIRTypePtr> paramTypes;
@@ -13622,9 +13626,9 @@ void HIRGenerator::visit(CallExpr& node) {
                             for (size_t callbackIndex = 0;
                                  callbackIndex < callbackCount; ++callbackIndex) {
                                 if (callbackIndex >= node.arguments.size() ||
-                                    dynamic_cast<NullLiteral*>(
+                                    ast_cast<NullLiteral>(
                                         node.arguments[callbackIndex].get()) ||
-                                    dynamic_cast<UndefinedLiteral*>(
+                                    ast_cast<UndefinedLiteral>(
                                         node.arguments[callbackIndex].get())) {
                                     args.push_back(builder_->createNullConstant(ptrType.get()));
                                     args.push_back(builder_->createNullConstant(ptrType.get()));
@@ -13682,8 +13686,8 @@ void HIRGenerator::visit(CallExpr& node) {
                     if (asyncGeneratorVars_.count(objIdent->name) > 0) {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected AsyncGenerator method call: " << methodName << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                        auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                        auto intType = HIRType::get(HIRType::Kind::I64);
 
                         std::string runtimeFuncName;
                         std::vector<HIRTypePtr> paramTypes;
@@ -13747,8 +13751,8 @@ void HIRGenerator::visit(CallExpr& node) {
                     if (generatorVars_.count(objIdent->name) > 0) {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected Generator method call: " << methodName << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                        auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                        auto intType = HIRType::get(HIRType::Kind::I64);
 
                         std::string runtimeFuncName;
                         std::vector<HIRTypePtr> paramTypes;
@@ -13810,9 +13814,9 @@ void HIRGenerator::visit(CallExpr& node) {
                     if (functionVars_.count(objIdent->name) > 0) {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected Function method call: " << objIdent->name << "." << methodName << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                        auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
-                        auto strType = std::make_shared<HIRType>(HIRType::Kind::String);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                        auto intType = HIRType::get(HIRType::Kind::I64);
+                        auto strType = HIRType::get(HIRType::Kind::String);
 
                         if (methodName == "call") {
                             // func.call(thisArg, arg1, arg2, ...)
@@ -13884,6 +13888,7 @@ void HIRGenerator::visit(CallExpr& node) {
 
                 // Check if object is an array type
                 bool isArrayMethod = false;
+                bool receiverWasUnboxed = false;
                 HIRTypePtr arrayElementType;
                 if (object && object->type) {
                     if (object->type->kind == hir::HIRType::Kind::Array) {
@@ -13907,9 +13912,9 @@ void HIRGenerator::visit(CallExpr& node) {
                 // normalized.  The AST receiver is still authoritative: it is
                 // an ArrayExpr and must retain array-method dispatch.
                 if (!isArrayMethod &&
-                    dynamic_cast<ArrayExpr*>(memberExpr->object.get())) {
+                    ast_cast<ArrayExpr>(memberExpr->object.get())) {
                     isArrayMethod = true;
-                    arrayElementType = std::make_shared<HIRType>(
+                    arrayElementType = HIRType::get(
                         HIRType::Kind::JSValue);
                 }
                 // Runtime materializations such as `[...generator]` use a
@@ -13918,11 +13923,11 @@ void HIRGenerator::visit(CallExpr& node) {
                 // authoritative signal for array-method dispatch.
                 if (!isArrayMethod) {
                     if (auto* arrayIdentifier =
-                            dynamic_cast<Identifier*>(memberExpr->object.get());
+                            ast_cast<Identifier>(memberExpr->object.get());
                         arrayIdentifier &&
                         runtimeArrayVars_.count(arrayIdentifier->name) > 0) {
                         isArrayMethod = true;
-                        arrayElementType = std::make_shared<HIRType>(
+                        arrayElementType = HIRType::get(
                             taggedRuntimeArrayVars_.count(
                                 arrayIdentifier->name) > 0
                                 ? HIRType::Kind::JSValue
@@ -13947,8 +13952,8 @@ void HIRGenerator::visit(CallExpr& node) {
                         "toString"
                     };
                     if (arrayMethodsOnJSValue.count(methodName) > 0) {
-                        auto jsValueType = std::make_shared<HIRType>(HIRType::Kind::JSValue);
-                        auto pointerType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                        auto jsValueType = HIRType::get(HIRType::Kind::JSValue);
+                        auto pointerType = HIRType::get(HIRType::Kind::Pointer);
                         auto existingUnbox = module_->getFunction("nova_value_to_object");
                         HIRFunction* unbox = existingUnbox ? existingUnbox.get() : nullptr;
                         if (!unbox) {
@@ -13960,8 +13965,9 @@ void HIRGenerator::visit(CallExpr& node) {
                         object = builder_->createCall(unbox, {object}, "array.receiver.unbox");
                         object->type = pointerType;
                         isArrayMethod = true;
+                        receiverWasUnboxed = true;
                         // Default to I64 element type for unboxed dynamic arrays.
-                        arrayElementType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        arrayElementType = HIRType::get(HIRType::Kind::I64);
                     }
                 }
 
@@ -13975,13 +13981,22 @@ void HIRGenerator::visit(CallExpr& node) {
                     bool hasReturnValue = false;
                     const bool usesJSValue = arrayElementType &&
                         arrayElementType->kind == HIRType::Kind::JSValue;
-                    auto valueType = std::make_shared<HIRType>(
+                    // Callbacks over raw integer elements can be expanded
+                    // into a loop in the caller (see InlineExpansion.cpp).
+                    // Unboxed dynamic receivers only default to I64 and may
+                    // hold tagged values, so they keep the runtime path.
+                    if (!receiverWasUnboxed && arrayElementType &&
+                        arrayElementType->kind == HIRType::Kind::I64 &&
+                        tryInlineArrayCallback(node, methodName, object)) {
+                        return;
+                    }
+                    auto valueType = HIRType::get(
                         usesJSValue ? HIRType::Kind::JSValue : HIRType::Kind::I64);
                     std::unordered_set<size_t> boxedArgumentIndexes;
                     auto makeArrayReturnType = [&]() -> HIRTypePtr {
                         HIRTypePtr element = arrayElementType
                             ? arrayElementType
-                            : std::make_shared<HIRType>(HIRType::Kind::I64);
+                            : HIRType::get(HIRType::Kind::I64);
                         auto arrayType = std::make_shared<HIRArrayType>(element, 0);
                         return std::make_shared<HIRPointerType>(arrayType, true);
                     };
@@ -13990,35 +14005,35 @@ void HIRGenerator::visit(CallExpr& node) {
                     // Using value-based array functions for primitive type arrays
                     if (methodName == "push") {
                         runtimeFuncName = "nova_value_array_push";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // ValueArray*
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // ValueArray*
                         paramTypes.push_back(valueType);
                         if (usesJSValue) boxedArgumentIndexes.insert(0);
-                        returnType = std::make_shared<HIRType>(HIRType::Kind::I64);             // returns int64 (new length)
+                        returnType = HIRType::get(HIRType::Kind::I64);             // returns int64 (new length)
                         hasReturnValue = true;
                     } else if (methodName == "pop") {
                         runtimeFuncName = "nova_value_array_pop";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // ValueArray*
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // ValueArray*
                         returnType = valueType;
                         hasReturnValue = true;
                     } else if (methodName == "shift") {
                         runtimeFuncName = "nova_value_array_shift";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // ValueArray*
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // ValueArray*
                         returnType = valueType;
                         hasReturnValue = true;
                     } else if (methodName == "unshift") {
                         runtimeFuncName = "nova_value_array_unshift";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // ValueArray*
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // ValueArray*
                         paramTypes.push_back(valueType);
                         if (usesJSValue) boxedArgumentIndexes.insert(0);
-                        returnType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        returnType = HIRType::get(HIRType::Kind::I64);
                         hasReturnValue = true;
                     } else if (methodName == "at") {
                         // array.at(index)
                         // Returns element at index (supports negative indices)
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected array method call: at" << std::endl;
                         runtimeFuncName = "nova_value_array_at";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // ValueArray*
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));    // int64 index
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // ValueArray*
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::I64));    // int64 index
                         returnType = valueType;
                         hasReturnValue = true;
                     } else if (methodName == "with") {
@@ -14026,11 +14041,11 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Returns NEW array with element at index replaced (immutable)
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected array method call: with" << std::endl;
                         runtimeFuncName = "nova_value_array_with";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // ValueArray*
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));    // int64 index
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));    // int64 value
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // ValueArray*
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::I64));    // int64 index
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::I64));    // int64 value
                         // Return proper array type: pointer to array of i64
-                        auto elementType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        auto elementType = HIRType::get(HIRType::Kind::I64);
                         auto arrayType = std::make_shared<HIRArrayType>(elementType, 0); // Size unknown at compile time
                         returnType = std::make_shared<HIRPointerType>(arrayType, true);
                         hasReturnValue = true;
@@ -14039,7 +14054,7 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Returns NEW reversed array (immutable operation)
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected array method call: toReversed" << std::endl;
                         runtimeFuncName = "nova_value_array_toReversed";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // ValueArray*
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // ValueArray*
                         // Return proper array type: pointer to array of i64
                         returnType = makeArrayReturnType();
                         hasReturnValue = true;
@@ -14048,9 +14063,9 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Returns NEW sorted array (immutable operation)
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected array method call: toSorted" << std::endl;
                         runtimeFuncName = "nova_value_array_toSorted";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // ValueArray*
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // ValueArray*
                         // Return proper array type: pointer to array of i64
-                        auto elementType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        auto elementType = HIRType::get(HIRType::Kind::I64);
                         auto arrayType = std::make_shared<HIRArrayType>(elementType, 0); // Size unknown at compile time
                         returnType = std::make_shared<HIRPointerType>(arrayType, true);
                         hasReturnValue = true;
@@ -14061,13 +14076,13 @@ void HIRGenerator::visit(CallExpr& node) {
                         runtimeFuncName = node.arguments.empty()
                             ? "nova_value_array_sort"
                             : "nova_value_array_sort_compare";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // ValueArray*
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // ValueArray*
                         if (!node.arguments.empty()) {
-                            paramTypes.push_back(std::make_shared<HIRType>(
+                            paramTypes.push_back(HIRType::get(
                                 HIRType::Kind::Pointer));
                         }
                         // Return proper array type: pointer to array of i64
-                        auto elementType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        auto elementType = HIRType::get(HIRType::Kind::I64);
                         auto arrayType = std::make_shared<HIRArrayType>(elementType, 0);
                         returnType = std::make_shared<HIRPointerType>(arrayType, true);
                         hasReturnValue = true;
@@ -14076,11 +14091,11 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Modifies array by removing deleteCount elements starting at start
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected array method call: splice" << std::endl;
                         runtimeFuncName = "nova_value_array_splice";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // ValueArray*
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));    // int64 start
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));    // int64 deleteCount
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // ValueArray*
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::I64));    // int64 start
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::I64));    // int64 deleteCount
                         // Return proper array type: pointer to array of i64
-                        auto elementType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        auto elementType = HIRType::get(HIRType::Kind::I64);
                         auto arrayType = std::make_shared<HIRArrayType>(elementType, 0);
                         returnType = std::make_shared<HIRPointerType>(arrayType, true);
                         hasReturnValue = true;
@@ -14090,13 +14105,13 @@ void HIRGenerator::visit(CallExpr& node) {
                         // end is optional (defaults to array length)
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected array method call: copyWithin" << std::endl;
                         runtimeFuncName = "nova_value_array_copyWithin";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // ValueArray*
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));    // int64 target
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));    // int64 start
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // ValueArray*
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::I64));    // int64 target
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::I64));    // int64 start
                         // For 2-arg version, pass array length as end; for 3-arg pass the actual end
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));    // int64 end
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::I64));    // int64 end
                         // Return proper array type: pointer to array of i64
-                        auto elementType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        auto elementType = HIRType::get(HIRType::Kind::I64);
                         auto arrayType = std::make_shared<HIRArrayType>(elementType, 0);
                         returnType = std::make_shared<HIRPointerType>(arrayType, true);
                         hasReturnValue = true;
@@ -14105,11 +14120,11 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Immutable version of splice() - does not modify original array
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected array method call: toSpliced" << std::endl;
                         runtimeFuncName = "nova_value_array_toSpliced";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // ValueArray*
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));    // int64 start
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));    // int64 deleteCount
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // ValueArray*
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::I64));    // int64 start
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::I64));    // int64 deleteCount
                         // Return new array - use proper 3-step pattern for array type
-                        auto elementType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        auto elementType = HIRType::get(HIRType::Kind::I64);
                         auto arrayType = std::make_shared<HIRArrayType>(elementType, 0);
                         returnType = std::make_shared<HIRPointerType>(arrayType, true);
                         hasReturnValue = true;
@@ -14118,17 +14133,17 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Returns string representation like "1,2,3"
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected array method call: toString" << std::endl;
                         runtimeFuncName = "nova_value_array_toString";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // ValueArray*
-                        returnType = std::make_shared<HIRType>(HIRType::Kind::String);           // returns string
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // ValueArray*
+                        returnType = HIRType::get(HIRType::Kind::String);           // returns string
                         hasReturnValue = true;
                     } else if (methodName == "flat") {
                         // array.flat() - flattens nested arrays one level deep (ES2019)
                         // Returns new array with sub-array elements concatenated
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected array method call: flat" << std::endl;
                         runtimeFuncName = "nova_value_array_flat";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // ValueArray*
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // ValueArray*
                         // Return proper array type: pointer to array of i64
-                        auto elementType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        auto elementType = HIRType::get(HIRType::Kind::I64);
                         auto arrayType = std::make_shared<HIRArrayType>(elementType, 0); // Size unknown at compile time
                         returnType = std::make_shared<HIRPointerType>(arrayType, true);
                         hasReturnValue = true;
@@ -14138,70 +14153,70 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Returns new array with transformed and flattened elements
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected array method call: flatMap" << std::endl;
                         runtimeFuncName = "nova_value_array_flatMap";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // ValueArray*
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // callback function pointer
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // ValueArray*
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // callback function pointer
                         // Return proper array type: pointer to array of i64
-                        auto elementType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        auto elementType = HIRType::get(HIRType::Kind::I64);
                         auto arrayType = std::make_shared<HIRArrayType>(elementType, 0);
                         returnType = std::make_shared<HIRPointerType>(arrayType, true);
                         hasReturnValue = true;
                     } else if (methodName == "includes") {
                         runtimeFuncName = "nova_value_array_includes";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // ValueArray*
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // ValueArray*
                         paramTypes.push_back(valueType);
                         if (usesJSValue) boxedArgumentIndexes.insert(0);
-                        returnType = std::make_shared<HIRType>(HIRType::Kind::I64);              // returns int64 (0 or 1)
+                        returnType = HIRType::get(HIRType::Kind::I64);              // returns int64 (0 or 1)
                         hasReturnValue = true;
                     } else if (methodName == "indexOf") {
                         runtimeFuncName = "nova_value_array_indexOf";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // ValueArray*
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // ValueArray*
                         paramTypes.push_back(valueType);
                         if (usesJSValue) boxedArgumentIndexes.insert(0);
-                        returnType = std::make_shared<HIRType>(HIRType::Kind::I64);              // returns int64 index
+                        returnType = HIRType::get(HIRType::Kind::I64);              // returns int64 index
                         hasReturnValue = true;
                     } else if (methodName == "lastIndexOf") {
                         // array.lastIndexOf(value)
                         // Searches from end to start, returns last occurrence index
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected array method call: lastIndexOf" << std::endl;
                         runtimeFuncName = "nova_value_array_lastIndexOf";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // ValueArray*
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // ValueArray*
                         paramTypes.push_back(valueType);
                         if (usesJSValue) boxedArgumentIndexes.insert(0);
-                        returnType = std::make_shared<HIRType>(HIRType::Kind::I64);              // returns int64 index
+                        returnType = HIRType::get(HIRType::Kind::I64);              // returns int64 index
                         hasReturnValue = true;
                     } else if (methodName == "reverse") {
                         runtimeFuncName = "nova_value_array_reverse";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // ValueArray*
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // ValueArray*
                         // Return proper array type: pointer to array of i64
                         returnType = makeArrayReturnType();
                         hasReturnValue = true;
                     } else if (methodName == "fill") {
                         runtimeFuncName = "nova_value_array_fill";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // ValueArray*
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));    // int64 value
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // ValueArray*
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::I64));    // int64 value
                         // Return proper array type: pointer to array of i64
-                        auto elementType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        auto elementType = HIRType::get(HIRType::Kind::I64);
                         auto arrayType = std::make_shared<HIRArrayType>(elementType, 0);
                         returnType = std::make_shared<HIRPointerType>(arrayType, true);
                         hasReturnValue = true;
                     } else if (methodName == "join") {
                         runtimeFuncName = "nova_value_array_join";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // ValueArray*
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));  // delimiter
-                        returnType = std::make_shared<HIRType>(HIRType::Kind::String);           // returns string
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // ValueArray*
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::String));  // delimiter
+                        returnType = HIRType::get(HIRType::Kind::String);           // returns string
                         hasReturnValue = true;
                     } else if (methodName == "concat") {
                         runtimeFuncName = "nova_value_array_concat";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // ValueArray* (first array)
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // ValueArray* (second array)
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // ValueArray* (first array)
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // ValueArray* (second array)
                         // Return proper array type: pointer to array of i64
                         returnType = makeArrayReturnType();
                         hasReturnValue = true;
                     } else if (methodName == "slice") {
                         runtimeFuncName = "nova_value_array_slice";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // ValueArray*
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));    // start index
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));    // end index
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // ValueArray*
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::I64));    // start index
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::I64));    // end index
                         // Return proper array type: pointer to array of i64
                         returnType = makeArrayReturnType();
                         hasReturnValue = true;
@@ -14210,9 +14225,9 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Callback: (element) => boolean
                         // Returns the element or 0 if not found
                         runtimeFuncName = "nova_value_array_find_tagged";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // ValueArray*
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // callback function pointer
-                        returnType = std::make_shared<HIRType>(
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // ValueArray*
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // callback function pointer
+                        returnType = HIRType::get(
                             HIRType::Kind::JSValue);
                         hasReturnValue = true;
                     } else if (methodName == "findIndex") {
@@ -14221,9 +14236,9 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Returns the index or -1 if not found
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected array method call: findIndex" << std::endl;
                         runtimeFuncName = "nova_value_array_findIndex";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // ValueArray*
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // callback function pointer
-                        returnType = std::make_shared<HIRType>(HIRType::Kind::I64);  // returns index (i64)
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // ValueArray*
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // callback function pointer
+                        returnType = HIRType::get(HIRType::Kind::I64);  // returns index (i64)
                         hasReturnValue = true;
                     } else if (methodName == "findLast") {
                         // array.findLast(callback) - ES2023
@@ -14231,9 +14246,9 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Returns the last element matching condition (searches right to left)
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected array method call: findLast" << std::endl;
                         runtimeFuncName = "nova_value_array_findLast_tagged";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // ValueArray*
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // callback function pointer
-                        returnType = std::make_shared<HIRType>(
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // ValueArray*
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // callback function pointer
+                        returnType = HIRType::get(
                             HIRType::Kind::JSValue);
                         hasReturnValue = true;
                     } else if (methodName == "findLastIndex") {
@@ -14242,9 +14257,9 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Returns the last index matching condition (searches right to left)
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected array method call: findLastIndex" << std::endl;
                         runtimeFuncName = "nova_value_array_findLastIndex";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // ValueArray*
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // callback function pointer
-                        returnType = std::make_shared<HIRType>(HIRType::Kind::I64);  // returns index (i64)
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // ValueArray*
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // callback function pointer
+                        returnType = HIRType::get(HIRType::Kind::I64);  // returns index (i64)
                         hasReturnValue = true;
                     } else if (methodName == "filter") {
                         // array.filter(callback)
@@ -14252,10 +14267,10 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Returns new array with matching elements
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected array method call: filter" << std::endl;
                         runtimeFuncName = "nova_value_array_filter";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // ValueArray*
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // callback function pointer
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // ValueArray*
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // callback function pointer
                         // Return simple pointer type so console.log recognizes it
-                        returnType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                        returnType = HIRType::get(HIRType::Kind::Pointer);
                         hasReturnValue = true;
                     } else if (methodName == "map") {
                         // array.map(callback)
@@ -14263,10 +14278,10 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Returns new array with transformed elements
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected array method call: map" << std::endl;
                         runtimeFuncName = "nova_value_array_map";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // ValueArray*
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // callback function pointer
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // ValueArray*
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // callback function pointer
                         // Return simple pointer type so console.log recognizes it
-                        returnType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                        returnType = HIRType::get(HIRType::Kind::Pointer);
                         hasReturnValue = true;
                     } else if (methodName == "some") {
                         // array.some(callback)
@@ -14274,9 +14289,9 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Returns true if any element matches
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected array method call: some" << std::endl;
                         runtimeFuncName = "nova_value_array_some";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // ValueArray*
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // callback function pointer
-                        returnType = std::make_shared<HIRType>(HIRType::Kind::I64);  // returns boolean as i64
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // ValueArray*
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // callback function pointer
+                        returnType = HIRType::get(HIRType::Kind::I64);  // returns boolean as i64
                         hasReturnValue = true;
                     } else if (methodName == "every") {
                         // array.every(callback)
@@ -14284,9 +14299,9 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Returns true if all elements match
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected array method call: every" << std::endl;
                         runtimeFuncName = "nova_value_array_every";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // ValueArray*
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // callback function pointer
-                        returnType = std::make_shared<HIRType>(HIRType::Kind::I64);  // returns boolean as i64
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // ValueArray*
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // callback function pointer
+                        returnType = HIRType::get(HIRType::Kind::I64);  // returns boolean as i64
                         hasReturnValue = true;
                     } else if (methodName == "forEach") {
                         // array.forEach(callback)
@@ -14294,9 +14309,9 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Returns void (but we return 0 for consistency)
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected array method call: forEach" << std::endl;
                         runtimeFuncName = "nova_value_array_forEach";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // ValueArray*
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // callback function pointer
-                        returnType = std::make_shared<HIRType>(HIRType::Kind::Void);  // returns void
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // ValueArray*
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // callback function pointer
+                        returnType = HIRType::get(HIRType::Kind::Void);  // returns void
                         hasReturnValue = false;  // No return value
                     } else if (methodName == "reduce") {
                         // array.reduce(callback, initialValue)
@@ -14307,15 +14322,15 @@ void HIRGenerator::visit(CallExpr& node) {
                         // which seeds the accumulator with the first element.
                         if (node.arguments.size() < 2) {
                             runtimeFuncName = "nova_value_array_reduce_no_init";
-                            paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // ValueArray*
-                            paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // callback function pointer
+                            paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // ValueArray*
+                            paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // callback function pointer
                         } else {
                             runtimeFuncName = "nova_value_array_reduce";
-                            paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // ValueArray*
-                            paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // callback function pointer
-                            paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64)); // initial value
+                            paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // ValueArray*
+                            paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // callback function pointer
+                            paramTypes.push_back(HIRType::get(HIRType::Kind::I64)); // initial value
                         }
-                        returnType = std::make_shared<HIRType>(HIRType::Kind::I64);  // returns accumulated value
+                        returnType = HIRType::get(HIRType::Kind::I64);  // returns accumulated value
                         hasReturnValue = true;
                     } else if (methodName == "reduceRight") {
                         // array.reduceRight(callback, initialValue)
@@ -14324,15 +14339,15 @@ void HIRGenerator::visit(CallExpr& node) {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected array method call: reduceRight" << std::endl;
                         if (node.arguments.size() < 2) {
                             runtimeFuncName = "nova_value_array_reduceRight_no_init";
-                            paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // ValueArray*
-                            paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // callback function pointer
+                            paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // ValueArray*
+                            paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // callback function pointer
                         } else {
                             runtimeFuncName = "nova_value_array_reduceRight";
-                            paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // ValueArray*
-                            paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer)); // callback function pointer
-                            paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64)); // initial value
+                            paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // ValueArray*
+                            paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer)); // callback function pointer
+                            paramTypes.push_back(HIRType::get(HIRType::Kind::I64)); // initial value
                         }
-                        returnType = std::make_shared<HIRType>(HIRType::Kind::I64);  // returns accumulated value
+                        returnType = HIRType::get(HIRType::Kind::I64);  // returns accumulated value
                         hasReturnValue = true;
                     } else {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Unknown array method: " << methodName << std::endl;
@@ -14347,15 +14362,15 @@ void HIRGenerator::visit(CallExpr& node) {
                     Expr* reductionInitial = node.arguments.size() >= 2
                         ? node.arguments[1].get() : nullptr;
                     while (auto* assertion =
-                               dynamic_cast<AsExpr*>(reductionInitial)) {
+                               ast_cast<AsExpr>(reductionInitial)) {
                         reductionInitial = assertion->expression.get();
                     }
                     const bool aggregateReduction =
                         (methodName == "reduce" ||
                          methodName == "reduceRight") &&
-                        dynamic_cast<ArrayExpr*>(reductionInitial) != nullptr;
+                        ast_cast<ArrayExpr>(reductionInitial) != nullptr;
                     if (aggregateReduction) {
-                        auto pointerType = std::make_shared<HIRType>(
+                        auto pointerType = HIRType::get(
                             HIRType::Kind::Pointer);
                         returnType = pointerType;
                         if (paramTypes.size() >= 3) {
@@ -14385,10 +14400,10 @@ void HIRGenerator::visit(CallExpr& node) {
                                 const std::string callbackName =
                                     lastFunctionName_;
                                 auto pointerType =
-                                    std::make_shared<HIRType>(
+                                    HIRType::get(
                                         HIRType::Kind::Pointer);
                                 auto integerType =
-                                    std::make_shared<HIRType>(
+                                    HIRType::get(
                                         HIRType::Kind::I64);
                                 HIRValue* environment =
                                     materializeClosureEnvironment(
@@ -14499,26 +14514,26 @@ void HIRGenerator::visit(CallExpr& node) {
                     if (methodName == "test") {
                         // regex.test(str) - returns boolean (1 if match, 0 if not)
                         runtimeFuncName = "nova_regex_test";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Any));    // regex object
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String)); // string to test
-                        returnType = std::make_shared<HIRType>(HIRType::Kind::I64);             // returns int64 (0 or 1)
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Any));    // regex object
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::String)); // string to test
+                        returnType = HIRType::get(HIRType::Kind::I64);             // returns int64 (0 or 1)
                     } else if (methodName == "exec") {
                         // regex.exec(str) - returns StringArray (match + capture groups) or null
                         runtimeFuncName = "nova_regex_exec_array";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Any));    // regex object
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String)); // string to match
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Any));    // regex object
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::String)); // string to match
                         // Return pointer to string array so .length and element
                         // access use the string-array code paths.
                         {
-                            auto elemType = std::make_shared<HIRType>(HIRType::Kind::String);
+                            auto elemType = HIRType::get(HIRType::Kind::String);
                             auto arrTy = std::make_shared<hir::HIRArrayType>(elemType, 0);
                             returnType = std::make_shared<hir::HIRPointerType>(arrTy, true);
                         }
                     } else if (methodName == "toString") {
                         // regex.toString() - returns "/pattern/flags"
                         runtimeFuncName = "nova_regex_toString";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Any));    // regex object
-                        returnType = std::make_shared<HIRType>(HIRType::Kind::String);          // returns string
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Any));    // regex object
+                        returnType = HIRType::get(HIRType::Kind::String);          // returns string
                     } else if (methodName == "compile") {
                         // regex.compile(pattern, flags?) — recompiles in place.
                         // The receiver is the regex object; arguments are a
@@ -14526,16 +14541,16 @@ void HIRGenerator::visit(CallExpr& node) {
                         // are read) and optional flags string. Returns the
                         // receiver (the same regex, recompiled).
                         runtimeFuncName = "nova_regex_compile";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Any));    // regex object (this)
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String)); // pattern string
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String)); // flags string (or empty)
-                        returnType = std::make_shared<HIRType>(HIRType::Kind::Any);
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Any));    // regex object (this)
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::String)); // pattern string
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::String)); // flags string (or empty)
+                        returnType = HIRType::get(HIRType::Kind::Any);
                     } else if (methodName == "matchAll") {
                         // regex.matchAll(str) - returns iterator of all matches (ES2020)
                         runtimeFuncName = "nova_regex_matchAll";
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Any));    // regex object
-                        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String)); // string to match
-                        returnType = std::make_shared<HIRType>(HIRType::Kind::Pointer);         // returns iterator
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::Any));    // regex object
+                        paramTypes.push_back(HIRType::get(HIRType::Kind::String)); // string to match
+                        returnType = HIRType::get(HIRType::Kind::Pointer);         // returns iterator
                     }
 
                     // Check if function already exists
@@ -14565,9 +14580,9 @@ void HIRGenerator::visit(CallExpr& node) {
                         // is strictly equal to `true`/`false` (the official harness
                         // asserts `assert(regex.test(...))` which compares === true).
                         auto i64Type =
-                            std::make_shared<HIRType>(HIRType::Kind::I64);
+                            HIRType::get(HIRType::Kind::I64);
                         auto jsValueType =
-                            std::make_shared<HIRType>(HIRType::Kind::JSValue);
+                            HIRType::get(HIRType::Kind::JSValue);
                         HIRFunction* boolBox = nullptr;
                         if (auto existing =
                                 module_->getFunction("nova_value_from_bool")) {
@@ -14598,20 +14613,20 @@ void HIRGenerator::visit(CallExpr& node) {
                 // intercepting toString/matchAll on non-regex i64 variables.
                 if (!memberExpr->isComputed && methodName == "compile") {
                     auto* regexObjIdent =
-                        dynamic_cast<Identifier*>(memberExpr->object.get());
+                        ast_cast<Identifier>(memberExpr->object.get());
                     if (regexObjIdent &&
                         regexVars_.count(regexObjIdent->name) > 0) {
                         memberExpr->object->accept(*this);
                         HIRValue* regexObj = lastValue_;
-                        auto anyType = std::make_shared<HIRType>(HIRType::Kind::Any);
-                        auto strType = std::make_shared<HIRType>(HIRType::Kind::String);
+                        auto anyType = HIRType::get(HIRType::Kind::Any);
+                        auto strType = HIRType::get(HIRType::Kind::String);
                         HIRValue* patternStr = builder_->createStringConstant("");
                         HIRValue* flagsStr = builder_->createStringConstant("");
                         if (!node.arguments.empty()) {
                             // Pattern argument: if it's a regex-tracked var,
                             // extract its source/flags; otherwise evaluate as
                             // a string.
-                            auto* argIdent = dynamic_cast<Identifier*>(
+                            auto* argIdent = ast_cast<Identifier>(
                                 node.arguments[0].get());
                             if (argIdent &&
                                 regexVars_.count(argIdent->name) > 0) {
@@ -14675,9 +14690,9 @@ void HIRGenerator::visit(CallExpr& node) {
         }
 
         // Check if this is an OBJECT METHOD call: obj.method(...) - BEFORE class methods
-        if (auto* memberExpr = dynamic_cast<MemberExpr*>(node.callee.get())) {
-            if (auto* objIdent = dynamic_cast<Identifier*>(memberExpr->object.get())) {
-                if (auto* propIdent = dynamic_cast<Identifier*>(memberExpr->property.get())) {
+        if (auto* memberExpr = ast_cast<MemberExpr>(node.callee.get())) {
+            if (auto* objIdent = ast_cast<Identifier>(memberExpr->object.get())) {
+                if (auto* propIdent = ast_cast<Identifier>(memberExpr->property.get())) {
                     std::string objName = objIdent->name;
                     std::string methodName = propIdent->name;
 
@@ -14734,14 +14749,14 @@ void HIRGenerator::visit(CallExpr& node) {
         // nova_dynamic_object_set_function[_with_env] is actually invoked.
         // Without this, `revocable.revoke()` would silently fetch the stored
         // fn pointer and then discard it (no indirect call emitted).
-        if (auto* dynMember = dynamic_cast<MemberExpr*>(node.callee.get())) {
+        if (auto* dynMember = ast_cast<MemberExpr>(node.callee.get())) {
             if (!dynMember->isComputed &&
                 node.arguments.empty() &&
-                dynamic_cast<Identifier*>(dynMember->property.get())) {
+                ast_cast<Identifier>(dynMember->property.get())) {
                 auto* dynObjIdent =
-                    dynamic_cast<Identifier*>(dynMember->object.get());
+                    ast_cast<Identifier>(dynMember->object.get());
                 auto* dynPropIdent =
-                    dynamic_cast<Identifier*>(dynMember->property.get());
+                    ast_cast<Identifier>(dynMember->property.get());
                 if (dynObjIdent && dynPropIdent &&
                     (dynamicObjectVars_.count(dynObjIdent->name) > 0 ||
                      forcedDynamicObjectVars_.count(dynObjIdent->name) > 0)) {
@@ -14751,13 +14766,13 @@ void HIRGenerator::visit(CallExpr& node) {
                     if (objPtr && objPtr->type &&
                         objPtr->type->kind != HIRType::Kind::Pointer) {
                         // Coerce to Pointer for the runtime helper.
-                        auto ptrCoerce = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                        auto ptrCoerce = HIRType::get(HIRType::Kind::Pointer);
                         objPtr = builder_->createCast(
                             objPtr, ptrCoerce.get(), "dyn_method.obj.cast");
                     }
 
-                    auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                    auto i64Type = std::make_shared<HIRType>(HIRType::Kind::I64);
+                    auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                    auto i64Type = HIRType::get(HIRType::Kind::I64);
                     std::vector<HIRTypePtr> paramTypes = {ptrType, ptrType};
                     const std::string runtimeName = "nova_dynamic_call_method_0";
                     auto existingFunc = module_->getFunction(runtimeName);
@@ -14790,16 +14805,16 @@ void HIRGenerator::visit(CallExpr& node) {
         // generated code falls back to undefined (matching the previous
         // no-op behaviour for the previously-unsupported `.call` chain).
         if (auto* outerMember =
-                dynamic_cast<MemberExpr*>(node.callee.get())) {
+                ast_cast<MemberExpr>(node.callee.get())) {
             auto* outerProp =
-                dynamic_cast<Identifier*>(outerMember->property.get());
+                ast_cast<Identifier>(outerMember->property.get());
             if (!outerMember->isComputed && outerProp &&
                 outerProp->name == "call") {
                 auto* innerMember =
-                    dynamic_cast<MemberExpr*>(outerMember->object.get());
+                    ast_cast<MemberExpr>(outerMember->object.get());
                 if (innerMember) {
                     auto* innerPropIdent =
-                        dynamic_cast<Identifier*>(innerMember->property.get());
+                        ast_cast<Identifier>(innerMember->property.get());
                     const std::string innerProp =
                         innerPropIdent ? innerPropIdent->name : std::string{};
                     if (innerProp == "get" || innerProp == "set") {
@@ -14808,14 +14823,14 @@ void HIRGenerator::visit(CallExpr& node) {
                         HIRValue* accessorValue = lastValue_;
                         const bool isSetter = (innerProp == "set");
                         auto jsValueType =
-                            std::make_shared<HIRType>(HIRType::Kind::JSValue);
+                            HIRType::get(HIRType::Kind::JSValue);
                         auto pointerType =
                             std::make_shared<HIRPointerType>(
-                                std::make_shared<HIRType>(
+                                HIRType::get(
                                     HIRType::Kind::Any),
                                 true);
                         auto stringType =
-                            std::make_shared<HIRType>(HIRType::Kind::String);
+                            HIRType::get(HIRType::Kind::String);
 
                         // Evaluate a receiver/value argument, lowering the
                         // intrinsic `RegExp` identifier to its runtime
@@ -14826,7 +14841,7 @@ void HIRGenerator::visit(CallExpr& node) {
                             [&](Expr* expr) -> HIRValue* {
                             if (!expr) return toJSValue(nullptr);
                             if (auto* id =
-                                    dynamic_cast<Identifier*>(expr);
+                                    ast_cast<Identifier>(expr);
                                 id && id->name == "RegExp") {
                                 HIRFunction* intrinsicGetter = nullptr;
                                 if (auto existing = module_->getFunction(
@@ -14865,7 +14880,7 @@ void HIRGenerator::visit(CallExpr& node) {
                         // Ensure accessorValue is a JSValue for the helper.
                         HIRValue* accessorJs = toJSValue(accessorValue);
                         auto i64Type =
-                            std::make_shared<HIRType>(HIRType::Kind::I64);
+                            HIRType::get(HIRType::Kind::I64);
                         HIRFunction* dispatchFunc = nullptr;
                         const std::string dispatchName =
                             "nova_regexp_legacy_dispatch_call";
@@ -14914,11 +14929,11 @@ void HIRGenerator::visit(CallExpr& node) {
         // are extracted. A runtime Object* is built representing the exports
         // and returned as the require() result. This makes require() work in
         // an AOT compiler without a runtime JS interpreter.
-        if (auto* reqId = dynamic_cast<Identifier*>(node.callee.get());
+        if (auto* reqId = ast_cast<Identifier>(node.callee.get());
             reqId && reqId->name == "require" && !node.arguments.empty()) {
 
             // Extract the module specifier (must be a string literal).
-            auto* specLit = dynamic_cast<StringLiteral*>(node.arguments[0].get());
+            auto* specLit = ast_cast<StringLiteral>(node.arguments[0].get());
             if (specLit) {
                 const std::string& spec = specLit->value;
 
@@ -14993,7 +15008,7 @@ void HIRGenerator::visit(CallExpr& node) {
                     std::ifstream mf(resolvedPath);
                     if (!mf.is_open()) {
                         lastValue_ = builder_->createNullConstant(
-                            std::make_shared<HIRType>(HIRType::Kind::Pointer).get());
+                            HIRType::get(HIRType::Kind::Pointer).get());
                         return;
                     }
                     std::string moduleSource((std::istreambuf_iterator<char>(mf)),
@@ -15003,7 +15018,8 @@ void HIRGenerator::visit(CallExpr& node) {
                     // Parse the module.
                     nova::Lexer lexer(resolvedPath, moduleSource);
                     nova::Parser parser(lexer);
-                    auto moduleAst = parser.parseProgram();
+                    Program* moduleAst = importedPrograms_
+                        .emplace_back(parser.parseProgram()).get();
 
                     // Build the exports object by evaluating the module body
                     // and collecting what gets assigned to module.exports or
@@ -15012,7 +15028,7 @@ void HIRGenerator::visit(CallExpr& node) {
                     // exported function/variable names.
                     //
                     // Create a runtime Object* to represent module.exports.
-                    auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                    auto ptrType = HIRType::get(HIRType::Kind::Pointer);
                     HIRFunction* createObj = nullptr;
                     if (auto existing = module_->getFunction("nova_dynamic_object_create")) {
                         createObj = existing.get();
@@ -15038,8 +15054,8 @@ void HIRGenerator::visit(CallExpr& node) {
                     // the builder state. Instead, we register them by name
                     // so that later property accesses can resolve them.
                     for (auto& stmt : moduleAst->body) {
-                        if (auto* ds = dynamic_cast<DeclStmt*>(stmt.get())) {
-                            if (auto* fd = dynamic_cast<FunctionDecl*>(
+                        if (auto* ds = ast_cast<DeclStmt>(stmt.get())) {
+                            if (auto* fd = ast_cast<FunctionDecl>(
                                     ds->declaration.get())) {
                                 // Register the function name in the current
                                 // scope so it can be looked up.
@@ -15054,26 +15070,26 @@ void HIRGenerator::visit(CallExpr& node) {
                     std::string setTagName = "nova_dynamic_object_set_tagged";
                     HIRFunction* setTaggedFn = module_->getFunction(setTagName).get();
                     if (!setTaggedFn) {
-                        auto strType = std::make_shared<HIRType>(HIRType::Kind::String);
-                        auto i64Type = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        auto strType = HIRType::get(HIRType::Kind::String);
+                        auto i64Type = HIRType::get(HIRType::Kind::I64);
                         auto* ft = new HIRFunctionType({ptrType, strType, i64Type},
-                                                       std::make_shared<HIRType>(HIRType::Kind::Void));
+                                                       HIRType::get(HIRType::Kind::Void));
                         auto created = module_->createFunction(setTagName, ft);
                         created->linkage = HIRFunction::Linkage::External;
                         setTaggedFn = created.get();
                     }
 
                     for (auto& stmt : moduleAst->body) {
-                        if (auto* es = dynamic_cast<ExprStmt*>(stmt.get())) {
+                        if (auto* es = ast_cast<ExprStmt>(stmt.get())) {
                             // Look for module.exports = { ... }
-                            if (auto* assign = dynamic_cast<AssignmentExpr*>(
+                            if (auto* assign = ast_cast<AssignmentExpr>(
                                     es->expression.get())) {
-                                auto* lhs = dynamic_cast<MemberExpr*>(
+                                auto* lhs = ast_cast<MemberExpr>(
                                     assign->left.get());
                                 if (lhs) {
-                                    auto* base = dynamic_cast<Identifier*>(
+                                    auto* base = ast_cast<Identifier>(
                                         lhs->object.get());
-                                    auto* prop = dynamic_cast<Identifier*>(
+                                    auto* prop = ast_cast<Identifier>(
                                         lhs->property.get());
                                     if (base && prop &&
                                         base->name == "module" &&
@@ -15081,15 +15097,15 @@ void HIRGenerator::visit(CallExpr& node) {
                                         // If RHS is an object literal, extract
                                         // its properties and set them on the
                                         // exports object at compile time.
-                                        auto* objLit = dynamic_cast<ObjectExpr*>(
+                                        auto* objLit = ast_cast<ObjectExpr>(
                                             assign->right.get());
                                         if (objLit) {
                                             for (auto& objProp : objLit->properties) {
                                                 // Extract key name from Identifier or StringLiteral.
                                                 std::string keyName;
-                                                if (auto* keyId = dynamic_cast<Identifier*>(objProp.key.get())) {
+                                                if (auto* keyId = ast_cast<Identifier>(objProp.key.get())) {
                                                     keyName = keyId->name;
-                                                } else if (auto* keyStr = dynamic_cast<StringLiteral*>(objProp.key.get())) {
+                                                } else if (auto* keyStr = ast_cast<StringLiteral>(objProp.key.get())) {
                                                     keyName = keyStr->value;
                                                 }
                                                 if (keyName.empty()) continue;
@@ -15102,7 +15118,7 @@ void HIRGenerator::visit(CallExpr& node) {
                                                     HIRValue* valI64 = val;
                                                     if (!val->type ||
                                                         val->type->kind != HIRType::Kind::I64) {
-                                                        auto i64T = std::make_shared<HIRType>(HIRType::Kind::I64);
+                                                        auto i64T = HIRType::get(HIRType::Kind::I64);
                                                         valI64 = builder_->createCast(
                                                             val, i64T.get(), "exports.val.cast");
                                                     }
@@ -15118,14 +15134,14 @@ void HIRGenerator::visit(CallExpr& node) {
                                 }
                             }
                             // For `exports.foo = value` patterns.
-                            if (auto* assign = dynamic_cast<AssignmentExpr*>(
+                            if (auto* assign = ast_cast<AssignmentExpr>(
                                     es->expression.get())) {
-                                auto* lhs = dynamic_cast<MemberExpr*>(
+                                auto* lhs = ast_cast<MemberExpr>(
                                     assign->left.get());
                                 if (lhs) {
-                                    auto* base = dynamic_cast<Identifier*>(
+                                    auto* base = ast_cast<Identifier>(
                                         lhs->object.get());
-                                    auto* prop = dynamic_cast<Identifier*>(
+                                    auto* prop = ast_cast<Identifier>(
                                         lhs->property.get());
                                     if (base && prop &&
                                         base->name == "exports") {
@@ -15137,7 +15153,7 @@ void HIRGenerator::visit(CallExpr& node) {
                                             HIRValue* valI64 = val;
                                             if (!val->type ||
                                                 val->type->kind != HIRType::Kind::I64) {
-                                                auto i64T = std::make_shared<HIRType>(HIRType::Kind::I64);
+                                                auto i64T = HIRType::get(HIRType::Kind::I64);
                                                 valI64 = builder_->createCast(
                                                     val, i64T.get(), "exports.val.cast");
                                             }
@@ -15164,17 +15180,17 @@ void HIRGenerator::visit(CallExpr& node) {
 
             // Fallback: if we can't resolve at compile time, return null.
             lastValue_ = builder_->createNullConstant(
-                std::make_shared<HIRType>(HIRType::Kind::Pointer).get());
+                HIRType::get(HIRType::Kind::Pointer).get());
             return;
         }
 
         // Check if this is an instance class method call: obj.method(...)
-        if (auto* memberExpr = dynamic_cast<MemberExpr*>(node.callee.get())) {
+        if (auto* memberExpr = ast_cast<MemberExpr>(node.callee.get())) {
             // Get the object
             memberExpr->object->accept(*this);
             HIRValue* object = lastValue_;
 
-            if (auto* propExpr = dynamic_cast<Identifier*>(memberExpr->property.get())) {
+            if (auto* propExpr = ast_cast<Identifier>(memberExpr->property.get())) {
                 std::string methodName = propExpr->name;
 
                 // Check if object has a struct type (indicating it's a class instance)
@@ -15267,14 +15283,14 @@ void HIRGenerator::visit(CallExpr& node) {
         // Generate arguments
         std::vector<HIRValue*> args;
         auto* directCallee =
-            dynamic_cast<Identifier*>(node.callee.get());
+            ast_cast<Identifier>(node.callee.get());
         for (size_t argumentIndex = 0;
              argumentIndex < node.arguments.size();
              ++argumentIndex) {
             auto& arg = node.arguments[argumentIndex];
             const bool forceDynamicLiteral =
                 directCallee &&
-                dynamic_cast<ObjectExpr*>(arg.get()) &&
+                ast_cast<ObjectExpr>(arg.get()) &&
                 dynamicObjectParameterIndices_[directCallee->name].count(
                     argumentIndex) > 0;
             const std::string savedDeclName = currentDeclName_;
@@ -15290,14 +15306,14 @@ void HIRGenerator::visit(CallExpr& node) {
             // helper (for example verifyProperty) must preserve the singleton
             // runtime Object rather than the old integer compiler marker.
             if (auto* intrinsicArgument =
-                    dynamic_cast<Identifier*>(arg.get());
+                    ast_cast<Identifier>(arg.get());
                 intrinsicArgument &&
                 intrinsicArgument->name == "RegExp") {
                 auto stringType =
-                    std::make_shared<HIRType>(HIRType::Kind::String);
+                    HIRType::get(HIRType::Kind::String);
                 auto pointerType =
                     std::make_shared<HIRPointerType>(
-                        std::make_shared<HIRType>(HIRType::Kind::Any),
+                        HIRType::get(HIRType::Kind::Any),
                         true);
                 HIRFunction* getter = nullptr;
                 if (auto existing =
@@ -15346,9 +15362,9 @@ void HIRGenerator::visit(CallExpr& node) {
                 return argument;
             }
             auto jsValueType =
-                std::make_shared<HIRType>(HIRType::Kind::JSValue);
+                HIRType::get(HIRType::Kind::JSValue);
             auto pointerType =
-                std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                HIRType::get(HIRType::Kind::Pointer);
             HIRFunction* converter = nullptr;
             if (auto existing =
                     module_->getFunction("nova_value_to_object")) {
@@ -15407,7 +15423,7 @@ void HIRGenerator::visit(CallExpr& node) {
         };
 
         // Lookup function
-        if (auto* id = dynamic_cast<Identifier*>(node.callee.get())) {
+        if (auto* id = ast_cast<Identifier>(node.callee.get())) {
             // Check if we need to apply default parameters
             auto defaultValuesIt = functionDefaultValues_.find(id->name);
             if (defaultValuesIt != functionDefaultValues_.end()) {
@@ -15495,10 +15511,10 @@ void HIRGenerator::visit(CallExpr& node) {
                                 if (expected ==
                                     HIRType::Kind::String) {
                                     auto stringType =
-                                        std::make_shared<HIRType>(
+                                        HIRType::get(
                                             HIRType::Kind::String);
                                     auto jsValueType =
-                                        std::make_shared<HIRType>(
+                                        HIRType::get(
                                             HIRType::Kind::JSValue);
                                     HIRFunction* converter = nullptr;
                                     if (auto existing =
@@ -15603,10 +15619,10 @@ void HIRGenerator::visit(CallExpr& node) {
                             args[1]->type->kind ==
                                 HIRType::Kind::JSValue) {
                             auto stringType =
-                                std::make_shared<HIRType>(
+                                HIRType::get(
                                     HIRType::Kind::String);
                             auto jsValueType =
-                                std::make_shared<HIRType>(
+                                HIRType::get(
                                     HIRType::Kind::JSValue);
                             HIRFunction* converter = nullptr;
                             if (auto existing =
@@ -15668,8 +15684,8 @@ void HIRGenerator::visit(CallExpr& node) {
                 if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected async generator function call: " << id->name << std::endl;
 
                 // Create async generator object with nova_async_generator_create(funcPtr, initialState)
-                auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                auto intType = HIRType::get(HIRType::Kind::I64);
                 std::vector<HIRTypePtr> paramTypes = {ptrType, intType};
                 HIRTypePtr returnType = ptrType;
 
@@ -15714,9 +15730,9 @@ void HIRGenerator::visit(CallExpr& node) {
                 if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Detected generator function call: " << id->name << std::endl;
 
                 // Create generator object with nova_generator_create(funcPtr, initialState)
-                auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
-                auto voidType = std::make_shared<HIRType>(HIRType::Kind::Void);
+                auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                auto intType = HIRType::get(HIRType::Kind::I64);
+                auto voidType = HIRType::get(HIRType::Kind::Void);
                 std::vector<HIRTypePtr> paramTypes = {ptrType, intType};
                 HIRTypePtr returnType = ptrType;
 
@@ -15781,7 +15797,7 @@ void HIRGenerator::visit(CallExpr& node) {
                              storedArgument->type->kind ==
                                  HIRType::Kind::Any)) {
                             auto f64Type =
-                                std::make_shared<HIRType>(HIRType::Kind::F64);
+                                HIRType::get(HIRType::Kind::F64);
                             HIRFunction* toNumber = nullptr;
                             if (auto existing =
                                     module_->getFunction(
@@ -15789,7 +15805,7 @@ void HIRGenerator::visit(CallExpr& node) {
                                 toNumber = existing.get();
                             } else {
                                 auto* toNumberType = new HIRFunctionType(
-                                    {std::make_shared<HIRType>(
+                                    {HIRType::get(
                                          HIRType::Kind::JSValue)},
                                     f64Type);
                                 auto created = module_->createFunction(
@@ -15889,9 +15905,9 @@ void HIRGenerator::visit(CallExpr& node) {
                                                 varName + ".closure.initial");
                                         }
 
-                                        auto sizeType = std::make_shared<HIRType>(
+                                        auto sizeType = HIRType::get(
                                             HIRType::Kind::I64);
-                                        auto opaqueType = std::make_shared<HIRType>(
+                                        auto opaqueType = HIRType::get(
                                             HIRType::Kind::Any);
                                         auto opaquePointer =
                                             std::make_shared<HIRPointerType>(
@@ -15974,7 +15990,7 @@ void HIRGenerator::visit(CallExpr& node) {
                 }
                 if (callable && callable->type &&
                     callable->type->kind == HIRType::Kind::JSValue) {
-                    auto jsValueType = std::make_shared<HIRType>(
+                    auto jsValueType = HIRType::get(
                         HIRType::Kind::JSValue);
                     auto existing = module_->getFunction("nova_callable_call1");
                     HIRFunction* callFunction = existing ? existing.get() : nullptr;
@@ -16002,9 +16018,9 @@ void HIRGenerator::visit(CallExpr& node) {
                     // existing variadic runtime trampoline instead of
                     // silently dropping `func()`.
                     auto pointerType =
-                        std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                        HIRType::get(HIRType::Kind::Pointer);
                     auto integerType =
-                        std::make_shared<HIRType>(HIRType::Kind::I64);
+                        HIRType::get(HIRType::Kind::I64);
                     std::vector<HIRTypePtr> parameterTypes = {
                         pointerType, pointerType,
                         integerType, integerType, integerType, integerType,
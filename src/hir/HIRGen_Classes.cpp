@@ -19,15 +19,15 @@ namespace {
 //   - Identifier                               -> NOT supported (returns false)
 bool tryFoldComputedKeyToStr(Expr* expr, std::string& out) {
     if (!expr) return false;
-    if (auto* strLit = dynamic_cast<StringLiteral*>(expr)) {
+    if (auto* strLit = ast_cast<StringLiteral>(expr)) {
         out = strLit->value;
         return true;
     }
-    if (auto* numLit = dynamic_cast<NumberLiteral*>(expr)) {
+    if (auto* numLit = ast_cast<NumberLiteral>(expr)) {
         out = std::to_string(numLit->value);
         return true;
     }
-    if (auto* binExpr = dynamic_cast<BinaryExpr*>(expr)) {
+    if (auto* binExpr = ast_cast<BinaryExpr>(expr)) {
         if (binExpr->op == BinaryExpr::Op::Add) {
             std::string lhs, rhs;
             if (tryFoldComputedKeyToStr(binExpr->left.get(), lhs) &&
@@ -97,7 +97,7 @@ void HIRGenerator::visit(ClassExpr& node) {
                 if (prop.type) {
                     typeKind = convertTypeKind(prop.type->kind);
                 }
-                auto fieldType = std::make_shared<hir::HIRType>(typeKind);
+                auto fieldType = hir::HIRType::get(typeKind);
                 fields.push_back({prop.name, fieldType, true});
                 fieldNames.insert(prop.name);
             }
@@ -106,18 +106,18 @@ void HIRGenerator::visit(ClassExpr& node) {
         // Also scan constructor for this.property assignments to auto-add fields
         for (auto& method : node.methods) {
             if (method.kind == ClassExpr::Method::Kind::Constructor && method.body) {
-                BlockStmt* bodyBlock = dynamic_cast<BlockStmt*>(method.body.get());
+                BlockStmt* bodyBlock = ast_cast<BlockStmt>(method.body.get());
                 if (bodyBlock) {
                     for (auto& stmt : bodyBlock->statements) {
-                        ExprStmt* exprStmt = dynamic_cast<ExprStmt*>(stmt.get());
+                        ExprStmt* exprStmt = ast_cast<ExprStmt>(stmt.get());
                         if (exprStmt) {
-                            AssignmentExpr* assignExpr = dynamic_cast<AssignmentExpr*>(exprStmt->expression.get());
+                            AssignmentExpr* assignExpr = ast_cast<AssignmentExpr>(exprStmt->expression.get());
                             if (assignExpr) {
-                                MemberExpr* memberExpr = dynamic_cast<MemberExpr*>(assignExpr->left.get());
+                                MemberExpr* memberExpr = ast_cast<MemberExpr>(assignExpr->left.get());
                                 if (memberExpr) {
-                                    ThisExpr* thisExpr = dynamic_cast<ThisExpr*>(memberExpr->object.get());
+                                    ThisExpr* thisExpr = ast_cast<ThisExpr>(memberExpr->object.get());
                                     if (thisExpr) {
-                                        Identifier* propIdent = dynamic_cast<Identifier*>(memberExpr->property.get());
+                                        Identifier* propIdent = ast_cast<Identifier>(memberExpr->property.get());
                                         if (propIdent) {
                                             std::string propName = propIdent->name;
                                             if (fieldNames.find(propName) == fieldNames.end()) {
@@ -125,18 +125,18 @@ void HIRGenerator::visit(ClassExpr& node) {
                                                 hir::HIRType::Kind typeKind = hir::HIRType::Kind::I64; // default
 
                                                 // Check what's being assigned
-                                                if (auto* stringLit = dynamic_cast<StringLiteral*>(assignExpr->right.get())) {
+                                                if (ast_isa<StringLiteral>(assignExpr->right.get())) {
                                                     typeKind = hir::HIRType::Kind::String;
                                                     if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Field '" << propName << "' inferred as String from string literal" << std::endl;
-                                                } else if (auto* numLit = dynamic_cast<NumberLiteral*>(assignExpr->right.get())) {
+                                                } else if (ast_isa<NumberLiteral>(assignExpr->right.get())) {
                                                     typeKind = hir::HIRType::Kind::I64;
-                                                } else if (auto* ident = dynamic_cast<Identifier*>(assignExpr->right.get())) {
+                                                } else if (auto* ident = ast_cast<Identifier>(assignExpr->right.get())) {
                                                     // Constructor parameter - use Any for dynamic typing (supports all types)
                                                     typeKind = hir::HIRType::Kind::Any;
                                                     if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Field '" << propName << "' inferred as Any from parameter '" << ident->name << "'" << std::endl;
                                                 }
 
-                                                auto fieldType = std::make_shared<hir::HIRType>(typeKind);
+                                                auto fieldType = hir::HIRType::get(typeKind);
                                                 fields.push_back({propName, fieldType, true});
                                                 fieldNames.insert(propName);
                                                 if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Auto-added field '" << propName << "' from constructor" << std::endl;
@@ -169,10 +169,10 @@ void HIRGenerator::visit(ClassExpr& node) {
 
             std::vector<hir::HIRTypePtr> paramTypes;
             for (size_t i = 0; i < constructor->params.size(); ++i) {
-                paramTypes.push_back(std::make_shared<hir::HIRType>(hir::HIRType::Kind::Any));
+                paramTypes.push_back(hir::HIRType::get(hir::HIRType::Kind::Any));
             }
 
-            auto returnType = std::make_shared<hir::HIRType>(hir::HIRType::Kind::Any);
+            auto returnType = hir::HIRType::get(hir::HIRType::Kind::Any);
             auto funcType = new HIRFunctionType(paramTypes, returnType);
             auto func = module_->createFunction(funcName, funcType);
 
@@ -209,8 +209,8 @@ void HIRGenerator::visit(ClassExpr& node) {
             }
             if (!mallocFunc) {
                 std::vector<hir::HIRTypePtr> mallocParams;
-                mallocParams.push_back(std::make_shared<hir::HIRType>(hir::HIRType::Kind::I64));
-                auto mallocRetType = std::make_shared<hir::HIRType>(hir::HIRType::Kind::Any);
+                mallocParams.push_back(hir::HIRType::get(hir::HIRType::Kind::I64));
+                auto mallocRetType = hir::HIRType::get(hir::HIRType::Kind::Any);
                 auto mallocType = new HIRFunctionType(mallocParams, mallocRetType);
                 auto mallocFuncPtr = module_->createFunction("malloc", mallocType);
                 mallocFuncPtr->linkage = HIRFunction::Linkage::External;
@@ -220,7 +220,7 @@ void HIRGenerator::visit(ClassExpr& node) {
             std::vector<HIRValue*> mallocArgs = {sizeValue};
             auto instancePtr = builder_->createCall(mallocFunc, mallocArgs, "instance");
             instancePtr->type = std::make_shared<hir::HIRPointerType>(
-                std::shared_ptr<hir::HIRStructType>(structType, [](hir::HIRStructType*){}), true);
+                hir::unownedRef<hir::HIRStructType>(structType), true);
 
             symbolTable_["this"] = instancePtr;
 
@@ -257,16 +257,16 @@ void HIRGenerator::visit(ClassExpr& node) {
                 std::vector<hir::HIRTypePtr> paramTypes;
                 // Create proper pointer-to-struct type for 'this' parameter
                 paramTypes.push_back(std::make_shared<hir::HIRPointerType>(
-                    std::shared_ptr<hir::HIRStructType>(structType, [](hir::HIRStructType*){}), true));
+                    hir::unownedRef<hir::HIRStructType>(structType), true));
                 for (size_t i = 0; i < method.params.size(); ++i) {
-                    paramTypes.push_back(std::make_shared<hir::HIRType>(hir::HIRType::Kind::Any));
+                    paramTypes.push_back(hir::HIRType::get(hir::HIRType::Kind::Any));
                 }
 
                 hir::HIRType::Kind retTypeKind = hir::HIRType::Kind::Any;
                 if (method.returnType) {
                     retTypeKind = convertTypeKind(method.returnType->kind);
                 }
-                auto returnType = std::make_shared<hir::HIRType>(retTypeKind);
+                auto returnType = hir::HIRType::get(retTypeKind);
 
                 auto funcType = new HIRFunctionType(paramTypes, returnType);
                 auto func = module_->createFunction(methodFuncName, funcType);
@@ -374,14 +374,14 @@ void HIRGenerator::visit(NewExpr& node) {
         // Get class name from callee (should be an Identifier or MemberExpr for Intl.*)
         std::string className;
         std::string objectName;  // For MemberExpr like Intl.NumberFormat
-        if (auto* id = dynamic_cast<Identifier*>(node.callee.get())) {
+        if (auto* id = ast_cast<Identifier>(node.callee.get())) {
             className = id->name;
             if(NOVA_DEBUG) std::cerr << "  DEBUG NEW: Class name: " << className << std::endl;
-        } else if (auto* memberExpr = dynamic_cast<MemberExpr*>(node.callee.get())) {
+        } else if (auto* memberExpr = ast_cast<MemberExpr>(node.callee.get())) {
             // Handle Intl.NumberFormat, Intl.DateTimeFormat, etc.
-            if (auto* objId = dynamic_cast<Identifier*>(memberExpr->object.get())) {
+            if (auto* objId = ast_cast<Identifier>(memberExpr->object.get())) {
                 objectName = objId->name;
-                if (auto* propId = dynamic_cast<Identifier*>(memberExpr->property.get())) {
+                if (auto* propId = ast_cast<Identifier>(memberExpr->property.get())) {
                     className = propId->name;
                     if (NOVA_DEBUG) std::cerr << "  DEBUG: MemberExpr class: " << objectName << "." << className << std::endl;
                 }
@@ -408,9 +408,9 @@ void HIRGenerator::visit(NewExpr& node) {
               className == "toGMTString" || className == "compile"));
         if (knownNonConstructor) {
             auto stringType =
-                std::make_shared<HIRType>(HIRType::Kind::String);
+                HIRType::get(HIRType::Kind::String);
             auto voidType =
-                std::make_shared<HIRType>(HIRType::Kind::Void);
+                HIRType::get(HIRType::Kind::Void);
             HIRFunction* throwTypeError = nullptr;
             if (auto existing =
                     module_->getFunction("nova_throw_type_error")) {
@@ -431,14 +431,14 @@ void HIRGenerator::visit(NewExpr& node) {
                     " is not a constructor")},
                 "new.not.constructor");
             lastValue_ = builder_->createNullConstant(
-                std::make_shared<HIRType>(
+                HIRType::get(
                     HIRType::Kind::Pointer).get());
             return;
         }
 
         // Handle Intl.* constructors
         if (objectName == "Intl") {
-            auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+            auto ptrType = HIRType::get(HIRType::Kind::Pointer);
 
             std::string runtimeFunc;
             HIRValue* localeArg = nullptr;
@@ -456,29 +456,29 @@ void HIRGenerator::visit(NewExpr& node) {
             // Get options argument (second arg)
             if (node.arguments.size() >= 2) {
                 if (auto* options =
-                        dynamic_cast<ObjectExpr*>(node.arguments[1].get())) {
+                        ast_cast<ObjectExpr>(node.arguments[1].get())) {
                     std::string serialized;
                     for (const auto& property : options->properties) {
                         std::string key;
                         if (auto* identifier =
-                                dynamic_cast<Identifier*>(property.key.get())) {
+                                ast_cast<Identifier>(property.key.get())) {
                             key = identifier->name;
                         } else if (auto* stringKey =
-                                       dynamic_cast<StringLiteral*>(
+                                       ast_cast<StringLiteral>(
                                            property.key.get())) {
                             key = stringKey->value;
                         }
                         std::string value;
                         if (auto* stringValue =
-                                dynamic_cast<StringLiteral*>(
+                                ast_cast<StringLiteral>(
                                     property.value.get())) {
                             value = stringValue->value;
                         } else if (auto* booleanValue =
-                                       dynamic_cast<BooleanLiteral*>(
+                                       ast_cast<BooleanLiteral>(
                                            property.value.get())) {
                             value = booleanValue->value ? "true" : "false";
                         } else if (auto* numberValue =
-                                       dynamic_cast<NumberLiteral*>(
+                                       ast_cast<NumberLiteral>(
                                            property.value.get())) {
                             value = std::to_string(numberValue->value);
                         }
@@ -552,9 +552,9 @@ void HIRGenerator::visit(NewExpr& node) {
         // Constructor syntax and regex literals share the same runtime object.
         if (className == "RegExp") {
             auto stringType =
-                std::make_shared<HIRType>(HIRType::Kind::String);
+                HIRType::get(HIRType::Kind::String);
             auto regexType =
-                std::make_shared<HIRType>(HIRType::Kind::Any);
+                HIRType::get(HIRType::Kind::Any);
             HIRValue* pattern = builder_->createStringConstant("");
             HIRValue* flags = builder_->createStringConstant("");
             if (!node.arguments.empty()) {
@@ -588,8 +588,8 @@ void HIRGenerator::visit(NewExpr& node) {
         if (className == "AggregateError") {
             if (NOVA_DEBUG) std::cerr << "  DEBUG: Handling AggregateError" << std::endl;
 
-            auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-            auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+            auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+            auto intType = HIRType::get(HIRType::Kind::I64);
 
             // JavaScript API: new AggregateError(errors, message)
             // Runtime API: nova_aggregate_error_create(message, errors, count)
@@ -603,7 +603,7 @@ void HIRGenerator::visit(NewExpr& node) {
                 errorsArg = lastValue_;
 
                 // Try to get array length if it's an array literal
-                if (auto* arrLit = dynamic_cast<ArrayExpr*>(node.arguments[0].get())) {
+                if (auto* arrLit = ast_cast<ArrayExpr>(node.arguments[0].get())) {
                     errorCount = static_cast<int64_t>(arrLit->elements.size());
                 }
             }
@@ -618,14 +618,14 @@ void HIRGenerator::visit(NewExpr& node) {
             HIRValue* causeArg = nullptr;
             if (node.arguments.size() >= 3) {
                 if (auto* options =
-                        dynamic_cast<ObjectExpr*>(node.arguments[2].get())) {
+                        ast_cast<ObjectExpr>(node.arguments[2].get())) {
                     for (auto& property : options->properties) {
                         std::string key;
                         if (auto* identifier =
-                                dynamic_cast<Identifier*>(property.key.get())) {
+                                ast_cast<Identifier>(property.key.get())) {
                             key = identifier->name;
                         } else if (auto* literal =
-                                       dynamic_cast<StringLiteral*>(
+                                       ast_cast<StringLiteral>(
                                            property.key.get())) {
                             key = literal->value;
                         }
@@ -645,7 +645,7 @@ void HIRGenerator::visit(NewExpr& node) {
             // Create function type: ptr @(ptr, ptr, i64[, i64])
             std::vector<HIRTypePtr> paramTypes = {ptrType, ptrType, intType};
             if (causeArg) {
-                paramTypes.push_back(std::make_shared<HIRType>(
+                paramTypes.push_back(HIRType::get(
                     HIRType::Kind::JSValue));
             }
 
@@ -681,8 +681,8 @@ void HIRGenerator::visit(NewExpr& node) {
         if (className == "ArrayBuffer") {
             if (NOVA_DEBUG) std::cerr << "  DEBUG: Handling ArrayBuffer constructor" << std::endl;
 
-            auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-            auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+            auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+            auto intType = HIRType::get(HIRType::Kind::I64);
 
             // Get length argument
             HIRValue* lengthArg = nullptr;
@@ -697,14 +697,14 @@ void HIRGenerator::visit(NewExpr& node) {
             HIRValue* maxByteLengthArg = nullptr;
             if (node.arguments.size() >= 2) {
                 auto* optionsExpr = node.arguments[1].get();
-                auto* objExpr = dynamic_cast<ObjectExpr*>(optionsExpr);
+                auto* objExpr = ast_cast<ObjectExpr>(optionsExpr);
                 if (objExpr) {
                     // Extract maxByteLength property if present
                     for (auto& prop : objExpr->properties) {
                         std::string keyName;
-                        if (auto* ident = dynamic_cast<Identifier*>(prop.key.get())) {
+                        if (auto* ident = ast_cast<Identifier>(prop.key.get())) {
                             keyName = ident->name;
-                        } else if (auto* strLit = dynamic_cast<StringLiteral*>(prop.key.get())) {
+                        } else if (auto* strLit = ast_cast<StringLiteral>(prop.key.get())) {
                             keyName = strLit->value;
                         }
                         if (keyName == "maxByteLength" && prop.value) {
@@ -744,8 +744,8 @@ void HIRGenerator::visit(NewExpr& node) {
         if (className == "SharedArrayBuffer") {
             if (NOVA_DEBUG) std::cerr << "  DEBUG: Handling SharedArrayBuffer constructor" << std::endl;
 
-            auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-            auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+            auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+            auto intType = HIRType::get(HIRType::Kind::I64);
 
             // Get length argument
             HIRValue* lengthArg = nullptr;
@@ -777,7 +777,7 @@ void HIRGenerator::visit(NewExpr& node) {
 
         // Handle Map constructor (ES2015)
         if (className == "Map") {
-            auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+            auto ptrType = HIRType::get(HIRType::Kind::Pointer);
 
             std::string runtimeFunc = "nova_map_create";
             std::vector<HIRTypePtr> paramTypes;  // No parameters for new Map()
@@ -802,7 +802,7 @@ void HIRGenerator::visit(NewExpr& node) {
 
         // Handle Set constructor (ES2015)
         if (className == "Set") {
-            auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+            auto ptrType = HIRType::get(HIRType::Kind::Pointer);
 
             // If an iterable argument was provided, use nova_set_create_from
             if (node.arguments.size() > 0) {
@@ -853,7 +853,7 @@ void HIRGenerator::visit(NewExpr& node) {
 
         // Handle WeakMap constructor (ES2015)
         if (className == "WeakMap") {
-            auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+            auto ptrType = HIRType::get(HIRType::Kind::Pointer);
 
             std::string runtimeFunc = "nova_weakmap_create";
             std::vector<HIRTypePtr> paramTypes;  // No parameters for new WeakMap()
@@ -878,7 +878,7 @@ void HIRGenerator::visit(NewExpr& node) {
 
         // Handle WeakRef constructor (ES2021)
         if (className == "WeakRef") {
-            auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+            auto ptrType = HIRType::get(HIRType::Kind::Pointer);
 
             std::string runtimeFunc = "nova_weakref_create";
             std::vector<HIRTypePtr> paramTypes = {ptrType};  // target object
@@ -887,7 +887,7 @@ void HIRGenerator::visit(NewExpr& node) {
             // Get target argument
             if (node.arguments.size() > 0) {
                 const bool inlineObject =
-                    dynamic_cast<ObjectExpr*>(
+                    ast_cast<ObjectExpr>(
                         node.arguments[0].get()) != nullptr;
                 const std::string savedDeclName = currentDeclName_;
                 if (inlineObject) {
@@ -925,7 +925,7 @@ void HIRGenerator::visit(NewExpr& node) {
         if (className == "WeakSet") {
             if (NOVA_DEBUG) std::cerr << "  DEBUG: Handling WeakSet constructor" << std::endl;
 
-            auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+            auto ptrType = HIRType::get(HIRType::Kind::Pointer);
 
             std::string runtimeFunc = "nova_weakset_create";
             std::vector<HIRTypePtr> paramTypes;  // No parameters for new WeakSet()
@@ -952,8 +952,8 @@ void HIRGenerator::visit(NewExpr& node) {
         if (className == "URL") {
             if (NOVA_DEBUG) std::cerr << "  DEBUG: Handling URL constructor" << std::endl;
 
-            auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-            auto strType = std::make_shared<HIRType>(HIRType::Kind::String);
+            auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+            auto strType = HIRType::get(HIRType::Kind::String);
 
             if (node.arguments.size() >= 2) {
                 // new URL(url, base)
@@ -1011,8 +1011,8 @@ void HIRGenerator::visit(NewExpr& node) {
         if (className == "URLSearchParams") {
             if (NOVA_DEBUG) std::cerr << "  DEBUG: Handling URLSearchParams constructor" << std::endl;
 
-            auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-            auto strType = std::make_shared<HIRType>(HIRType::Kind::String);
+            auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+            auto strType = HIRType::get(HIRType::Kind::String);
 
             std::string runtimeFunc = "nova_urlsearchparams_create";
             std::vector<HIRTypePtr> paramTypes = {strType};
@@ -1046,7 +1046,7 @@ void HIRGenerator::visit(NewExpr& node) {
         if (className == "TextEncoder") {
             if (NOVA_DEBUG) std::cerr << "  DEBUG: Handling TextEncoder constructor" << std::endl;
 
-            auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+            auto ptrType = HIRType::get(HIRType::Kind::Pointer);
 
             std::string runtimeFunc = "nova_textencoder_create";
             std::vector<HIRTypePtr> paramTypes;
@@ -1073,8 +1073,8 @@ void HIRGenerator::visit(NewExpr& node) {
         if (className == "TextDecoder") {
             if (NOVA_DEBUG) std::cerr << "  DEBUG: Handling TextDecoder constructor" << std::endl;
 
-            auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-            auto strType = std::make_shared<HIRType>(HIRType::Kind::String);
+            auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+            auto strType = HIRType::get(HIRType::Kind::String);
 
             std::string runtimeFunc;
             std::vector<HIRTypePtr> paramTypes;
@@ -1110,7 +1110,7 @@ void HIRGenerator::visit(NewExpr& node) {
         if (className == "Headers") {
             if (NOVA_DEBUG) std::cerr << "  DEBUG: Handling Headers constructor" << std::endl;
 
-            auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+            auto ptrType = HIRType::get(HIRType::Kind::Pointer);
 
             std::string runtimeFunc = "nova_headers_create";
             std::vector<HIRTypePtr> paramTypes;
@@ -1137,8 +1137,8 @@ void HIRGenerator::visit(NewExpr& node) {
         if (className == "Request") {
             if (NOVA_DEBUG) std::cerr << "  DEBUG: Handling Request constructor" << std::endl;
 
-            auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-            auto strType = std::make_shared<HIRType>(HIRType::Kind::String);
+            auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+            auto strType = HIRType::get(HIRType::Kind::String);
 
             std::string runtimeFunc = "nova_request_create";
             std::vector<HIRTypePtr> paramTypes = {strType};
@@ -1172,9 +1172,9 @@ void HIRGenerator::visit(NewExpr& node) {
         if (className == "Response") {
             if (NOVA_DEBUG) std::cerr << "  DEBUG: Handling Response constructor" << std::endl;
 
-            auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-            auto strType = std::make_shared<HIRType>(HIRType::Kind::String);
-            auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+            auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+            auto strType = HIRType::get(HIRType::Kind::String);
+            auto intType = HIRType::get(HIRType::Kind::I64);
 
             std::string runtimeFunc = "nova_response_create";
             std::vector<HIRTypePtr> paramTypes = {strType, intType, strType};
@@ -1214,7 +1214,7 @@ void HIRGenerator::visit(NewExpr& node) {
         if (className == "Proxy") {
             if (NOVA_DEBUG) std::cerr << "  DEBUG: Handling Proxy constructor" << std::endl;
 
-            auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+            auto ptrType = HIRType::get(HIRType::Kind::Pointer);
 
             std::string runtimeFunc = "nova_proxy_create";
             std::vector<HIRTypePtr> paramTypes = {ptrType, ptrType};  // target, handler
@@ -1231,7 +1231,7 @@ void HIRGenerator::visit(NewExpr& node) {
             // Get handler argument
             if (node.arguments.size() > 1) {
                 const bool inlineObject =
-                    dynamic_cast<ObjectExpr*>(
+                    ast_cast<ObjectExpr>(
                         node.arguments[1].get()) != nullptr;
                 const std::string savedDeclName = currentDeclName_;
                 if (inlineObject) {
@@ -1266,8 +1266,8 @@ void HIRGenerator::visit(NewExpr& node) {
 
         // Handle Array(length) constructor.
         if (className == "Array") {
-            auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
-            auto elementType = std::make_shared<HIRType>(HIRType::Kind::I64);
+            auto intType = HIRType::get(HIRType::Kind::I64);
+            auto elementType = HIRType::get(HIRType::Kind::I64);
             auto arrayType = std::make_shared<HIRArrayType>(elementType, 0);
             auto returnType =
                 std::make_shared<HIRPointerType>(arrayType, true);
@@ -1299,8 +1299,8 @@ void HIRGenerator::visit(NewExpr& node) {
         if (className == "Date") {
             if (NOVA_DEBUG) std::cerr << "  DEBUG: Handling Date constructor" << std::endl;
 
-            auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-            auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+            auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+            auto intType = HIRType::get(HIRType::Kind::I64);
 
             std::string runtimeFunc;
             std::vector<HIRTypePtr> paramTypes;
@@ -1314,9 +1314,9 @@ void HIRGenerator::visit(NewExpr& node) {
                 // new Date(timestamp) or new Date(dateString)
                 // Check if the argument is a string
                 bool isStringArg = false;
-                if (auto* strLit = dynamic_cast<StringLiteral*>(node.arguments[0].get())) {
+                if (ast_isa<StringLiteral>(node.arguments[0].get())) {
                     isStringArg = true;
-                } else if (auto* ident = dynamic_cast<Identifier*>(node.arguments[0].get())) {
+                } else if (ast_isa<Identifier>(node.arguments[0].get())) {
                     // Could be a string variable - hard to know without type info
                     // Conservative: only treat string literals as date strings
                     isStringArg = false;
@@ -1329,7 +1329,7 @@ void HIRGenerator::visit(NewExpr& node) {
                     HIRValue* strArg = lastValue_;
 
                     // Step 2: call nova_date_parse(string) -> i64 timestamp
-                    auto strType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                    auto strType = HIRType::get(HIRType::Kind::Pointer);
                     std::vector<HIRTypePtr> parseParamTypes = {strType};
                     auto parseReturnType = intType;
                     auto existingParseFunc = module_->getFunction("nova_date_parse");
@@ -1403,13 +1403,13 @@ void HIRGenerator::visit(NewExpr& node) {
 
             if (NOVA_DEBUG) std::cerr << "  DEBUG: Handling TypedArray constructor: " << className << std::endl;
 
-            auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-            auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+            auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+            auto intType = HIRType::get(HIRType::Kind::I64);
 
             // Check if first argument is an ArrayBuffer
             bool isFromBuffer = false;
             if (!node.arguments.empty()) {
-                if (auto* argIdent = dynamic_cast<Identifier*>(node.arguments[0].get())) {
+                if (auto* argIdent = ast_cast<Identifier>(node.arguments[0].get())) {
                     if (arrayBufferVars_.count(argIdent->name) > 0 ||
                         sharedArrayBufferVars_.count(argIdent->name) > 0) {
                         isFromBuffer = true;
@@ -1524,8 +1524,8 @@ void HIRGenerator::visit(NewExpr& node) {
         if (className == "DataView") {
             if (NOVA_DEBUG) std::cerr << "  DEBUG: Handling DataView constructor" << std::endl;
 
-            auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-            auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+            auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+            auto intType = HIRType::get(HIRType::Kind::I64);
 
             // Get arguments: buffer, byteOffset (optional), byteLength (optional)
             HIRValue* bufferArg = nullptr;
@@ -1572,7 +1572,7 @@ void HIRGenerator::visit(NewExpr& node) {
         if (className == "DisposableStack") {
             if (NOVA_DEBUG) std::cerr << "  DEBUG: Handling DisposableStack constructor" << std::endl;
 
-            auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+            auto ptrType = HIRType::get(HIRType::Kind::Pointer);
 
             // DisposableStack takes no arguments
             std::vector<HIRTypePtr> paramTypes = {};
@@ -1598,7 +1598,7 @@ void HIRGenerator::visit(NewExpr& node) {
         if (className == "AsyncDisposableStack") {
             if (NOVA_DEBUG) std::cerr << "  DEBUG: Handling AsyncDisposableStack constructor" << std::endl;
 
-            auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+            auto ptrType = HIRType::get(HIRType::Kind::Pointer);
 
             // AsyncDisposableStack takes no arguments
             std::vector<HIRTypePtr> paramTypes = {};
@@ -1624,7 +1624,7 @@ void HIRGenerator::visit(NewExpr& node) {
         if (className == "FinalizationRegistry") {
             if (NOVA_DEBUG) std::cerr << "  DEBUG: Handling FinalizationRegistry constructor" << std::endl;
 
-            auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+            auto ptrType = HIRType::get(HIRType::Kind::Pointer);
 
             // FinalizationRegistry takes a callback function
             HIRValue* callbackArg = nullptr;
@@ -1660,8 +1660,8 @@ void HIRGenerator::visit(NewExpr& node) {
         if (className == "GeneratorFunction") {
             if (NOVA_DEBUG) std::cerr << "  DEBUG: Handling GeneratorFunction constructor" << std::endl;
 
-            auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-            auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+            auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+            auto intType = HIRType::get(HIRType::Kind::I64);
 
             // Last argument is the function body, all others are parameter names
             std::string body;
@@ -1672,13 +1672,13 @@ void HIRGenerator::visit(NewExpr& node) {
                 size_t bodyIndex = node.arguments.size() - 1;
 
                 // Get body string (must be a constant string for AOT)
-                if (auto* strLit = dynamic_cast<StringLiteral*>(node.arguments[bodyIndex].get())) {
+                if (auto* strLit = ast_cast<StringLiteral>(node.arguments[bodyIndex].get())) {
                     body = strLit->value;
                 }
 
                 // Get parameter names (all arguments except last)
                 for (size_t i = 0; i < bodyIndex; i++) {
-                    if (auto* paramLit = dynamic_cast<StringLiteral*>(node.arguments[i].get())) {
+                    if (auto* paramLit = ast_cast<StringLiteral>(node.arguments[i].get())) {
                         paramNames.push_back(paramLit->value);
                     }
                 }
@@ -1716,8 +1716,8 @@ void HIRGenerator::visit(NewExpr& node) {
         if (className == "AsyncGeneratorFunction") {
             if (NOVA_DEBUG) std::cerr << "  DEBUG: Handling AsyncGeneratorFunction constructor" << std::endl;
 
-            auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-            auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+            auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+            auto intType = HIRType::get(HIRType::Kind::I64);
 
             // Last argument is the function body, all others are parameter names
             std::string body;
@@ -1726,12 +1726,12 @@ void HIRGenerator::visit(NewExpr& node) {
             if (!node.arguments.empty()) {
                 size_t bodyIndex = node.arguments.size() - 1;
 
-                if (auto* strLit = dynamic_cast<StringLiteral*>(node.arguments[bodyIndex].get())) {
+                if (auto* strLit = ast_cast<StringLiteral>(node.arguments[bodyIndex].get())) {
                     body = strLit->value;
                 }
 
                 for (size_t i = 0; i < bodyIndex; i++) {
-                    if (auto* paramLit = dynamic_cast<StringLiteral*>(node.arguments[i].get())) {
+                    if (auto* paramLit = ast_cast<StringLiteral>(node.arguments[i].get())) {
                         paramNames.push_back(paramLit->value);
                     }
                 }
@@ -1767,7 +1767,7 @@ void HIRGenerator::visit(NewExpr& node) {
         if (className == "Promise") {
             if(NOVA_DEBUG) std::cerr << "  DEBUG: Handling Promise constructor" << std::endl;
 
-            auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+            auto ptrType = HIRType::get(HIRType::Kind::Pointer);
             HIRValue* executorValue = builder_->createNullConstant(ptrType.get());
             HIRValue* executorEnvironment =
                 builder_->createNullConstant(ptrType.get());
@@ -1780,7 +1780,7 @@ void HIRGenerator::visit(NewExpr& node) {
 
                 promiseExecutorResolveName_.clear();
                 promiseExecutorRejectName_.clear();
-                if (auto* arrow = dynamic_cast<ArrowFunctionExpr*>(
+                if (auto* arrow = ast_cast<ArrowFunctionExpr>(
                         node.arguments[0].get())) {
                     if (!arrow->params.empty()) {
                         promiseExecutorResolveName_ = arrow->params[0];
@@ -1788,7 +1788,7 @@ void HIRGenerator::visit(NewExpr& node) {
                     if (arrow->params.size() > 1) {
                         promiseExecutorRejectName_ = arrow->params[1];
                     }
-                } else if (auto* expression = dynamic_cast<FunctionExpr*>(
+                } else if (auto* expression = ast_cast<FunctionExpr>(
                                node.arguments[0].get())) {
                     if (!expression->params.empty()) {
                         promiseExecutorResolveName_ = expression->params[0];
@@ -1890,7 +1890,7 @@ void HIRGenerator::visit(NewExpr& node) {
             }
 
             // Create external function reference
-            auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+            auto ptrType = HIRType::get(HIRType::Kind::Pointer);
             std::vector<HIRTypePtr> paramTypes;
             paramTypes.push_back(ptrType);  // void* error
             paramTypes.push_back(ptrType);  // void* suppressed
@@ -1941,14 +1941,14 @@ void HIRGenerator::visit(NewExpr& node) {
             // value at HIR time so we can pass it to the constructor.
             if (node.arguments.size() > 1) {
                 if (auto* options =
-                        dynamic_cast<ObjectExpr*>(node.arguments[1].get())) {
+                        ast_cast<ObjectExpr>(node.arguments[1].get())) {
                     for (auto& property : options->properties) {
                         std::string key;
                         if (auto* identifier =
-                                dynamic_cast<Identifier*>(property.key.get())) {
+                                ast_cast<Identifier>(property.key.get())) {
                             key = identifier->name;
                         } else if (auto* literal =
-                                       dynamic_cast<StringLiteral*>(
+                                       ast_cast<StringLiteral>(
                                            property.key.get())) {
                             key = literal->value;
                         }
@@ -1980,11 +1980,11 @@ void HIRGenerator::visit(NewExpr& node) {
             }
 
             // Create external function reference
-            auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+            auto ptrType = HIRType::get(HIRType::Kind::Pointer);
             std::vector<HIRTypePtr> paramTypes;
             paramTypes.push_back(ptrType);  // const char* message
             if (causeArg) {
-                paramTypes.push_back(std::make_shared<HIRType>(
+                paramTypes.push_back(HIRType::get(
                     HIRType::Kind::JSValue));
             }
 
@@ -2041,7 +2041,7 @@ void HIRGenerator::visit(NewExpr& node) {
         for (size_t i = 0; i < node.arguments.size(); ++i) {
             const bool inlineProxyObject =
                 className == "Proxy" && i < 2 &&
-                dynamic_cast<ObjectExpr*>(node.arguments[i].get()) != nullptr;
+                ast_cast<ObjectExpr>(node.arguments[i].get()) != nullptr;
             const std::string savedDeclName = currentDeclName_;
             const std::string proxyLiteralName =
                 "__proxy_inline_object_" + std::to_string(i);
@@ -2066,7 +2066,7 @@ void HIRGenerator::visit(NewExpr& node) {
             std::string runtimeFuncName = builtinIt->second + "_new";
             if(NOVA_DEBUG) std::cerr << "  DEBUG: Handling builtin constructor: " << className << " -> " << runtimeFuncName << std::endl;
 
-            auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+            auto ptrType = HIRType::get(HIRType::Kind::Pointer);
             std::vector<HIRTypePtr> paramTypes;  // Most constructors take no args
             std::vector<HIRValue*> callArgs;
 
@@ -2152,9 +2152,9 @@ void HIRGenerator::visit(ThisExpr& node) {
         if (currentFunction_ &&
             currentFunction_->name == "main") {
             auto stringType =
-                std::make_shared<HIRType>(HIRType::Kind::String);
+                HIRType::get(HIRType::Kind::String);
             auto pointerType =
-                std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                HIRType::get(HIRType::Kind::Pointer);
             HIRFunction* global = nullptr;
             if (auto existing =
                     module_->getFunction("nova_intrinsic_object")) {
@@ -2267,8 +2267,8 @@ void HIRGenerator::visit(ClassDecl& node) {
                     "AggregateError"
                 };
                 if (builtinErrors.count(node.superclass)) {
-                    auto strType = std::make_shared<hir::HIRType>(hir::HIRType::Kind::String);
-                    auto ptrType = std::make_shared<hir::HIRType>(hir::HIRType::Kind::Pointer);
+                    auto strType = hir::HIRType::get(hir::HIRType::Kind::String);
+                    auto ptrType = hir::HIRType::get(hir::HIRType::Kind::Pointer);
                     if (!fieldNames.count("message")) {
                         fields.push_back({"message", strType, true});
                         fieldNames.insert("message");
@@ -2300,7 +2300,7 @@ void HIRGenerator::visit(ClassDecl& node) {
                 // Evaluate initializer if present
                 int64_t initValue = 0;
                 if (prop.initializer) {
-                    if (auto* numLit = dynamic_cast<NumberLiteral*>(prop.initializer.get())) {
+                    if (auto* numLit = ast_cast<NumberLiteral>(prop.initializer.get())) {
                         initValue = static_cast<int64_t>(numLit->value);
                     }
                 }
@@ -2321,7 +2321,7 @@ void HIRGenerator::visit(ClassDecl& node) {
                 if (prop.type) {
                     typeKind = convertTypeKind(prop.type->kind);
                 }
-                auto fieldType = std::make_shared<hir::HIRType>(typeKind);
+                auto fieldType = hir::HIRType::get(typeKind);
                 fields.push_back({prop.name, fieldType, true});
                 fieldNames.insert(prop.name);
                 if (NOVA_DEBUG) std::cerr << "  DEBUG: Added field: " << prop.name << std::endl;
@@ -2331,18 +2331,18 @@ void HIRGenerator::visit(ClassDecl& node) {
         // Also scan constructor for this.property assignments to auto-add fields
         for (auto& method : node.methods) {
             if (method.kind == ClassDecl::Method::Kind::Constructor && method.body) {
-                BlockStmt* bodyBlock = dynamic_cast<BlockStmt*>(method.body.get());
+                BlockStmt* bodyBlock = ast_cast<BlockStmt>(method.body.get());
                 if (bodyBlock) {
                     for (auto& stmt : bodyBlock->statements) {
-                        ExprStmt* exprStmt = dynamic_cast<ExprStmt*>(stmt.get());
+                        ExprStmt* exprStmt = ast_cast<ExprStmt>(stmt.get());
                         if (exprStmt) {
-                            AssignmentExpr* assignExpr = dynamic_cast<AssignmentExpr*>(exprStmt->expression.get());
+                            AssignmentExpr* assignExpr = ast_cast<AssignmentExpr>(exprStmt->expression.get());
                             if (assignExpr) {
-                                MemberExpr* memberExpr = dynamic_cast<MemberExpr*>(assignExpr->left.get());
+                                MemberExpr* memberExpr = ast_cast<MemberExpr>(assignExpr->left.get());
                                 if (memberExpr) {
-                                    ThisExpr* thisExpr = dynamic_cast<ThisExpr*>(memberExpr->object.get());
+                                    ThisExpr* thisExpr = ast_cast<ThisExpr>(memberExpr->object.get());
                                     if (thisExpr) {
-                                        Identifier* propIdent = dynamic_cast<Identifier*>(memberExpr->property.get());
+                                        Identifier* propIdent = ast_cast<Identifier>(memberExpr->property.get());
                                         if (propIdent) {
                                             std::string propName = propIdent->name;
                                             if (fieldNames.find(propName) == fieldNames.end()) {
@@ -2350,19 +2350,19 @@ void HIRGenerator::visit(ClassDecl& node) {
                                                 hir::HIRType::Kind typeKind = hir::HIRType::Kind::I64; // default
 
                                                 // Check what's being assigned
-                                                if (auto* stringLit = dynamic_cast<StringLiteral*>(assignExpr->right.get())) {
+                                                if (ast_isa<StringLiteral>(assignExpr->right.get())) {
                                                     typeKind = hir::HIRType::Kind::String;
                                                     if (NOVA_DEBUG) std::cerr << "  DEBUG: Field '" << propName << "' inferred as String from string literal" << std::endl;
-                                                } else if (auto* numLit = dynamic_cast<NumberLiteral*>(assignExpr->right.get())) {
+                                                } else if (ast_isa<NumberLiteral>(assignExpr->right.get())) {
                                                     typeKind = hir::HIRType::Kind::I64;
-                                                } else if (auto* ident = dynamic_cast<Identifier*>(assignExpr->right.get())) {
+                                                } else if (auto* ident = ast_cast<Identifier>(assignExpr->right.get())) {
                                                     // Constructor parameter - use Any for dynamic typing
                                                     // Any type can hold numbers, strings, objects, etc.
                                                     typeKind = hir::HIRType::Kind::Any;
                                                     if (NOVA_DEBUG) std::cerr << "  DEBUG: Field '" << propName << "' inferred as Any from parameter '" << ident->name << "'" << std::endl;
                                                 }
 
-                                                auto fieldType = std::make_shared<hir::HIRType>(typeKind);
+                                                auto fieldType = hir::HIRType::get(typeKind);
                                                 fields.push_back({propName, fieldType, true});
                                                 fieldNames.insert(propName);
                                                 if (NOVA_DEBUG) std::cerr << "  DEBUG: Auto-added field '" << propName << "' from constructor" << std::endl;
@@ -2426,39 +2426,39 @@ void HIRGenerator::visit(ClassDecl& node) {
                     !declaration->second || !declaration->second->body) {
                     continue;
                 }
-                auto* decoratorBody = dynamic_cast<BlockStmt*>(
+                auto* decoratorBody = ast_cast<BlockStmt>(
                     declaration->second->body.get());
                 if (!decoratorBody) continue;
                 for (const auto& statement : decoratorBody->statements) {
                     auto* expressionStatement =
-                        dynamic_cast<ExprStmt*>(statement.get());
+                        ast_cast<ExprStmt>(statement.get());
                     auto* assignment = expressionStatement
-                        ? dynamic_cast<AssignmentExpr*>(
+                        ? ast_cast<AssignmentExpr>(
                               expressionStatement->expression.get())
                         : nullptr;
                     auto* wrapper = assignment
-                        ? dynamic_cast<FunctionExpr*>(
+                        ? ast_cast<FunctionExpr>(
                               assignment->right.get())
                         : nullptr;
                     auto* wrapperBody = wrapper
-                        ? dynamic_cast<BlockStmt*>(wrapper->body.get())
+                        ? ast_cast<BlockStmt>(wrapper->body.get())
                         : nullptr;
                     if (!wrapperBody) continue;
                     for (const auto& wrapperStatement :
                          wrapperBody->statements) {
                         auto* returnStatement =
-                            dynamic_cast<ReturnStmt*>(
+                            ast_cast<ReturnStmt>(
                                 wrapperStatement.get());
                         auto* binary = returnStatement &&
                                 returnStatement->argument
-                            ? dynamic_cast<BinaryExpr*>(
+                            ? ast_cast<BinaryExpr>(
                                   returnStatement->argument.get())
                             : nullptr;
                         if (!binary ||
                             binary->op != BinaryExpr::Op::Mul) {
                             continue;
                         }
-                        auto* factor = dynamic_cast<NumberLiteral*>(
+                        auto* factor = ast_cast<NumberLiteral>(
                             binary->right.get());
                         if (!factor) continue;
                         legacyDecoratedMethodResultMultipliers_[
@@ -2502,11 +2502,11 @@ void HIRGenerator::generateConstructorFunction(const std::string& className,
         // Use Any type to accept both strings and numbers (JavaScript is dynamically typed)
         std::vector<hir::HIRTypePtr> paramTypes;
         for (size_t i = 0; i < constructor.params.size(); ++i) {
-            paramTypes.push_back(std::make_shared<hir::HIRType>(hir::HIRType::Kind::Any));
+            paramTypes.push_back(hir::HIRType::get(hir::HIRType::Kind::Any));
         }
 
         // Return type is pointer to struct (use Any for now)
-        auto returnType = std::make_shared<hir::HIRType>(hir::HIRType::Kind::Any);
+        auto returnType = hir::HIRType::get(hir::HIRType::Kind::Any);
 
         // Create function type
         auto funcType = new HIRFunctionType(paramTypes, returnType);
@@ -2538,12 +2538,12 @@ void HIRGenerator::generateConstructorFunction(const std::string& className,
         // Check if constructor starts with super() call
         bool hasSuperCall = false;
         if (constructor.body) {
-            BlockStmt* bodyBlock = dynamic_cast<BlockStmt*>(constructor.body.get());
+            BlockStmt* bodyBlock = ast_cast<BlockStmt>(constructor.body.get());
             if (bodyBlock && !bodyBlock->statements.empty()) {
-                ExprStmt* firstStmt = dynamic_cast<ExprStmt*>(bodyBlock->statements[0].get());
+                ExprStmt* firstStmt = ast_cast<ExprStmt>(bodyBlock->statements[0].get());
                 if (firstStmt) {
-                    CallExpr* callExpr = dynamic_cast<CallExpr*>(firstStmt->expression.get());
-                    if (callExpr && dynamic_cast<SuperExpr*>(callExpr->callee.get())) {
+                    CallExpr* callExpr = ast_cast<CallExpr>(firstStmt->expression.get());
+                    if (callExpr && ast_cast<SuperExpr>(callExpr->callee.get())) {
                         hasSuperCall = true;
                         std::cerr << "    DEBUG: Constructor has super() call - will use parent's instance" << std::endl;
                     }
@@ -2574,8 +2574,8 @@ void HIRGenerator::generateConstructorFunction(const std::string& className,
                 // Create malloc: void* malloc(size_t size)
                 // HIR signature: pointer malloc(i64 size)
                 std::vector<HIRTypePtr> mallocParamTypes;
-                mallocParamTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));
-                auto mallocReturnType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                mallocParamTypes.push_back(HIRType::get(HIRType::Kind::I64));
+                auto mallocReturnType = HIRType::get(HIRType::Kind::Pointer);
                 HIRFunctionType* mallocFuncType = new HIRFunctionType(mallocParamTypes, mallocReturnType);
                 HIRFunctionPtr mallocFuncPtr = module_->createFunction("malloc", mallocFuncType);
                 mallocFuncPtr->linkage = HIRFunction::Linkage::External;
@@ -2680,35 +2680,35 @@ void HIRGenerator::generateConstructorFunction(const std::string& className,
         // NEW: Store field initial values for this class (for future child classes)
         // Scan constructor body for this.field = literal assignments
         if (constructor.body) {
-            BlockStmt* bodyBlock = dynamic_cast<BlockStmt*>(constructor.body.get());
+            BlockStmt* bodyBlock = ast_cast<BlockStmt>(constructor.body.get());
             if (bodyBlock) {
                 std::unordered_map<std::string, FieldInitValue> fieldValues;
 
                 for (auto& stmt : bodyBlock->statements) {
-                    ExprStmt* exprStmt = dynamic_cast<ExprStmt*>(stmt.get());
+                    ExprStmt* exprStmt = ast_cast<ExprStmt>(stmt.get());
                     if (!exprStmt) continue;
 
-                    AssignmentExpr* assignExpr = dynamic_cast<AssignmentExpr*>(exprStmt->expression.get());
+                    AssignmentExpr* assignExpr = ast_cast<AssignmentExpr>(exprStmt->expression.get());
                     if (!assignExpr) continue;
 
-                    MemberExpr* memberExpr = dynamic_cast<MemberExpr*>(assignExpr->left.get());
+                    MemberExpr* memberExpr = ast_cast<MemberExpr>(assignExpr->left.get());
                     if (!memberExpr) continue;
 
-                    ThisExpr* thisExpr = dynamic_cast<ThisExpr*>(memberExpr->object.get());
+                    ThisExpr* thisExpr = ast_cast<ThisExpr>(memberExpr->object.get());
                     if (!thisExpr) continue;
 
-                    Identifier* propIdent = dynamic_cast<Identifier*>(memberExpr->property.get());
+                    Identifier* propIdent = ast_cast<Identifier>(memberExpr->property.get());
                     if (!propIdent) continue;
 
                     // Check if right side is a literal (string or number)
-                    if (StringLiteral* strLit = dynamic_cast<StringLiteral*>(assignExpr->right.get())) {
+                    if (StringLiteral* strLit = ast_cast<StringLiteral>(assignExpr->right.get())) {
                         FieldInitValue initVal;
                         initVal.kind = FieldInitValue::Kind::String;
                         initVal.stringValue = strLit->value;
                         fieldValues[propIdent->name] = initVal;
                         std::cerr << "      DEBUG: Stored string literal for field '"
                                  << propIdent->name << "'" << std::endl;
-                    } else if (NumberLiteral* numLit = dynamic_cast<NumberLiteral*>(assignExpr->right.get())) {
+                    } else if (NumberLiteral* numLit = ast_cast<NumberLiteral>(assignExpr->right.get())) {
                         FieldInitValue initVal;
                         initVal.kind = FieldInitValue::Kind::Number;
                         initVal.numberValue = numLit->value;
@@ -2777,7 +2777,7 @@ void HIRGenerator::generateDefaultConstructor(const std::string& className,
         }
 
         // Return type is pointer to struct (use Any for now)
-        auto returnType = std::make_shared<hir::HIRType>(hir::HIRType::Kind::Any);
+        auto returnType = hir::HIRType::get(hir::HIRType::Kind::Any);
 
         // Create function type
         auto funcType = new HIRFunctionType(paramTypes, returnType);
@@ -2815,8 +2815,8 @@ void HIRGenerator::generateDefaultConstructor(const std::string& className,
 
         if (!mallocFunc) {
             std::vector<HIRTypePtr> mallocParamTypes;
-            mallocParamTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));
-            auto mallocReturnType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+            mallocParamTypes.push_back(HIRType::get(HIRType::Kind::I64));
+            auto mallocReturnType = HIRType::get(HIRType::Kind::Pointer);
             HIRFunctionType* mallocFuncType = new HIRFunctionType(mallocParamTypes, mallocReturnType);
             HIRFunctionPtr mallocFuncPtr = module_->createFunction("malloc", mallocFuncType);
             mallocFuncPtr->linkage = HIRFunction::Linkage::External;
@@ -2870,17 +2870,17 @@ void HIRGenerator::generateMethodFunction(const std::string& className,
         std::vector<hir::HIRTypePtr> paramTypes;
         // First parameter is 'this' (pointer to struct) - use proper struct type
         paramTypes.push_back(std::make_shared<hir::HIRPointerType>(
-            std::shared_ptr<hir::HIRStructType>(structType, [](hir::HIRStructType*){}), true));
+            hir::unownedRef<hir::HIRStructType>(structType), true));
 
         // Add method parameters (use Any for dynamic typing)
         for (size_t i = 0; i < method.params.size(); ++i) {
-            paramTypes.push_back(std::make_shared<hir::HIRType>(hir::HIRType::Kind::Any));
+            paramTypes.push_back(hir::HIRType::get(hir::HIRType::Kind::Any));
         }
 
         // Return type - infer from return statements if not explicitly typed
         hir::HIRTypePtr returnType;
         if (method.returnType) {
-            returnType = std::make_shared<hir::HIRType>(convertTypeKind(method.returnType->kind));
+            returnType = hir::HIRType::get(convertTypeKind(method.returnType->kind));
         } else {
             // Infer return type by scanning method body for return statements
             // Use Any as default for dynamic typing (JavaScript is dynamically typed)
@@ -2888,15 +2888,15 @@ void HIRGenerator::generateMethodFunction(const std::string& className,
 
             if (method.body) {
                 // Simple heuristic: check if body is a block with a return statement
-                if (auto* block = dynamic_cast<BlockStmt*>(method.body.get())) {
+                if (auto* block = ast_cast<BlockStmt>(method.body.get())) {
                     for (auto& stmt : block->statements) {
-                        if (auto* retStmt = dynamic_cast<ReturnStmt*>(stmt.get())) {
+                        if (auto* retStmt = ast_cast<ReturnStmt>(stmt.get())) {
                             if (retStmt->argument) {
                                 // Check type of returned expression
-                                if (dynamic_cast<StringLiteral*>(retStmt->argument.get())) {
+                                if (ast_cast<StringLiteral>(retStmt->argument.get())) {
                                     inferredType = hir::HIRType::Kind::String;
                                     std::cerr << "    DEBUG: Inferred method return type as String from return statement" << std::endl;
-                                } else if (dynamic_cast<NumberLiteral*>(retStmt->argument.get())) {
+                                } else if (ast_cast<NumberLiteral>(retStmt->argument.get())) {
                                     inferredType = hir::HIRType::Kind::I64;
                                 }
                             }
@@ -2906,7 +2906,7 @@ void HIRGenerator::generateMethodFunction(const std::string& className,
                 }
             }
 
-            returnType = std::make_shared<hir::HIRType>(inferredType);
+            returnType = hir::HIRType::get(inferredType);
         }
 
         // Create function type
@@ -2997,15 +2997,15 @@ void HIRGenerator::generateStaticMethodFunction(const std::string& className,
         // Parameter types: NO 'this' pointer for static methods
         std::vector<hir::HIRTypePtr> paramTypes;
         for (size_t i = 0; i < method.params.size(); ++i) {
-            paramTypes.push_back(std::make_shared<hir::HIRType>(hir::HIRType::Kind::I64));
+            paramTypes.push_back(hir::HIRType::get(hir::HIRType::Kind::I64));
         }
 
         // Return type
         hir::HIRTypePtr returnType;
         if (method.returnType) {
-            returnType = std::make_shared<hir::HIRType>(convertTypeKind(method.returnType->kind));
+            returnType = hir::HIRType::get(convertTypeKind(method.returnType->kind));
         } else {
-            returnType = std::make_shared<hir::HIRType>(hir::HIRType::Kind::I64);
+            returnType = hir::HIRType::get(hir::HIRType::Kind::I64);
         }
 
         // Create function type
@@ -3061,14 +3061,14 @@ void HIRGenerator::generateGetterFunction(const std::string& className,
 
         // Parameter types: only 'this' pointer
         std::vector<hir::HIRTypePtr> paramTypes;
-        paramTypes.push_back(std::make_shared<hir::HIRType>(hir::HIRType::Kind::Any));
+        paramTypes.push_back(hir::HIRType::get(hir::HIRType::Kind::Any));
 
         // Return type
         hir::HIRTypePtr returnType;
         if (method.returnType) {
-            returnType = std::make_shared<hir::HIRType>(convertTypeKind(method.returnType->kind));
+            returnType = hir::HIRType::get(convertTypeKind(method.returnType->kind));
         } else {
-            returnType = std::make_shared<hir::HIRType>(hir::HIRType::Kind::I64);
+            returnType = hir::HIRType::get(hir::HIRType::Kind::I64);
         }
 
         // Create function type
@@ -3130,14 +3130,14 @@ void HIRGenerator::generateSetterFunction(const std::string& className,
 
         // Parameter types: 'this' pointer + value parameter
         std::vector<hir::HIRTypePtr> paramTypes;
-        paramTypes.push_back(std::make_shared<hir::HIRType>(hir::HIRType::Kind::Any));
+        paramTypes.push_back(hir::HIRType::get(hir::HIRType::Kind::Any));
         // Add parameter for the value
         if (method.params.size() > 0) {
-            paramTypes.push_back(std::make_shared<hir::HIRType>(hir::HIRType::Kind::I64));
+            paramTypes.push_back(hir::HIRType::get(hir::HIRType::Kind::I64));
         }
 
         // Setters return void
-        auto returnType = std::make_shared<hir::HIRType>(hir::HIRType::Kind::Void);
+        auto returnType = hir::HIRType::get(hir::HIRType::Kind::Void);
 
         // Create function type
         auto funcType = new HIRFunctionType(paramTypes, returnType);
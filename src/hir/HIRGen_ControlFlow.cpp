@@ -192,9 +192,9 @@ void HIRGenerator::visit(ForStmt& node) {
         builder_->setInsertPoint(initBlock);
         if(NOVA_DEBUG) std::cerr << "DEBUG: Executing for init" << std::endl;
         if (node.init) {
-            if (auto* varDeclStmt = dynamic_cast<VarDeclStmt*>(node.init.get())) {
+            if (auto* varDeclStmt = ast_cast<VarDeclStmt>(node.init.get())) {
                 varDeclStmt->accept(*this);
-            } else if (auto* exprStmt = dynamic_cast<ExprStmt*>(node.init.get())) {
+            } else if (auto* exprStmt = ast_cast<ExprStmt>(node.init.get())) {
                 exprStmt->accept(*this);
             } else {
                 // For expression initializers, wrap in an expression statement
@@ -202,6 +202,16 @@ void HIRGenerator::visit(ForStmt& node) {
             }
         }
         if(NOVA_DEBUG) std::cerr << "DEBUG: For init executed" << std::endl;
+        // `for (let i = 0; i < a.length; i++)` over an array the body cannot
+        // modify: read the length once here so the loop needs no per-access
+        // bounds checks (see passes/BoundsCheckElimination.cpp).
+        std::string canonicalArray;
+        std::string canonicalIndex;
+        const bool canonicalArrayLoop =
+            matchCanonicalArrayLoop(node, canonicalArray, canonicalIndex);
+        if (canonicalArrayLoop) {
+            beginCanonicalArrayLoop(canonicalArray, canonicalIndex);
+        }
         // Branch to condition
         builder_->createBr(condBlock);
         
@@ -250,6 +260,9 @@ void HIRGenerator::visit(ForStmt& node) {
         
         // End block
         builder_->setInsertPoint(endBlock);
+        if (canonicalArrayLoop) {
+            endCanonicalArrayLoop();
+        }
 
         // Pop break and continue targets from stacks
         breakTargetStack_.pop_back();
@@ -265,7 +278,7 @@ void HIRGenerator::visit(ForInStmt& node) {
 
         // Check if the iterable is a variable with compile-time known field names
         std::string iterableName;
-        if (auto* identNode = dynamic_cast<Identifier*>(node.right.get())) {
+        if (auto* identNode = ast_cast<Identifier>(node.right.get())) {
             iterableName = identNode->name;
         }
 
@@ -318,7 +331,7 @@ void HIRGenerator::visit(ForInStmt& node) {
             // runtime Object representation consumed by nova_object_keys.
             // A fixed-layout __obj_N pointer is not ABI-compatible and would
             // be interpreted as PropertyStorage, causing an access violation.
-            if (dynamic_cast<ObjectExpr*>(node.right.get())) {
+            if (ast_cast<ObjectExpr>(node.right.get())) {
                 const std::string savedDeclName = currentDeclName_;
                 const std::string sentinel = "__forin_runtime_object";
                 const bool wasForced =
@@ -335,8 +348,8 @@ void HIRGenerator::visit(ForInStmt& node) {
             }
             auto* objectValue = lastValue_;
 
-            auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-            auto i64Type = std::make_shared<HIRType>(HIRType::Kind::I64);
+            auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+            auto i64Type = HIRType::get(HIRType::Kind::I64);
 
             // Get or create nova_object_keys function
             std::vector<HIRTypePtr> keysParamTypes = {ptrType};
@@ -440,7 +453,7 @@ void HIRGenerator::visit(ForOfStmt& node) {
         bool isGeneratorIteration = false;
         bool isAsyncGeneratorIteration = false;
         bool isDynamicProtocolIteration = false;
-        if (auto* identExpr = dynamic_cast<Identifier*>(node.right.get())) {
+        if (auto* identExpr = ast_cast<Identifier>(node.right.get())) {
             if (asyncGeneratorVars_.count(identExpr->name) > 0) {
                 isAsyncGeneratorIteration = true;
                 isGeneratorIteration = true;  // Async generators are also generators
@@ -453,11 +466,11 @@ void HIRGenerator::visit(ForOfStmt& node) {
                        taggedRuntimeArrayVars_.count(identExpr->name) == 0) {
                 isDynamicProtocolIteration = true;
             }
-        } else if (auto* callExpr = dynamic_cast<CallExpr*>(node.right.get())) {
+        } else if (auto* callExpr = ast_cast<CallExpr>(node.right.get())) {
             // A very common form is `for (const value of generator())`.
             // Do not rely on the result having first been assigned to a
             // variable: recognize the generator function at the call site.
-            if (auto* callee = dynamic_cast<Identifier*>(callExpr->callee.get())) {
+            if (auto* callee = ast_cast<Identifier>(callExpr->callee.get())) {
                 if (asyncGeneratorFuncs_.count(callee->name) > 0) {
                     isAsyncGeneratorIteration = true;
                     isGeneratorIteration = true;
@@ -499,10 +512,10 @@ void HIRGenerator::visit(ForOfStmt& node) {
             auto* genValue = lastValue_;
 
             // Create result variable to hold IteratorResult
-            auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-            auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+            auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+            auto intType = HIRType::get(HIRType::Kind::I64);
             auto jsValueType =
-                std::make_shared<HIRType>(HIRType::Kind::JSValue);
+                HIRType::get(HIRType::Kind::JSValue);
             if (isDynamicProtocolIteration) {
                 auto existingCreate =
                     module_->getFunction("nova_dynamic_iterator_create");
@@ -572,7 +585,7 @@ void HIRGenerator::visit(ForOfStmt& node) {
                 doneFunc = existingDoneFunc.get();
             } else {
                 std::vector<HIRTypePtr> paramTypes = {ptrType};
-                auto boolType = std::make_shared<HIRType>(HIRType::Kind::Bool);
+                auto boolType = HIRType::get(HIRType::Kind::Bool);
                 HIRFunctionType* funcType = new HIRFunctionType(paramTypes, boolType);
                 HIRFunctionPtr funcPtr = module_->createFunction(doneFuncName, funcType);
                 funcPtr->linkage = HIRFunction::Linkage::External;
@@ -705,7 +718,7 @@ void HIRGenerator::visit(ForOfStmt& node) {
         bool isSetIterable = false;
         std::string iterableElementType;
         if (auto* iterableIdentifier =
-                dynamic_cast<Identifier*>(node.right.get())) {
+                ast_cast<Identifier>(node.right.get())) {
             isSetIterable =
                 setVars_.count(iterableIdentifier->name) > 0;
             auto elementType =
@@ -714,13 +727,13 @@ void HIRGenerator::visit(ForOfStmt& node) {
                 iterableElementType = elementType->second;
             }
         } else if (auto* iterableCall =
-                       dynamic_cast<CallExpr*>(node.right.get())) {
+                       ast_cast<CallExpr>(node.right.get())) {
             if (auto* member =
-                    dynamic_cast<MemberExpr*>(iterableCall->callee.get())) {
+                    ast_cast<MemberExpr>(iterableCall->callee.get())) {
                 auto* receiver =
-                    dynamic_cast<Identifier*>(member->object.get());
+                    ast_cast<Identifier>(member->object.get());
                 auto* method =
-                    dynamic_cast<Identifier*>(member->property.get());
+                    ast_cast<Identifier>(member->property.get());
                 if (receiver && method &&
                     mapVars_.count(receiver->name) > 0) {
                     const auto& elementTypes = method->name == "keys"
@@ -745,7 +758,7 @@ void HIRGenerator::visit(ForOfStmt& node) {
         // before using the indexed for-of lowering.
         if (isSetIterable) {
             auto pointerType =
-                std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                HIRType::get(HIRType::Kind::Pointer);
             auto existing = module_->getFunction("nova_set_values");
             HIRFunction* valuesFunction =
                 existing ? existing.get() : nullptr;
@@ -772,9 +785,9 @@ void HIRGenerator::visit(ForOfStmt& node) {
             // tagged JSValue objects. Runtime array helpers require the
             // decoded metadata pointer, never the tagged integer bits.
             auto jsValueType =
-                std::make_shared<HIRType>(HIRType::Kind::JSValue);
+                HIRType::get(HIRType::Kind::JSValue);
             auto pointerType =
-                std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                HIRType::get(HIRType::Kind::Pointer);
             auto existing = module_->getFunction("nova_value_to_object");
             HIRFunction* toObject = existing ? existing.get() : nullptr;
             if (!toObject) {
@@ -808,7 +821,7 @@ void HIRGenerator::visit(ForOfStmt& node) {
 
         // Check if iterating over a runtime array
         bool isRuntimeArrayForLength = expressionRuntimeArray;
-        if (auto* identExpr = dynamic_cast<Identifier*>(node.right.get())) {
+        if (auto* identExpr = ast_cast<Identifier>(node.right.get())) {
             if (runtimeArrayVars_.count(identExpr->name) > 0) {
                 isRuntimeArrayForLength = true;
             }
@@ -818,9 +831,9 @@ void HIRGenerator::visit(ForOfStmt& node) {
         HIRValue* arrayLength = nullptr;
         if (isStringIterable) {
             auto stringType =
-                std::make_shared<HIRType>(HIRType::Kind::String);
+                HIRType::get(HIRType::Kind::String);
             auto intType =
-                std::make_shared<HIRType>(HIRType::Kind::I64);
+                HIRType::get(HIRType::Kind::I64);
             auto existing = module_->getFunction("strlen");
             HIRFunction* function = existing ? existing.get() : nullptr;
             if (!function) {
@@ -837,8 +850,8 @@ void HIRGenerator::visit(ForOfStmt& node) {
         } else if (isRuntimeArrayForLength) {
             if(NOVA_DEBUG) std::cerr << "DEBUG: ForOf - using runtime array length function" << std::endl;
             // Use nova_value_array_length for runtime arrays
-            auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-            auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+            auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+            auto intType = HIRType::get(HIRType::Kind::I64);
 
             std::string runtimeFunc = "nova_value_array_length";
             auto existingFunc = module_->getFunction(runtimeFunc);
@@ -889,7 +902,7 @@ void HIRGenerator::visit(ForOfStmt& node) {
         bool isRuntimeArray = expressionRuntimeArray;
         bool isTaggedRuntimeArray =
             expressionTaggedRuntimeArray;
-        if (auto* identExpr = dynamic_cast<Identifier*>(node.right.get())) {
+        if (auto* identExpr = ast_cast<Identifier>(node.right.get())) {
             if (runtimeArrayVars_.count(identExpr->name) > 0) {
                 isRuntimeArray = true;
                 isTaggedRuntimeArray =
@@ -900,9 +913,9 @@ void HIRGenerator::visit(ForOfStmt& node) {
 
         if (isStringIterable) {
             auto stringType =
-                std::make_shared<HIRType>(HIRType::Kind::String);
+                HIRType::get(HIRType::Kind::String);
             auto intType =
-                std::make_shared<HIRType>(HIRType::Kind::I64);
+                HIRType::get(HIRType::Kind::I64);
             auto existing = module_->getFunction("nova_string_at");
             HIRFunction* function = existing ? existing.get() : nullptr;
             if (!function) {
@@ -918,8 +931,8 @@ void HIRGenerator::visit(ForOfStmt& node) {
             currentElement->type = stringType;
         } else if (isRuntimeArray) {
             // Use nova_value_array_at for runtime arrays
-            auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-            auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+            auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+            auto intType = HIRType::get(HIRType::Kind::I64);
 
             std::string runtimeFunc = "nova_value_array_at";
             auto existingFunc = module_->getFunction(runtimeFunc);
@@ -937,14 +950,14 @@ void HIRGenerator::visit(ForOfStmt& node) {
             std::vector<HIRValue*> args = {arrayValue, indexForAccess};
             currentElement = builder_->createCall(func, args, "iter_elem");
             currentElement->type = isTaggedRuntimeArray
-                ? std::make_shared<HIRType>(HIRType::Kind::JSValue)
+                ? HIRType::get(HIRType::Kind::JSValue)
                 : intType;
             if (isTaggedRuntimeArray && !iterableElementType.empty()) {
                 auto jsType =
-                    std::make_shared<HIRType>(HIRType::Kind::JSValue);
+                    HIRType::get(HIRType::Kind::JSValue);
                 if (iterableElementType == "String") {
                     auto stringType =
-                        std::make_shared<HIRType>(HIRType::Kind::String);
+                        HIRType::get(HIRType::Kind::String);
                     auto existing =
                         module_->getFunction("nova_value_to_string_alloc");
                     HIRFunction* function =
@@ -980,7 +993,7 @@ void HIRGenerator::visit(ForOfStmt& node) {
                     currentElement->type = intType;
                 } else {
                     auto doubleType =
-                        std::make_shared<HIRType>(HIRType::Kind::F64);
+                        HIRType::get(HIRType::Kind::F64);
                     auto existing =
                         module_->getFunction("nova_value_to_number");
                     HIRFunction* function =
@@ -1004,7 +1017,7 @@ void HIRGenerator::visit(ForOfStmt& node) {
             } else if (!isTaggedRuntimeArray &&
                        iterableElementType == "String") {
                 currentElement->type =
-                    std::make_shared<HIRType>(HIRType::Kind::String);
+                    HIRType::get(HIRType::Kind::String);
             }
         } else {
             // Use GetElement for regular arrays
@@ -1081,9 +1094,9 @@ void HIRGenerator::visit(ReturnStmt& node) {
             }
 
             // Get types
-            auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-            auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
-            auto voidType = std::make_shared<HIRType>(HIRType::Kind::Void);
+            auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+            auto intType = HIRType::get(HIRType::Kind::I64);
+            auto voidType = HIRType::get(HIRType::Kind::Void);
 
             // Get or create nova_generator_complete function
             std::string completeFuncName = "nova_generator_complete";
@@ -1134,8 +1147,8 @@ void HIRGenerator::visit(ReturnStmt& node) {
                 // later call sites (which may be generated before MIR) can
                 // invoke the returned closure with its environment.
                 if (currentFunction_) {
-                    if (auto* call = dynamic_cast<CallExpr*>(node.argument.get())) {
-                        if (auto* callee = dynamic_cast<Identifier*>(call->callee.get())) {
+                    if (auto* call = ast_cast<CallExpr>(node.argument.get())) {
+                        if (auto* callee = ast_cast<Identifier>(call->callee.get())) {
                             auto returnedClosure =
                                 module_->closureReturnedBy.find(callee->name);
                             if (returnedClosure !=
@@ -1161,9 +1174,9 @@ void HIRGenerator::visit(ReturnStmt& node) {
                 if (returnsString && returnValue && returnValue->type &&
                     returnValue->type->kind == HIRType::Kind::JSValue) {
                     auto jsValueType =
-                        std::make_shared<HIRType>(HIRType::Kind::JSValue);
+                        HIRType::get(HIRType::Kind::JSValue);
                     auto stringType =
-                        std::make_shared<HIRType>(HIRType::Kind::String);
+                        HIRType::get(HIRType::Kind::String);
                     auto existing =
                         module_->getFunction("nova_value_to_string_ptr");
                     HIRFunction* function = existing ? existing.get() : nullptr;
@@ -1274,15 +1287,15 @@ void HIRGenerator::visit(ThrowStmt& node) {
         // runtime (the static instanceof resolver cannot see catch params,
         // which carry no class kind info).
         std::string thrownClassName;
-        NewExpr* asNew = dynamic_cast<NewExpr*>(node.argument.get());
+        NewExpr* asNew = ast_cast<NewExpr>(node.argument.get());
         if (asNew) {
-            if (auto* id = dynamic_cast<Identifier*>(asNew->callee.get())) {
+            if (auto* id = ast_cast<Identifier>(asNew->callee.get())) {
                 thrownClassName = id->name;
             }
         }
         // Also handle `throw identifier` where identifier is a known class instance
         if (thrownClassName.empty()) {
-            if (auto* id = dynamic_cast<Identifier*>(node.argument.get())) {
+            if (auto* id = ast_cast<Identifier>(node.argument.get())) {
                 auto kindIt = variableKinds_.find(id->name);
                 if (kindIt != variableKinds_.end()) {
                     thrownClassName = kindIt->second;
@@ -1306,8 +1319,8 @@ void HIRGenerator::visit(ThrowStmt& node) {
             std::string setFuncName = "nova_set_thrown_class_name";
             HIRFunction* setFunc = module_->getFunction(setFuncName).get();
             if (!setFunc) {
-                auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                auto voidType = std::make_shared<HIRType>(HIRType::Kind::Void);
+                auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                auto voidType = HIRType::get(HIRType::Kind::Void);
                 HIRFunctionType* ft = new HIRFunctionType({ptrType}, voidType);
                 auto fp = module_->createFunction(setFuncName, ft);
                 fp->linkage = HIRFunction::Linkage::External;
@@ -1322,8 +1335,8 @@ void HIRGenerator::visit(ThrowStmt& node) {
         // Setup function signature for nova_throw(int64_t)
         std::string runtimeFuncName = "nova_throw";
         std::vector<HIRTypePtr> paramTypes;
-        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));
-        auto returnType = std::make_shared<HIRType>(HIRType::Kind::Void);
+        paramTypes.push_back(HIRType::get(HIRType::Kind::I64));
+        auto returnType = HIRType::get(HIRType::Kind::Void);
 
         // Find or create runtime function
         HIRFunction* runtimeFunc = nullptr;
@@ -1358,7 +1371,7 @@ bool HIRGenerator::pollExceptionAfterCall() {
         if (!currentCatchBlock_ || !currentFunction_) return true;
 
         // Get or create declaration for nova_exception_pending().
-        auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+        auto intType = HIRType::get(HIRType::Kind::I64);
         HIRFunction* pollFunc = nullptr;
         const std::string runtimeName = "nova_exception_pending";
         if (auto existing = module_->getFunction(runtimeName)) {
@@ -1407,7 +1420,7 @@ void HIRGenerator::visit(TryStmt& node) {
             }
             if (!runtimeFunc) {
                 std::vector<HIRTypePtr> paramTypes;
-                auto returnType = std::make_shared<HIRType>(HIRType::Kind::Void);
+                auto returnType = HIRType::get(HIRType::Kind::Void);
                 HIRFunctionType* funcType = new HIRFunctionType(paramTypes, returnType);
                 HIRFunctionPtr funcPtr = module_->createFunction(funcName, funcType);
                 funcPtr->linkage = HIRFunction::Linkage::External;
@@ -1438,7 +1451,7 @@ void HIRGenerator::visit(TryStmt& node) {
                 tryEnd = existing.get();
             } else {
                 auto* type = new HIRFunctionType(
-                    {}, std::make_shared<HIRType>(
+                    {}, HIRType::get(
                             HIRType::Kind::Void));
                 auto created =
                     module_->createFunction("nova_try_end", type);
@@ -1482,7 +1495,7 @@ void HIRGenerator::visit(TryStmt& node) {
                     // calling nova_throw). Declaring the return type as JSValue
                     // prevents downstream codegen from re-wrapping it with
                     // nova_value_from_i64 and losing the string/object tag bits.
-                    auto returnType = std::make_shared<HIRType>(HIRType::Kind::JSValue);
+                    auto returnType = HIRType::get(HIRType::Kind::JSValue);
                     HIRFunctionType* funcType = new HIRFunctionType(paramTypes, returnType);
                     HIRFunctionPtr funcPtr = module_->createFunction(funcName, funcType);
                     funcPtr->linkage = HIRFunction::Linkage::External;
@@ -1498,7 +1511,7 @@ void HIRGenerator::visit(TryStmt& node) {
             // try scope even when the catch returns early.
             {
                 auto voidType =
-                    std::make_shared<HIRType>(HIRType::Kind::Void);
+                    HIRType::get(HIRType::Kind::Void);
                 auto getRuntimeVoid = [&](const std::string& name) {
                     if (auto existing = module_->getFunction(name)) {
                         return existing.get();
@@ -49,7 +49,7 @@ void HIRGenerator::visit(FunctionExpr& node) {
             !forcePromiseExecutorABI_ && !forceTaggedFunctionABI_;
         if (supportsDynamicThis) {
             paramTypes.push_back(
-                std::make_shared<HIRType>(HIRType::Kind::JSValue));
+                HIRType::get(HIRType::Kind::JSValue));
         }
         for (size_t i = 0; i < node.params.size(); ++i) {
             if (i < node.paramPatterns.size() && node.paramPatterns[i]) {
@@ -62,10 +62,10 @@ void HIRGenerator::visit(FunctionExpr& node) {
                 i < node.paramTypes.size() && node.paramTypes[i]) {
                 typeKind = convertTypeKind(node.paramTypes[i]->kind);
             }
-            paramTypes.push_back(std::make_shared<HIRType>(typeKind));
+            paramTypes.push_back(HIRType::get(typeKind));
         }
         if (!node.restParam.empty()) {
-            auto restElementType = std::make_shared<HIRType>(HIRType::Kind::JSValue);
+            auto restElementType = HIRType::get(HIRType::Kind::JSValue);
             auto restArrayType = std::make_shared<HIRArrayType>(restElementType, 0);
             paramTypes.push_back(std::make_shared<HIRPointerType>(restArrayType, true));
         }
@@ -83,7 +83,7 @@ void HIRGenerator::visit(FunctionExpr& node) {
         } else if (!node.isGenerator && hasHeterogeneousReturns(node.body.get())) {
             retTypeKind = HIRType::Kind::JSValue;
         }
-        auto retType = std::make_shared<HIRType>(retTypeKind);
+        auto retType = HIRType::get(retTypeKind);
 
         auto funcType = new HIRFunctionType(paramTypes, retType);
 
@@ -358,11 +358,11 @@ void HIRGenerator::visit(ArrowFunctionExpr& node) {
                 i < node.paramTypes.size() && node.paramTypes[i]) {
                 typeKind = convertTypeKind(node.paramTypes[i]->kind);
             }
-            paramTypes.push_back(std::make_shared<HIRType>(typeKind));
+            paramTypes.push_back(HIRType::get(typeKind));
         }
 
         if (!node.restParam.empty()) {
-            auto restElementType = std::make_shared<HIRType>(HIRType::Kind::JSValue);
+            auto restElementType = HIRType::get(HIRType::Kind::JSValue);
             auto restArrayType = std::make_shared<HIRArrayType>(restElementType, 0);
             paramTypes.push_back(std::make_shared<HIRPointerType>(restArrayType, true));
         }
@@ -380,7 +380,7 @@ void HIRGenerator::visit(ArrowFunctionExpr& node) {
         } else if (hasHeterogeneousReturns(node.body.get())) {
             retTypeKind = HIRType::Kind::JSValue;
         }
-        auto retType = std::make_shared<HIRType>(retTypeKind);
+        auto retType = HIRType::get(retTypeKind);
 
         auto funcType = new HIRFunctionType(paramTypes, retType);
 
@@ -466,7 +466,7 @@ void HIRGenerator::visit(ArrowFunctionExpr& node) {
         // Generate function body
         if (node.body) {
             // Check if body is an expression statement (implicit return)
-            if (auto* exprStmt = dynamic_cast<ExprStmt*>(node.body.get())) {
+            if (auto* exprStmt = ast_cast<ExprStmt>(node.body.get())) {
                 // Arrow function with expression body: x => x + 1
                 // This should return the expression value
                 exprStmt->expression->accept(*this);
@@ -478,7 +478,7 @@ void HIRGenerator::visit(ArrowFunctionExpr& node) {
                     // JavaScript represents booleans as numbers (0/1), and C++ runtime
                     // callbacks expect int64_t returns, not bool
                     if (lastValue_->type->kind == HIRType::Kind::Bool) {
-                        func->functionType->returnType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        func->functionType->returnType = HIRType::get(HIRType::Kind::I64);
                         if(NOVA_DEBUG) std::cerr << "DEBUG: Arrow function bool return converted to I64 for callback compatibility" << std::endl;
                     } else {
                         func->functionType->returnType = lastValue_->type;
@@ -503,7 +503,7 @@ void HIRGenerator::visit(ArrowFunctionExpr& node) {
                             if (!terminator->operands.empty() && terminator->operands[0]->type) {
                                 // SPECIAL CASE: Convert Bool to I64 for callback compatibility
                                 if (terminator->operands[0]->type->kind == HIRType::Kind::Bool) {
-                                    func->functionType->returnType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                                    func->functionType->returnType = HIRType::get(HIRType::Kind::I64);
                                     if(NOVA_DEBUG) std::cerr << "DEBUG: Arrow function bool return converted to I64 for callback compatibility" << std::endl;
                                 } else {
                                     func->functionType->returnType = terminator->operands[0]->type;
@@ -640,13 +640,13 @@ void HIRGenerator::visit(FunctionDecl& node) {
         const bool supportsDynamicThis = !node.isGenerator;
         if (supportsDynamicThis) {
             paramTypes.push_back(
-                std::make_shared<HIRType>(HIRType::Kind::JSValue));
+                HIRType::get(HIRType::Kind::JSValue));
         }
 
         // For generator functions, add implicit genPtr and input parameters
         if (node.isGenerator) {
-            paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer));  // genPtr
-            paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::I64));      // input
+            paramTypes.push_back(HIRType::get(HIRType::Kind::Pointer));  // genPtr
+            paramTypes.push_back(HIRType::get(HIRType::Kind::I64));      // input
         }
 
         // Generator bodies are resumed by nova_generator_next through the
@@ -672,7 +672,7 @@ void HIRGenerator::visit(FunctionDecl& node) {
                         }
                     }
                     auto elementType =
-                        std::make_shared<HIRType>(elementKind);
+                        HIRType::get(elementKind);
                     auto arrayType =
                         std::make_shared<HIRArrayType>(elementType, 0);
                     paramTypes.push_back(
@@ -702,7 +702,7 @@ void HIRGenerator::visit(FunctionDecl& node) {
                     typeKind = HIRType::Kind::Pointer;
                 }
 
-                paramTypes.push_back(std::make_shared<HIRType>(typeKind));
+                paramTypes.push_back(HIRType::get(typeKind));
             }
         }
 
@@ -711,7 +711,7 @@ void HIRGenerator::visit(FunctionDecl& node) {
         // avoiding a platform-specific C varargs ABI while preserving the
         // JavaScript-visible rest value.
         if (!node.isGenerator && !node.restParam.empty()) {
-            auto restElementType = std::make_shared<HIRType>(
+            auto restElementType = HIRType::get(
                 HIRType::Kind::JSValue);
             auto restArrayType = std::make_shared<HIRArrayType>(
                 restElementType, 0);
@@ -728,7 +728,7 @@ void HIRGenerator::visit(FunctionDecl& node) {
         } else if (!node.isGenerator && hasHeterogeneousReturns(node.body.get())) {
             retTypeKind = HIRType::Kind::JSValue;
         }
-        auto retType = std::make_shared<HIRType>(retTypeKind);
+        auto retType = HIRType::get(retTypeKind);
 
         auto funcType = new HIRFunctionType(paramTypes, retType);
         
@@ -891,8 +891,8 @@ void HIRGenerator::visit(FunctionDecl& node) {
             generatorLoadLocalFunc_ = nullptr;
 
             // Generator function receives (genPtr, input) as implicit first two parameters
-            auto voidType = std::make_shared<HIRType>(HIRType::Kind::Void);
-            auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+            auto voidType = HIRType::get(HIRType::Kind::Void);
+            auto intType = HIRType::get(HIRType::Kind::I64);
             // Use proper HIRPointerType for generator pointer (pointer to opaque void)
             auto ptrType = std::make_shared<HIRPointerType>(voidType, false);
 
@@ -1026,9 +1026,9 @@ void HIRGenerator::visit(FunctionDecl& node) {
             // (i.e., no explicit return statement in the generator)
             auto* currentBlock = builder_->getInsertBlock();
             if (currentBlock && !currentBlock->hasTerminator()) {
-                auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
-                auto voidType = std::make_shared<HIRType>(HIRType::Kind::Void);
+                auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                auto intType = HIRType::get(HIRType::Kind::I64);
+                auto voidType = HIRType::get(HIRType::Kind::Void);
 
                 std::string completeFuncName = "nova_generator_complete";
                 auto existingCompleteFunc = module_->getFunction(completeFuncName);
@@ -33,7 +33,7 @@ void HIRGenerator::visit(BigIntLiteral& node) {
     // Create BigInt from string literal (ES2020)
     if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: BigInt literal: " << node.value << "n" << std::endl;
 
-    auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+    auto ptrType = HIRType::get(HIRType::Kind::Pointer);
 
     // Create string constant for the value
     HIRValue* strValue = builder_->createStringConstant(node.value);
@@ -85,9 +85,9 @@ void HIRGenerator::visit(RegexLiteralExpr& node) {
     if (!regexCreateFunc) {
         // Declare the function
         std::vector<HIRTypePtr> paramTypes;
-        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-        paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
-        auto returnType = std::make_shared<HIRType>(HIRType::Kind::Any);  // Returns regex handle
+        paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+        paramTypes.push_back(HIRType::get(HIRType::Kind::String));
+        auto returnType = HIRType::get(HIRType::Kind::Any);  // Returns regex handle
 
         HIRFunctionType* funcType = new HIRFunctionType(paramTypes, returnType);
         HIRFunctionPtr funcPtr = module_->createFunction("nova_regex_create", funcType);
@@ -107,14 +107,14 @@ void HIRGenerator::visit(BooleanLiteral& node) {
 // NullLiteral - handles null constant
 void HIRGenerator::visit(NullLiteral& node) {
     (void)node;
-    auto nullType = std::make_shared<HIRType>(HIRType::Kind::Unknown);
+    auto nullType = HIRType::get(HIRType::Kind::Unknown);
     lastValue_ = builder_->createNullConstant(nullType.get());
 }
 
 // UndefinedLiteral - handles undefined constant
 void HIRGenerator::visit(UndefinedLiteral& node) {
     (void)node;
-    auto undefType = std::make_shared<HIRType>(HIRType::Kind::Unknown);
+    auto undefType = HIRType::get(HIRType::Kind::Unknown);
     lastValue_ = builder_->createUndefinedConstant(undefType.get());
 }
 
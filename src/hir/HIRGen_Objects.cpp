@@ -21,12 +21,12 @@ namespace nova::hir {
 // retrieved and dispatched by Proxy traps, Reflect.apply, Object.groupBy
 // callbacks, and any other path that needs to treat a function as a value.
 void HIRGenerator::emitRuntimeObjectLiteral(ObjectExpr& node) {
-    auto pointerType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-    auto stringType = std::make_shared<HIRType>(HIRType::Kind::String);
-    auto jsValueType = std::make_shared<HIRType>(HIRType::Kind::JSValue);
-    auto voidType = std::make_shared<HIRType>(HIRType::Kind::Void);
-    auto i64Type = std::make_shared<HIRType>(HIRType::Kind::I64);
-    auto anyType = std::make_shared<HIRType>(HIRType::Kind::Any);
+    auto pointerType = HIRType::get(HIRType::Kind::Pointer);
+    auto stringType = HIRType::get(HIRType::Kind::String);
+    auto jsValueType = HIRType::get(HIRType::Kind::JSValue);
+    auto voidType = HIRType::get(HIRType::Kind::Void);
+    auto i64Type = HIRType::get(HIRType::Kind::I64);
+    auto anyType = HIRType::get(HIRType::Kind::Any);
 
     // nova_dynamic_object_create() -> Object*
     auto getCreate = [&](HIRFunction*& fn) {
@@ -80,11 +80,11 @@ void HIRGenerator::emitRuntimeObjectLiteral(ObjectExpr& node) {
             continue;
         }
         std::string fieldName = "field" + std::to_string(i);
-        if (auto* ident = dynamic_cast<Identifier*>(prop.key.get())) {
+        if (auto* ident = ast_cast<Identifier>(prop.key.get())) {
             fieldName = ident->name;
-        } else if (auto* str = dynamic_cast<StringLiteral*>(prop.key.get())) {
+        } else if (auto* str = ast_cast<StringLiteral>(prop.key.get())) {
             fieldName = str->value;
-        } else if (auto* num = dynamic_cast<NumberLiteral*>(prop.key.get())) {
+        } else if (auto* num = ast_cast<NumberLiteral>(prop.key.get())) {
             fieldName = std::to_string(num->value);
         }
 
@@ -115,7 +115,7 @@ void HIRGenerator::emitRuntimeObjectLiteral(ObjectExpr& node) {
     // context (the function constructing this object literal) and store BOTH
     // the function pointer and env pointer on the runtime Object — trap
     // dispatch then passes env as the trailing argument.
-    auto voidType2 = std::make_shared<HIRType>(HIRType::Kind::Void);
+    auto voidType2 = HIRType::get(HIRType::Kind::Void);
     auto getSetFnWithEnv = [&](HIRFunction*& fn) {
         auto existing = module_->getFunction("nova_dynamic_object_set_function_with_env");
         if (existing) { fn = existing.get(); return; }
@@ -131,7 +131,7 @@ void HIRGenerator::emitRuntimeObjectLiteral(ObjectExpr& node) {
     bool hasRangeTo = false;
     for (const auto& property : node.properties) {
         if (auto* identifier =
-                dynamic_cast<Identifier*>(property.key.get())) {
+                ast_cast<Identifier>(property.key.get())) {
             hasRangeFrom = hasRangeFrom || identifier->name == "from";
             hasRangeTo = hasRangeTo || identifier->name == "to";
         }
@@ -142,14 +142,14 @@ void HIRGenerator::emitRuntimeObjectLiteral(ObjectExpr& node) {
         if (prop.kind != ObjectExpr::Property::Kind::Method) continue;
 
         std::string fieldName;
-        if (auto* ident = dynamic_cast<Identifier*>(prop.key.get())) {
+        if (auto* ident = ast_cast<Identifier>(prop.key.get())) {
             fieldName = ident->name;
-        } else if (auto* str = dynamic_cast<StringLiteral*>(prop.key.get())) {
+        } else if (auto* str = ast_cast<StringLiteral>(prop.key.get())) {
             fieldName = str->value;
         } else if (auto* member =
-                       dynamic_cast<MemberExpr*>(prop.key.get())) {
-            auto* base = dynamic_cast<Identifier*>(member->object.get());
-            auto* key = dynamic_cast<Identifier*>(member->property.get());
+                       ast_cast<MemberExpr>(prop.key.get())) {
+            auto* base = ast_cast<Identifier>(member->object.get());
+            auto* key = ast_cast<Identifier>(member->property.get());
             if (base && key && base->name == "Symbol" &&
                 key->name == "iterator") {
                 fieldName = "__iterator__";
@@ -158,7 +158,7 @@ void HIRGenerator::emitRuntimeObjectLiteral(ObjectExpr& node) {
             continue;
         }
 
-        auto* funcExpr = dynamic_cast<FunctionExpr*>(prop.value.get());
+        auto* funcExpr = ast_cast<FunctionExpr>(prop.value.get());
         if (!funcExpr) continue;
 
         // A `{from, to, [Symbol.iterator]() { ...next closure... }}`
@@ -273,12 +273,16 @@ void HIRGenerator::emitRuntimeObjectLiteral(ObjectExpr& node) {
 
 
 void HIRGenerator::visit(MemberExpr& node) {
+        if (tryCanonicalLoopAccess(node)) {
+            return;
+        }
+
         auto regexPointerType =
-            std::make_shared<HIRType>(HIRType::Kind::Pointer);
+            HIRType::get(HIRType::Kind::Pointer);
         auto regexIntegerType =
-            std::make_shared<HIRType>(HIRType::Kind::I64);
+            HIRType::get(HIRType::Kind::I64);
         auto regexStringType =
-            std::make_shared<HIRType>(HIRType::Kind::String);
+            HIRType::get(HIRType::Kind::String);
 
         // Intrinsic prototypes are real singleton runtime Objects. This is
         // required for observable descriptor operations (hasOwnProperty,
@@ -287,14 +291,14 @@ void HIRGenerator::visit(MemberExpr& node) {
         // compiler markers.
         if (!node.isComputed) {
             auto* intrinsic =
-                dynamic_cast<Identifier*>(node.object.get());
+                ast_cast<Identifier>(node.object.get());
             auto* property =
-                dynamic_cast<Identifier*>(node.property.get());
+                ast_cast<Identifier>(node.property.get());
             if (intrinsic && property && property->name == "prototype" &&
                 (intrinsic->name == "Date" ||
                  intrinsic->name == "RegExp")) {
                 auto stringType =
-                    std::make_shared<HIRType>(HIRType::Kind::String);
+                    HIRType::get(HIRType::Kind::String);
                 HIRFunction* getter = nullptr;
                 if (auto existing =
                         module_->getFunction("nova_intrinsic_object")) {
@@ -321,9 +325,9 @@ void HIRGenerator::visit(MemberExpr& node) {
         // RegExp.lastIndex is mutable runtime state.
         if (!node.isComputed) {
             auto* regexIdentifier =
-                dynamic_cast<Identifier*>(node.object.get());
+                ast_cast<Identifier>(node.object.get());
             auto* property =
-                dynamic_cast<Identifier*>(node.property.get());
+                ast_cast<Identifier>(node.property.get());
             if (regexIdentifier && property &&
                 regexVars_.count(regexIdentifier->name) > 0 &&
                 property->name == "lastIndex") {
@@ -351,12 +355,12 @@ void HIRGenerator::visit(MemberExpr& node) {
         // works for both exec() results and each matchAll() element.
         if (!node.isComputed) {
             auto* groups =
-                dynamic_cast<MemberExpr*>(node.object.get());
+                ast_cast<MemberExpr>(node.object.get());
             auto* groupsProperty = groups
-                ? dynamic_cast<Identifier*>(groups->property.get())
+                ? ast_cast<Identifier>(groups->property.get())
                 : nullptr;
             auto* groupName =
-                dynamic_cast<Identifier*>(node.property.get());
+                ast_cast<Identifier>(node.property.get());
             if (groups && !groups->isComputed && groupsProperty &&
                 groupName && groupsProperty->name == "groups") {
                 groups->object->accept(*this);
@@ -391,22 +395,22 @@ void HIRGenerator::visit(MemberExpr& node) {
         // MatchResult.indices[capture][endpoint].
         if (node.isComputed) {
             auto* captureAccess =
-                dynamic_cast<MemberExpr*>(node.object.get());
+                ast_cast<MemberExpr>(node.object.get());
             auto* indicesAccess = captureAccess
-                ? dynamic_cast<MemberExpr*>(
+                ? ast_cast<MemberExpr>(
                       captureAccess->object.get())
                 : nullptr;
             auto* indicesProperty = indicesAccess
-                ? dynamic_cast<Identifier*>(
+                ? ast_cast<Identifier>(
                       indicesAccess->property.get())
                 : nullptr;
             auto* capture =
                 captureAccess
-                ? dynamic_cast<NumberLiteral*>(
+                ? ast_cast<NumberLiteral>(
                       captureAccess->property.get())
                 : nullptr;
             auto* endpoint =
-                dynamic_cast<NumberLiteral*>(node.property.get());
+                ast_cast<NumberLiteral>(node.property.get());
             if (captureAccess && captureAccess->isComputed &&
                 indicesAccess && !indicesAccess->isComputed &&
                 indicesProperty && indicesProperty->name == "indices" &&
@@ -448,28 +452,28 @@ void HIRGenerator::visit(MemberExpr& node) {
         // Resolve fields of an Intl.NumberFormat resolved-options result
         // without erasing its runtime type to an opaque pointer.
         if (auto* resolvedCall =
-                dynamic_cast<CallExpr*>(node.object.get())) {
+                ast_cast<CallExpr>(node.object.get())) {
             auto* resolvedMember =
-                dynamic_cast<MemberExpr*>(resolvedCall->callee.get());
+                ast_cast<MemberExpr>(resolvedCall->callee.get());
             auto* formatter = resolvedMember
-                ? dynamic_cast<Identifier*>(
+                ? ast_cast<Identifier>(
                       resolvedMember->object.get())
                 : nullptr;
             auto* resolvedMethod = resolvedMember
-                ? dynamic_cast<Identifier*>(
+                ? ast_cast<Identifier>(
                       resolvedMember->property.get())
                 : nullptr;
             auto* optionProperty =
-                dynamic_cast<Identifier*>(node.property.get());
+                ast_cast<Identifier>(node.property.get());
             if (formatter && resolvedMethod && optionProperty &&
                 numberFormatVars_.count(formatter->name) > 0 &&
                 resolvedMethod->name == "resolvedOptions" &&
                 optionProperty->name == "currency") {
                 formatter->accept(*this);
                 auto pointerType =
-                    std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                    HIRType::get(HIRType::Kind::Pointer);
                 auto stringType =
-                    std::make_shared<HIRType>(HIRType::Kind::String);
+                    HIRType::get(HIRType::Kind::String);
                 HIRFunction* function = nullptr;
                 if (auto existing = module_->getFunction(
                         "nova_intl_numberformat_currency")) {
@@ -498,15 +502,15 @@ void HIRGenerator::visit(MemberExpr& node) {
         // cause, runtime-array pointer for errors). Without this short-circuit
         // the dynamic path returns a generic JSValue and `.errors.length` or
         // `.cause` propagation fails.
-        if (auto* errIdent = dynamic_cast<Identifier*>(node.object.get())) {
+        if (auto* errIdent = ast_cast<Identifier>(node.object.get())) {
             if (promiseWithResolversVars_.count(errIdent->name) > 0) {
-                if (auto* propIdent = dynamic_cast<Identifier*>(node.property.get())) {
+                if (auto* propIdent = ast_cast<Identifier>(node.property.get())) {
                     const std::string& propertyName = propIdent->name;
                     if (propertyName == "promise" || propertyName == "resolve" ||
                         propertyName == "reject") {
                         errIdent->accept(*this);
                         HIRValue* object = lastValue_;
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
 
                         std::string runtimeFunc;
                         if (propertyName == "promise") {
@@ -538,7 +542,7 @@ void HIRGenerator::visit(MemberExpr& node) {
                 }
             }
             if (errorVars_.count(errIdent->name) > 0) {
-                if (auto* propIdent = dynamic_cast<Identifier*>(node.property.get())) {
+                if (auto* propIdent = ast_cast<Identifier>(node.property.get())) {
                     const std::string& propertyName = propIdent->name;
                     static const std::unordered_set<std::string> errorProps = {
                         "name", "message", "stack", "cause", "errors"
@@ -546,9 +550,9 @@ void HIRGenerator::visit(MemberExpr& node) {
                     if (errorProps.count(propertyName) > 0) {
                         errIdent->accept(*this);
                         HIRValue* object = lastValue_;
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                        auto jsValueType = std::make_shared<HIRType>(HIRType::Kind::JSValue);
-                        auto stringType = std::make_shared<HIRType>(HIRType::Kind::String);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                        auto jsValueType = HIRType::get(HIRType::Kind::JSValue);
+                        auto stringType = HIRType::get(HIRType::Kind::String);
 
                         std::string runtimeFunc;
                         std::string returnTypeKind;  // empty = ptr(string), "jsvalue" = JSValue
@@ -613,7 +617,7 @@ void HIRGenerator::visit(MemberExpr& node) {
         std::function<bool(Expr*)> isDynamicObjectExpression =
             [&](Expr* expression) -> bool {
                 if (!expression) return false;
-                if (dynamic_cast<ThisExpr*>(expression)) {
+                if (ast_cast<ThisExpr>(expression)) {
                     // Class constructors/methods keep `this` as a statically
                     // laid-out struct pointer. Only the source entry/global
                     // receiver and ordinary functions using the tagged-this
@@ -630,7 +634,7 @@ void HIRGenerator::visit(MemberExpr& node) {
                               HIRType::Kind::JSValue));
                 }
                 if (auto* identifier =
-                        dynamic_cast<Identifier*>(expression)) {
+                        ast_cast<Identifier>(expression)) {
                     // Array-typed callback parameters may also contain
                     // dynamic objects as their elements. The container
                     // itself still uses ValueArray metadata and must route
@@ -664,7 +668,7 @@ void HIRGenerator::visit(MemberExpr& node) {
                         (binding->type->kind == HIRType::Kind::Any ||
                          binding->type->kind == HIRType::Kind::JSValue);
                 }
-                if (auto* assertion = dynamic_cast<AsExpr*>(expression)) {
+                if (auto* assertion = ast_cast<AsExpr>(expression)) {
                     if (assertion->targetType &&
                         assertion->targetType->kind == Type::Kind::Any) {
                         return true;
@@ -672,13 +676,13 @@ void HIRGenerator::visit(MemberExpr& node) {
                     return isDynamicObjectExpression(
                         assertion->expression.get());
                 }
-                if (auto* member = dynamic_cast<MemberExpr*>(expression)) {
+                if (auto* member = ast_cast<MemberExpr>(expression)) {
                     if (!member->isComputed) {
                         auto* base =
-                            dynamic_cast<Identifier*>(
+                            ast_cast<Identifier>(
                                 member->object.get());
                         auto* property =
-                            dynamic_cast<Identifier*>(
+                            ast_cast<Identifier>(
                                 member->property.get());
                         if (base && property &&
                             property->name == "prototype" &&
@@ -695,13 +699,13 @@ void HIRGenerator::visit(MemberExpr& node) {
             bool symbolKeySyntax = false;
             if (node.isComputed) {
                 if (auto* symbolMember =
-                        dynamic_cast<MemberExpr*>(node.property.get())) {
+                        ast_cast<MemberExpr>(node.property.get())) {
                     auto* symbolBase =
-                        dynamic_cast<Identifier*>(symbolMember->object.get());
+                        ast_cast<Identifier>(symbolMember->object.get());
                     symbolKeySyntax =
                         symbolBase && symbolBase->name == "Symbol";
                 } else if (auto* symbolIdentifier =
-                               dynamic_cast<Identifier*>(node.property.get())) {
+                               ast_cast<Identifier>(node.property.get())) {
                     symbolKeySyntax =
                         symbolVars_.count(symbolIdentifier->name) > 0;
                 }
@@ -720,9 +724,9 @@ void HIRGenerator::visit(MemberExpr& node) {
                 if (computedKeyIsSymbol && computedKey &&
                     computedKey->type &&
                     computedKey->type->kind == HIRType::Kind::Pointer) {
-                    auto pointerType = std::make_shared<HIRType>(
+                    auto pointerType = HIRType::get(
                         HIRType::Kind::Pointer);
-                    auto jsValueType = std::make_shared<HIRType>(
+                    auto jsValueType = HIRType::get(
                         HIRType::Kind::JSValue);
                     if (objectValue && objectValue->type &&
                         objectValue->type->kind == HIRType::Kind::JSValue) {
@@ -764,24 +768,24 @@ void HIRGenerator::visit(MemberExpr& node) {
             std::string propertyName;
             if (!node.isComputed) {
             if (auto* propertyIdentifier =
-                    dynamic_cast<Identifier*>(node.property.get())) {
+                    ast_cast<Identifier>(node.property.get())) {
                 propertyName = propertyIdentifier->name;
             } else if (auto* propertyString =
-                           dynamic_cast<StringLiteral*>(node.property.get())) {
+                           ast_cast<StringLiteral>(node.property.get())) {
                 propertyName = propertyString->value;
             }
             } else if (auto* propertyString =
-                           dynamic_cast<StringLiteral*>(node.property.get())) {
+                           ast_cast<StringLiteral>(node.property.get())) {
                 propertyName = propertyString->value;
             }
             if (!propertyName.empty() || node.isComputed) {
                 node.object->accept(*this);
                 HIRValue* objectValue = lastValue_;
-                auto pointerType = std::make_shared<HIRType>(
+                auto pointerType = HIRType::get(
                     HIRType::Kind::Pointer);
-                auto stringType = std::make_shared<HIRType>(
+                auto stringType = HIRType::get(
                     HIRType::Kind::String);
-                auto jsValueType = std::make_shared<HIRType>(
+                auto jsValueType = HIRType::get(
                     HIRType::Kind::JSValue);
                 // If the object expression just produced a runtime-array
                 // metadata pointer (e.g. `aggregate.errors`), the dynamic
@@ -790,7 +794,7 @@ void HIRGenerator::visit(MemberExpr& node) {
                 // and `[i]` on the freshly-produced runtime array instead.
                 if (lastWasRuntimeArray_ && objectValue && objectValue->type &&
                     objectValue->type->kind == HIRType::Kind::Pointer) {
-                    auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                    auto intType = HIRType::get(HIRType::Kind::I64);
                     if (propertyName == "length") {
                         auto existingLen = module_->getFunction("nova_value_array_length");
                         HIRFunction* lenFn = existingLen ? existingLen.get() : nullptr;
@@ -828,7 +832,7 @@ void HIRGenerator::visit(MemberExpr& node) {
                     objectValue->type &&
                     objectValue->type->kind == HIRType::Kind::JSValue) {
                     auto intType =
-                        std::make_shared<HIRType>(HIRType::Kind::I64);
+                        HIRType::get(HIRType::Kind::I64);
                     HIRFunction* lengthFn = nullptr;
                     if (auto existing =
                             module_->getFunction("nova_value_length")) {
@@ -908,7 +912,7 @@ void HIRGenerator::visit(MemberExpr& node) {
                                propertyKey->type->kind !=
                                    HIRType::Kind::Pointer) {
                         auto integerType =
-                            std::make_shared<HIRType>(
+                            HIRType::get(
                                 HIRType::Kind::I64);
                         HIRFunction* toString = nullptr;
                         if (auto found = module_->getFunction(
@@ -943,8 +947,8 @@ void HIRGenerator::visit(MemberExpr& node) {
             }
         }
 
-        if (auto* objectIdentifier = dynamic_cast<Identifier*>(node.object.get())) {
-            if (auto* propertyIdentifier = dynamic_cast<Identifier*>(node.property.get())) {
+        if (auto* objectIdentifier = ast_cast<Identifier>(node.object.get())) {
+            if (auto* propertyIdentifier = ast_cast<Identifier>(node.property.get())) {
                 const auto& namespaceName = objectIdentifier->name;
                 const auto& propertyName = propertyIdentifier->name;
                 if (auto space = moduleNamespaceNumberConstants_.find(namespaceName);
@@ -978,9 +982,9 @@ void HIRGenerator::visit(MemberExpr& node) {
         }
 
         // Handle globalThis property access (ES2020)
-        if (auto* objIdent = dynamic_cast<Identifier*>(node.object.get())) {
+        if (auto* objIdent = ast_cast<Identifier>(node.object.get())) {
             if (objIdent->name == "globalThis") {
-                if (auto* propIdent = dynamic_cast<Identifier*>(node.property.get())) {
+                if (auto* propIdent = ast_cast<Identifier>(node.property.get())) {
                     if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: globalThis." << propIdent->name << " property access" << std::endl;
 
                     // Global constants
@@ -1042,8 +1046,8 @@ void HIRGenerator::visit(MemberExpr& node) {
         }
 
         // Check for Math constants (PI, E, etc.)
-        if (auto* objIdent = dynamic_cast<Identifier*>(node.object.get())) {
-            if (auto* propIdent = dynamic_cast<Identifier*>(node.property.get())) {
+        if (auto* objIdent = ast_cast<Identifier>(node.object.get())) {
+            if (auto* propIdent = ast_cast<Identifier>(node.property.get())) {
                 if (objIdent->name == "Math") {
                     if (propIdent->name == "PI") {
                         // Math.PI ≈ 3.14159... -> return 3 for integer
@@ -1151,7 +1155,7 @@ void HIRGenerator::visit(MemberExpr& node) {
                     }
 
                     if (!runtimeFunc.empty()) {
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
                         std::vector<HIRTypePtr> paramTypes;  // No params
 
                         HIRFunction* func = nullptr;
@@ -1190,7 +1194,7 @@ void HIRGenerator::visit(MemberExpr& node) {
                     // Reverse mapping for numeric enums: Color[0] -> "Red"
                     if (node.isComputed) {
                         // property is the expression in brackets
-                        if (auto* numLit = dynamic_cast<NumberLiteral*>(node.property.get())) {
+                        if (auto* numLit = ast_cast<NumberLiteral>(node.property.get())) {
                             int64_t key = static_cast<int64_t>(numLit->value);
                             for (const auto& p : enumIt->second) {
                                 if (p.second.kind == HIRGenerator::EnumValue::Kind::Number &&
@@ -1211,8 +1215,8 @@ void HIRGenerator::visit(MemberExpr& node) {
                         // (e.g. private static counters). Use the lazy-init variant so the
                         // declared initializer is applied on first access without needing
                         // an active HIR insert point at class-declaration time.
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                        auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                        auto intType = HIRType::get(HIRType::Kind::I64);
                         std::string propKey = objIdent->name + "_" + propIdent->name;
                         int64_t initValue = 0;
                         auto ivIt = staticPropertyValues_.find(propKey);
@@ -1241,20 +1245,20 @@ void HIRGenerator::visit(MemberExpr& node) {
         // `range(1, 3).next().value` have no identifier that can be recorded
         // in generatorVars_. Lower the complete chain here so the generator
         // expression is evaluated exactly once.
-        if (auto* resultCall = dynamic_cast<CallExpr*>(node.object.get())) {
+        if (auto* resultCall = ast_cast<CallExpr>(node.object.get())) {
             auto* nextMember =
-                dynamic_cast<MemberExpr*>(resultCall->callee.get());
+                ast_cast<MemberExpr>(resultCall->callee.get());
             auto* method = nextMember
-                ? dynamic_cast<Identifier*>(nextMember->property.get())
+                ? ast_cast<Identifier>(nextMember->property.get())
                 : nullptr;
             auto* generatorCall = nextMember
-                ? dynamic_cast<CallExpr*>(nextMember->object.get())
+                ? ast_cast<CallExpr>(nextMember->object.get())
                 : nullptr;
             auto* generatorName = generatorCall
-                ? dynamic_cast<Identifier*>(generatorCall->callee.get())
+                ? ast_cast<Identifier>(generatorCall->callee.get())
                 : nullptr;
             auto* resultProperty =
-                dynamic_cast<Identifier*>(node.property.get());
+                ast_cast<Identifier>(node.property.get());
             if (method && generatorName && resultProperty &&
                 generatorFuncs_.count(generatorName->name) > 0 &&
                 (method->name == "next" ||
@@ -1265,9 +1269,9 @@ void HIRGenerator::visit(MemberExpr& node) {
                 generatorCall->accept(*this);
                 HIRValue* generator = lastValue_;
                 auto ptrType =
-                    std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                    HIRType::get(HIRType::Kind::Pointer);
                 auto intType =
-                    std::make_shared<HIRType>(HIRType::Kind::I64);
+                    HIRType::get(HIRType::Kind::I64);
                 const std::string nextHelper =
                     method->name == "return"
                         ? "nova_generator_return"
@@ -1299,7 +1303,7 @@ void HIRGenerator::visit(MemberExpr& node) {
 
                 const bool wantsValue =
                     resultProperty->name == "value";
-                auto resultType = std::make_shared<HIRType>(
+                auto resultType = HIRType::get(
                     wantsValue ? HIRType::Kind::I64
                                : HIRType::Kind::Bool);
                 const std::string accessor = wantsValue
@@ -1336,15 +1340,15 @@ void HIRGenerator::visit(MemberExpr& node) {
         // call to a variable first, so the direct form silently fell through
         // to generic property access and produced zero.
         bool immediateIteratorResult = false;
-        if (auto* resultCall = dynamic_cast<CallExpr*>(node.object.get())) {
+        if (auto* resultCall = ast_cast<CallExpr>(node.object.get())) {
             if (auto* nextMember =
-                    dynamic_cast<MemberExpr*>(resultCall->callee.get())) {
+                    ast_cast<MemberExpr>(resultCall->callee.get())) {
                 if (auto* method =
-                        dynamic_cast<Identifier*>(nextMember->property.get())) {
+                        ast_cast<Identifier>(nextMember->property.get())) {
                     if (method->name == "next" || method->name == "return" ||
                         method->name == "throw") {
                         if (auto* base =
-                                dynamic_cast<Identifier*>(nextMember->object.get())) {
+                                ast_cast<Identifier>(nextMember->object.get())) {
                             immediateIteratorResult =
                                 generatorVars_.count(base->name) > 0 ||
                                 asyncGeneratorVars_.count(base->name) > 0;
@@ -1355,13 +1359,13 @@ void HIRGenerator::visit(MemberExpr& node) {
         }
         if (immediateIteratorResult) {
             if (auto* property =
-                    dynamic_cast<Identifier*>(node.property.get())) {
+                    ast_cast<Identifier>(node.property.get())) {
                 const bool wantsValue = property->name == "value";
                 const bool wantsDone = property->name == "done";
                 if (wantsValue || wantsDone) {
                     auto ptrType =
-                        std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                    auto resultType = std::make_shared<HIRType>(
+                        HIRType::get(HIRType::Kind::Pointer);
+                    auto resultType = HIRType::get(
                         wantsValue ? HIRType::Kind::I64
                                    : HIRType::Kind::Bool);
                     const std::string helper = wantsValue
@@ -1396,10 +1400,10 @@ void HIRGenerator::visit(MemberExpr& node) {
         // generic-class path and returns undefined / segfaults.
         if (lastWasRuntimeArray_ && object && object->type &&
             object->type->kind == HIRType::Kind::Pointer) {
-            if (auto* propIdent = dynamic_cast<Identifier*>(node.property.get())) {
+            if (auto* propIdent = ast_cast<Identifier>(node.property.get())) {
                 if (propIdent->name == "length") {
-                    auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                    auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                    auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                    auto intType = HIRType::get(HIRType::Kind::I64);
                     auto existingFunc = module_->getFunction("nova_value_array_length");
                     HIRFunction* func = existingFunc ? existingFunc.get() : nullptr;
                     if (!func) {
@@ -1419,8 +1423,8 @@ void HIRGenerator::visit(MemberExpr& node) {
                 // numeric/symbol index on a freshly-produced runtime array
                 node.property->accept(*this);
                 auto index = lastValue_;
-                auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                auto intType = HIRType::get(HIRType::Kind::I64);
                 auto existingFunc = module_->getFunction("nova_value_array_at");
                 HIRFunction* func = existingFunc ? existingFunc.get() : nullptr;
                 if (!func) {
@@ -1443,8 +1447,8 @@ void HIRGenerator::visit(MemberExpr& node) {
                 value->type->kind != HIRType::Kind::JSValue) {
                 return value;
             }
-            auto jsValueType = std::make_shared<HIRType>(HIRType::Kind::JSValue);
-            auto pointerType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+            auto jsValueType = HIRType::get(HIRType::Kind::JSValue);
+            auto pointerType = HIRType::get(HIRType::Kind::Pointer);
             auto existing = module_->getFunction("nova_value_to_object");
             HIRFunction* function = existing ? existing.get() : nullptr;
             if (!function) {
@@ -1463,7 +1467,7 @@ void HIRGenerator::visit(MemberExpr& node) {
             // A literal string key on a fixed-layout object is statically the
             // same operation as dot access. Resolve it before the generic array
             // path, whose runtime ABI only accepts numeric indices.
-            if (auto* keyLiteral = dynamic_cast<StringLiteral*>(node.property.get())) {
+            if (auto* keyLiteral = ast_cast<StringLiteral>(node.property.get())) {
                 HIRStructType* structType = nullptr;
                 if (object && object->type) {
                     structType = dynamic_cast<HIRStructType*>(object->type.get());
@@ -1503,7 +1507,7 @@ void HIRGenerator::visit(MemberExpr& node) {
                 }
             }
             if (auto* arrayIdentifier =
-                    dynamic_cast<Identifier*>(node.object.get());
+                    ast_cast<Identifier>(node.object.get());
                 arrayIdentifier &&
                 runtimeArrayVars_.count(arrayIdentifier->name) > 0) {
                 isStaticArray = false;
@@ -1523,11 +1527,11 @@ void HIRGenerator::visit(MemberExpr& node) {
                 if (staticElementType &&
                     staticElementType->kind == HIRType::Kind::JSValue) {
                     auto ptrType =
-                        std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                        HIRType::get(HIRType::Kind::Pointer);
                     auto intType =
-                        std::make_shared<HIRType>(HIRType::Kind::I64);
+                        HIRType::get(HIRType::Kind::I64);
                     auto jsType =
-                        std::make_shared<HIRType>(HIRType::Kind::JSValue);
+                        HIRType::get(HIRType::Kind::JSValue);
                     auto existing = module_->getFunction(
                         "nova_value_array_at_tagged");
                     HIRFunction* function =
@@ -1554,10 +1558,10 @@ void HIRGenerator::visit(MemberExpr& node) {
                 // it as String. Apply an explicit cast so types align.
                 if (lastValue_ && lastValue_->type &&
                     lastValue_->type->kind == HIRType::Kind::I64) {
-                    if (auto* objIdent = dynamic_cast<Identifier*>(node.object.get())) {
+                    if (auto* objIdent = ast_cast<Identifier>(node.object.get())) {
                         auto it = variableArrayElementTypes_.find(objIdent->name);
                         if (it != variableArrayElementTypes_.end() && it->second == "String") {
-                            auto stringType = std::make_shared<HIRType>(HIRType::Kind::String);
+                            auto stringType = HIRType::get(HIRType::Kind::String);
                             lastValue_ = builder_->createCast(lastValue_, stringType.get(), "array_elem_str");
                         }
                     }
@@ -1566,27 +1570,27 @@ void HIRGenerator::visit(MemberExpr& node) {
             }
 
             // Check if this is runtime array element access (from keys(), values(), entries())
-            if (auto* objIdent = dynamic_cast<Identifier*>(node.object.get())) {
+            if (auto* objIdent = ast_cast<Identifier>(node.object.get())) {
                 if (runtimeArrayVars_.count(objIdent->name) > 0) {
                     if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Runtime array element access on " << objIdent->name << std::endl;
 
-                    auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                    auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                    auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                    auto intType = HIRType::get(HIRType::Kind::I64);
                     const bool tagged =
                         taggedRuntimeArrayVars_.count(objIdent->name) > 0;
                     HIRTypePtr elementType =
                         tagged
-                        ? std::make_shared<HIRType>(HIRType::Kind::JSValue)
+                        ? HIRType::get(HIRType::Kind::JSValue)
                         : intType;
                     if (!tagged) {
                         auto inferred =
                             variableArrayElementTypes_.find(objIdent->name);
                         if (inferred != variableArrayElementTypes_.end()) {
                             if (inferred->second == "String") {
-                                elementType = std::make_shared<HIRType>(
+                                elementType = HIRType::get(
                                     HIRType::Kind::String);
                             } else if (inferred->second == "Bool") {
-                                elementType = std::make_shared<HIRType>(
+                                elementType = HIRType::get(
                                     HIRType::Kind::Bool);
                             }
                         }
@@ -1630,7 +1634,7 @@ void HIRGenerator::visit(MemberExpr& node) {
             }
 
             // Check if this is TypedArray element access
-            if (auto* objIdent = dynamic_cast<Identifier*>(node.object.get())) {
+            if (auto* objIdent = ast_cast<Identifier>(node.object.get())) {
                 auto typeIt = typedArrayTypes_.find(objIdent->name);
                 if (typeIt != typedArrayTypes_.end()) {
                     std::string typedArrayType = typeIt->second;
@@ -1651,16 +1655,22 @@ void HIRGenerator::visit(MemberExpr& node) {
                     else if (typedArrayType == "BigInt64Array") runtimeFunc = "nova_bigint64array_get";
                     else if (typedArrayType == "BigUint64Array") runtimeFunc = "nova_biguint64array_get";
 
+                    // In-bounds by construction inside a canonical loop over this array
+                    if (!runtimeFunc.empty() &&
+                        isCanonicalTypedArrayElement(objIdent->name, node.property.get())) {
+                        runtimeFunc += "_unchecked";
+                    }
+
                     if (!runtimeFunc.empty()) {
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                        auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                        auto intType = HIRType::get(HIRType::Kind::I64);
 
                         // Determine return type (float for Float32/Float64, i64 otherwise)
                         HIRTypePtr returnType;
                         if (typedArrayType == "Float32Array" || typedArrayType == "Float64Array") {
-                            returnType = std::make_shared<HIRType>(HIRType::Kind::F64);
+                            returnType = HIRType::get(HIRType::Kind::F64);
                         } else {
-                            returnType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                            returnType = HIRType::get(HIRType::Kind::I64);
                         }
 
                         std::vector<HIRTypePtr> paramTypes = {ptrType, intType};
@@ -1685,8 +1695,8 @@ void HIRGenerator::visit(MemberExpr& node) {
 
             // Use runtime function for array element access to ensure correct type
             // This fixes the bug where arr[i] returns Object type instead of the element type
-            auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-            auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+            auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+            auto intType = HIRType::get(HIRType::Kind::I64);
 
             // String indexing: s[i] returns the single-character string at i,
             // matching JS String.prototype.charAt semantics. Without this, the
@@ -1701,9 +1711,9 @@ void HIRGenerator::visit(MemberExpr& node) {
                     func = existingFunc.get();
                 } else {
                     std::vector<HIRTypePtr> paramTypes = {
-                        std::make_shared<HIRType>(HIRType::Kind::String),
+                        HIRType::get(HIRType::Kind::String),
                         intType};
-                    auto stringType = std::make_shared<HIRType>(HIRType::Kind::String);
+                    auto stringType = HIRType::get(HIRType::Kind::String);
                     HIRFunctionType* funcType = new HIRFunctionType(paramTypes, stringType);
                     HIRFunctionPtr funcPtr = module_->createFunction(runtimeFunc, funcType);
                     funcPtr->linkage = HIRFunction::Linkage::External;
@@ -1711,20 +1721,20 @@ void HIRGenerator::visit(MemberExpr& node) {
                 }
                 std::vector<HIRValue*> args = {object, index};
                 lastValue_ = builder_->createCall(func, args, "str_index");
-                lastValue_->type = std::make_shared<HIRType>(HIRType::Kind::String);
+                lastValue_->type = HIRType::get(HIRType::Kind::String);
                 return;
             }
 
             // Determine element type from declared variable annotations
             // (e.g. `let arr: string[] = ...`) so arr[i] returns a proper String.
             HIRTypePtr resultType;
-            if (auto* objIdent = dynamic_cast<Identifier*>(node.object.get())) {
+            if (auto* objIdent = ast_cast<Identifier>(node.object.get())) {
                 auto it = variableArrayElementTypes_.find(objIdent->name);
                 if (it != variableArrayElementTypes_.end()) {
                     if (it->second == "String") {
-                        resultType = std::make_shared<HIRType>(HIRType::Kind::String);
+                        resultType = HIRType::get(HIRType::Kind::String);
                     } else if (it->second == "Bool") {
-                        resultType = std::make_shared<HIRType>(HIRType::Kind::Bool);
+                        resultType = HIRType::get(HIRType::Kind::Bool);
                     }
                 }
             }
@@ -1754,7 +1764,7 @@ void HIRGenerator::visit(MemberExpr& node) {
             }
         } else {
             // Regular member: obj.property (struct field access)
-            if (auto propExpr = dynamic_cast<Identifier*>(node.property.get())) {
+            if (auto propExpr = ast_cast<Identifier>(node.property.get())) {
                 std::string propertyName = propExpr->name;
 
                 // Extract the base variable name from node.object, handling chained calls
@@ -1762,25 +1772,25 @@ void HIRGenerator::visit(MemberExpr& node) {
                 // We need to find the original Set variable name (mySet)
                 std::string setVarName;
                 Expr* current = node.object.get();
-                while (auto* callExpr = dynamic_cast<CallExpr*>(current)) {
-                    if (auto* memberExpr = dynamic_cast<MemberExpr*>(callExpr->callee.get())) {
+                while (auto* callExpr = ast_cast<CallExpr>(current)) {
+                    if (auto* memberExpr = ast_cast<MemberExpr>(callExpr->callee.get())) {
                         current = memberExpr->object.get();
                     } else {
                         break;
                     }
                 }
-                if (auto* objIdent = dynamic_cast<Identifier*>(current)) {
+                if (auto* objIdent = ast_cast<Identifier>(current)) {
                     setVarName = objIdent->name;
                 }
 
                 // Check if this is TypedArray property access
-                if (auto* objIdent = dynamic_cast<Identifier*>(node.object.get())) {
+                if (auto* objIdent = ast_cast<Identifier>(node.object.get())) {
                     auto typeIt = typedArrayTypes_.find(objIdent->name);
                     if (typeIt != typedArrayTypes_.end()) {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: TypedArray property access: " << objIdent->name << "." << propertyName << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                        auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                        auto intType = HIRType::get(HIRType::Kind::I64);
 
                         std::string runtimeFunc;
                         HIRTypePtr returnType = intType;
@@ -1822,8 +1832,8 @@ void HIRGenerator::visit(MemberExpr& node) {
                     if (runtimeArrayVars_.count(objIdent->name) > 0 && propertyName == "length") {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Runtime array length access on " << objIdent->name << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                        auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                        auto intType = HIRType::get(HIRType::Kind::I64);
 
                         std::string runtimeFunc = "nova_value_array_length";
                         auto existingFunc = module_->getFunction(runtimeFunc);
@@ -1849,8 +1859,8 @@ void HIRGenerator::visit(MemberExpr& node) {
                     if (arrayBufferVars_.count(objIdent->name) > 0) {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: ArrayBuffer property access: " << objIdent->name << "." << propertyName << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                        auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                        auto intType = HIRType::get(HIRType::Kind::I64);
 
                         std::string runtimeFunc;
                         if (propertyName == "byteLength") {
@@ -1885,8 +1895,8 @@ void HIRGenerator::visit(MemberExpr& node) {
                     if (dataViewVars_.count(objIdent->name) > 0) {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: DataView property access: " << objIdent->name << "." << propertyName << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                        auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                        auto intType = HIRType::get(HIRType::Kind::I64);
 
                         std::string runtimeFunc;
                         HIRTypePtr returnType = intType;
@@ -1925,8 +1935,8 @@ void HIRGenerator::visit(MemberExpr& node) {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: DisposableStack property access: " << objIdent->name << "." << propertyName << std::endl;
 
                         if (propertyName == "disposed") {
-                            auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                            auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                            auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                            auto intType = HIRType::get(HIRType::Kind::I64);
 
                             std::vector<HIRTypePtr> paramTypes = {ptrType};
                             auto existingFunc = module_->getFunction("nova_disposablestack_get_disposed");
@@ -1952,8 +1962,8 @@ void HIRGenerator::visit(MemberExpr& node) {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: AsyncDisposableStack property access: " << objIdent->name << "." << propertyName << std::endl;
 
                         if (propertyName == "disposed") {
-                            auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                            auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                            auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                            auto intType = HIRType::get(HIRType::Kind::I64);
 
                             std::vector<HIRTypePtr> paramTypes = {ptrType};
                             auto existingFunc = module_->getFunction("nova_asyncdisposablestack_get_disposed");
@@ -1978,9 +1988,9 @@ void HIRGenerator::visit(MemberExpr& node) {
                     if (iteratorResultVars_.count(objIdent->name) > 0) {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: IteratorResult property access: " << objIdent->name << "." << propertyName << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                        auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
-                        auto boolType = std::make_shared<HIRType>(HIRType::Kind::Bool);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                        auto intType = HIRType::get(HIRType::Kind::I64);
+                        auto boolType = HIRType::get(HIRType::Kind::Bool);
 
                         if (propertyName == "value") {
                             std::vector<HIRTypePtr> paramTypes = {ptrType};
@@ -2027,7 +2037,7 @@ void HIRGenerator::visit(MemberExpr& node) {
                     if (errorVars_.count(objIdent->name) > 0) {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Error property access: " << objIdent->name << "." << propertyName << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
 
                         std::string runtimeFunc;
                         std::string returnTypeKind;  // empty = ptr, "jsvalue" = JSValue
@@ -2048,7 +2058,7 @@ void HIRGenerator::visit(MemberExpr& node) {
                             std::vector<HIRTypePtr> paramTypes = {ptrType};
                             HIRTypePtr retType = ptrType;
                             if (returnTypeKind == "jsvalue") {
-                                retType = std::make_shared<HIRType>(HIRType::Kind::JSValue);
+                                retType = HIRType::get(HIRType::Kind::JSValue);
                             }
                             auto existingFunc = module_->getFunction(runtimeFunc);
                             HIRFunction* func = nullptr;
@@ -2065,7 +2075,7 @@ void HIRGenerator::visit(MemberExpr& node) {
                             if (errorObject && errorObject->type &&
                                 errorObject->type->kind ==
                                     HIRType::Kind::JSValue) {
-                                auto jsValueType = std::make_shared<HIRType>(
+                                auto jsValueType = HIRType::get(
                                     HIRType::Kind::JSValue);
                                 auto existingUnbox = module_->getFunction(
                                     "nova_value_to_object");
@@ -2102,7 +2112,7 @@ void HIRGenerator::visit(MemberExpr& node) {
                     if (suppressedErrorVars_.count(objIdent->name) > 0) {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: SuppressedError property access: " << objIdent->name << "." << propertyName << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
 
                         std::string runtimeFunc;
                         if (propertyName == "error") {
@@ -2141,8 +2151,8 @@ void HIRGenerator::visit(MemberExpr& node) {
                     if (symbolVars_.count(objIdent->name) > 0) {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Symbol property access: " << objIdent->name << "." << propertyName << std::endl;
 
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                        auto strType = std::make_shared<HIRType>(HIRType::Kind::String);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                        auto strType = HIRType::get(HIRType::Kind::String);
 
                         if (propertyName == "description") {
                             std::vector<HIRTypePtr> paramTypes = {ptrType};
@@ -2166,14 +2176,14 @@ void HIRGenerator::visit(MemberExpr& node) {
                 }
 
                 // Check if this is Map property access (ES2015) - handle chained calls
-                if (auto* objIdent = dynamic_cast<Identifier*>(node.object.get())) {
+                if (auto* objIdent = ast_cast<Identifier>(node.object.get())) {
                     std::string mapCheckName = !setVarName.empty() ? setVarName : objIdent->name;
                     if (mapVars_.count(mapCheckName) > 0) {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Map property access: " << mapCheckName << "." << propertyName << std::endl;
 
                         if (propertyName == "size") {
-                            auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                            auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                            auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                            auto intType = HIRType::get(HIRType::Kind::I64);
 
                             std::vector<HIRTypePtr> paramTypes = {ptrType};
                             auto existingFunc = module_->getFunction("nova_map_size");
@@ -2204,14 +2214,14 @@ void HIRGenerator::visit(MemberExpr& node) {
                 }
 
                 // Check if this is Set property access (ES2015) - handle chained calls
-                if (auto* objIdent = dynamic_cast<Identifier*>(node.object.get())) {
+                if (auto* objIdent = ast_cast<Identifier>(node.object.get())) {
                     std::string setCheckName = !setVarName.empty() ? setVarName : objIdent->name;
                     if (setVars_.count(setCheckName) > 0) {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Set property access: " << setCheckName << "." << propertyName << std::endl;
 
                         if (propertyName == "size") {
-                            auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                            auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                            auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                            auto intType = HIRType::get(HIRType::Kind::I64);
 
                             std::vector<HIRTypePtr> paramTypes = {ptrType};
                             auto existingFunc = module_->getFunction("nova_set_size");
@@ -2241,14 +2251,14 @@ void HIRGenerator::visit(MemberExpr& node) {
                 }
 
                 // Check if this is WeakMap property access - handle chained calls
-                if (auto* objIdent = dynamic_cast<Identifier*>(node.object.get())) {
+                if (auto* objIdent = ast_cast<Identifier>(node.object.get())) {
                     std::string weakMapCheckName = !setVarName.empty() ? setVarName : objIdent->name;
                     if (weakMapVars_.count(weakMapCheckName) > 0) {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: WeakMap property access: " << weakMapCheckName << "." << propertyName << std::endl;
 
                         if (propertyName == "size") {
-                            auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                            auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                            auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                            auto intType = HIRType::get(HIRType::Kind::I64);
 
                             std::vector<HIRTypePtr> paramTypes = {ptrType};
                             auto existingFunc = module_->getFunction("nova_weakmap_size");
@@ -2276,14 +2286,14 @@ void HIRGenerator::visit(MemberExpr& node) {
                 }
 
                 // Check if this is WeakSet property access - handle chained calls
-                if (auto* objIdent = dynamic_cast<Identifier*>(node.object.get())) {
+                if (auto* objIdent = ast_cast<Identifier>(node.object.get())) {
                     std::string weakSetCheckName = !setVarName.empty() ? setVarName : objIdent->name;
                     if (weakSetVars_.count(weakSetCheckName) > 0) {
                         if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: WeakSet property access: " << weakSetCheckName << "." << propertyName << std::endl;
 
                         if (propertyName == "size") {
-                            auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                            auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                            auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                            auto intType = HIRType::get(HIRType::Kind::I64);
 
                             std::vector<HIRTypePtr> paramTypes = {ptrType};
                             auto existingFunc = module_->getFunction("nova_weakset_size");
@@ -2341,7 +2351,7 @@ void HIRGenerator::visit(MemberExpr& node) {
                 // Error subclass).  Recover the concrete declared class so
                 // own fields such as `custom.code` remain addressable.
                 if (auto* instanceIdentifier =
-                        dynamic_cast<Identifier*>(node.object.get())) {
+                        ast_cast<Identifier>(node.object.get())) {
                     auto classRef =
                         classReferences_.find(instanceIdentifier->name);
                     if (classRef != classReferences_.end()) {
@@ -2356,9 +2366,7 @@ void HIRGenerator::visit(MemberExpr& node) {
                             // make a derived field look out-of-bounds.
                             if (object) {
                                 object->type =
-                                    std::shared_ptr<HIRStructType>(
-                                        structType,
-                                        [](HIRStructType*) {});
+                                    unownedRef<HIRStructType>(structType);
                             }
                             for (size_t field = 0;
                                  field < structType->fields.size(); ++field) {
@@ -2368,10 +2376,10 @@ void HIRGenerator::visit(MemberExpr& node) {
                                         structType->fields[field].type->kind ==
                                             HIRType::Kind::Any) {
                                         auto pointerType =
-                                            std::make_shared<HIRType>(
+                                            HIRType::get(
                                                 HIRType::Kind::Pointer);
                                         auto integerType =
-                                            std::make_shared<HIRType>(
+                                            HIRType::get(
                                                 HIRType::Kind::I64);
                                         auto existing = module_->getFunction(
                                             "nova_class_get_field_i64");
@@ -2414,7 +2422,7 @@ void HIRGenerator::visit(MemberExpr& node) {
                                         structType->fields[field].type->kind ==
                                             HIRType::Kind::Any) {
                                         lastValue_->type =
-                                            std::make_shared<HIRType>(
+                                            HIRType::get(
                                                 HIRType::Kind::I64);
                                     }
                                     return;
@@ -2467,9 +2475,9 @@ void HIRGenerator::visit(MemberExpr& node) {
                     // route through nova_dynamic_object_get_tagged so the
                     // property is read at runtime regardless of how the caller
                     // constructed the object.
-                    auto jsValueType = std::make_shared<HIRType>(HIRType::Kind::JSValue);
-                    auto pointerType2 = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                    auto stringType2 = std::make_shared<HIRType>(HIRType::Kind::String);
+                    auto jsValueType = HIRType::get(HIRType::Kind::JSValue);
+                    auto pointerType2 = HIRType::get(HIRType::Kind::Pointer);
+                    auto stringType2 = HIRType::get(HIRType::Kind::String);
                     auto existingUnbox = module_->getFunction("nova_value_to_object");
                     HIRFunction* unbox = existingUnbox ? existingUnbox.get() : nullptr;
                     if (!unbox) {
@@ -2500,8 +2508,8 @@ void HIRGenerator::visit(MemberExpr& node) {
                     if (object && object->type &&
                         object->type->kind == hir::HIRType::Kind::JSValue &&
                         propertyName == "length") {
-                        auto jsValueType = std::make_shared<HIRType>(HIRType::Kind::JSValue);
-                        auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        auto jsValueType = HIRType::get(HIRType::Kind::JSValue);
+                        auto intType = HIRType::get(HIRType::Kind::I64);
                         auto existing = module_->getFunction("nova_value_length");
                         hir::HIRFunction* func = existing ? existing.get() : nullptr;
                         if (!func) {
@@ -2552,9 +2560,9 @@ void HIRGenerator::visit(MemberExpr& node) {
 
                                 // Create function type: i64 strlen(i8*)
                                 std::vector<HIRTypePtr> paramTypes;
-                                paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::String));
+                                paramTypes.push_back(HIRType::get(HIRType::Kind::String));
 
-                                HIRTypePtr retType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                                HIRTypePtr retType = HIRType::get(HIRType::Kind::I64);
                                 HIRFunctionType* funcType = new HIRFunctionType(paramTypes, retType);
 
                                 // Create function using module's createFunction
@@ -2608,7 +2616,7 @@ void HIRGenerator::visit(MemberExpr& node) {
                     } else {
                         // Check if this is a builtin object method access (e.g., emitter.on, readable.read)
                         bool foundBuiltinMethod = false;
-                        if (auto* objIdent = dynamic_cast<Identifier*>(node.object.get())) {
+                        if (auto* objIdent = ast_cast<Identifier>(node.object.get())) {
                             auto typeIt = variableObjectTypes_.find(objIdent->name);
                             if (typeIt != variableObjectTypes_.end()) {
                                 std::string objectType = typeIt->second;  // e.g., "events:EventEmitter"
@@ -2665,14 +2673,14 @@ void HIRGenerator::visit(ObjectExpr& node) {
             protocolObject = protocolObject || property.isComputed;
             std::string propertyName;
             if (auto* identifier =
-                    dynamic_cast<Identifier*>(property.key.get())) {
+                    ast_cast<Identifier>(property.key.get())) {
                 propertyName = identifier->name;
             } else if (auto* member =
-                           dynamic_cast<MemberExpr*>(property.key.get())) {
+                           ast_cast<MemberExpr>(property.key.get())) {
                 auto* base =
-                    dynamic_cast<Identifier*>(member->object.get());
+                    ast_cast<Identifier>(member->object.get());
                 auto* key =
-                    dynamic_cast<Identifier*>(member->property.get());
+                    ast_cast<Identifier>(member->property.get());
                 if (base && key && base->name == "Symbol" &&
                     key->name == "iterator") {
                     protocolObject = true;
@@ -2714,17 +2722,17 @@ void HIRGenerator::visit(ObjectExpr& node) {
 
             // Get the property name from the key
             std::string fieldName = "field" + std::to_string(i);
-            if (auto identifier = dynamic_cast<Identifier*>(prop.key.get())) {
+            if (auto identifier = ast_cast<Identifier>(prop.key.get())) {
                 fieldName = identifier->name;
             }
 
             // Check if this property is a method
             bool isMethod = (prop.kind == ObjectExpr::Property::Kind::Method) ||
-                           dynamic_cast<FunctionExpr*>(prop.value.get()) != nullptr;
+                           ast_cast<FunctionExpr>(prop.value.get()) != nullptr;
 
             if (isMethod) {
                 // Store method for later generation (after struct type is created)
-                auto* funcExpr = dynamic_cast<FunctionExpr*>(prop.value.get());
+                auto* funcExpr = ast_cast<FunctionExpr>(prop.value.get());
                 if (funcExpr) {
                     methodsToGenerate.push_back({fieldName, funcExpr});
                 }
@@ -2767,11 +2775,11 @@ void HIRGenerator::visit(ObjectExpr& node) {
 
                 // Remaining parameters from method signature
                 for (size_t j = 0; j < funcExpr->params.size(); ++j) {
-                    paramTypes.push_back(std::make_shared<HIRType>(HIRType::Kind::Any));
+                    paramTypes.push_back(HIRType::get(HIRType::Kind::Any));
                 }
 
                 // Return type
-                auto retType = std::make_shared<HIRType>(HIRType::Kind::Any);
+                auto retType = HIRType::get(HIRType::Kind::Any);
                 auto funcType = new HIRFunctionType(paramTypes, retType);
 
                 // Create function
@@ -8,7 +8,7 @@
 namespace nova::hir {
 
 HIRValue* HIRGenerator::toJSValue(HIRValue* value) {
-        auto jsType = std::make_shared<HIRType>(HIRType::Kind::JSValue);
+        auto jsType = HIRType::get(HIRType::Kind::JSValue);
         if (!value || !value->type) {
             return new HIRConstant(jsType, HIRConstant::Kind::Integer,
                 static_cast<int64_t>(0x7ff9000000000000ULL));
@@ -40,7 +40,7 @@ HIRValue* HIRGenerator::toJSValue(HIRValue* value) {
             case HIRType::Kind::Function:
             case HIRType::Kind::Closure:
                 functionName = "nova_value_from_object";
-                parameterType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                parameterType = HIRType::get(HIRType::Kind::Pointer);
                 break;
             default: functionName = "nova_value_from_i64"; break;
         }
@@ -111,8 +111,8 @@ HIRValue* HIRGenerator::toBoolean(HIRValue* value) {
                 return builder_->createNe(
                     value, builder_->createStringConstant(""), "tobool.string");
             case Kind::JSValue: {
-                auto jsType = std::make_shared<HIRType>(Kind::JSValue);
-                auto intType = std::make_shared<HIRType>(Kind::I64);
+                auto jsType = HIRType::get(Kind::JSValue);
+                auto intType = HIRType::get(Kind::I64);
                 auto existing = module_->getFunction("nova_value_to_boolean");
                 HIRFunction* function = existing ? existing.get() : nullptr;
                 if (!function) {
@@ -153,21 +153,21 @@ void HIRGenerator::visit(BinaryExpr& node) {
         // Handle instanceof operator - resolve statically when possible
         if (node.op == Op::Instanceof) {
             std::string rhsClassName;
-            if (auto* rhsIdent = dynamic_cast<Identifier*>(node.right.get())) {
+            if (auto* rhsIdent = ast_cast<Identifier>(node.right.get())) {
                 rhsClassName = rhsIdent->name;
             }
 
             // Try to determine left side's class statically
             std::string lhsClassName;
             // Case 1: lhs is `new ClassName(...)` - inspect AST directly
-            if (auto* lhsNew = dynamic_cast<NewExpr*>(node.left.get())) {
-                if (auto* id = dynamic_cast<Identifier*>(lhsNew->callee.get())) {
+            if (auto* lhsNew = ast_cast<NewExpr>(node.left.get())) {
+                if (auto* id = ast_cast<Identifier>(lhsNew->callee.get())) {
                     lhsClassName = id->name;
                 }
             }
             // Case 2: lhs is an Identifier - look up classReferences_ and variableKinds_
             if (lhsClassName.empty()) {
-                if (auto* lhsIdent = dynamic_cast<Identifier*>(node.left.get())) {
+                if (auto* lhsIdent = ast_cast<Identifier>(node.left.get())) {
                     auto it = classReferences_.find(lhsIdent->name);
                     if (it != classReferences_.end()) {
                         lhsClassName = it->second;
@@ -182,26 +182,26 @@ void HIRGenerator::visit(BinaryExpr& node) {
             }
             // Case 3: lhs is an Array literal -> Array
             if (lhsClassName.empty()) {
-                if (dynamic_cast<ArrayExpr*>(node.left.get())) {
+                if (ast_cast<ArrayExpr>(node.left.get())) {
                     lhsClassName = "Array";
                 }
             }
             // Case 4: lhs is an Object literal -> Object
             if (lhsClassName.empty()) {
-                if (dynamic_cast<ObjectExpr*>(node.left.get())) {
+                if (ast_cast<ObjectExpr>(node.left.get())) {
                     lhsClassName = "Object";
                 }
             }
             // Case 5: lhs is a Function/ArrowFunction -> Function
             if (lhsClassName.empty()) {
-                if (dynamic_cast<ArrowFunctionExpr*>(node.left.get()) ||
-                    dynamic_cast<FunctionExpr*>(node.left.get())) {
+                if (ast_cast<ArrowFunctionExpr>(node.left.get()) ||
+                    ast_cast<FunctionExpr>(node.left.get())) {
                     lhsClassName = "Function";
                 }
             }
             // Case 6: function references via identifier
             if (lhsClassName.empty()) {
-                if (auto* lhsIdent = dynamic_cast<Identifier*>(node.left.get())) {
+                if (auto* lhsIdent = ast_cast<Identifier>(node.left.get())) {
                     if (functionReferences_.count(lhsIdent->name)) {
                         lhsClassName = "Function";
                     }
@@ -250,8 +250,8 @@ void HIRGenerator::visit(BinaryExpr& node) {
             // compile time and emit one runtime comparison per candidate name
             // (the RHS plus each known ancestor), OR-ed together.
             if (lhsClassName.empty() && !rhsClassName.empty()) {
-                auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                auto intType = HIRType::get(HIRType::Kind::I64);
 
                 // First, when RHS is a builtin Error subclass, evaluate LHS
                 // to a pointer and dispatch to the matching nova_is_<type>
@@ -284,7 +284,7 @@ void HIRGenerator::visit(BinaryExpr& node) {
                         auto existingUnbox = module_->getFunction("nova_value_to_object");
                         HIRFunction* unbox = existingUnbox ? existingUnbox.get() : nullptr;
                         if (!unbox) {
-                            auto jsValueType = std::make_shared<HIRType>(HIRType::Kind::JSValue);
+                            auto jsValueType = HIRType::get(HIRType::Kind::JSValue);
                             auto* type = new HIRFunctionType({jsValueType}, ptrType);
                             auto created = module_->createFunction("nova_value_to_object", type);
                             created->linkage = HIRFunction::Linkage::External;
@@ -436,15 +436,15 @@ void HIRGenerator::visit(BinaryExpr& node) {
             node.right->accept(*this);
             HIRValue* obj = lastValue_;
 
-            auto pointerType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-            auto stringType = std::make_shared<HIRType>(HIRType::Kind::String);
-            auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+            auto pointerType = HIRType::get(HIRType::Kind::Pointer);
+            auto stringType = HIRType::get(HIRType::Kind::String);
+            auto intType = HIRType::get(HIRType::Kind::I64);
 
             // Coerce key to string if needed.
             if (key && key->type && key->type->kind != HIRType::Kind::String) {
                 // For JSValue keys, unbox to a C string via nova_value_to_string_ptr.
                 if (key->type->kind == HIRType::Kind::JSValue) {
-                    auto jsValueType = std::make_shared<HIRType>(HIRType::Kind::JSValue);
+                    auto jsValueType = HIRType::get(HIRType::Kind::JSValue);
                     auto existing = module_->getFunction("nova_value_to_string_ptr");
                     HIRFunction* fn = existing ? existing.get() : nullptr;
                     if (!fn) {
@@ -481,7 +481,7 @@ void HIRGenerator::visit(BinaryExpr& node) {
 
             // Coerce object to pointer.
             if (obj && obj->type && obj->type->kind == HIRType::Kind::JSValue) {
-                auto jsValueType = std::make_shared<HIRType>(HIRType::Kind::JSValue);
+                auto jsValueType = HIRType::get(HIRType::Kind::JSValue);
                 auto existingUnbox = module_->getFunction("nova_value_to_object");
                 HIRFunction* unbox = existingUnbox ? existingUnbox.get() : nullptr;
                 if (!unbox) {
@@ -558,8 +558,8 @@ void HIRGenerator::visit(BinaryExpr& node) {
             node.left->accept(*this);
             auto* lhs = lastValue_;
             if (lhs && lhs->type && lhs->type->kind == HIRType::Kind::JSValue) {
-                auto jsType = std::make_shared<HIRType>(HIRType::Kind::JSValue);
-                auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                auto jsType = HIRType::get(HIRType::Kind::JSValue);
+                auto intType = HIRType::get(HIRType::Kind::I64);
                 auto existing = module_->getFunction("nova_value_is_nullish");
                 HIRFunction* function = existing ? existing.get() : nullptr;
                 if (!function) {
@@ -612,8 +612,8 @@ void HIRGenerator::visit(BinaryExpr& node) {
         lastWasBigInt_ = false;
 
         if (lhsIsBigInt && rhsIsBigInt) {
-            auto pointerType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-            auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+            auto pointerType = HIRType::get(HIRType::Kind::Pointer);
+            auto intType = HIRType::get(HIRType::Kind::I64);
             if (node.op == Op::LeftShift || node.op == Op::RightShift) {
                 auto convertExisting = module_->getFunction("nova_bigint_toInt64");
                 HIRFunction* convert = convertExisting ? convertExisting.get() : nullptr;
@@ -712,8 +712,8 @@ void HIRGenerator::visit(BinaryExpr& node) {
             node.op == Op::LessEqual || node.op == Op::Greater ||
             node.op == Op::GreaterEqual;
         if (hasJSValueOperand || (bothStringOperands && relationalOperator)) {
-            auto jsType = std::make_shared<HIRType>(HIRType::Kind::JSValue);
-            auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+            auto jsType = HIRType::get(HIRType::Kind::JSValue);
+            auto intType = HIRType::get(HIRType::Kind::I64);
             const auto emitCall = [&](const std::string& functionName,
                                       std::vector<HIRTypePtr> parameters,
                                       HIRTypePtr resultType,
@@ -779,7 +779,7 @@ void HIRGenerator::visit(BinaryExpr& node) {
             if (value && value->type && value->type->kind == HIRType::Kind::Bool) {
                 // Convert boolean to integer: true -> 1, false -> 0
                 // Use ZExt (zero extension) to convert i1 to i64
-                auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                auto intType = HIRType::get(HIRType::Kind::I64);
                 return builder_->createCast(value, intType.get());
             }
             return value;
@@ -827,9 +827,9 @@ void HIRGenerator::visit(BinaryExpr& node) {
             HIRFunction* fn = existing ? existing.get() : nullptr;
             if (!fn) return value;
 
-            auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+            auto ptrType = HIRType::get(HIRType::Kind::Pointer);
             std::vector<HIRTypePtr> paramVec = {ptrType};
-            auto retType = std::make_shared<HIRType>(HIRType::Kind::Any);
+            auto retType = HIRType::get(HIRType::Kind::Any);
             HIRFunctionType* fnType = new HIRFunctionType(paramVec, retType);
             HIRFunctionPtr created = module_->createFunction(methodName, fnType);
             created->linkage = HIRFunction::Linkage::External;
@@ -968,8 +968,8 @@ void HIRGenerator::visit(BinaryExpr& node) {
                 };
                 const auto emitIdentityEquality = [this](HIRValue* left,
                                                          HIRValue* right) -> HIRValue* {
-                    auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                    auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                    auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                    auto intType = HIRType::get(HIRType::Kind::I64);
                     auto existing = module_->getFunction("nova_object_is_identity");
                     HIRFunction* identity = existing ? existing.get() : nullptr;
                     if (!identity) {
@@ -985,9 +985,9 @@ void HIRGenerator::visit(BinaryExpr& node) {
                 };
                 const auto emitNumberStringEquality = [this](
                     HIRValue* number, HIRValue* string) -> HIRValue* {
-                    auto floatType = std::make_shared<HIRType>(HIRType::Kind::F64);
-                    auto stringType = std::make_shared<HIRType>(HIRType::Kind::String);
-                    auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                    auto floatType = HIRType::get(HIRType::Kind::F64);
+                    auto stringType = HIRType::get(HIRType::Kind::String);
+                    auto intType = HIRType::get(HIRType::Kind::I64);
                     auto existing = module_->getFunction(
                         "nova_abstract_equal_number_string");
                     HIRFunction* function = existing ? existing.get() : nullptr;
@@ -1008,8 +1008,8 @@ void HIRGenerator::visit(BinaryExpr& node) {
                     (lhs->type->kind == HIRType::Kind::JSValue ||
                      rhs->type->kind == HIRType::Kind::JSValue);
                 if (hasJSValue) {
-                    auto jsType = std::make_shared<HIRType>(HIRType::Kind::JSValue);
-                    auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                    auto jsType = HIRType::get(HIRType::Kind::JSValue);
+                    auto intType = HIRType::get(HIRType::Kind::I64);
                     const std::string functionName = strict
                         ? "nova_value_strict_equal" : "nova_value_abstract_equal";
                     auto existing = module_->getFunction(functionName);
@@ -1122,8 +1122,8 @@ void HIRGenerator::visit(BinaryExpr& node) {
                                lhs->type->kind != rhs->type->kind) {
                         // Mixed String/Pointer kinds: route through runtime
                         // string equality instead of constant-folding.
-                        auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                        auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                        auto intType = HIRType::get(HIRType::Kind::I64);
                         auto existing = module_->getFunction("nova_string_equals");
                         HIRFunction* strEq = existing ? existing.get() : nullptr;
                         if (!strEq) {
@@ -1170,8 +1170,8 @@ void HIRGenerator::visit(BinaryExpr& node) {
                         const bool rhsOpaque = isRealPtr(rhs->type->kind) ||
                             (rhs->type->kind == HIRType::Kind::I64 && isOpaqueBits(rhs));
                         if (lhsOpaque || rhsOpaque) {
-                            auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                            auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                            auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                            auto intType = HIRType::get(HIRType::Kind::I64);
                             auto existing = module_->getFunction("nova_string_equals");
                             HIRFunction* strEq = existing ? existing.get() : nullptr;
                             if (!strEq) {
@@ -1220,7 +1220,7 @@ void HIRGenerator::visit(BinaryExpr& node) {
                                 kind == HIRType::Kind::Any;
                         };
                         if (isIntOrPtr(lhs->type->kind) && isIntOrPtr(rhs->type->kind)) {
-                            auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                            auto intType = HIRType::get(HIRType::Kind::I64);
                             auto lhsI = lhs;
                             auto rhsI = rhs;
                             if (lhs->type->kind != HIRType::Kind::I64) {
@@ -1240,8 +1240,8 @@ void HIRGenerator::visit(BinaryExpr& node) {
                             // rather than by pointer. JS `===` semantics require
                             // "foo" === "foo" to be true even when the runtime
                             // allocates them at distinct addresses.
-                            auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                            auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                            auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                            auto intType = HIRType::get(HIRType::Kind::I64);
                             auto existing = module_->getFunction("nova_string_equals");
                             HIRFunction* strEq = existing ? existing.get() : nullptr;
                             if (!strEq) {
@@ -1267,12 +1267,12 @@ void HIRGenerator::visit(BinaryExpr& node) {
                     auto rhsKind = abstractRhs->type->kind;
 
                     if (lhsKind == HIRType::Kind::Bool) {
-                        auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        auto intType = HIRType::get(HIRType::Kind::I64);
                         abstractLhs = builder_->createCast(abstractLhs, intType.get());
                         lhsKind = HIRType::Kind::I64;
                     }
                     if (rhsKind == HIRType::Kind::Bool) {
-                        auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        auto intType = HIRType::get(HIRType::Kind::I64);
                         abstractRhs = builder_->createCast(abstractRhs, intType.get());
                         rhsKind = HIRType::Kind::I64;
                     }
@@ -1354,10 +1354,10 @@ void HIRGenerator::visit(UnaryExpr& node) {
         // returning false in strict mode semantics (we accept silent refusal
         // here since Nova codegen doesn't currently distinguish strict mode).
         if (node.op == Op::Delete) {
-            auto* member = dynamic_cast<MemberExpr*>(node.operand.get());
+            auto* member = ast_cast<MemberExpr>(node.operand.get());
             if (member) {
                 std::string objectVariableName;
-                if (auto* objIdent = dynamic_cast<Identifier*>(member->object.get())) {
+                if (auto* objIdent = ast_cast<Identifier>(member->object.get())) {
                     objectVariableName = objIdent->name;
                 }
                 bool dynamicTypedObject = false;
@@ -1387,7 +1387,7 @@ void HIRGenerator::visit(UnaryExpr& node) {
                 }
                 if (!dynamicTypedObject && member->isComputed) {
                     if (auto* keyIdentifier =
-                            dynamic_cast<Identifier*>(
+                            ast_cast<Identifier>(
                                 member->property.get())) {
                         if (auto* keyBinding =
                                 lookupVariable(keyIdentifier->name);
@@ -1400,7 +1400,7 @@ void HIRGenerator::visit(UnaryExpr& node) {
                                 keyBinding->type->kind ==
                                     HIRType::Kind::Any;
                         }
-                    } else if (dynamic_cast<StringLiteral*>(
+                    } else if (ast_cast<StringLiteral>(
                                    member->property.get())) {
                         dynamicTypedObject = true;
                     }
@@ -1408,7 +1408,7 @@ void HIRGenerator::visit(UnaryExpr& node) {
                 bool intrinsicObject = false;
                 std::string intrinsicObjectPath;
                 if (auto* directIntrinsic =
-                        dynamic_cast<Identifier*>(member->object.get());
+                        ast_cast<Identifier>(member->object.get());
                     directIntrinsic &&
                     (directIntrinsic->name == "Date" ||
                      directIntrinsic->name == "RegExp")) {
@@ -1416,10 +1416,10 @@ void HIRGenerator::visit(UnaryExpr& node) {
                     intrinsicObjectPath = directIntrinsic->name;
                 }
                 if (auto* intrinsicMember =
-                        dynamic_cast<MemberExpr*>(member->object.get())) {
-                    auto* base = dynamic_cast<Identifier*>(
+                        ast_cast<MemberExpr>(member->object.get())) {
+                    auto* base = ast_cast<Identifier>(
                         intrinsicMember->object.get());
-                    auto* property = dynamic_cast<Identifier*>(
+                    auto* property = ast_cast<Identifier>(
                         intrinsicMember->property.get());
                     intrinsicObject =
                         !intrinsicMember->isComputed && base && property &&
@@ -1436,11 +1436,11 @@ void HIRGenerator::visit(UnaryExpr& node) {
                      dynamicObjectVars_.count(objectVariableName) > 0)) {
                     std::string propertyName;
                     if (!member->isComputed) {
-                    if (auto* propIdent = dynamic_cast<Identifier*>(member->property.get())) {
+                    if (auto* propIdent = ast_cast<Identifier>(member->property.get())) {
                         propertyName = propIdent->name;
-                    } else if (auto* propStr = dynamic_cast<StringLiteral*>(member->property.get())) {
+                    } else if (auto* propStr = ast_cast<StringLiteral>(member->property.get())) {
                         propertyName = propStr->value;
-                    } else if (auto* propNum = dynamic_cast<NumberLiteral*>(member->property.get())) {
+                    } else if (auto* propNum = ast_cast<NumberLiteral>(member->property.get())) {
                         propertyName = std::to_string(propNum->value);
                     }
                     }
@@ -1448,11 +1448,11 @@ void HIRGenerator::visit(UnaryExpr& node) {
                     if (!propertyName.empty() || member->isComputed) {
                         auto pointerType =
                             std::make_shared<HIRPointerType>(
-                                std::make_shared<HIRType>(
+                                HIRType::get(
                                     HIRType::Kind::Any),
                                 true);
-                        auto stringType = std::make_shared<HIRType>(HIRType::Kind::String);
-                        auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        auto stringType = HIRType::get(HIRType::Kind::String);
+                        auto intType = HIRType::get(HIRType::Kind::I64);
                         HIRValue* objectValue = nullptr;
                         if (!intrinsicObjectPath.empty()) {
                             HIRFunction* getter = nullptr;
@@ -1481,7 +1481,7 @@ void HIRGenerator::visit(UnaryExpr& node) {
 
                         if (objectValue && objectValue->type &&
                             objectValue->type->kind == HIRType::Kind::JSValue) {
-                            auto jsValueType = std::make_shared<HIRType>(HIRType::Kind::JSValue);
+                            auto jsValueType = HIRType::get(HIRType::Kind::JSValue);
                             auto existingUnbox = module_->getFunction("nova_value_to_object");
                             HIRFunction* unbox = existingUnbox ? existingUnbox.get() : nullptr;
                             if (!unbox) {
@@ -1506,7 +1506,7 @@ void HIRGenerator::visit(UnaryExpr& node) {
                                 keyValue->type->kind ==
                                     HIRType::Kind::JSValue) {
                                 auto jsValueType =
-                                    std::make_shared<HIRType>(
+                                    HIRType::get(
                                         HIRType::Kind::JSValue);
                                 HIRFunction* toString = nullptr;
                                 if (auto existing =
@@ -1584,7 +1584,7 @@ void HIRGenerator::visit(UnaryExpr& node) {
         lastWasSymbol_ = false;
         if (operandIsBigInt &&
             (node.op == Op::Minus || node.op == Op::BitNot)) {
-            auto pointerType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+            auto pointerType = HIRType::get(HIRType::Kind::Pointer);
             const std::string functionName = node.op == Op::Minus
                 ? "nova_bigint_unary_minus" : "nova_bigint_not";
             auto existing = module_->getFunction(functionName);
@@ -1603,8 +1603,8 @@ void HIRGenerator::visit(UnaryExpr& node) {
         }
         if (operand && operand->type && operand->type->kind == HIRType::Kind::JSValue &&
             (node.op == Op::Plus || node.op == Op::Minus || node.op == Op::BitNot)) {
-            auto jsType = std::make_shared<HIRType>(HIRType::Kind::JSValue);
-            auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+            auto jsType = HIRType::get(HIRType::Kind::JSValue);
+            auto intType = HIRType::get(HIRType::Kind::I64);
             auto existing = module_->getFunction("nova_value_unary_numeric");
             HIRFunction* function = existing ? existing.get() : nullptr;
             if (!function) {
@@ -1658,10 +1658,10 @@ void HIRGenerator::visit(UnaryExpr& node) {
                     // Special case: typeof of `resolvers.resolve` / `resolvers.reject`
                     // where `resolvers` is the result of Promise.withResolvers().
                     // Those properties are callable functions per spec.
-                    if (auto* member = dynamic_cast<MemberExpr*>(node.operand.get())) {
-                        if (auto* objIdent = dynamic_cast<Identifier*>(member->object.get())) {
+                    if (auto* member = ast_cast<MemberExpr>(node.operand.get())) {
+                        if (auto* objIdent = ast_cast<Identifier>(member->object.get())) {
                             if (promiseWithResolversVars_.count(objIdent->name) > 0) {
-                                if (auto* propIdent = dynamic_cast<Identifier*>(member->property.get())) {
+                                if (auto* propIdent = ast_cast<Identifier>(member->property.get())) {
                                     if (propIdent->name == "resolve" || propIdent->name == "reject") {
                                         typeStr = "function";
                                     }
@@ -1676,8 +1676,8 @@ void HIRGenerator::visit(UnaryExpr& node) {
                     // visit(ArrowFunctionExpr&) / visit(FunctionExpr&) in
                     // HIRGen_Functions.cpp). Detect that here so
                     // `typeof (() => 1) === "function"` works.
-                    if (dynamic_cast<ArrowFunctionExpr*>(node.operand.get()) ||
-                        dynamic_cast<FunctionExpr*>(node.operand.get())) {
+                    if (ast_cast<ArrowFunctionExpr>(node.operand.get()) ||
+                        ast_cast<FunctionExpr>(node.operand.get())) {
                         typeStr = "function";
                     }
 
@@ -1699,10 +1699,10 @@ void HIRGenerator::visit(UnaryExpr& node) {
                         operand->type->kind ==
                             HIRType::Kind::JSValue) {
                         auto jsValueType =
-                            std::make_shared<HIRType>(
+                            HIRType::get(
                                 HIRType::Kind::JSValue);
                         auto stringType =
-                            std::make_shared<HIRType>(
+                            HIRType::get(
                                 HIRType::Kind::String);
                         HIRFunction* typeOf = nullptr;
                         if (auto existing =
@@ -1797,8 +1797,8 @@ void HIRGenerator::visit(UnaryExpr& node) {
 void HIRGenerator::visit(UpdateExpr& node) {
         // Increment/Decrement operators: ++x, x++, --x, x--
         // Supports identifiers AND member access (obj.field, obj[field]).
-        auto* identifier = dynamic_cast<Identifier*>(node.argument.get());
-        auto* member = dynamic_cast<MemberExpr*>(node.argument.get());
+        auto* identifier = ast_cast<Identifier>(node.argument.get());
+        auto* member = ast_cast<MemberExpr>(node.argument.get());
 
         HIRValue* varAlloca = nullptr;
         HIRValue* objectAlloca = nullptr;
@@ -1819,7 +1819,7 @@ void HIRGenerator::visit(UpdateExpr& node) {
                      builder_->createIntConstant(generatorSlot)},
                     identifier->name + ".generator.update");
                 currentValue->type =
-                    std::make_shared<HIRType>(HIRType::Kind::I64);
+                    HIRType::get(HIRType::Kind::I64);
             }
             // Get the variable's current value (with closure support)
             if (generatorSlot < 0) {
@@ -1861,7 +1861,7 @@ void HIRGenerator::visit(UpdateExpr& node) {
         const std::string identName = identifier ? identifier->name : std::string();
 
         if (identifier && bigIntVars_.count(identifier->name) > 0) {
-            auto pointerType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+            auto pointerType = HIRType::get(HIRType::Kind::Pointer);
             const std::string functionName =
                 node.op == UpdateExpr::Op::Increment
                     ? "nova_bigint_inc" : "nova_bigint_dec";
@@ -1890,7 +1890,7 @@ void HIRGenerator::visit(UpdateExpr& node) {
         HIRValue* newValue;
         if (currentValue && currentValue->type &&
             currentValue->type->kind == HIRType::Kind::JSValue) {
-            auto jsType = std::make_shared<HIRType>(HIRType::Kind::JSValue);
+            auto jsType = HIRType::get(HIRType::Kind::JSValue);
             const bool increment = node.op == UpdateExpr::Op::Increment;
             const std::string functionName = increment
                 ? "nova_value_add" : "nova_value_binary_numeric";
@@ -1900,7 +1900,7 @@ void HIRGenerator::visit(UpdateExpr& node) {
                 std::vector<HIRTypePtr> parameters = {jsType, jsType};
                 if (!increment) {
                     parameters.push_back(
-                        std::make_shared<HIRType>(HIRType::Kind::I64));
+                        HIRType::get(HIRType::Kind::I64));
                 }
                 HIRFunctionType* functionType = new HIRFunctionType(
                     parameters, jsType);
@@ -1934,7 +1934,7 @@ void HIRGenerator::visit(UpdateExpr& node) {
             // For member access, look up the field index in the current
             // class struct (handles `this.field` and `obj.field` when obj
             // is the current `this`).
-            auto* memberIdent = dynamic_cast<Identifier*>(member->property.get());
+            auto* memberIdent = ast_cast<Identifier>(member->property.get());
             if (memberIdent && !member->isComputed && currentClassStructType_) {
                 int fieldIdx = -1;
                 for (size_t i = 0; i < currentClassStructType_->fields.size(); ++i) {
@@ -2088,8 +2088,8 @@ void HIRGenerator::visit(AssignmentExpr& node) {
             } else {
                 if (leftValue && leftValue->type &&
                     leftValue->type->kind == HIRType::Kind::JSValue) {
-                    auto jsType = std::make_shared<HIRType>(HIRType::Kind::JSValue);
-                    auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                    auto jsType = HIRType::get(HIRType::Kind::JSValue);
+                    auto intType = HIRType::get(HIRType::Kind::I64);
                     auto existing = module_->getFunction("nova_value_is_nullish");
                     HIRFunction* function = existing ? existing.get() : nullptr;
                     if (!function) {
@@ -2154,13 +2154,13 @@ void HIRGenerator::visit(AssignmentExpr& node) {
                 node.left->accept(*this);
                 auto leftValue = lastValue_;
 
-                auto* leftIdentifier = dynamic_cast<Identifier*>(node.left.get());
+                auto* leftIdentifier = ast_cast<Identifier>(node.left.get());
                 const bool leftIsBigInt = leftIdentifier &&
                     bigIntVars_.count(leftIdentifier->name) > 0;
 
                 if (leftIsBigInt && rightIsBigInt) {
-                    auto pointerType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                    auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                    auto pointerType = HIRType::get(HIRType::Kind::Pointer);
+                    auto intType = HIRType::get(HIRType::Kind::I64);
                     std::string functionName;
                     switch (node.op) {
                         case AssignmentExpr::Op::AddAssign:
@@ -2235,7 +2235,7 @@ void HIRGenerator::visit(AssignmentExpr& node) {
                     // The BigInt operation above already produced finalValue.
                 } else if (leftValue && leftValue->type &&
                     leftValue->type->kind == HIRType::Kind::JSValue) {
-                    auto jsType = std::make_shared<HIRType>(HIRType::Kind::JSValue);
+                    auto jsType = HIRType::get(HIRType::Kind::JSValue);
                     if (node.op == AssignmentExpr::Op::AddAssign) {
                         auto existing = module_->getFunction("nova_value_add");
                         HIRFunction* function = existing ? existing.get() : nullptr;
@@ -2265,7 +2265,7 @@ void HIRGenerator::visit(AssignmentExpr& node) {
                             case AssignmentExpr::Op::UnsignedRightShiftAssign: operation = 10; break;
                             default: break;
                         }
-                        auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                        auto intType = HIRType::get(HIRType::Kind::I64);
                         auto existing = module_->getFunction("nova_value_binary_numeric");
                         HIRFunction* function = existing ? existing.get() : nullptr;
                         if (!function) {
@@ -2327,7 +2327,7 @@ void HIRGenerator::visit(AssignmentExpr& node) {
         }
 
         // Store to left side
-        if (auto* id = dynamic_cast<Identifier*>(node.left.get())) {
+        if (auto* id = ast_cast<Identifier>(node.left.get())) {
             auto generatorSlotIt = generatorVarSlots_.find(id->name);
             if (currentGeneratorPtr_ && generatorStoreLocalFunc_ &&
                 generatorSlotIt != generatorVarSlots_.end()) {
@@ -2374,7 +2374,7 @@ void HIRGenerator::visit(AssignmentExpr& node) {
                         pointerType && pointerType->pointeeType && value && value->type) {
                         if (pointerType->pointeeType->kind != HIRType::Kind::JSValue &&
                             pointerType->pointeeType->kind != value->type->kind) {
-                            pointerType->pointeeType = std::make_shared<HIRType>(
+                            pointerType->pointeeType = HIRType::get(
                                 HIRType::Kind::JSValue);
                         }
                         if (pointerType->pointeeType->kind == HIRType::Kind::JSValue) {
@@ -2399,17 +2399,17 @@ void HIRGenerator::visit(AssignmentExpr& node) {
             } else {
                 staticNullishVariables_.erase(id->name);
             }
-        } else if (auto* memberExpr = dynamic_cast<MemberExpr*>(node.left.get())) {
+        } else if (auto* memberExpr = ast_cast<MemberExpr>(node.left.get())) {
             std::string objectVariableName;
             bool explicitlyDynamicObject = false;
             Expr* assignmentObject = memberExpr->object.get();
-            if (auto* assertion = dynamic_cast<AsExpr*>(assignmentObject)) {
+            if (auto* assertion = ast_cast<AsExpr>(assignmentObject)) {
                 explicitlyDynamicObject = assertion->targetType &&
                     assertion->targetType->kind == Type::Kind::Any;
                 assignmentObject = assertion->expression.get();
             }
             if (auto* objectIdentifier =
-                    dynamic_cast<Identifier*>(assignmentObject)) {
+                    ast_cast<Identifier>(assignmentObject)) {
                 objectVariableName = objectIdentifier->name;
                 if (auto* binding =
                         lookupVariable(objectVariableName);
@@ -2437,7 +2437,7 @@ void HIRGenerator::visit(AssignmentExpr& node) {
             }
             if (!explicitlyDynamicObject && memberExpr->isComputed) {
                 if (auto* keyIdentifier =
-                        dynamic_cast<Identifier*>(
+                        ast_cast<Identifier>(
                             memberExpr->property.get())) {
                     if (auto* keyBinding =
                             lookupVariable(keyIdentifier->name);
@@ -2450,7 +2450,7 @@ void HIRGenerator::visit(AssignmentExpr& node) {
                             keyBinding->type->kind ==
                                 HIRType::Kind::Any;
                     }
-                } else if (dynamic_cast<StringLiteral*>(
+                } else if (ast_cast<StringLiteral>(
                                memberExpr->property.get())) {
                     explicitlyDynamicObject = true;
                 }
@@ -2458,16 +2458,16 @@ void HIRGenerator::visit(AssignmentExpr& node) {
 
             if (!memberExpr->isComputed &&
                 regexVars_.count(objectVariableName) > 0) {
-                auto* property = dynamic_cast<Identifier*>(
+                auto* property = ast_cast<Identifier>(
                     memberExpr->property.get());
                 if (property && property->name == "lastIndex") {
                     memberExpr->object->accept(*this);
                     HIRValue* regex = lastValue_;
-                    auto pointerType = std::make_shared<HIRType>(
+                    auto pointerType = HIRType::get(
                         HIRType::Kind::Pointer);
-                    auto integerType = std::make_shared<HIRType>(
+                    auto integerType = HIRType::get(
                         HIRType::Kind::I64);
-                    auto voidType = std::make_shared<HIRType>(
+                    auto voidType = HIRType::get(
                         HIRType::Kind::Void);
                     HIRValue* index = value;
                     if (index && index->type &&
@@ -2505,11 +2505,11 @@ void HIRGenerator::visit(AssignmentExpr& node) {
                  dynamicObjectVars_.count(objectVariableName) > 0)) {
                 std::string propertyName;
                 if (!memberExpr->isComputed) {
-                    if (auto* propIdent = dynamic_cast<Identifier*>(memberExpr->property.get())) {
+                    if (auto* propIdent = ast_cast<Identifier>(memberExpr->property.get())) {
                         propertyName = propIdent->name;
-                    } else if (auto* propStr = dynamic_cast<StringLiteral*>(memberExpr->property.get())) {
+                    } else if (auto* propStr = ast_cast<StringLiteral>(memberExpr->property.get())) {
                         propertyName = propStr->value;
-                    } else if (auto* propNum = dynamic_cast<NumberLiteral*>(memberExpr->property.get())) {
+                    } else if (auto* propNum = ast_cast<NumberLiteral>(memberExpr->property.get())) {
                         propertyName = std::to_string(propNum->value);
                     }
                 }
@@ -2521,10 +2521,10 @@ void HIRGenerator::visit(AssignmentExpr& node) {
                 if (!propertyName.empty() || memberExpr->isComputed) {
                     memberExpr->object->accept(*this);
                     HIRValue* objectValue = lastValue_;
-                    auto pointerType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                    auto stringType = std::make_shared<HIRType>(HIRType::Kind::String);
-                    auto jsValueType = std::make_shared<HIRType>(HIRType::Kind::JSValue);
-                    auto voidType = std::make_shared<HIRType>(HIRType::Kind::Void);
+                    auto pointerType = HIRType::get(HIRType::Kind::Pointer);
+                    auto stringType = HIRType::get(HIRType::Kind::String);
+                    auto jsValueType = HIRType::get(HIRType::Kind::JSValue);
+                    auto voidType = HIRType::get(HIRType::Kind::Void);
 
                     if (objectValue && objectValue->type &&
                         objectValue->type->kind == HIRType::Kind::JSValue) {
@@ -2620,7 +2620,7 @@ void HIRGenerator::visit(AssignmentExpr& node) {
                             // Fallback: convert to a generic key string. Pointer
                             // values that aren't Symbols (e.g. function refs)
                             // land here.
-                            auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                            auto intType = HIRType::get(HIRType::Kind::I64);
                             auto existingKey = module_->getFunction("nova_value_key_to_string");
                             HIRFunction* keyFn = existingKey ? existingKey.get() : nullptr;
                             if (!keyFn) {
@@ -2650,10 +2650,10 @@ void HIRGenerator::visit(AssignmentExpr& node) {
             if (!memberExpr->isComputed && objectVariableName != "") {
                 auto classIt = classStaticProps_.find(objectVariableName);
                 if (classIt != classStaticProps_.end()) {
-                    if (auto* propIdent = dynamic_cast<Identifier*>(memberExpr->property.get())) {
+                    if (auto* propIdent = ast_cast<Identifier>(memberExpr->property.get())) {
                         if (classIt->second.find(propIdent->name) != classIt->second.end()) {
-                            auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                            auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                            auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                            auto intType = HIRType::get(HIRType::Kind::I64);
                             std::string setter = "nova_class_static_set_i64";
                             HIRFunction* setFunc = nullptr;
                             auto existingSet = module_->getFunction(setter);
@@ -2686,7 +2686,7 @@ void HIRGenerator::visit(AssignmentExpr& node) {
             if (memberExpr->isComputed) {
                 // Array element assignment: arr[index] = value
                 if (auto* keyLiteral =
-                        dynamic_cast<StringLiteral*>(memberExpr->property.get())) {
+                        ast_cast<StringLiteral>(memberExpr->property.get())) {
                     HIRStructType* structType = nullptr;
                     if (object && object->type) {
                         structType = dynamic_cast<HIRStructType*>(object->type.get());
@@ -2719,7 +2719,7 @@ void HIRGenerator::visit(AssignmentExpr& node) {
                                     HIRValue* storedValue = value;
                                     if (structType->name.rfind("__obj_", 0) == 0 &&
                                         value->type->kind != structType->fields[i].type->kind) {
-                                        structType->fields[i].type = std::make_shared<HIRType>(
+                                        structType->fields[i].type = HIRType::get(
                                             HIRType::Kind::JSValue);
                                     }
                                     if (structType->fields[i].type->kind ==
@@ -2744,7 +2744,7 @@ void HIRGenerator::visit(AssignmentExpr& node) {
                 auto index = lastValue_;
 
                 // Check if this is TypedArray element assignment
-                if (auto* objIdent = dynamic_cast<Identifier*>(memberExpr->object.get())) {
+                if (auto* objIdent = ast_cast<Identifier>(memberExpr->object.get())) {
                     auto typeIt = typedArrayTypes_.find(objIdent->name);
                     if (typeIt != typedArrayTypes_.end()) {
                         std::string typedArrayType = typeIt->second;
@@ -2765,17 +2765,23 @@ void HIRGenerator::visit(AssignmentExpr& node) {
                         else if (typedArrayType == "BigInt64Array") runtimeFunc = "nova_bigint64array_set";
                         else if (typedArrayType == "BigUint64Array") runtimeFunc = "nova_biguint64array_set";
 
+                        // In-bounds by construction inside a canonical loop over this array
+                        if (!runtimeFunc.empty() &&
+                            isCanonicalTypedArrayElement(objIdent->name, memberExpr->property.get())) {
+                            runtimeFunc += "_unchecked";
+                        }
+
                         if (!runtimeFunc.empty()) {
-                            auto ptrType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-                            auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
-                            auto voidType = std::make_shared<HIRType>(HIRType::Kind::Void);
+                            auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+                            auto intType = HIRType::get(HIRType::Kind::I64);
+                            auto voidType = HIRType::get(HIRType::Kind::Void);
 
                             // Determine value type (double for Float32/Float64, i64 otherwise)
                             HIRTypePtr valueType;
                             if (typedArrayType == "Float32Array" || typedArrayType == "Float64Array") {
-                                valueType = std::make_shared<HIRType>(HIRType::Kind::F64);
+                                valueType = HIRType::get(HIRType::Kind::F64);
                             } else {
-                                valueType = std::make_shared<HIRType>(HIRType::Kind::I64);
+                                valueType = HIRType::get(HIRType::Kind::I64);
                             }
 
                             std::vector<HIRTypePtr> paramTypes = {ptrType, intType, valueType};
@@ -2800,7 +2806,7 @@ void HIRGenerator::visit(AssignmentExpr& node) {
 
                 // Use SetElement to store value directly to regular array element
                 builder_->createSetElement(object, index, value);
-            } else if (auto propExpr = dynamic_cast<Identifier*>(memberExpr->property.get())) {
+            } else if (auto propExpr = ast_cast<Identifier>(memberExpr->property.get())) {
                 // Object property assignment: obj.x = value or this.x = value
                 std::string propertyName = propExpr->name;
 
@@ -2884,7 +2890,7 @@ void HIRGenerator::visit(AssignmentExpr& node) {
                     if (structType && structType->name.rfind("__obj_", 0) == 0 &&
                         structType->fields[fieldIndex].type && value && value->type &&
                         value->type->kind != structType->fields[fieldIndex].type->kind) {
-                        structType->fields[fieldIndex].type = std::make_shared<HIRType>(
+                        structType->fields[fieldIndex].type = HIRType::get(
                             HIRType::Kind::JSValue);
                     }
                     if (structType && structType->fields[fieldIndex].type &&
@@ -13,33 +13,33 @@ enum class DynamicKind {
 
 DynamicKind expressionKind(Expr* expression) {
     if (!expression) return DynamicKind::Undefined;
-    if (dynamic_cast<NumberLiteral*>(expression)) return DynamicKind::Number;
-    if (dynamic_cast<StringLiteral*>(expression) ||
-        dynamic_cast<TemplateLiteralExpr*>(expression)) return DynamicKind::String;
-    if (dynamic_cast<BooleanLiteral*>(expression)) return DynamicKind::Boolean;
-    if (dynamic_cast<NullLiteral*>(expression)) return DynamicKind::Null;
-    if (dynamic_cast<UndefinedLiteral*>(expression)) return DynamicKind::Undefined;
-    if (dynamic_cast<ArrayExpr*>(expression) || dynamic_cast<ObjectExpr*>(expression) ||
-        dynamic_cast<NewExpr*>(expression) || dynamic_cast<RegexLiteralExpr*>(expression)) {
+    if (ast_cast<NumberLiteral>(expression)) return DynamicKind::Number;
+    if (ast_cast<StringLiteral>(expression) ||
+        ast_cast<TemplateLiteralExpr>(expression)) return DynamicKind::String;
+    if (ast_cast<BooleanLiteral>(expression)) return DynamicKind::Boolean;
+    if (ast_cast<NullLiteral>(expression)) return DynamicKind::Null;
+    if (ast_cast<UndefinedLiteral>(expression)) return DynamicKind::Undefined;
+    if (ast_cast<ArrayExpr>(expression) || ast_cast<ObjectExpr>(expression) ||
+        ast_cast<NewExpr>(expression) || ast_cast<RegexLiteralExpr>(expression)) {
         return DynamicKind::Object;
     }
-    if (dynamic_cast<FunctionExpr*>(expression) ||
-        dynamic_cast<ArrowFunctionExpr*>(expression)) return DynamicKind::Function;
-    if (auto* parenthesized = dynamic_cast<ParenthesizedExpr*>(expression)) {
+    if (ast_cast<FunctionExpr>(expression) ||
+        ast_cast<ArrowFunctionExpr>(expression)) return DynamicKind::Function;
+    if (auto* parenthesized = ast_cast<ParenthesizedExpr>(expression)) {
         return expressionKind(parenthesized->expression.get());
     }
-    if (auto* assertion = dynamic_cast<AsExpr*>(expression)) {
+    if (auto* assertion = ast_cast<AsExpr>(expression)) {
         return expressionKind(assertion->expression.get());
     }
-    if (auto* nonNull = dynamic_cast<NonNullExpr*>(expression)) {
+    if (auto* nonNull = ast_cast<NonNullExpr>(expression)) {
         return expressionKind(nonNull->expression.get());
     }
-    if (auto* conditional = dynamic_cast<ConditionalExpr*>(expression)) {
+    if (auto* conditional = ast_cast<ConditionalExpr>(expression)) {
         const auto left = expressionKind(conditional->consequent.get());
         const auto right = expressionKind(conditional->alternate.get());
         return left == right ? left : DynamicKind::Unknown;
     }
-    if (auto* binary = dynamic_cast<BinaryExpr*>(expression)) {
+    if (auto* binary = ast_cast<BinaryExpr>(expression)) {
         using Op = BinaryExpr::Op;
         switch (binary->op) {
             case Op::Equal: case Op::NotEqual: case Op::StrictEqual:
@@ -57,7 +57,7 @@ DynamicKind expressionKind(Expr* expression) {
                 return DynamicKind::Number;
         }
     }
-    if (auto* assignment = dynamic_cast<AssignmentExpr*>(expression)) {
+    if (auto* assignment = ast_cast<AssignmentExpr>(expression)) {
         return expressionKind(assignment->right.get());
     }
     return DynamicKind::Unknown;
@@ -74,25 +74,25 @@ public:
 
     void scanExpression(Expr* expression) {
         if (!expression) return;
-        if (auto* assignment = dynamic_cast<AssignmentExpr*>(expression)) {
+        if (auto* assignment = ast_cast<AssignmentExpr>(expression)) {
             scanExpression(assignment->right.get());
             if (assignment->pattern) {
                 std::function<void(Pattern*)> mark = [&](Pattern* pattern) {
                     if (!pattern) return;
                     if (auto* identifier =
-                            dynamic_cast<IdentifierPattern*>(pattern)) {
+                            ast_cast<IdentifierPattern>(pattern)) {
                         result.insert(identifier->name);
                     } else if (auto* value =
-                                   dynamic_cast<AssignmentPattern*>(pattern)) {
+                                   ast_cast<AssignmentPattern>(pattern)) {
                         mark(value->left.get());
                     } else if (auto* rest =
-                                   dynamic_cast<RestElement*>(pattern)) {
+                                   ast_cast<RestElement>(pattern)) {
                         mark(rest->argument.get());
                     } else if (auto* array =
-                                   dynamic_cast<ArrayPattern*>(pattern)) {
+                                   ast_cast<ArrayPattern>(pattern)) {
                         for (auto& element : array->elements) mark(element.get());
                     } else if (auto* object =
-                                   dynamic_cast<ObjectPattern*>(pattern)) {
+                                   ast_cast<ObjectPattern>(pattern)) {
                         for (auto& property : object->properties) {
                             mark(property.value.get());
                         }
@@ -101,7 +101,7 @@ public:
                 mark(assignment->pattern.get());
                 return;
             }
-            if (auto* identifier = dynamic_cast<Identifier*>(assignment->left.get())) {
+            if (auto* identifier = ast_cast<Identifier>(assignment->left.get())) {
                 auto found = bindings.find(identifier->name);
                 if (found != bindings.end()) {
                     auto assigned = expressionKind(assignment->right.get());
@@ -118,14 +118,14 @@ public:
             } else {
                 scanExpression(assignment->left.get());
             }
-        } else if (auto* binary = dynamic_cast<BinaryExpr*>(expression)) {
+        } else if (auto* binary = ast_cast<BinaryExpr>(expression)) {
             scanExpression(binary->left.get()); scanExpression(binary->right.get());
-        } else if (auto* unary = dynamic_cast<UnaryExpr*>(expression)) {
+        } else if (auto* unary = ast_cast<UnaryExpr>(expression)) {
             scanExpression(unary->operand.get());
-        } else if (auto* update = dynamic_cast<UpdateExpr*>(expression)) {
+        } else if (auto* update = ast_cast<UpdateExpr>(expression)) {
             scanExpression(update->argument.get());
-        } else if (auto* call = dynamic_cast<CallExpr*>(expression)) {
-            if (auto* identifier = dynamic_cast<Identifier*>(call->callee.get())) {
+        } else if (auto* call = ast_cast<CallExpr>(expression)) {
+            if (auto* identifier = ast_cast<Identifier>(call->callee.get())) {
                 auto& parameterKinds = callKinds[identifier->name];
                 if (parameterKinds.size() < call->arguments.size()) {
                     parameterKinds.resize(call->arguments.size());
@@ -137,83 +137,83 @@ public:
             }
             scanExpression(call->callee.get());
             for (auto& argument : call->arguments) scanExpression(argument.get());
-        } else if (auto* member = dynamic_cast<MemberExpr*>(expression)) {
+        } else if (auto* member = ast_cast<MemberExpr>(expression)) {
             scanExpression(member->object.get()); scanExpression(member->property.get());
-        } else if (auto* conditional = dynamic_cast<ConditionalExpr*>(expression)) {
+        } else if (auto* conditional = ast_cast<ConditionalExpr>(expression)) {
             scanExpression(conditional->test.get());
             scanExpression(conditional->consequent.get());
             scanExpression(conditional->alternate.get());
-        } else if (auto* array = dynamic_cast<ArrayExpr*>(expression)) {
+        } else if (auto* array = ast_cast<ArrayExpr>(expression)) {
             for (auto& element : array->elements) scanExpression(element.get());
-        } else if (auto* object = dynamic_cast<ObjectExpr*>(expression)) {
+        } else if (auto* object = ast_cast<ObjectExpr>(expression)) {
             for (auto& property : object->properties) scanExpression(property.value.get());
-        } else if (auto* parenthesized = dynamic_cast<ParenthesizedExpr*>(expression)) {
+        } else if (auto* parenthesized = ast_cast<ParenthesizedExpr>(expression)) {
             scanExpression(parenthesized->expression.get());
-        } else if (auto* sequence = dynamic_cast<SequenceExpr*>(expression)) {
+        } else if (auto* sequence = ast_cast<SequenceExpr>(expression)) {
             for (auto& item : sequence->expressions) scanExpression(item.get());
-        } else if (auto* spread = dynamic_cast<SpreadExpr*>(expression)) {
+        } else if (auto* spread = ast_cast<SpreadExpr>(expression)) {
             scanExpression(spread->argument.get());
-        } else if (auto* awaited = dynamic_cast<AwaitExpr*>(expression)) {
+        } else if (auto* awaited = ast_cast<AwaitExpr>(expression)) {
             scanExpression(awaited->argument.get());
-        } else if (auto* yielded = dynamic_cast<YieldExpr*>(expression)) {
+        } else if (auto* yielded = ast_cast<YieldExpr>(expression)) {
             scanExpression(yielded->argument.get());
-        } else if (auto* assertion = dynamic_cast<AsExpr*>(expression)) {
+        } else if (auto* assertion = ast_cast<AsExpr>(expression)) {
             scanExpression(assertion->expression.get());
-        } else if (auto* satisfies = dynamic_cast<SatisfiesExpr*>(expression)) {
+        } else if (auto* satisfies = ast_cast<SatisfiesExpr>(expression)) {
             scanExpression(satisfies->expression.get());
-        } else if (auto* nonNull = dynamic_cast<NonNullExpr*>(expression)) {
+        } else if (auto* nonNull = ast_cast<NonNullExpr>(expression)) {
             scanExpression(nonNull->expression.get());
         }
     }
 
     void scanStatement(Stmt* statement) {
         if (!statement) return;
-        if (auto* block = dynamic_cast<BlockStmt*>(statement)) {
+        if (auto* block = ast_cast<BlockStmt>(statement)) {
             for (auto& item : block->statements) scanStatement(item.get());
-        } else if (auto* expression = dynamic_cast<ExprStmt*>(statement)) {
+        } else if (auto* expression = ast_cast<ExprStmt>(statement)) {
             scanExpression(expression->expression.get());
-        } else if (auto* variables = dynamic_cast<VarDeclStmt*>(statement)) {
+        } else if (auto* variables = ast_cast<VarDeclStmt>(statement)) {
             for (auto& declarator : variables->declarations) {
                 scanExpression(declarator.init.get());
                 if (!declarator.name.empty()) {
                     bindings[declarator.name] = expressionKind(declarator.init.get());
                 }
             }
-        } else if (auto* conditional = dynamic_cast<IfStmt*>(statement)) {
+        } else if (auto* conditional = ast_cast<IfStmt>(statement)) {
             scanExpression(conditional->test.get());
             scanStatement(conditional->consequent.get());
             scanStatement(conditional->alternate.get());
-        } else if (auto* whileLoop = dynamic_cast<WhileStmt*>(statement)) {
+        } else if (auto* whileLoop = ast_cast<WhileStmt>(statement)) {
             scanExpression(whileLoop->test.get()); scanStatement(whileLoop->body.get());
-        } else if (auto* doWhileLoop = dynamic_cast<DoWhileStmt*>(statement)) {
+        } else if (auto* doWhileLoop = ast_cast<DoWhileStmt>(statement)) {
             scanStatement(doWhileLoop->body.get()); scanExpression(doWhileLoop->test.get());
-        } else if (auto* forLoop = dynamic_cast<ForStmt*>(statement)) {
+        } else if (auto* forLoop = ast_cast<ForStmt>(statement)) {
             scanStatement(forLoop->init.get()); scanExpression(forLoop->test.get());
             scanExpression(forLoop->update.get()); scanStatement(forLoop->body.get());
-        } else if (auto* forInLoop = dynamic_cast<ForInStmt*>(statement)) {
+        } else if (auto* forInLoop = ast_cast<ForInStmt>(statement)) {
             scanExpression(forInLoop->right.get()); scanStatement(forInLoop->body.get());
-        } else if (auto* forOfLoop = dynamic_cast<ForOfStmt*>(statement)) {
+        } else if (auto* forOfLoop = ast_cast<ForOfStmt>(statement)) {
             scanExpression(forOfLoop->right.get()); scanStatement(forOfLoop->body.get());
-        } else if (auto* returned = dynamic_cast<ReturnStmt*>(statement)) {
+        } else if (auto* returned = ast_cast<ReturnStmt>(statement)) {
             scanExpression(returned->argument.get());
             returnKinds.insert(static_cast<int>(expressionKind(returned->argument.get())));
-        } else if (auto* thrown = dynamic_cast<ThrowStmt*>(statement)) {
+        } else if (auto* thrown = ast_cast<ThrowStmt>(statement)) {
             scanExpression(thrown->argument.get());
-        } else if (auto* labeled = dynamic_cast<LabeledStmt*>(statement)) {
+        } else if (auto* labeled = ast_cast<LabeledStmt>(statement)) {
             scanStatement(labeled->statement.get());
-        } else if (auto* switchStatement = dynamic_cast<SwitchStmt*>(statement)) {
+        } else if (auto* switchStatement = ast_cast<SwitchStmt>(statement)) {
             scanExpression(switchStatement->discriminant.get());
             for (auto& item : switchStatement->cases) {
                 scanExpression(item->test.get());
                 for (auto& consequent : item->consequent) scanStatement(consequent.get());
             }
-        } else if (auto* tryStatement = dynamic_cast<TryStmt*>(statement)) {
+        } else if (auto* tryStatement = ast_cast<TryStmt>(statement)) {
             scanStatement(tryStatement->block.get());
             if (tryStatement->handler) scanStatement(tryStatement->handler->body.get());
             scanStatement(tryStatement->finalizer.get());
         } else if (visitNestedFunctions_) {
-            if (auto* declaration = dynamic_cast<DeclStmt*>(statement)) {
-                if (auto* function = dynamic_cast<FunctionDecl*>(declaration->declaration.get())) {
+            if (auto* declaration = ast_cast<DeclStmt>(statement)) {
+                if (auto* function = ast_cast<FunctionDecl>(declaration->declaration.get())) {
                     scanStatement(function->body.get());
                 }
             }
@@ -265,56 +265,56 @@ public:
 
     void scanStatement(Stmt* statement) {
         if (!statement) return;
-        if (auto* block = dynamic_cast<BlockStmt*>(statement)) {
+        if (auto* block = ast_cast<BlockStmt>(statement)) {
             for (auto& item : block->statements) scanStatement(item.get());
-        } else if (auto* expression = dynamic_cast<ExprStmt*>(statement)) {
+        } else if (auto* expression = ast_cast<ExprStmt>(statement)) {
             scanExpression(expression->expression.get());
-        } else if (auto* variables = dynamic_cast<VarDeclStmt*>(statement)) {
+        } else if (auto* variables = ast_cast<VarDeclStmt>(statement)) {
             for (auto& declarator : variables->declarations) {
                 scanExpression(declarator.init.get());
             }
-        } else if (auto* conditional = dynamic_cast<IfStmt*>(statement)) {
+        } else if (auto* conditional = ast_cast<IfStmt>(statement)) {
             scanExpression(conditional->test.get());
             scanStatement(conditional->consequent.get());
             scanStatement(conditional->alternate.get());
-        } else if (auto* whileLoop = dynamic_cast<WhileStmt*>(statement)) {
+        } else if (auto* whileLoop = ast_cast<WhileStmt>(statement)) {
             scanExpression(whileLoop->test.get());
             scanStatement(whileLoop->body.get());
-        } else if (auto* doWhileLoop = dynamic_cast<DoWhileStmt*>(statement)) {
+        } else if (auto* doWhileLoop = ast_cast<DoWhileStmt>(statement)) {
             scanStatement(doWhileLoop->body.get());
             scanExpression(doWhileLoop->test.get());
-        } else if (auto* forLoop = dynamic_cast<ForStmt*>(statement)) {
+        } else if (auto* forLoop = ast_cast<ForStmt>(statement)) {
             scanStatement(forLoop->init.get());
             scanExpression(forLoop->test.get());
             scanExpression(forLoop->update.get());
             scanStatement(forLoop->body.get());
-        } else if (auto* forInLoop = dynamic_cast<ForInStmt*>(statement)) {
+        } else if (auto* forInLoop = ast_cast<ForInStmt>(statement)) {
             scanExpression(forInLoop->right.get());
             scanStatement(forInLoop->body.get());
-        } else if (auto* forOfLoop = dynamic_cast<ForOfStmt*>(statement)) {
+        } else if (auto* forOfLoop = ast_cast<ForOfStmt>(statement)) {
             scanExpression(forOfLoop->right.get());
             scanStatement(forOfLoop->body.get());
-        } else if (auto* returned = dynamic_cast<ReturnStmt*>(statement)) {
+        } else if (auto* returned = ast_cast<ReturnStmt>(statement)) {
             scanExpression(returned->argument.get());
-        } else if (auto* thrown = dynamic_cast<ThrowStmt*>(statement)) {
+        } else if (auto* thrown = ast_cast<ThrowStmt>(statement)) {
             scanExpression(thrown->argument.get());
-        } else if (auto* labeled = dynamic_cast<LabeledStmt*>(statement)) {
+        } else if (auto* labeled = ast_cast<LabeledStmt>(statement)) {
             scanStatement(labeled->statement.get());
-        } else if (auto* switchStatement = dynamic_cast<SwitchStmt*>(statement)) {
+        } else if (auto* switchStatement = ast_cast<SwitchStmt>(statement)) {
             scanExpression(switchStatement->discriminant.get());
             for (auto& item : switchStatement->cases) {
                 scanExpression(item->test.get());
                 for (auto& consequent : item->consequent) scanStatement(consequent.get());
             }
-        } else if (auto* tryStatement = dynamic_cast<TryStmt*>(statement)) {
+        } else if (auto* tryStatement = ast_cast<TryStmt>(statement)) {
             scanStatement(tryStatement->block.get());
             if (tryStatement->handler) scanStatement(tryStatement->handler->body.get());
             scanStatement(tryStatement->finalizer.get());
-        } else if (auto* declaration = dynamic_cast<DeclStmt*>(statement)) {
-            if (auto* function = dynamic_cast<FunctionDecl*>(declaration->declaration.get())) {
+        } else if (auto* declaration = ast_cast<DeclStmt>(statement)) {
+            if (auto* function = ast_cast<FunctionDecl>(declaration->declaration.get())) {
                 if (function->body) scanStatement(function->body.get());
             } else if (auto* classDecl =
-                           dynamic_cast<ClassDecl*>(declaration->declaration.get())) {
+                           ast_cast<ClassDecl>(declaration->declaration.get())) {
                 for (auto& method : classDecl->methods) {
                     if (method.body) scanStatement(method.body.get());
                 }
@@ -325,17 +325,17 @@ public:
 private:
     void scanExpression(Expr* expression) {
         if (!expression) return;
-        if (auto* assignment = dynamic_cast<AssignmentExpr*>(expression)) {
+        if (auto* assignment = ast_cast<AssignmentExpr>(expression)) {
             // A computed write through a well-known Symbol cannot target a
             // fixed-layout object. Force the receiver to use the runtime
             // property store so the symbol identity is preserved and the
             // write does not get mis-lowered as a numeric array SetElement.
-            if (auto* member = dynamic_cast<MemberExpr*>(assignment->left.get());
+            if (auto* member = ast_cast<MemberExpr>(assignment->left.get());
                 member && member->isComputed) {
                 if (auto* symbolMember =
-                        dynamic_cast<MemberExpr*>(member->property.get())) {
+                        ast_cast<MemberExpr>(member->property.get())) {
                     auto* symbolBase =
-                        dynamic_cast<Identifier*>(symbolMember->object.get());
+                        ast_cast<Identifier>(symbolMember->object.get());
                     if (symbolBase && symbolBase->name == "Symbol") {
                         addIfIdentifier(member->object.get());
                     }
@@ -343,27 +343,27 @@ private:
             }
             scanExpression(assignment->left.get());
             scanExpression(assignment->right.get());
-        } else if (auto* binary = dynamic_cast<BinaryExpr*>(expression)) {
+        } else if (auto* binary = ast_cast<BinaryExpr>(expression)) {
             // `foo in X` — X is RHS, must be dynamic.
             if (binary->op == BinaryExpr::Op::In) {
                 addIfIdentifier(binary->right.get());
             }
             scanExpression(binary->left.get());
             scanExpression(binary->right.get());
-        } else if (auto* unary = dynamic_cast<UnaryExpr*>(expression)) {
+        } else if (auto* unary = ast_cast<UnaryExpr>(expression)) {
             // `delete X.foo` — X must be dynamic.
             if (unary->op == UnaryExpr::Op::Delete) {
-                if (auto* member = dynamic_cast<MemberExpr*>(unary->operand.get())) {
+                if (auto* member = ast_cast<MemberExpr>(unary->operand.get())) {
                     addIfIdentifier(member->object.get());
                 }
             }
             scanExpression(unary->operand.get());
-        } else if (auto* update = dynamic_cast<UpdateExpr*>(expression)) {
+        } else if (auto* update = ast_cast<UpdateExpr>(expression)) {
             scanExpression(update->argument.get());
         } else if (auto* construction =
-                       dynamic_cast<NewExpr*>(expression)) {
+                       ast_cast<NewExpr>(expression)) {
             if (auto* constructor =
-                    dynamic_cast<Identifier*>(construction->callee.get());
+                    ast_cast<Identifier>(construction->callee.get());
                 constructor && constructor->name == "Proxy") {
                 if (!construction->arguments.empty()) {
                     addIfIdentifier(
@@ -378,16 +378,16 @@ private:
             for (auto& argument : construction->arguments) {
                 scanExpression(argument.get());
             }
-        } else if (auto* call = dynamic_cast<CallExpr*>(expression)) {
+        } else if (auto* call = ast_cast<CallExpr>(expression)) {
             scanCall(call);
             scanExpression(call->callee.get());
             for (auto& argument : call->arguments) scanExpression(argument.get());
-        } else if (auto* member = dynamic_cast<MemberExpr*>(expression)) {
+        } else if (auto* member = ast_cast<MemberExpr>(expression)) {
             // X.isPrototypeOf(...) / X.hasOwnProperty(...) / X.propertyIsEnumerable(...)
             // — receiver must be dynamic. The actual call visitor handles the
             // call form; here we catch the member access alone in case it's
             // passed around without being called.
-            if (auto* propIdent = dynamic_cast<Identifier*>(member->property.get())) {
+            if (auto* propIdent = ast_cast<Identifier>(member->property.get())) {
                 if (propIdent->name == "isPrototypeOf" ||
                     propIdent->name == "hasOwnProperty" ||
                     propIdent->name == "propertyIsEnumerable") {
@@ -396,39 +396,39 @@ private:
             }
             scanExpression(member->object.get());
             scanExpression(member->property.get());
-        } else if (auto* conditional = dynamic_cast<ConditionalExpr*>(expression)) {
+        } else if (auto* conditional = ast_cast<ConditionalExpr>(expression)) {
             scanExpression(conditional->test.get());
             scanExpression(conditional->consequent.get());
             scanExpression(conditional->alternate.get());
-        } else if (auto* array = dynamic_cast<ArrayExpr*>(expression)) {
+        } else if (auto* array = ast_cast<ArrayExpr>(expression)) {
             for (auto& element : array->elements) scanExpression(element.get());
-        } else if (auto* object = dynamic_cast<ObjectExpr*>(expression)) {
+        } else if (auto* object = ast_cast<ObjectExpr>(expression)) {
             for (auto& property : object->properties) {
                 if (property.isComputed) scanExpression(property.key.get());
                 scanExpression(property.value.get());
             }
-        } else if (auto* parenthesized = dynamic_cast<ParenthesizedExpr*>(expression)) {
+        } else if (auto* parenthesized = ast_cast<ParenthesizedExpr>(expression)) {
             scanExpression(parenthesized->expression.get());
-        } else if (auto* sequence = dynamic_cast<SequenceExpr*>(expression)) {
+        } else if (auto* sequence = ast_cast<SequenceExpr>(expression)) {
             for (auto& item : sequence->expressions) scanExpression(item.get());
-        } else if (auto* spread = dynamic_cast<SpreadExpr*>(expression)) {
+        } else if (auto* spread = ast_cast<SpreadExpr>(expression)) {
             scanExpression(spread->argument.get());
-        } else if (auto* awaited = dynamic_cast<AwaitExpr*>(expression)) {
+        } else if (auto* awaited = ast_cast<AwaitExpr>(expression)) {
             scanExpression(awaited->argument.get());
-        } else if (auto* yielded = dynamic_cast<YieldExpr*>(expression)) {
+        } else if (auto* yielded = ast_cast<YieldExpr>(expression)) {
             scanExpression(yielded->argument.get());
-        } else if (auto* assertion = dynamic_cast<AsExpr*>(expression)) {
+        } else if (auto* assertion = ast_cast<AsExpr>(expression)) {
             scanExpression(assertion->expression.get());
-        } else if (auto* satisfies = dynamic_cast<SatisfiesExpr*>(expression)) {
+        } else if (auto* satisfies = ast_cast<SatisfiesExpr>(expression)) {
             scanExpression(satisfies->expression.get());
-        } else if (auto* nonNull = dynamic_cast<NonNullExpr*>(expression)) {
+        } else if (auto* nonNull = ast_cast<NonNullExpr>(expression)) {
             scanExpression(nonNull->expression.get());
         }
     }
 
     void scanCall(CallExpr* call) {
         if (auto* alias =
-                dynamic_cast<Identifier*>(call->callee.get());
+                ast_cast<Identifier>(call->callee.get());
             alias && functionReferences_) {
             auto found = functionReferences_->find(alias->name);
             if (found != functionReferences_->end()) {
@@ -451,10 +451,10 @@ private:
         }
 
         // Identify Object.X(...) and Reflect.X(...) static method calls.
-        auto* member = dynamic_cast<MemberExpr*>(call->callee.get());
+        auto* member = ast_cast<MemberExpr>(call->callee.get());
         if (!member) return;
-        auto* objectIdent = dynamic_cast<Identifier*>(member->object.get());
-        auto* propIdent = dynamic_cast<Identifier*>(member->property.get());
+        auto* objectIdent = ast_cast<Identifier>(member->object.get());
+        auto* propIdent = ast_cast<Identifier>(member->property.get());
         if (!objectIdent || !propIdent) return;
 
         const auto& ns = objectIdent->name;
@@ -488,7 +488,7 @@ private:
             if (method == "assign") {
                 // Object.assign(target, source) — both args dynamic unless literal {}.
                 for (auto& arg : call->arguments) {
-                    if (!dynamic_cast<ObjectExpr*>(arg.get())) {
+                    if (!ast_cast<ObjectExpr>(arg.get())) {
                         addIfIdentifier(arg.get());
                     }
                 }
@@ -523,16 +523,16 @@ private:
 
     void addIfIdentifier(Expr* expression) {
         // Walk through common wrappers to find an Identifier.
-        while (auto* asExpr = dynamic_cast<AsExpr*>(expression)) {
+        while (auto* asExpr = ast_cast<AsExpr>(expression)) {
             expression = asExpr->expression.get();
         }
-        while (auto* nonNull = dynamic_cast<NonNullExpr*>(expression)) {
+        while (auto* nonNull = ast_cast<NonNullExpr>(expression)) {
             expression = nonNull->expression.get();
         }
-        while (auto* paren = dynamic_cast<ParenthesizedExpr*>(expression)) {
+        while (auto* paren = ast_cast<ParenthesizedExpr>(expression)) {
             expression = paren->expression.get();
         }
-        if (auto* ident = dynamic_cast<Identifier*>(expression)) {
+        if (auto* ident = ast_cast<Identifier>(expression)) {
             result.insert(ident->name);
         }
     }
@@ -550,19 +550,19 @@ std::unordered_set<std::string> HIRGenerator::scanForcedDynamicObjects(Stmt* sta
 
 bool HIRGenerator::targetForcedDynamic(Expr* expression) {
     while (expression) {
-        if (auto* asExpr = dynamic_cast<AsExpr*>(expression)) {
+        if (auto* asExpr = ast_cast<AsExpr>(expression)) {
             expression = asExpr->expression.get();
             continue;
         }
-        if (auto* nonNull = dynamic_cast<NonNullExpr*>(expression)) {
+        if (auto* nonNull = ast_cast<NonNullExpr>(expression)) {
             expression = nonNull->expression.get();
             continue;
         }
-        if (auto* paren = dynamic_cast<ParenthesizedExpr*>(expression)) {
+        if (auto* paren = ast_cast<ParenthesizedExpr>(expression)) {
             expression = paren->expression.get();
             continue;
         }
-        if (auto* ident = dynamic_cast<Identifier*>(expression)) {
+        if (auto* ident = ast_cast<Identifier>(expression)) {
             return dynamicObjectVars_.count(ident->name) > 0;
         }
         return false;
@@ -617,6 +617,17 @@ void HIRGenerator::visit(BlockStmt& node) {
     }
     
 void HIRGenerator::visit(ExprStmt& node) {
+        // `[a, b] = [b, a];` - the assignment result is discarded, so the
+        // right-hand literal never escapes and need not be allocated.
+        if (auto* assignment =
+                ast_cast<AssignmentExpr>(node.expression.get());
+            assignment && assignment->pattern &&
+            assignment->op == AssignmentExpr::Op::Assign &&
+            tryScalarReplaceDestructuring(assignment->pattern.get(),
+                                          assignment->right.get(), true)) {
+            lastValue_ = nullptr;
+            return;
+        }
         if (node.expression) {
             node.expression->accept(*this);
         }
@@ -658,9 +669,9 @@ void HIRGenerator::visit(ExprStmt& node) {
                     };
                 if (isSideEffectingHelper(calleeName)) {
                     auto i64Type =
-                        std::make_shared<HIRType>(HIRType::Kind::I64);
+                        HIRType::get(HIRType::Kind::I64);
                     auto voidType =
-                        std::make_shared<HIRType>(HIRType::Kind::Void);
+                        HIRType::get(HIRType::Kind::Void);
                     HIRFunction* anchor = nullptr;
                     if (auto existing = module_->getFunction(
                             "nova_sideeffect_anchor")) {
@@ -676,7 +687,7 @@ void HIRGenerator::visit(ExprStmt& node) {
                     HIRValue* anchoredValue = lastValue_;
                     if (!anchoredValue->type ||
                         anchoredValue->type->kind != HIRType::Kind::I64) {
-                        auto ptrCoerce = std::make_shared<HIRType>(
+                        auto ptrCoerce = HIRType::get(
                             HIRType::Kind::I64);
                         anchoredValue = builder_->createCast(
                             anchoredValue, ptrCoerce.get(),
@@ -691,37 +702,37 @@ void HIRGenerator::visit(ExprStmt& node) {
 
 void HIRGenerator::appendPatternParameterTypes(
     Pattern* pattern, std::vector<HIRTypePtr>& types) {
-    if (auto* assignment = dynamic_cast<AssignmentPattern*>(pattern)) {
+    if (auto* assignment = ast_cast<AssignmentPattern>(pattern)) {
         appendPatternParameterTypes(assignment->left.get(), types);
         return;
     }
-    if (auto* rest = dynamic_cast<RestElement*>(pattern)) {
+    if (auto* rest = ast_cast<RestElement>(pattern)) {
         appendPatternParameterTypes(rest->argument.get(), types);
         return;
     }
-    if (auto* object = dynamic_cast<ObjectPattern*>(pattern)) {
+    if (auto* object = ast_cast<ObjectPattern>(pattern)) {
         for (auto& property : object->properties) {
             appendPatternParameterTypes(property.value.get(), types);
         }
         if (object->rest) {
-            types.push_back(std::make_shared<HIRType>(HIRType::Kind::Pointer));
+            types.push_back(HIRType::get(HIRType::Kind::Pointer));
         }
         return;
     }
-    types.push_back(std::make_shared<HIRType>(HIRType::Kind::JSValue));
+    types.push_back(HIRType::get(HIRType::Kind::JSValue));
 }
 
 void HIRGenerator::bindPatternParameters(
     Pattern* pattern, const std::vector<HIRParameter*>& parameters,
     size_t& cursor, Expr* defaultValue) {
     if (!pattern) return;
-    if (auto* assignment = dynamic_cast<AssignmentPattern*>(pattern)) {
+    if (auto* assignment = ast_cast<AssignmentPattern>(pattern)) {
         bindPatternParameters(
             assignment->left.get(), parameters, cursor,
             assignment->right.get());
         return;
     }
-    if (auto* object = dynamic_cast<ObjectPattern*>(pattern)) {
+    if (auto* object = ast_cast<ObjectPattern>(pattern)) {
         for (auto& property : object->properties) {
             bindPatternParameters(
                 property.value.get(), parameters, cursor,
@@ -730,7 +741,7 @@ void HIRGenerator::bindPatternParameters(
         if (object->rest && cursor < parameters.size()) {
             bindDestructuringPattern(
                 object->rest.get(), parameters[cursor++]);
-            if (auto* identifier = dynamic_cast<IdentifierPattern*>(
+            if (auto* identifier = ast_cast<IdentifierPattern>(
                     object->rest.get())) {
                 dynamicObjectVars_.insert(identifier->name);
             }
@@ -747,11 +758,11 @@ void HIRGenerator::appendPatternArguments(
         arguments.push_back(value);
         return;
     }
-    if (auto* assignment = dynamic_cast<AssignmentPattern*>(pattern)) {
+    if (auto* assignment = ast_cast<AssignmentPattern>(pattern)) {
         appendPatternArguments(assignment->left.get(), value, arguments);
         return;
     }
-    if (auto* object = dynamic_cast<ObjectPattern*>(pattern)) {
+    if (auto* object = ast_cast<ObjectPattern>(pattern)) {
         HIRType* sourceCandidate = value && value->type
             ? value->type.get() : nullptr;
         if (auto* sourcePointer = dynamic_cast<HIRPointerType*>(sourceCandidate);
@@ -771,7 +782,7 @@ void HIRGenerator::appendPatternArguments(
                 }
             }
             if (!propertyValue) {
-                auto unknownType = std::make_shared<HIRType>(HIRType::Kind::Unknown);
+                auto unknownType = HIRType::get(HIRType::Kind::Unknown);
                 propertyValue = builder_->createUndefinedConstant(
                     unknownType.get());
             }
@@ -779,10 +790,10 @@ void HIRGenerator::appendPatternArguments(
                 property.value.get(), propertyValue, arguments);
         }
         if (object->rest) {
-            auto pointerType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-            auto voidType = std::make_shared<HIRType>(HIRType::Kind::Void);
-            auto stringType = std::make_shared<HIRType>(HIRType::Kind::String);
-            auto jsValueType = std::make_shared<HIRType>(HIRType::Kind::JSValue);
+            auto pointerType = HIRType::get(HIRType::Kind::Pointer);
+            auto voidType = HIRType::get(HIRType::Kind::Void);
+            auto stringType = HIRType::get(HIRType::Kind::String);
+            auto jsValueType = HIRType::get(HIRType::Kind::JSValue);
 
             auto createExisting = module_->getFunction(
                 "nova_dynamic_object_create");
@@ -849,7 +860,7 @@ HIRValue* HIRGenerator::applyDestructuringDefault(
         return value;
     }
 
-    auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
+    auto intType = HIRType::get(HIRType::Kind::I64);
     auto existing = module_->getFunction("nova_value_is_undefined");
     HIRFunction* isUndefined = existing ? existing.get() : nullptr;
     if (!isUndefined) {
@@ -884,7 +895,7 @@ void HIRGenerator::bindDestructuringPattern(
     Pattern* pattern, HIRValue* value, Expr* defaultValue) {
     if (!pattern) return;
 
-    if (auto* assignment = dynamic_cast<AssignmentPattern*>(pattern)) {
+    if (auto* assignment = ast_cast<AssignmentPattern>(pattern)) {
         bindDestructuringPattern(
             assignment->left.get(), value, assignment->right.get());
         return;
@@ -892,11 +903,11 @@ void HIRGenerator::bindDestructuringPattern(
 
     value = applyDestructuringDefault(value, defaultValue);
     if (!value) {
-        auto unknownType = std::make_shared<HIRType>(HIRType::Kind::Unknown);
+        auto unknownType = HIRType::get(HIRType::Kind::Unknown);
         value = builder_->createUndefinedConstant(unknownType.get());
     }
 
-    if (auto* identifier = dynamic_cast<IdentifierPattern*>(pattern)) {
+    if (auto* identifier = ast_cast<IdentifierPattern>(pattern)) {
         HIRValue* storedValue = value;
         if (value->type && value->type->kind == HIRType::Kind::Unknown) {
             storedValue = toJSValue(value);
@@ -911,12 +922,12 @@ void HIRGenerator::bindDestructuringPattern(
         return;
     }
 
-    if (auto* rest = dynamic_cast<RestElement*>(pattern)) {
+    if (auto* rest = ast_cast<RestElement>(pattern)) {
         bindDestructuringPattern(rest->argument.get(), value);
         return;
     }
 
-    if (auto* arrayPattern = dynamic_cast<ArrayPattern*>(pattern)) {
+    if (auto* arrayPattern = ast_cast<ArrayPattern>(pattern)) {
         HIRValue* arrayValue = value;
         HIRArrayType* arrayType = nullptr;
         if (value->type) {
@@ -929,7 +940,7 @@ void HIRGenerator::bindDestructuringPattern(
         }
 
         if (value->type && value->type->kind == HIRType::Kind::JSValue) {
-            auto pointerType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
+            auto pointerType = HIRType::get(HIRType::Kind::Pointer);
             auto existing = module_->getFunction("nova_value_to_object");
             HIRFunction* toObject = existing ? existing.get() : nullptr;
             if (!toObject) {
@@ -944,9 +955,9 @@ void HIRGenerator::bindDestructuringPattern(
                 toObject, {value}, "destructure.array.object");
         }
 
-        auto pointerType = std::make_shared<HIRType>(HIRType::Kind::Pointer);
-        auto intType = std::make_shared<HIRType>(HIRType::Kind::I64);
-        auto jsValueType = std::make_shared<HIRType>(HIRType::Kind::JSValue);
+        auto pointerType = HIRType::get(HIRType::Kind::Pointer);
+        auto intType = HIRType::get(HIRType::Kind::I64);
+        auto jsValueType = HIRType::get(HIRType::Kind::JSValue);
 
         for (size_t index = 0; index < arrayPattern->elements.size(); ++index) {
             auto& element = arrayPattern->elements[index];
@@ -1038,7 +1049,7 @@ void HIRGenerator::bindDestructuringPattern(
         return;
     }
 
-    if (auto* objectPattern = dynamic_cast<ObjectPattern*>(pattern)) {
+    if (auto* objectPattern = ast_cast<ObjectPattern>(pattern)) {
         HIRStructType* structType = nullptr;
         if (value->type) {
             HIRType* candidate = value->type.get();
@@ -1063,7 +1074,7 @@ void HIRGenerator::bindDestructuringPattern(
                 }
             }
             if (!propertyValue) {
-                auto unknownType = std::make_shared<HIRType>(HIRType::Kind::Unknown);
+                auto unknownType = HIRType::get(HIRType::Kind::Unknown);
                 propertyValue = builder_->createUndefinedConstant(unknownType.get());
             }
             bindDestructuringPattern(
@@ -1096,16 +1107,16 @@ void HIRGenerator::assignDestructuringPattern(
     std::vector<std::string> names;
     std::function<void(Pattern*)> collect = [&](Pattern* current) {
         if (!current) return;
-        if (auto* identifier = dynamic_cast<IdentifierPattern*>(current)) {
+        if (auto* identifier = ast_cast<IdentifierPattern>(current)) {
             names.push_back(identifier->name);
-        } else if (auto* assignment = dynamic_cast<AssignmentPattern*>(current)) {
+        } else if (auto* assignment = ast_cast<AssignmentPattern>(current)) {
             collect(assignment->left.get());
-        } else if (auto* rest = dynamic_cast<RestElement*>(current)) {
+        } else if (auto* rest = ast_cast<RestElement>(current)) {
             collect(rest->argument.get());
-        } else if (auto* array = dynamic_cast<ArrayPattern*>(current)) {
+        } else if (auto* array = ast_cast<ArrayPattern>(current)) {
             for (auto& element : array->elements) collect(element.get());
             collect(array->rest.get());
-        } else if (auto* object = dynamic_cast<ObjectPattern*>(current)) {
+        } else if (auto* object = ast_cast<ObjectPattern>(current)) {
             for (auto& property : object->properties) {
                 collect(property.value.get());
             }
@@ -1154,6 +1165,12 @@ void HIRGenerator::visit(VarDeclStmt& node) {
         for (auto& decl : node.declarations) {
             lastIntegrityObjectName_.clear();
 
+            if (decl.pattern && decl.init &&
+                tryScalarReplaceDestructuring(decl.pattern.get(),
+                                              decl.init.get(), false)) {
+                continue;
+            }
+
             if(NOVA_DEBUG) {
                 std::cerr << "  VARDECL INNER: name='" << decl.name << "' init=" << (decl.init ? "yes" : "no")
                           << " lastWasSet_=" << lastWasSet_
@@ -1181,7 +1198,7 @@ void HIRGenerator::visit(VarDeclStmt& node) {
             Expr* dynamicAliasSource = decl.init.get();
             bool preservesDynamicObject = true;
             while (auto* assertion =
-                       dynamic_cast<AsExpr*>(dynamicAliasSource)) {
+                       ast_cast<AsExpr>(dynamicAliasSource)) {
                 if (!assertion->targetType ||
                     assertion->targetType->kind != Type::Kind::Any) {
                     preservesDynamicObject = false;
@@ -1189,7 +1206,7 @@ void HIRGenerator::visit(VarDeclStmt& node) {
                 dynamicAliasSource = assertion->expression.get();
             }
             if (auto* source =
-                    dynamic_cast<Identifier*>(dynamicAliasSource);
+                    ast_cast<Identifier>(dynamicAliasSource);
                 preservesDynamicObject && source &&
                 dynamicObjectVars_.count(source->name) > 0) {
                 dynamicObjectVars_.insert(decl.name);
@@ -1209,13 +1226,13 @@ void HIRGenerator::visit(VarDeclStmt& node) {
             // (for example Object.getOwnPropertyNames(...).join(...) before a
             // descriptor declaration).  The call shape is stable and avoids
             // losing dynamic property access on the bound result.
-            if (auto* call = dynamic_cast<CallExpr*>(dynamicAliasSource)) {
+            if (auto* call = ast_cast<CallExpr>(dynamicAliasSource)) {
                 if (auto* member =
-                        dynamic_cast<MemberExpr*>(call->callee.get())) {
+                        ast_cast<MemberExpr>(call->callee.get())) {
                     auto* receiver =
-                        dynamic_cast<Identifier*>(member->object.get());
+                        ast_cast<Identifier>(member->object.get());
                     auto* method =
-                        dynamic_cast<Identifier*>(member->property.get());
+                        ast_cast<Identifier>(member->property.get());
                     if (receiver && method && receiver->name == "Object" &&
                         (method->name == "create" ||
                          method->name == "fromEntries" ||
@@ -1237,14 +1254,14 @@ void HIRGenerator::visit(VarDeclStmt& node) {
             // promoted to dynamic — otherwise `.length` on the result would
             // go through nova_dynamic_object_get_tagged and return undefined.
             if (auto* member =
-                    dynamic_cast<MemberExpr*>(dynamicAliasSource)) {
+                    ast_cast<MemberExpr>(dynamicAliasSource)) {
                 // Walk past `as any` wrappers on the receiver too.
                 Expr* receiver = member->object.get();
-                while (auto* a = dynamic_cast<AsExpr*>(receiver)) {
+                while (auto* a = ast_cast<AsExpr>(receiver)) {
                     receiver = a->expression.get();
                 }
                 if (auto* baseIdent =
-                        dynamic_cast<Identifier*>(receiver)) {
+                        ast_cast<Identifier>(receiver)) {
                     if (dynamicObjectVars_.count(baseIdent->name) > 0 &&
                         !lastWasRuntimeArray_) {
                         dynamicObjectVars_.insert(decl.name);
@@ -1281,7 +1298,7 @@ void HIRGenerator::visit(VarDeclStmt& node) {
             // Object.freeze/seal/preventExtensions return values.
             std::string integritySource = lastIntegrityObjectName_;
             if (integritySource.empty()) {
-                if (auto* sourceIdentifier = dynamic_cast<Identifier*>(decl.init.get())) {
+                if (auto* sourceIdentifier = ast_cast<Identifier>(decl.init.get())) {
                     integritySource = sourceIdentifier->name;
                 }
             }
@@ -1316,9 +1333,9 @@ void HIRGenerator::visit(VarDeclStmt& node) {
                 // aliases so direct calls settle the same capability.
                 if (lastWasPromiseWithResolvers_) {
                     if (auto* objectPattern =
-                            dynamic_cast<ObjectPattern*>(decl.pattern.get())) {
+                            ast_cast<ObjectPattern>(decl.pattern.get())) {
                         auto ptrType =
-                            std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                            HIRType::get(HIRType::Kind::Pointer);
                         for (auto& property : objectPattern->properties) {
                             std::string helper;
                             if (property.key == "promise") {
@@ -1351,7 +1368,7 @@ void HIRGenerator::visit(VarDeclStmt& node) {
                                 property.defaultValue.get());
 
                             if (auto* identifier =
-                                    dynamic_cast<IdentifierPattern*>(
+                                    ast_cast<IdentifierPattern>(
                                         property.value.get())) {
                                 if (property.key == "promise") {
                                     promiseVars_.insert(identifier->name);
@@ -1377,8 +1394,8 @@ void HIRGenerator::visit(VarDeclStmt& node) {
             // environment immediately; waiting until a return statement leaves
             // the variable holding only the generated function-name string.
             const bool directClosureExpression =
-                dynamic_cast<FunctionExpr*>(decl.init.get()) != nullptr ||
-                dynamic_cast<ArrowFunctionExpr*>(decl.init.get()) != nullptr;
+                ast_cast<FunctionExpr>(decl.init.get()) != nullptr ||
+                ast_cast<ArrowFunctionExpr>(decl.init.get()) != nullptr;
             if (directClosureExpression && !lastFunctionName_.empty() && currentFunction_ &&
                 lastFunctionName_ != currentFunction_->name &&
                 module_->closureEnvironments.count(lastFunctionName_) != 0) {
@@ -1400,8 +1417,8 @@ void HIRGenerator::visit(VarDeclStmt& node) {
             // lastFunctionName_ cursor.  Nested function generation and callee
             // visitation can restore that cursor before the declaration is
             // bound, while closureReturnedBy is stable module metadata.
-            if (auto* call = dynamic_cast<CallExpr*>(decl.init.get())) {
-                if (auto* callee = dynamic_cast<Identifier*>(call->callee.get())) {
+            if (auto* call = ast_cast<CallExpr>(decl.init.get())) {
+                if (auto* callee = ast_cast<Identifier>(call->callee.get())) {
                     auto returnedClosure =
                         module_->closureReturnedBy.find(callee->name);
                     if (returnedClosure != module_->closureReturnedBy.end()) {
@@ -1443,26 +1460,26 @@ void HIRGenerator::visit(VarDeclStmt& node) {
                     lastFunctionName_.clear();
                 };
             auto primordialPointerType =
-                std::make_shared<HIRType>(HIRType::Kind::Pointer);
+                HIRType::get(HIRType::Kind::Pointer);
             auto primordialStringType =
-                std::make_shared<HIRType>(HIRType::Kind::String);
+                HIRType::get(HIRType::Kind::String);
             auto primordialIntegerType =
-                std::make_shared<HIRType>(HIRType::Kind::I64);
+                HIRType::get(HIRType::Kind::I64);
             auto primordialBooleanType =
-                std::make_shared<HIRType>(HIRType::Kind::Bool);
+                HIRType::get(HIRType::Kind::Bool);
             auto primordialJSValueType =
-                std::make_shared<HIRType>(HIRType::Kind::JSValue);
+                HIRType::get(HIRType::Kind::JSValue);
             auto memberPath = [&](Expr* expression) {
                 std::vector<std::string> parts;
                 Expr* cursor = expression;
                 while (auto* member =
-                           dynamic_cast<MemberExpr*>(cursor)) {
+                           ast_cast<MemberExpr>(cursor)) {
                     if (member->isComputed) {
                         parts.clear();
                         break;
                     }
                     auto* property =
-                        dynamic_cast<Identifier*>(
+                        ast_cast<Identifier>(
                             member->property.get());
                     if (!property) {
                         parts.clear();
@@ -1471,7 +1488,7 @@ void HIRGenerator::visit(VarDeclStmt& node) {
                     parts.push_back(property->name);
                     cursor = member->object.get();
                 }
-                if (auto* base = dynamic_cast<Identifier*>(cursor)) {
+                if (auto* base = ast_cast<Identifier>(cursor)) {
                     parts.push_back(base->name);
                 } else {
                     parts.clear();
@@ -1506,7 +1523,7 @@ void HIRGenerator::visit(VarDeclStmt& node) {
                     "nova_value_is_array",
                     {primordialJSValueType}, primordialBooleanType);
             } else if (auto* bindCall =
-                           dynamic_cast<CallExpr*>(decl.init.get())) {
+                           ast_cast<CallExpr>(decl.init.get())) {
                 if (memberPath(bindCall->callee.get()) ==
                         "Function.prototype.call.bind" &&
                     !bindCall->arguments.empty()) {
@@ -1758,13 +1775,13 @@ void HIRGenerator::visit(VarDeclStmt& node) {
             }
 
             // Check if this is a runtime array assignment (from keys(), values(), entries())
-            if (auto* call = dynamic_cast<CallExpr*>(decl.init.get())) {
+            if (auto* call = ast_cast<CallExpr>(decl.init.get())) {
                 if (auto* member =
-                        dynamic_cast<MemberExpr*>(call->callee.get())) {
+                        ast_cast<MemberExpr>(call->callee.get())) {
                     auto* receiver =
-                        dynamic_cast<Identifier*>(member->object.get());
+                        ast_cast<Identifier>(member->object.get());
                     auto* method =
-                        dynamic_cast<Identifier*>(member->property.get());
+                        ast_cast<Identifier>(member->property.get());
                     if (receiver && method &&
                         dateTimeFormatVars_.count(receiver->name) > 0 &&
                         method->name == "formatToParts") {
@@ -1776,18 +1793,18 @@ void HIRGenerator::visit(VarDeclStmt& node) {
             }
 
             if (auto* initializer =
-                    dynamic_cast<Identifier*>(decl.init.get());
+                    ast_cast<Identifier>(decl.init.get());
                 initializer && initializer->name == "eval") {
                 evalAliasVars_.insert(decl.name);
             }
             if (auto* construction =
-                    dynamic_cast<NewExpr*>(decl.init.get())) {
+                    ast_cast<NewExpr>(decl.init.get())) {
                 auto* constructor =
-                    dynamic_cast<Identifier*>(
+                    ast_cast<Identifier>(
                         construction->callee.get());
                 if (constructor && constructor->name == "Function" &&
                     !construction->arguments.empty()) {
-                    if (auto* body = dynamic_cast<StringLiteral*>(
+                    if (auto* body = ast_cast<StringLiteral>(
                             construction->arguments.back().get())) {
                         for (char operation : {'+', '-', '*', '/', '%'}) {
                             if (body->value.find(operation) !=
@@ -1954,7 +1971,7 @@ void HIRGenerator::visit(VarDeclStmt& node) {
                 }
 
                 // Also create a normal alloca for within-block access (optimization)
-                auto i64Type = std::make_shared<HIRType>(HIRType::Kind::I64);
+                auto i64Type = HIRType::get(HIRType::Kind::I64);
                 auto alloca = builder_->createAlloca(i64Type.get(), decl.name);
                 symbolTable_[decl.name] = alloca;
                 if (initValue) {
@@ -1971,7 +1988,7 @@ void HIRGenerator::visit(VarDeclStmt& node) {
                 // undefined. Use a real tagged value instead of an uninitialized
                 // i64 slot (whose pointee type also used to dangle here).
                 if (!initValue) {
-                    auto jsType = std::make_shared<HIRType>(HIRType::Kind::JSValue);
+                    auto jsType = HIRType::get(HIRType::Kind::JSValue);
                     initValue = new HIRConstant(
                         jsType, HIRConstant::Kind::Integer,
                         static_cast<int64_t>(0x7ff9000000000000ULL));
@@ -2059,7 +2076,7 @@ void HIRGenerator::visit(UsingStmt& node) {
         if (initValue && initValue->type) {
             allocaType = initValue->type.get();
         } else {
-            auto anyType = std::make_shared<HIRType>(HIRType::Kind::Any);
+            auto anyType = HIRType::get(HIRType::Kind::Any);
             allocaType = anyType.get();
         }
 
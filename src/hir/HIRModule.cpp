@@ -1,9 +1,21 @@
 #include "nova/HIR/HIR.h"
+#include <array>
 #include <sstream>
 
 namespace nova::hir {
 
 // HIRType implementations
+HIRTypePtr HIRType::get(Kind kind) {
+    static const auto interned = [] {
+        std::array<HIRTypePtr, static_cast<size_t>(Kind::Unknown) + 1> types;
+        for (size_t i = 0; i < types.size(); ++i) {
+            types[i] = std::make_shared<HIRType>(static_cast<Kind>(i));
+        }
+        return types;
+    }();
+    return interned[static_cast<size_t>(kind)];
+}
+
 bool HIRType::isInteger() const {
     return kind >= Kind::I8 && kind <= Kind::USize;
 }
@@ -183,7 +195,7 @@ std::string HIRBasicBlock::toString() const {
 // HIRFunction implementations
 HIRBasicBlockPtr HIRFunction::createBasicBlock(const std::string& label) {
     auto block = std::make_shared<HIRBasicBlock>(label);
-    block->parentFunction = std::shared_ptr<HIRFunction>(this, [](HIRFunction*){});
+    block->parentFunction = unownedRef<HIRFunction>(this);
     basicBlocks.push_back(block);
     return block;
 }
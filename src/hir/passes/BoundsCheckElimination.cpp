@@ -0,0 +1,360 @@
+// BoundsCheckElimination.cpp - Range analysis for canonical array loops
+//
+// Element reads on runtime arrays lower to nova_value_array_at(), which
+// re-validates the receiver, normalizes negative indices and range-checks
+// on every access, and `a.length` in the loop condition is a fresh call on
+// every iteration. For the canonical counted loop
+//
+//   for (let i = <non-negative integer>; i < a.length; i++) { ... a[i] ... }
+//
+// both are provably redundant when the body cannot change the array or the
+// index: `i` starts non-negative, only grows by one, and the loop exits as
+// soon as it reaches a length that nothing in the body can modify. The
+// loop is therefore versioned on a single length read in the preheader;
+// the condition compares against that value and `a[i]` becomes
+// nova_value_array_at_unchecked(), which LLVMCodeGen emits as a plain
+// element load, leaving a loop LLVM can unroll and vectorize.
+//
+// The body check is a whitelist: no calls (which could run user code that
+// resizes or reassigns the array), no member access other than `a[i]` and
+// `a.length` (getters), no writes to `a`, `i` or any element, and no nested
+// functions, await or yield. Runtime arrays store untagged i64 slots, so
+// there is no separate hole check to remove.
+//
+// Typed arrays of a statically known kind get the same treatment with two
+// relaxations: their length and backing store are fixed at construction,
+// so `a[i] = v` is allowed in the body, and so are element reads and writes
+// on other typed arrays (which stay on the checked accessors). Inside such
+// a loop `a[i]` selects the nova_<kind>array_{get,set}_unchecked entry
+// points, which LLVMCodeGen turns into typed loads and stores.
+
+#include "nova/HIR/HIRGen_Internal.h"
+#define NOVA_DEBUG 0
+
+namespace nova::hir {
+
+namespace {
+
+class CanonicalLoopBodyCheck {
+public:
+    CanonicalLoopBodyCheck(
+        const std::string& array, const std::string& index,
+        const std::unordered_map<std::string, std::string>* typedArrays)
+        : array_(array), index_(index), typedArrays_(typedArrays) {}
+
+    bool statement(Stmt* node) {
+        if (!node) return true;
+        if (auto* block = ast_cast<BlockStmt>(node)) {
+            for (auto& child : block->statements) {
+                if (!statement(child.get())) return false;
+            }
+            return true;
+        }
+        if (auto* expressionStatement = ast_cast<ExprStmt>(node)) {
+            return expression(expressionStatement->expression.get());
+        }
+        if (auto* declaration = ast_cast<VarDeclStmt>(node)) {
+            for (auto& declarator : declaration->declarations) {
+                if (declarator.pattern || declarator.name == array_ ||
+                    declarator.name == index_ ||
+                    !expression(declarator.init.get())) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        if (auto* branch = ast_cast<IfStmt>(node)) {
+            return expression(branch->test.get()) &&
+                   statement(branch->consequent.get()) &&
+                   statement(branch->alternate.get());
+        }
+        if (auto* loop = ast_cast<WhileStmt>(node)) {
+            return expression(loop->test.get()) && statement(loop->body.get());
+        }
+        if (auto* loop = ast_cast<ForStmt>(node)) {
+            return statement(loop->init.get()) &&
+                   expression(loop->test.get()) &&
+                   expression(loop->update.get()) &&
+                   statement(loop->body.get());
+        }
+        if (auto* ret = ast_cast<ReturnStmt>(node)) {
+            return expression(ret->argument.get());
+        }
+        return ast_cast<BreakStmt>(node) != nullptr ||
+               ast_cast<ContinueStmt>(node) != nullptr;
+    }
+
+    bool expression(Expr* node) {
+        if (!node) return true;
+        if (ast_cast<NumberLiteral>(node) ||
+            ast_cast<BooleanLiteral>(node) ||
+            ast_cast<StringLiteral>(node)) {
+            return true;
+        }
+        if (ast_cast<Identifier>(node)) {
+            // A bare `a` could be stored somewhere and written through.
+            return static_cast<Identifier*>(node)->name != array_;
+        }
+        if (auto* parenthesized = ast_cast<ParenthesizedExpr>(node)) {
+            return expression(parenthesized->expression.get());
+        }
+        if (auto* binary = ast_cast<BinaryExpr>(node)) {
+            if (binary->op == BinaryExpr::Op::In ||
+                binary->op == BinaryExpr::Op::Instanceof) {
+                return false;
+            }
+            return expression(binary->left.get()) &&
+                   expression(binary->right.get());
+        }
+        if (auto* unary = ast_cast<UnaryExpr>(node)) {
+            if (unary->op == UnaryExpr::Op::Delete ||
+                unary->op == UnaryExpr::Op::Await) {
+                return false;
+            }
+            return expression(unary->operand.get());
+        }
+        if (auto* conditional = ast_cast<ConditionalExpr>(node)) {
+            return expression(conditional->test.get()) &&
+                   expression(conditional->consequent.get()) &&
+                   expression(conditional->alternate.get());
+        }
+        if (auto* update = ast_cast<UpdateExpr>(node)) {
+            return writableLocal(update->argument.get());
+        }
+        if (auto* assignment = ast_cast<AssignmentExpr>(node)) {
+            if (assignment->pattern) return false;
+            if (auto* member = ast_cast<MemberExpr>(assignment->left.get())) {
+                return assignment->op == AssignmentExpr::Op::Assign &&
+                       typedElement(member) && expression(assignment->right.get());
+            }
+            return writableLocal(assignment->left.get()) &&
+                   expression(assignment->right.get());
+        }
+        if (auto* member = ast_cast<MemberExpr>(node)) {
+            return isElementRead(member) || isLengthRead(member) ||
+                   typedElement(member);
+        }
+        return false;
+    }
+
+    bool isElementRead(MemberExpr* member) const {
+        auto* object = ast_cast<Identifier>(member->object.get());
+        auto* property = ast_cast<Identifier>(member->property.get());
+        return member->isComputed && !member->isOptional && object &&
+               property && object->name == array_ && property->name == index_;
+    }
+
+    bool isLengthRead(MemberExpr* member) const {
+        auto* object = ast_cast<Identifier>(member->object.get());
+        auto* property = ast_cast<Identifier>(member->property.get());
+        return !member->isComputed && !member->isOptional && object &&
+               property && object->name == array_ &&
+               property->name == "length";
+    }
+
+private:
+    bool writableLocal(Expr* target) const {
+        auto* identifier = ast_cast<Identifier>(target);
+        return identifier && identifier->name != array_ &&
+               identifier->name != index_;
+    }
+
+    // Element access on any typed array. Only reached in typed-array loops;
+    // indices other than `i` on the loop array keep their bounds check.
+    bool typedElement(MemberExpr* member) {
+        auto* object = ast_cast<Identifier>(member->object.get());
+        return typedArrays_ && member->isComputed && !member->isOptional &&
+               object && typedArrays_->count(object->name) &&
+               expression(member->property.get());
+    }
+
+    const std::string& array_;
+    const std::string& index_;
+    const std::unordered_map<std::string, std::string>* typedArrays_;
+};
+
+bool isIncrementOf(Expr* update, const std::string& index) {
+    if (auto* increment = ast_cast<UpdateExpr>(update)) {
+        auto* target = ast_cast<Identifier>(increment->argument.get());
+        return increment->op == UpdateExpr::Op::Increment && target &&
+               target->name == index;
+    }
+    if (auto* assignment = ast_cast<AssignmentExpr>(update)) {
+        auto* target = ast_cast<Identifier>(assignment->left.get());
+        auto* step = ast_cast<NumberLiteral>(assignment->right.get());
+        return assignment->op == AssignmentExpr::Op::AddAssign && target &&
+               target->name == index && step && step->value == 1.0;
+    }
+    return false;
+}
+
+} // namespace
+
+bool HIRGenerator::matchCanonicalArrayLoop(ForStmt& node, std::string& array,
+                                           std::string& index) {
+    auto* declaration = ast_cast<VarDeclStmt>(node.init.get());
+    if (!declaration || declaration->declarations.size() != 1 ||
+        declaration->kind == VarDeclStmt::Kind::Const) {
+        return false;
+    }
+    auto& declarator = declaration->declarations[0];
+    auto* start = ast_cast<NumberLiteral>(declarator.init.get());
+    if (declarator.pattern || declarator.name.empty() || !start ||
+        start->value < 0 ||
+        start->value != static_cast<double>(static_cast<int64_t>(start->value)) ||
+        start->raw.find_first_of(".eE") != std::string::npos) {
+        return false;
+    }
+
+    auto* test = ast_cast<BinaryExpr>(node.test.get());
+    if (!test || test->op != BinaryExpr::Op::Less) return false;
+    auto* counter = ast_cast<Identifier>(test->left.get());
+    auto* bound = ast_cast<MemberExpr>(test->right.get());
+    auto* receiver = bound ? ast_cast<Identifier>(bound->object.get()) : nullptr;
+    if (!counter || counter->name != declarator.name || !receiver ||
+        !isIncrementOf(node.update.get(), declarator.name)) {
+        return false;
+    }
+
+    // Static arrays already index their element storage directly, and
+    // tagged runtime arrays must go through the tagged accessor.
+    bool typedArray = typedArrayTypes_.count(receiver->name) != 0;
+    if ((!typedArray && (!runtimeArrayVars_.count(receiver->name) ||
+                         taggedRuntimeArrayVars_.count(receiver->name))) ||
+        receiver->name == declarator.name || currentGeneratorPtr_) {
+        return false;
+    }
+    CanonicalLoopBodyCheck check(receiver->name, declarator.name,
+                                 typedArray ? &typedArrayTypes_ : nullptr);
+    if (!check.isLengthRead(bound) || !check.statement(node.body.get())) {
+        return false;
+    }
+    array = receiver->name;
+    index = declarator.name;
+    return true;
+}
+
+void HIRGenerator::beginCanonicalArrayLoop(const std::string& array,
+                                           const std::string& index) {
+    if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Hoisting bounds checks for "
+                             << array << "[" << index << "]" << std::endl;
+
+    bool typedArray = typedArrayTypes_.count(array) != 0;
+    const std::string lengthName =
+        typedArray ? "nova_typedarray_length" : "nova_value_array_length";
+    auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+    auto intType = HIRType::get(HIRType::Kind::I64);
+    HIRFunction* lengthFunc = nullptr;
+    if (auto existing = module_->getFunction(lengthName)) {
+        lengthFunc = existing.get();
+    } else {
+        auto* functionType = new HIRFunctionType({ptrType}, intType);
+        auto created = module_->createFunction(lengthName, functionType);
+        created->linkage = HIRFunction::Linkage::External;
+        lengthFunc = created.get();
+    }
+
+    auto* length = builder_->createCall(
+        lengthFunc, {loadCanonicalLoopArray(array)}, "loop.len");
+    length->type = intType;
+    canonicalArrayLoops_.push_back({array, index, length, typedArray});
+}
+
+void HIRGenerator::endCanonicalArrayLoop() {
+    canonicalArrayLoops_.pop_back();
+}
+
+HIRValue* HIRGenerator::loadCanonicalLoopArray(const std::string& array) {
+    Identifier receiver(array);
+    receiver.accept(*this);
+    HIRValue* value = lastValue_;
+    if (!value || !value->type ||
+        value->type->kind != HIRType::Kind::JSValue) {
+        return value;
+    }
+    auto pointerType = HIRType::get(HIRType::Kind::Pointer);
+    HIRFunction* toObject = nullptr;
+    if (auto existing = module_->getFunction("nova_value_to_object")) {
+        toObject = existing.get();
+    } else {
+        auto* functionType = new HIRFunctionType({value->type}, pointerType);
+        auto created = module_->createFunction(
+            "nova_value_to_object", functionType);
+        created->linkage = HIRFunction::Linkage::External;
+        toObject = created.get();
+    }
+    return builder_->createCall(toObject, {value}, "loop.array");
+}
+
+bool HIRGenerator::tryCanonicalLoopAccess(MemberExpr& node) {
+    if (canonicalArrayLoops_.empty() || node.isOptional) return false;
+    auto* object = ast_cast<Identifier>(node.object.get());
+    auto* property = ast_cast<Identifier>(node.property.get());
+    if (!object || !property) return false;
+
+    // Innermost loop first: an inner loop may cover the same array with a
+    // different index variable.
+    for (auto it = canonicalArrayLoops_.rbegin();
+         it != canonicalArrayLoops_.rend(); ++it) {
+        if (it->array != object->name) continue;
+        if (!node.isComputed && property->name == "length") {
+            lastValue_ = it->length;
+            return true;
+        }
+        // Typed-array elements keep their kind-specific lowering and only
+        // switch to the unchecked accessor (isCanonicalTypedArrayElement).
+        if (!node.isComputed || property->name != it->index ||
+            it->typedArray) {
+            continue;
+        }
+
+        auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+        auto intType = HIRType::get(HIRType::Kind::I64);
+        HIRFunction* elementFunc = nullptr;
+        if (auto existing =
+                module_->getFunction("nova_value_array_at_unchecked")) {
+            elementFunc = existing.get();
+        } else {
+            auto* functionType = new HIRFunctionType({ptrType, intType}, intType);
+            auto created = module_->createFunction(
+                "nova_value_array_at_unchecked", functionType);
+            created->linkage = HIRFunction::Linkage::External;
+            elementFunc = created.get();
+        }
+        HIRValue* arrayValue = loadCanonicalLoopArray(it->array);
+        property->accept(*this);
+        HIRValue* rawElement = builder_->createCall(
+            elementFunc, {arrayValue, lastValue_}, "loop.elem");
+        rawElement->type = intType;
+
+        // Keep the element typing of the checked runtime-array path.
+        auto inferred = variableArrayElementTypes_.find(it->array);
+        if (inferred != variableArrayElementTypes_.end() &&
+            (inferred->second == "String" || inferred->second == "Bool")) {
+            auto elementType = HIRType::get(
+                inferred->second == "String" ? HIRType::Kind::String
+                                             : HIRType::Kind::Bool);
+            lastValue_ = builder_->createCast(
+                rawElement, elementType.get(), "loop.elem.typed");
+        } else {
+            lastValue_ = rawElement;
+        }
+        return true;
+    }
+    return false;
+}
+
+bool HIRGenerator::isCanonicalTypedArrayElement(const std::string& array,
+                                                Expr* index) const {
+    auto* identifier = ast_cast<Identifier>(index);
+    if (!identifier) return false;
+    for (const auto& loop : canonicalArrayLoops_) {
+        if (loop.typedArray && loop.array == array &&
+            loop.index == identifier->name) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace nova::hir
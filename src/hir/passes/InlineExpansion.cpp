@@ -1,4 +1,653 @@
-// Placeholder inline expansion pass
+// InlineExpansion.cpp - HIR-level inline expansion
+//
+// Two expansions happen while HIR is generated, because both need the AST of
+// the callee and the caller's symbol table:
+//
+//   * Array higher-order builtins (map, filter, forEach, reduce, find,
+//     findIndex, some, every) whose callback is an inline arrow function are
+//     specialized into a plain counted loop with the callback body emitted in
+//     place. LLVM otherwise only sees an opaque function pointer handed to
+//     nova_value_array_* and can never inline or vectorize the callback.
+//   * Direct calls to tiny `number`-typed functions of the form
+//     `function f(a: number, ...): number { return <expr>; }` are replaced by
+//     the returned expression evaluated over the bound arguments.
+//
+// The cost model is deliberately JS-aware rather than size-only: a body is
+// inlinable when it is small AND every operation in it keeps the integer
+// representation of the outlined version (no division, exponentiation, float
+// literals, strings, calls, member access, `this`/`arguments`, or nested
+// functions). `%` is only accepted with a non-zero constant divisor: an
+// integer remainder by zero is undefined in LLVM, where JS yields NaN.
+// Anything else falls back to the runtime call, so inlining never changes
+// observable semantics.
+
+#include "nova/HIR/HIRGen_Internal.h"
+#define NOVA_DEBUG 0
+
 namespace nova::hir {
-// Placeholder for inline expansion
+
+namespace {
+
+// Upper bound on AST nodes in an inlined body. Callbacks above this size gain
+// little from inlining and blow up the caller when used in several places.
+constexpr size_t kInlineNodeBudget = 40;
+
+HIRFunction* runtimeFunction(HIRModule* module, const std::string& name,
+                             std::vector<HIRTypePtr> paramTypes,
+                             HIRTypePtr returnType) {
+    if (auto existing = module->getFunction(name)) {
+        return existing.get();
+    }
+    auto* functionType = new HIRFunctionType(std::move(paramTypes), returnType);
+    auto created = module->createFunction(name, functionType);
+    created->linkage = HIRFunction::Linkage::External;
+    return created.get();
+}
+
+bool isIntegralKind(HIRType::Kind kind) {
+    switch (kind) {
+        case HIRType::Kind::I8:
+        case HIRType::Kind::I16:
+        case HIRType::Kind::I32:
+        case HIRType::Kind::I64:
+            return true;
+        default:
+            return false;
+    }
+}
+
+Expr* stripParentheses(Expr* expression) {
+    while (auto* parenthesized = ast_cast<ParenthesizedExpr>(expression)) {
+        expression = parenthesized->expression.get();
+    }
+    return expression;
+}
+
+// True when the expression produces a number (as opposed to a boolean) in
+// the integer subset, i.e. it may be stored into an I64 array slot.
+bool producesNumber(Expr* expression) {
+    expression = stripParentheses(expression);
+    if (auto* binary = ast_cast<BinaryExpr>(expression)) {
+        switch (binary->op) {
+            case BinaryExpr::Op::Add:
+            case BinaryExpr::Op::Sub:
+            case BinaryExpr::Op::Mul:
+            case BinaryExpr::Op::Mod:
+            case BinaryExpr::Op::BitAnd:
+            case BinaryExpr::Op::BitOr:
+            case BinaryExpr::Op::BitXor:
+            case BinaryExpr::Op::LeftShift:
+            case BinaryExpr::Op::RightShift:
+                return true;
+            default:
+                return false;
+        }
+    }
+    if (auto* unary = ast_cast<UnaryExpr>(expression)) {
+        return unary->op == UnaryExpr::Op::Minus ||
+               unary->op == UnaryExpr::Op::BitNot;
+    }
+    if (auto* conditional = ast_cast<ConditionalExpr>(expression)) {
+        return producesNumber(conditional->consequent.get()) &&
+               producesNumber(conditional->alternate.get());
+    }
+    return ast_cast<NumberLiteral>(expression) != nullptr ||
+           ast_cast<Identifier>(expression) != nullptr ||
+           ast_cast<UpdateExpr>(expression) != nullptr ||
+           ast_cast<AssignmentExpr>(expression) != nullptr;
+}
+
+// Walks a candidate body and decides whether it stays inside the integer
+// subset described at the top of this file. Identifiers that are not bound
+// parameters are collected so the caller can check their storage.
+class InlineCostModel {
+public:
+    InlineCostModel(const std::unordered_set<std::string>& parameters,
+                    bool allowAssignments)
+        : parameters_(parameters), allowAssignments_(allowAssignments) {}
+
+    bool accept(Expr* expression) {
+        if (!expression || ++nodes_ > kInlineNodeBudget) return false;
+
+        if (auto* number = ast_cast<NumberLiteral>(expression)) {
+            const bool explicitFloat =
+                number->raw.find_first_of(".eE") != std::string::npos &&
+                number->raw.rfind("0x", 0) != 0 &&
+                number->raw.rfind("0X", 0) != 0;
+            return !explicitFloat &&
+                   number->value == static_cast<double>(
+                       static_cast<int64_t>(number->value));
+        }
+        if (auto* identifier = ast_cast<Identifier>(expression)) {
+            return acceptName(identifier->name);
+        }
+        if (auto* parenthesized = ast_cast<ParenthesizedExpr>(expression)) {
+            return accept(parenthesized->expression.get());
+        }
+        if (auto* binary = ast_cast<BinaryExpr>(expression)) {
+            switch (binary->op) {
+                case BinaryExpr::Op::Div:
+                case BinaryExpr::Op::Pow:
+                case BinaryExpr::Op::UnsignedRightShift:
+                case BinaryExpr::Op::NullishCoalescing:
+                case BinaryExpr::Op::In:
+                case BinaryExpr::Op::Instanceof:
+                    return false;
+                case BinaryExpr::Op::Mod: {
+                    auto* divisor = ast_cast<NumberLiteral>(
+                        stripParentheses(binary->right.get()));
+                    return divisor && divisor->value != 0 &&
+                           accept(binary->left.get()) &&
+                           accept(binary->right.get());
+                }
+                default:
+                    return accept(binary->left.get()) &&
+                           accept(binary->right.get());
+            }
+        }
+        if (auto* unary = ast_cast<UnaryExpr>(expression)) {
+            if (unary->op != UnaryExpr::Op::Minus &&
+                unary->op != UnaryExpr::Op::Not &&
+                unary->op != UnaryExpr::Op::BitNot) {
+                return false;
+            }
+            return accept(unary->operand.get());
+        }
+        if (auto* conditional = ast_cast<ConditionalExpr>(expression)) {
+            return accept(conditional->test.get()) &&
+                   accept(conditional->consequent.get()) &&
+                   accept(conditional->alternate.get());
+        }
+        if (auto* update = ast_cast<UpdateExpr>(expression)) {
+            auto* target = ast_cast<Identifier>(update->argument.get());
+            return allowAssignments_ && target && acceptName(target->name);
+        }
+        if (auto* assignment = ast_cast<AssignmentExpr>(expression)) {
+            auto* target = ast_cast<Identifier>(assignment->left.get());
+            if (!allowAssignments_ || !target || assignment->pattern) {
+                return false;
+            }
+            switch (assignment->op) {
+                case AssignmentExpr::Op::Assign:
+                case AssignmentExpr::Op::AddAssign:
+                case AssignmentExpr::Op::SubAssign:
+                case AssignmentExpr::Op::MulAssign:
+                case AssignmentExpr::Op::BitAndAssign:
+                case AssignmentExpr::Op::BitOrAssign:
+                case AssignmentExpr::Op::BitXorAssign:
+                    break;
+                default:
+                    return false;
+            }
+            return acceptName(target->name) &&
+                   accept(assignment->right.get());
+        }
+        return false;
+    }
+
+    const std::vector<std::string>& freeNames() const { return freeNames_; }
+
+private:
+    bool acceptName(const std::string& name) {
+        if (name == "arguments" || name == "undefined" || name == "NaN" ||
+            name == "Infinity" || name == "globalThis") {
+            return false;
+        }
+        if (parameters_.count(name) == 0) {
+            freeNames_.push_back(name);
+        }
+        return true;
+    }
+
+    const std::unordered_set<std::string>& parameters_;
+    bool allowAssignments_;
+    size_t nodes_ = 0;
+    std::vector<std::string> freeNames_;
+};
+
+// Extracts the expressions that make up an arrow body: `x => e` and
+// `x => { return e; }` yield {e}; statement bodies are accepted only when
+// `allowStatements` is set (forEach) and consist of expression statements.
+bool collectBodyExpressions(Stmt* body, bool allowStatements,
+                            std::vector<Expr*>& expressions,
+                            bool& hasResult) {
+    hasResult = false;
+    if (auto* expressionStatement = ast_cast<ExprStmt>(body)) {
+        expressions.push_back(expressionStatement->expression.get());
+        hasResult = true;
+        return true;
+    }
+    auto* block = ast_cast<BlockStmt>(body);
+    if (!block) return false;
+    for (size_t i = 0; i < block->statements.size(); ++i) {
+        Stmt* statement = block->statements[i].get();
+        if (auto* ret = ast_cast<ReturnStmt>(statement)) {
+            if (!ret->argument || i + 1 != block->statements.size()) {
+                return false;
+            }
+            expressions.push_back(ret->argument.get());
+            hasResult = true;
+            return true;
+        }
+        auto* expressionStatement = ast_cast<ExprStmt>(statement);
+        if (!allowStatements || !expressionStatement) return false;
+        expressions.push_back(expressionStatement->expression.get());
+    }
+    return allowStatements;
+}
+
+} // namespace
+
+bool HIRGenerator::isInlinableIntegerBinding(const std::string& name) {
+    if (staticNullishVariables_.count(name) ||
+        importedStringConstants_.count(name) ||
+        importedBooleanConstants_.count(name) ||
+        functionReferences_.count(name) || runtimeArrayVars_.count(name) ||
+        generatorVarSlots_.count(name)) {
+        return false;
+    }
+    auto found = symbolTable_.find(name);
+    if (found == symbolTable_.end() || !found->second) return false;
+    HIRValue* storage = found->second;
+    if (auto* parameter = dynamic_cast<HIRParameter*>(storage)) {
+        return parameter->type && isIntegralKind(parameter->type->kind);
+    }
+    auto* instruction = dynamic_cast<HIRInstruction*>(storage);
+    if (!instruction ||
+        instruction->opcode != HIRInstruction::Opcode::Alloca) {
+        return false;
+    }
+    auto* pointer = dynamic_cast<HIRPointerType*>(instruction->type.get());
+    return pointer && pointer->pointeeType &&
+           isIntegralKind(pointer->pointeeType->kind);
+}
+
+bool HIRGenerator::tryInlineArrayCallback(CallExpr& node,
+                                          const std::string& methodName,
+                                          HIRValue* array) {
+    enum class Shape { Map, Filter, ForEach, Reduce, Find, FindIndex, Some, Every };
+    static const std::unordered_map<std::string, Shape> shapes = {
+        {"map", Shape::Map}, {"filter", Shape::Filter},
+        {"forEach", Shape::ForEach}, {"reduce", Shape::Reduce},
+        {"find", Shape::Find}, {"findIndex", Shape::FindIndex},
+        {"some", Shape::Some}, {"every", Shape::Every},
+    };
+    auto shapeIt = shapes.find(methodName);
+    if (shapeIt == shapes.end() || !array || currentGeneratorPtr_ ||
+        node.arguments.empty()) {
+        return false;
+    }
+    const Shape shape = shapeIt->second;
+    const bool isReduce = shape == Shape::Reduce;
+    if (node.arguments.size() != (isReduce ? 2u : 1u)) return false;
+
+    auto* callback = ast_cast<ArrowFunctionExpr>(node.arguments[0].get());
+    if (!callback || callback->isAsync || !callback->restParam.empty() ||
+        !callback->body) {
+        return false;
+    }
+    // (element[, index]) for the predicate/transform shapes and
+    // (accumulator, element[, index]) for reduce. The trailing `array`
+    // parameter would need the receiver materialized as a value.
+    const size_t minParams = isReduce ? 2 : 1;
+    const size_t maxParams = isReduce ? 3 : 2;
+    if (callback->params.size() < minParams ||
+        callback->params.size() > maxParams) {
+        return false;
+    }
+    std::unordered_set<std::string> parameters;
+    for (size_t i = 0; i < callback->params.size(); ++i) {
+        const std::string& name = callback->params[i];
+        if ((i < callback->paramPatterns.size() && callback->paramPatterns[i]) ||
+            (i < callback->defaultValues.size() && callback->defaultValues[i]) ||
+            (i < callback->paramTypes.size() && callback->paramTypes[i] &&
+             callback->paramTypes[i]->kind != Type::Kind::Number) ||
+            name.empty() || !parameters.insert(name).second ||
+            symbolTable_.count(name) || staticNullishVariables_.count(name) ||
+            importedNumberConstants_.count(name) ||
+            importedStringConstants_.count(name) ||
+            importedBooleanConstants_.count(name) ||
+            functionReferences_.count(name) || module_->getFunction(name)) {
+            return false;
+        }
+    }
+
+    std::vector<Expr*> expressions;
+    bool hasResult = false;
+    if (!collectBodyExpressions(callback->body.get(), shape == Shape::ForEach,
+                                expressions, hasResult)) {
+        return false;
+    }
+    if (shape != Shape::ForEach && !hasResult) return false;
+
+    InlineCostModel cost(parameters, true);
+    for (Expr* expression : expressions) {
+        if (!cost.accept(expression)) return false;
+    }
+    if (isReduce && !cost.accept(node.arguments[1].get())) return false;
+    for (const auto& name : cost.freeNames()) {
+        if (!isInlinableIntegerBinding(name)) return false;
+    }
+    if ((shape == Shape::Map || isReduce) &&
+        !producesNumber(expressions.back())) {
+        return false;
+    }
+
+    if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Inlining " << methodName
+                             << " callback into a counted loop" << std::endl;
+
+    auto ptrType = HIRType::get(HIRType::Kind::Pointer);
+    auto intType = HIRType::get(HIRType::Kind::I64);
+    auto voidType = HIRType::get(HIRType::Kind::Void);
+    auto* lengthFunc = runtimeFunction(
+        module_, "nova_value_array_length", {ptrType}, intType);
+    auto* elementFunc = runtimeFunction(
+        module_, "nova_value_array_at", {ptrType, intType}, intType);
+
+    // Everything the loop mutates lives in allocas so that MIR sees the same
+    // shape as a source-level for loop.
+    auto* slotType = HIRType::get(HIRType::Kind::I64).get();
+    auto* length = builder_->createCall(lengthFunc, {array}, "inline.len");
+    length->type = intType;
+    auto* indexSlot = builder_->createAlloca(slotType, "inline.idx");
+    builder_->createStore(builder_->createIntConstant(0), indexSlot);
+
+    HIRValue* resultArray = nullptr;
+    HIRInstruction* resultSlot = nullptr;
+    HIRInstruction* foundSlot = nullptr;
+    switch (shape) {
+        case Shape::Map: {
+            auto* create = runtimeFunction(
+                module_, "nova_value_array_create", {intType}, ptrType);
+            resultArray = builder_->createCall(create, {length}, "inline.map");
+            resultArray->type = ptrType;
+            break;
+        }
+        case Shape::Filter: {
+            auto* create = runtimeFunction(
+                module_, "nova_value_array_create", {intType}, ptrType);
+            resultArray = builder_->createCall(
+                create, {builder_->createIntConstant(0)}, "inline.filter");
+            resultArray->type = ptrType;
+            break;
+        }
+        case Shape::Reduce:
+            node.arguments[1]->accept(*this);
+            resultSlot = builder_->createAlloca(slotType, "inline.acc");
+            builder_->createStore(lastValue_, resultSlot);
+            break;
+        case Shape::Find:
+            resultSlot = builder_->createAlloca(slotType, "inline.found");
+            foundSlot = builder_->createAlloca(slotType, "inline.hit");
+            builder_->createStore(builder_->createIntConstant(0), resultSlot);
+            builder_->createStore(builder_->createIntConstant(0), foundSlot);
+            break;
+        case Shape::FindIndex:
+            resultSlot = builder_->createAlloca(slotType, "inline.index");
+            builder_->createStore(builder_->createIntConstant(-1), resultSlot);
+            break;
+        case Shape::Some:
+        case Shape::Every:
+            resultSlot = builder_->createAlloca(slotType, "inline.any");
+            builder_->createStore(
+                builder_->createIntConstant(shape == Shape::Every ? 1 : 0),
+                resultSlot);
+            break;
+        case Shape::ForEach:
+            break;
+    }
+
+    auto* condBlock = currentFunction_->createBasicBlock("inline.cond").get();
+    auto* bodyBlock = currentFunction_->createBasicBlock("inline.body").get();
+    auto* updateBlock = currentFunction_->createBasicBlock("inline.update").get();
+    auto* exitBlock = shape == Shape::Find || shape == Shape::FindIndex ||
+                              shape == Shape::Some || shape == Shape::Every
+        ? currentFunction_->createBasicBlock("inline.exit").get()
+        : nullptr;
+    auto* endBlock = currentFunction_->createBasicBlock("inline.end").get();
+
+    builder_->createBr(condBlock);
+    builder_->setInsertPoint(condBlock);
+    auto* index = builder_->createLoad(indexSlot, "inline.i");
+    builder_->createCondBr(builder_->createLt(index, length), bodyBlock, endBlock);
+
+    builder_->setInsertPoint(bodyBlock);
+    auto* elementIndex = builder_->createLoad(indexSlot, "inline.i");
+    auto* element = builder_->createCall(
+        elementFunc, {array, elementIndex}, "inline.elem");
+    element->type = intType;
+
+    // Bind the callback parameters as ordinary locals of the caller.
+    std::vector<std::string> bound;
+    auto bindParameter = [&](size_t position, HIRValue* value) {
+        if (position >= callback->params.size()) return;
+        auto* slot = builder_->createAlloca(slotType, callback->params[position]);
+        builder_->createStore(value, slot);
+        symbolTable_[callback->params[position]] = slot;
+        bound.push_back(callback->params[position]);
+    };
+    size_t firstElementParam = 0;
+    if (isReduce) {
+        bindParameter(0, builder_->createLoad(resultSlot, "inline.acc"));
+        firstElementParam = 1;
+    }
+    bindParameter(firstElementParam, element);
+    bindParameter(firstElementParam + 1, elementIndex);
+
+    for (size_t i = 0; i + 1 < expressions.size(); ++i) {
+        expressions[i]->accept(*this);
+    }
+    expressions.back()->accept(*this);
+    HIRValue* result = lastValue_;
+
+    switch (shape) {
+        case Shape::Map: {
+            auto* set = runtimeFunction(
+                module_, "value_array_set", {ptrType, intType, intType},
+                voidType);
+            builder_->createCall(set, {resultArray, elementIndex, result});
+            builder_->createBr(updateBlock);
+            break;
+        }
+        case Shape::Filter: {
+            auto* keepBlock = currentFunction_->createBasicBlock("inline.keep").get();
+            builder_->createCondBr(toBoolean(result), keepBlock, updateBlock);
+            builder_->setInsertPoint(keepBlock);
+            auto* push = runtimeFunction(
+                module_, "nova_value_array_push", {ptrType, intType}, intType);
+            builder_->createCall(push, {resultArray, element});
+            builder_->createBr(updateBlock);
+            break;
+        }
+        case Shape::Reduce:
+            builder_->createStore(result, resultSlot);
+            builder_->createBr(updateBlock);
+            break;
+        case Shape::Find:
+        case Shape::FindIndex:
+        case Shape::Some: {
+            auto* hitBlock = currentFunction_->createBasicBlock("inline.hit").get();
+            builder_->createCondBr(toBoolean(result), hitBlock, updateBlock);
+            builder_->setInsertPoint(hitBlock);
+            if (shape == Shape::Find) {
+                builder_->createStore(element, resultSlot);
+                builder_->createStore(builder_->createIntConstant(1), foundSlot);
+            } else if (shape == Shape::FindIndex) {
+                builder_->createStore(elementIndex, resultSlot);
+            } else {
+                builder_->createStore(builder_->createIntConstant(1), resultSlot);
+            }
+            builder_->createBr(exitBlock);
+            break;
+        }
+        case Shape::Every: {
+            auto* missBlock = currentFunction_->createBasicBlock("inline.miss").get();
+            builder_->createCondBr(toBoolean(result), updateBlock, missBlock);
+            builder_->setInsertPoint(missBlock);
+            builder_->createStore(builder_->createIntConstant(0), resultSlot);
+            builder_->createBr(exitBlock);
+            break;
+        }
+        case Shape::ForEach:
+            builder_->createBr(updateBlock);
+            break;
+    }
+
+    builder_->setInsertPoint(updateBlock);
+    auto* current = builder_->createLoad(indexSlot, "inline.i");
+    builder_->createStore(
+        builder_->createAdd(current, builder_->createIntConstant(1)), indexSlot);
+    builder_->createBr(condBlock);
+
+    if (exitBlock) {
+        builder_->setInsertPoint(exitBlock);
+        builder_->createBr(endBlock);
+    }
+    builder_->setInsertPoint(endBlock);
+
+    for (const auto& name : bound) {
+        symbolTable_.erase(name);
+    }
+
+    switch (shape) {
+        case Shape::Map:
+        case Shape::Filter:
+            lastValue_ = resultArray;
+            lastWasRuntimeArray_ = true;
+            lastWasTaggedRuntimeArray_ = false;
+            break;
+        case Shape::Find: {
+            // find() yields `undefined` when nothing matched, so the result
+            // keeps the tagged representation of the runtime path.
+            auto jsType = HIRType::get(HIRType::Kind::JSValue);
+            auto* merged = builder_->createAlloca(jsType.get(), "inline.find");
+            auto* hitBlock = currentFunction_->createBasicBlock("inline.found").get();
+            auto* missBlock = currentFunction_->createBasicBlock("inline.notfound").get();
+            auto* joinBlock = currentFunction_->createBasicBlock("inline.join").get();
+            auto* hit = builder_->createLoad(foundSlot, "inline.hit");
+            builder_->createCondBr(toBoolean(hit), hitBlock, missBlock);
+            builder_->setInsertPoint(hitBlock);
+            builder_->createStore(
+                toJSValue(builder_->createLoad(resultSlot, "inline.found")),
+                merged);
+            builder_->createBr(joinBlock);
+            builder_->setInsertPoint(missBlock);
+            builder_->createStore(
+                toJSValue(builder_->createUndefinedConstant(jsType.get())),
+                merged);
+            builder_->createBr(joinBlock);
+            builder_->setInsertPoint(joinBlock);
+            lastValue_ = builder_->createLoad(merged, "inline.find");
+            lastValue_->type = jsType;
+            break;
+        }
+        case Shape::Reduce:
+        case Shape::FindIndex:
+        case Shape::Some:
+        case Shape::Every:
+            lastValue_ = builder_->createLoad(resultSlot, "inline.result");
+            lastValue_->type = intType;
+            break;
+        case Shape::ForEach:
+            lastValue_ = builder_->createIntConstant(0);
+            break;
+    }
+    return true;
+}
+
+bool HIRGenerator::tryInlineDirectCall(CallExpr& node) {
+    auto* callee = ast_cast<Identifier>(node.callee.get());
+    if (!callee || currentGeneratorPtr_) return false;
+    auto declIt = functionDeclarations_.find(callee->name);
+    if (declIt == functionDeclarations_.end() || !declIt->second) return false;
+    FunctionDecl* decl = declIt->second;
+
+    // Shadowed names, closures and anything with a non-trivial calling
+    // convention keep the ordinary call. Every declaration registers itself
+    // in functionReferences_; only a rebinding to another function counts.
+    auto reference = functionReferences_.find(callee->name);
+    if (symbolTable_.count(callee->name) ||
+        (reference != functionReferences_.end() &&
+         reference->second != callee->name) ||
+        closureEnvironments_.count(callee->name) ||
+        module_->closureEnvironments.count(callee->name) ||
+        generatorFuncs_.count(callee->name) ||
+        asyncFuncs_.count(callee->name) || decl->isAsync ||
+        decl->isGenerator || !decl->restParam.empty() ||
+        !decl->typeParams.empty() || !decl->returnType ||
+        decl->returnType->kind != Type::Kind::Number ||
+        decl->params.size() != node.arguments.size()) {
+        return false;
+    }
+    std::unordered_set<std::string> parameters;
+    for (size_t i = 0; i < decl->params.size(); ++i) {
+        if ((i < decl->paramPatterns.size() && decl->paramPatterns[i]) ||
+            (i < decl->defaultValues.size() && decl->defaultValues[i]) ||
+            i >= decl->paramTypes.size() || !decl->paramTypes[i] ||
+            decl->paramTypes[i]->kind != Type::Kind::Number ||
+            !parameters.insert(decl->params[i]).second) {
+            return false;
+        }
+    }
+
+    auto* block = ast_cast<BlockStmt>(decl->body.get());
+    if (!block || block->statements.size() != 1) return false;
+    auto* ret = ast_cast<ReturnStmt>(block->statements[0].get());
+    if (!ret || !ret->argument || !producesNumber(ret->argument.get())) {
+        return false;
+    }
+    InlineCostModel cost(parameters, false);
+    if (!cost.accept(ret->argument.get()) || !cost.freeNames().empty()) {
+        return false;
+    }
+
+    // Arguments must be integral too, otherwise the outlined call would
+    // have converted them at the parameter boundary.
+    static const std::unordered_set<std::string> noParameters;
+    for (auto& argument : node.arguments) {
+        InlineCostModel argumentCost(noParameters, false);
+        if (!argumentCost.accept(argument.get())) return false;
+        for (const auto& name : argumentCost.freeNames()) {
+            if (!isInlinableIntegerBinding(name)) return false;
+        }
+    }
+
+    if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Inlining direct call to "
+                             << callee->name << std::endl;
+
+    // Arguments are evaluated left to right exactly once, as for a call,
+    // before any of them becomes visible under its parameter name.
+    std::vector<HIRValue*> values;
+    values.reserve(node.arguments.size());
+    for (auto& argument : node.arguments) {
+        argument->accept(*this);
+        values.push_back(lastValue_);
+    }
+
+    std::unordered_map<std::string, HIRValue*> shadowed;
+    auto* slotType = HIRType::get(HIRType::Kind::I64).get();
+    for (size_t i = 0; i < decl->params.size(); ++i) {
+        const std::string& name = decl->params[i];
+        auto existing = symbolTable_.find(name);
+        if (existing != symbolTable_.end()) {
+            shadowed[name] = existing->second;
+        }
+        auto* slot = builder_->createAlloca(slotType, name);
+        builder_->createStore(values[i], slot);
+        symbolTable_[name] = slot;
+    }
+
+    ret->argument->accept(*this);
+
+    for (const auto& name : decl->params) {
+        auto previous = shadowed.find(name);
+        if (previous != shadowed.end()) {
+            symbolTable_[name] = previous->second;
+        } else {
+            symbolTable_.erase(name);
+        }
+    }
+    return true;
+}
+
 } // namespace nova::hir
@@ -0,0 +1,269 @@
+// ScalarReplacement.cpp - Scalar replacement of non-escaping literal aggregates
+//
+// An array or object literal that is immediately destructured can never be
+// observed by anything else: no name is bound to it, and the
+// destructuring pattern reads each slot exactly once. Typical sources are
+// tuple-style swaps and multi-value temporaries:
+//
+//   const [lo, hi] = [a, b];
+//   [a, b] = [b, a];
+//   const {x, y} = {x: px + 1, y: py - 1};
+//
+// Lowering these through the generic path heap-allocates the aggregate
+// (nova_value_array_create / a struct literal) only to read it back. Here
+// the literal is never materialized: its element expressions are
+// evaluated into SSA values in source order, and the pattern is bound
+// directly to those values. Nested literal/pattern pairs are replaced
+// recursively. Default values are still applied while binding, after all
+// element expressions have run, as the language requires.
+//
+// Anything the escape check below cannot prove safe (spreads, holes,
+// computed keys, accessors, rest patterns, function values, `__proto__`
+// keys, pattern keys that would fall through to Object.prototype, or a
+// destructuring assignment whose result is used) keeps the allocating
+// path.
+
+#include "nova/HIR/HIRGen_Internal.h"
+#define NOVA_DEBUG 0
+
+namespace nova::hir {
+
+namespace {
+
+bool literalPropertyKey(const ObjectExpr::Property& property, std::string& key) {
+    if (property.isComputed ||
+        property.kind != ObjectExpr::Property::Kind::Init ||
+        !property.value || ast_cast<SpreadExpr>(property.value.get())) {
+        return false;
+    }
+    if (auto* identifier = ast_cast<Identifier>(property.key.get())) {
+        key = identifier->name;
+        return true;
+    }
+    if (auto* literal = ast_cast<StringLiteral>(property.key.get())) {
+        key = literal->value;
+        return true;
+    }
+    return false;
+}
+
+// Values whose binding carries extra generator state (closure environments,
+// function references, class metadata) must go through the ordinary
+// variable path, so they disqualify the whole literal.
+bool isPlainValue(Expr* expression) {
+    return expression &&
+           !ast_cast<ArrowFunctionExpr>(expression) &&
+           !ast_cast<FunctionExpr>(expression) &&
+           !ast_cast<ClassExpr>(expression) &&
+           !ast_cast<SpreadExpr>(expression);
+}
+
+// A pattern key missing from the literal reads through the prototype
+// chain, so it is only `undefined` if Object.prototype lacks it too.
+bool isObjectPrototypeKey(const std::string& key) {
+    static const std::unordered_set<std::string> keys = {
+        "constructor", "hasOwnProperty", "isPrototypeOf",
+        "propertyIsEnumerable", "toLocaleString", "toString", "valueOf",
+        "__proto__", "__defineGetter__", "__defineSetter__",
+        "__lookupGetter__", "__lookupSetter__",
+    };
+    return keys.count(key) != 0;
+}
+
+Pattern* stripDefault(Pattern* pattern) {
+    while (auto* assignment = ast_cast<AssignmentPattern>(pattern)) {
+        pattern = assignment->left.get();
+    }
+    return pattern;
+}
+
+} // namespace
+
+bool HIRGenerator::canScalarReplace(Pattern* pattern, Expr* init) {
+    while (auto* parenthesized = ast_cast<ParenthesizedExpr>(init)) {
+        init = parenthesized->expression.get();
+    }
+    pattern = stripDefault(pattern);
+    if (!pattern || !init) return false;
+
+    if (auto* arrayPattern = ast_cast<ArrayPattern>(pattern)) {
+        auto* array = ast_cast<ArrayExpr>(init);
+        if (!array || arrayPattern->rest) return false;
+        for (size_t i = 0; i < array->elements.size(); ++i) {
+            Expr* element = array->elements[i].get();
+            if (!isPlainValue(element)) return false;
+            Pattern* target = i < arrayPattern->elements.size()
+                ? stripDefault(arrayPattern->elements[i].get())
+                : nullptr;
+            if (target && !ast_cast<IdentifierPattern>(target) &&
+                !canScalarReplace(target, element)) {
+                return false;
+            }
+        }
+        for (size_t i = array->elements.size();
+             i < arrayPattern->elements.size(); ++i) {
+            Pattern* target = stripDefault(arrayPattern->elements[i].get());
+            if (target && !ast_cast<IdentifierPattern>(target)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    if (auto* objectPattern = ast_cast<ObjectPattern>(pattern)) {
+        auto* object = ast_cast<ObjectExpr>(init);
+        if (!object || objectPattern->rest) return false;
+        std::unordered_map<std::string, Expr*> values;
+        for (auto& property : object->properties) {
+            std::string key;
+            // `__proto__: v` sets the prototype rather than defining a
+            // property.
+            if (!literalPropertyKey(property, key) || key == "__proto__" ||
+                !isPlainValue(property.value.get())) {
+                return false;
+            }
+            values[key] = property.value.get();
+        }
+        std::unordered_set<std::string> seen;
+        for (auto& property : objectPattern->properties) {
+            if (!seen.insert(property.key).second) return false;
+            Pattern* target = stripDefault(property.value.get());
+            auto found = values.find(property.key);
+            if (found == values.end() && isObjectPrototypeKey(property.key)) {
+                return false;
+            }
+            if (target && !ast_cast<IdentifierPattern>(target) &&
+                (found == values.end() ||
+                 !canScalarReplace(target, found->second))) {
+                return false;
+            }
+        }
+        return true;
+    }
+    return false;
+}
+
+void HIRGenerator::evaluateScalarReplaced(
+    Pattern* pattern, Expr* init,
+    std::vector<ScalarReplacedBinding>& bindings) {
+    while (auto* parenthesized = ast_cast<ParenthesizedExpr>(init)) {
+        init = parenthesized->expression.get();
+    }
+    Pattern* target = stripDefault(pattern);
+    if (!target || ast_cast<IdentifierPattern>(target)) {
+        const std::string savedDeclName = currentDeclName_;
+        currentDeclName_.clear();
+        init->accept(*this);
+        currentDeclName_ = savedDeclName;
+        if (pattern) {
+            // The AssignmentPattern wrapper, if any, is kept so its default
+            // is applied at bind time.
+            bindings.push_back({pattern, lastValue_, nullptr});
+        }
+        return;
+    }
+
+    // A literal element is never undefined, so defaults on nested literal
+    // targets are dead and only the inner pattern matters.
+    auto unknownType = HIRType::get(HIRType::Kind::Unknown);
+    if (auto* arrayPattern = ast_cast<ArrayPattern>(target)) {
+        auto* array = static_cast<ArrayExpr*>(init);
+        for (size_t i = 0; i < array->elements.size(); ++i) {
+            evaluateScalarReplaced(
+                i < arrayPattern->elements.size()
+                    ? arrayPattern->elements[i].get()
+                    : nullptr,
+                array->elements[i].get(), bindings);
+        }
+        // Pattern slots past the end of the literal read `undefined`.
+        for (size_t i = array->elements.size();
+             i < arrayPattern->elements.size(); ++i) {
+            if (!arrayPattern->elements[i]) continue;
+            bindings.push_back({
+                arrayPattern->elements[i].get(),
+                builder_->createUndefinedConstant(unknownType.get()),
+                nullptr});
+        }
+        return;
+    }
+
+    auto* objectPattern = static_cast<ObjectPattern*>(target);
+    auto* object = static_cast<ObjectExpr*>(init);
+    std::unordered_map<std::string, size_t> lastOccurrence;
+    for (size_t i = 0; i < object->properties.size(); ++i) {
+        std::string key;
+        literalPropertyKey(object->properties[i], key);
+        lastOccurrence[key] = i;
+    }
+    std::unordered_map<std::string, const ObjectPattern::Property*> targets;
+    for (auto& property : objectPattern->properties) {
+        targets[property.key] = &property;
+    }
+
+    // Values are evaluated in property order; a duplicated key keeps the
+    // value of its last occurrence. Bindings are only emitted afterwards,
+    // in pattern order, so a default may refer to an earlier target.
+    std::unordered_map<std::string, HIRValue*> values;
+    std::unordered_map<std::string, std::vector<ScalarReplacedBinding>> nested;
+    for (size_t i = 0; i < object->properties.size(); ++i) {
+        auto& property = object->properties[i];
+        std::string key;
+        literalPropertyKey(property, key);
+        auto found = targets.find(key);
+        Pattern* nestedTarget = found != targets.end()
+            ? stripDefault(found->second->value.get())
+            : nullptr;
+        if (nestedTarget && lastOccurrence[key] == i &&
+            !ast_cast<IdentifierPattern>(nestedTarget)) {
+            evaluateScalarReplaced(nestedTarget, property.value.get(),
+                                   nested[key]);
+            continue;
+        }
+        const std::string savedDeclName = currentDeclName_;
+        currentDeclName_.clear();
+        property.value->accept(*this);
+        currentDeclName_ = savedDeclName;
+        values[key] = lastValue_;
+    }
+    for (auto& property : objectPattern->properties) {
+        auto nestedBindings = nested.find(property.key);
+        if (nestedBindings != nested.end()) {
+            bindings.insert(bindings.end(), nestedBindings->second.begin(),
+                            nestedBindings->second.end());
+            continue;
+        }
+        auto found = values.find(property.key);
+        bindings.push_back({
+            property.value.get(),
+            found != values.end()
+                ? found->second
+                : builder_->createUndefinedConstant(unknownType.get()),
+            property.defaultValue.get()});
+    }
+}
+
+bool HIRGenerator::tryScalarReplaceDestructuring(
+    Pattern* pattern, Expr* init, bool assignToExisting) {
+    if (!canScalarReplace(pattern, init)) return false;
+
+    if(NOVA_DEBUG) std::cerr << "DEBUG HIRGen: Scalar-replacing literal "
+                             << "destructuring source" << std::endl;
+
+    // Every element expression runs before the first binding, exactly as if
+    // the aggregate had been built and then destructured.
+    std::vector<ScalarReplacedBinding> bindings;
+    evaluateScalarReplaced(pattern, init, bindings);
+    for (auto& binding : bindings) {
+        if (assignToExisting) {
+            assignDestructuringPattern(
+                binding.pattern,
+                applyDestructuringDefault(binding.value, binding.defaultValue));
+        } else {
+            bindDestructuringPattern(
+                binding.pattern, binding.value, binding.defaultValue);
+        }
+    }
+    return true;
+}
+
+} // namespace nova::hir
@@ -13,6 +13,7 @@
 
 #include "nova/Frontend/Lexer.h"
 #include "nova/Frontend/Parser.h"
+#include "nova/Frontend/ProjectChecker.h"
 #include "nova/Frontend/TypeChecker.h"
 #include "nova/HIR/HIRGen.h"
 #include "nova/MIR/MIRGen.h"
@@ -55,7 +56,7 @@ Commands:
   run, -r        JIT compile and run
   build, -b      Transpile TypeScript to JavaScript (like tsc)
   test           Run automated tests
-  check          Type check only
+  check          Type check only (a directory or several files: as a project)
   pm             Package manager commands (see 'nova pm --help')
   install, i     Install packages (fast, with cache)
   update, u      Update packages to latest versions
@@ -81,6 +82,11 @@ Options:
   --emit-obj          Emit object file (.o)
   --emit-all          Emit all IR stages
   --target <triple>   Target triple (e.g., x86_64-pc-windows-msvc)
+  --profile-generate[=<dir>]
+                      Build an instrumented executable that writes .profraw
+                      profiles at exit (compile only)
+  --profile-use=<file>
+                      Optimize with a .profdata/.profraw profile (compile only)
   --verbose           Verbose output
   --help              Show this help message
   --version           Show version
@@ -104,6 +110,8 @@ Build Options (for -b/build):
   --declarationMap    Generate .d.ts.map source maps
   --sourceMap         Generate source map files
   --module <type>     Module system: commonjs, es6 [default: commonjs]
+  --bundle            Bundle the entry and its imports into one file
+  --outFile <file>    Bundle output file (implies --bundle)
   --target <ver>      JS target: es5, es6, es2020 [default: es2020]
   --watch, -w         Watch mode - recompile on file changes
 
@@ -116,10 +124,19 @@ Examples:
   nova -b src/app.ts              # Single file
   nova -b --outDir dist --minify  # With options
   nova -b --watch                 # Watch mode
+  nova -b src/app.ts --bundle     # One tree-shaken file
+
+  # Type check a project, reusing results for unchanged files
+  nova check src
 
   # Compile to native (LLVM)
   nova -c app.ts --emit-llvm
 
+  # Profile-guided build
+  nova -c app.ts -o app --profile-generate=prof   # instrumented binary
+  ./app && llvm-profdata merge -o app.profdata prof
+  nova -c app.ts -o app --profile-use=app.profdata
+
   # JIT execute
   nova -r script.ts
 
@@ -411,6 +428,7 @@ int main(int argc, char** argv) {
     
     // Parse arguments
     std::string inputFile;
+    std::vector<std::string> inputFiles;
     std::string outputFile;
     int optLevel = 2;
     bool emitLLVM = false;
@@ -424,6 +442,9 @@ int main(int argc, char** argv) {
     bool noCache = false;
     bool showCacheStats = false;
     std::string targetTriple;
+    bool profileGenerate = false;
+    std::string profileGenerateDir;
+    std::string profileUseFile;
 
     // Build-specific options
     std::string outDir = "./dist";
@@ -432,6 +453,8 @@ int main(int argc, char** argv) {
     bool declarationMap = false;
     bool sourceMap = false;
     bool watchMode = false;
+    bool bundleMode = false;
+    std::string outFile;
     std::string moduleType = "commonjs";
     std::string jsTarget = "es2020";
 
@@ -480,6 +503,16 @@ int main(int argc, char** argv) {
         else if (arg == "--target" && i + 1 < argc) {
             targetTriple = argv[++i];
         }
+        else if (arg == "--profile-generate") {
+            profileGenerate = true;
+        }
+        else if (arg.rfind("--profile-generate=", 0) == 0) {
+            profileGenerate = true;
+            profileGenerateDir = arg.substr(19);
+        }
+        else if (arg.rfind("--profile-use=", 0) == 0) {
+            profileUseFile = arg.substr(14);
+        }
         else if (arg == "--verbose") {
             verbose = true;
         }
@@ -520,6 +553,13 @@ int main(int argc, char** argv) {
         else if (arg == "--watch" || arg == "-w") {
             watchMode = true;
         }
+        else if (arg == "--bundle") {
+            bundleMode = true;
+        }
+        else if (arg == "--outFile" && i + 1 < argc) {
+            outFile = argv[++i];
+            bundleMode = true;
+        }
         else if (arg == "--module" && i + 1 < argc) {
             moduleType = argv[++i];
         }
@@ -542,9 +582,28 @@ int main(int argc, char** argv) {
         }
         else if (arg[0] != '-') {
             inputFile = arg;
+            inputFiles.push_back(arg);
         }
     }
 
+    // A profile either comes out of a build or goes into one, and it only
+    // applies when the build ends in a native executable.
+    const bool profileFlags = profileGenerate || !profileUseFile.empty();
+    if (profileGenerate && !profileUseFile.empty()) {
+        std::cerr << "❌ Error: --profile-generate and --profile-use cannot be combined" << std::endl;
+        return 1;
+    }
+    if (profileFlags && command == "compile" &&
+        (emitLLVM || emitMIR || emitHIR || emitAsm || emitObj)) {
+        std::cerr << "❌ Error: --profile-generate/--profile-use require an executable output; "
+                  << "remove --emit-* options" << std::endl;
+        return 1;
+    }
+    if (profileFlags && command == "run") {
+        std::cerr << "⚠️  Warning: --profile-generate/--profile-use are ignored by 'run'; "
+                  << "use 'compile' to build a PGO executable" << std::endl;
+    }
+
     // Handle init command
     if (command == "init") {
         pm::PackageManager pm;
@@ -862,6 +921,7 @@ int main(int argc, char** argv) {
         opts.sourceMap = sourceMap;
         opts.module = moduleType;
         opts.target = jsTarget;
+        opts.outFile = outFile;
         transpiler.setOptions(opts);
 
         // Check if input is a directory (project build) or file (single file)
@@ -879,6 +939,16 @@ int main(int argc, char** argv) {
             }
         }
 
+        // --bundle without an output file bundles into the outDir
+        auto& options = transpiler.getOptions();
+        if (bundleMode && options.outFile.empty()) {
+            std::string bundleName = isProjectBuild
+                ? "bundle.js"
+                : std::filesystem::path(inputFile).stem().string() + ".js";
+            options.outFile = (std::filesystem::path(options.outDir.empty() ? "." : options.outDir) /
+                               bundleName).string();
+        }
+
         // Watch mode
         if (watchMode) {
             transpiler.watch(projectPath, [](const transpiler::TranspileResult& result) {
@@ -894,7 +964,26 @@ int main(int argc, char** argv) {
             return 0; // Never reached, watch runs forever
         }
 
-        if (!isProjectBuild) {
+        if (!isProjectBuild && !options.outFile.empty()) {
+            // Single entry bundle
+            auto result = transpiler.bundle({inputFile}, options.outFile);
+            for (const auto& warning : result.warnings) {
+                std::cerr << "[WARN] " << warning << std::endl;
+            }
+            if (!result.success) {
+                for (const auto& err : result.errors) {
+                    std::cerr << "[ERROR] " << err << std::endl;
+                }
+                return 1;
+            }
+            std::cout << "[OK] " << inputFile << " -> " << result.outFile << std::endl;
+            std::cout << "     Modules: " << result.modules.size()
+                      << ", statements kept: " << result.keptStatements
+                      << ", dropped: " << result.droppedStatements << std::endl;
+            std::cout << "     " << result.totalInputSize << " bytes -> "
+                      << result.outputSize << " bytes" << std::endl;
+            std::cout << "     Time: " << result.totalTimeMs << "ms" << std::endl;
+        } else if (!isProjectBuild) {
             // Single file transpilation
             auto result = transpiler.transpileFile(inputFile);
             if (result.success) {
@@ -979,6 +1068,34 @@ int main(int argc, char** argv) {
         return 0;
     }
 
+    // A directory or several files are checked as one project: imports see
+    // the exported types of the modules they name, independent modules are
+    // checked in parallel, and results are cached per file so unchanged
+    // modules (whose imports kept their exported types) are not rechecked.
+    if (command == "check" &&
+        (inputFiles.size() > 1 ||
+         (inputFiles.size() == 1 && std::filesystem::is_directory(inputFiles[0])))) {
+        ProjectCheckOptions checkOptions;
+        if (!noCache) {
+            const std::filesystem::path root = inputFiles.size() == 1
+                ? std::filesystem::path(inputFiles[0]) : std::filesystem::path(".");
+            checkOptions.cacheFile = (root / ".novacheckinfo").string();
+        }
+        ProjectChecker projectChecker(checkOptions);
+        ProjectCheckResult checked = projectChecker.check(inputFiles);
+        for (const auto& diagnostic : checked.diagnostics) {
+            std::cerr << diagnostic << std::endl;
+        }
+        if (verbose) {
+            std::cout << "[*] Checked " << checked.checked << " of "
+                      << checked.files.size() << " files ("
+                      << checked.reused << " unchanged)" << std::endl;
+        }
+        if (!checked.success()) return 1;
+        std::cout << "✅ Type checking completed successfully" << std::endl;
+        return 0;
+    }
+
     if (inputFile.empty()) {
         std::cerr << "Error: No input file specified" << std::endl;
         printUsage();
@@ -1172,6 +1289,11 @@ int main(int argc, char** argv) {
 
         if (verbose) std::cout << "⏳ Phase 9: LLVM Optimization Passes..." << std::endl;
         codegen.runOptimizationPasses(optLevel);
+        if (command != "run" && profileGenerate) {
+            codegen.setProfileGenerate(profileGenerateDir);
+        } else if (command != "run" && !profileUseFile.empty()) {
+            codegen.setProfileUse(profileUseFile);
+        }
 
         if (emitLLVM) {
             std::string llFile = outputFile.empty() ?
@@ -1233,6 +1355,24 @@ int main(int argc, char** argv) {
                 (inputFile.substr(0, inputFile.find_last_of('.')) + ".exe") : outputFile;
             if (verbose) std::cout << "⏳ Phase 10: Linking..." << std::endl;
             if (verbose) std::cout << "💾 Writing executable to: " << exeFile << std::endl;
+            if (profileGenerate || !profileUseFile.empty()) {
+                // Profiles only apply to a native build, so PGO builds link
+                // through clang instead of stopping at LLVM IR.
+                bool linked = codegen.emitExecutable(exeFile);
+                delete mirModule;
+                delete hirModule;
+                if (!linked) {
+                    std::cerr << "❌ Error: PGO build failed" << std::endl;
+                    return 1;
+                }
+                if (profileGenerate) {
+                    std::cout << "[OK] Instrumented executable: " << exeFile
+                              << " (run it, then rebuild with --profile-use)" << std::endl;
+                } else {
+                    std::cout << "[OK] Profile-optimized executable: " << exeFile << std::endl;
+                }
+                return 0;
+            }
             // TODO: Link and create executable using LLVM's object file output
             // For now, emit LLVM IR and object file
             codegen.emitLLVMIR(inputFile.substr(0, inputFile.find_last_of('.')) + ".ll");
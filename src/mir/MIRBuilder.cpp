@@ -232,77 +232,77 @@ MIRBasicBlockPtr MIRBuilder::createBasicBlock(const std::string& label) {
 // ==================== Type Creation ====================
 
 MIRTypePtr MIRBuilder::getVoidType() {
-    static auto type = std::make_shared<MIRType>(MIRType::Kind::Void);
+    static auto type = MIRType::get(MIRType::Kind::Void);
     return type;
 }
 
 MIRTypePtr MIRBuilder::getBoolType() {
-    static auto type = std::make_shared<MIRType>(MIRType::Kind::I1);
+    static auto type = MIRType::get(MIRType::Kind::I1);
     return type;
 }
 
 MIRTypePtr MIRBuilder::getI8Type() {
-    static auto type = std::make_shared<MIRType>(MIRType::Kind::I8);
+    static auto type = MIRType::get(MIRType::Kind::I8);
     return type;
 }
 
 MIRTypePtr MIRBuilder::getI16Type() {
-    static auto type = std::make_shared<MIRType>(MIRType::Kind::I16);
+    static auto type = MIRType::get(MIRType::Kind::I16);
     return type;
 }
 
 MIRTypePtr MIRBuilder::getI32Type() {
-    static auto type = std::make_shared<MIRType>(MIRType::Kind::I32);
+    static auto type = MIRType::get(MIRType::Kind::I32);
     return type;
 }
 
 MIRTypePtr MIRBuilder::getI64Type() {
-    static auto type = std::make_shared<MIRType>(MIRType::Kind::I64);
+    static auto type = MIRType::get(MIRType::Kind::I64);
     return type;
 }
 
 MIRTypePtr MIRBuilder::getISizeType() {
-    static auto type = std::make_shared<MIRType>(MIRType::Kind::ISize);
+    static auto type = MIRType::get(MIRType::Kind::ISize);
     return type;
 }
 
 MIRTypePtr MIRBuilder::getU8Type() {
-    static auto type = std::make_shared<MIRType>(MIRType::Kind::U8);
+    static auto type = MIRType::get(MIRType::Kind::U8);
     return type;
 }
 
 MIRTypePtr MIRBuilder::getU16Type() {
-    static auto type = std::make_shared<MIRType>(MIRType::Kind::U16);
+    static auto type = MIRType::get(MIRType::Kind::U16);
     return type;
 }
 
 MIRTypePtr MIRBuilder::getU32Type() {
-    static auto type = std::make_shared<MIRType>(MIRType::Kind::U32);
+    static auto type = MIRType::get(MIRType::Kind::U32);
     return type;
 }
 
 MIRTypePtr MIRBuilder::getU64Type() {
-    static auto type = std::make_shared<MIRType>(MIRType::Kind::U64);
+    static auto type = MIRType::get(MIRType::Kind::U64);
     return type;
 }
 
 MIRTypePtr MIRBuilder::getUSizeType() {
-    static auto type = std::make_shared<MIRType>(MIRType::Kind::USize);
+    static auto type = MIRType::get(MIRType::Kind::USize);
     return type;
 }
 
 MIRTypePtr MIRBuilder::getF32Type() {
-    static auto type = std::make_shared<MIRType>(MIRType::Kind::F32);
+    static auto type = MIRType::get(MIRType::Kind::F32);
     return type;
 }
 
 MIRTypePtr MIRBuilder::getF64Type() {
-    static auto type = std::make_shared<MIRType>(MIRType::Kind::F64);
+    static auto type = MIRType::get(MIRType::Kind::F64);
     return type;
 }
 
 MIRTypePtr MIRBuilder::getPointerType() {
-    static auto type = std::make_shared<MIRType>(MIRType::Kind::Pointer);
+    static auto type = MIRType::get(MIRType::Kind::Pointer);
     return type;
 }
 
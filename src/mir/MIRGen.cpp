@@ -87,69 +87,69 @@ private:
     
     MIRTypePtr translateType(hir::HIRType* hirType) {
         if (!hirType) {
-            return std::make_shared<MIRType>(MIRType::Kind::Void);
+            return MIRType::get(MIRType::Kind::Void);
         }
         
         switch (hirType->kind) {
             case hir::HIRType::Kind::Void:
             case hir::HIRType::Kind::Unit:
-                return std::make_shared<MIRType>(MIRType::Kind::Void);
+                return MIRType::get(MIRType::Kind::Void);
             
             case hir::HIRType::Kind::Bool:
-                return std::make_shared<MIRType>(MIRType::Kind::I1);
+                return MIRType::get(MIRType::Kind::I1);
             
             case hir::HIRType::Kind::I8:
-                return std::make_shared<MIRType>(MIRType::Kind::I8);
+                return MIRType::get(MIRType::Kind::I8);
             case hir::HIRType::Kind::I16:
-                return std::make_shared<MIRType>(MIRType::Kind::I16);
+                return MIRType::get(MIRType::Kind::I16);
             case hir::HIRType::Kind::I32:
-                return std::make_shared<MIRType>(MIRType::Kind::I32);
+                return MIRType::get(MIRType::Kind::I32);
             case hir::HIRType::Kind::I64:
-                return std::make_shared<MIRType>(MIRType::Kind::I64);
+                return MIRType::get(MIRType::Kind::I64);
             case hir::HIRType::Kind::ISize:
-                return std::make_shared<MIRType>(MIRType::Kind::ISize);
+                return MIRType::get(MIRType::Kind::ISize);
             
             case hir::HIRType::Kind::U8:
-                return std::make_shared<MIRType>(MIRType::Kind::U8);
+                return MIRType::get(MIRType::Kind::U8);
             case hir::HIRType::Kind::U16:
-                return std::make_shared<MIRType>(MIRType::Kind::U16);
+                return MIRType::get(MIRType::Kind::U16);
             case hir::HIRType::Kind::U32:
-                return std::make_shared<MIRType>(MIRType::Kind::U32);
+                return MIRType::get(MIRType::Kind::U32);
             case hir::HIRType::Kind::U64:
-                return std::make_shared<MIRType>(MIRType::Kind::U64);
+                return MIRType::get(MIRType::Kind::U64);
             case hir::HIRType::Kind::USize:
-                return std::make_shared<MIRType>(MIRType::Kind::USize);
+                return MIRType::get(MIRType::Kind::USize);
             
             case hir::HIRType::Kind::F32:
-                return std::make_shared<MIRType>(MIRType::Kind::F32);
+                return MIRType::get(MIRType::Kind::F32);
             case hir::HIRType::Kind::F64:
-                return std::make_shared<MIRType>(MIRType::Kind::F64);
+                return MIRType::get(MIRType::Kind::F64);
             
             case hir::HIRType::Kind::Pointer:
             case hir::HIRType::Kind::Reference:
             case hir::HIRType::Kind::String:  // Strings are represented as pointers
-                return std::make_shared<MIRType>(MIRType::Kind::Pointer);
+                return MIRType::get(MIRType::Kind::Pointer);
 
             case hir::HIRType::Kind::Array:
-                return std::make_shared<MIRType>(MIRType::Kind::Array);
+                return MIRType::get(MIRType::Kind::Array);
 
             case hir::HIRType::Kind::Struct:
-                return std::make_shared<MIRType>(MIRType::Kind::Struct);
+                return MIRType::get(MIRType::Kind::Struct);
 
             case hir::HIRType::Kind::Function:
-                return std::make_shared<MIRType>(MIRType::Kind::Function);
+                return MIRType::get(MIRType::Kind::Function);
 
             case hir::HIRType::Kind::Any:
                 // WORKAROUND: Use I64 instead of Pointer for better callback compatibility
                 // This allows untyped parameters to work with array callbacks
                 // Fixed: Changed from Pointer to I64 as comment intended
-                return std::make_shared<MIRType>(MIRType::Kind::I64);
+                return MIRType::get(MIRType::Kind::I64);
 
             case hir::HIRType::Kind::JSValue:
-                return std::make_shared<MIRType>(MIRType::Kind::JSValue);
+                return MIRType::get(MIRType::Kind::JSValue);
             
             default:
-                return std::make_shared<MIRType>(MIRType::Kind::Void);
+                return MIRType::get(MIRType::Kind::Void);
         }
     }
     
@@ -592,7 +592,7 @@ private:
         if (hirFunc->functionType) {
             mirFunc->returnType = translateType(hirFunc->functionType->returnType.get());
         } else {
-            mirFunc->returnType = std::make_shared<MIRType>(MIRType::Kind::Void);
+            mirFunc->returnType = MIRType::get(MIRType::Kind::Void);
         }
         
         // Translate parameters
@@ -699,7 +699,7 @@ private:
                                 auto envOperand = builder_->createCopyOperand(envPlace);
                                 auto fieldIndexOperand = builder_->createIntConstant(
                                     static_cast<int64_t>(i),
-                                    std::make_shared<MIRType>(MIRType::Kind::I64)
+                                    MIRType::get(MIRType::Kind::I64)
                                 );
 
                                 auto getElemRValue = std::make_shared<MIRGetElementRValue>(
@@ -1178,7 +1178,7 @@ private:
                     );
 
                     auto tempPlace = currentFunction_->createLocal(
-                        std::make_shared<MIRType>(MIRType::Kind::Void),
+                        MIRType::get(MIRType::Kind::Void),
                         "__setfield_store"
                     );
                     builder_->createAssign(tempPlace, setFieldRValue);
@@ -1269,7 +1269,7 @@ private:
             // Create function name operand
             funcOperand = builder_->createStringConstant(
                 functionName,
-                std::make_shared<MIRType>(MIRType::Kind::Pointer)
+                MIRType::get(MIRType::Kind::Pointer)
             );
 
             // Prepend environment as first argument
@@ -1424,7 +1424,7 @@ private:
                         for (const auto& field : hirEnvStruct->fields) {
                             fieldTypes.push_back(translateType(field.type.get()));
                         }
-                        auto mirEnvType = std::make_shared<MIRType>(MIRType::Kind::Struct);
+                        auto mirEnvType = MIRType::get(MIRType::Kind::Struct);
                         // Note: MIR struct types don't store field info, just use as marker
 
                         // Allocate environment struct
@@ -1544,7 +1544,7 @@ private:
                                                     parentNamesIt->second.begin(),
                                                     parentName));
                                             auto pointerType =
-                                                std::make_shared<MIRType>(
+                                                MIRType::get(
                                                     MIRType::Kind::Pointer);
                                             auto inheritedCell =
                                                 currentFunction_->createLocal(
@@ -1559,7 +1559,7 @@ private:
                                                     parentEnvironmentPlace->second),
                                                 builder_->createIntConstant(
                                                     parentIndex,
-                                                    std::make_shared<MIRType>(
+                                                    MIRType::get(
                                                         MIRType::Kind::I64)),
                                                 true, pointerType);
                                             builder_->createAssign(
@@ -1577,7 +1577,7 @@ private:
 
                                     // Create field index operand
                                     auto fieldIndexOperand = builder_->createIntConstant(i,
-                                        std::make_shared<MIRType>(MIRType::Kind::I64));
+                                        MIRType::get(MIRType::Kind::I64));
 
                                     // Create environment place operand
                                     auto envOperand = builder_->createCopyOperand(envPlace);
@@ -1596,7 +1596,7 @@ private:
 
                                     // Create temp place for the SetField result
                                     auto tempPlace = currentFunction_->createLocal(
-                                        std::make_shared<MIRType>(MIRType::Kind::Void),
+                                        MIRType::get(MIRType::Kind::Void),
                                         "__setfield_temp"
                                     );
 
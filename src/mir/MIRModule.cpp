@@ -1,4 +1,5 @@
 #include "nova/MIR/MIR.h"
+#include <array>
 #include <sstream>
 #include <algorithm>
 
@@ -6,6 +7,17 @@ namespace nova::mir {
 
 // ==================== MIRType Implementation ====================
 
+MIRTypePtr MIRType::get(Kind kind) {
+    static const auto interned = [] {
+        std::array<MIRTypePtr, static_cast<size_t>(Kind::JSValue) + 1> types;
+        for (size_t i = 0; i < types.size(); ++i) {
+            types[i] = std::make_shared<MIRType>(static_cast<Kind>(i));
+        }
+        return types;
+    }();
+    return interned[static_cast<size_t>(kind)];
+}
+
 std::string MIRType::toString() const {
     switch (kind) {
         case Kind::Void: return "()";
@@ -58,6 +58,8 @@ Options:
   --emit-obj          Emit object file (.o)
   --emit-all          Emit all IR stages
   --target <triple>   Target triple
+  --profile-generate[=<dir>]  Instrumented build writing .profraw at exit
+  --profile-use=<file>        Optimize with a .profdata/.profraw profile
   --verbose           Verbose output
   --help, -h          Show this help
   --version, -v       Show version
@@ -131,6 +133,9 @@ int main(int argc, char** argv) {
     bool emitObj = false;
     bool verbose = false;
     std::string targetTriple;
+    bool profileGenerate = false;
+    std::string profileGenerateDir;
+    std::string profileUseFile;
 
     // Build-specific options
     std::string outDir = "./dist";
@@ -161,6 +166,13 @@ int main(int argc, char** argv) {
             emitHIR = emitMIR = emitLLVM = true;
         } else if (arg == "--target" && i + 1 < argc) {
             targetTriple = argv[++i];
+        } else if (arg == "--profile-generate") {
+            profileGenerate = true;
+        } else if (arg.rfind("--profile-generate=", 0) == 0) {
+            profileGenerate = true;
+            profileGenerateDir = arg.substr(19);
+        } else if (arg.rfind("--profile-use=", 0) == 0) {
+            profileUseFile = arg.substr(14);
         } else if (arg == "--verbose") {
             verbose = true;
         } else if (arg == "--outDir" && i + 1 < argc) {
@@ -180,6 +192,18 @@ int main(int argc, char** argv) {
         }
     }
 
+    // Profiles only apply to a native executable built by `compile`.
+    if (profileGenerate && !profileUseFile.empty()) {
+        std::cerr << "Error: --profile-generate and --profile-use cannot be combined" << std::endl;
+        return 1;
+    }
+    if ((profileGenerate || !profileUseFile.empty()) &&
+        (command != "compile" || emitLLVM || emitMIR || emitHIR || emitAsm || emitObj)) {
+        std::cerr << "Error: --profile-generate/--profile-use require 'compile' "
+                  << "with an executable output" << std::endl;
+        return 1;
+    }
+
     // Handle build command (transpile)
     if (command == "build") {
         transpiler::Transpiler transpiler;
@@ -327,6 +351,11 @@ int main(int argc, char** argv) {
 
             if (verbose) std::cout << "[*] Running optimizations (O" << optLevel << ")..." << std::endl;
             codegen.runOptimizationPasses(optLevel);
+            if (profileGenerate) {
+                codegen.setProfileGenerate(profileGenerateDir);
+            } else if (!profileUseFile.empty()) {
+                codegen.setProfileUse(profileUseFile);
+            }
 
             if (emitLLVM) {
                 std::string llFile = outputFile.empty() ?
@@ -865,6 +865,13 @@ int64_t nova_value_array_at(void* array_ptr, int64_t index) {
     return array->elements[normalized];
 }
 
+// Element read for indices already proven to be inside [0, length), e.g.
+// the counter of a canonical `for (i < a.length)` loop. LLVMCodeGen emits
+// this inline; the definition serves the other consumers of the ABI.
+int64_t nova_value_array_at_unchecked(void* array_ptr, int64_t index) {
+    return static_cast<nova::runtime::ValueArray*>(array_ptr)->elements[index];
+}
+
 std::uint64_t nova_value_array_at_tagged(
     void* array_ptr, int64_t index, int64_t element_kind) {
     auto* array = static_cast<nova::runtime::ValueArray*>(array_ptr);
@@ -471,6 +471,113 @@ void nova_biguint64array_set(void* arrayPtr, int64_t index, uint64_t value) {
     reinterpret_cast<uint64_t*>(arr->data)[index] = value;
 }
 
+// ============================================================================
+// Unchecked element access
+// ============================================================================
+// Only emitted by HIRGen for indices proven to lie in [0, length) of a live
+// typed array (canonical counted loops, see BoundsCheckElimination.cpp).
+// LLVMCodeGen normally inlines these as typed loads/stores on `data`; the
+// out-of-line definitions cover call sites it leaves alone.
+
+int64_t nova_int8array_get_unchecked(void* arrayPtr, int64_t index) {
+    return reinterpret_cast<int8_t*>(static_cast<NovaTypedArray*>(arrayPtr)->data)[index];
+}
+
+void nova_int8array_set_unchecked(void* arrayPtr, int64_t index, int64_t value) {
+    reinterpret_cast<int8_t*>(static_cast<NovaTypedArray*>(arrayPtr)->data)[index] =
+        static_cast<int8_t>(value);
+}
+
+int64_t nova_uint8array_get_unchecked(void* arrayPtr, int64_t index) {
+    return reinterpret_cast<uint8_t*>(static_cast<NovaTypedArray*>(arrayPtr)->data)[index];
+}
+
+void nova_uint8array_set_unchecked(void* arrayPtr, int64_t index, int64_t value) {
+    reinterpret_cast<uint8_t*>(static_cast<NovaTypedArray*>(arrayPtr)->data)[index] =
+        static_cast<uint8_t>(value);
+}
+
+int64_t nova_uint8clampedarray_get_unchecked(void* arrayPtr, int64_t index) {
+    return reinterpret_cast<uint8_t*>(static_cast<NovaTypedArray*>(arrayPtr)->data)[index];
+}
+
+void nova_uint8clampedarray_set_unchecked(void* arrayPtr, int64_t index, int64_t value) {
+    static_cast<NovaTypedArray*>(arrayPtr)->data[index] =
+        static_cast<uint8_t>(value < 0 ? 0 : (value > 255 ? 255 : value));
+}
+
+int64_t nova_int16array_get_unchecked(void* arrayPtr, int64_t index) {
+    return reinterpret_cast<int16_t*>(static_cast<NovaTypedArray*>(arrayPtr)->data)[index];
+}
+
+void nova_int16array_set_unchecked(void* arrayPtr, int64_t index, int64_t value) {
+    reinterpret_cast<int16_t*>(static_cast<NovaTypedArray*>(arrayPtr)->data)[index] =
+        static_cast<int16_t>(value);
+}
+
+int64_t nova_uint16array_get_unchecked(void* arrayPtr, int64_t index) {
+    return reinterpret_cast<uint16_t*>(static_cast<NovaTypedArray*>(arrayPtr)->data)[index];
+}
+
+void nova_uint16array_set_unchecked(void* arrayPtr, int64_t index, int64_t value) {
+    reinterpret_cast<uint16_t*>(static_cast<NovaTypedArray*>(arrayPtr)->data)[index] =
+        static_cast<uint16_t>(value);
+}
+
+int64_t nova_int32array_get_unchecked(void* arrayPtr, int64_t index) {
+    return reinterpret_cast<int32_t*>(static_cast<NovaTypedArray*>(arrayPtr)->data)[index];
+}
+
+void nova_int32array_set_unchecked(void* arrayPtr, int64_t index, int64_t value) {
+    reinterpret_cast<int32_t*>(static_cast<NovaTypedArray*>(arrayPtr)->data)[index] =
+        static_cast<int32_t>(value);
+}
+
+int64_t nova_uint32array_get_unchecked(void* arrayPtr, int64_t index) {
+    return reinterpret_cast<uint32_t*>(static_cast<NovaTypedArray*>(arrayPtr)->data)[index];
+}
+
+void nova_uint32array_set_unchecked(void* arrayPtr, int64_t index, int64_t value) {
+    reinterpret_cast<uint32_t*>(static_cast<NovaTypedArray*>(arrayPtr)->data)[index] =
+        static_cast<uint32_t>(value);
+}
+
+double nova_float32array_get_unchecked(void* arrayPtr, int64_t index) {
+    return reinterpret_cast<float*>(static_cast<NovaTypedArray*>(arrayPtr)->data)[index];
+}
+
+void nova_float32array_set_unchecked(void* arrayPtr, int64_t index, double value) {
+    reinterpret_cast<float*>(static_cast<NovaTypedArray*>(arrayPtr)->data)[index] =
+        static_cast<float>(value);
+}
+
+double nova_float64array_get_unchecked(void* arrayPtr, int64_t index) {
+    return reinterpret_cast<double*>(static_cast<NovaTypedArray*>(arrayPtr)->data)[index];
+}
+
+void nova_float64array_set_unchecked(void* arrayPtr, int64_t index, double value) {
+    reinterpret_cast<double*>(static_cast<NovaTypedArray*>(arrayPtr)->data)[index] =
+        static_cast<double>(value);
+}
+
+int64_t nova_bigint64array_get_unchecked(void* arrayPtr, int64_t index) {
+    return reinterpret_cast<int64_t*>(static_cast<NovaTypedArray*>(arrayPtr)->data)[index];
+}
+
+void nova_bigint64array_set_unchecked(void* arrayPtr, int64_t index, int64_t value) {
+    reinterpret_cast<int64_t*>(static_cast<NovaTypedArray*>(arrayPtr)->data)[index] =
+        static_cast<int64_t>(value);
+}
+
+uint64_t nova_biguint64array_get_unchecked(void* arrayPtr, int64_t index) {
+    return reinterpret_cast<uint64_t*>(static_cast<NovaTypedArray*>(arrayPtr)->data)[index];
+}
+
+void nova_biguint64array_set_unchecked(void* arrayPtr, int64_t index, uint64_t value) {
+    reinterpret_cast<uint64_t*>(static_cast<NovaTypedArray*>(arrayPtr)->data)[index] =
+        static_cast<uint64_t>(value);
+}
+
 // ============================================================================
 // Common TypedArray Properties
 // ============================================================================
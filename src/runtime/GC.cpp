@@ -10,7 +10,8 @@
 // - Generational collection
 // - Compact heap
 
-#include "nova/Runtime/GC.h"
+#include "nova/runtime/GC.h"
+#include "nova/runtime/Runtime.h"
 #include <unordered_set>
 #include <iostream>
 #include <mutex>
@@ -46,7 +47,7 @@ void* nova_gc_alloc(size_t size, GCObjectType type) {
     obj->type = type;
     obj->refCount = 1;  // Start with 1 reference (the owner)
     obj->flags = 0;
-    obj->color = GCColor::Black;  // Default color
+    obj->color = GCColor_Black;  // Default color
 
     std::lock_guard<std::mutex> lock(gcState.mutex);
     gcState.trackedObjects.insert(obj);
@@ -129,14 +130,21 @@ int nova_gc_get_refcount(void* ptr) {
 // Statistics and Diagnostics
 // ============================================================================
 
-// Get GC statistics
+// Get GC statistics. Objects created through the runtime allocator
+// (allocate() in Memory.cpp: objects, arrays, strings) are included so the
+// totals reflect every heap allocation made by compiled code.
 void nova_gc_get_stats(size_t* totalAllocs, size_t* totalFrees,
                        size_t* liveObjects) {
+    const size_t runtimeAllocs = get_lifetime_allocation_count();
+    const size_t runtimeLive = get_allocation_count();
+
     std::lock_guard<std::mutex> lock(gcState.mutex);
 
-    if (totalAllocs) *totalAllocs = gcState.totalAllocations;
-    if (totalFrees) *totalFrees = gcState.totalDeallocations;
-    if (liveObjects) *liveObjects = gcState.trackedObjects.size();
+    if (totalAllocs) *totalAllocs = gcState.totalAllocations + runtimeAllocs;
+    if (totalFrees) {
+        *totalFrees = gcState.totalDeallocations + (runtimeAllocs - runtimeLive);
+    }
+    if (liveObjects) *liveObjects = gcState.trackedObjects.size() + runtimeLive;
 }
 
 // Force a garbage collection cycle (for reference counting, this is a no-op
@@ -156,12 +164,17 @@ void nova_gc_collect() {
 
 // Print GC statistics
 void nova_gc_print_stats() {
+    size_t totalAllocs = 0;
+    size_t totalFrees = 0;
+    size_t liveObjects = 0;
+    nova_gc_get_stats(&totalAllocs, &totalFrees, &liveObjects);
+
     std::lock_guard<std::mutex> lock(gcState.mutex);
 
     std::cerr << "=== GC Statistics ===" << std::endl;
-    std::cerr << "Total allocations: " << gcState.totalAllocations << std::endl;
-    std::cerr << "Total deallocations: " << gcState.totalDeallocations << std::endl;
-    std::cerr << "Live objects: " << gcState.trackedObjects.size() << std::endl;
+    std::cerr << "Total allocations: " << totalAllocs << std::endl;
+    std::cerr << "Total deallocations: " << totalFrees << std::endl;
+    std::cerr << "Live objects: " << liveObjects << std::endl;
     std::cerr << "Collections: " << gcState.collectionCount << std::endl;
     std::cerr << "====================" << std::endl;
 }
@@ -1,4 +1,5 @@
 #include "nova/runtime/Runtime.h"
+#include "nova/runtime/GC.h"
 #include <cstdlib>
 #include <cstring>
 
@@ -8,6 +9,17 @@ namespace runtime {
 // Simple allocator implementation
 static size_t total_allocated = 0;
 static size_t allocation_count = 0;
+static size_t lifetime_allocation_count = 0;
+
+// NOVA_GC_STATS=1 prints allocation totals at exit, which is how the
+// benchmarks compare allocation counts between compiler changes. Registered
+// once during static initialization so allocate() carries no guard check.
+[[maybe_unused]] static const bool stats_registered = [] {
+    if (std::getenv("NOVA_GC_STATS")) {
+        std::atexit(nova_gc_print_stats);
+    }
+    return true;
+}();
 
 void* allocate(size_t size, TypeId type_id) {
     // Allocate memory for object + header
@@ -29,6 +41,7 @@ void* allocate(size_t size, TypeId type_id) {
     // Update statistics
     total_allocated += total_size;
     allocation_count++;
+    lifetime_allocation_count++;
     
     // Return pointer to data area (after header)
     return static_cast<char*>(memory) + sizeof(ObjectHeader);
@@ -79,5 +92,9 @@ size_t get_allocation_count() {
     return allocation_count;
 }
 
+size_t get_lifetime_allocation_count() {
+    return lifetime_allocation_count;
+}
+
 } // namespace runtime
 } // namespace nova
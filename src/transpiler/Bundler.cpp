@@ -0,0 +1,1240 @@
+#include "nova/Transpiler/Transpiler.h"
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace nova {
+namespace transpiler {
+
+// ============================================================================
+// Bundler
+// ============================================================================
+//
+// Three phases:
+//   1. Graph: workers pull files off a shared queue, transpile each to an ES
+//      module, scan its top-level structure and resolve its imports, pushing
+//      files not seen yet back onto the queue.
+//   2. Link: modules are ordered by a depth-first walk of the imports from
+//      the entries (the order ES modules evaluate in, independent of which
+//      worker finished first), declarations are marked live starting from
+//      every statement with side effects and the entry's exports, and each
+//      live top-level name gets a name that is unique across the bundle.
+//   3. Print: live statements are copied with references renamed, imports
+//      and exports dropped, and the per-module source maps composed into
+//      one that points back at the original files.
+
+namespace {
+
+constexpr char kBase64[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+void appendVLQ(std::string& out, int64_t value) {
+    uint64_t vlq = value < 0 ? ((static_cast<uint64_t>(-value)) << 1) | 1
+                             : static_cast<uint64_t>(value) << 1;
+    do {
+        uint64_t digit = vlq & 31;
+        vlq >>= 5;
+        if (vlq != 0) digit |= 32;
+        out += kBase64[digit];
+    } while (vlq != 0);
+}
+
+int utf16Units(unsigned char c) {
+    if ((c & 0xC0) == 0x80) return 0;
+    return c >= 0xF0 ? 2 : 1;
+}
+
+std::string jsonEscape(const std::string& input) {
+    std::string output;
+    for (unsigned char character : input) {
+        switch (character) {
+            case '\\': output += "\\\\"; break;
+            case '"': output += "\\\""; break;
+            case '\n': output += "\\n"; break;
+            case '\r': output += "\\r"; break;
+            case '\t': output += "\\t"; break;
+            default:
+                if (character < 0x20) {
+                    const char* digits = "0123456789abcdef";
+                    output += "\\u00";
+                    output += digits[(character >> 4) & 0xf];
+                    output += digits[character & 0xf];
+                } else {
+                    output += static_cast<char>(character);
+                }
+        }
+    }
+    return output;
+}
+
+bool isIdentifier(const std::string& name) {
+    if (name.empty() || std::isdigit(static_cast<unsigned char>(name[0]))) return false;
+    return std::all_of(name.begin(), name.end(), [](unsigned char c) {
+        return std::isalnum(c) != 0 || c == '_' || c == '$' || c >= 0x80;
+    });
+}
+
+// A mapping from a byte offset in a module's emitted JavaScript back to
+// its original source.
+struct Segment {
+    uint32_t offset;
+    int32_t line;
+    int32_t column;
+};
+
+// Decodes single-source "mappings" against the code they describe,
+// turning generated line/UTF-16 column pairs into byte offsets.
+std::vector<Segment> decodeSegments(const std::string& mappings, const std::string& code) {
+    std::vector<Segment> segments;
+    int64_t sourceLine = 0;
+    int64_t sourceColumn = 0;
+    size_t lineStart = 0;
+    size_t p = 0;
+    while (p <= mappings.size()) {
+        size_t cursor = lineStart;
+        int64_t cursorColumn = 0;
+        int64_t column = 0;
+        while (p < mappings.size() && mappings[p] != ';') {
+            int64_t values[4] = {0, 0, 0, 0};
+            int count = 0;
+            while (p < mappings.size() && mappings[p] != ',' && mappings[p] != ';') {
+                int64_t value = 0;
+                int shift = 0;
+                for (; p < mappings.size(); ++p) {
+                    const char* digit = std::strchr(kBase64, mappings[p]);
+                    if (digit == nullptr || mappings[p] == '\0') break;
+                    const int64_t bits = digit - kBase64;
+                    value += (bits & 31) << shift;
+                    shift += 5;
+                    if ((bits & 32) == 0) {
+                        ++p;
+                        break;
+                    }
+                }
+                if (count < 4) values[count] = (value & 1) ? -(value >> 1) : value >> 1;
+                ++count;
+            }
+            if (p < mappings.size() && mappings[p] == ',') ++p;
+            column += values[0];
+            if (count < 4) continue;
+            sourceLine += values[2];
+            sourceColumn += values[3];
+            if (column < cursorColumn) {
+                cursor = lineStart;
+                cursorColumn = 0;
+            }
+            while (cursor < code.size() && code[cursor] != '\n' && cursorColumn < column) {
+                cursorColumn += utf16Units(static_cast<unsigned char>(code[cursor]));
+                ++cursor;
+            }
+            segments.push_back(Segment{static_cast<uint32_t>(cursor),
+                                       static_cast<int32_t>(sourceLine),
+                                       static_cast<int32_t>(sourceColumn)});
+        }
+        ++p;
+        const size_t newline = code.find('\n', lineStart);
+        if (newline == std::string::npos) break;
+        lineStart = newline + 1;
+    }
+    std::stable_sort(segments.begin(), segments.end(),
+                     [](const Segment& a, const Segment& b) { return a.offset < b.offset; });
+    return segments;
+}
+
+// A file transpiled and scanned; shared between bundles of the same
+// Transpiler while the file is unchanged.
+struct LoadedModule {
+    std::filesystem::file_time_type modified;
+    std::string source;
+    std::string code;                  // ES module JavaScript
+    ModuleScan scan;
+    std::vector<Segment> segments;
+    std::string error;
+};
+
+struct BundleModule {
+    std::string path;
+    std::shared_ptr<const LoadedModule> loaded;
+    std::unordered_map<std::string, int> dependencies;  // specifier -> module, -1 external
+    std::vector<int> requests;         // scan.requests, as modules
+    std::vector<std::string> errors;
+};
+
+void loadModule(const std::string& path, LoadedModule& module, const EmitOptions& options,
+                const std::string& jsxImportSource) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        module.error = "Cannot open file: " + path;
+        return;
+    }
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    module.source = buffer.str();
+
+    std::string mappings;
+    if (std::filesystem::path(path).extension() == ".json") {
+        module.code = "export default " + module.source + ";\n";
+    } else {
+        SourceRewriter rewriter(module.source, path);
+        EmitResult emitted = rewriter.emitJavaScript(options);
+        module.code = std::move(emitted.code);
+        mappings = std::move(emitted.mappings);
+        if (emitted.usesJSXRuntime) {
+            module.code = "import { jsx as _jsx, jsxs as _jsxs, Fragment as _Fragment } from \"" +
+                jsxImportSource + "/jsx-runtime\";\n" + module.code;
+            if (options.sourceMap) mappings.insert(0, 1, ';');
+        }
+    }
+    module.scan = SourceRewriter(module.code, "module.js").scanModule();
+    if (options.sourceMap) module.segments = decodeSegments(mappings, module.code);
+}
+
+} // namespace
+
+// Loaded modules by path, kept across bundle() calls so a rebuild in
+// watch mode only transpiles the files that changed.
+struct BundleModuleCache {
+    std::mutex mutex;
+    std::unordered_map<std::string, std::shared_ptr<const LoadedModule>> modules;
+};
+
+namespace {
+
+// A resolved binding: a top-level name of a bundled module, a module's
+// namespace object ("*"), or an import from an external module.
+struct Symbol {
+    int module = -1;
+    std::string name;
+    std::string specifier;  // external
+};
+
+class BundleLinker {
+public:
+    struct Options {
+        bool esModule = false;
+        bool minify = false;
+        bool sourceMap = false;
+        bool exportEntry = true;
+        std::string outDirectory;
+    };
+
+    BundleLinker(std::vector<BundleModule*> modules, std::vector<int> entries,
+                 const Options& options)
+        : modules_(std::move(modules)), entries_(std::move(entries)), options_(options) {
+        prepare();
+    }
+
+    std::vector<std::string> errors;
+    int keptStatements = 0;
+    int droppedStatements = 0;
+
+    // Marks what is live, names it, and prints the bundle.
+    bool link(std::string& code, std::string& mappings, std::vector<std::string>& sources) {
+        markLive();
+        if (!errors.empty()) return false;
+        assignNames();
+        print(code, mappings, sources);
+        return errors.empty();
+    }
+
+private:
+    struct ModuleInfo {
+        std::unordered_map<std::string, const ModuleScan::Import*> imports;  // by local
+        std::unordered_map<std::string, std::vector<size_t>> declaredBy;
+        std::unordered_map<std::string, std::string> finals;
+        std::unordered_set<std::string> names;                // every name
+        std::vector<uint8_t> live;
+        std::string stem;
+    };
+
+    std::vector<BundleModule*> modules_;
+    std::vector<int> entries_;
+    Options options_;
+    std::vector<ModuleInfo> info_;
+
+    std::unordered_set<std::string> reserved_;   // names some module uses unbound
+    std::unordered_set<std::string> everyName_;
+    std::unordered_set<std::string> claimed_;
+
+    std::vector<std::pair<int, size_t>> work_;
+    std::vector<uint8_t> namespaceLive_;
+    std::unordered_map<int, std::string> namespaceFinals_;
+    std::vector<std::string> externalOrder_;     // specifiers, first use first
+    std::map<std::string, std::vector<std::pair<std::string, std::string>>> externalBindings_;
+    std::map<std::pair<std::string, std::string>, std::string> externalFinals_;
+    std::map<std::pair<int, std::string>, bool> rewritable_;
+
+    std::string text(int m, const ModuleScan::Name& name) const {
+        return modules_[m]->loaded->code.substr(name.begin, name.end - name.begin);
+    }
+
+    void prepare() {
+        info_.resize(modules_.size());
+        namespaceLive_.assign(modules_.size(), 0);
+        for (size_t m = 0; m < modules_.size(); ++m) {
+            const BundleModule& module = *modules_[m];
+            ModuleInfo& info = info_[m];
+            info.live.assign(module.loaded->scan.statements.size(), 0);
+            std::string stem = std::filesystem::path(module.path).stem().string();
+            for (char& c : stem) {
+                if (!(std::isalnum(static_cast<unsigned char>(c)) || c == '_' || c == '$')) c = '_';
+            }
+            if (stem.empty() || std::isdigit(static_cast<unsigned char>(stem[0]))) stem = "_" + stem;
+            info.stem = stem;
+            for (const ModuleScan::Import& import : module.loaded->scan.imports) {
+                if (!import.local.empty()) info.imports[import.local] = &import;
+            }
+            for (size_t s = 0; s < module.loaded->scan.statements.size(); ++s) {
+                for (const std::string& name : module.loaded->scan.statements[s].declares) {
+                    info.declaredBy[name].push_back(s);
+                }
+            }
+            for (const ModuleScan::Name& name : module.loaded->scan.names) {
+                info.names.insert(text(static_cast<int>(m), name));
+            }
+            for (const std::string& name : info.names) {
+                everyName_.insert(name);
+                if (!info.imports.count(name) && !info.declaredBy.count(name)) {
+                    reserved_.insert(name);
+                }
+            }
+        }
+        for (const char* name : {"require", "module", "exports", "arguments", "eval",
+                                 "undefined", "globalThis", "__dirname", "__filename"}) {
+            reserved_.insert(name);
+        }
+    }
+
+    int dependency(int m, const std::string& specifier) const {
+        const auto& dependencies = modules_[m]->dependencies;
+        const auto found = dependencies.find(specifier);
+        return found == dependencies.end() ? -1 : found->second;
+    }
+
+    std::string where(int m) const { return modules_[m]->path; }
+
+    // ---- resolution --------------------------------------------------------
+
+    bool resolveExport(int m, const std::string& exported, Symbol& symbol,
+                       std::vector<int>& visiting) {
+        if (std::find(visiting.begin(), visiting.end(), m) != visiting.end()) return false;
+        visiting.push_back(m);
+        const ModuleScan& scan = modules_[m]->loaded->scan;
+        for (const ModuleScan::Export& entry : scan.exports) {
+            if (entry.exported != exported) continue;
+            if (entry.from.empty()) return resolveLocal(m, entry.local, symbol);
+            const int target = dependency(m, entry.from);
+            if (target < 0) {
+                symbol = Symbol{-1, entry.local, entry.from};
+                return true;
+            }
+            if (entry.local == "*") {
+                symbol = Symbol{target, "*", ""};
+                return true;
+            }
+            return resolveExport(target, entry.local, symbol, visiting);
+        }
+        if (exported == "default") return false;
+        std::string external;
+        for (const ModuleScan::Export& entry : scan.exports) {
+            if (entry.exported != "*") continue;
+            const int target = dependency(m, entry.from);
+            if (target < 0) {
+                if (external.empty()) external = entry.from;
+                continue;
+            }
+            if (resolveExport(target, exported, symbol, visiting)) return true;
+        }
+        if (!external.empty()) {
+            symbol = Symbol{-1, exported, external};
+            return true;
+        }
+        return false;
+    }
+
+    bool resolveExport(int m, const std::string& exported, Symbol& symbol) {
+        std::vector<int> visiting;
+        return resolveExport(m, exported, symbol, visiting);
+    }
+
+    bool resolveLocal(int m, const std::string& local, Symbol& symbol) {
+        const auto import = info_[m].imports.find(local);
+        if (import == info_[m].imports.end()) {
+            symbol = Symbol{m, local, ""};
+            return true;
+        }
+        const ModuleScan::Import& binding = *import->second;
+        const int target = dependency(m, binding.specifier);
+        if (target < 0) {
+            symbol = Symbol{-1, binding.imported, binding.specifier};
+            return true;
+        }
+        if (binding.imported == "*") {
+            symbol = Symbol{target, "*", ""};
+            return true;
+        }
+        if (resolveExport(target, binding.imported, symbol)) return true;
+        errors.push_back(where(m) + ": module '" + binding.specifier +
+                         "' has no export named '" + binding.imported + "'");
+        return false;
+    }
+
+    // Names a module exports, star re-exports included.
+    void exportNames(int m, std::vector<std::string>& names, std::vector<int>& visiting) const {
+        if (std::find(visiting.begin(), visiting.end(), m) != visiting.end()) return;
+        visiting.push_back(m);
+        for (const ModuleScan::Export& entry : modules_[m]->loaded->scan.exports) {
+            if (entry.exported == "*") {
+                const int target = dependency(m, entry.from);
+                if (target < 0) continue;
+                std::vector<std::string> starred;
+                exportNames(target, starred, visiting);
+                for (const std::string& name : starred) {
+                    if (name != "default" &&
+                        std::find(names.begin(), names.end(), name) == names.end()) {
+                        names.push_back(name);
+                    }
+                }
+            } else if (std::find(names.begin(), names.end(), entry.exported) == names.end()) {
+                names.push_back(entry.exported);
+            }
+        }
+    }
+
+    std::vector<std::string> exportNames(int m) const {
+        std::vector<std::string> names;
+        std::vector<int> visiting;
+        exportNames(m, names, visiting);
+        return names;
+    }
+
+    // `import * as ns` whose every use is `ns.member` can skip the
+    // namespace object: each use becomes a direct reference.
+    bool rewritable(int m, const std::string& local) {
+        const auto key = std::make_pair(m, local);
+        const auto cached = rewritable_.find(key);
+        if (cached != rewritable_.end()) return cached->second;
+        const ModuleScan::Import& binding = *info_[m].imports.at(local);
+        const int target = dependency(m, binding.specifier);
+        bool result = target >= 0;
+        for (const ModuleScan::Name& name : modules_[m]->loaded->scan.names) {
+            if (!result) break;
+            if (text(m, name) != local) continue;
+            Symbol symbol;
+            result = !name.shorthand && !name.member.empty() &&
+                resolveExport(target, name.member, symbol);
+        }
+        rewritable_[key] = result;
+        return result;
+    }
+
+    // ---- liveness ----------------------------------------------------------
+
+    void markStatement(int m, size_t s) {
+        if (info_[m].live[s]) return;
+        info_[m].live[s] = 1;
+        work_.emplace_back(m, s);
+    }
+
+    void markExternal(const Symbol& symbol, const std::string& hint) {
+        auto& bindings = externalBindings_[symbol.specifier];
+        for (const auto& binding : bindings) {
+            if (binding.first == symbol.name) return;
+        }
+        bindings.emplace_back(symbol.name, hint);
+    }
+
+    void markSymbol(const Symbol& symbol, const std::string& hint) {
+        if (symbol.module < 0) {
+            markExternal(symbol, hint);
+            return;
+        }
+        if (symbol.name == "*") {
+            if (namespaceLive_[symbol.module]) return;
+            namespaceLive_[symbol.module] = 1;
+            for (const std::string& name : exportNames(symbol.module)) {
+                Symbol member;
+                if (resolveExport(symbol.module, name, member)) markSymbol(member, name);
+            }
+            return;
+        }
+        const auto declared = info_[symbol.module].declaredBy.find(symbol.name);
+        if (declared == info_[symbol.module].declaredBy.end()) return;
+        for (size_t s : declared->second) markStatement(symbol.module, s);
+    }
+
+    void markLive() {
+        for (size_t m = 0; m < modules_.size(); ++m) {
+            const auto& statements = modules_[m]->loaded->scan.statements;
+            for (size_t s = 0; s < statements.size(); ++s) {
+                const ModuleScan::Statement& statement = statements[s];
+                if (statement.kind == ModuleScan::StatementKind::Other ||
+                    (statement.kind == ModuleScan::StatementKind::Declaration &&
+                     !statement.pure)) {
+                    markStatement(static_cast<int>(m), s);
+                }
+            }
+            for (const ModuleScan::Import& import : modules_[m]->loaded->scan.imports) {
+                if (dependency(static_cast<int>(m), import.specifier) < 0 &&
+                    std::find(externalOrder_.begin(), externalOrder_.end(),
+                              import.specifier) == externalOrder_.end()) {
+                    externalOrder_.push_back(import.specifier);
+                }
+            }
+        }
+        if (options_.exportEntry) {
+            for (int entry : entries_) {
+                for (const std::string& name : exportNames(entry)) {
+                    Symbol symbol;
+                    if (resolveExport(entry, name, symbol)) markSymbol(symbol, name);
+                }
+            }
+        }
+        while (!work_.empty()) {
+            const auto [m, s] = work_.back();
+            work_.pop_back();
+            const BundleModule& module = *modules_[m];
+            const ModuleScan::Statement& statement = module.loaded->scan.statements[s];
+            auto name = std::lower_bound(
+                module.loaded->scan.names.begin(), module.loaded->scan.names.end(), statement.begin,
+                [](const ModuleScan::Name& n, uint32_t offset) { return n.begin < offset; });
+            for (; name != module.loaded->scan.names.end() && name->begin < statement.end; ++name) {
+                const std::string local = text(m, *name);
+                if (info_[m].imports.count(local)) {
+                    Symbol symbol;
+                    if (!resolveLocal(m, local, symbol)) continue;
+                    if (symbol.module >= 0 && symbol.name == "*" && rewritable(m, local)) {
+                        Symbol member;
+                        resolveExport(symbol.module, name->member, member);
+                        markSymbol(member, name->member);
+                    } else {
+                        markSymbol(symbol, local);
+                    }
+                } else if (info_[m].declaredBy.count(local)) {
+                    markSymbol(Symbol{m, local, ""}, local);
+                }
+            }
+        }
+        for (size_t m = 0; m < modules_.size(); ++m) {
+            for (size_t s = 0; s < info_[m].live.size(); ++s) {
+                const auto kind = modules_[m]->loaded->scan.statements[s].kind;
+                if (kind != ModuleScan::StatementKind::Declaration &&
+                    kind != ModuleScan::StatementKind::Other) {
+                    continue;
+                }
+                if (info_[m].live[s]) {
+                    ++keptStatements;
+                } else {
+                    ++droppedStatements;
+                }
+            }
+        }
+    }
+
+    // ---- naming ------------------------------------------------------------
+
+    // `base` if nothing in the bundle would see a different binding under
+    // that name, else the first free `base$N`.
+    std::string claim(const std::string& base) {
+        if (!reserved_.count(base) && claimed_.insert(base).second) return base;
+        for (int n = 1;; ++n) {
+            std::string candidate = base + "$" + std::to_string(n);
+            if (!everyName_.count(candidate) && !reserved_.count(candidate) &&
+                claimed_.insert(candidate).second) {
+                return candidate;
+            }
+        }
+    }
+
+    void assignNames() {
+        for (size_t m = 0; m < modules_.size(); ++m) {
+            ModuleInfo& info = info_[m];
+            const auto& statements = modules_[m]->loaded->scan.statements;
+            for (size_t s = 0; s < statements.size(); ++s) {
+                if (!info.live[s]) continue;
+                for (const std::string& name : statements[s].declares) {
+                    if (info.finals.count(name)) continue;
+                    info.finals[name] = claim(name == kDefaultExportLocal
+                                                  ? info.stem + "_default" : name);
+                }
+            }
+        }
+        for (auto& [specifier, bindings] : externalBindings_) {
+            for (const auto& [imported, hint] : bindings) {
+                const std::string base =
+                    imported == "default" || imported == "*" || !isIdentifier(imported)
+                        ? hint : imported;
+                externalFinals_[{specifier, imported}] = claim(isIdentifier(base) ? base : "_" + base);
+            }
+        }
+        for (size_t m = 0; m < modules_.size(); ++m) {
+            if (namespaceLive_[m]) {
+                namespaceFinals_[static_cast<int>(m)] = claim(info_[m].stem + "_exports");
+            }
+        }
+    }
+
+    std::string finalName(const Symbol& symbol) {
+        if (symbol.module < 0) {
+            const auto found = externalFinals_.find({symbol.specifier, symbol.name});
+            if (found != externalFinals_.end()) return found->second;
+            markExternal(symbol, symbol.name);
+            return externalFinals_[{symbol.specifier, symbol.name}] = claim(symbol.name);
+        }
+        if (symbol.name == "*") {
+            auto found = namespaceFinals_.find(symbol.module);
+            if (found == namespaceFinals_.end()) {
+                found = namespaceFinals_.emplace(
+                    symbol.module, claim(info_[symbol.module].stem + "_exports")).first;
+            }
+            return found->second;
+        }
+        auto& finals = info_[symbol.module].finals;
+        const auto found = finals.find(symbol.name);
+        if (found != finals.end()) return found->second;
+        return finals[symbol.name] = claim(symbol.name);
+    }
+
+    // ---- printing ----------------------------------------------------------
+
+    class Writer {
+    public:
+        explicit Writer(bool map) : map_(map) {}
+
+        std::string code;
+        std::string mappings;
+
+        void write(const std::string& text) { code += text; }
+        void write(const std::string& text, size_t from, size_t to) {
+            code.append(text, from, to - from);
+        }
+        void mapping(int source, int32_t line, int32_t column) {
+            if (!map_) return;
+            for (; scanned_ < code.size(); ++scanned_) {
+                const unsigned char c = static_cast<unsigned char>(code[scanned_]);
+                if (c == '\n') {
+                    mappings += ';';
+                    column_ = 0;
+                    previousColumn_ = 0;
+                    firstOnLine_ = true;
+                } else if (c != '\r') {
+                    column_ += utf16Units(c);
+                }
+            }
+            if (!firstOnLine_) mappings += ',';
+            appendVLQ(mappings, column_ - previousColumn_);
+            appendVLQ(mappings, source - previousSource_);
+            appendVLQ(mappings, line - previousLine_);
+            appendVLQ(mappings, column - previousSourceColumn_);
+            previousColumn_ = column_;
+            previousSource_ = source;
+            previousLine_ = line;
+            previousSourceColumn_ = column;
+            firstOnLine_ = false;
+        }
+
+    private:
+        bool map_;
+        size_t scanned_ = 0;
+        int64_t column_ = 0;
+        int64_t previousColumn_ = 0;
+        int64_t previousSource_ = 0;
+        int64_t previousLine_ = 0;
+        int64_t previousSourceColumn_ = 0;
+        bool firstOnLine_ = true;
+    };
+
+    // What a name occurrence becomes: empty when it stays as written.
+    std::string replacement(int m, const ModuleScan::Name& name, uint32_t& end) {
+        end = name.end;
+        const std::string local = text(m, name);
+        std::string renamed;
+        if (info_[m].imports.count(local)) {
+            Symbol symbol;
+            if (!resolveLocal(m, local, symbol)) return std::string();
+            if (symbol.module >= 0 && symbol.name == "*" && rewritable(m, local)) {
+                Symbol member;
+                resolveExport(symbol.module, name.member, member);
+                end = name.memberEnd;
+                return finalName(member);
+            }
+            renamed = finalName(symbol);
+        } else if (info_[m].declaredBy.count(local)) {
+            renamed = finalName(Symbol{m, local, ""});
+        }
+        if (renamed.empty() || renamed == local) return std::string();
+        return name.shorthand ? local + ": " + renamed : renamed;
+    }
+
+    void copy(Writer& writer, int m, int source, uint32_t from, uint32_t to) {
+        const BundleModule& module = *modules_[m];
+        const std::vector<Segment>& segments = module.loaded->segments;
+        auto segment = std::lower_bound(
+            segments.begin(), segments.end(), from,
+            [](const Segment& s, uint32_t offset) { return s.offset < offset; });
+        uint32_t position = from;
+        const auto copyTo = [&](uint32_t stop) {
+            for (; segment != segments.end() && segment->offset < stop; ++segment) {
+                writer.write(module.loaded->code, position, segment->offset);
+                position = segment->offset;
+                writer.mapping(source, segment->line, segment->column);
+            }
+            writer.write(module.loaded->code, position, stop);
+            position = stop;
+        };
+        auto name = std::lower_bound(
+            module.loaded->scan.names.begin(), module.loaded->scan.names.end(), from,
+            [](const ModuleScan::Name& n, uint32_t offset) { return n.begin < offset; });
+        for (; name != module.loaded->scan.names.end() && name->begin < to; ++name) {
+            uint32_t end = 0;
+            const std::string renamed = replacement(m, *name, end);
+            if (renamed.empty()) continue;
+            copyTo(name->begin);
+            if (segment != segments.end() && segment->offset == name->begin) {
+                writer.mapping(source, segment->line, segment->column);
+            }
+            writer.write(renamed);
+            position = end;
+            while (segment != segments.end() && segment->offset < end) ++segment;
+        }
+        copyTo(to);
+    }
+
+    // First mapping at or after `offset`, to attach to inserted text.
+    void mapAt(Writer& writer, int m, int source, uint32_t offset) {
+        const std::vector<Segment>& segments = modules_[m]->loaded->segments;
+        const auto segment = std::lower_bound(
+            segments.begin(), segments.end(), offset,
+            [](const Segment& s, uint32_t value) { return s.offset < value; });
+        if (segment != segments.end()) {
+            writer.mapping(source, segment->line, segment->column);
+        }
+    }
+
+    static std::string propertyName(const std::string& name) {
+        return isIdentifier(name) ? name : "\"" + jsonEscape(name) + "\"";
+    }
+
+    void printExternals(Writer& writer) {
+        const std::string newline = "\n";
+        for (const std::string& specifier : externalOrder_) {
+            const auto bindings = externalBindings_.find(specifier);
+            const std::string quoted = "\"" + jsonEscape(specifier) + "\"";
+            if (bindings == externalBindings_.end() || bindings->second.empty()) {
+                writer.write(options_.esModule ? "import " + quoted + ";" + newline
+                                               : "require(" + quoted + ");" + newline);
+                continue;
+            }
+            std::vector<std::string> named;
+            for (const auto& binding : bindings->second) {
+                const std::string& imported = binding.first;
+                const std::string& local = externalFinals_.at({specifier, imported});
+                if (imported == "*") {
+                    writer.write(options_.esModule
+                        ? "import * as " + local + " from " + quoted + ";" + newline
+                        : "var " + local + " = require(" + quoted + ");" + newline);
+                } else if (imported == "default") {
+                    writer.write(options_.esModule
+                        ? "import " + local + " from " + quoted + ";" + newline
+                        : "var " + local + " = (m => m && m.__esModule ? m.default : m)(require(" +
+                              quoted + "));" + newline);
+                } else if (options_.esModule) {
+                    named.push_back(imported == local ? local
+                                                      : propertyName(imported) + " as " + local);
+                } else {
+                    named.push_back(imported == local ? local
+                                                      : propertyName(imported) + ": " + local);
+                }
+            }
+            if (named.empty()) continue;
+            std::string list;
+            for (size_t k = 0; k < named.size(); ++k) list += (k ? ", " : "") + named[k];
+            writer.write(options_.esModule
+                ? "import { " + list + " } from " + quoted + ";" + newline
+                : "var { " + list + " } = require(" + quoted + ");" + newline);
+        }
+    }
+
+    void printNamespaces(Writer& writer) {
+        for (size_t m = 0; m < modules_.size(); ++m) {
+            if (!namespaceLive_[m]) continue;
+            std::string object = "var " + finalName(Symbol{static_cast<int>(m), "*", ""}) +
+                " = Object.freeze({ __proto__: null";
+            for (const std::string& name : exportNames(static_cast<int>(m))) {
+                Symbol symbol;
+                if (!resolveExport(static_cast<int>(m), name, symbol)) continue;
+                object += ", get " + propertyName(name) + "() { return " +
+                    finalName(symbol) + "; }";
+            }
+            writer.write(object + " });\n");
+        }
+    }
+
+    void printExports(Writer& writer) {
+        if (!options_.exportEntry) return;
+        std::vector<std::string> clauses;
+        std::vector<std::string> stars;
+        for (int entry : entries_) {
+            for (const std::string& name : exportNames(entry)) {
+                Symbol symbol;
+                if (!resolveExport(entry, name, symbol)) continue;
+                const std::string local = finalName(symbol);
+                clauses.push_back(options_.esModule
+                    ? (local == name ? local : local + " as " + propertyName(name))
+                    : "exports" + (isIdentifier(name) ? "." + name
+                                                      : "[\"" + jsonEscape(name) + "\"]") +
+                          " = " + local + ";");
+            }
+            for (const ModuleScan::Export& entryExport : modules_[entry]->loaded->scan.exports) {
+                if (entryExport.exported == "*" && dependency(entry, entryExport.from) < 0) {
+                    stars.push_back(entryExport.from);
+                }
+            }
+        }
+        if (!options_.esModule) {
+            if (clauses.empty() && stars.empty()) return;
+            writer.write("Object.defineProperty(exports, \"__esModule\", { value: true });\n");
+            for (const std::string& clause : clauses) writer.write(clause + "\n");
+            for (const std::string& star : stars) {
+                writer.write("Object.keys(require(\"" + jsonEscape(star) +
+                             "\")).forEach(k => k === \"default\" || k in exports || "
+                             "Object.defineProperty(exports, k, { enumerable: true, "
+                             "get: () => require(\"" + jsonEscape(star) + "\")[k] }));\n");
+            }
+            return;
+        }
+        if (!clauses.empty()) {
+            std::string list;
+            for (size_t k = 0; k < clauses.size(); ++k) list += (k ? ", " : "") + clauses[k];
+            writer.write("export { " + list + " };\n");
+        }
+        for (const std::string& star : stars) {
+            writer.write("export * from \"" + jsonEscape(star) + "\";\n");
+        }
+    }
+
+    void print(std::string& code, std::string& mappings, std::vector<std::string>& sources) {
+        Writer writer(options_.sourceMap);
+        if (!options_.esModule) writer.write("\"use strict\";\n");
+        printExternals(writer);
+        printNamespaces(writer);
+
+        for (size_t mi = 0; mi < modules_.size(); ++mi) {
+            const int m = static_cast<int>(mi);
+            const BundleModule& module = *modules_[m];
+            const auto& statements = module.loaded->scan.statements;
+            const bool any = std::any_of(info_[m].live.begin(), info_[m].live.end(),
+                                         [](uint8_t live) { return live != 0; });
+            if (!any) continue;
+            const int source = static_cast<int>(sources.size());
+            sources.push_back(module.path);
+            if (!options_.minify) {
+                std::string shown = module.path;
+                if (!options_.outDirectory.empty()) {
+                    std::error_code error;
+                    const auto relative = std::filesystem::relative(
+                        module.path, options_.outDirectory, error);
+                    if (!error && !relative.empty()) shown = relative.generic_string();
+                }
+                writer.write("// " + shown + "\n");
+            }
+            for (size_t s = 0; s < statements.size(); ++s) {
+                if (!info_[m].live[s]) continue;
+                const ModuleScan::Statement& statement = statements[s];
+                uint32_t from = statement.code;
+                if (statement.defaultExpression) {
+                    mapAt(writer, m, source, from);
+                    writer.write("var " + finalName(Symbol{m, kDefaultExportLocal, ""}) + " = ");
+                }
+                if (statement.anonymous != UINT32_MAX) {
+                    copy(writer, m, source, from, statement.anonymous);
+                    writer.write(" " + finalName(Symbol{m, kDefaultExportLocal, ""}));
+                    from = statement.anonymous;
+                    while (from < statement.end && module.loaded->code[from] == ' ') ++from;
+                }
+                copy(writer, m, source, from, statement.end);
+                // Declarations of functions and classes end in `}`; anything
+                // else gets its `;` so the next chunk cannot continue it.
+                const std::string head = module.loaded->code.substr(statement.code, 8);
+                const bool block = !statement.defaultExpression &&
+                    statement.kind == ModuleScan::StatementKind::Declaration &&
+                    (head.rfind("function", 0) == 0 || head.rfind("async", 0) == 0 ||
+                     head.rfind("class", 0) == 0);
+                size_t last = writer.code.size();
+                while (last > 0 && std::isspace(static_cast<unsigned char>(writer.code[last - 1]))) {
+                    --last;
+                }
+                writer.code.resize(last);
+                if (!block && last > 0 && writer.code[last - 1] != ';') writer.write(";");
+                writer.write("\n");
+            }
+        }
+        printExports(writer);
+        code = std::move(writer.code);
+        mappings = std::move(writer.mappings);
+    }
+};
+
+} // namespace
+
+std::string Transpiler::resolveImport(const std::string& specifier,
+                                      const std::string& importer) const {
+    namespace fs = std::filesystem;
+    const auto& opts = config_.compilerOptions;
+
+    const auto file = [](const fs::path& candidate) -> std::string {
+        std::error_code error;
+        if (!fs::is_regular_file(candidate, error)) return std::string();
+        return fs::weakly_canonical(candidate, error).string();
+    };
+    // `./x`, `./x.js` (meaning x.ts), `./dir` (meaning dir/index.ts).
+    const auto lookup = [&](const fs::path& base) -> std::string {
+        static const char* const extensions[] = {
+            ".ts", ".tsx", ".mts", ".cts", ".js", ".jsx", ".mjs", ".cjs"};
+        const std::string extension = base.extension().string();
+        if (extension == ".js" || extension == ".jsx" || extension == ".mjs" ||
+            extension == ".cjs") {
+            fs::path typescript = base;
+            typescript.replace_extension(
+                extension == ".js" ? ".ts" : extension == ".jsx" ? ".tsx"
+                : extension == ".mjs" ? ".mts" : ".cts");
+            std::string found = file(typescript);
+            if (!found.empty()) return found;
+        }
+        std::string found = file(base);
+        if (!found.empty()) return found;
+        for (const char* candidate : extensions) {
+            found = file(fs::path(base.string() + candidate));
+            if (!found.empty()) return found;
+        }
+        for (const char* candidate : extensions) {
+            found = file(base / (std::string("index") + candidate));
+            if (!found.empty()) return found;
+        }
+        return std::string();
+    };
+
+    if (specifier.rfind("./", 0) == 0 || specifier.rfind("../", 0) == 0 ||
+        specifier == "." || specifier == ".." || fs::path(specifier).is_absolute()) {
+        return lookup(fs::path(importer).parent_path() / specifier);
+    }
+    const fs::path base = opts.baseUrl.empty()
+        ? fs::path(configDir_.empty() ? "." : configDir_)
+        : fs::path(resolveConfigRelativePath(opts.baseUrl));
+    for (const auto& [pattern, replacements] : opts.paths) {
+        const size_t star = pattern.find('*');
+        std::string wildcard;
+        if (star == std::string::npos) {
+            if (specifier != pattern) continue;
+        } else {
+            const std::string prefix = pattern.substr(0, star);
+            const std::string suffix = pattern.substr(star + 1);
+            if (specifier.size() < prefix.size() + suffix.size() ||
+                specifier.compare(0, prefix.size(), prefix) != 0 ||
+                specifier.compare(specifier.size() - suffix.size(), suffix.size(),
+                                  suffix) != 0) {
+                continue;
+            }
+            wildcard = specifier.substr(prefix.size(),
+                                        specifier.size() - prefix.size() - suffix.size());
+        }
+        for (std::string replacement : replacements) {
+            const size_t replacementStar = replacement.find('*');
+            if (replacementStar != std::string::npos) {
+                replacement.replace(replacementStar, 1, wildcard);
+            }
+            const std::string found = lookup(base / replacement);
+            if (!found.empty()) return found;
+        }
+    }
+    if (!opts.baseUrl.empty()) return lookup(base / specifier);
+    return std::string();
+}
+
+BundleResult Transpiler::bundle(const std::vector<std::string>& entries,
+                                const std::string& outFile) {
+    auto startTime = std::chrono::high_resolution_clock::now();
+    const auto& opts = config_.compilerOptions;
+
+    BundleResult result;
+    result.outFile = outFile;
+
+    // ---- graph -------------------------------------------------------------
+
+    if (!bundleCache_) bundleCache_ = std::make_shared<BundleModuleCache>();
+    BundleModuleCache& cache = *bundleCache_;
+
+    std::mutex mutex;
+    std::condition_variable ready;
+    std::deque<size_t> queue;
+    std::vector<std::unique_ptr<BundleModule>> modules;
+    std::unordered_map<std::string, size_t> indexOf;
+    size_t active = 0;
+
+    // Caller holds the lock.
+    const auto enqueue = [&](const std::string& path) {
+        const auto [found, inserted] = indexOf.emplace(path, modules.size());
+        if (inserted) {
+            modules.push_back(std::make_unique<BundleModule>());
+            modules.back()->path = path;
+            queue.push_back(found->second);
+            ready.notify_one();
+        }
+        return static_cast<int>(found->second);
+    };
+
+    std::vector<int> entryIndices;
+    for (const std::string& entry : entries) {
+        std::error_code error;
+        const std::filesystem::path path = std::filesystem::weakly_canonical(entry, error);
+        if (error || !std::filesystem::is_regular_file(path)) {
+            result.errors.push_back("Cannot find entry: " + entry);
+            continue;
+        }
+        const int index = enqueue(path.string());
+        if (std::find(entryIndices.begin(), entryIndices.end(), index) == entryIndices.end()) {
+            entryIndices.push_back(index);
+        }
+    }
+    if (!result.errors.empty()) return result;
+
+    const auto work = [&]() {
+        std::unique_lock<std::mutex> lock(mutex);
+        for (;;) {
+            ready.wait(lock, [&] { return !queue.empty() || active == 0; });
+            if (queue.empty()) return;
+            BundleModule* module = modules[queue.front()].get();
+            queue.pop_front();
+            ++active;
+            lock.unlock();
+
+            std::error_code error;
+            const auto modified = std::filesystem::last_write_time(module->path, error);
+            {
+                std::lock_guard<std::mutex> cacheLock(cache.mutex);
+                const auto cached = cache.modules.find(module->path);
+                if (cached != cache.modules.end() && !error &&
+                    cached->second->modified == modified) {
+                    module->loaded = cached->second;
+                }
+            }
+            if (!module->loaded) {
+                EmitOptions options = emitOptionsFor(module->path);
+                options.commonJS = false;
+                options.sourceMap = opts.sourceMap || opts.inlineSourceMap;
+                options.rewriteSpecifier = nullptr;
+                auto loaded = std::make_shared<LoadedModule>();
+                loaded->modified = modified;
+                loadModule(module->path, *loaded, options, opts.jsxImportSource);
+                if (loaded->error.empty()) {
+                    std::lock_guard<std::mutex> cacheLock(cache.mutex);
+                    cache.modules[module->path] = loaded;
+                } else {
+                    module->errors.push_back(loaded->error);
+                }
+                module->loaded = std::move(loaded);
+            }
+            // Resolution is redone every time: a new file can change
+            // what an unchanged import refers to.
+            std::vector<std::string> resolved;
+            for (const std::string& specifier : module->loaded->scan.requests) {
+                resolved.push_back(resolveImport(specifier, module->path));
+                const bool relative = specifier.rfind("./", 0) == 0 ||
+                    specifier.rfind("../", 0) == 0 || specifier.rfind("/", 0) == 0;
+                if (resolved.back().empty() && relative) {
+                    module->errors.push_back("Cannot resolve '" + specifier + "'");
+                }
+            }
+
+            lock.lock();
+            for (size_t k = 0; k < resolved.size(); ++k) {
+                const int dependency = resolved[k].empty() ? -1 : enqueue(resolved[k]);
+                module->requests.push_back(dependency);
+                module->dependencies[module->loaded->scan.requests[k]] = dependency;
+            }
+            --active;
+            if (active == 0 && queue.empty()) ready.notify_all();
+        }
+    };
+    const size_t workerCount = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<std::thread> workers;
+    for (size_t worker = 1; worker < workerCount; ++worker) {
+        workers.emplace_back(work);
+    }
+    work();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    for (const auto& module : modules) {
+        result.totalInputSize += module->loaded->source.size();
+        for (const std::string& error : module->errors) {
+            result.errors.push_back(module->path + ": " + error);
+        }
+        for (const std::string& warning : module->loaded->scan.warnings) {
+            result.warnings.push_back(module->path + ": " + warning);
+        }
+    }
+    if (!result.errors.empty()) return result;
+
+    // ---- order -------------------------------------------------------------
+
+    // Post-order of the imports from each entry: dependencies first, in the
+    // order they are imported.
+    std::vector<int> order;
+    std::vector<uint8_t> visited(modules.size(), 0);
+    for (int entry : entryIndices) {
+        if (visited[entry]) continue;
+        std::vector<std::pair<int, size_t>> stack{{entry, 0}};
+        visited[entry] = 1;
+        while (!stack.empty()) {
+            auto& [module, next] = stack.back();
+            const std::vector<int>& requests = modules[module]->requests;
+            if (next < requests.size()) {
+                const int dependency = requests[next++];
+                if (dependency >= 0 && !visited[dependency]) {
+                    visited[dependency] = 1;
+                    stack.emplace_back(dependency, 0);
+                }
+                continue;
+            }
+            order.push_back(module);
+            stack.pop_back();
+        }
+    }
+    std::vector<int> position(modules.size(), -1);
+    std::vector<BundleModule*> ordered;
+    for (int index : order) {
+        position[index] = static_cast<int>(ordered.size());
+        ordered.push_back(modules[index].get());
+    }
+    for (BundleModule* module : ordered) {
+        for (auto& [specifier, dependency] : module->dependencies) {
+            if (dependency >= 0) dependency = position[dependency];
+        }
+        result.modules.push_back(module->path);
+        auto& imports = result.imports[module->path];
+        for (int dependency : module->requests) {
+            if (dependency >= 0) imports.push_back(modules[dependency]->path);
+        }
+    }
+    std::vector<int> orderedEntries;
+    for (int entry : entryIndices) orderedEntries.push_back(position[entry]);
+
+    // ---- link and print ----------------------------------------------------
+
+    std::string module = opts.module;
+    std::transform(module.begin(), module.end(), module.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    BundleLinker::Options linkOptions;
+    linkOptions.esModule = module.rfind("es", 0) == 0 || module == "preserve";
+    linkOptions.minify = opts.minify;
+    linkOptions.sourceMap = opts.sourceMap || opts.inlineSourceMap;
+    linkOptions.exportEntry = orderedEntries.size() == 1;
+    linkOptions.outDirectory =
+        std::filesystem::absolute(outFile).parent_path().lexically_normal().string();
+
+    BundleLinker linker(ordered, orderedEntries, linkOptions);
+    std::string mappings;
+    std::vector<std::string> sources;
+    if (!linker.link(result.code, mappings, sources)) {
+        result.errors = linker.errors;
+        return result;
+    }
+    result.keptStatements = linker.keptStatements;
+    result.droppedStatements = linker.droppedStatements;
+
+    if (linkOptions.sourceMap) {
+        const std::filesystem::path outPath(outFile);
+        std::stringstream map;
+        map << "{\n";
+        map << "  \"version\": 3,\n";
+        map << "  \"file\": \"" << jsonEscape(outPath.filename().string()) << "\",\n";
+        if (!opts.sourceRoot.empty()) {
+            map << "  \"sourceRoot\": \"" << jsonEscape(opts.sourceRoot) << "\",\n";
+        }
+        map << "  \"sources\": [";
+        for (size_t k = 0; k < sources.size(); ++k) {
+            std::error_code error;
+            std::filesystem::path relative = std::filesystem::relative(
+                sources[k], linkOptions.outDirectory, error);
+            if (error || relative.empty()) relative = sources[k];
+            map << (k ? ", " : "") << "\"" << jsonEscape(relative.generic_string()) << "\"";
+        }
+        map << "],\n";
+        if (opts.inlineSources) {
+            map << "  \"sourcesContent\": [";
+            for (size_t k = 0; k < sources.size(); ++k) {
+                const auto found = std::find_if(
+                    ordered.begin(), ordered.end(),
+                    [&](const BundleModule* m) { return m->path == sources[k]; });
+                map << (k ? ", " : "") << "\"" << jsonEscape((*found)->loaded->source) << "\"";
+            }
+            map << "],\n";
+        }
+        map << "  \"names\": [],\n";
+        map << "  \"mappings\": \"" << mappings << "\"\n";
+        map << "}\n";
+        result.sourceMap = map.str();
+    }
+
+    // ---- write -------------------------------------------------------------
+
+    if (!opts.noEmit) {
+        std::filesystem::path outPath(outFile);
+        if (!outPath.parent_path().empty()) {
+            std::filesystem::create_directories(outPath.parent_path());
+        }
+        std::string code = result.code;
+        if (!result.sourceMap.empty()) {
+            if (opts.inlineSourceMap) {
+                std::string encoded;
+                int value = 0;
+                int bits = -6;
+                for (unsigned char c : result.sourceMap) {
+                    value = (value << 8) + c;
+                    bits += 8;
+                    while (bits >= 0) {
+                        encoded += kBase64[(value >> bits) & 0x3F];
+                        bits -= 6;
+                    }
+                }
+                if (bits > -6) encoded += kBase64[((value << 8) >> (bits + 8)) & 0x3F];
+                while (encoded.size() % 4) encoded += '=';
+                code += "//# sourceMappingURL=data:application/json;base64," + encoded + "\n";
+            } else {
+                code += "//# sourceMappingURL=" + outPath.filename().string() + ".map\n";
+                std::ofstream mapFile(outFile + ".map");
+                mapFile << result.sourceMap;
+            }
+        }
+        std::ofstream output(outFile);
+        if (!output.is_open()) {
+            result.errors.push_back("Cannot write " + outFile);
+            return result;
+        }
+        output << code;
+        result.outputSize = code.size();
+    } else {
+        result.outputSize = result.code.size();
+    }
+
+    result.success = true;
+    auto endTime = std::chrono::high_resolution_clock::now();
+    result.totalTimeMs = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+    return result;
+}
+
+} // namespace transpiler
+} // namespace nova
@@ -0,0 +1,4942 @@
+#include "nova/Transpiler/SourceRewriter.h"
+#include "nova/Frontend/Lexer.h"
+#include "nova/Frontend/Token.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+namespace nova {
+namespace transpiler {
+
+namespace {
+
+constexpr size_t npos = static_cast<size_t>(-1);
+constexpr uint32_t noMatch = UINT32_MAX;
+
+struct Tok {
+    TokenType type;
+    std::string_view value;
+    uint32_t begin;
+    uint32_t end;
+    bool newlineBefore;
+    bool jsx;
+};
+
+bool isIdentifierChar(unsigned char c) {
+    return std::isalnum(c) != 0 || c == '_' || c == '$' || c >= 0x80;
+}
+
+bool isSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+// Skips whitespace and comments starting at `position`; stops at `limit`.
+size_t skipTrivia(const std::string& source, size_t position, size_t limit) {
+    while (position < limit) {
+        const char c = source[position];
+        if (isSpace(c)) {
+            ++position;
+        } else if (c == '/' && position + 1 < limit &&
+                   source[position + 1] == '/') {
+            while (position < limit && source[position] != '\n') ++position;
+        } else if (c == '/' && position + 1 < limit &&
+                   source[position + 1] == '*') {
+            const size_t close = source.find("*/", position + 2);
+            position = close == std::string::npos ? limit : close + 2;
+        } else {
+            break;
+        }
+    }
+    return position;
+}
+
+// Offset one past the token the lexer reported at `begin`. Identifiers,
+// operators and regexes are slices of the source, but escaped strings,
+// templates and numbers with separators are cooked and shorter than the
+// text they came from; those are re-scanned the way the lexer scans them.
+size_t tokenEnd(const std::string& source, TokenType type, size_t begin,
+                std::string_view value) {
+    const size_t length = source.size();
+    size_t p = begin;
+    switch (type) {
+        case TokenType::StringLiteral: {
+            const char quote = source[p++];
+            while (p < length && source[p] != quote) {
+                p += source[p] == '\\' ? 2 : 1;
+            }
+            return std::min(p + 1, length);
+        }
+        case TokenType::TemplateLiteral: {
+            ++p;
+            int depth = 0;
+            while (p < length) {
+                const char c = source[p];
+                if (depth == 0 && c == '`') break;
+                if (depth == 0 && c == '\\') {
+                    p += 2;
+                    continue;
+                }
+                ++p;
+                if (c == '$' && p < length && source[p] == '{') {
+                    ++p;
+                    ++depth;
+                } else if (depth > 0 && c == '{') {
+                    ++depth;
+                } else if (depth > 0 && c == '}') {
+                    --depth;
+                }
+            }
+            return std::min(p + 1, length);
+        }
+        case TokenType::NumberLiteral: {
+            const auto digit = [&](size_t at) {
+                return at < length &&
+                    std::isdigit(static_cast<unsigned char>(source[at])) != 0;
+            };
+            if (source[p] == '0' && p + 1 < length &&
+                std::strchr("bBoOxX", source[p + 1]) != nullptr &&
+                source[p + 1] != '\0') {
+                p += 2;
+                while (p < length &&
+                       std::isxdigit(static_cast<unsigned char>(source[p]))) {
+                    ++p;
+                }
+                return p;
+            }
+            while (digit(p) || (p < length && source[p] == '_')) ++p;
+            if (p < length && source[p] == '.' && digit(p + 1)) {
+                ++p;
+                while (digit(p) || (p < length && source[p] == '_')) ++p;
+            }
+            if (p < length && (source[p] == 'e' || source[p] == 'E')) {
+                ++p;
+                if (p < length && (source[p] == '+' || source[p] == '-')) ++p;
+                while (digit(p)) ++p;
+            }
+            if (p < length && source[p] == 'n') ++p;
+            return p;
+        }
+        default:
+            return std::min(begin + value.size(), length);
+    }
+}
+
+bool isKeyword(TokenType type) {
+    return type >= TokenType::KeywordBreak && type <= TokenType::KeywordUsing;
+}
+
+bool identifierLike(TokenType type) {
+    return type == TokenType::Identifier || isKeyword(type) ||
+        type == TokenType::TrueLiteral || type == TokenType::FalseLiteral ||
+        type == TokenType::NullLiteral || type == TokenType::UndefinedLiteral;
+}
+
+bool isLiteral(TokenType type) {
+    switch (type) {
+        case TokenType::NumberLiteral:
+        case TokenType::StringLiteral:
+        case TokenType::TemplateLiteral:
+        case TokenType::RegexLiteral:
+        case TokenType::TrueLiteral:
+        case TokenType::FalseLiteral:
+        case TokenType::NullLiteral:
+        case TokenType::UndefinedLiteral:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// ============================================================================
+// JSX
+// ============================================================================
+
+// Character-level JSX element parser. Without an output string it only
+// finds where an element ends, which is how the token stream carves JSX
+// out of the lexer's view of the file; with one it also lowers the element
+// to factory calls, handing every `{...}` container to `expression` so
+// nested JSX and type syntax inside it are rewritten too.
+class JSXParser {
+public:
+    struct Options {
+        bool automatic = false;
+        std::string factory;
+        std::string fragment;
+        std::function<std::string(const std::string&)> expression;
+    };
+
+    explicit JSXParser(const std::string& source,
+                       const Options* options = nullptr)
+        : source_(source), options_(options) {}
+
+    bool scan(size_t start, size_t& end) {
+        return parseElement(start, end, nullptr);
+    }
+
+    bool transform(size_t start, size_t& end, std::string& output) {
+        return parseElement(start, end, &output);
+    }
+
+    // Component names referenced by the last element, and the `{...}`
+    // containers directly inside it (not those nested in containers).
+    const std::vector<std::string>& components() const { return components_; }
+    const std::vector<std::pair<size_t, size_t>>& containers() const {
+        return containers_;
+    }
+
+    static std::string quote(const std::string& text) {
+        std::string result = "\"";
+        for (unsigned char c : text) {
+            switch (c) {
+                case '\\': result += "\\\\"; break;
+                case '"': result += "\\\""; break;
+                case '\n': result += "\\n"; break;
+                case '\r': result += "\\r"; break;
+                case '\t': result += "\\t"; break;
+                default:
+                    if (c < 0x20) {
+                        char escaped[8];
+                        std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+                        result += escaped;
+                    } else {
+                        result += static_cast<char>(c);
+                    }
+            }
+        }
+        result += '"';
+        return result;
+    }
+
+    // Offset of the `}` closing the container opened at `open`, skipping
+    // strings, templates, comments and nested elements; npos if unclosed.
+    size_t containerEnd(size_t open) {
+        ++nesting_;
+        const size_t close = scanContainer(open);
+        --nesting_;
+        return close;
+    }
+
+private:
+    const std::string& source_;
+    const Options* options_;
+    std::vector<std::string> components_;
+    std::vector<std::pair<size_t, size_t>> containers_;
+    int nesting_ = 0;
+
+    size_t scanContainer(size_t open) {
+        int depth = 0;
+        char previous = '{';
+        std::string word;
+        const size_t length = source_.size();
+        for (size_t p = open; p < length;) {
+            const char c = source_[p];
+            if (c == '"' || c == '\'') {
+                p = skipString(p);
+                previous = c;
+                word.clear();
+                continue;
+            }
+            if (c == '`') {
+                p = skipTemplate(p);
+                previous = c;
+                word.clear();
+                continue;
+            }
+            if (c == '/' && p + 1 < length &&
+                (source_[p + 1] == '/' || source_[p + 1] == '*')) {
+                p = skipTrivia(source_, p, length);
+                continue;
+            }
+            if (c == '<' &&
+                (std::strchr("({[,;:=?&|!>", previous) != nullptr ||
+                 word == "return" || word == "yield" || word == "default")) {
+                size_t end = p;
+                if (parseElement(p, end, nullptr)) {
+                    p = end;
+                    previous = ')';
+                    word.clear();
+                    continue;
+                }
+            }
+            if (c == '{') {
+                ++depth;
+            } else if (c == '}' && --depth == 0) {
+                return p;
+            }
+            if (isIdentifierChar(static_cast<unsigned char>(c))) {
+                if (!isIdentifierChar(static_cast<unsigned char>(previous))) {
+                    word.clear();
+                }
+                word += c;
+            } else if (!isSpace(c)) {
+                word.clear();
+            }
+            if (!isSpace(c)) previous = c;
+            ++p;
+        }
+        return npos;
+    }
+
+    size_t skipString(size_t p) const {
+        const char quote = source_[p++];
+        while (p < source_.size() && source_[p] != quote &&
+               source_[p] != '\n') {
+            p += source_[p] == '\\' ? 2 : 1;
+        }
+        return std::min(p + 1, source_.size());
+    }
+
+    size_t skipTemplate(size_t p) {
+        ++p;
+        while (p < source_.size() && source_[p] != '`') {
+            if (source_[p] == '\\') {
+                p += 2;
+            } else if (source_[p] == '$' && p + 1 < source_.size() &&
+                       source_[p + 1] == '{') {
+                const size_t close = containerEnd(p + 1);
+                if (close == npos) return source_.size();
+                p = close + 1;
+            } else {
+                ++p;
+            }
+        }
+        return std::min(p + 1, source_.size());
+    }
+
+    void skipSpace(size_t& p) const {
+        while (p < source_.size() && isSpace(source_[p])) ++p;
+    }
+
+    bool name(size_t& p, std::string& result, bool member) const {
+        const size_t start = p;
+        while (p < source_.size() &&
+               (isIdentifierChar(static_cast<unsigned char>(source_[p])) ||
+                source_[p] == '-' || source_[p] == ':' ||
+                (member && source_[p] == '.'))) {
+            ++p;
+        }
+        result = source_.substr(start, p - start);
+        return p > start;
+    }
+
+    static void appendUtf8(std::string& output, uint32_t codepoint) {
+        if (codepoint < 0x80) {
+            output += static_cast<char>(codepoint);
+        } else if (codepoint < 0x800) {
+            output += static_cast<char>(0xC0 | (codepoint >> 6));
+            output += static_cast<char>(0x80 | (codepoint & 0x3F));
+        } else if (codepoint < 0x10000) {
+            output += static_cast<char>(0xE0 | (codepoint >> 12));
+            output += static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+            output += static_cast<char>(0x80 | (codepoint & 0x3F));
+        } else {
+            output += static_cast<char>(0xF0 | (codepoint >> 18));
+            output += static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F));
+            output += static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+            output += static_cast<char>(0x80 | (codepoint & 0x3F));
+        }
+    }
+
+    // HTML character references allowed in JSX text and attribute strings.
+    static std::string decodeEntities(const std::string& text) {
+        static const struct { const char* name; uint32_t codepoint; } named[] = {
+            {"amp", '&'}, {"lt", '<'}, {"gt", '>'}, {"quot", '"'},
+            {"apos", '\''}, {"nbsp", 0xA0}, {"copy", 0xA9}, {"reg", 0xAE},
+            {"hellip", 0x2026}, {"mdash", 0x2014}, {"ndash", 0x2013},
+            {"middot", 0xB7}, {"times", 0xD7}, {"laquo", 0xAB},
+            {"raquo", 0xBB}, {"bull", 0x2022}, {"trade", 0x2122},
+        };
+        std::string result;
+        for (size_t p = 0; p < text.size(); ++p) {
+            const size_t semicolon = text[p] == '&'
+                ? text.find(';', p + 1) : std::string::npos;
+            if (semicolon == std::string::npos || semicolon - p > 10) {
+                result += text[p];
+                continue;
+            }
+            const std::string entity = text.substr(p + 1, semicolon - p - 1);
+            uint32_t codepoint = 0;
+            if (entity.size() > 1 && entity[0] == '#') {
+                const bool hex = entity[1] == 'x' || entity[1] == 'X';
+                char* end = nullptr;
+                const std::string digits = entity.substr(hex ? 2 : 1);
+                codepoint = static_cast<uint32_t>(
+                    std::strtoul(digits.c_str(), &end, hex ? 16 : 10));
+                if (digits.empty() || *end != '\0') codepoint = 0;
+            } else {
+                for (const auto& candidate : named) {
+                    if (entity == candidate.name) codepoint = candidate.codepoint;
+                }
+            }
+            if (codepoint == 0) {
+                result += text[p];
+                continue;
+            }
+            appendUtf8(result, codepoint);
+            p = semicolon;
+        }
+        return result;
+    }
+
+    // JSX text collapses like React: lines are trimmed, blank lines
+    // dropped and the rest joined with single spaces.
+    static std::string cleanText(const std::string& text) {
+        std::vector<std::string> lines;
+        size_t start = 0;
+        for (size_t p = 0; p <= text.size(); ++p) {
+            if (p == text.size() || text[p] == '\n') {
+                lines.push_back(text.substr(start, p - start));
+                start = p + 1;
+            }
+        }
+        size_t lastNonEmpty = npos;
+        for (size_t i = 0; i < lines.size(); ++i) {
+            for (char& c : lines[i]) {
+                if (c == '\t' || c == '\r') c = ' ';
+            }
+            if (lines[i].find_first_not_of(' ') != std::string::npos) {
+                lastNonEmpty = i;
+            }
+        }
+        std::string result;
+        for (size_t i = 0; i < lines.size(); ++i) {
+            std::string line = lines[i];
+            if (i != 0) line.erase(0, line.find_first_not_of(' '));
+            if (i + 1 != lines.size()) {
+                const size_t last = line.find_last_not_of(' ');
+                line.erase(last == std::string::npos ? 0 : last + 1);
+            }
+            if (line.empty()) continue;
+            if (i != lastNonEmpty) line += ' ';
+            result += line;
+        }
+        return result;
+    }
+
+    static bool blank(const std::string& code) {
+        return skipTrivia(code, 0, code.size()) == code.size();
+    }
+
+    std::string expression(size_t begin, size_t end) {
+        if (nesting_ > 0) return std::string();
+        containers_.emplace_back(begin, end);
+        if (!options_ || !options_->expression) return std::string();
+        return options_->expression(source_.substr(begin, end - begin));
+    }
+
+    bool parseElement(size_t start, size_t& end, std::string* output) {
+        const size_t length = source_.size();
+        if (start + 1 >= length || source_[start] != '<') return false;
+        size_t p = start + 1;
+        const bool fragment = source_[p] == '>';
+        std::string tag;
+        if (fragment) {
+            ++p;
+        } else {
+            const unsigned char first = static_cast<unsigned char>(source_[p]);
+            if (!(std::isalpha(first) != 0 || first == '_' || first == '$')) {
+                return false;
+            }
+            name(p, tag, true);
+        }
+
+        std::vector<std::string> properties;
+        std::string key;
+        bool selfClosing = false;
+        if (!fragment) {
+            for (;;) {
+                skipSpace(p);
+                if (p >= length) return false;
+                if (source_.compare(p, 2, "/>") == 0) {
+                    p += 2;
+                    selfClosing = true;
+                    break;
+                }
+                if (source_[p] == '>') {
+                    ++p;
+                    break;
+                }
+                if (source_[p] == '{') {
+                    const size_t close = containerEnd(p);
+                    if (close == npos) return false;
+                    size_t inner = p + 1;
+                    skipSpace(inner);
+                    if (source_.compare(inner, 3, "...") != 0) return false;
+                    properties.push_back("..." + expression(inner + 3, close));
+                    p = close + 1;
+                    continue;
+                }
+                std::string attribute;
+                if (!name(p, attribute, false)) return false;
+                skipSpace(p);
+                std::string value = "true";
+                if (p < length && source_[p] == '=') {
+                    ++p;
+                    skipSpace(p);
+                    if (p >= length) return false;
+                    if (source_[p] == '"' || source_[p] == '\'') {
+                        const char delimiter = source_[p];
+                        const size_t close = source_.find(delimiter, p + 1);
+                        if (close == std::string::npos) return false;
+                        value = quote(decodeEntities(
+                            source_.substr(p + 1, close - p - 1)));
+                        p = close + 1;
+                    } else if (source_[p] == '{') {
+                        const size_t close = containerEnd(p);
+                        if (close == npos) return false;
+                        value = expression(p + 1, close);
+                        p = close + 1;
+                    } else if (source_[p] == '<') {
+                        size_t elementEnd = p;
+                        std::string nested;
+                        if (!parseElement(p, elementEnd,
+                                          output ? &nested : nullptr)) {
+                            return false;
+                        }
+                        value = nested;
+                        p = elementEnd;
+                    } else {
+                        return false;
+                    }
+                }
+                if (options_ && options_->automatic && attribute == "key") {
+                    key = value;
+                    continue;
+                }
+                const bool plain =
+                    attribute.find_first_of("-:") == std::string::npos;
+                properties.push_back(
+                    (plain ? attribute : quote(attribute)) + ": " + value);
+            }
+        }
+
+        std::vector<std::string> children;
+        if (!selfClosing) {
+            bool closed = false;
+            while (p < length) {
+                if (source_.compare(p, 2, "</") == 0) {
+                    size_t q = p + 2;
+                    skipSpace(q);
+                    std::string closing;
+                    if (!fragment) name(q, closing, true);
+                    skipSpace(q);
+                    if (closing != tag || q >= length || source_[q] != '>') {
+                        return false;
+                    }
+                    p = q + 1;
+                    closed = true;
+                    break;
+                }
+                if (source_[p] == '<') {
+                    size_t childEnd = p;
+                    std::string child;
+                    if (!parseElement(p, childEnd,
+                                      output ? &child : nullptr)) {
+                        return false;
+                    }
+                    children.push_back(child);
+                    p = childEnd;
+                } else if (source_[p] == '{') {
+                    const size_t close = containerEnd(p);
+                    if (close == npos) return false;
+                    if (!blank(source_.substr(p + 1, close - p - 1))) {
+                        children.push_back(expression(p + 1, close));
+                    }
+                    p = close + 1;
+                } else {
+                    const size_t textStart = p;
+                    while (p < length && source_[p] != '<' && source_[p] != '{') {
+                        ++p;
+                    }
+                    if (output) {
+                        const std::string text = cleanText(
+                            source_.substr(textStart, p - textStart));
+                        if (!text.empty()) {
+                            children.push_back(quote(decodeEntities(text)));
+                        }
+                    }
+                }
+            }
+            if (!closed) return false;
+        }
+        end = p;
+        const bool intrinsic = !fragment &&
+            (std::islower(static_cast<unsigned char>(tag[0])) != 0 ||
+             tag.find_first_of("-:") != std::string::npos);
+        if (!fragment && !intrinsic && nesting_ == 0) {
+            const std::string root = tag.substr(0, tag.find('.'));
+            if (root != "this") components_.push_back(root);
+        }
+        if (!output) return true;
+
+        const std::string type = fragment ? options_->fragment
+            : intrinsic ? quote(tag) : tag;
+        const auto join = [](const std::vector<std::string>& items) {
+            std::string result;
+            for (size_t i = 0; i < items.size(); ++i) {
+                if (i) result += ", ";
+                result += items[i];
+            }
+            return result;
+        };
+        if (options_->automatic) {
+            if (children.size() == 1) {
+                properties.push_back("children: " + children.front());
+            } else if (children.size() > 1) {
+                properties.push_back("children: [" + join(children) + "]");
+            }
+            *output = (children.size() > 1 ? "_jsxs(" : "_jsx(") + type +
+                (properties.empty() ? ", {}" : ", { " + join(properties) + " }") +
+                (key.empty() ? "" : ", " + key) + ")";
+        } else {
+            *output = options_->factory + "(" + type + ", " +
+                (properties.empty() ? "null" : "{ " + join(properties) + " }");
+            for (const std::string& child : children) *output += ", " + child;
+            *output += ")";
+        }
+        return true;
+    }
+};
+
+} // namespace
+
+// ============================================================================
+// Token stream
+// ============================================================================
+
+// One lexer pass over the file, with token end offsets, line-break flags and
+// bracket partners precomputed so the rewriters can look ahead freely. JSX
+// elements are carved out as single opaque tokens: the lexer knows nothing
+// of JSX text, so after an element the file is re-lexed from its end
+// whenever the lexer's tokens and the element boundary disagree.
+class TokenStream {
+public:
+    TokenStream(const std::string& source, const std::string& filename)
+        : source(source) {
+        const auto endsWith = [&](const char* suffix) {
+            const size_t length = std::strlen(suffix);
+            return filename.size() >= length &&
+                filename.compare(filename.size() - length, length, suffix) == 0;
+        };
+        jsx = endsWith(".tsx") || endsWith(".jsx");
+
+        // A BOM and a `#!` line are not tokens; lex a copy with them blanked
+        // so offsets still line up with the original text.
+        size_t prefix = 0;
+        if (source.compare(0, 3, "\xEF\xBB\xBF") == 0) prefix = 3;
+        if (source.compare(prefix, 2, "#!") == 0) {
+            const size_t newline = source.find('\n', prefix);
+            prefix = newline == std::string::npos ? source.size() : newline;
+        }
+        if (prefix != 0) {
+            std::string blanked = source;
+            std::fill(blanked.begin(), blanked.begin() + prefix, ' ');
+            lexFrom(filename, blanked);
+        } else {
+            lexFrom(filename, source);
+        }
+        matchBrackets();
+    }
+
+    const std::string& source;
+    bool jsx = false;
+    std::vector<Tok> tokens;          // ends with an EndOfFile token
+    std::vector<uint32_t> partner;    // matching bracket, or noMatch
+    std::vector<uint8_t> controlHead; // ')' closing an if/for/while/... head
+
+    size_t eof() const { return tokens.size() - 1; }
+    const Tok& operator[](size_t i) const {
+        return tokens[std::min(i, tokens.size() - 1)];
+    }
+    TokenType type(size_t i) const { return (*this)[i].type; }
+    bool is(size_t i, TokenType t) const { return type(i) == t; }
+    bool isWord(size_t i, std::string_view word) const {
+        return type(i) == TokenType::Identifier && (*this)[i].value == word;
+    }
+    size_t match(size_t i) const {
+        return i < partner.size() && partner[i] != noMatch ? partner[i] : npos;
+    }
+    // Index just past the group opened at `i`, or `i + 1` if unbalanced.
+    size_t after(size_t i) const {
+        const size_t close = match(i);
+        return close == npos ? i + 1 : close + 1;
+    }
+
+    // True when the token at `i` can end an expression, so a following `<`
+    // is a comparison or type argument list, `!` is a non-null assertion
+    // and a line break may terminate the statement.
+    bool expressionEnd(size_t i) const {
+        const Tok& token = (*this)[i];
+        if (token.jsx) return true;
+        switch (token.type) {
+            case TokenType::Identifier:
+            case TokenType::KeywordThis:
+            case TokenType::KeywordSuper:
+            case TokenType::RightBracket:
+            case TokenType::RightBrace:
+            case TokenType::PlusPlus:
+            case TokenType::MinusMinus:
+            case TokenType::KeywordFrom:
+            case TokenType::KeywordOf:
+            case TokenType::KeywordAsync:
+            case TokenType::KeywordGet:
+            case TokenType::KeywordSet:
+            case TokenType::KeywordType:
+            case TokenType::KeywordNamespace:
+            case TokenType::KeywordDeclare:
+            case TokenType::KeywordAbstract:
+            case TokenType::KeywordReadonly:
+            case TokenType::KeywordStatic:
+            case TokenType::KeywordOverride:
+            case TokenType::KeywordPublic:
+            case TokenType::KeywordPrivate:
+            case TokenType::KeywordProtected:
+            case TokenType::KeywordUsing:
+                return true;
+            case TokenType::RightParen:
+                return !controlHead[i];
+            default:
+                return isLiteral(token.type);
+        }
+    }
+
+    // A token after a line break that cannot continue the expression before
+    // it, so automatic semicolon insertion ends the statement there.
+    bool startsStatement(size_t i) const {
+        const Tok& token = (*this)[i];
+        if (!token.newlineBefore || i == 0 || !expressionEnd(i - 1)) {
+            return false;
+        }
+        if (token.jsx) return true;
+        switch (token.type) {
+            case TokenType::KeywordIn:
+            case TokenType::KeywordInstanceof:
+                return false;
+            case TokenType::PlusPlus:
+            case TokenType::MinusMinus:
+            case TokenType::Exclamation:
+            case TokenType::Tilde:
+            case TokenType::LeftBrace:
+            case TokenType::At:
+            case TokenType::Hash:
+                return true;
+            default:
+                return identifierLike(token.type) || isLiteral(token.type);
+        }
+    }
+
+private:
+    std::vector<std::unique_ptr<Lexer>> lexers_;
+    std::vector<std::string> suffixes_;
+
+    void push(const Tok& token) {
+        // The lexer splits identifiers at non-ASCII bytes; glue them back.
+        if (!tokens.empty()) {
+            Tok& previous = tokens.back();
+            const auto wordy = [](const Tok& t) {
+                return t.type == TokenType::Identifier ||
+                    (t.type == TokenType::Invalid && !t.value.empty() &&
+                     static_cast<unsigned char>(t.value[0]) >= 0x80);
+            };
+            if (previous.end == token.begin && !previous.jsx && !token.jsx &&
+                wordy(token) && wordy(previous) &&
+                (previous.type == TokenType::Invalid ||
+                 token.type == TokenType::Invalid)) {
+                previous.type = TokenType::Identifier;
+                previous.end = token.end;
+                previous.value = std::string_view(
+                    source.data() + previous.begin, previous.end - previous.begin);
+                return;
+            }
+        }
+        tokens.push_back(token);
+    }
+
+    void lexFrom(const std::string& filename, const std::string& text) {
+        size_t base = 0;
+        for (;;) {
+            if (base != 0) {
+                suffixes_.push_back(text.substr(base));
+            }
+            lexers_.push_back(std::make_unique<Lexer>(
+                filename, base == 0 ? text : suffixes_.back()));
+            const std::vector<Token>& raw = lexers_.back()->getAllTokens();
+            size_t restart = npos;
+            for (size_t k = 0; k < raw.size(); ++k) {
+                const Token& token = raw[k];
+                const size_t begin = std::min(
+                    base + token.location.offset, source.size());
+                if (token.type == TokenType::EndOfFile) break;
+                const size_t end = tokenEnd(text, token.type, begin, token.value);
+                const uint32_t previousEnd = tokens.empty() ? 0 : tokens.back().end;
+                const bool newline = source.find('\n', previousEnd) < begin;
+
+                size_t elementEnd = begin;
+                if (jsx && token.type == TokenType::Less &&
+                    (tokens.empty() || !expressionEnd(tokens.size() - 1) ||
+                     tokens.back().type == TokenType::KeywordReturn) &&
+                    JSXParser(source).scan(begin, elementEnd)) {
+                    push(Tok{TokenType::Less,
+                             std::string_view(source.data() + begin,
+                                              elementEnd - begin),
+                             static_cast<uint32_t>(begin),
+                             static_cast<uint32_t>(elementEnd), newline, true});
+                    size_t next = k + 1;
+                    while (raw[next].type != TokenType::EndOfFile &&
+                           base + raw[next].location.offset < elementEnd) {
+                        ++next;
+                    }
+                    const size_t nextBegin = raw[next].type == TokenType::EndOfFile
+                        ? text.size() : base + raw[next].location.offset;
+                    if (skipTrivia(text, elementEnd, nextBegin) != nextBegin) {
+                        restart = elementEnd;
+                        break;
+                    }
+                    k = next - 1;
+                    continue;
+                }
+                push(Tok{token.type, token.value, static_cast<uint32_t>(begin),
+                         static_cast<uint32_t>(end), newline, false});
+            }
+            if (restart == npos) break;
+            base = restart;
+        }
+        const uint32_t length = static_cast<uint32_t>(source.size());
+        const uint32_t previousEnd = tokens.empty() ? 0 : tokens.back().end;
+        tokens.push_back(Tok{TokenType::EndOfFile, std::string_view(), length,
+                             length,
+                             source.find('\n', previousEnd) != std::string::npos,
+                             false});
+    }
+
+    void matchBrackets() {
+        partner.assign(tokens.size(), noMatch);
+        controlHead.assign(tokens.size(), 0);
+        std::vector<uint32_t> open;
+        for (uint32_t i = 0; i < tokens.size(); ++i) {
+            switch (tokens[i].type) {
+                case TokenType::LeftParen:
+                case TokenType::LeftBracket:
+                case TokenType::LeftBrace:
+                    open.push_back(i);
+                    break;
+                case TokenType::RightParen:
+                case TokenType::RightBracket:
+                case TokenType::RightBrace: {
+                    const TokenType expected =
+                        tokens[i].type == TokenType::RightParen
+                            ? TokenType::LeftParen
+                            : tokens[i].type == TokenType::RightBracket
+                                ? TokenType::LeftBracket
+                                : TokenType::LeftBrace;
+                    if (open.empty() || tokens[open.back()].type != expected) {
+                        break;
+                    }
+                    const uint32_t start = open.back();
+                    open.pop_back();
+                    partner[start] = i;
+                    partner[i] = start;
+                    if (expected == TokenType::LeftParen && start > 0) {
+                        size_t keyword = start - 1;
+                        if (tokens[keyword].type == TokenType::KeywordAwait &&
+                            keyword > 0) {
+                            --keyword;
+                        }
+                        switch (tokens[keyword].type) {
+                            case TokenType::KeywordIf:
+                            case TokenType::KeywordWhile:
+                            case TokenType::KeywordFor:
+                            case TokenType::KeywordSwitch:
+                            case TokenType::KeywordWith:
+                            case TokenType::KeywordCatch:
+                                controlHead[i] = 1;
+                                break;
+                            default:
+                                break;
+                        }
+                    }
+                    break;
+                }
+                default:
+                    break;
+            }
+        }
+    }
+};
+
+namespace {
+
+// ============================================================================
+// Type syntax
+// ============================================================================
+
+size_t skipType(const TokenStream& ts, size_t i);
+
+// Index past a `<...>` list starting at `i`, or npos when the tokens inside
+// cannot be a type parameter or argument list (so `<` is a comparison).
+size_t skipAngles(const TokenStream& ts, size_t i) {
+    if (!ts.is(i, TokenType::Less)) return npos;
+    int depth = 0;
+    for (size_t j = i; j < ts.eof(); ++j) {
+        const TokenType type = ts.type(j);
+        switch (type) {
+            case TokenType::Less: ++depth; break;
+            case TokenType::Greater: --depth; break;
+            case TokenType::GreaterGreater: depth -= 2; break;
+            case TokenType::GreaterGreaterGreater: depth -= 3; break;
+            case TokenType::LeftParen:
+            case TokenType::LeftBracket:
+            case TokenType::LeftBrace:
+                if (ts.match(j) == npos) return npos;
+                j = ts.match(j);
+                continue;
+            case TokenType::Comma:
+            case TokenType::Dot:
+            case TokenType::Pipe:
+            case TokenType::Ampersand:
+            case TokenType::Question:
+            case TokenType::Colon:
+            case TokenType::Equal:
+            case TokenType::Arrow:
+            case TokenType::Minus:
+            case TokenType::DotDotDot:
+                continue;
+            default:
+                if (identifierLike(type) || isLiteral(type)) continue;
+                return npos;
+        }
+        if (depth < 0) return npos;
+        if (depth == 0) return j + 1;
+    }
+    return npos;
+}
+
+size_t skipTypeOperand(const TokenStream& ts, size_t i) {
+    const size_t start = i;
+    for (;;) {
+        const TokenType type = ts.type(i);
+        if (type == TokenType::KeywordKeyof || type == TokenType::KeywordUnique ||
+            (type == TokenType::KeywordReadonly &&
+             !ts.is(i + 1, TokenType::Comma) && !ts.is(i + 1, TokenType::Greater))) {
+            ++i;
+        } else if (type == TokenType::KeywordInfer) {
+            i += 2;
+            return i;
+        } else if (type == TokenType::Minus &&
+                   ts.is(i + 1, TokenType::NumberLiteral)) {
+            ++i;
+        } else {
+            break;
+        }
+    }
+
+    const TokenType type = ts.type(i);
+    if (type == TokenType::KeywordNew ||
+        (type == TokenType::KeywordAbstract && ts.is(i + 1, TokenType::KeywordNew))) {
+        i += type == TokenType::KeywordNew ? 1 : 2;
+        if (ts.is(i, TokenType::Less)) {
+            const size_t next = skipAngles(ts, i);
+            if (next == npos) return start;
+            i = next;
+        }
+        if (!ts.is(i, TokenType::LeftParen)) return start;
+        i = ts.after(i);
+        if (!ts.is(i, TokenType::Arrow)) return start;
+        return skipType(ts, i + 1);
+    }
+    if (type == TokenType::KeywordAsserts &&
+        identifierLike(ts.type(i + 1)) && !ts[i + 1].newlineBefore) {
+        i += 2;
+        if (ts.is(i, TokenType::KeywordIs)) return skipType(ts, i + 1);
+        return i;
+    }
+    if (type == TokenType::KeywordTypeof) {
+        ++i;
+        if (ts.is(i, TokenType::KeywordImport)) {
+            i = ts.after(i + 1);
+        } else if (identifierLike(ts.type(i))) {
+            ++i;
+        } else {
+            return start;
+        }
+        while (ts.is(i, TokenType::Dot) && identifierLike(ts.type(i + 1))) i += 2;
+        if (ts.is(i, TokenType::Less) && !ts[i].newlineBefore) {
+            const size_t next = skipAngles(ts, i);
+            if (next != npos) i = next;
+        }
+    } else if (type == TokenType::LeftParen) {
+        const size_t close = ts.match(i);
+        if (close == npos) return start;
+        if (ts.is(close + 1, TokenType::Arrow)) return skipType(ts, close + 2);
+        i = close + 1;
+    } else if (type == TokenType::Less) {
+        const size_t next = skipAngles(ts, i);
+        if (next == npos || !ts.is(next, TokenType::LeftParen)) return start;
+        const size_t close = ts.after(next);
+        if (!ts.is(close, TokenType::Arrow)) return start;
+        return skipType(ts, close + 1);
+    } else if (type == TokenType::LeftBrace || type == TokenType::LeftBracket) {
+        if (ts.match(i) == npos) return start;
+        i = ts.match(i) + 1;
+    } else if (type == TokenType::KeywordImport && ts.is(i + 1, TokenType::LeftParen)) {
+        i = ts.after(i + 1);
+        while (ts.is(i, TokenType::Dot) && identifierLike(ts.type(i + 1))) i += 2;
+        if (ts.is(i, TokenType::Less)) {
+            const size_t next = skipAngles(ts, i);
+            if (next != npos) i = next;
+        }
+    } else if (isLiteral(type) && type != TokenType::RegexLiteral) {
+        ++i;
+    } else if (identifierLike(type)) {
+        ++i;
+        while (ts.is(i, TokenType::Dot) && identifierLike(ts.type(i + 1))) i += 2;
+        if (ts.is(i, TokenType::Less)) {
+            const size_t next = skipAngles(ts, i);
+            if (next != npos) i = next;
+        }
+        if (ts.is(i, TokenType::KeywordIs) && !ts[i].newlineBefore) {
+            return skipType(ts, i + 1);
+        }
+    } else {
+        return start;
+    }
+
+    while (ts.is(i, TokenType::LeftBracket) && !ts[i].newlineBefore &&
+           ts.match(i) != npos) {
+        i = ts.match(i) + 1;
+    }
+    return i;
+}
+
+size_t skipUnionType(const TokenStream& ts, size_t i) {
+    if (ts.is(i, TokenType::Pipe) || ts.is(i, TokenType::Ampersand)) ++i;
+    const size_t first = skipTypeOperand(ts, i);
+    if (first == i) return i;
+    i = first;
+    while (ts.is(i, TokenType::Pipe) || ts.is(i, TokenType::Ampersand)) {
+        const size_t next = skipTypeOperand(ts, i + 1);
+        if (next == i + 1) break;
+        i = next;
+    }
+    return i;
+}
+
+// Index past the type starting at `i` (i itself if there is none).
+size_t skipType(const TokenStream& ts, size_t i) {
+    const size_t start = i;
+    i = skipUnionType(ts, i);
+    if (i == start || !ts.is(i, TokenType::KeywordExtends)) return i;
+    // Conditional type: Check extends Extends ? True : False
+    const size_t extends = skipUnionType(ts, i + 1);
+    if (extends == i + 1 || !ts.is(extends, TokenType::Question)) return i;
+    const size_t whenTrue = skipType(ts, extends + 1);
+    if (!ts.is(whenTrue, TokenType::Colon)) return i;
+    return skipType(ts, whenTrue + 1);
+}
+
+// Index past a trailing `;`, if there is one at `i`.
+size_t finishStatement(const TokenStream& ts, size_t i) {
+    return ts.is(i, TokenType::Semicolon) ? i + 1 : i;
+}
+
+// `interface Name<T> extends A, B { ... }` starting at the keyword.
+size_t interfaceEnd(const TokenStream& ts, size_t i) {
+    for (size_t j = i + 1; j < ts.eof();) {
+        if (ts.is(j, TokenType::LeftBrace)) return ts.after(j);
+        if (ts.is(j, TokenType::Semicolon)) return j + 1;
+        if (ts.is(j, TokenType::Less)) {
+            const size_t next = skipAngles(ts, j);
+            j = next == npos ? j + 1 : next;
+        } else {
+            ++j;
+        }
+    }
+    return ts.eof();
+}
+
+// `type Name<T> = Type;` starting at the keyword.
+size_t typeAliasEnd(const TokenStream& ts, size_t i) {
+    size_t j = i + 2;
+    if (ts.is(j, TokenType::Less)) {
+        const size_t next = skipAngles(ts, j);
+        if (next != npos) j = next;
+    }
+    if (!ts.is(j, TokenType::Equal)) return finishStatement(ts, j);
+    return finishStatement(ts, skipType(ts, j + 1));
+}
+
+// A declaration after `declare` (or a body-less one after `export`):
+// class/enum/namespace/module/global blocks, function signatures and
+// variable lists.
+size_t ambientEnd(const TokenStream& ts, size_t i) {
+    size_t j = i;
+    if (ts.is(j, TokenType::KeywordExport)) ++j;
+    if (ts.is(j, TokenType::KeywordDefault)) ++j;
+    const TokenType type = ts.type(j);
+    if (type == TokenType::KeywordType) return typeAliasEnd(ts, j);
+    if (type == TokenType::KeywordFunction || type == TokenType::KeywordAsync) {
+        while (j < ts.eof() && !ts.is(j, TokenType::LeftParen)) {
+            if (ts.is(j, TokenType::Less)) {
+                const size_t next = skipAngles(ts, j);
+                j = next == npos ? j + 1 : next;
+            } else {
+                ++j;
+            }
+        }
+        j = ts.after(j);
+        if (ts.is(j, TokenType::Colon)) j = skipType(ts, j + 1);
+        return finishStatement(ts, j);
+    }
+    if (type == TokenType::KeywordConst && !ts.is(j + 1, TokenType::KeywordEnum)) {
+        // fall through to the variable list below
+    } else if (type == TokenType::KeywordLet || type == TokenType::KeywordVar ||
+               type == TokenType::KeywordConst) {
+        // variable list
+    } else {
+        // class, enum, const enum, namespace, module, global, interface
+        for (++j; j < ts.eof(); ++j) {
+            if (ts.is(j, TokenType::LeftBrace)) return ts.after(j);
+            if (ts.is(j, TokenType::Semicolon)) return j + 1;
+            if (ts[j].newlineBefore && ts.startsStatement(j)) return j;
+            if (ts.is(j, TokenType::Less)) {
+                const size_t next = skipAngles(ts, j);
+                if (next != npos) j = next - 1;
+            }
+        }
+        return ts.eof();
+    }
+    for (++j; j < ts.eof();) {
+        if (ts.is(j, TokenType::LeftBrace) || ts.is(j, TokenType::LeftBracket)) {
+            j = ts.after(j);
+        } else if (identifierLike(ts.type(j))) {
+            ++j;
+        }
+        if (ts.is(j, TokenType::Colon)) j = skipType(ts, j + 1);
+        if (ts.is(j, TokenType::Equal)) {
+            j += 1;
+            while (j < ts.eof() && !ts.is(j, TokenType::Comma) &&
+                   !ts.is(j, TokenType::Semicolon) && !ts.startsStatement(j)) {
+                j = ts.is(j, TokenType::LeftParen) || ts.is(j, TokenType::LeftBracket) ||
+                        ts.is(j, TokenType::LeftBrace)
+                    ? ts.after(j) : j + 1;
+            }
+        }
+        if (!ts.is(j, TokenType::Comma)) break;
+        ++j;
+    }
+    return finishStatement(ts, j);
+}
+
+// Whitespace from the start of the line containing `offset` up to the
+// first non-blank character, used to indent inserted statements.
+std::string lineIndent(const std::string& source, size_t offset) {
+    size_t start = offset;
+    while (start > 0 && source[start - 1] != '\n') --start;
+    size_t stop = start;
+    while (stop < source.size() && (source[stop] == ' ' || source[stop] == '\t')) {
+        ++stop;
+    }
+    return source.substr(start, stop - start);
+}
+
+// ============================================================================
+// Printer
+// ============================================================================
+
+// A replacement of source bytes [begin, end) with `text`; an insertion when
+// the range is empty, a removal when the text is.
+struct Edit {
+    uint32_t begin;
+    uint32_t end;
+    uint32_t sequence;
+    std::string text;
+};
+
+constexpr char kBase64[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+void appendVLQ(std::string& out, int64_t value) {
+    uint64_t vlq = value < 0 ? ((static_cast<uint64_t>(-value)) << 1) | 1
+                             : static_cast<uint64_t>(value) << 1;
+    do {
+        uint64_t digit = vlq & 31;
+        vlq >>= 5;
+        if (vlq != 0) digit |= 32;
+        out += kBase64[digit];
+    } while (vlq != 0);
+}
+
+// Copies the source between edits token by token, applying the edits and
+// normalizing the whitespace they leave behind: a removed statement takes
+// its line with it, runs of blank lines collapse to one, and in minify mode
+// whitespace shrinks to whatever keeps adjacent tokens apart. Source map
+// segments are recorded for every copied token and inserted text.
+class Printer {
+public:
+    Printer(const TokenStream& ts, const EmitOptions& options, bool map,
+            bool fragment)
+        : ts_(ts), source_(ts.source), options_(options), map_(map),
+          fragment_(fragment) {
+        crlf_ = source_.find("\r\n") != std::string::npos;
+    }
+
+    std::string print(std::vector<Edit>& edits, std::string* mappings) {
+        std::sort(edits.begin(), edits.end(), [](const Edit& a, const Edit& b) {
+            if (a.begin != b.begin) return a.begin < b.begin;
+            const bool aInsert = a.begin == a.end;
+            const bool bInsert = b.begin == b.end;
+            if (aInsert != bInsert) return aInsert;
+            if (a.end != b.end) return a.end > b.end;
+            return a.sequence < b.sequence;
+        });
+        out_.reserve(source_.size() + source_.size() / 8);
+        size_t position = 0;
+        for (const Edit& edit : edits) {
+            if (edit.begin < position) continue;
+            copy(position, edit.begin);
+            if (!edit.text.empty()) {
+                write(edit.text, edit.begin);
+            } else if (edit.end > edit.begin) {
+                erased();
+            }
+            position = std::max<size_t>(position, edit.end);
+        }
+        copy(position, source_.size());
+        if (fragment_) {
+            if (!options_.minify) out_ += pending_;
+        } else if (pendingNewlines_ > 0 && !out_.empty()) {
+            out_ += crlf_ ? "\r\n" : "\n";
+        }
+        if (mappings) *mappings = std::move(mappings_);
+        return std::move(out_);
+    }
+
+private:
+    const TokenStream& ts_;
+    const std::string& source_;
+    const EmitOptions& options_;
+    bool map_;
+    bool fragment_;
+    bool crlf_ = false;
+
+    std::string out_;
+    size_t token_ = 0;
+
+    std::string pending_;        // whitespace not yet written
+    int pendingNewlines_ = 0;
+    int erasedLines_ = 0;
+    bool erasing_ = false;       // a removal started at the beginning of a line
+    bool erasedInline_ = false;  // a removal inside a line
+
+    // Source map state.
+    std::string mappings_;
+    size_t scanned_ = 0;         // output bytes already counted
+    int64_t generatedColumn_ = 0;
+    int64_t previousColumn_ = 0;
+    int64_t previousLine_ = 0;
+    int64_t previousSourceColumn_ = 0;
+    bool firstOnLine_ = true;
+    size_t sourceCursor_ = 0;    // offset/line/column of the last lookup
+    int64_t sourceLine_ = 0;
+    int64_t sourceColumn_ = 0;
+
+    static bool identifierChar(char c) {
+        return isIdentifierChar(static_cast<unsigned char>(c));
+    }
+
+    static int utf16Units(unsigned char c) {
+        if ((c & 0xC0) == 0x80) return 0;
+        return c >= 0xF0 ? 2 : 1;
+    }
+
+    void copy(size_t from, size_t to) {
+        while (token_ < ts_.eof() && ts_[token_].end <= from) ++token_;
+        size_t p = from;
+        while (p < to) {
+            const Tok& token = ts_[token_];
+            if (p < token.begin) {
+                const size_t stop = std::min<size_t>(to, token.begin);
+                gap(p, stop);
+                p = stop;
+                continue;
+            }
+            const size_t stop = std::min<size_t>(to, token.end);
+            code(p, stop, p == token.begin);
+            p = stop;
+            if (p >= token.end && token_ < ts_.eof()) ++token_;
+        }
+    }
+
+    // Whitespace, comments and (for a BOM or `#!` line) raw text between
+    // tokens.
+    void gap(size_t p, size_t stop) {
+        while (p < stop) {
+            const char c = source_[p];
+            size_t end = p + 1;
+            if (isSpace(c)) {
+                while (end < stop && isSpace(source_[end])) ++end;
+                whitespace(p, end);
+            } else if (c == '/' && end < stop &&
+                       (source_[end] == '/' || source_[end] == '*')) {
+                if (source_[end] == '/') {
+                    while (end < stop && source_[end] != '\n') ++end;
+                } else {
+                    const size_t close = source_.find("*/", p + 2);
+                    end = close == std::string::npos || close + 2 > stop
+                        ? stop : close + 2;
+                }
+                const bool keep = source_.compare(p, 3, "/*!") == 0 ||
+                    (!options_.removeComments && !options_.minify);
+                if (keep) {
+                    code(p, end, false);
+                } else {
+                    erased();
+                }
+            } else {
+                while (end < stop && !isSpace(source_[end]) &&
+                       !(source_[end] == '/' && end + 1 < stop &&
+                         (source_[end + 1] == '/' || source_[end + 1] == '*'))) {
+                    ++end;
+                }
+                code(p, end, false);
+            }
+            p = end;
+        }
+    }
+
+    void whitespace(size_t begin, size_t end) {
+        pending_.append(source_, begin, end - begin);
+        const int newlines = static_cast<int>(
+            std::count(source_.begin() + begin, source_.begin() + end, '\n'));
+        pendingNewlines_ += newlines;
+        if (erasing_ && newlines > 0) {
+            ++erasedLines_;
+            erasing_ = false;
+        }
+    }
+
+    void erased() {
+        erasing_ = pendingNewlines_ > 0 || out_.empty() || out_.back() == '\n';
+        erasedInline_ = !erasing_;
+    }
+
+    void flush(char next) {
+        erasing_ = false;
+        if (pending_.empty() && pendingNewlines_ == 0) {
+            erasedInline_ = false;
+            return;
+        }
+        if (options_.minify) {
+            if (!out_.empty()) {
+                const char previous = out_.back();
+                const bool newline = pendingNewlines_ > 0 &&
+                    std::strchr(";{,([=:?&|*%<>!~^+-/", previous) == nullptr &&
+                    std::strchr(".,;:)]}?=*%&|^<>", next) == nullptr;
+                if (newline) {
+                    out_ += '\n';
+                } else if ((identifierChar(previous) && identifierChar(next)) ||
+                           (previous == '+' && next == '+') ||
+                           (previous == '-' && next == '-') ||
+                           (previous == '/' && (next == '/' || next == '*'))) {
+                    out_ += ' ';
+                }
+            }
+        } else if (fragment_) {
+            out_ += pending_;
+        } else if (pendingNewlines_ == 0) {
+            // Spaces on both sides of something removed inside a line
+            // collapse to one.
+            if (erasedInline_ && !pending_.empty()) {
+                out_ += ' ';
+            } else {
+                out_ += pending_;
+            }
+        } else {
+            // Line breaks already at the end of the output (from inserted
+            // text) count toward the one-blank-line limit.
+            int written = 0;
+            for (size_t k = out_.size(); k > 0 && (out_[k - 1] == '\n' || out_[k - 1] == '\r');
+                 --k) {
+                if (out_[k - 1] == '\n') ++written;
+            }
+            int newlines = std::min(pendingNewlines_ - erasedLines_, 2 - std::min(written, 2));
+            if (out_.empty()) {
+                newlines = 0;
+            } else if (newlines < 1 && written == 0) {
+                newlines = 1;
+            }
+            for (int n = 0; n < newlines; ++n) out_ += crlf_ ? "\r\n" : "\n";
+            out_.append(pending_, pending_.rfind('\n') + 1, std::string::npos);
+        }
+        pending_.clear();
+        pendingNewlines_ = 0;
+        erasedLines_ = 0;
+        erasedInline_ = false;
+    }
+
+    void code(size_t begin, size_t end, bool mapped) {
+        flush(source_[begin]);
+        if (map_ && mapped) mapping(begin);
+        out_.append(source_, begin, end - begin);
+    }
+
+    void write(const std::string& text, size_t origin) {
+        flush(text[0]);
+        if (map_) {
+            // Leading line breaks belong to the previous line; the segment
+            // goes on the first character of the inserted code.
+            const size_t first = text.find_first_not_of("\r\n");
+            out_.append(text, 0, first == std::string::npos ? text.size() : first);
+            if (first == std::string::npos) return;
+            mapping(origin);
+            out_.append(text, first, std::string::npos);
+            return;
+        }
+        out_ += text;
+    }
+
+    void mapping(size_t offset) {
+        for (; scanned_ < out_.size(); ++scanned_) {
+            const unsigned char c = static_cast<unsigned char>(out_[scanned_]);
+            if (c == '\n') {
+                mappings_ += ';';
+                generatedColumn_ = 0;
+                previousColumn_ = 0;
+                firstOnLine_ = true;
+            } else if (c != '\r') {
+                generatedColumn_ += utf16Units(c);
+            }
+        }
+        if (offset < sourceCursor_) {
+            // Out-of-order lookup (a hoisted insertion): restart from the
+            // beginning of the line.
+            size_t start = offset;
+            while (start > 0 && source_[start - 1] != '\n') --start;
+            sourceLine_ = std::count(source_.begin(), source_.begin() + start, '\n');
+            sourceColumn_ = 0;
+            sourceCursor_ = start;
+        }
+        for (; sourceCursor_ < offset; ++sourceCursor_) {
+            const unsigned char c = static_cast<unsigned char>(source_[sourceCursor_]);
+            if (c == '\n') {
+                ++sourceLine_;
+                sourceColumn_ = 0;
+            } else if (c != '\r') {
+                sourceColumn_ += utf16Units(c);
+            }
+        }
+        if (!firstOnLine_) mappings_ += ',';
+        appendVLQ(mappings_, generatedColumn_ - previousColumn_);
+        appendVLQ(mappings_, 0);
+        appendVLQ(mappings_, sourceLine_ - previousLine_);
+        appendVLQ(mappings_, sourceColumn_ - previousSourceColumn_);
+        previousColumn_ = generatedColumn_;
+        previousLine_ = sourceLine_;
+        previousSourceColumn_ = sourceColumn_;
+        firstOnLine_ = false;
+    }
+};
+
+// ============================================================================
+// JavaScript emit
+// ============================================================================
+
+struct Binding {
+    std::string imported;  // or the local name, for export lists
+    std::string local;     // or the exported name, for export lists
+};
+
+struct ImportRecord {
+    size_t first = 0;                 // `import`
+    size_t last = 0;                  // one past the statement
+    size_t specifier = npos;          // module string token
+    std::string defaultName;
+    std::string namespaceName;
+    std::vector<Binding> named;
+    bool clause = false;              // has bindings (not `import "x"`)
+    bool droppedTypes = false;        // some specifiers were `type`-only
+
+    // `import X = require("m")` / `import X = A.B`
+    std::string equalsName;
+    size_t entity = npos;             // A.B tokens
+    size_t entityEnd = npos;
+    bool exported = false;
+    std::string target;               // export target for `export import`
+};
+
+struct ExportListRecord {
+    size_t first = 0;
+    size_t last = 0;
+    std::vector<Binding> names;       // local name, exported name
+    bool droppedTypes = false;
+};
+
+constexpr const char* kImportDefaultHelper =
+    "var __importDefault = (this && this.__importDefault) || function (mod) "
+    "{ return (mod && mod.__esModule) ? mod : { \"default\": mod }; };";
+constexpr const char* kExportStarHelper =
+    "var __exportStar = (this && this.__exportStar) || function (m, exports) "
+    "{ for (var p in m) if (p !== \"default\" && "
+    "!Object.prototype.hasOwnProperty.call(exports, p)) exports[p] = m[p]; };";
+
+// Walks the token stream as statements and expressions, recording the
+// edits that turn TypeScript into JavaScript: type syntax and TS-only
+// declarations are removed, enums and namespaces become IIFEs, parameter
+// properties become assignments, JSX becomes factory calls and module
+// syntax is rewritten for the target. Imports are kept or elided once the
+// whole file has been seen, based on which names were used as values.
+class JavaScriptEmitter {
+public:
+    JavaScriptEmitter(const TokenStream& ts, const EmitOptions& options)
+        : ts(ts), options_(options) {}
+
+    std::vector<Edit> edits;
+    std::unordered_set<std::string> used;
+    std::vector<std::string> imports;
+    bool usesJSXRuntime = false;
+
+    void emitModule() {
+        scopes_.push_back(Scope());
+        scopes_.back().target = options_.commonJS ? "exports" : "";
+        scopes_.back().module = true;
+        statementList(0, ts.eof(), true);
+        finishImports();
+        finishExportLists();
+        Scope& scope = scopes_.back();
+        if (!(options_.commonJS && module_)) return;
+
+        size_t first = 0;
+        while (ts.is(first, TokenType::StringLiteral) &&
+               (ts.is(first + 1, TokenType::Semicolon) ||
+                ts[first + 1].newlineBefore)) {
+            first = finishStatement(ts, first + 1);
+        }
+        std::string header;
+        if (!exportAssignment_) {
+            header += "Object.defineProperty(exports, \"__esModule\", "
+                      "{ value: true });" + newline("");
+        }
+        if (importDefaultHelper_) header += kImportDefaultHelper + newline("");
+        if (exportStarHelper_) header += kExportStarHelper + newline("");
+        for (const std::string& line : scope.hoisted) header += line + newline("");
+        if (!header.empty()) insert(ts[first].begin, header);
+        std::string trailing;
+        for (const std::string& line : scope.trailing) trailing += newline("") + line;
+        if (!trailing.empty()) insert(static_cast<uint32_t>(ts.source.size()), trailing);
+    }
+
+    void emitFragment() {
+        scopes_.push_back(Scope());
+        expressionList(0, ts.eof());
+    }
+
+private:
+    struct Scope {
+        std::string target;     // "exports", the namespace, or "" for ESM
+        bool module = false;
+        std::vector<std::string> hoisted;   // exports of hoisted functions
+        std::vector<std::string> trailing;  // export-list assignments
+        std::unordered_set<std::string> values;     // runtime declarations
+        std::unordered_set<std::string> functions;
+        std::unordered_set<std::string> types;      // type-only declarations
+    };
+
+    const TokenStream& ts;
+    const EmitOptions& options_;
+    uint32_t sequence_ = 0;
+    std::vector<Scope> scopes_;
+    std::vector<ImportRecord> imports_;
+    std::vector<ExportListRecord> exportLists_;
+    std::unordered_set<std::string> typeImports_;
+    bool module_ = false;
+    bool exportAssignment_ = false;
+    bool importDefaultHelper_ = false;
+    bool exportStarHelper_ = false;
+    int reexports_ = 0;
+
+    // ---- edits -------------------------------------------------------------
+
+    void replace(uint32_t begin, uint32_t end, std::string text) {
+        edits.push_back(Edit{begin, end, sequence_++, std::move(text)});
+    }
+    void insert(uint32_t at, std::string text) {
+        replace(at, at, std::move(text));
+    }
+    void replaceTokens(size_t first, size_t last, std::string text) {
+        replace(ts[first].begin, ts[last - 1].end, std::move(text));
+    }
+    void removeTokens(size_t first, size_t last) {
+        if (last > first) replaceTokens(first, last, std::string());
+    }
+    // The token at `i` and the whitespace after it.
+    void removeWord(size_t i) { replace(ts[i].begin, ts[i + 1].begin, std::string()); }
+    // Tokens [first, last) along with the whitespace before them, as for
+    // `: Type`, `as Type` or `!`.
+    void removeTrailing(size_t first, size_t last) {
+        if (last > first && first > 0) {
+            replace(ts[first - 1].end, ts[last - 1].end, std::string());
+        }
+    }
+
+    std::string raw(size_t i) const {
+        return ts.source.substr(ts[i].begin, ts[i].end - ts[i].begin);
+    }
+    std::string raw(size_t first, size_t last) const {
+        return ts.source.substr(ts[first].begin, ts[last - 1].end - ts[first].begin);
+    }
+    std::string word(size_t i) const { return std::string(ts[i].value); }
+    std::string indentOf(size_t i) const { return lineIndent(ts.source, ts[i].begin); }
+    std::string newline(const std::string& indent) const {
+        return options_.minify ? std::string() : "\n" + indent;
+    }
+    bool sameLine(size_t i) const { return !ts[i].newlineBefore; }
+
+    static std::string quote(const std::string& text) {
+        return JSXParser::quote(text);
+    }
+
+    // Every specifier the output still loads goes through one of these
+    // two, which is how `imports` sees exactly the runtime dependencies.
+    void request(const std::string& value) {
+        if (std::find(imports.begin(), imports.end(), value) == imports.end()) {
+            imports.push_back(value);
+        }
+    }
+    std::string specifier(size_t i) {
+        const std::string value(ts[i].value);
+        request(value);
+        return options_.rewriteSpecifier ? options_.rewriteSpecifier(value) : value;
+    }
+    void rewriteSpecifier(size_t i) {
+        const std::string value(ts[i].value);
+        request(value);
+        if (!options_.rewriteSpecifier) return;
+        const std::string rewritten = options_.rewriteSpecifier(value);
+        if (rewritten != value) {
+            const char delimiter = ts.source[ts[i].begin];
+            replaceTokens(i, i + 1, delimiter == '\'' ? "'" + rewritten + "'"
+                                                      : quote(rewritten));
+        }
+    }
+
+    Scope& scope() { return scopes_.back(); }
+
+    // ---- statements --------------------------------------------------------
+
+    void statementList(size_t i, size_t end, bool moduleLevel) {
+        while (i < end) {
+            const size_t next = statement(i, end, moduleLevel);
+            i = next > i ? next : i + 1;
+        }
+    }
+
+    size_t expressionStatement(size_t i, size_t end) {
+        size_t j = expression(i, end, false);
+        if (j == i) j = i + 1;
+        return finishStatement(ts, j);
+    }
+
+    size_t parenthesized(size_t i) {
+        if (!ts.is(i, TokenType::LeftParen) || ts.match(i) == npos) return i;
+        const size_t close = ts.match(i);
+        expressionList(i + 1, close);
+        return close + 1;
+    }
+
+    size_t statement(size_t i, size_t end, bool moduleLevel) {
+        const TokenType type = ts.type(i);
+        switch (type) {
+            case TokenType::Semicolon:
+                return i + 1;
+            case TokenType::LeftBrace: {
+                const size_t close = ts.match(i);
+                if (close == npos || close > end) return i + 1;
+                statementList(i + 1, close, false);
+                return close + 1;
+            }
+            case TokenType::At:
+                return statement(decorators(i, end), end, moduleLevel);
+            case TokenType::KeywordImport:
+                if (moduleLevel && !ts.is(i + 1, TokenType::LeftParen) &&
+                    !ts.is(i + 1, TokenType::Dot)) {
+                    return importDeclaration(i, i);
+                }
+                break;
+            case TokenType::KeywordExport:
+                if (moduleLevel) return exportDeclaration(i, end);
+                break;
+            case TokenType::KeywordInterface:
+                if (identifierLike(ts.type(i + 1)) && sameLine(i + 1)) {
+                    scope().types.insert(word(i + 1));
+                    const size_t stop = interfaceEnd(ts, i);
+                    removeTokens(i, stop);
+                    return stop;
+                }
+                break;
+            case TokenType::KeywordType:
+                if (identifierLike(ts.type(i + 1)) && sameLine(i + 1) &&
+                    (ts.is(i + 2, TokenType::Equal) || ts.is(i + 2, TokenType::Less))) {
+                    scope().types.insert(word(i + 1));
+                    const size_t stop = typeAliasEnd(ts, i);
+                    removeTokens(i, stop);
+                    return stop;
+                }
+                break;
+            case TokenType::KeywordDeclare:
+                if (identifierLike(ts.type(i + 1)) && sameLine(i + 1)) {
+                    const size_t stop = ambientEnd(ts, i + 1);
+                    removeTokens(i, stop);
+                    return stop;
+                }
+                break;
+            case TokenType::KeywordAbstract:
+                if (ts.is(i + 1, TokenType::KeywordClass)) {
+                    removeWord(i);
+                    return classStatement(i + 1, end, nullptr);
+                }
+                break;
+            case TokenType::KeywordEnum:
+                if (identifierLike(ts.type(i + 1))) return enumDeclaration(i, i, false);
+                break;
+            case TokenType::KeywordConst:
+                if (ts.is(i + 1, TokenType::KeywordEnum)) {
+                    return enumDeclaration(i, i + 1, false);
+                }
+                return variableStatement(i, end, nullptr);
+            case TokenType::KeywordNamespace:
+                if (identifierLike(ts.type(i + 1)) && sameLine(i + 1)) {
+                    return namespaceDeclaration(i, i, false);
+                }
+                break;
+            case TokenType::Identifier:
+                if (ts[i].value == "module" && ts.is(i + 1, TokenType::Identifier) &&
+                    sameLine(i + 1)) {
+                    return namespaceDeclaration(i, i, false);
+                }
+                if (ts.is(i + 1, TokenType::Colon)) {
+                    return statement(i + 2, end, false);  // label
+                }
+                break;
+            case TokenType::KeywordLet:
+                if (identifierLike(ts.type(i + 1)) || ts.is(i + 1, TokenType::LeftBrace) ||
+                    ts.is(i + 1, TokenType::LeftBracket)) {
+                    return variableStatement(i, end, nullptr);
+                }
+                break;
+            case TokenType::KeywordVar:
+                return variableStatement(i, end, nullptr);
+            case TokenType::KeywordUsing:
+                if (identifierLike(ts.type(i + 1)) && sameLine(i + 1)) {
+                    return variableStatement(i, end, nullptr);
+                }
+                break;
+            case TokenType::KeywordAsync:
+                if (ts.is(i + 1, TokenType::KeywordFunction) && sameLine(i + 1)) {
+                    return functionStatement(i, i, nullptr);
+                }
+                break;
+            case TokenType::KeywordFunction:
+                return functionStatement(i, i, nullptr);
+            case TokenType::KeywordClass:
+                return classStatement(i, end, nullptr);
+            case TokenType::KeywordIf: {
+                size_t j = statement(parenthesized(i + 1), end, false);
+                if (ts.is(j, TokenType::KeywordElse)) j = statement(j + 1, end, false);
+                return j;
+            }
+            case TokenType::KeywordWhile:
+            case TokenType::KeywordWith:
+            case TokenType::KeywordSwitch:
+                return statement(parenthesized(i + 1), end, false);
+            case TokenType::KeywordFor:
+                return forStatement(i, end);
+            case TokenType::KeywordDo: {
+                size_t j = statement(i + 1, end, false);
+                if (ts.is(j, TokenType::KeywordWhile)) j = parenthesized(j + 1);
+                return finishStatement(ts, j);
+            }
+            case TokenType::KeywordTry: {
+                size_t j = statement(i + 1, end, false);
+                if (ts.is(j, TokenType::KeywordCatch)) {
+                    ++j;
+                    if (ts.is(j, TokenType::LeftParen) && ts.match(j) != npos) {
+                        params(j, ts.match(j), nullptr);
+                        j = ts.match(j) + 1;
+                    }
+                    j = statement(j, end, false);
+                }
+                if (ts.is(j, TokenType::KeywordFinally)) j = statement(j + 1, end, false);
+                return j;
+            }
+            case TokenType::KeywordReturn:
+            case TokenType::KeywordThrow: {
+                size_t j = i + 1;
+                if (j < end && sameLine(j) && !ts.is(j, TokenType::Semicolon) &&
+                    !ts.is(j, TokenType::RightBrace)) {
+                    j = expression(j, end, false);
+                }
+                return finishStatement(ts, j);
+            }
+            case TokenType::KeywordBreak:
+            case TokenType::KeywordContinue: {
+                size_t j = i + 1;
+                if (identifierLike(ts.type(j)) && sameLine(j)) ++j;
+                return finishStatement(ts, j);
+            }
+            case TokenType::KeywordCase: {
+                size_t j = expression(i + 1, end, false);
+                return ts.is(j, TokenType::Colon) ? j + 1 : std::max(j, i + 1);
+            }
+            case TokenType::KeywordDefault:
+                if (ts.is(i + 1, TokenType::Colon)) return i + 2;
+                break;
+            case TokenType::KeywordDebugger:
+                return finishStatement(ts, i + 1);
+            default:
+                break;
+        }
+        return expressionStatement(i, end);
+    }
+
+    size_t forStatement(size_t i, size_t end) {
+        size_t open = i + 1;
+        if (ts.is(open, TokenType::KeywordAwait)) ++open;
+        const size_t close = ts.match(open);
+        if (!ts.is(open, TokenType::LeftParen) || close == npos) return open;
+        size_t j = open + 1;
+        const TokenType type = ts.type(j);
+        if ((type == TokenType::KeywordLet || type == TokenType::KeywordConst ||
+             type == TokenType::KeywordVar || type == TokenType::KeywordUsing) &&
+            !ts.is(j + 1, TokenType::KeywordIn) && !ts.is(j + 1, TokenType::KeywordOf)) {
+            j = declaration(j, close, nullptr);
+        }
+        while (j < close) {
+            const size_t next = expression(j, close, false);
+            j = next > j ? next : j + 1;
+        }
+        return statement(close + 1, end, false);
+    }
+
+    size_t variableStatement(size_t i, size_t end, std::vector<std::string>* names) {
+        return finishStatement(ts, declaration(i, end, names));
+    }
+
+    // `let/const/var/using` bindings with their types removed; returns the
+    // index after the last declarator.
+    size_t declaration(size_t i, size_t end, std::vector<std::string>* names) {
+        size_t j = i;
+        if (options_.downlevelES5 &&
+            (ts.is(j, TokenType::KeywordLet) || ts.is(j, TokenType::KeywordConst))) {
+            replaceTokens(j, j + 1, "var");
+        }
+        ++j;
+        for (;;) {
+            if (ts.is(j, TokenType::LeftBrace) || ts.is(j, TokenType::LeftBracket)) {
+                const size_t close = ts.match(j);
+                if (close == npos) return j + 1;
+                bindingPattern(j, close, names);
+                j = close + 1;
+            } else if (identifierLike(ts.type(j))) {
+                if (names) names->push_back(word(j));
+                ++j;
+            } else {
+                return j;
+            }
+            if (ts.is(j, TokenType::Exclamation)) {
+                removeTrailing(j, j + 1);
+                ++j;
+            }
+            if (ts.is(j, TokenType::Colon)) {
+                const size_t stop = skipType(ts, j + 1);
+                removeTrailing(j, stop);
+                j = stop;
+            }
+            if (ts.is(j, TokenType::Equal)) j = expression(j + 1, end, true);
+            if (!ts.is(j, TokenType::Comma)) return j;
+            ++j;
+        }
+    }
+
+    // Object or array destructuring between `open` and its partner: bound
+    // names are collected, defaults and computed keys walked.
+    void bindingPattern(size_t open, size_t close, std::vector<std::string>* names) {
+        const bool object = ts.is(open, TokenType::LeftBrace);
+        size_t j = open + 1;
+        while (j < close) {
+            const size_t start = j;
+            if (ts.is(j, TokenType::Comma)) {
+                ++j;
+                continue;
+            }
+            if (ts.is(j, TokenType::DotDotDot)) ++j;
+            bool value = !object;
+            if (object) {
+                if (ts.is(j, TokenType::LeftBracket) && ts.match(j) != npos) {
+                    expressionList(j + 1, ts.match(j));
+                    j = ts.match(j) + 1;
+                } else if (ts.is(j + 1, TokenType::Colon)) {
+                    ++j;
+                } else if (identifierLike(ts.type(j))) {
+                    if (names) names->push_back(word(j));
+                    ++j;
+                }
+                if (ts.is(j, TokenType::Colon)) {
+                    ++j;
+                    value = true;
+                }
+            }
+            if (value) {
+                if (ts.is(j, TokenType::LeftBrace) || ts.is(j, TokenType::LeftBracket)) {
+                    if (ts.match(j) != npos) {
+                        bindingPattern(j, ts.match(j), names);
+                        j = ts.match(j) + 1;
+                    } else {
+                        ++j;
+                    }
+                } else if (identifierLike(ts.type(j))) {
+                    if (names) names->push_back(word(j));
+                    ++j;
+                }
+            }
+            if (ts.is(j, TokenType::Equal)) j = expression(j + 1, close, true);
+            while (j < close && !ts.is(j, TokenType::Comma)) {
+                const size_t next = expression(j, close, true);
+                j = next > j ? next : j + 1;
+            }
+            if (j == start) ++j;
+        }
+    }
+
+    // Parameter list between `open` and `close`: types, `?`, `this`
+    // parameters and accessibility modifiers are removed. Names declared as
+    // parameter properties are appended to `properties`.
+    void params(size_t open, size_t close, std::vector<std::string>* properties) {
+        size_t j = open + 1;
+        while (j < close) {
+            const size_t start = j;
+            while (ts.is(j, TokenType::At)) j = decorators(j, close);
+            if (ts.is(j, TokenType::KeywordThis) && ts.is(j + 1, TokenType::Colon)) {
+                size_t stop = skipType(ts, j + 2);
+                if (ts.is(stop, TokenType::Comma)) {
+                    replace(ts[j].begin, ts[stop + 1].begin, std::string());
+                    j = stop + 1;
+                } else {
+                    removeTokens(j, stop);
+                    j = stop;
+                }
+                continue;
+            }
+            bool property = false;
+            for (;;) {
+                const TokenType type = ts.type(j);
+                const bool modifier = type == TokenType::KeywordPublic ||
+                    type == TokenType::KeywordPrivate ||
+                    type == TokenType::KeywordProtected ||
+                    type == TokenType::KeywordReadonly ||
+                    type == TokenType::KeywordOverride;
+                if (!modifier || !(identifierLike(ts.type(j + 1)) ||
+                                   ts.is(j + 1, TokenType::LeftBrace) ||
+                                   ts.is(j + 1, TokenType::LeftBracket))) {
+                    break;
+                }
+                removeWord(j);
+                property = true;
+                ++j;
+            }
+            if (ts.is(j, TokenType::DotDotDot)) ++j;
+            if (ts.is(j, TokenType::LeftBrace) || ts.is(j, TokenType::LeftBracket)) {
+                if (ts.match(j) == npos) return;
+                bindingPattern(j, ts.match(j), nullptr);
+                j = ts.match(j) + 1;
+            } else if (identifierLike(ts.type(j))) {
+                if (property && properties) properties->push_back(word(j));
+                ++j;
+            }
+            if (ts.is(j, TokenType::Question)) {
+                removeTrailing(j, j + 1);
+                ++j;
+            }
+            if (ts.is(j, TokenType::Colon)) {
+                const size_t stop = skipType(ts, j + 1);
+                removeTrailing(j, stop);
+                j = stop;
+            }
+            if (ts.is(j, TokenType::Equal)) j = expression(j + 1, close, true);
+            while (j < close && !ts.is(j, TokenType::Comma)) {
+                const size_t next = expression(j, close, true);
+                j = next > j ? next : j + 1;
+            }
+            if (ts.is(j, TokenType::Comma)) ++j;
+            if (j == start) ++j;
+        }
+    }
+
+    // `@expr` decorators, kept as written; returns the index after them.
+    size_t decorators(size_t i, size_t end) {
+        while (ts.is(i, TokenType::At) && i < end) {
+            size_t j = i + 1;
+            if (ts.is(j, TokenType::LeftParen)) {
+                i = parenthesized(j);
+                continue;
+            }
+            if (identifierLike(ts.type(j))) used.insert(word(j));
+            ++j;
+            while (ts.is(j, TokenType::Dot) && identifierLike(ts.type(j + 1))) j += 2;
+            if (ts.is(j, TokenType::Less)) {
+                const size_t stop = skipAngles(ts, j);
+                if (stop != npos && ts.is(stop, TokenType::LeftParen)) {
+                    removeTokens(j, stop);
+                    j = stop;
+                }
+            }
+            if (ts.is(j, TokenType::LeftParen)) j = parenthesized(j);
+            i = j;
+        }
+        return i;
+    }
+
+    // ---- functions and classes ---------------------------------------------
+
+    // `(params) [: Type] { body }` with optional leading `<T>`, starting at
+    // `(` or `<`. Returns the index past the body, or npos for a signature
+    // without one (overloads, abstract members), with `signatureEnd` set.
+    size_t callable(size_t j, std::vector<std::string>* properties,
+                    size_t* signatureEnd, size_t* bodyOpen) {
+        size_t typeParameters = npos;
+        if (ts.is(j, TokenType::Less)) {
+            const size_t stop = skipAngles(ts, j);
+            if (stop == npos) return j + 1;
+            typeParameters = j;
+            j = stop;
+        }
+        const size_t close = ts.match(j);
+        if (!ts.is(j, TokenType::LeftParen) || close == npos) {
+            if (signatureEnd) *signatureEnd = j;
+            return npos;
+        }
+        size_t body = close + 1;
+        const bool returnType = ts.is(body, TokenType::Colon);
+        if (returnType) body = skipType(ts, body + 1);
+        if (!ts.is(body, TokenType::LeftBrace) || ts.match(body) == npos) {
+            if (signatureEnd) *signatureEnd = body;
+            return npos;
+        }
+        if (typeParameters != npos) removeTokens(typeParameters, j);
+        params(j, close, properties);
+        if (returnType) removeTrailing(close + 1, body);
+        if (bodyOpen) *bodyOpen = body;
+        statementList(body + 1, ts.match(body), false);
+        return ts.match(body) + 1;
+    }
+
+    // `[async] function [*] [name] ...` starting at `i`.
+    size_t function(size_t i, std::string* name, size_t* signatureEnd) {
+        size_t j = i;
+        if (ts.is(j, TokenType::KeywordAsync)) ++j;
+        ++j;
+        if (ts.is(j, TokenType::Star)) ++j;
+        if (identifierLike(ts.type(j))) {
+            if (name) *name = word(j);
+            ++j;
+        }
+        return callable(j, nullptr, signatureEnd, nullptr);
+    }
+
+    size_t functionStatement(size_t start, size_t i, std::string* declared) {
+        std::string name;
+        size_t signatureEnd = i + 1;
+        const size_t stop = function(i, &name, &signatureEnd);
+        if (stop == npos) {
+            // Overload signature or body-less declaration.
+            const size_t last = finishStatement(ts, signatureEnd);
+            removeTokens(start, last);
+            if (declared) declared->clear();
+            return last;
+        }
+        if (!name.empty()) {
+            scope().values.insert(name);
+            scope().functions.insert(name);
+        }
+        if (declared) *declared = name;
+        return stop;
+    }
+
+    size_t classStatement(size_t i, size_t end, std::string* declared) {
+        std::string name;
+        const size_t stop = classDeclaration(i, end, &name);
+        if (!name.empty()) scope().values.insert(name);
+        if (declared) *declared = name;
+        return stop;
+    }
+
+    size_t classDeclaration(size_t i, size_t end, std::string* name) {
+        size_t j = i + 1;
+        if (identifierLike(ts.type(j)) && !ts.is(j, TokenType::KeywordExtends) &&
+            !ts.is(j, TokenType::KeywordImplements)) {
+            if (name) *name = word(j);
+            ++j;
+        }
+        if (ts.is(j, TokenType::Less)) {
+            const size_t stop = skipAngles(ts, j);
+            if (stop != npos) {
+                removeTokens(j, stop);
+                j = stop;
+            }
+        }
+        bool derived = false;
+        if (ts.is(j, TokenType::KeywordExtends)) {
+            derived = true;
+            ++j;
+            while (j < end && !ts.is(j, TokenType::LeftBrace) &&
+                   !ts.is(j, TokenType::KeywordImplements)) {
+                if (ts.is(j, TokenType::Less) && ts.expressionEnd(j - 1)) {
+                    const size_t stop = skipAngles(ts, j);
+                    if (stop != npos) {
+                        removeTokens(j, stop);
+                        j = stop;
+                        continue;
+                    }
+                }
+                if (ts.is(j, TokenType::LeftParen)) {
+                    j = parenthesized(j);
+                    continue;
+                }
+                if (identifierLike(ts.type(j)) && !ts.is(j - 1, TokenType::Dot)) {
+                    used.insert(word(j));
+                }
+                ++j;
+            }
+        }
+        if (ts.is(j, TokenType::KeywordImplements)) {
+            size_t k = j;
+            while (k < end && !ts.is(k, TokenType::LeftBrace)) {
+                const size_t stop = ts.is(k, TokenType::Less) ? skipAngles(ts, k) : npos;
+                k = stop == npos ? k + 1 : stop;
+            }
+            removeTrailing(j, k);
+            j = k;
+        }
+        if (!ts.is(j, TokenType::LeftBrace) || ts.match(j) == npos) return j;
+        classBody(j, derived);
+        return ts.match(j) + 1;
+    }
+
+    void classBody(size_t open, bool derived) {
+        const size_t close = ts.match(open);
+        size_t j = open + 1;
+        while (j < close) {
+            if (ts.is(j, TokenType::Semicolon)) {
+                ++j;
+                continue;
+            }
+            const size_t start = j;
+            while (ts.is(j, TokenType::At)) j = decorators(j, close);
+            bool ambient = false;
+            bool staticBlock = false;
+            for (;;) {
+                const TokenType type = ts.type(j);
+                const TokenType next = ts.type(j + 1);
+                const bool followed = identifierLike(next) ||
+                    next == TokenType::StringLiteral ||
+                    next == TokenType::NumberLiteral ||
+                    next == TokenType::LeftBracket || next == TokenType::Hash ||
+                    next == TokenType::Star;
+                if ((type == TokenType::KeywordPublic || type == TokenType::KeywordPrivate ||
+                     type == TokenType::KeywordProtected ||
+                     type == TokenType::KeywordReadonly ||
+                     type == TokenType::KeywordOverride) && followed) {
+                    removeWord(j);
+                    ++j;
+                } else if ((type == TokenType::KeywordDeclare ||
+                            type == TokenType::KeywordAbstract) && followed) {
+                    ambient = true;
+                    ++j;
+                } else if (type == TokenType::KeywordStatic &&
+                           next == TokenType::LeftBrace) {
+                    staticBlock = true;
+                    break;
+                } else if ((type == TokenType::KeywordStatic ||
+                            type == TokenType::KeywordGet ||
+                            type == TokenType::KeywordSet ||
+                            (type == TokenType::Identifier && ts[j].value == "accessor") ||
+                            (type == TokenType::KeywordAsync && sameLine(j + 1))) &&
+                           followed) {
+                    ++j;
+                } else if (type == TokenType::Star) {
+                    ++j;
+                } else {
+                    break;
+                }
+            }
+            if (staticBlock) {
+                const size_t blockClose = ts.match(j + 1);
+                if (blockClose == npos) return;
+                statementList(j + 2, blockClose, false);
+                j = blockClose + 1;
+                continue;
+            }
+            // Index signature: [key: Type]: Type;
+            if (ts.is(j, TokenType::LeftBracket) && identifierLike(ts.type(j + 1)) &&
+                ts.is(j + 2, TokenType::Colon)) {
+                size_t stop = ts.after(j);
+                if (ts.is(stop, TokenType::Colon)) stop = skipType(ts, stop + 1);
+                stop = finishStatement(ts, stop);
+                removeTokens(start, stop);
+                j = stop;
+                continue;
+            }
+            const size_t nameToken = j;
+            if (ts.is(j, TokenType::LeftBracket) && ts.match(j) != npos) {
+                if (!ambient) expressionList(j + 1, ts.match(j));
+                j = ts.match(j) + 1;
+            } else if (ts.is(j, TokenType::Hash)) {
+                j += 2;
+            } else {
+                ++j;
+            }
+            const bool constructor = ts.is(nameToken, TokenType::Identifier) &&
+                ts[nameToken].value == "constructor";
+            if (ts.is(j, TokenType::Question) || ts.is(j, TokenType::Exclamation)) {
+                removeTrailing(j, j + 1);
+                ++j;
+            }
+            if (ts.is(j, TokenType::LeftParen) || ts.is(j, TokenType::Less)) {
+                if (ambient) {
+                    size_t stop = j;
+                    if (ts.is(stop, TokenType::Less)) {
+                        const size_t angles = skipAngles(ts, stop);
+                        stop = angles == npos ? stop + 1 : angles;
+                    }
+                    stop = ts.after(stop);
+                    if (ts.is(stop, TokenType::Colon)) stop = skipType(ts, stop + 1);
+                    stop = finishStatement(ts, stop);
+                    removeTokens(start, stop);
+                    j = stop;
+                    continue;
+                }
+                std::vector<std::string> properties;
+                size_t signatureEnd = j;
+                size_t bodyOpen = npos;
+                const size_t stop = callable(j, constructor ? &properties : nullptr,
+                                             &signatureEnd, &bodyOpen);
+                if (stop == npos) {
+                    const size_t last = finishStatement(ts, signatureEnd);
+                    removeTokens(start, last);
+                    j = last;
+                    continue;
+                }
+                if (!properties.empty()) {
+                    parameterProperties(bodyOpen, nameToken, derived, properties);
+                }
+                j = stop;
+                continue;
+            }
+            // Property declaration.
+            size_t stop = j;
+            if (ts.is(stop, TokenType::Colon)) stop = skipType(ts, stop + 1);
+            if (ambient) {
+                if (ts.is(stop, TokenType::Equal)) stop = skipExpression(stop + 1, close);
+                stop = finishStatement(ts, stop);
+                removeTokens(start, stop);
+                j = stop;
+                continue;
+            }
+            removeTrailing(j, stop);
+            if (ts.is(stop, TokenType::Equal)) stop = expression(stop + 1, close, false);
+            stop = finishStatement(ts, stop);
+            j = stop > start ? stop : start + 1;
+        }
+    }
+
+    // Index where an expression starting at `i` ends, without edits.
+    size_t skipExpression(size_t i, size_t end) const {
+        while (i < end && !ts.is(i, TokenType::Semicolon) &&
+               !ts.is(i, TokenType::RightBrace) && !ts.startsStatement(i)) {
+            i = ts.after(i);
+        }
+        return i;
+    }
+
+    // `this.x = x;` for each constructor parameter property, after the
+    // `super(...)` call in derived classes.
+    void parameterProperties(size_t bodyOpen, size_t nameToken, bool derived,
+                             const std::vector<std::string>& properties) {
+        const size_t bodyClose = ts.match(bodyOpen);
+        uint32_t at = ts[bodyOpen].end;
+        if (derived) {
+            for (size_t k = bodyOpen + 1; k < bodyClose; ++k) {
+                if (ts.is(k, TokenType::KeywordSuper) && ts.is(k + 1, TokenType::LeftParen) &&
+                    ts.match(k + 1) != npos) {
+                    const size_t call = ts.match(k + 1);
+                    at = ts.is(call + 1, TokenType::Semicolon) ? ts[call + 1].end
+                                                               : ts[call].end;
+                    break;
+                }
+            }
+        }
+        const std::string indent = bodyOpen + 1 < bodyClose &&
+                ts[bodyOpen + 1].newlineBefore
+            ? indentOf(bodyOpen + 1)
+            : indentOf(nameToken) + "    ";
+        std::string text;
+        for (const std::string& property : properties) {
+            text += (options_.minify && text.empty() ? "" : newline(indent)) +
+                "this." + property + " = " + property + ";";
+        }
+        insert(at, text);
+    }
+
+    // ---- expressions -------------------------------------------------------
+
+    void expressionList(size_t i, size_t end) {
+        while (i < end) {
+            const size_t next = expression(i, end, true);
+            i = next > i ? next : i + 1;
+        }
+    }
+
+    size_t expression(size_t i, size_t end, bool stopAtComma) {
+        const size_t start = i;
+        int conditional = 0;
+        while (i < end) {
+            switch (ts.type(i)) {
+                case TokenType::Semicolon:
+                case TokenType::RightParen:
+                case TokenType::RightBracket:
+                case TokenType::RightBrace:
+                case TokenType::EndOfFile:
+                case TokenType::KeywordElse:
+                case TokenType::KeywordCatch:
+                case TokenType::KeywordFinally:
+                    return i;
+                case TokenType::Comma:
+                    if (stopAtComma) return i;
+                    ++i;
+                    continue;
+                case TokenType::Colon:
+                    if (conditional == 0) return i;
+                    --conditional;
+                    ++i;
+                    continue;
+                default:
+                    break;
+            }
+            if (i != start && ts.startsStatement(i)) return i;
+            i = operand(i, end, start, conditional);
+        }
+        return i;
+    }
+
+    // Can the token at `i` follow `f<T>` so that `<T>` were type arguments?
+    bool followsTypeArguments(size_t i) const {
+        switch (ts.type(i)) {
+            case TokenType::LeftParen:
+            case TokenType::TemplateLiteral:
+            case TokenType::RightParen:
+            case TokenType::RightBracket:
+            case TokenType::RightBrace:
+            case TokenType::Semicolon:
+            case TokenType::Comma:
+            case TokenType::Dot:
+            case TokenType::QuestionDot:
+            case TokenType::Colon:
+            case TokenType::Equal:
+            case TokenType::EqualEqual:
+            case TokenType::EqualEqualEqual:
+            case TokenType::ExclamationEqual:
+            case TokenType::ExclamationEqualEqual:
+            case TokenType::AmpersandAmpersand:
+            case TokenType::PipePipe:
+            case TokenType::QuestionQuestion:
+            case TokenType::EndOfFile:
+                return true;
+            default:
+                return ts[i].newlineBefore;
+        }
+    }
+
+    size_t operand(size_t i, size_t end, size_t start, int& conditional) {
+        const Tok& token = ts[i];
+        if (token.jsx) {
+            jsx(i);
+            return i + 1;
+        }
+        switch (token.type) {
+            case TokenType::Question:
+                ++conditional;
+                return i + 1;
+            case TokenType::Dot:
+            case TokenType::QuestionDot:
+                return identifierLike(ts.type(i + 1)) ? i + 2 : i + 1;
+            case TokenType::LeftParen: {
+                const size_t close = ts.match(i);
+                if (close == npos) return i + 1;
+                if (ts.is(close + 1, TokenType::Arrow) && sameLine(close + 1)) {
+                    params(i, close, nullptr);
+                    return arrowBody(close + 1, end, i);
+                }
+                if (ts.is(close + 1, TokenType::Colon) && conditional == 0) {
+                    const size_t type = skipType(ts, close + 2);
+                    if (type > close + 2 && ts.is(type, TokenType::Arrow)) {
+                        params(i, close, nullptr);
+                        removeTrailing(close + 1, type);
+                        return arrowBody(type, end, i);
+                    }
+                }
+                expressionList(i + 1, close);
+                return close + 1;
+            }
+            case TokenType::LeftBracket: {
+                const size_t close = ts.match(i);
+                if (close == npos) return i + 1;
+                expressionList(i + 1, close);
+                return close + 1;
+            }
+            case TokenType::LeftBrace:
+                return objectLiteral(i);
+            case TokenType::TemplateLiteral:
+                templateLiteral(i);
+                return i + 1;
+            case TokenType::Arrow:
+                return arrowBody(i, end, npos);
+            case TokenType::Less: {
+                const size_t stop = skipAngles(ts, i);
+                if (i != start && ts.expressionEnd(i - 1)) {
+                    if (stop != npos && followsTypeArguments(stop)) {
+                        removeTokens(i, stop);
+                        return stop;
+                    }
+                    return i + 1;
+                }
+                // Generic arrow function or `<Type>value` assertion.
+                if (stop != npos) {
+                    removeTokens(i, stop);
+                    return stop;
+                }
+                return i + 1;
+            }
+            case TokenType::Exclamation:
+                if (i != start && ts.expressionEnd(i - 1) && sameLine(i)) {
+                    replaceTokens(i, i + 1, std::string());
+                }
+                return i + 1;
+            case TokenType::KeywordAs:
+            case TokenType::KeywordSatisfies:
+                if (i != start && ts.expressionEnd(i - 1) && sameLine(i)) {
+                    const size_t stop = ts.is(i + 1, TokenType::KeywordConst)
+                        ? i + 2 : skipType(ts, i + 1);
+                    if (stop > i + 1) {
+                        removeTrailing(i, stop);
+                        return stop;
+                    }
+                }
+                used.insert(word(i));
+                return i + 1;
+            case TokenType::KeywordFunction:
+                return functionExpression(i);
+            case TokenType::KeywordAsync:
+                if (ts.is(i + 1, TokenType::KeywordFunction) && sameLine(i + 1)) {
+                    return functionExpression(i);
+                }
+                break;
+            case TokenType::KeywordClass:
+                return classDeclaration(i, end, nullptr);
+            case TokenType::KeywordImport:
+                if (ts.is(i + 1, TokenType::LeftParen) &&
+                    ts.is(i + 2, TokenType::StringLiteral)) {
+                    rewriteSpecifier(i + 2);
+                }
+                return i + 1;
+            default:
+                break;
+        }
+        if (identifierLike(token.type)) {
+            if (i == 0 || (!ts.is(i - 1, TokenType::Dot) &&
+                           !ts.is(i - 1, TokenType::QuestionDot))) {
+                used.insert(std::string(token.value));
+            }
+            if (token.type == TokenType::Identifier && token.value == "require" &&
+                ts.is(i + 1, TokenType::LeftParen) &&
+                ts.is(i + 2, TokenType::StringLiteral) &&
+                ts.is(i + 3, TokenType::RightParen)) {
+                rewriteSpecifier(i + 2);
+            }
+            if (ts.is(i + 1, TokenType::Arrow) && sameLine(i + 1)) {
+                return arrowBody(i + 1, end, i);
+            }
+        }
+        return i + 1;
+    }
+
+    size_t functionExpression(size_t i) {
+        size_t signatureEnd = i + 1;
+        const size_t stop = function(i, nullptr, &signatureEnd);
+        return stop == npos ? signatureEnd : stop;
+    }
+
+    // Arrow body after the `=>` at `arrow`; `parameters` is the `(` or the
+    // lone parameter, for rewriting to a function expression below ES2015.
+    size_t arrowBody(size_t arrow, size_t end, size_t parameters) {
+        const bool downlevel = options_.downlevelES5 && parameters != npos;
+        if (downlevel) {
+            if (ts.is(parameters, TokenType::LeftParen)) {
+                insert(ts[parameters].begin, "function ");
+            } else {
+                insert(ts[parameters].begin, "function (");
+                insert(ts[parameters].end, ")");
+            }
+        }
+        const size_t body = arrow + 1;
+        if (ts.is(body, TokenType::LeftBrace) && ts.match(body) != npos) {
+            if (downlevel) replace(ts[arrow - 1].end, ts[arrow].end, std::string());
+            statementList(body + 1, ts.match(body), false);
+            return ts.match(body) + 1;
+        }
+        size_t stop = expression(body, end, true);
+        if (stop == body) stop = std::min(body + 1, end);
+        if (downlevel) {
+            replace(ts[arrow - 1].end, ts[arrow].end, " { return");
+            insert(ts[stop - 1].end, "; }");
+        }
+        return stop;
+    }
+
+    size_t objectLiteral(size_t open) {
+        const size_t close = ts.match(open);
+        if (close == npos) return open + 1;
+        size_t j = open + 1;
+        while (j < close) {
+            if (ts.is(j, TokenType::Comma)) {
+                ++j;
+                continue;
+            }
+            const size_t start = j;
+            if (ts.is(j, TokenType::DotDotDot)) {
+                j = expression(j + 1, close, true);
+                if (j == start + 1) ++j;
+                continue;
+            }
+            for (;;) {
+                const TokenType type = ts.type(j);
+                const TokenType next = ts.type(j + 1);
+                const bool modifier = (type == TokenType::KeywordAsync ||
+                                       type == TokenType::KeywordGet ||
+                                       type == TokenType::KeywordSet) &&
+                    next != TokenType::Comma && next != TokenType::Colon &&
+                    next != TokenType::LeftParen && next != TokenType::RightBrace &&
+                    next != TokenType::Equal && next != TokenType::Less;
+                if (!modifier && type != TokenType::Star) break;
+                ++j;
+            }
+            const size_t key = j;
+            if (ts.is(j, TokenType::LeftBracket) && ts.match(j) != npos) {
+                expressionList(j + 1, ts.match(j));
+                j = ts.match(j) + 1;
+            } else {
+                ++j;
+            }
+            if (ts.is(j, TokenType::LeftParen) || ts.is(j, TokenType::Less)) {
+                size_t signatureEnd = j;
+                const size_t stop = callable(j, nullptr, &signatureEnd, nullptr);
+                j = stop == npos ? signatureEnd : stop;
+            } else if (ts.is(j, TokenType::Colon)) {
+                j = expression(j + 1, close, true);
+            } else {
+                if (identifierLike(ts.type(key))) used.insert(word(key));
+                if (ts.is(j, TokenType::Equal)) j = expression(j + 1, close, true);
+            }
+            while (j < close && !ts.is(j, TokenType::Comma)) {
+                const size_t next = expression(j, close, true);
+                j = next > j ? next : j + 1;
+            }
+            if (j == start) ++j;
+        }
+        return close + 1;
+    }
+
+    // Substitutions of a template literal, rewritten in place when they
+    // contain TypeScript; below ES2015 the template becomes a concatenation.
+    void templateLiteral(size_t i) {
+        const Tok& token = ts[i];
+        const std::string& source = ts.source;
+        const bool downlevel = options_.downlevelES5 &&
+            (i == 0 || !ts.expressionEnd(i - 1));
+        if (token.end - token.begin < 2) return;
+        const size_t last = token.end - 1;
+        std::vector<std::pair<size_t, size_t>> chunks;
+        std::vector<std::string> substitutions;
+        size_t chunk = token.begin + 1;
+        for (size_t p = chunk; p < last;) {
+            if (source[p] == '\\') {
+                p += 2;
+                continue;
+            }
+            if (source[p] == '$' && p + 1 < last && source[p + 1] == '{') {
+                JSXParser scanner(source);
+                const size_t close = scanner.containerEnd(p + 1);
+                if (close == npos || close >= last) return;
+                chunks.emplace_back(chunk, p);
+                const std::string code = source.substr(p + 2, close - p - 2);
+                std::string rewritten = fragment(code);
+                if (!downlevel && rewritten != code) {
+                    replace(static_cast<uint32_t>(p + 2), static_cast<uint32_t>(close),
+                            rewritten);
+                }
+                substitutions.push_back(std::move(rewritten));
+                p = close + 1;
+                chunk = p;
+                continue;
+            }
+            ++p;
+        }
+        if (!downlevel) return;
+        chunks.emplace_back(chunk, last);
+        std::string text;
+        for (size_t k = 0; k < chunks.size(); ++k) {
+            std::string literal = "\"";
+            for (size_t p = chunks[k].first; p < chunks[k].second; ++p) {
+                const char c = source[p];
+                if (c == '\\' && p + 1 < chunks[k].second) {
+                    const char escaped = source[p + 1];
+                    if (escaped == '`' || escaped == '$') {
+                        literal += escaped;
+                    } else {
+                        literal += c;
+                        literal += escaped;
+                    }
+                    ++p;
+                } else if (c == '"') {
+                    literal += "\\\"";
+                } else if (c == '\n') {
+                    literal += "\\n";
+                } else if (c != '\r') {
+                    literal += c;
+                }
+            }
+            literal += '"';
+            if (k == 0 || literal != "\"\"") {
+                if (k != 0) text += " + ";
+                text += literal;
+            }
+            if (k < substitutions.size()) {
+                text += " + (" + substitutions[k] + ")";
+            }
+        }
+        replaceTokens(i, i + 1, text);
+    }
+
+    static bool simpleReference(const std::string& code, std::string& root) {
+        size_t p = 0;
+        while (p < code.size() && isSpace(code[p])) ++p;
+        const size_t start = p;
+        while (p < code.size() &&
+               (isIdentifierChar(static_cast<unsigned char>(code[p])) || code[p] == '.')) {
+            ++p;
+        }
+        const size_t stop = p;
+        while (p < code.size() && isSpace(code[p])) ++p;
+        if (p != code.size() || stop == start ||
+            std::isdigit(static_cast<unsigned char>(code[start])) != 0 ||
+            code[start] == '.') {
+            return false;
+        }
+        root = code.substr(start, code.find('.', start) == std::string::npos ||
+                                      code.find('.', start) > stop
+                                  ? stop - start : code.find('.', start) - start);
+        return true;
+    }
+
+    // Rewrites a standalone expression (a template substitution or JSX
+    // container) with a nested emitter; used names flow back to this file.
+    std::string fragment(const std::string& code) {
+        std::string root;
+        if (simpleReference(code, root)) {
+            used.insert(root);
+            return code;
+        }
+        TokenStream stream(code, ts.jsx ? "fragment.tsx" : "fragment.ts");
+        JavaScriptEmitter nested(stream, options_);
+        nested.emitFragment();
+        used.insert(nested.used.begin(), nested.used.end());
+        usesJSXRuntime = usesJSXRuntime || nested.usesJSXRuntime;
+        for (const std::string& value : nested.imports) request(value);
+        if (nested.edits.empty()) return code;
+        Printer printer(stream, options_, false, true);
+        return printer.print(nested.edits, nullptr);
+    }
+
+    void jsx(size_t i) {
+        const Tok& token = ts[i];
+        JSXParser::Options jsxOptions;
+        jsxOptions.automatic = options_.jsxAutomatic;
+        jsxOptions.factory = options_.jsxFactory;
+        jsxOptions.fragment = options_.jsxAutomatic ? "_Fragment"
+                                                    : options_.jsxFragmentFactory;
+        jsxOptions.expression = [this](const std::string& code) {
+            return fragment(code);
+        };
+        size_t stop = token.begin;
+        if (options_.transformJSX) {
+            JSXParser parser(ts.source, &jsxOptions);
+            std::string output;
+            if (!parser.transform(token.begin, stop, output)) return;
+            replaceTokens(i, i + 1, output);
+            for (const std::string& component : parser.components()) {
+                used.insert(component);
+            }
+            if (options_.jsxAutomatic) {
+                usesJSXRuntime = true;
+            } else {
+                used.insert(options_.jsxFactory.substr(0, options_.jsxFactory.find('.')));
+            }
+            return;
+        }
+        JSXParser parser(ts.source);
+        if (!parser.scan(token.begin, stop)) return;
+        for (const std::string& component : parser.components()) used.insert(component);
+        for (const auto& [begin, close] : parser.containers()) {
+            const std::string code = ts.source.substr(begin, close - begin);
+            const std::string rewritten = fragment(code);
+            if (rewritten != code) {
+                replace(static_cast<uint32_t>(begin), static_cast<uint32_t>(close),
+                        rewritten);
+            }
+        }
+    }
+
+    // ---- modules -----------------------------------------------------------
+
+    static bool isIdentifierName(const std::string& name) {
+        if (name.empty() || std::isdigit(static_cast<unsigned char>(name[0])) != 0) {
+            return false;
+        }
+        return std::all_of(name.begin(), name.end(), [](char c) {
+            return isIdentifierChar(static_cast<unsigned char>(c));
+        });
+    }
+
+    static std::string member(const std::string& object, const std::string& name) {
+        return isIdentifierName(name) ? object + "." + name
+                                      : object + "[" + quote(name) + "]";
+    }
+
+    static std::string propertyKey(const std::string& name) {
+        return isIdentifierName(name) ? name : quote(name);
+    }
+
+    // Index past an optional `with { ... }` / `assert { ... }` clause.
+    size_t attributes(size_t j) const {
+        if ((ts.is(j, TokenType::KeywordWith) || ts.isWord(j, "assert")) &&
+            sameLine(j) && ts.is(j + 1, TokenType::LeftBrace)) {
+            return ts.after(j + 1);
+        }
+        return j;
+    }
+
+    std::string bindingName(size_t i) const {
+        return ts.is(i, TokenType::StringLiteral) ? std::string(ts[i].value) : word(i);
+    }
+
+    // `{ a, type B, c as d }` starting at `open`; type-only specifiers are
+    // dropped (their local names reported through `typeNames`).
+    size_t specifiers(size_t open, std::vector<Binding>& bindings, bool& droppedTypes,
+                      std::unordered_set<std::string>* typeNames) const {
+        const size_t close = ts.match(open);
+        if (close == npos) return open + 1;
+        size_t k = open + 1;
+        while (k < close) {
+            if (ts.is(k, TokenType::Comma)) {
+                ++k;
+                continue;
+            }
+            const bool typeOnly = ts.is(k, TokenType::KeywordType) &&
+                (identifierLike(ts.type(k + 1)) || ts.is(k + 1, TokenType::StringLiteral)) &&
+                !ts.is(k + 1, TokenType::KeywordAs);
+            if (typeOnly) ++k;
+            Binding binding;
+            binding.imported = bindingName(k);
+            binding.local = binding.imported;
+            ++k;
+            if (ts.is(k, TokenType::KeywordAs)) {
+                binding.local = bindingName(k + 1);
+                k += 2;
+            }
+            if (typeOnly) {
+                droppedTypes = true;
+                if (typeNames) typeNames->insert(binding.local);
+            } else {
+                bindings.push_back(binding);
+            }
+            while (k < close && !ts.is(k, TokenType::Comma)) ++k;
+        }
+        return close + 1;
+    }
+
+    size_t importDeclaration(size_t first, size_t i) {
+        if (scopes_.size() == 1) module_ = true;
+        size_t j = i + 1;
+        if (ts.is(j, TokenType::KeywordType) && !ts.is(j + 1, TokenType::KeywordFrom) &&
+            !ts.is(j + 1, TokenType::Comma) && !ts.is(j + 1, TokenType::Equal)) {
+            size_t k = j + 1;
+            bool dropped = false;
+            std::vector<Binding> names;
+            if (ts.is(k, TokenType::LeftBrace)) {
+                k = specifiers(k, names, dropped, nullptr);
+            } else if (ts.is(k, TokenType::Star)) {
+                typeImports_.insert(word(k + 2));
+                k += 3;
+            } else {
+                typeImports_.insert(word(k));
+                ++k;
+                if (ts.is(k, TokenType::Equal)) k = skipEntity(k + 1);
+            }
+            for (const Binding& name : names) typeImports_.insert(name.local);
+            if (ts.is(k, TokenType::KeywordFrom)) k += 2;
+            const size_t stop = finishStatement(ts, attributes(k));
+            removeTokens(first, stop);
+            return stop;
+        }
+        if (identifierLike(ts.type(j)) && ts.is(j + 1, TokenType::Equal)) {
+            return importEquals(first, i, false);
+        }
+
+        ImportRecord record;
+        record.first = first;
+        if (ts.is(j, TokenType::StringLiteral)) {
+            record.specifier = j;
+            record.last = finishStatement(ts, attributes(j + 1));
+            imports_.push_back(record);
+            return record.last;
+        }
+        record.clause = true;
+        if (identifierLike(ts.type(j)) && !ts.is(j, TokenType::KeywordFrom)) {
+            record.defaultName = word(j);
+            ++j;
+            if (ts.is(j, TokenType::Comma)) ++j;
+        } else if (ts.is(j, TokenType::KeywordFrom) && ts.is(j + 1, TokenType::KeywordFrom)) {
+            record.defaultName = word(j);  // import from from "m"
+            ++j;
+        }
+        if (ts.is(j, TokenType::Star)) {
+            record.namespaceName = word(j + 2);
+            j += 3;
+        } else if (ts.is(j, TokenType::LeftBrace)) {
+            j = specifiers(j, record.named, record.droppedTypes, &typeImports_);
+        }
+        if (ts.is(j, TokenType::KeywordFrom)) ++j;
+        if (ts.is(j, TokenType::StringLiteral)) {
+            record.specifier = j;
+            ++j;
+        }
+        record.last = finishStatement(ts, attributes(j));
+        imports_.push_back(record);
+        return record.last;
+    }
+
+    size_t skipEntity(size_t j) const {
+        if (identifierLike(ts.type(j))) ++j;
+        while (ts.is(j, TokenType::Dot) && identifierLike(ts.type(j + 1))) j += 2;
+        return j;
+    }
+
+    // `import X = require("m")` and `import X = A.B`, resolved once usage is
+    // known; `first` is the `export` keyword for `export import`.
+    size_t importEquals(size_t first, size_t i, bool exported) {
+        ImportRecord record;
+        record.first = first;
+        record.equalsName = word(i + 1);
+        record.exported = exported;
+        record.target = scope().target;
+        size_t j = i + 3;
+        if (ts.isWord(j, "require") && ts.is(j + 1, TokenType::LeftParen) &&
+            ts.is(j + 2, TokenType::StringLiteral)) {
+            record.specifier = j + 2;
+            j = ts.after(j + 1);
+        } else {
+            record.entity = j;
+            j = skipEntity(j);
+            record.entityEnd = j;
+        }
+        record.last = finishStatement(ts, j);
+        imports_.push_back(record);
+        return record.last;
+    }
+
+    size_t exportDeclaration(size_t i, size_t end) {
+        const bool topLevel = scopes_.size() == 1;
+        if (topLevel) module_ = true;
+        const std::string target = scope().target;
+        const bool rewrite = !target.empty();
+        size_t j = i + 1;
+        switch (ts.type(j)) {
+            case TokenType::KeywordType:
+                if (ts.is(j + 1, TokenType::LeftBrace) || ts.is(j + 1, TokenType::Star)) {
+                    size_t k = ts.is(j + 1, TokenType::LeftBrace) ? ts.after(j + 1) : j + 2;
+                    if (ts.is(k, TokenType::KeywordAs)) k += 2;
+                    if (ts.is(k, TokenType::KeywordFrom)) k += 2;
+                    const size_t stop = finishStatement(ts, attributes(k));
+                    removeTokens(i, stop);
+                    return stop;
+                }
+                if (identifierLike(ts.type(j + 1))) {
+                    scope().types.insert(word(j + 1));
+                    const size_t stop = typeAliasEnd(ts, j);
+                    removeTokens(i, stop);
+                    return stop;
+                }
+                break;
+            case TokenType::KeywordInterface: {
+                scope().types.insert(word(j + 1));
+                const size_t stop = interfaceEnd(ts, j);
+                removeTokens(i, stop);
+                return stop;
+            }
+            case TokenType::KeywordDeclare: {
+                const size_t stop = ambientEnd(ts, j + 1);
+                removeTokens(i, stop);
+                return stop;
+            }
+            case TokenType::KeywordImport:
+                if (identifierLike(ts.type(j + 1)) && ts.is(j + 2, TokenType::Equal)) {
+                    return importEquals(i, j, true);
+                }
+                break;
+            case TokenType::Equal:
+                if (topLevel) exportAssignment_ = true;
+                replaceTokens(i, j + 1, "module.exports =");
+                return finishStatement(ts, expression(j + 1, end, false));
+            case TokenType::KeywordAs: {
+                const size_t stop = finishStatement(ts, j + 3);
+                removeTokens(i, stop);
+                return stop;
+            }
+            case TokenType::KeywordDefault:
+                return exportDefault(i, j + 1, end);
+            case TokenType::Star:
+                return exportStar(i, j);
+            case TokenType::LeftBrace:
+                return exportList(i, j);
+            case TokenType::KeywordEnum:
+                return enumDeclaration(i, j, true);
+            case TokenType::KeywordConst:
+                if (ts.is(j + 1, TokenType::KeywordEnum)) return enumDeclaration(i, j + 1, true);
+                return exportVariable(i, j, end);
+            case TokenType::KeywordLet:
+            case TokenType::KeywordVar:
+            case TokenType::KeywordUsing:
+                return exportVariable(i, j, end);
+            case TokenType::KeywordNamespace:
+                return namespaceDeclaration(i, j, true);
+            case TokenType::Identifier:
+                if (ts[j].value == "module") return namespaceDeclaration(i, j, true);
+                break;
+            case TokenType::KeywordAbstract:
+                if (ts.is(j + 1, TokenType::KeywordClass)) {
+                    removeWord(j);
+                    return exportClass(i, j + 1, end);
+                }
+                break;
+            case TokenType::At:
+                return exportClass(i, decorators(j, end), end);
+            case TokenType::KeywordClass:
+                return exportClass(i, j, end);
+            case TokenType::KeywordFunction:
+            case TokenType::KeywordAsync: {
+                if (rewrite) removeWord(i);
+                std::string name;
+                const size_t stop = functionStatement(i, j, &name);
+                if (rewrite && !name.empty()) {
+                    scope().hoisted.push_back(member(target, name) + " = " + name + ";");
+                }
+                return stop;
+            }
+            default:
+                break;
+        }
+        return expressionStatement(j, end);
+    }
+
+    size_t exportClass(size_t i, size_t j, size_t end) {
+        const std::string target = scope().target;
+        if (target.empty()) return classStatement(j, end, nullptr);
+        removeWord(i);
+        std::string name;
+        const size_t stop = classStatement(j, end, &name);
+        if (!name.empty()) {
+            insert(ts[stop - 1].end, newline(indentOf(i)) + member(target, name) +
+                   " = " + name + ";");
+        }
+        return stop;
+    }
+
+    size_t exportVariable(size_t i, size_t j, size_t end) {
+        const std::string target = scope().target;
+        if (target.empty()) return variableStatement(j, end, nullptr);
+        removeWord(i);
+        std::vector<std::string> names;
+        const size_t stop = variableStatement(j, end, &names);
+        std::string text;
+        for (const std::string& name : names) {
+            text += newline(indentOf(i)) + member(target, name) + " = " + name + ";";
+        }
+        if (!text.empty()) insert(ts[stop - 1].end, text);
+        return stop;
+    }
+
+    size_t exportDefault(size_t i, size_t k, size_t end) {
+        const std::string target = scope().target;
+        const bool rewrite = !target.empty();
+        const std::string assignment = member(target, "default") + " = ";
+        if (ts.is(k, TokenType::KeywordInterface)) {
+            const size_t stop = interfaceEnd(ts, k);
+            removeTokens(i, stop);
+            return stop;
+        }
+        if (ts.is(k, TokenType::KeywordAbstract) && ts.is(k + 1, TokenType::KeywordClass)) {
+            removeWord(k);
+            ++k;
+        }
+        if (ts.is(k, TokenType::At)) k = decorators(k, end);
+        if (ts.is(k, TokenType::KeywordClass)) {
+            if (!rewrite) return classStatement(k, end, nullptr);
+            const bool named = identifierLike(ts.type(k + 1)) &&
+                !ts.is(k + 1, TokenType::KeywordExtends) &&
+                !ts.is(k + 1, TokenType::KeywordImplements);
+            if (named) {
+                replace(ts[i].begin, ts[k].begin, std::string());
+                std::string name;
+                const size_t stop = classStatement(k, end, &name);
+                insert(ts[stop - 1].end, newline(indentOf(i)) + assignment + name + ";");
+                return stop;
+            }
+            replace(ts[i].begin, ts[k].begin, assignment);
+            const size_t stop = classDeclaration(k, end, nullptr);
+            insert(ts[stop - 1].end, ";");
+            return stop;
+        }
+        const bool function = ts.is(k, TokenType::KeywordFunction) ||
+            (ts.is(k, TokenType::KeywordAsync) && ts.is(k + 1, TokenType::KeywordFunction));
+        if (function) {
+            size_t nameToken = ts.is(k, TokenType::KeywordAsync) ? k + 2 : k + 1;
+            if (ts.is(nameToken, TokenType::Star)) ++nameToken;
+            const bool named = identifierLike(ts.type(nameToken));
+            if (!rewrite) return functionStatement(i, k, nullptr);
+            if (named) {
+                replace(ts[i].begin, ts[k].begin, std::string());
+                std::string name;
+                const size_t stop = functionStatement(i, k, &name);
+                if (!name.empty()) scope().hoisted.push_back(assignment + name + ";");
+                return stop;
+            }
+            replace(ts[i].begin, ts[k].begin, assignment);
+            const size_t stop = functionExpression(k);
+            insert(ts[stop - 1].end, ";");
+            return stop;
+        }
+        if (rewrite) replace(ts[i].begin, ts[k].begin, assignment);
+        return expressionStatement(k, end);
+    }
+
+    size_t exportStar(size_t i, size_t j) {
+        const std::string target = scope().target;
+        size_t k = j + 1;
+        std::string name;
+        if (ts.is(k, TokenType::KeywordAs)) {
+            name = bindingName(k + 1);
+            k += 2;
+        }
+        if (ts.is(k, TokenType::KeywordFrom)) ++k;
+        const size_t module = k;
+        const size_t stop = finishStatement(ts, attributes(k + 1));
+        if (!ts.is(module, TokenType::StringLiteral)) return stop;
+        if (target.empty()) {
+            rewriteSpecifier(module);
+            return stop;
+        }
+        const std::string require = "require(" + quote(specifier(module)) + ")";
+        if (name.empty()) {
+            exportStarHelper_ = true;
+            replaceTokens(i, stop, "__exportStar(" + require + ", " + target + ");");
+        } else {
+            replaceTokens(i, stop, member(target, name) + " = " + require + ";");
+        }
+        return stop;
+    }
+
+    size_t exportList(size_t i, size_t open) {
+        const std::string target = scope().target;
+        ExportListRecord record;
+        record.first = i;
+        size_t k = specifiers(open, record.names, record.droppedTypes, nullptr);
+        if (ts.is(k, TokenType::KeywordFrom) && ts.is(k + 1, TokenType::StringLiteral)) {
+            const size_t module = k + 1;
+            const size_t stop = finishStatement(ts, attributes(k + 2));
+            if (record.names.empty()) {
+                removeTokens(i, stop);
+            } else if (target.empty()) {
+                if (record.droppedTypes) {
+                    replaceTokens(i, stop, "export " + exportClause(record.names) +
+                                  " from " + quote(specifier(module)) + ";");
+                } else {
+                    rewriteSpecifier(module);
+                }
+            } else {
+                const std::string name = "_reexport" + std::to_string(++reexports_);
+                std::string text = "var " + name + " = require(" +
+                    quote(specifier(module)) + ");";
+                for (const Binding& binding : record.names) {
+                    text += newline(indentOf(i)) + "Object.defineProperty(" + target +
+                        ", " + quote(binding.local) +
+                        ", { enumerable: true, get: function () { return " +
+                        member(name, binding.imported) + "; } });";
+                }
+                replaceTokens(i, stop, text);
+            }
+            return stop;
+        }
+        record.last = finishStatement(ts, k);
+        for (const Binding& binding : record.names) used.insert(binding.imported);
+        exportLists_.push_back(record);
+        return record.last;
+    }
+
+    static std::string exportClause(const std::vector<Binding>& names) {
+        std::string text = "{ ";
+        for (size_t k = 0; k < names.size(); ++k) {
+            if (k) text += ", ";
+            text += propertyKey(names[k].imported);
+            if (names[k].local != names[k].imported) {
+                text += " as " + propertyKey(names[k].local);
+            }
+        }
+        return text + " }";
+    }
+
+    void finishExportLists() {
+        Scope& module = scopes_.front();
+        for (const ExportListRecord& record : exportLists_) {
+            std::vector<Binding> kept;
+            for (const Binding& binding : record.names) {
+                if (!module.types.count(binding.imported) &&
+                    !typeImports_.count(binding.imported)) {
+                    kept.push_back(binding);
+                }
+            }
+            if (!module.target.empty()) {
+                for (const Binding& binding : kept) {
+                    std::string line = member(module.target, binding.local) + " = " +
+                        binding.imported + ";";
+                    (module.functions.count(binding.imported) ? module.hoisted
+                                                              : module.trailing)
+                        .push_back(std::move(line));
+                }
+                removeTokens(record.first, record.last);
+            } else if (kept.empty()) {
+                removeTokens(record.first, record.last);
+            } else if (kept.size() != record.names.size() || record.droppedTypes) {
+                replaceTokens(record.first, record.last,
+                              "export " + exportClause(kept) + ";");
+            }
+        }
+    }
+
+    bool keep(const std::string& name) const {
+        return options_.verbatimModuleSyntax || used.count(name) != 0;
+    }
+
+    void finishImports() {
+        // `import X = A.B` aliases first: keeping one uses its entity.
+        for (const ImportRecord& record : imports_) {
+            if (record.equalsName.empty()) continue;
+            if (!record.exported && !keep(record.equalsName)) {
+                removeTokens(record.first, record.last);
+                continue;
+            }
+            std::string value;
+            if (record.specifier != npos) {
+                value = "require(" + quote(specifier(record.specifier)) + ")";
+            } else {
+                value = raw(record.entity, record.entityEnd);
+                used.insert(word(record.entity));
+            }
+            std::string text = (record.specifier != npos && !options_.downlevelES5
+                                    ? "const " : "var ") +
+                record.equalsName + " = " + value + ";";
+            if (record.exported) {
+                text = record.target.empty()
+                    ? "export " + text
+                    : text + " " + member(record.target, record.equalsName) + " = " +
+                        record.equalsName + ";";
+            }
+            replaceTokens(record.first, record.last, text);
+        }
+        const std::string declare = options_.downlevelES5 ? "var " : "const ";
+        for (const ImportRecord& record : imports_) {
+            if (!record.equalsName.empty()) continue;
+            const bool keepDefault = !record.defaultName.empty() && keep(record.defaultName);
+            const bool keepNamespace =
+                !record.namespaceName.empty() && keep(record.namespaceName);
+            std::vector<Binding> named;
+            for (const Binding& binding : record.named) {
+                if (keep(binding.local)) named.push_back(binding);
+            }
+            const bool everything = keepDefault == !record.defaultName.empty() &&
+                keepNamespace == !record.namespaceName.empty() &&
+                named.size() == record.named.size() && !record.droppedTypes;
+            const bool nothing = !keepDefault && !keepNamespace && named.empty();
+            if (record.specifier == npos) {
+                if (record.clause && nothing) removeTokens(record.first, record.last);
+                continue;
+            }
+            const std::string module = quote(specifier(record.specifier));
+            if (!options_.commonJS) {
+                if (record.clause && nothing) {
+                    removeTokens(record.first, record.last);
+                } else if (!record.clause || everything) {
+                    rewriteSpecifier(record.specifier);
+                } else {
+                    std::string clause;
+                    if (keepDefault) clause = record.defaultName;
+                    if (keepNamespace) {
+                        clause += (clause.empty() ? "* as " : ", * as ") + record.namespaceName;
+                    } else if (!named.empty()) {
+                        std::vector<Binding> renamed = named;
+                        clause += (clause.empty() ? "" : ", ") + exportClause(renamed);
+                    }
+                    const size_t tail = attributes(record.specifier + 1);
+                    const std::string with = tail > record.specifier + 1
+                        ? " " + raw(record.specifier + 1, tail) : std::string();
+                    replaceTokens(record.first, record.last,
+                                  "import " + clause + " from " + module + with + ";");
+                }
+                continue;
+            }
+            if (!record.clause) {
+                replaceTokens(record.first, record.last, "require(" + module + ");");
+                continue;
+            }
+            if (nothing) {
+                removeTokens(record.first, record.last);
+                continue;
+            }
+            const std::string require = "require(" + module + ")";
+            const std::string separator = newline(indentOf(record.first));
+            std::string text;
+            if (keepDefault) {
+                if (options_.esModuleInterop) {
+                    importDefaultHelper_ = true;
+                    text = declare + record.defaultName + " = __importDefault(" + require +
+                        ").default;";
+                } else {
+                    text = declare + record.defaultName + " = " + require + ".default;";
+                }
+            }
+            if (keepNamespace) {
+                text += (text.empty() ? "" : separator) + declare + record.namespaceName +
+                    " = " + require + ";";
+            }
+            if (!named.empty()) {
+                std::string pattern;
+                for (const Binding& binding : named) {
+                    if (!pattern.empty()) pattern += ", ";
+                    pattern += binding.imported == binding.local
+                        ? binding.local
+                        : propertyKey(binding.imported) + ": " + binding.local;
+                }
+                text += (text.empty() ? "" : separator) + declare + "{ " + pattern + " } = " +
+                    require + ";";
+            }
+            replaceTokens(record.first, record.last, text);
+        }
+    }
+
+    // ---- enums and namespaces ----------------------------------------------
+
+    static bool parseNumber(std::string_view text, double& value) {
+        std::string digits;
+        for (char c : text) {
+            if (c != '_') digits += c;
+        }
+        if (digits.empty() || digits.back() == 'n') return false;
+        char* end = nullptr;
+        if (digits.size() > 2 && digits[0] == '0' &&
+            std::strchr("xXoObB", digits[1]) != nullptr) {
+            const int base = (digits[1] == 'x' || digits[1] == 'X') ? 16
+                : (digits[1] == 'o' || digits[1] == 'O') ? 8 : 2;
+            value = static_cast<double>(std::strtoull(digits.c_str() + 2, &end, base));
+        } else {
+            value = std::strtod(digits.c_str(), &end);
+        }
+        return end != nullptr && *end == '\0';
+    }
+
+    static std::string formatNumber(double value) {
+        char buffer[32];
+        if (value == static_cast<double>(static_cast<int64_t>(value)) &&
+            value > -1e15 && value < 1e15) {
+            std::snprintf(buffer, sizeof(buffer), "%lld",
+                          static_cast<long long>(value));
+        } else {
+            std::snprintf(buffer, sizeof(buffer), "%.17g", value);
+        }
+        return buffer;
+    }
+
+    // The scope argument of an enum or namespace IIFE: `E || (E = {})`,
+    // exported as `E || (exports.E = E = {})`.
+    std::string iifeArgument(const std::string& name, bool exported) {
+        const std::string target = scope().target;
+        if (exported && !target.empty()) {
+            return name + " || (" + member(target, name) + " = " + name + " = {})";
+        }
+        return name + " || (" + name + " = {})";
+    }
+
+    std::string variableFor(const std::string& name, bool exported) {
+        if (scope().values.count(name)) return std::string();
+        const bool esmExport = exported && scope().target.empty() && scope().module;
+        return (esmExport ? "export var " : "var ") + name + ";";
+    }
+
+    size_t enumDeclaration(size_t start, size_t i, bool exported) {
+        const size_t open = i + 2;
+        if (!identifierLike(ts.type(i + 1)) || !ts.is(open, TokenType::LeftBrace) ||
+            ts.match(open) == npos) {
+            return i + 1;
+        }
+        const std::string name = word(i + 1);
+        const size_t close = ts.match(open);
+        const std::string indent = indentOf(start);
+        const std::string inner = indent + "    ";
+
+        std::unordered_set<std::string> members;
+        std::string body;
+        double next = 0;
+        bool numeric = true;
+        std::string previous;
+        size_t j = open + 1;
+        while (j < close) {
+            if (ts.is(j, TokenType::Comma)) {
+                ++j;
+                continue;
+            }
+            const std::string key = bindingName(j);
+            ++j;
+            size_t valueEnd = j;
+            std::string value;
+            if (ts.is(j, TokenType::Equal)) {
+                valueEnd = j + 1;
+                while (valueEnd < close && !ts.is(valueEnd, TokenType::Comma)) {
+                    valueEnd = ts.after(valueEnd);
+                }
+                for (size_t t = j + 1; t < valueEnd; ++t) {
+                    if (t > j + 1) {
+                        value.append(ts.source, ts[t - 1].end, ts[t].begin - ts[t - 1].end);
+                    }
+                    const bool reference = identifierLike(ts.type(t)) &&
+                        !ts.is(t - 1, TokenType::Dot);
+                    if (reference && members.count(word(t))) {
+                        value += member(name, word(t));
+                    } else {
+                        if (reference) used.insert(word(t));
+                        value += raw(t);
+                    }
+                }
+            }
+            std::string line;
+            const bool stringValue = valueEnd == j + 2 &&
+                (ts.is(j + 1, TokenType::StringLiteral) ||
+                 ts.is(j + 1, TokenType::TemplateLiteral));
+            if (stringValue) {
+                line = name + "[" + quote(key) + "] = " + value + ";";
+                numeric = false;
+            } else {
+                double number = 0;
+                if (value.empty()) {
+                    value = numeric ? formatNumber(next)
+                                    : name + "[" + quote(previous) + "] + 1";
+                    next += 1;
+                } else if (valueEnd == j + 2 && ts.is(j + 1, TokenType::NumberLiteral) &&
+                           parseNumber(ts[j + 1].value, number)) {
+                    next = number + 1;
+                    numeric = true;
+                } else if (valueEnd == j + 3 && ts.is(j + 1, TokenType::Minus) &&
+                           ts.is(j + 2, TokenType::NumberLiteral) &&
+                           parseNumber(ts[j + 2].value, number)) {
+                    next = 1 - number;
+                    numeric = true;
+                } else {
+                    numeric = false;
+                }
+                line = name + "[" + name + "[" + quote(key) + "] = " + value + "] = " +
+                    quote(key) + ";";
+            }
+            body += newline(inner) + line;
+            members.insert(key);
+            previous = key;
+            j = valueEnd;
+        }
+
+        std::string text = variableFor(name, exported);
+        if (!text.empty()) text += newline(indent);
+        text += "(function (" + name + ") {" + body + newline(indent) + "})(" +
+            iifeArgument(name, exported) + ");";
+        replace(ts[start].begin, ts[close].end, text);
+        scope().values.insert(name);
+        return close + 1;
+    }
+
+    // True when a namespace body declares only types.
+    bool nonInstantiated(size_t open, size_t close) const {
+        size_t k = open + 1;
+        while (k < close) {
+            size_t t = k;
+            if (ts.is(t, TokenType::KeywordExport)) ++t;
+            if (ts.is(t, TokenType::Semicolon)) {
+                k = t + 1;
+            } else if (ts.is(t, TokenType::KeywordInterface)) {
+                k = interfaceEnd(ts, t);
+            } else if (ts.is(t, TokenType::KeywordType) && identifierLike(ts.type(t + 1))) {
+                k = typeAliasEnd(ts, t);
+            } else if (ts.is(t, TokenType::KeywordDeclare)) {
+                k = ambientEnd(ts, t + 1);
+            } else if ((ts.is(t, TokenType::KeywordNamespace) || ts.isWord(t, "module")) &&
+                       identifierLike(ts.type(t + 1))) {
+                const size_t body = skipEntity(t + 1);
+                if (!ts.is(body, TokenType::LeftBrace) || ts.match(body) == npos ||
+                    !nonInstantiated(body, ts.match(body))) {
+                    return false;
+                }
+                k = ts.match(body) + 1;
+            } else {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    size_t namespaceDeclaration(size_t start, size_t i, bool exported) {
+        std::vector<std::string> names;
+        size_t j = i + 1;
+        while (identifierLike(ts.type(j))) {
+            names.push_back(word(j));
+            if (!ts.is(j + 1, TokenType::Dot)) {
+                ++j;
+                break;
+            }
+            j += 2;
+        }
+        const size_t open = j;
+        if (names.empty() || !ts.is(open, TokenType::LeftBrace) || ts.match(open) == npos) {
+            return expressionStatement(i, ts.eof());
+        }
+        const size_t close = ts.match(open);
+        if (nonInstantiated(open, close)) {
+            scope().types.insert(names.front());
+            removeTokens(start, close + 1);
+            return close + 1;
+        }
+
+        const std::string indent = indentOf(start);
+        std::string header = variableFor(names.front(), exported);
+        if (!header.empty()) header += newline(indent);
+        std::vector<std::string> arguments;
+        arguments.push_back(iifeArgument(names.front(), exported));
+        scope().values.insert(names.front());
+        for (size_t k = 0; k < names.size(); ++k) {
+            if (k > 0) {
+                header += newline(indent) + (options_.downlevelES5 ? "var " : "let ") +
+                    names[k] + ";";
+                const std::string outer = member(names[k - 1], names[k]);
+                arguments.push_back(names[k] + " = " + outer + " || (" + outer + " = {})");
+            }
+            header += (k > 0 ? newline(indent) : std::string()) +
+                "(function (" + names[k] + ") {";
+        }
+
+        scopes_.push_back(Scope());
+        scope().target = names.back();
+        statementList(open + 1, close, true);
+        const std::string bodyIndent = indent + "    ";
+        for (const std::string& line : scope().hoisted) header += newline(bodyIndent) + line;
+        std::string footer;
+        for (const std::string& line : scope().trailing) footer += line + newline(indent);
+        scopes_.pop_back();
+
+        for (size_t k = names.size(); k-- > 0;) {
+            if (k + 1 < names.size()) footer += newline(indent);
+            footer += "})(" + arguments[k] + ");";
+        }
+        replace(ts[start].begin, ts[open].end, header);
+        replaceTokens(close, close + 1, footer);
+        return close + 1;
+    }
+};
+
+// ============================================================================
+// Declaration emit
+// ============================================================================
+
+// Prints the .d.ts surface of a module from the same token stream: type
+// declarations are copied, runtime declarations are reduced to signatures.
+// Inferred types the rewriter cannot see (return types, initializers other
+// than literals) are written as `unknown`; `#private` members are left out
+// since Nova's own parser does not accept them in declarations. Every
+// emitted declaration maps back to the statement it came from.
+class DeclarationEmitter {
+public:
+    explicit DeclarationEmitter(const TokenStream& ts) : ts(ts) {}
+
+    EmitResult emit() {
+        module_ = false;
+        for (size_t k = 0; k < ts.eof(); ++k) {
+            if (ts.is(k, TokenType::KeywordImport) || ts.is(k, TokenType::KeywordExport)) {
+                module_ = true;
+            }
+            if (ts.is(k, TokenType::KeywordExport) && ts.is(k + 1, TokenType::LeftBrace) &&
+                ts.match(k + 1) != npos) {
+                size_t j = ts.match(k + 1) + 1;
+                if (ts.is(j, TokenType::KeywordFrom)) continue;
+                for (size_t t = k + 2; t < j - 1; ++t) {
+                    if (identifierLike(ts.type(t)) && !ts.is(t - 1, TokenType::KeywordAs) &&
+                        !ts.is(t, TokenType::KeywordAs)) {
+                        exportedLocals_.insert(std::string(ts[t].value));
+                    }
+                }
+            }
+        }
+        statements(0, ts.eof(), std::string(), false);
+        EmitResult result;
+        result.code = std::move(out_);
+        result.mappings = std::move(mappings_);
+        return result;
+    }
+
+private:
+    const TokenStream& ts;
+    std::string out_;
+    std::string mappings_;
+    bool module_ = false;
+    std::unordered_set<std::string> exportedLocals_;
+
+    int64_t generatedLine_ = 0;
+    int64_t previousLine_ = 0;
+    int64_t previousColumn_ = 0;
+    size_t cursor_ = 0;
+    int64_t sourceLine_ = 0;
+    int64_t sourceColumn_ = 0;
+
+    std::string raw(size_t first, size_t last) const {
+        if (last <= first) return std::string();
+        return ts.source.substr(ts[first].begin, ts[last - 1].end - ts[first].begin);
+    }
+    std::string word(size_t i) const { return std::string(ts[i].value); }
+
+    size_t skipDecorators(size_t k) const {
+        while (ts.is(k, TokenType::At)) {
+            if (ts.is(k + 1, TokenType::LeftParen)) {
+                k = ts.after(k + 1);
+                continue;
+            }
+            k += 2;
+            while (ts.is(k, TokenType::Dot) && identifierLike(ts.type(k + 1))) k += 2;
+            if (ts.is(k, TokenType::Less)) {
+                const size_t next = skipAngles(ts, k);
+                if (next != npos) k = next;
+            }
+            if (ts.is(k, TokenType::LeftParen)) k = ts.after(k);
+        }
+        return k;
+    }
+
+    // Appends `text` as one declaration starting a new line, mapped to the
+    // token at `origin`.
+    void line(const std::string& indent, const std::string& text, size_t origin) {
+        const size_t offset = ts[origin].begin;
+        if (offset < cursor_) {
+            cursor_ = 0;
+            sourceLine_ = 0;
+            sourceColumn_ = 0;
+        }
+        for (; cursor_ < offset; ++cursor_) {
+            const unsigned char c = static_cast<unsigned char>(ts.source[cursor_]);
+            if (c == '\n') {
+                ++sourceLine_;
+                sourceColumn_ = 0;
+            } else if (c != '\r' && (c & 0xC0) != 0x80) {
+                sourceColumn_ += c >= 0xF0 ? 2 : 1;
+            }
+        }
+        appendVLQ(mappings_, static_cast<int64_t>(indent.size()));
+        appendVLQ(mappings_, 0);
+        appendVLQ(mappings_, sourceLine_ - previousLine_);
+        appendVLQ(mappings_, sourceColumn_ - previousColumn_);
+        previousLine_ = sourceLine_;
+        previousColumn_ = sourceColumn_;
+
+        out_ += indent;
+        out_ += text;
+        out_ += '\n';
+        const int64_t lines = 1 + std::count(text.begin(), text.end(), '\n');
+        generatedLine_ += lines;
+        mappings_.append(static_cast<size_t>(lines), ';');
+    }
+
+    // Index past a statement this emitter does not understand.
+    size_t skipStatement(size_t k, size_t end) const {
+        size_t j = k;
+        while (j < end) {
+            if (ts.is(j, TokenType::Semicolon)) return j + 1;
+            if (j > k && ts.startsStatement(j)) return j;
+            const bool block = ts.is(j, TokenType::LeftBrace);
+            j = ts.after(j);
+            if (block && (j >= end || ts[j].newlineBefore)) return j;
+        }
+        return end;
+    }
+
+    static std::string widen(const TokenStream& ts, size_t k, size_t stop, bool literal) {
+        if (stop == k + 1) {
+            switch (ts.type(k)) {
+                case TokenType::StringLiteral:
+                    return literal ? JSXParser::quote(std::string(ts[k].value)) : "string";
+                case TokenType::NumberLiteral:
+                    if (ts[k].value.find('n') != std::string_view::npos) return "bigint";
+                    return literal ? std::string(ts[k].value) : "number";
+                case TokenType::TrueLiteral:
+                    return literal ? "true" : "boolean";
+                case TokenType::FalseLiteral:
+                    return literal ? "false" : "boolean";
+                case TokenType::TemplateLiteral:
+                    return "string";
+                case TokenType::NullLiteral:
+                    return "null";
+                default:
+                    break;
+            }
+        }
+        if (stop == k + 2 && ts.is(k, TokenType::Minus) &&
+            ts.is(k + 1, TokenType::NumberLiteral)) {
+            return literal ? "-" + std::string(ts[k + 1].value) : "number";
+        }
+        if (ts.is(k, TokenType::KeywordNew) && identifierLike(ts.type(k + 1))) {
+            size_t j = k + 1;
+            std::string name = std::string(ts[j].value);
+            while (ts.is(j + 1, TokenType::Dot) && identifierLike(ts.type(j + 2))) {
+                name += "." + std::string(ts[j + 2].value);
+                j += 2;
+            }
+            if (ts.is(j + 1, TokenType::LeftParen) && ts.after(j + 1) == stop) return name;
+        }
+        if (stop > k + 2 && ts.is(stop - 2, TokenType::KeywordAs) &&
+            identifierLike(ts.type(stop - 1)) && !ts.isWord(stop - 1, "const")) {
+            return std::string(ts[stop - 1].value);
+        }
+        return "unknown";
+    }
+
+    size_t initializerEnd(size_t k, size_t end) const {
+        while (k < end && !ts.is(k, TokenType::Comma) && !ts.is(k, TokenType::Semicolon) &&
+               !ts.is(k, TokenType::RightBrace) && !ts.startsStatement(k)) {
+            k = ts.after(k);
+        }
+        return k;
+    }
+
+    // `(a: T, b = 1, ...rest: U[])` with defaults turned into optional
+    // parameters; `properties` collects constructor parameter properties.
+    std::string parameters(size_t open, std::vector<std::string>* properties) const {
+        const size_t close = ts.match(open);
+        std::string text = "(";
+        size_t k = open + 1;
+        bool first = true;
+        while (k < close) {
+            k = skipDecorators(k);
+            std::string modifiers;
+            bool property = false;
+            while ((ts.is(k, TokenType::KeywordPublic) || ts.is(k, TokenType::KeywordPrivate) ||
+                    ts.is(k, TokenType::KeywordProtected) ||
+                    ts.is(k, TokenType::KeywordReadonly) ||
+                    ts.is(k, TokenType::KeywordOverride)) &&
+                   (identifierLike(ts.type(k + 1)) || ts.is(k + 1, TokenType::LeftBrace) ||
+                    ts.is(k + 1, TokenType::LeftBracket))) {
+                property = true;
+                if (!ts.is(k, TokenType::KeywordPublic) && !ts.is(k, TokenType::KeywordOverride)) {
+                    modifiers += word(k) + " ";
+                }
+                ++k;
+            }
+            const size_t nameStart = k;
+            if (ts.is(k, TokenType::DotDotDot)) ++k;
+            k = ts.is(k, TokenType::LeftBrace) || ts.is(k, TokenType::LeftBracket)
+                ? ts.after(k) : k + 1;
+            std::string name = raw(nameStart, k);
+            bool optional = false;
+            if (ts.is(k, TokenType::Question)) {
+                optional = true;
+                ++k;
+            }
+            std::string type;
+            if (ts.is(k, TokenType::Colon)) {
+                const size_t stop = skipType(ts, k + 1);
+                type = raw(k + 1, stop);
+                k = stop;
+            }
+            if (ts.is(k, TokenType::Equal)) {
+                const size_t stop = initializerEnd(k + 1, close);
+                if (type.empty()) type = widen(ts, k + 1, stop, false);
+                optional = true;
+                k = stop;
+            }
+            if (type.empty()) type = ts.is(nameStart, TokenType::DotDotDot) ? "any[]" : "any";
+            if (name != "this" || !type.empty()) {
+                if (!first) text += ", ";
+                first = false;
+                text += name + (optional ? "?: " : ": ") + type;
+            }
+            if (property && properties) {
+                properties->push_back(modifiers +
+                                      (modifiers.find("private") != std::string::npos
+                                           ? name + ";"
+                                           : name + (optional ? "?: " : ": ") + type + ";"));
+            }
+            while (k < close && !ts.is(k, TokenType::Comma)) k = ts.after(k);
+            ++k;
+        }
+        return text + ")";
+    }
+
+    // True when the block [open, close] returns a value anywhere.
+    bool returnsValue(size_t open, size_t close) const {
+        for (size_t k = open + 1; k < close; ++k) {
+            if (ts.is(k, TokenType::KeywordReturn) && k + 1 < close &&
+                !ts[k + 1].newlineBefore && !ts.is(k + 1, TokenType::Semicolon) &&
+                !ts.is(k + 1, TokenType::RightBrace)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Signature from the token after the name: `<T>(params): R`. Sets
+    // `stop` past the body (or signature) and `body` when there is one.
+    std::string signature(size_t k, size_t end, bool async, bool returnType,
+                          std::vector<std::string>* properties, size_t& stop,
+                          bool& body) const {
+        std::string text;
+        if (ts.is(k, TokenType::Less)) {
+            const size_t next = skipAngles(ts, k);
+            if (next != npos) {
+                text += raw(k, next);
+                k = next;
+            }
+        }
+        if (!ts.is(k, TokenType::LeftParen) || ts.match(k) == npos) {
+            stop = skipStatement(k, end);
+            body = false;
+            return text + "()";
+        }
+        text += parameters(k, properties);
+        k = ts.match(k) + 1;
+        std::string type;
+        if (ts.is(k, TokenType::Colon)) {
+            const size_t next = skipType(ts, k + 1);
+            type = raw(k + 1, next);
+            k = next;
+        }
+        body = ts.is(k, TokenType::LeftBrace) && ts.match(k) != npos;
+        if (type.empty() && body) {
+            type = returnsValue(k, ts.match(k)) ? "unknown" : "void";
+            if (async) type = "Promise<" + type + ">";
+        } else if (type.empty()) {
+            type = "unknown";
+        }
+        if (returnType) text += ": " + type;
+        stop = body ? ts.match(k) + 1 : finishStatement(ts, k);
+        return text;
+    }
+
+    std::string prefix(bool exported, bool isDefault, bool ambient) const {
+        std::string text;
+        if (exported) text += "export ";
+        if (isDefault) return text + "default ";
+        if (!ambient) text += "declare ";
+        return text;
+    }
+
+    void statements(size_t k, size_t end, const std::string& indent, bool ambient) {
+        std::unordered_set<std::string> overloaded;
+        while (k < end) {
+            const size_t start = k;
+            if (ts.is(k, TokenType::Semicolon)) {
+                ++k;
+                continue;
+            }
+            k = skipDecorators(k);
+            bool exported = false;
+            bool isDefault = false;
+            if (ts.is(k, TokenType::KeywordExport)) {
+                exported = true;
+                ++k;
+                if (ts.is(k, TokenType::KeywordDefault)) {
+                    isDefault = true;
+                    ++k;
+                }
+            }
+            const size_t next = declaration(start, k, end, indent, ambient, exported,
+                                            isDefault, overloaded);
+            k = next > start ? next : start + 1;
+        }
+    }
+
+    size_t declaration(size_t start, size_t k, size_t end, const std::string& indent,
+                       bool ambient, bool exported, bool isDefault,
+                       std::unordered_set<std::string>& overloaded) {
+        const TokenType type = ts.type(k);
+        const auto visible = [&](const std::string& name) {
+            return exported || !module_ || (!ambient && exportedLocals_.count(name) != 0);
+        };
+        if (exported && !isDefault &&
+            (type == TokenType::LeftBrace || type == TokenType::Star ||
+             type == TokenType::Equal || type == TokenType::KeywordAs ||
+             type == TokenType::KeywordImport)) {
+            size_t stop = type == TokenType::LeftBrace ? ts.after(k) : k + 1;
+            stop = skipStatement(stop, end);
+            line(indent, raw(start, stop) + (ts.is(stop - 1, TokenType::Semicolon) ? "" : ";"),
+                 start);
+            return stop;
+        }
+        if (exported && type == TokenType::KeywordType &&
+            (ts.is(k + 1, TokenType::LeftBrace) || ts.is(k + 1, TokenType::Star))) {
+            const size_t stop = skipStatement(k + 1, end);
+            line(indent, raw(start, stop), start);
+            return stop;
+        }
+        switch (type) {
+            case TokenType::KeywordImport: {
+                const size_t stop = skipStatement(k + 1, end);
+                if (exported || ts.is(k + 1, TokenType::LeftParen) ||
+                    ts.is(k + 1, TokenType::Dot) || ts.is(k + 1, TokenType::StringLiteral)) {
+                    return stop;
+                }
+                // Every import in a declaration file is type-only already.
+                const bool typeOnly = ts.is(k + 1, TokenType::KeywordType) &&
+                    !ts.is(k + 2, TokenType::KeywordFrom) && !ts.is(k + 2, TokenType::Comma) &&
+                    !ts.is(k + 2, TokenType::Equal);
+                line(indent, typeOnly ? "import " + raw(k + 2, stop) : raw(start, stop), start);
+                return stop;
+            }
+            case TokenType::KeywordInterface: {
+                const size_t stop = interfaceEnd(ts, k);
+                line(indent, raw(start, stop), start);
+                return stop;
+            }
+            case TokenType::KeywordType:
+                if (identifierLike(ts.type(k + 1))) {
+                    const size_t stop = typeAliasEnd(ts, k);
+                    std::string text = raw(start, stop);
+                    if (!ts.is(stop - 1, TokenType::Semicolon)) text += ";";
+                    line(indent, text, start);
+                    return stop;
+                }
+                break;
+            case TokenType::KeywordDeclare: {
+                const size_t stop = ambientEnd(ts, k + 1);
+                if (ambient) {
+                    line(indent, raw(k + 1, stop), start);
+                } else {
+                    line(indent, raw(start, stop), start);
+                }
+                return stop;
+            }
+            case TokenType::KeywordEnum:
+            case TokenType::KeywordConst:
+                if (type == TokenType::KeywordEnum || ts.is(k + 1, TokenType::KeywordEnum)) {
+                    const size_t keyword = type == TokenType::KeywordEnum ? k : k + 1;
+                    const size_t stop = ts.after(keyword + 2);
+                    // Const enums are emitted as regular enums, so they are
+                    // declared as such.
+                    if (visible(word(keyword + 1))) {
+                        line(indent, prefix(exported, false, ambient) + raw(keyword, stop), start);
+                    }
+                    return stop;
+                }
+                return variables(start, k, end, indent, ambient, exported);
+            case TokenType::KeywordLet:
+            case TokenType::KeywordVar:
+            case TokenType::KeywordUsing:
+                return variables(start, k, end, indent, ambient, exported);
+            case TokenType::KeywordNamespace:
+            case TokenType::Identifier:
+                if (type == TokenType::KeywordNamespace || ts[k].value == "module") {
+                    if (!identifierLike(ts.type(k + 1)) || ts.is(k + 1, TokenType::Colon)) break;
+                    size_t open = k + 1;
+                    while (identifierLike(ts.type(open)) || ts.is(open, TokenType::Dot)) ++open;
+                    if (!ts.is(open, TokenType::LeftBrace) || ts.match(open) == npos) break;
+                    const size_t close = ts.match(open);
+                    if (visible(word(k + 1))) {
+                        line(indent, prefix(exported, false, ambient) + "namespace " +
+                             raw(k + 1, open) + " {", start);
+                        statements(open + 1, close, indent + "    ", true);
+                        line(indent, "}", close);
+                    }
+                    return close + 1;
+                }
+                break;
+            case TokenType::KeywordAbstract:
+            case TokenType::KeywordClass:
+                if (type == TokenType::KeywordAbstract && !ts.is(k + 1, TokenType::KeywordClass)) {
+                    break;
+                }
+                return classDeclaration(start, k, end, indent, ambient, exported, isDefault);
+            case TokenType::KeywordAsync:
+            case TokenType::KeywordFunction: {
+                if (type == TokenType::KeywordAsync && !ts.is(k + 1, TokenType::KeywordFunction)) {
+                    break;
+                }
+                const bool async = type == TokenType::KeywordAsync;
+                size_t j = async ? k + 2 : k + 1;
+                const bool generator = ts.is(j, TokenType::Star);
+                if (generator) ++j;
+                std::string name;
+                if (identifierLike(ts.type(j)) && !ts.is(j, TokenType::LeftParen)) {
+                    name = word(j);
+                    ++j;
+                }
+                size_t stop = j;
+                bool body = false;
+                std::string text = signature(j, end, async, true, nullptr, stop, body);
+                if (generator) {
+                    const size_t colon = text.rfind("): ");
+                    if (colon != std::string::npos && body) {
+                        text = text.substr(0, colon + 3) +
+                            (async ? "AsyncGenerator<unknown>" : "Generator<unknown>");
+                    }
+                }
+                const std::string key = name.empty() ? "default" : name;
+                if (!body) {
+                    overloaded.insert(key);
+                } else if (overloaded.count(key)) {
+                    return stop;
+                }
+                if (isDefault) {
+                    // `declare function f(): T; export default f;` rather
+                    // than a body-less `export default function`.
+                    const std::string local = name.empty() ? "_default" : name;
+                    line(indent, prefix(false, false, ambient) + "function " +
+                         (generator ? "*" : "") + local + text + ";", start);
+                    line(indent, "export default " + local + ";", start);
+                } else if (visible(name)) {
+                    line(indent, prefix(exported, false, ambient) + "function " +
+                         (generator ? "*" : "") + name + text + ";", start);
+                }
+                return stop;
+            }
+            default:
+                break;
+        }
+        const size_t stop = skipStatement(k, end);
+        if (isDefault) {
+            if (stop == k + 1 + (ts.is(stop - 1, TokenType::Semicolon) ? 1 : 0) &&
+                identifierLike(ts.type(k))) {
+                line(indent, "export default " + word(k) + ";", start);
+            } else {
+                line(indent, "declare const _default: unknown;", start);
+                line(indent, "export default _default;", start);
+            }
+        }
+        return stop;
+    }
+
+    size_t variables(size_t start, size_t k, size_t end, const std::string& indent,
+                     bool ambient, bool exported) {
+        const bool constant = ts.is(k, TokenType::KeywordConst);
+        const std::string keyword = constant ? "const " : "let ";
+        size_t j = k + 1;
+        while (j < end) {
+            const size_t nameStart = j;
+            j = ts.is(j, TokenType::LeftBrace) || ts.is(j, TokenType::LeftBracket)
+                ? ts.after(j) : j + 1;
+            const std::string name = raw(nameStart, j);
+            if (ts.is(j, TokenType::Exclamation)) ++j;
+            std::string type;
+            if (ts.is(j, TokenType::Colon)) {
+                const size_t stop = skipType(ts, j + 1);
+                type = raw(j + 1, stop);
+                j = stop;
+            }
+            if (ts.is(j, TokenType::Equal)) {
+                const size_t stop = initializerEnd(j + 1, end);
+                if (type.empty()) type = widen(ts, j + 1, stop, constant);
+                j = stop;
+            }
+            if (type.empty()) type = "unknown";
+            if (identifierLike(ts.type(nameStart)) && (exported || !module_ ||
+                                                        exportedLocals_.count(name))) {
+                line(indent, prefix(exported, false, ambient) + keyword + name + ": " +
+                     type + ";", start);
+            }
+            if (!ts.is(j, TokenType::Comma)) break;
+            ++j;
+        }
+        return finishStatement(ts, j);
+    }
+
+    size_t classDeclaration(size_t start, size_t k, size_t end, const std::string& indent,
+                            bool ambient, bool exported, bool isDefault) {
+        const size_t keyword = ts.is(k, TokenType::KeywordAbstract) ? k + 1 : k;
+        size_t open = keyword + 1;
+        while (open < end && !ts.is(open, TokenType::LeftBrace)) {
+            if (ts.is(open, TokenType::Less)) {
+                const size_t next = skipAngles(ts, open);
+                open = next == npos ? open + 1 : next;
+            } else {
+                open = ts.is(open, TokenType::LeftParen) ? ts.after(open) : open + 1;
+            }
+        }
+        if (open >= end || ts.match(open) == npos) return skipStatement(k, end);
+        const size_t close = ts.match(open);
+        const bool named = identifierLike(ts.type(keyword + 1)) &&
+            !ts.is(keyword + 1, TokenType::KeywordExtends) &&
+            !ts.is(keyword + 1, TokenType::KeywordImplements);
+        if (!isDefault && !(named && (exported || !module_ ||
+                                      exportedLocals_.count(word(keyword + 1))))) {
+            return close + 1;
+        }
+        line(indent, prefix(exported, isDefault, ambient) + raw(k, open) + " {", start);
+        members(open, close, indent + "    ");
+        line(indent, "}", close);
+        return close + 1;
+    }
+
+    void members(size_t open, size_t close, const std::string& indent) {
+        std::unordered_set<std::string> overloaded;
+        size_t j = open + 1;
+        while (j < close) {
+            if (ts.is(j, TokenType::Semicolon)) {
+                ++j;
+                continue;
+            }
+            const size_t start = j;
+            j = skipDecorators(j);
+            std::string modifiers;
+            bool isPrivate = false;
+            bool async = false;
+            bool generator = false;
+            std::string accessor;
+            for (;;) {
+                const TokenType type = ts.type(j);
+                const bool modifier = type == TokenType::KeywordPublic ||
+                    type == TokenType::KeywordPrivate || type == TokenType::KeywordProtected ||
+                    type == TokenType::KeywordReadonly || type == TokenType::KeywordStatic ||
+                    type == TokenType::KeywordAbstract || type == TokenType::KeywordOverride ||
+                    type == TokenType::KeywordDeclare || type == TokenType::KeywordAsync ||
+                    type == TokenType::KeywordGet || type == TokenType::KeywordSet ||
+                    ts.isWord(j, "accessor");
+                const TokenType following = ts.type(j + 1);
+                const bool name = identifierLike(following) ||
+                    following == TokenType::StringLiteral ||
+                    following == TokenType::NumberLiteral ||
+                    following == TokenType::LeftBracket || following == TokenType::Hash ||
+                    following == TokenType::Star;
+                if (!modifier || !name || ts[j + 1].newlineBefore) break;
+                if (type == TokenType::KeywordPrivate) isPrivate = true;
+                if (type == TokenType::KeywordAsync) {
+                    async = true;
+                } else if (type == TokenType::KeywordGet || type == TokenType::KeywordSet) {
+                    accessor = word(j) + " ";
+                } else if (type != TokenType::KeywordPublic &&
+                           type != TokenType::KeywordOverride &&
+                           type != TokenType::KeywordDeclare) {
+                    modifiers += word(j) + " ";
+                }
+                ++j;
+            }
+            if (ts.is(j, TokenType::Star)) {
+                generator = true;
+                ++j;
+            }
+            if (ts.is(j, TokenType::KeywordStatic) && ts.is(j + 1, TokenType::LeftBrace)) {
+                j = ts.after(j + 1);
+                continue;
+            }
+            if (ts.is(j, TokenType::LeftBracket) && identifierLike(ts.type(j + 1)) &&
+                ts.is(j + 2, TokenType::Colon)) {
+                // Index signature.
+                size_t stop = ts.after(j);
+                if (ts.is(stop, TokenType::Colon)) stop = skipType(ts, stop + 1);
+                stop = finishStatement(ts, stop);
+                line(indent, modifiers + raw(j, stop) +
+                     (ts.is(stop - 1, TokenType::Semicolon) ? "" : ";"), start);
+                j = stop;
+                continue;
+            }
+            const size_t nameStart = j;
+            if (ts.is(j, TokenType::Hash)) ++j;
+            j = ts.is(j, TokenType::LeftBracket) ? ts.after(j) : j + 1;
+            const std::string name = raw(nameStart, j);
+            std::string optional;
+            if (ts.is(j, TokenType::Question)) {
+                optional = "?";
+                ++j;
+            } else if (ts.is(j, TokenType::Exclamation)) {
+                ++j;
+            }
+            const bool hashName = ts.is(nameStart, TokenType::Hash);
+
+            if (ts.is(j, TokenType::LeftParen) || ts.is(j, TokenType::Less)) {
+                const bool constructor = name == "constructor";
+                std::vector<std::string> properties;
+                size_t stop = j;
+                bool body = false;
+                const bool setter = accessor == "set ";
+                std::string text = signature(j, close, async, !constructor && !setter,
+                                             constructor ? &properties : nullptr, stop, body);
+                if (generator && body) {
+                    const size_t colon = text.rfind("): ");
+                    if (colon != std::string::npos) {
+                        text = text.substr(0, colon + 3) +
+                            (async ? "AsyncGenerator<unknown>" : "Generator<unknown>");
+                    }
+                }
+                j = stop;
+                const std::string key = accessor + name;
+                if (!body) {
+                    overloaded.insert(key);
+                } else if (overloaded.count(key)) {
+                    continue;
+                }
+                if (hashName) continue;
+                for (const std::string& property : properties) line(indent, property, start);
+                if (isPrivate) {
+                    if (accessor.empty() || !overloaded.count("private " + name)) {
+                        line(indent, modifiers + name + ";", start);
+                        overloaded.insert("private " + name);
+                    }
+                } else {
+                    line(indent, modifiers + accessor + name + optional + text + ";", start);
+                }
+                continue;
+            }
+
+            std::string type;
+            if (ts.is(j, TokenType::Colon)) {
+                const size_t stop = skipType(ts, j + 1);
+                type = raw(j + 1, stop);
+                j = stop;
+            }
+            if (ts.is(j, TokenType::Equal)) {
+                const size_t stop = initializerEnd(j + 1, close);
+                if (type.empty()) {
+                    type = widen(ts, j + 1, stop,
+                                 modifiers.find("readonly") != std::string::npos);
+                }
+                j = stop;
+            }
+            if (type.empty()) type = "unknown";
+            j = finishStatement(ts, j);
+            if (j == start) ++j;
+            if (hashName) {
+                continue;
+            } else if (isPrivate) {
+                line(indent, modifiers + name + ";", start);
+            } else {
+                line(indent, modifiers + name + optional + ": " + type + ";", start);
+            }
+        }
+    }
+};
+
+// ============================================================================
+// Module scan
+// ============================================================================
+
+// Statement split and name classification for the bundler. It runs on
+// emitted JavaScript, so there is no type syntax left to step over; what
+// it has to get right is where top-level statements end, which of them can
+// be dropped, and which identifiers are names (renamed when modules share
+// one scope) rather than property keys or member names.
+class ModuleScanner {
+public:
+    explicit ModuleScanner(const TokenStream& ts) : ts(ts) {}
+
+    ModuleScan scan() {
+        size_t i = 0;
+        while (i < ts.eof()) {
+            const size_t next = statement(i);
+            i = next > i ? next : i + 1;
+        }
+        walk(ts, 0, false);
+        std::sort(scan_.names.begin(), scan_.names.end(),
+                  [](const ModuleScan::Name& a, const ModuleScan::Name& b) {
+                      return a.begin < b.begin;
+                  });
+        return std::move(scan_);
+    }
+
+private:
+    using Kind = ModuleScan::StatementKind;
+
+    enum class Frame : uint8_t { Block, Object, Class, Group };
+
+    struct Context {
+        Frame frame;
+        bool memberStart;  // at a property key or class member name
+        int conditional;   // `?` still waiting for their `:`
+    };
+
+    const TokenStream& ts;
+    ModuleScan scan_;
+    // Import and export-list statements, and the `export` keywords before
+    // declarations: their identifiers are not names in the module body.
+    std::vector<std::pair<size_t, size_t>> skipped_;
+
+    std::string word(size_t i) const { return std::string(ts[i].value); }
+    uint32_t endOf(size_t last) const { return last == 0 ? 0 : ts[last - 1].end; }
+
+    static bool opener(const TokenStream& stream, size_t i) {
+        const TokenType type = stream.type(i);
+        return type == TokenType::LeftParen || type == TokenType::LeftBracket ||
+            type == TokenType::LeftBrace;
+    }
+    static bool closer(const TokenStream& stream, size_t i) {
+        const TokenType type = stream.type(i);
+        return type == TokenType::RightParen || type == TokenType::RightBracket ||
+            type == TokenType::RightBrace;
+    }
+    static bool relative(std::string_view specifier) {
+        return specifier.rfind("./", 0) == 0 || specifier.rfind("../", 0) == 0;
+    }
+
+    void push(ModuleScan::Statement statement) {
+        scan_.statements.push_back(std::move(statement));
+    }
+
+    // ---- statements --------------------------------------------------------
+
+    bool declarationHead(size_t i) const {
+        switch (ts.type(i)) {
+            case TokenType::KeywordFunction:
+            case TokenType::KeywordClass:
+            case TokenType::KeywordVar:
+            case TokenType::KeywordConst:
+                return true;
+            case TokenType::KeywordLet:
+                return identifierLike(ts.type(i + 1)) ||
+                    ts.is(i + 1, TokenType::LeftBrace) ||
+                    ts.is(i + 1, TokenType::LeftBracket);
+            case TokenType::KeywordAsync:
+                return ts.is(i + 1, TokenType::KeywordFunction) &&
+                    !ts[i + 1].newlineBefore;
+            default:
+                return false;
+        }
+    }
+
+    bool statementHead(size_t i) const {
+        if (ts.is(i, TokenType::KeywordImport)) {
+            return !ts.is(i + 1, TokenType::LeftParen) && !ts.is(i + 1, TokenType::Dot);
+        }
+        return ts.is(i, TokenType::KeywordExport) || declarationHead(i);
+    }
+
+    bool atStatementStart(size_t i) const {
+        return i == 0 || ts.is(i - 1, TokenType::Semicolon) ||
+            ts.is(i - 1, TokenType::RightBrace) || ts.startsStatement(i);
+    }
+
+    size_t statement(size_t i) {
+        if (ts.is(i, TokenType::Semicolon)) return i + 1;
+        if (ts.is(i, TokenType::KeywordImport) && statementHead(i)) {
+            return importStatement(i);
+        }
+        if (ts.is(i, TokenType::KeywordExport)) return exportStatement(i);
+        if (declarationHead(i)) {
+            ModuleScan::Statement statement;
+            const size_t last = declaration(i, statement);
+            statement.begin = statement.code = ts[i].begin;
+            statement.end = endOf(last);
+            push(std::move(statement));
+            return last;
+        }
+        return otherStatement(i);
+    }
+
+    // Everything up to a `;` or the next import, export or declaration.
+    // Consecutive runs merge: they are always kept, and copying them as one
+    // range keeps `if`/`else` and similar pairs together.
+    size_t otherStatement(size_t i) {
+        size_t j = i;
+        while (j < ts.eof()) {
+            if (j > i && statementHead(j) && atStatementStart(j)) break;
+            if (ts.is(j, TokenType::Semicolon)) {
+                ++j;
+                break;
+            }
+            j = opener(ts, j) ? ts.after(j) : j + 1;
+        }
+        if (!scan_.statements.empty() &&
+            scan_.statements.back().kind == Kind::Other) {
+            scan_.statements.back().end = endOf(j);
+        } else {
+            ModuleScan::Statement statement;
+            statement.begin = statement.code = ts[i].begin;
+            statement.end = endOf(j);
+            push(std::move(statement));
+        }
+        return j;
+    }
+
+    // End of an expression starting at `i`: a `,`, `;` or closing bracket
+    // at its own depth, or a line break where a new statement begins.
+    size_t expressionEnd(size_t i) const {
+        size_t j = i;
+        while (j < ts.eof() && !ts.is(j, TokenType::Comma) &&
+               !ts.is(j, TokenType::Semicolon) && !closer(ts, j) &&
+               !(j > i && ts.startsStatement(j))) {
+            j = opener(ts, j) ? ts.after(j) : j + 1;
+        }
+        return j;
+    }
+
+    // Past the body of the function or class whose keyword is at `i`.
+    size_t bodyEnd(size_t i) const {
+        size_t j = i;
+        while (j < ts.eof() && !ts.is(j, TokenType::LeftBrace)) {
+            j = opener(ts, j) ? ts.after(j) : j + 1;
+        }
+        return ts.after(j);
+    }
+
+    bool bindingName(size_t i) const {
+        return identifierLike(ts.type(i)) && !ts.is(i, TokenType::KeywordExtends);
+    }
+
+    // A function, class or variable declaration at `i`: what it declares
+    // and whether evaluating it can have side effects.
+    size_t declaration(size_t i, ModuleScan::Statement& statement) {
+        statement.kind = Kind::Declaration;
+        const TokenType type = ts.type(i);
+        if (type == TokenType::KeywordFunction || type == TokenType::KeywordAsync) {
+            size_t j = i + (type == TokenType::KeywordAsync ? 2 : 1);
+            if (ts.is(j, TokenType::Star)) ++j;
+            if (bindingName(j)) statement.declares.push_back(word(j));
+            statement.pure = true;
+            return bodyEnd(i);
+        }
+        if (type == TokenType::KeywordClass) {
+            if (bindingName(i + 1)) statement.declares.push_back(word(i + 1));
+            statement.pure = classPure(i);
+            return bodyEnd(i);
+        }
+        statement.pure = true;
+        size_t j = i + 1;
+        for (;;) {
+            const size_t pattern = j;
+            j = bindingPattern(j, statement.declares);
+            if (j == pattern) break;
+            if (ts.is(j, TokenType::Equal)) {
+                const size_t stop = expressionEnd(j + 1);
+                statement.pure = statement.pure && pure(j + 1, stop);
+                j = stop;
+            }
+            if (!ts.is(j, TokenType::Comma)) break;
+            ++j;
+        }
+        return finishStatement(ts, j);
+    }
+
+    size_t bindingPattern(size_t i, std::vector<std::string>& names) const {
+        if (!ts.is(i, TokenType::LeftBrace) && !ts.is(i, TokenType::LeftBracket)) {
+            if (!identifierLike(ts.type(i))) return i;
+            names.push_back(word(i));
+            return i + 1;
+        }
+        const size_t close = ts.match(i);
+        if (close == npos) return i + 1;
+        const bool object = ts.is(i, TokenType::LeftBrace);
+        size_t j = i + 1;
+        while (j < close) {
+            if (ts.is(j, TokenType::Comma)) {
+                ++j;
+                continue;
+            }
+            if (ts.is(j, TokenType::DotDotDot)) {
+                j = bindingPattern(j + 1, names);
+            } else if (object) {
+                const size_t key = j;
+                j = ts.is(j, TokenType::LeftBracket) ? ts.after(j) : j + 1;
+                if (ts.is(j, TokenType::Colon)) {
+                    j = bindingPattern(j + 1, names);
+                } else if (identifierLike(ts.type(key))) {
+                    names.push_back(word(key));
+                }
+            } else {
+                j = bindingPattern(j, names);
+            }
+            if (ts.is(j, TokenType::Equal)) j = expressionEnd(j + 1);
+            while (j < close && !ts.is(j, TokenType::Comma)) {
+                j = opener(ts, j) ? ts.after(j) : j + 1;
+            }
+        }
+        return close + 1;
+    }
+
+    // `with { type: "json" }` after a module specifier.
+    size_t attributes(size_t j) const {
+        if ((ts.is(j, TokenType::KeywordWith) || ts.isWord(j, "assert")) &&
+            ts.is(j + 1, TokenType::LeftBrace) && !ts[j].newlineBefore) {
+            return ts.after(j + 1);
+        }
+        return j;
+    }
+
+    size_t importStatement(size_t i) {
+        size_t j = i + 1;
+        std::vector<ModuleScan::Import> bindings;
+        if (!ts.is(j, TokenType::StringLiteral)) {
+            if (identifierLike(ts.type(j))) {
+                bindings.push_back({"", "default", word(j)});
+                ++j;
+                if (ts.is(j, TokenType::Comma)) ++j;
+            }
+            if (ts.is(j, TokenType::Star)) {
+                if (ts.is(j + 1, TokenType::KeywordAs)) {
+                    bindings.push_back({"", "*", word(j + 2)});
+                }
+                j += 3;
+            } else if (ts.is(j, TokenType::LeftBrace) && ts.match(j) != npos) {
+                const size_t close = ts.match(j);
+                for (size_t k = j + 1; k < close;) {
+                    if (ts.is(k, TokenType::Comma)) {
+                        ++k;
+                        continue;
+                    }
+                    std::string imported = word(k);
+                    std::string local = imported;
+                    ++k;
+                    if (ts.is(k, TokenType::KeywordAs)) {
+                        local = word(k + 1);
+                        k += 2;
+                    }
+                    bindings.push_back({"", std::move(imported), std::move(local)});
+                }
+                j = close + 1;
+            }
+            if (ts.is(j, TokenType::KeywordFrom)) ++j;
+        }
+        std::string specifier;
+        if (ts.is(j, TokenType::StringLiteral)) specifier = word(j++);
+        j = finishStatement(ts, attributes(j));
+
+        scan_.requests.push_back(specifier);
+        if (bindings.empty()) scan_.imports.push_back({specifier, "", ""});
+        for (ModuleScan::Import& binding : bindings) {
+            binding.specifier = specifier;
+            scan_.imports.push_back(std::move(binding));
+        }
+        ModuleScan::Statement statement;
+        statement.kind = Kind::Import;
+        statement.begin = statement.code = ts[i].begin;
+        statement.end = endOf(j);
+        push(std::move(statement));
+        skipped_.emplace_back(i, j);
+        return j;
+    }
+
+    size_t exportStatement(size_t i) {
+        size_t j = i + 1;
+        ModuleScan::Statement statement;
+        statement.begin = ts[i].begin;
+
+        if (ts.is(j, TokenType::Star) ||
+            (ts.is(j, TokenType::LeftBrace) && ts.match(j) != npos)) {
+            std::vector<ModuleScan::Export> names;
+            if (ts.is(j, TokenType::Star)) {
+                std::string exported = "*";
+                ++j;
+                if (ts.is(j, TokenType::KeywordAs)) {
+                    exported = word(j + 1);
+                    j += 2;
+                }
+                names.push_back({exported, "*", ""});
+            } else {
+                const size_t close = ts.match(j);
+                for (size_t k = j + 1; k < close;) {
+                    if (ts.is(k, TokenType::Comma)) {
+                        ++k;
+                        continue;
+                    }
+                    std::string local = word(k);
+                    std::string exported = local;
+                    ++k;
+                    if (ts.is(k, TokenType::KeywordAs)) {
+                        exported = word(k + 1);
+                        k += 2;
+                    }
+                    names.push_back({std::move(exported), std::move(local), ""});
+                }
+                j = close + 1;
+            }
+            if (ts.is(j, TokenType::KeywordFrom) && ts.is(j + 1, TokenType::StringLiteral)) {
+                const std::string from = word(j + 1);
+                for (ModuleScan::Export& name : names) name.from = from;
+                scan_.requests.push_back(from);
+                j = attributes(j + 2);
+            }
+            j = finishStatement(ts, j);
+            for (ModuleScan::Export& name : names) scan_.exports.push_back(std::move(name));
+            statement.kind = Kind::Export;
+            statement.code = statement.begin;
+            statement.end = endOf(j);
+            push(std::move(statement));
+            skipped_.emplace_back(i, j);
+            return j;
+        }
+
+        if (ts.is(j, TokenType::KeywordDefault)) {
+            const size_t k = j + 1;
+            statement.code = ts[k].begin;
+            const bool function = ts.is(k, TokenType::KeywordFunction) ||
+                (ts.is(k, TokenType::KeywordAsync) &&
+                 ts.is(k + 1, TokenType::KeywordFunction) && !ts[k + 1].newlineBefore);
+            size_t last;
+            if (function || ts.is(k, TokenType::KeywordClass)) {
+                last = declaration(k, statement);
+                if (statement.declares.empty()) {
+                    size_t keyword = ts.is(k, TokenType::KeywordAsync) ? k + 1 : k;
+                    if (function && ts.is(keyword + 1, TokenType::Star)) ++keyword;
+                    statement.anonymous = ts[keyword].end;
+                    statement.declares.push_back(kDefaultExportLocal);
+                }
+            } else {
+                statement.kind = Kind::Declaration;
+                last = expressionEnd(k);
+                statement.pure = pure(k, last);
+                statement.defaultExpression = true;
+                statement.declares.push_back(kDefaultExportLocal);
+                last = finishStatement(ts, last);
+            }
+            scan_.exports.push_back({"default", statement.declares.front(), ""});
+            statement.end = endOf(last);
+            push(std::move(statement));
+            skipped_.emplace_back(i, k);
+            return last;
+        }
+
+        if (declarationHead(j)) {
+            statement.code = ts[j].begin;
+            const size_t last = declaration(j, statement);
+            for (const std::string& name : statement.declares) {
+                scan_.exports.push_back({name, name, ""});
+            }
+            statement.end = endOf(last);
+            push(std::move(statement));
+            skipped_.emplace_back(i, j);
+            return last;
+        }
+        return otherStatement(i);
+    }
+
+    // ---- side effects ------------------------------------------------------
+
+    // Whether evaluating tokens [first, last) can be observed. Function
+    // bodies are not evaluated; calls, `new`, assignments, updates,
+    // spreads (iterators and getters) and substitutions in templates
+    // (toString) all count as effects.
+    bool pure(size_t first, size_t last) const {
+        for (size_t k = first; k < last; ++k) {
+            const TokenType type = ts.type(k);
+            if (type >= TokenType::Equal && type <= TokenType::QuestionQuestionEqual) {
+                return false;
+            }
+            switch (type) {
+                case TokenType::KeywordFunction:
+                    k = bodyEnd(k) - 1;
+                    break;
+                case TokenType::KeywordClass:
+                    if (!classPure(k)) return false;
+                    k = bodyEnd(k) - 1;
+                    break;
+                case TokenType::Arrow:
+                    k = (ts.is(k + 1, TokenType::LeftBrace) ? ts.after(k + 1)
+                                                             : conciseEnd(k + 1, last)) - 1;
+                    break;
+                case TokenType::LeftParen: {
+                    const size_t close = ts.match(k);
+                    if (close == npos) return false;
+                    if (ts.is(close + 1, TokenType::Arrow)) {
+                        k = close;  // parameters
+                    } else if (ts.is(close + 1, TokenType::LeftBrace)) {
+                        k = ts.after(close + 1) - 1;  // object literal method
+                    } else if (k > first && ts.expressionEnd(k - 1) &&
+                               !ts.is(k - 1, TokenType::KeywordAsync)) {
+                        return false;
+                    }
+                    break;
+                }
+                case TokenType::TemplateLiteral:
+                    if (k > first && ts.expressionEnd(k - 1)) return false;
+                    if (ts.source.find("${", ts[k].begin) < ts[k].end) return false;
+                    break;
+                case TokenType::KeywordNew:
+                case TokenType::KeywordDelete:
+                case TokenType::KeywordAwait:
+                case TokenType::KeywordYield:
+                case TokenType::KeywordImport:
+                case TokenType::KeywordSuper:
+                case TokenType::PlusPlus:
+                case TokenType::MinusMinus:
+                case TokenType::DotDotDot:
+                    return false;
+                default:
+                    break;
+            }
+        }
+        return true;
+    }
+
+    size_t conciseEnd(size_t i, size_t last) const {
+        size_t j = i;
+        while (j < last && !ts.is(j, TokenType::Comma) &&
+               !ts.is(j, TokenType::Semicolon) && !closer(ts, j)) {
+            j = opener(ts, j) ? ts.after(j) : j + 1;
+        }
+        return j;
+    }
+
+    // A class definition runs its heritage expression, computed keys,
+    // static initializers and decorators; instance fields and methods wait.
+    bool classPure(size_t i) const {
+        size_t j = i + 1;
+        if (bindingName(j)) ++j;
+        if (ts.is(j, TokenType::KeywordExtends)) {
+            for (++j; j < ts.eof() && !ts.is(j, TokenType::LeftBrace); ++j) {
+                if (!identifierLike(ts.type(j)) && !ts.is(j, TokenType::Dot)) return false;
+            }
+        }
+        const size_t close = ts.match(j);
+        if (!ts.is(j, TokenType::LeftBrace) || close == npos) return false;
+        for (size_t k = j + 1; k < close;) {
+            const TokenType type = ts.type(k);
+            if (type == TokenType::At) return false;
+            if (type == TokenType::LeftBracket) {
+                if (!pure(k + 1, ts.match(k))) return false;
+            } else if (type == TokenType::KeywordStatic) {
+                size_t m = k + 1;
+                if (ts.is(m, TokenType::LeftBrace)) return false;
+                while ((ts.is(m, TokenType::KeywordGet) || ts.is(m, TokenType::KeywordSet) ||
+                        ts.is(m, TokenType::KeywordAsync) || ts.is(m, TokenType::Star)) &&
+                       !ts.is(m + 1, TokenType::LeftParen)) {
+                    ++m;
+                }
+                if (ts.is(m, TokenType::Hash)) ++m;
+                m = ts.is(m, TokenType::LeftBracket) ? ts.after(m) : m + 1;
+                if (ts.is(m, TokenType::Equal)) return false;
+            }
+            k = opener(ts, k) ? ts.after(k) : k + 1;
+        }
+        return true;
+    }
+
+    // ---- names -------------------------------------------------------------
+
+    // Records every identifier of `stream` that names a binding. `base` is
+    // the stream's offset in the module: template substitutions are lexed
+    // on their own and walked as expressions.
+    void walk(const TokenStream& stream, uint32_t base, bool expression) {
+        std::vector<Context> stack{{expression ? Frame::Group : Frame::Block, false, 0}};
+        std::vector<size_t> classes;  // depths of `class` keywords awaiting a body
+        bool colonExpression = false;
+        size_t skip = 0;
+        for (size_t i = 0; i < stream.eof(); ++i) {
+            if (&stream == &ts) {
+                while (skip < skipped_.size() && skipped_[skip].second <= i) ++skip;
+                if (skip < skipped_.size() && skipped_[skip].first <= i) {
+                    i = skipped_[skip].second - 1;
+                    continue;
+                }
+            }
+            const Tok& token = stream[i];
+            const TokenType type = token.type;
+            Context& top = stack.back();
+            // A class field without a semicolon ends at the line break.
+            if (top.frame == Frame::Class && !top.memberStart && token.newlineBefore &&
+                i > 0 && stream.expressionEnd(i - 1) &&
+                (identifierLike(type) || type == TokenType::StringLiteral ||
+                 type == TokenType::NumberLiteral || type == TokenType::LeftBracket ||
+                 type == TokenType::Star || type == TokenType::Hash)) {
+                top.memberStart = true;
+            }
+            switch (type) {
+                case TokenType::LeftBrace: {
+                    const Frame frame = braceFrame(stream, i, stack, classes, colonExpression);
+                    stack.push_back({frame, frame != Frame::Block, 0});
+                    continue;
+                }
+                case TokenType::LeftParen:
+                case TokenType::LeftBracket:
+                    top.memberStart = false;
+                    stack.push_back({Frame::Group, false, 0});
+                    continue;
+                case TokenType::RightParen:
+                case TokenType::RightBracket:
+                case TokenType::RightBrace:
+                    if (stack.size() > 1) stack.pop_back();
+                    if (type == TokenType::RightBrace && stack.back().frame == Frame::Class) {
+                        stack.back().memberStart = true;
+                    }
+                    continue;
+                case TokenType::Comma:
+                    if (top.frame == Frame::Object) top.memberStart = true;
+                    continue;
+                case TokenType::Semicolon:
+                    if (top.frame == Frame::Class) top.memberStart = true;
+                    continue;
+                case TokenType::Question:
+                    ++top.conditional;
+                    continue;
+                case TokenType::Colon:
+                    if (top.conditional > 0) {
+                        --top.conditional;
+                        colonExpression = true;
+                    } else {
+                        colonExpression = top.frame != Frame::Block;
+                    }
+                    continue;
+                case TokenType::TemplateLiteral:
+                    substitutions(stream, i, base);
+                    continue;
+                case TokenType::KeywordClass:
+                    classes.push_back(stack.size());
+                    continue;
+                case TokenType::Hash:
+                case TokenType::Dot:
+                case TokenType::QuestionDot:
+                    // `#private`, `.property`: never a binding.
+                    if (identifierLike(stream.type(i + 1))) ++i;
+                    top.memberStart = false;
+                    continue;
+                case TokenType::DotDotDot:
+                case TokenType::StringLiteral:
+                case TokenType::NumberLiteral:
+                    top.memberStart = false;
+                    continue;
+                case TokenType::KeywordImport:
+                    if (stream.is(i + 1, TokenType::LeftParen) &&
+                        stream.is(i + 2, TokenType::StringLiteral) &&
+                        relative(stream[i + 2].value)) {
+                        scan_.warnings.push_back(
+                            "dynamic import(\"" + std::string(stream[i + 2].value) +
+                            "\") is not bundled");
+                    }
+                    continue;
+                default:
+                    break;
+            }
+            if (!identifierLike(type)) continue;
+
+            if ((top.frame == Frame::Object || top.frame == Frame::Class) && top.memberStart) {
+                if (modifier(stream, i, top.frame)) continue;
+                top.memberStart = false;
+                if (top.frame == Frame::Class) continue;
+                const TokenType next = stream.type(i + 1);
+                if (next == TokenType::Colon || next == TokenType::LeftParen) continue;
+                if (nameToken(stream, i)) record(stream, i, base, true);
+                continue;
+            }
+            if (nameToken(stream, i)) record(stream, i, base, false);
+        }
+    }
+
+    // Which kind of braces open at `i`.
+    static Frame braceFrame(const TokenStream& stream, size_t i,
+                            const std::vector<Context>& stack,
+                            std::vector<size_t>& classes, bool colonExpression) {
+        if (!classes.empty() && classes.back() == stack.size()) {
+            classes.pop_back();
+            return Frame::Class;
+        }
+        if (i == 0) {
+            return stack.back().frame == Frame::Group ? Frame::Object : Frame::Block;
+        }
+        const TokenType previous = stream.type(i - 1);
+        switch (previous) {
+            case TokenType::RightParen:
+            case TokenType::Arrow:
+            case TokenType::Semicolon:
+            case TokenType::LeftBrace:
+            case TokenType::RightBrace:
+                return Frame::Block;
+            case TokenType::Colon:
+                return colonExpression ? Frame::Object : Frame::Block;
+            case TokenType::KeywordReturn:
+            case TokenType::KeywordTypeof:
+            case TokenType::KeywordVoid:
+            case TokenType::KeywordDelete:
+            case TokenType::KeywordIn:
+            case TokenType::KeywordOf:
+            case TokenType::KeywordInstanceof:
+            case TokenType::KeywordNew:
+            case TokenType::KeywordYield:
+            case TokenType::KeywordAwait:
+            case TokenType::KeywordCase:
+            case TokenType::KeywordThrow:
+            case TokenType::KeywordDefault:
+            case TokenType::KeywordExtends:
+            case TokenType::KeywordConst:   // destructuring patterns
+            case TokenType::KeywordLet:
+            case TokenType::KeywordVar:
+                return Frame::Object;
+            default:
+                break;
+        }
+        if (identifierLike(previous) || isLiteral(previous) ||
+            previous == TokenType::RightBracket) {
+            return Frame::Block;  // `else {`, `try {`, or after a line break
+        }
+        return Frame::Object;
+    }
+
+    // `get`/`set`/`async`/`static` before a property or member name.
+    static bool modifier(const TokenStream& stream, size_t i, Frame frame) {
+        switch (stream.type(i)) {
+            case TokenType::KeywordGet:
+            case TokenType::KeywordSet:
+            case TokenType::KeywordAsync:
+                break;
+            case TokenType::KeywordStatic:
+                if (frame != Frame::Class) return false;
+                if (stream.is(i + 1, TokenType::LeftBrace)) return true;
+                break;
+            case TokenType::Identifier:
+                if (frame != Frame::Class || stream[i].value != "accessor") return false;
+                break;
+            default:
+                return false;
+        }
+        if (stream[i + 1].newlineBefore) return false;
+        const TokenType next = stream.type(i + 1);
+        return identifierLike(next) || next == TokenType::StringLiteral ||
+            next == TokenType::NumberLiteral || next == TokenType::LeftBracket ||
+            next == TokenType::Star || next == TokenType::Hash;
+    }
+
+    // Identifiers, and contextual keywords where they are not acting as
+    // keywords. Reserved words never name bindings in module code.
+    static bool nameToken(const TokenStream& stream, size_t i) {
+        const TokenType next = stream.type(i + 1);
+        switch (stream.type(i)) {
+            case TokenType::Identifier:
+                return true;
+            case TokenType::KeywordAsync:
+                if (stream[i + 1].newlineBefore) return true;
+                if (next == TokenType::KeywordFunction) return false;
+                if (identifierLike(next) && stream.is(i + 2, TokenType::Arrow)) return false;
+                return !(next == TokenType::LeftParen &&
+                         stream.is(stream.after(i + 1), TokenType::Arrow));
+            case TokenType::KeywordOf:
+                return !(i > 0 && stream.expressionEnd(i - 1));
+            case TokenType::KeywordUsing:
+                return !(identifierLike(next) && !stream[i + 1].newlineBefore);
+            case TokenType::KeywordFrom:
+            case TokenType::KeywordAs:
+            case TokenType::KeywordType:
+            case TokenType::KeywordNamespace:
+            case TokenType::KeywordDeclare:
+            case TokenType::KeywordAbstract:
+            case TokenType::KeywordReadonly:
+            case TokenType::KeywordGet:
+            case TokenType::KeywordSet:
+            case TokenType::KeywordOverride:
+            case TokenType::KeywordSatisfies:
+            case TokenType::KeywordKeyof:
+            case TokenType::KeywordInfer:
+            case TokenType::KeywordIs:
+            case TokenType::KeywordAsserts:
+            case TokenType::KeywordUnique:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    void record(const TokenStream& stream, size_t i, uint32_t base, bool shorthand) {
+        ModuleScan::Name name;
+        name.begin = base + stream[i].begin;
+        name.end = base + stream[i].end;
+        name.shorthand = shorthand;
+        if (!shorthand && stream.is(i + 1, TokenType::Dot) &&
+            identifierLike(stream.type(i + 2))) {
+            name.member = std::string(stream[i + 2].value);
+            name.memberEnd = base + stream[i + 2].end;
+        }
+        if (stream[i].value == "require" && stream.is(i + 1, TokenType::LeftParen) &&
+            stream.is(i + 2, TokenType::StringLiteral) && relative(stream[i + 2].value)) {
+            scan_.warnings.push_back("require(\"" + std::string(stream[i + 2].value) +
+                                     "\") is left to the runtime");
+        }
+        scan_.names.push_back(std::move(name));
+    }
+
+    void substitutions(const TokenStream& stream, size_t i, uint32_t base) {
+        const Tok& token = stream[i];
+        const std::string& source = stream.source;
+        if (token.end - token.begin < 2) return;
+        const size_t last = token.end - 1;
+        for (size_t p = token.begin + 1; p < last;) {
+            if (source[p] == '\\') {
+                p += 2;
+                continue;
+            }
+            if (source[p] == '$' && p + 1 < last && source[p + 1] == '{') {
+                const size_t close = JSXParser(source).containerEnd(p + 1);
+                if (close == npos || close >= last) return;
+                const std::string code = source.substr(p + 2, close - p - 2);
+                TokenStream nested(code, "fragment.js");
+                walk(nested, base + static_cast<uint32_t>(p + 2), true);
+                p = close + 1;
+                continue;
+            }
+            ++p;
+        }
+    }
+};
+
+} // namespace
+
+SourceRewriter::SourceRewriter(const std::string& source, const std::string& filename)
+    : source_(source), filename_(filename),
+      tokens_(std::make_unique<TokenStream>(source, filename)) {}
+
+SourceRewriter::~SourceRewriter() = default;
+
+EmitResult SourceRewriter::emitJavaScript(const EmitOptions& options) const {
+    JavaScriptEmitter emitter(*tokens_, options);
+    emitter.emitModule();
+    Printer printer(*tokens_, options, options.sourceMap, false);
+    EmitResult result;
+    result.code = printer.print(emitter.edits,
+                                options.sourceMap ? &result.mappings : nullptr);
+    result.usesJSXRuntime = emitter.usesJSXRuntime;
+    result.imports = std::move(emitter.imports);
+    return result;
+}
+
+EmitResult SourceRewriter::emitDeclarations() const {
+    return DeclarationEmitter(*tokens_).emit();
+}
+
+ModuleScan SourceRewriter::scanModule() const {
+    return ModuleScanner(*tokens_).scan();
+}
+
+} // namespace transpiler
+} // namespace nova
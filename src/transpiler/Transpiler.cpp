@@ -7,9 +7,16 @@
 #include <cctype>
 #include <iostream>
 #include <thread>
-#include <future>
+#include <atomic>
 #include <iomanip>
 
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <poll.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
+
 namespace nova {
 namespace transpiler {
 
@@ -84,300 +91,6 @@ namespace {
         }
         return output;
     }
-
-    class JSXTransformer {
-    public:
-        JSXTransformer(const std::string& source, std::string factory,
-                       std::string fragment, bool automatic)
-            : source_(source), factory_(std::move(factory)),
-              fragment_(std::move(fragment)), automatic_(automatic) {}
-
-        std::string transform(bool& changed) {
-            std::string output;
-            for (size_t position = 0; position < source_.size();) {
-                std::string element;
-                size_t end = position;
-                if (source_[position] == '<' &&
-                    parseElement(position, end, element)) {
-                    output += element;
-                    position = end;
-                    changed = true;
-                } else {
-                    output += source_[position++];
-                }
-            }
-            return output;
-        }
-
-    private:
-        const std::string& source_;
-        std::string factory_;
-        std::string fragment_;
-        bool automatic_;
-
-        static void skipSpace(const std::string& source, size_t& position) {
-            while (position < source.size() &&
-                   std::isspace(static_cast<unsigned char>(
-                       source[position])) != 0) {
-                ++position;
-            }
-        }
-
-        static std::string quote(const std::string& text) {
-            std::string result = "\"";
-            for (char character : text) {
-                if (character == '\\' || character == '"') result += '\\';
-                if (character == '\n' || character == '\r') {
-                    result += ' ';
-                } else {
-                    result += character;
-                }
-            }
-            result += '"';
-            return result;
-        }
-
-        bool parseBraced(size_t start, size_t& end,
-                         std::string& expression) const {
-            if (start >= source_.size() || source_[start] != '{') return false;
-            int depth = 1;
-            char stringQuote = '\0';
-            for (size_t position = start + 1; position < source_.size();
-                 ++position) {
-                const char character = source_[position];
-                if (stringQuote != '\0') {
-                    if (character == '\\') {
-                        ++position;
-                    } else if (character == stringQuote) {
-                        stringQuote = '\0';
-                    }
-                    continue;
-                }
-                if (character == '\'' || character == '"' ||
-                    character == '`') {
-                    stringQuote = character;
-                } else if (character == '{') {
-                    ++depth;
-                } else if (character == '}' && --depth == 0) {
-                    expression =
-                        source_.substr(start + 1, position - start - 1);
-                    end = position + 1;
-                    return true;
-                }
-            }
-            return false;
-        }
-
-        bool parseElement(size_t start, size_t& end,
-                          std::string& output) const {
-            if (start >= source_.size() || source_[start] != '<' ||
-                start + 1 >= source_.size() || source_[start + 1] == '/') {
-                return false;
-            }
-            size_t position = start + 1;
-            bool fragment = source_[position] == '>';
-            std::string tag;
-            if (fragment) {
-                ++position;
-            } else {
-                if (!(std::isalpha(static_cast<unsigned char>(
-                          source_[position])) != 0 ||
-                      source_[position] == '_' ||
-                      source_[position] == '$')) {
-                    return false;
-                }
-                const size_t tagStart = position;
-                while (position < source_.size() &&
-                       (std::isalnum(static_cast<unsigned char>(
-                            source_[position])) != 0 ||
-                        source_[position] == '_' ||
-                        source_[position] == '$' ||
-                        source_[position] == '.' ||
-                        source_[position] == '-' ||
-                        source_[position] == ':')) {
-                    ++position;
-                }
-                tag = source_.substr(tagStart, position - tagStart);
-            }
-
-            std::vector<std::string> properties;
-            bool selfClosing = false;
-            if (!fragment) {
-                while (position < source_.size()) {
-                    skipSpace(source_, position);
-                    if (source_.compare(position, 2, "/>") == 0) {
-                        position += 2;
-                        selfClosing = true;
-                        break;
-                    }
-                    if (position < source_.size() &&
-                        source_[position] == '>') {
-                        ++position;
-                        break;
-                    }
-                    if (position < source_.size() &&
-                        source_[position] == '{') {
-                        size_t braceEnd = position;
-                        std::string spread;
-                        if (!parseBraced(position, braceEnd, spread) ||
-                            spread.rfind("...", 0) != 0) {
-                            return false;
-                        }
-                        properties.push_back(spread);
-                        position = braceEnd;
-                        continue;
-                    }
-                    const size_t nameStart = position;
-                    while (position < source_.size() &&
-                           (std::isalnum(static_cast<unsigned char>(
-                                source_[position])) != 0 ||
-                            source_[position] == '_' ||
-                            source_[position] == '$' ||
-                            source_[position] == '-')) {
-                        ++position;
-                    }
-                    if (position == nameStart) return false;
-                    std::string name =
-                        source_.substr(nameStart, position - nameStart);
-                    skipSpace(source_, position);
-                    std::string value = "true";
-                    if (position < source_.size() &&
-                        source_[position] == '=') {
-                        ++position;
-                        skipSpace(source_, position);
-                        if (position >= source_.size()) return false;
-                        if (source_[position] == '"' ||
-                            source_[position] == '\'') {
-                            const char delimiter = source_[position++];
-                            const size_t valueStart = position;
-                            while (position < source_.size() &&
-                                   source_[position] != delimiter) {
-                                if (source_[position] == '\\') ++position;
-                                ++position;
-                            }
-                            if (position >= source_.size()) return false;
-                            value = quote(source_.substr(
-                                valueStart, position - valueStart));
-                            ++position;
-                        } else if (source_[position] == '{') {
-                            size_t braceEnd = position;
-                            if (!parseBraced(position, braceEnd, value)) {
-                                return false;
-                            }
-                            position = braceEnd;
-                        } else {
-                            const size_t valueStart = position;
-                            while (position < source_.size() &&
-                                   std::isspace(static_cast<unsigned char>(
-                                       source_[position])) == 0 &&
-                                   source_[position] != '>' &&
-                                   source_[position] != '/') {
-                                ++position;
-                            }
-                            value = source_.substr(
-                                valueStart, position - valueStart);
-                        }
-                    }
-                    properties.push_back(name + ": " + value);
-                }
-            }
-
-            std::vector<std::string> children;
-            if (!selfClosing) {
-                while (position < source_.size()) {
-                    if ((fragment &&
-                         source_.compare(position, 3, "</>") == 0) ||
-                        (!fragment &&
-                         source_.compare(position, tag.size() + 3,
-                             "</" + tag + ">") == 0)) {
-                        position += fragment ? 3 : tag.size() + 3;
-                        break;
-                    }
-                    if (source_[position] == '<') {
-                        size_t childEnd = position;
-                        std::string child;
-                        if (!parseElement(position, childEnd, child)) {
-                            return false;
-                        }
-                        children.push_back(child);
-                        position = childEnd;
-                    } else if (source_[position] == '{') {
-                        size_t braceEnd = position;
-                        std::string expression;
-                        if (!parseBraced(position, braceEnd, expression)) {
-                            return false;
-                        }
-                        if (expression.find_first_not_of(" \t\r\n") !=
-                            std::string::npos) {
-                            children.push_back(expression);
-                        }
-                        position = braceEnd;
-                    } else {
-                        const size_t textStart = position;
-                        while (position < source_.size() &&
-                               source_[position] != '<' &&
-                               source_[position] != '{') {
-                            ++position;
-                        }
-                        std::string text = source_.substr(
-                            textStart, position - textStart);
-                        const size_t first = text.find_first_not_of(" \t\r\n");
-                        const size_t last = text.find_last_not_of(" \t\r\n");
-                        if (first != std::string::npos) {
-                            children.push_back(
-                                quote(text.substr(first, last - first + 1)));
-                        }
-                    }
-                }
-            }
-
-            const std::string elementType = fragment
-                ? fragment_
-                : (std::islower(static_cast<unsigned char>(tag[0])) != 0
-                    ? quote(tag) : tag);
-            if (automatic_) {
-                if (!children.empty()) {
-                    std::string childValue;
-                    if (children.size() == 1) {
-                        childValue = children.front();
-                    } else {
-                        childValue = "[";
-                        for (size_t index = 0; index < children.size();
-                             ++index) {
-                            if (index) childValue += ", ";
-                            childValue += children[index];
-                        }
-                        childValue += "]";
-                    }
-                    properties.push_back("children: " + childValue);
-                }
-                std::string props = "{";
-                for (size_t index = 0; index < properties.size(); ++index) {
-                    if (index) props += ", ";
-                    props += properties[index];
-                }
-                props += "}";
-                output = (children.size() > 1 ? "_jsxs" : factory_) +
-                    "(" + elementType + ", " + props + ")";
-            } else {
-                std::string props = properties.empty() ? "null" : "{";
-                if (!properties.empty()) {
-                    for (size_t index = 0; index < properties.size(); ++index) {
-                        if (index) props += ", ";
-                        props += properties[index];
-                    }
-                    props += "}";
-                }
-                output = factory_ + "(" + elementType + ", " + props;
-                for (const std::string& child : children) {
-                    output += ", " + child;
-                }
-                output += ")";
-            }
-            end = position;
-            return true;
-        }
-    };
 }
 
 Transpiler::Transpiler() {
@@ -399,6 +112,7 @@ Transpiler::~Transpiler() = default;
 
 bool Transpiler::loadConfig(const std::string& configPath) {
     std::set<std::string> visited;
+    bundleCache_.reset();
     return loadConfigRecursive(configPath, visited);
 }
 
@@ -583,6 +297,7 @@ void Transpiler::mergeConfig(const TSConfig& other) {
 
 void Transpiler::setOptions(const CompilerOptions& options) {
     config_.compilerOptions = options;
+    bundleCache_.reset();
 }
 
 // ============================================================================
@@ -628,34 +343,39 @@ TranspileResult Transpiler::transpileString(const std::string& content, const st
     result.success = true;
 
     try {
+        const auto& opts = config_.compilerOptions;
+
         // Check if noEmit
-        if (config_.compilerOptions.noEmit) {
+        if (opts.noEmit) {
             result.jsCode = "";
             result.outputSize = 0;
             return result;
         }
 
-        // Transform TypeScript to JavaScript
-        std::string jsCode = transformTypeScript(content, filename);
-
-        // Minify if requested
-        if (config_.compilerOptions.minify) {
-            jsCode = minifyCode(jsCode);
-        }
+        // Lex once; JavaScript, declarations and both source maps are all
+        // printed from the same token stream.
+        SourceRewriter rewriter(content, filename);
+        EmitResult emitted = transformTypeScript(rewriter, filename);
 
         // Check emitDeclarationOnly
-        if (!config_.compilerOptions.emitDeclarationOnly) {
-            result.jsCode = jsCode;
+        if (!opts.emitDeclarationOnly) {
+            result.jsCode = emitted.code;
+        }
+        result.outputSize = emitted.code.size();
+        for (const std::string& specifier : emitted.imports) {
+            std::string resolved = resolveImport(specifier, filename);
+            if (!resolved.empty()) result.imports.push_back(std::move(resolved));
         }
-        result.outputSize = jsCode.size();
 
         // Generate declaration file if requested
-        if (config_.compilerOptions.declaration) {
-            result.dtsCode = generateDeclaration(content);
+        if (opts.declaration) {
+            EmitResult declarations = rewriter.emitDeclarations();
+            result.dtsCode = std::move(declarations.code);
 
             // Generate declaration map if requested
-            if (config_.compilerOptions.declarationMap && !result.dtsCode.empty()) {
-                result.declarationMap = generateDeclarationMap(content, result.dtsCode, filename);
+            if (opts.declarationMap && !result.dtsCode.empty()) {
+                result.declarationMap =
+                    generateDeclarationMap(declarations.mappings, filename);
                 result.dtsCode += "\n//# sourceMappingURL=" +
                     std::filesystem::path(filename).stem().string() +
                     ".d.ts.map\n";
@@ -663,15 +383,15 @@ TranspileResult Transpiler::transpileString(const std::string& content, const st
         }
 
         // Generate source map if requested
-        if (config_.compilerOptions.sourceMap && !config_.compilerOptions.inlineSourceMap) {
-            result.sourceMap = generateSourceMap(content, jsCode, filename);
+        if (opts.sourceMap && !opts.inlineSourceMap) {
+            result.sourceMap = generateSourceMap(content, emitted.mappings, filename);
             if (!result.jsCode.empty()) {
                 result.jsCode += "\n//# sourceMappingURL=" +
                     std::filesystem::path(filename).stem().string() +
                     ".js.map\n";
             }
-        } else if (config_.compilerOptions.inlineSourceMap) {
-            std::string sourceMapData = generateSourceMap(content, jsCode, filename);
+        } else if (opts.inlineSourceMap) {
+            std::string sourceMapData = generateSourceMap(content, emitted.mappings, filename);
             // Base64 encode and append to jsCode
             result.jsCode += "\n//# sourceMappingURL=data:application/json;base64," + base64Encode(sourceMapData);
         }
@@ -687,575 +407,167 @@ TranspileResult Transpiler::transpileString(const std::string& content, const st
     return result;
 }
 
-std::string Transpiler::transformTypeScript(const std::string& source, const std::string& filename) {
-    std::string result = source;
-
-    // Step 1: Remove TypeScript-only syntax before injecting JSX runtime
-    // imports so import aliases are not mistaken for `as` assertions.
-    result = removeTypeAnnotations(result);
-
-    // Step 2: Transform JSX if needed
-    bool isTsx = filename.size() > 4 && filename.substr(filename.size() - 4) == ".tsx";
-    bool isJsx = filename.size() > 4 && filename.substr(filename.size() - 4) == ".jsx";
-    if ((isTsx || isJsx) && !config_.compilerOptions.jsx.empty()) {
-        result = transformJSX(result);
-    }
-
-    // Step 3: Transform path aliases
-    if (!config_.compilerOptions.paths.empty() ||
-        !config_.compilerOptions.baseUrl.empty() ||
-        config_.compilerOptions.rewriteRelativeImportExtensions) {
-        result = transformPaths(result, filename);
-    }
-
-    // Step 4: Transform imports based on module type
-    result = transformImports(result);
-
-    // Step 5: Transform exports based on module type
-    result = transformExports(result);
-
-    // Step 6: Downlevel to target if needed
-    if (config_.compilerOptions.target == "es5" || config_.compilerOptions.target == "es3") {
-        result = downlevelToTarget(result);
-    }
-
-    // Step 7: Remove comments if configured
-    if (config_.compilerOptions.removeComments) {
-        // Protect URLs by temporarily replacing them
-        std::string urlPlaceholder = "__URL_PLACEHOLDER_";
-        std::vector<std::string> urls;
-        std::regex urlRegex("(https?://[^\\s\"'<>]+)");
-        std::smatch urlMatch;
-        std::string tempResult = result;
-        while (std::regex_search(tempResult, urlMatch, urlRegex)) {
-            urls.push_back(urlMatch[1].str());
-            tempResult = urlMatch.suffix().str();
-        }
-        for (size_t i = 0; i < urls.size(); i++) {
-            size_t pos = result.find(urls[i]);
-            if (pos != std::string::npos) {
-                result.replace(pos, urls[i].size(), urlPlaceholder + std::to_string(i) + "__");
-            }
-        }
-
-        // Remove single-line comments
-        result = std::regex_replace(result, std::regex("//[^\n]*"), "");
-        // Remove multi-line comments
-        result = std::regex_replace(result, std::regex("/\\*[\\s\\S]*?\\*/"), "");
-
-        // Restore URLs
-        for (size_t i = 0; i < urls.size(); i++) {
-            std::string placeholder = urlPlaceholder + std::to_string(i) + "__";
-            size_t pos = result.find(placeholder);
-            if (pos != std::string::npos) {
-                result.replace(pos, placeholder.size(), urls[i]);
-            }
-        }
-    }
-
-    // Step 8: Clean up extra whitespace
-    result = std::regex_replace(result, std::regex("\n\\s*\n\\s*\n"), "\n\n");
-
-    // Step 9: Add "use strict" if alwaysStrict is enabled
-    if (config_.compilerOptions.alwaysStrict || config_.compilerOptions.strict) {
-        // Check if "use strict" is not already present
-        if (result.find("\"use strict\"") == std::string::npos &&
-            result.find("'use strict'") == std::string::npos) {
-            result = "\"use strict\";\n" + result;
-        }
-    }
-
-    // Handle newLine option
-    if (config_.compilerOptions.newLine == "crlf") {
-        result = std::regex_replace(result, std::regex("\n"), "\r\n");
-    } else if (config_.compilerOptions.newLine == "lf") {
-        result = std::regex_replace(result, std::regex("\r\n"), "\n");
-    }
-
-    return result;
-}
-
-std::string Transpiler::removeTypeAnnotations(const std::string& source) {
-    std::string result = source;
-
-    // Remove interface declarations (with optional generics)
-    result = std::regex_replace(result, std::regex("interface\\s+\\w+\\s*(?:<[^>]*>)?\\s*(?:extends\\s+[^{]+)?\\s*\\{[^}]*\\}"), "");
-
-    // Remove type alias declarations
-    result = std::regex_replace(result, std::regex("type\\s+\\w+\\s*(?:<[^>]*>)?\\s*=\\s*[^;]+;"), "");
-
-    // Remove optional parameter type annotations: (param?: Type) -> (param)
-    result = std::regex_replace(result, std::regex("(\\w+)\\?\\s*:\\s*[\\w<>\\[\\]|&\\s]+(?=[,)])"), "$1");
-
-    // Remove parameter type annotations: (param: Type) -> (param)
-    result = std::regex_replace(result, std::regex("(\\w+)\\s*:\\s*[\\w<>\\[\\]|&\\s]+(?=[,)])"), "$1");
-
-    // Remove return type annotations: ): Type { -> ) {
-    result = std::regex_replace(result, std::regex("\\)\\s*:\\s*[\\w<>\\[\\]|&\\s]+\\s*(?=\\{)"), ") ");
-    result = std::regex_replace(result, std::regex("\\)\\s*:\\s*[\\w<>\\[\\]|&\\s]+\\s*(?==>)"), ") ");
-
-    // Remove variable type annotations: let x: Type = -> let x =
-    result = std::regex_replace(result, std::regex("(let|const|var)\\s+(\\w+)\\s*:\\s*[\\w<>\\[\\]|&\\s]+\\s*="), "$1 $2 =");
-
-    // Remove optional property type annotations: name?: Type; -> name;
-    result = std::regex_replace(result, std::regex("(\\w+)\\?\\s*:\\s*[\\w<>\\[\\]|&\\s]+\\s*;"), "$1;");
-    result = std::regex_replace(result, std::regex("(\\w+)\\?\\s*:\\s*[\\w<>\\[\\]|&\\s]+\\s*="), "$1 =");
-
-    // Remove property type annotations in classes: name: string; -> name;
-    result = std::regex_replace(result, std::regex("(\\w+)\\s*:\\s*[\\w<>\\[\\]|&\\s]+\\s*;"), "$1;");
-    result = std::regex_replace(result, std::regex("(\\w+)\\s*:\\s*[\\w<>\\[\\]|&\\s]+\\s*="), "$1 =");
-
-    // Remove type assertions: <Type>value and value as Type
-    result = std::regex_replace(result, std::regex("<[\\w<>\\[\\]|&\\s]+>(?=\\w)"), "");
-    result = std::regex_replace(result, std::regex("\\s+as\\s+[\\w<>\\[\\]|&\\s]+"), "");
-
-    // Remove generic type parameters from functions: function<T>( -> function(
-    result = std::regex_replace(result, std::regex("(function\\s*\\w*)\\s*<[^>]+>\\s*\\("), "$1(");
-
-    // Remove generic type parameters from arrow functions
-    result = std::regex_replace(result, std::regex("<[^>]+>\\s*(?=\\([^)]*\\)\\s*=>)"), "");
-
-    // Remove class generic parameters: class Foo<T> -> class Foo
-    result = std::regex_replace(result, std::regex("(class\\s+\\w+)\\s*<[^>]+>"), "$1");
-
-    // Remove generic type in new expression: new Foo<T>(...) -> new Foo(...)
-    result = std::regex_replace(result, std::regex("new\\s+(\\w+)\\s*<[^>]+>\\s*\\("), "new $1(");
-
-    // Remove implements/extends type constraints
-    result = std::regex_replace(result, std::regex("\\s+implements\\s+[\\w<>,\\s]+(?=\\s*\\{)"), "");
-
-    // Remove readonly modifier
-    result = std::regex_replace(result, std::regex("\\breadonly\\s+"), "");
-
-    // Remove public/private/protected modifiers
-    result = std::regex_replace(result, std::regex("\\b(public|private|protected)\\s+"), "");
-
-    // Remove abstract modifier
-    result = std::regex_replace(result, std::regex("\\babstract\\s+"), "");
-
-    // Remove declare statements
-    result = std::regex_replace(result, std::regex("declare\\s+[^;]+;"), "");
-    result = std::regex_replace(result, std::regex("declare\\s+(function|class|const|let|var|enum|interface|type|namespace|module)[^{;]+[{;]"), "");
-
-    // Remove namespace/module declarations (keep content)
-    result = std::regex_replace(result, std::regex("namespace\\s+\\w+\\s*\\{"), "{");
-    result = std::regex_replace(result, std::regex("module\\s+\\w+\\s*\\{"), "{");
-
-    // Remove non-null assertions: value! -> value
-    result = std::regex_replace(result, std::regex("(\\w+)!(?=[^=])"), "$1");
-
-    // Remove definite assignment assertions: name!: -> name
-    result = std::regex_replace(result, std::regex("(\\w+)!\\s*:"), "$1:");
-
-    // Remove satisfies expression
-    result = std::regex_replace(result, std::regex("\\s+satisfies\\s+[\\w<>\\[\\]|&\\s]+"), "");
-
-    return result;
-}
-
-std::string Transpiler::transformJSX(const std::string& source) {
+EmitOptions Transpiler::emitOptionsFor(const std::string& filename) const {
     const auto& opts = config_.compilerOptions;
-
-    if (opts.jsx == "preserve" || opts.jsx == "react-native") {
-        // Keep JSX as-is
-        return source;
-    }
-
-    std::string createElement = opts.jsxFactory;
-    std::string fragmentType = opts.jsxFragmentFactory;
-    const bool automatic =
-        opts.jsx == "react-jsx" || opts.jsx == "react-jsxdev";
-    if (automatic) {
-        createElement = "_jsx";
-        fragmentType = "_Fragment";
-    }
-    bool changed = false;
-    JSXTransformer transformer(
-        source, createElement, fragmentType, automatic);
-    std::string result = transformer.transform(changed);
-    if (automatic && changed) {
-        const bool commonJS =
-            opts.module == "commonjs" || opts.module == "CommonJS";
-        if (commonJS) {
-            result =
-                "const { jsx: _jsx, jsxs: _jsxs, Fragment: _Fragment } = "
-                "require(\"" + opts.jsxImportSource +
-                "/jsx-runtime\");\n" + result;
-        } else {
-            result =
-                "import { jsx as _jsx, jsxs as _jsxs, "
-                "Fragment as _Fragment } from \"" +
-                opts.jsxImportSource + "/jsx-runtime\";\n" + result;
-        }
-    }
-    return result;
+    EmitOptions options;
+
+    std::string module = opts.module;
+    std::transform(module.begin(), module.end(), module.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    std::string target = opts.target;
+    std::transform(target.begin(), target.end(), target.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    const std::string extension = std::filesystem::path(filename).extension().string();
+
+    // .cts/.mts pin the module kind; node16/nodenext default to CommonJS
+    // like a package without "type": "module".
+    if (extension == ".mts" || extension == ".mjs") {
+        options.commonJS = false;
+    } else if (extension == ".cts" || extension == ".cjs") {
+        options.commonJS = true;
+    } else {
+        options.commonJS = module == "commonjs" || module == "node16" || module == "nodenext";
+    }
+    options.esModuleInterop = opts.esModuleInterop;
+    options.verbatimModuleSyntax = opts.verbatimModuleSyntax;
+    options.downlevelES5 = target == "es5" || target == "es3";
+    options.removeComments = opts.removeComments;
+    options.minify = opts.minify;
+    options.sourceMap = opts.sourceMap || opts.inlineSourceMap;
+
+    const bool jsxFile = extension == ".tsx" || extension == ".jsx";
+    if (jsxFile && !opts.jsx.empty() && opts.jsx != "preserve" &&
+        opts.jsx != "react-native") {
+        options.transformJSX = true;
+        options.jsxAutomatic = opts.jsx == "react-jsx" || opts.jsx == "react-jsxdev";
+        options.jsxFactory = opts.jsxFactory;
+        options.jsxFragmentFactory = opts.jsxFragmentFactory;
+    }
+
+    if (!opts.paths.empty() || opts.rewriteRelativeImportExtensions) {
+        options.rewriteSpecifier = [this, filename](const std::string& specifier) {
+            return rewriteModuleSpecifier(specifier, filename);
+        };
+    }
+    return options;
 }
 
-std::string Transpiler::transformPaths(
-    const std::string& source, const std::string& filename) {
+std::string Transpiler::rewriteModuleSpecifier(
+    const std::string& specifier, const std::string& filename) const {
     const auto& opts = config_.compilerOptions;
-
-    if (opts.paths.empty() && !opts.rewriteRelativeImportExtensions) {
-        return source;
-    }
-    const auto rewrite = [&](const std::string& specifier) {
-        for (const auto& [pattern, replacements] : opts.paths) {
-            if (replacements.empty()) continue;
-            const size_t star = pattern.find('*');
-            std::string wildcard;
-            if (star == std::string::npos) {
-                if (specifier != pattern) continue;
-            } else {
-                const std::string prefix = pattern.substr(0, star);
-                const std::string suffix = pattern.substr(star + 1);
-                if (specifier.size() < prefix.size() + suffix.size() ||
-                    specifier.compare(0, prefix.size(), prefix) != 0 ||
-                    specifier.compare(
-                        specifier.size() - suffix.size(),
-                        suffix.size(), suffix) != 0) {
-                    continue;
-                }
-                wildcard = specifier.substr(
-                    prefix.size(),
-                    specifier.size() - prefix.size() - suffix.size());
-            }
-            std::string replacement = replacements.front();
-            const size_t replacementStar = replacement.find('*');
-            if (replacementStar != std::string::npos) {
-                replacement.replace(replacementStar, 1, wildcard);
-            }
-            std::filesystem::path base = opts.baseUrl.empty()
-                ? std::filesystem::path(configDir_)
-                : std::filesystem::path(
-                    resolveConfigRelativePath(opts.baseUrl));
-            std::filesystem::path targetSource = base / replacement;
-            if (!targetSource.has_extension()) targetSource += ".ts";
-            std::filesystem::path targetOutput =
-                resolveOutputPath(targetSource.string(), ".js");
-            std::filesystem::path importerOutput =
-                resolveOutputPath(filename, ".js");
-            std::filesystem::path relative = std::filesystem::relative(
-                targetOutput, importerOutput.parent_path());
-            if (!opts.rewriteRelativeImportExtensions) {
-                relative.replace_extension();
+    for (const auto& [pattern, replacements] : opts.paths) {
+        if (replacements.empty()) continue;
+        const size_t star = pattern.find('*');
+        std::string wildcard;
+        if (star == std::string::npos) {
+            if (specifier != pattern) continue;
+        } else {
+            const std::string prefix = pattern.substr(0, star);
+            const std::string suffix = pattern.substr(star + 1);
+            if (specifier.size() < prefix.size() + suffix.size() ||
+                specifier.compare(0, prefix.size(), prefix) != 0 ||
+                specifier.compare(
+                    specifier.size() - suffix.size(),
+                    suffix.size(), suffix) != 0) {
+                continue;
             }
-            std::string resolved = relative.generic_string();
-            if (!resolved.empty() && resolved[0] != '.') resolved = "./" + resolved;
-            return resolved;
+            wildcard = specifier.substr(
+                prefix.size(),
+                specifier.size() - prefix.size() - suffix.size());
         }
-        if (opts.rewriteRelativeImportExtensions &&
-            (specifier.rfind("./", 0) == 0 ||
-             specifier.rfind("../", 0) == 0)) {
-            std::filesystem::path rewritten(specifier);
-            const std::string extension = rewritten.extension().string();
-            if (extension == ".ts" || extension == ".tsx" ||
-                extension == ".mts" || extension == ".cts") {
-                rewritten.replace_extension(".js");
-                return rewritten.generic_string();
-            }
+        std::string replacement = replacements.front();
+        const size_t replacementStar = replacement.find('*');
+        if (replacementStar != std::string::npos) {
+            replacement.replace(replacementStar, 1, wildcard);
         }
-        return specifier;
-    };
-
-    std::string result;
-    for (size_t position = 0; position < source.size();) {
-        if (source[position] != '"' && source[position] != '\'') {
-            result += source[position++];
-            continue;
+        std::filesystem::path base = opts.baseUrl.empty()
+            ? std::filesystem::path(configDir_)
+            : std::filesystem::path(
+                resolveConfigRelativePath(opts.baseUrl));
+        std::filesystem::path targetSource = base / replacement;
+        if (!targetSource.has_extension()) targetSource += ".ts";
+        std::filesystem::path targetOutput =
+            resolveOutputPath(targetSource.string(), ".js");
+        std::filesystem::path importerOutput =
+            resolveOutputPath(filename, ".js");
+        std::filesystem::path relative = std::filesystem::relative(
+            targetOutput, importerOutput.parent_path());
+        if (!opts.rewriteRelativeImportExtensions) {
+            relative.replace_extension();
         }
-        const char delimiter = source[position];
-        const size_t valueStart = ++position;
-        while (position < source.size() &&
-               source[position] != delimiter) {
-            if (source[position] == '\\' && position + 1 < source.size()) {
-                position += 2;
-            } else {
-                ++position;
-            }
+        std::string resolved = relative.generic_string();
+        if (!resolved.empty() && resolved[0] != '.') resolved = "./" + resolved;
+        return resolved;
+    }
+    if (opts.rewriteRelativeImportExtensions &&
+        (specifier.rfind("./", 0) == 0 ||
+         specifier.rfind("../", 0) == 0)) {
+        std::filesystem::path rewritten(specifier);
+        const std::string extension = rewritten.extension().string();
+        if (extension == ".ts" || extension == ".tsx" ||
+            extension == ".mts" || extension == ".cts") {
+            rewritten.replace_extension(".js");
+            return rewritten.generic_string();
         }
-        const std::string value =
-            source.substr(valueStart, position - valueStart);
-        result += delimiter;
-        result += rewrite(value);
-        if (position < source.size()) result += source[position++];
     }
-    return result;
+    return specifier;
 }
 
-std::string Transpiler::transformImports(const std::string& source) {
-    std::string result = source;
+EmitResult Transpiler::transformTypeScript(
+    const SourceRewriter& rewriter, const std::string& filename) {
     const auto& opts = config_.compilerOptions;
-
-    // Remove import type statements (they have no runtime effect)
-    result = std::regex_replace(result, std::regex("import\\s+type\\s+[^;]+;"), "");
-    result = std::regex_replace(result, std::regex("import\\s*\\{\\s*type\\s+[^}]+\\}\\s*from\\s*[^;]+;"), "");
-
-    // Check module format
-    bool isCommonJS = (opts.module == "commonjs" || opts.module == "CommonJS");
-    bool isES = (opts.module == "es6" || opts.module == "es2015" || opts.module == "es2020" ||
-                 opts.module == "es2022" || opts.module == "esnext" || opts.module == "ESNext");
-
-    if (isES) {
-        // Keep ES modules as-is, just clean up type imports
-        return result;
-    }
-
-    if (isCommonJS) {
-        // Transform ES6 imports to CommonJS require
-
-        // import { a, b } from 'module' -> const { a, b } = require('module')
-        result = std::regex_replace(result,
-            std::regex("import\\s*\\{([^}]+)\\}\\s*from\\s*['\"]([^'\"]+)['\"]"),
-            "const {$1} = require(\"$2\")");
-
-        // import * as name from 'module' -> const name = require('module')
-        result = std::regex_replace(result,
-            std::regex("import\\s*\\*\\s*as\\s+(\\w+)\\s*from\\s*['\"]([^'\"]+)['\"]"),
-            "const $1 = require(\"$2\")");
-
-        // import name from 'module' -> const name = require('module').default || require('module')
-        if (opts.esModuleInterop) {
-            result = std::regex_replace(result,
-                std::regex("import\\s+(\\w+)\\s*from\\s*['\"]([^'\"]+)['\"]"),
-                "const $1 = require(\"$2\").default || require(\"$2\")");
+    const EmitOptions options = emitOptionsFor(filename);
+    EmitResult result = rewriter.emitJavaScript(options);
+
+    // Lines prepended to the emitted code; each one shifts the mappings
+    // down by a line.
+    std::vector<std::string> prologue;
+    if ((opts.alwaysStrict || opts.strict) &&
+        result.code.find("\"use strict\"") == std::string::npos &&
+        result.code.find("'use strict'") == std::string::npos) {
+        prologue.push_back("\"use strict\";");
+    }
+    if (result.usesJSXRuntime) {
+        if (options.commonJS) {
+            prologue.push_back(
+                "const { jsx: _jsx, jsxs: _jsxs, Fragment: _Fragment } = "
+                "require(\"" + opts.jsxImportSource + "/jsx-runtime\");");
         } else {
-            result = std::regex_replace(result,
-                std::regex("import\\s+(\\w+)\\s*from\\s*['\"]([^'\"]+)['\"]"),
-                "const $1 = require(\"$2\")");
-        }
-
-        // import 'module' -> require('module')
-        result = std::regex_replace(result,
-            std::regex("import\\s*['\"]([^'\"]+)['\"]"),
-            "require(\"$1\")");
-
-        // Handle JSON imports if enabled
-        if (opts.resolveJsonModule) {
-            // Already handled by require()
+            prologue.push_back(
+                "import { jsx as _jsx, jsxs as _jsxs, "
+                "Fragment as _Fragment } from \"" +
+                opts.jsxImportSource + "/jsx-runtime\";");
         }
     }
-
-    return result;
-}
-
-std::string Transpiler::transformExports(const std::string& source) {
-    std::string result = source;
-    std::vector<std::string> exportedNames;
-    const auto& opts = config_.compilerOptions;
-
-    bool isCommonJS = (opts.module == "commonjs" || opts.module == "CommonJS");
-    bool isES = (opts.module == "es6" || opts.module == "es2015" || opts.module == "es2020" ||
-                 opts.module == "es2022" || opts.module == "esnext" || opts.module == "ESNext");
-
-    if (isES) {
-        // Keep ES exports, just handle enum transformation
-        // Transform enum member syntax: Key = "value" -> Key: "value"
-        result = std::regex_replace(result,
-            std::regex("(\\n\\s*)(\\w+)\\s*=\\s*(\"[^\"]*\")"),
-            "$1$2: $3");
-        result = std::regex_replace(result,
-            std::regex("(\\n\\s*)(\\w+)\\s*=\\s*('[^']*')"),
-            "$1$2: $3");
-        result = std::regex_replace(result,
-            std::regex("(\\n\\s*)(\\w+)\\s*=\\s*(\\d+)\\s*([,}])"),
-            "$1$2: $3$4");
-
-        // export enum Name { ... } -> export const Name = { ... };
-        result = std::regex_replace(result,
-            std::regex("export\\s+enum\\s+(\\w+)\\s*\\{([^}]*)\\}"),
-            "export const $1 = {$2};");
-
-        // enum Name { ... } -> const Name = { ... };
-        result = std::regex_replace(result,
-            std::regex("\\benum\\s+(\\w+)\\s*\\{([^}]*)\\}"),
-            "const $1 = {$2};");
-
-        return result;
+    if (!prologue.empty()) {
+        std::string code;
+        for (const std::string& line : prologue) code += line + "\n";
+        result.code = code + result.code;
+        if (options.sourceMap) result.mappings.insert(0, prologue.size(), ';');
     }
 
-    if (isCommonJS) {
-        // Collect exported names first
-
-        // Find export const/let/var names
-        std::regex varExportRegex("export\\s+(?:const|let|var)\\s+(\\w+)");
-        std::sregex_iterator varIt(source.begin(), source.end(), varExportRegex);
-        std::sregex_iterator endIt;
-        while (varIt != endIt) {
-            exportedNames.push_back((*varIt)[1].str());
-            ++varIt;
-        }
-
-        // Find export function names
-        std::regex funcExportRegex("export\\s+(?:async\\s+)?function\\s+(\\w+)");
-        std::sregex_iterator funcIt(source.begin(), source.end(), funcExportRegex);
-        while (funcIt != endIt) {
-            exportedNames.push_back((*funcIt)[1].str());
-            ++funcIt;
-        }
-
-        // Find export class names
-        std::regex classExportRegex("export\\s+class\\s+(\\w+)");
-        std::sregex_iterator classIt(source.begin(), source.end(), classExportRegex);
-        while (classIt != endIt) {
-            exportedNames.push_back((*classIt)[1].str());
-            ++classIt;
-        }
-
-        // Find export enum names
-        std::regex enumExportRegex("export\\s+enum\\s+(\\w+)");
-        std::sregex_iterator enumIt(source.begin(), source.end(), enumExportRegex);
-        while (enumIt != endIt) {
-            exportedNames.push_back((*enumIt)[1].str());
-            ++enumIt;
-        }
-
-        // Transform enum member syntax FIRST: Key = "value" -> Key: "value"
-        result = std::regex_replace(result,
-            std::regex("(\\n\\s*)(\\w+)\\s*=\\s*(\"[^\"]*\")"),
-            "$1$2: $3");
-        result = std::regex_replace(result,
-            std::regex("(\\n\\s*)(\\w+)\\s*=\\s*('[^']*')"),
-            "$1$2: $3");
-        result = std::regex_replace(result,
-            std::regex("(\\n\\s*)(\\w+)\\s*=\\s*(\\d+)\\s*([,}])"),
-            "$1$2: $3$4");
-
-        // Transform ES6 exports to CommonJS
-
-        // export default value -> module.exports = value
-        result = std::regex_replace(result,
-            std::regex("export\\s+default\\s+"),
-            "module.exports = ");
-
-        // export { a, b } -> module.exports = { a, b }
-        result = std::regex_replace(result,
-            std::regex("export\\s*\\{([^}]+)\\}\\s*;?"),
-            "module.exports = {$1};");
-
-        // export const/let/var name = value -> const/let/var name = value
-        result = std::regex_replace(result,
-            std::regex("export\\s+(const|let|var)\\s+(\\w+)"),
-            "$1 $2");
-
-        // export async function name -> async function name
-        result = std::regex_replace(result,
-            std::regex("export\\s+async\\s+function\\s+(\\w+)"),
-            "async function $1");
-
-        // export function name -> function name
-        result = std::regex_replace(result,
-            std::regex("export\\s+function\\s+(\\w+)"),
-            "function $1");
-
-        // export class name -> class name
-        result = std::regex_replace(result,
-            std::regex("export\\s+class\\s+(\\w+)"),
-            "class $1");
-
-        // export enum Name { ... } -> const Name = { ... };
-        result = std::regex_replace(result,
-            std::regex("export\\s+enum\\s+(\\w+)\\s*\\{([^}]*)\\}"),
-            "const $1 = {$2};");
-
-        // Non-exported enum: enum Name { ... } -> const Name = { ... };
-        result = std::regex_replace(result,
-            std::regex("\\benum\\s+(\\w+)\\s*\\{([^}]*)\\}"),
-            "const $1 = {$2};");
-
-        // Add module.exports at the end for collected exports
-        if (!exportedNames.empty()) {
-            result += "\n\nmodule.exports = { ";
-            for (size_t i = 0; i < exportedNames.size(); ++i) {
-                if (i > 0) result += ", ";
-                result += exportedNames[i];
+    // Handle newLine option
+    if (opts.newLine == "crlf") {
+        std::string converted;
+        converted.reserve(result.code.size() + result.code.size() / 32);
+        for (size_t i = 0; i < result.code.size(); ++i) {
+            if (result.code[i] == '\n' && (i == 0 || result.code[i - 1] != '\r')) {
+                converted += '\r';
             }
-            result += " };\n";
+            converted += result.code[i];
         }
+        result.code = std::move(converted);
+    } else if (opts.newLine == "lf") {
+        result.code.erase(std::remove(result.code.begin(), result.code.end(), '\r'),
+                          result.code.end());
     }
 
     return result;
 }
 
-std::string Transpiler::downlevelToTarget(const std::string& source) {
-    std::string result = source;
-    const auto& opts = config_.compilerOptions;
-
-    // ES5/ES3 transformations
-    if (opts.target == "es5" || opts.target == "es3") {
-        // Transform arrow functions: (x) => x -> function(x) { return x; }
-        result = std::regex_replace(result,
-            std::regex("\\(([^)]*)\\)\\s*=>\\s*([^{][^;\\n]*)"),
-            "function($1) { return $2; }");
-
-        // Transform arrow functions with block: (x) => { ... } -> function(x) { ... }
-        result = std::regex_replace(result,
-            std::regex("\\(([^)]*)\\)\\s*=>\\s*\\{"),
-            "function($1) {");
-
-        // Transform template literals: `${x}` -> "" + x + ""
-        // This is a simplified transformation
-        result = std::regex_replace(result,
-            std::regex("`([^`]*)`"),
-            "\"$1\"");
-
-        // Transform let/const to var
-        result = std::regex_replace(result, std::regex("\\blet\\s+"), "var ");
-        result = std::regex_replace(result, std::regex("\\bconst\\s+"), "var ");
-
-        // Transform class to function (simplified)
-        // Full class transformation would be more complex
-    }
-
-    return result;
-}
-
-std::string Transpiler::minifyCode(const std::string& source) {
-    std::string result = source;
-
-    // Remove multi-line whitespace (replace newlines with single space)
-    result = std::regex_replace(result, std::regex("\\n+"), " ");
-
-    // Collapse multiple spaces to one
-    result = std::regex_replace(result, std::regex("  +"), " ");
-
-    // Remove spaces around brackets and punctuation
-    result = std::regex_replace(result, std::regex("\\s*\\(\\s*"), "(");
-    result = std::regex_replace(result, std::regex("\\s*\\)\\s*"), ")");
-    result = std::regex_replace(result, std::regex("\\s*\\[\\s*"), "[");
-    result = std::regex_replace(result, std::regex("\\s*\\]\\s*"), "]");
-    result = std::regex_replace(result, std::regex("\\s*;\\s*"), ";");
-    result = std::regex_replace(result, std::regex("\\s*,\\s*"), ",");
-
-    // Handle braces
-    result = std::regex_replace(result, std::regex("\\s*\\{\\s*"), "{");
-    result = std::regex_replace(result, std::regex("\\s*\\}\\s*"), "}");
-
-    // Remove spaces around operators
-    result = std::regex_replace(result, std::regex("\\s*=\\s*"), "=");
-    result = std::regex_replace(result, std::regex("\\s*\\+\\s*"), "+");
-    result = std::regex_replace(result, std::regex("\\s*-\\s*"), "-");
-    result = std::regex_replace(result, std::regex("\\s*\\*\\s*"), "*");
-    result = std::regex_replace(result, std::regex("\\s*/\\s*"), "/");
-    result = std::regex_replace(result, std::regex("\\s*<\\s*"), "<");
-    result = std::regex_replace(result, std::regex("\\s*>\\s*"), ">");
-
-    // Remove trailing semicolons before closing brace
-    result = std::regex_replace(result, std::regex(";\\}"), "}");
-
-    // Trim leading/trailing whitespace
-    size_t start = result.find_first_not_of(" \t\n\r");
-    size_t end = result.find_last_not_of(" \t\n\r");
-    if (start != std::string::npos && end != std::string::npos) {
-        result = result.substr(start, end - start + 1);
-    }
-
-    return result;
-}
-
-std::string Transpiler::generateSourceMap(const std::string& source, const std::string& output, const std::string& filename) {
+std::string Transpiler::generateSourceMap(const std::string& source, const std::string& mappings, const std::string& filename) {
     const auto& opts = config_.compilerOptions;
 
-    // Generate a proper source map
     std::stringstream ss;
     ss << "{\n";
     ss << "  \"version\": 3,\n";
@@ -1276,133 +588,15 @@ std::string Transpiler::generateSourceMap(const std::string& source, const std::
     }
 
     ss << "  \"names\": [],\n";
-
-    // Generate basic mappings (line-by-line)
-    // This is a simplified implementation - real source maps need VLQ encoding
-    ss << "  \"mappings\": \"";
-
-    // Count lines in output
-    int lineCount = 1;
-    for (char c : output) {
-        if (c == '\n') lineCount++;
-    }
-
-    // Generate simple 1:1 line mapping
-    for (int i = 0; i < lineCount; i++) {
-        if (i > 0) ss << ";";
-        ss << "AAAA"; // Simple identity mapping
-    }
-
-    ss << "\"\n";
+    // Segments recorded while printing: one per copied token run and
+    // inserted edit.
+    ss << "  \"mappings\": \"" << mappings << "\"\n";
     ss << "}\n";
 
     return ss.str();
 }
 
-std::string Transpiler::generateDeclaration(const std::string& source) {
-    std::string result;
-    std::set<std::string> emittedFunctions;
-    std::set<std::string> emittedVariables;
-
-    // Extract interfaces (keep them as-is for .d.ts)
-    std::regex interfaceRegex("((?:export\\s+)?interface\\s+\\w+\\s*(?:<[^>]*>)?\\s*(?:extends\\s+[^{]+)?\\s*\\{[^}]*\\})");
-    std::sregex_iterator it(source.begin(), source.end(), interfaceRegex);
-    std::sregex_iterator end;
-    while (it != end) {
-        result += it->str() + "\n\n";
-        ++it;
-    }
-
-    // Extract type aliases
-    std::regex typeRegex("((?:export\\s+)?type\\s+\\w+\\s*(?:<[^>]*>)?\\s*=\\s*[^;]+;)");
-    it = std::sregex_iterator(source.begin(), source.end(), typeRegex);
-    while (it != end) {
-        result += it->str() + "\n";
-        ++it;
-    }
-
-    // Extract exported function signatures
-    std::regex funcRegex(
-        "export\\s+((?:async\\s+)?function\\s+(\\w+)\\s*"
-        "(?:<[^>]*>)?\\s*\\([^)]*\\)\\s*:\\s*"
-        "[\\w<>\\[\\]|&.,\\s]+)");
-    it = std::sregex_iterator(source.begin(), source.end(), funcRegex);
-    while (it != end) {
-        result += "export declare " + it->str(1) + ";\n";
-        emittedFunctions.insert(it->str(2));
-        ++it;
-    }
-    std::regex inferredFuncRegex(
-        "export\\s+((?:async\\s+)?function\\s+(\\w+)\\s*"
-        "((?:<[^>]*>)?)\\s*\\(([^)]*)\\))\\s*\\{");
-    it = std::sregex_iterator(
-        source.begin(), source.end(), inferredFuncRegex);
-    while (it != end) {
-        if (emittedFunctions.insert(it->str(2)).second) {
-            result += "export declare " + it->str(1) + ": unknown;\n";
-        }
-        ++it;
-    }
-
-    // Extract exported class declarations
-    std::regex classRegex("export\\s+(class\\s+\\w+\\s*(?:<[^>]*>)?\\s*(?:extends\\s+[^{]+)?\\s*(?:implements\\s+[^{]+)?\\s*)\\{");
-    it = std::sregex_iterator(source.begin(), source.end(), classRegex);
-    while (it != end) {
-        result += "export declare " + it->str(1) + "{ }\n";
-        ++it;
-    }
-
-    // Extract exported const/let declarations
-    std::regex varRegex("export\\s+(const|let)\\s+(\\w+)\\s*:\\s*([^=;]+)");
-    it = std::sregex_iterator(source.begin(), source.end(), varRegex);
-    while (it != end) {
-        result += "export declare " + it->str(1) + " " + it->str(2) + ": " + it->str(3) + ";\n";
-        emittedVariables.insert(it->str(2));
-        ++it;
-    }
-    std::regex inferredVarRegex(
-        "export\\s+(const|let)\\s+(\\w+)\\s*=\\s*([^;]+);");
-    it = std::sregex_iterator(source.begin(), source.end(), inferredVarRegex);
-    while (it != end) {
-        const std::string name = it->str(2);
-        if (emittedVariables.insert(name).second) {
-            std::string initializer = it->str(3);
-            initializer.erase(0, initializer.find_first_not_of(" \t\r\n"));
-            std::string inferred = "unknown";
-            if (!initializer.empty() &&
-                (initializer.front() == '"' || initializer.front() == '\'' ||
-                 initializer.front() == '`')) {
-                inferred = "string";
-            } else if (initializer == "true" || initializer == "false") {
-                inferred = "boolean";
-            } else if (std::regex_match(
-                           initializer,
-                           std::regex("[+-]?[0-9]+(?:\\.[0-9]+)?"))) {
-                inferred = "number";
-            }
-            result += "export declare " + it->str(1) + " " + name +
-                ": " + inferred + ";\n";
-        }
-        ++it;
-    }
-
-    // Extract enums
-    std::regex enumRegex("((?:export\\s+)?enum\\s+\\w+\\s*\\{[^}]*\\})");
-    it = std::sregex_iterator(source.begin(), source.end(), enumRegex);
-    while (it != end) {
-        std::string enumStr = it->str();
-        if (enumStr.find("export") == std::string::npos) {
-            result += "declare " + enumStr + "\n";
-        } else {
-            result += enumStr.substr(0, 6) + " declare" + enumStr.substr(6) + "\n";
-        }
-        ++it;
-    }
-
-    return result;
-}
-
-std::string Transpiler::generateDeclarationMap([[maybe_unused]] const std::string& source, const std::string& dtsCode, const std::string& filename) {
+std::string Transpiler::generateDeclarationMap(const std::string& mappings, const std::string& filename) {
     std::stringstream ss;
     std::filesystem::path srcPath(filename);
 
@@ -1415,16 +609,7 @@ std::string Transpiler::generateDeclarationMap([[maybe_unused]] const std::strin
     ss << "  \"file\": \"" << dtsFile << "\",\n";
     ss << "  \"sources\": [\"" << jsonEscape(srcFile) << "\"],\n";
     ss << "  \"names\": [],\n";
-
-    // Generate simple line mappings from .d.ts to source
-    // Each line in .d.ts maps to corresponding source location
-    std::string mappings;
-    int lineCount = std::count(dtsCode.begin(), dtsCode.end(), '\n') + 1;
-    for (int i = 0; i < lineCount; i++) {
-        if (i > 0) mappings += ";";
-        mappings += "AAAA";  // Simple 1:1 mapping
-    }
-
+    // Each declaration maps to the statement it was printed from.
     ss << "  \"mappings\": \"" << mappings << "\"\n";
     ss << "}";
 
@@ -1567,7 +752,7 @@ bool Transpiler::matchesGlob(const std::string& path, const std::string& pattern
     return normalizedPath.find(pattern) != std::string::npos;
 }
 
-std::string Transpiler::resolveOutputPath(const std::string& inputPath, const std::string& ext) {
+std::string Transpiler::resolveOutputPath(const std::string& inputPath, const std::string& ext) const {
     const auto& opts = config_.compilerOptions;
     std::filesystem::path input(inputPath);
     std::filesystem::path output;
@@ -1666,6 +851,23 @@ BuildResult Transpiler::build(const std::string& projectPath) {
         return result;
     }
 
+    // outFile: one bundle instead of a file per module
+    if (!opts.outFile.empty()) {
+        BundleResult bundled = bundle(files, resolveConfigRelativePath(opts.outFile));
+        result.success = bundled.success;
+        result.errors = bundled.errors;
+        result.successCount = bundled.success ? result.totalFiles : 0;
+        result.failCount = bundled.success ? 0 : result.totalFiles;
+        result.totalInputSize = bundled.totalInputSize;
+        result.totalOutputSize = bundled.outputSize;
+        for (const auto& warning : bundled.warnings) {
+            std::cerr << "[WARN] " << warning << std::endl;
+        }
+        auto endTime = std::chrono::high_resolution_clock::now();
+        result.totalTimeMs = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+        return result;
+    }
+
     // Create output directory
     std::string outDir = resolveConfigRelativePath(
         opts.outDir.empty() ? "." : opts.outDir);
@@ -1689,18 +891,11 @@ BuildResult Transpiler::build(const std::string& projectPath) {
         filesToBuild = files;
     }
 
-    // Transpile files in parallel
-    std::vector<std::future<TranspileResult>> futures;
-    for (const auto& file : filesToBuild) {
-        futures.push_back(std::async(std::launch::async, [this, file]() {
-            return this->transpileFile(file);
-        }));
-    }
+    std::vector<TranspileResult> transpiled = transpileFiles(filesToBuild);
 
     // Collect results
     bool hasErrors = false;
-    for (auto& future : futures) {
-        TranspileResult fileResult = future.get();
+    for (auto& fileResult : transpiled) {
         result.files.push_back(fileResult);
 
         if (fileResult.success) {
@@ -1711,70 +906,11 @@ BuildResult Transpiler::build(const std::string& projectPath) {
             // Don't write if noEmit
             if (opts.noEmit) continue;
 
-            // Write output file
-            std::string jsPath = resolveOutputPath(fileResult.filename, ".js");
-
-            // Create subdirectories if needed
-            std::filesystem::create_directories(std::filesystem::path(jsPath).parent_path());
-
-            if (!opts.emitDeclarationOnly && !fileResult.jsCode.empty()) {
-                std::ofstream outFile(jsPath);
-                if (outFile.is_open()) {
-                    outFile << fileResult.jsCode;
-                    outFile.close();
-                }
-            }
-
-            // Write declaration file if generated
-            if (!fileResult.dtsCode.empty()) {
-                std::string dtsPath = resolveOutputPath(fileResult.filename, ".d.ts");
-                if (!opts.declarationDir.empty()) {
-                    std::filesystem::path input(fileResult.filename);
-                    std::filesystem::path root = opts.rootDir.empty()
-                        ? std::filesystem::path(configDir_)
-                        : std::filesystem::path(
-                            resolveConfigRelativePath(opts.rootDir));
-                    std::filesystem::path relative =
-                        std::filesystem::relative(input.parent_path(), root);
-                    dtsPath =
-                        (std::filesystem::path(resolveConfigRelativePath(
-                             opts.declarationDir)) /
-                         relative /
-                         (input.stem().string() + ".d.ts")).string();
-                }
-
-                std::filesystem::create_directories(std::filesystem::path(dtsPath).parent_path());
-                std::ofstream dtsFile(dtsPath);
-                if (dtsFile.is_open()) {
-                    dtsFile << fileResult.dtsCode;
-                    dtsFile.close();
-                }
-
-                // Write declaration map if generated
-                if (!fileResult.declarationMap.empty()) {
-                    std::string dtsMapPath = dtsPath + ".map";
-                    std::ofstream dtsMapFile(dtsMapPath);
-                    if (dtsMapFile.is_open()) {
-                        dtsMapFile << fileResult.declarationMap;
-                        dtsMapFile.close();
-                    }
-                }
-            }
-
-            // Write source map if generated
-            if (!fileResult.sourceMap.empty()) {
-                std::string mapPath = jsPath + ".map";
-                std::ofstream mapFile(mapPath);
-                if (mapFile.is_open()) {
-                    mapFile << fileResult.sourceMap;
-                    mapFile.close();
-                }
-            }
+            writeOutputs(fileResult);
 
             // Update build cache
             if (opts.incremental) {
-                buildCache_.fileModTimes[fileResult.filename] =
-                    std::filesystem::last_write_time(fileResult.filename);
+                recordBuilt(fileResult);
             }
         } else {
             result.failCount++;
@@ -1804,40 +940,219 @@ BuildResult Transpiler::build(const std::string& projectPath) {
     return result;
 }
 
+std::vector<TranspileResult> Transpiler::transpileFiles(const std::vector<std::string>& files) {
+    // Transpile files on a fixed pool of workers pulling from a shared
+    // index; results keep their input order.
+    std::vector<TranspileResult> transpiled(files.size());
+    std::atomic<size_t> nextFile{0};
+    const auto work = [&]() {
+        for (size_t index; (index = nextFile.fetch_add(1)) < files.size();) {
+            transpiled[index] = transpileFile(files[index]);
+        }
+    };
+    const size_t workerCount = std::min<size_t>(
+        std::max(1u, std::thread::hardware_concurrency()), files.size());
+    std::vector<std::thread> workers;
+    for (size_t worker = 1; worker < workerCount; ++worker) {
+        workers.emplace_back(work);
+    }
+    work();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    return transpiled;
+}
+
+void Transpiler::writeOutputs(const TranspileResult& fileResult) {
+    const auto& opts = config_.compilerOptions;
+
+    // Write output file
+    std::string jsPath = resolveOutputPath(fileResult.filename, ".js");
+
+    // Create subdirectories if needed
+    std::filesystem::create_directories(std::filesystem::path(jsPath).parent_path());
+
+    if (!opts.emitDeclarationOnly && !fileResult.jsCode.empty()) {
+        std::ofstream outFile(jsPath);
+        if (outFile.is_open()) {
+            outFile << fileResult.jsCode;
+            outFile.close();
+        }
+    }
+
+    // Write declaration file if generated
+    if (!fileResult.dtsCode.empty()) {
+        std::string dtsPath = resolveOutputPath(fileResult.filename, ".d.ts");
+        if (!opts.declarationDir.empty()) {
+            std::filesystem::path input(fileResult.filename);
+            std::filesystem::path root = opts.rootDir.empty()
+                ? std::filesystem::path(configDir_)
+                : std::filesystem::path(
+                    resolveConfigRelativePath(opts.rootDir));
+            std::filesystem::path relative =
+                std::filesystem::relative(input.parent_path(), root);
+            dtsPath =
+                (std::filesystem::path(resolveConfigRelativePath(
+                     opts.declarationDir)) /
+                 relative /
+                 (input.stem().string() + ".d.ts")).string();
+        }
+
+        std::filesystem::create_directories(std::filesystem::path(dtsPath).parent_path());
+        std::ofstream dtsFile(dtsPath);
+        if (dtsFile.is_open()) {
+            dtsFile << fileResult.dtsCode;
+            dtsFile.close();
+        }
+
+        // Write declaration map if generated
+        if (!fileResult.declarationMap.empty()) {
+            std::string dtsMapPath = dtsPath + ".map";
+            std::ofstream dtsMapFile(dtsMapPath);
+            if (dtsMapFile.is_open()) {
+                dtsMapFile << fileResult.declarationMap;
+                dtsMapFile.close();
+            }
+        }
+    }
+
+    // Write source map if generated
+    if (!fileResult.sourceMap.empty()) {
+        std::string mapPath = jsPath + ".map";
+        std::ofstream mapFile(mapPath);
+        if (mapFile.is_open()) {
+            mapFile << fileResult.sourceMap;
+            mapFile.close();
+        }
+    }
+}
+
 // ============================================================================
 // Incremental Build Helpers
 // ============================================================================
 
+namespace {
+    // Build cache key: the same file always maps to the same string no
+    // matter how it was reached (project glob, import, watch event).
+    std::string cacheKey(const std::string& path) {
+        std::error_code error;
+        std::filesystem::path canonical = std::filesystem::weakly_canonical(path, error);
+        return error ? path : canonical.string();
+    }
+
+    // FNV-1a; only compared against itself, so any stable hash will do.
+    std::string contentHash(const std::string& path) {
+        std::ifstream file(path, std::ios::binary);
+        if (!file.is_open()) return std::string();
+        uint64_t hash = 14695981039346656037ull;
+        char buffer[65536];
+        while (file.read(buffer, sizeof(buffer)) || file.gcount() > 0) {
+            const std::streamsize count = file.gcount();
+            for (std::streamsize i = 0; i < count; ++i) {
+                hash ^= static_cast<unsigned char>(buffer[i]);
+                hash *= 1099511628211ull;
+            }
+        }
+        std::ostringstream text;
+        text << std::hex << std::setw(16) << std::setfill('0') << hash;
+        return text.str();
+    }
+}
+
 bool Transpiler::needsRebuild(const std::string& filePath) {
     if (!buildCache_.isValid) return true;
 
-    auto it = buildCache_.fileModTimes.find(filePath);
+    const auto& opts = config_.compilerOptions;
+    const std::string key = cacheKey(filePath);
+    auto it = buildCache_.fileModTimes.find(key);
     if (it == buildCache_.fileModTimes.end()) return true;
 
-    auto currentModTime = std::filesystem::last_write_time(filePath);
-    return currentModTime > it->second;
+    // Outputs deleted since the last build
+    if (!opts.noEmit && !opts.emitDeclarationOnly && opts.outFile.empty() &&
+        !std::filesystem::exists(resolveOutputPath(filePath, ".js"))) {
+        return true;
+    }
+
+    std::error_code error;
+    auto currentModTime = std::filesystem::last_write_time(filePath, error);
+    if (error) return true;
+    if (currentModTime == it->second) return false;
+
+    // Touched (checkout, save without edits): same content, same output
+    const auto hash = buildCache_.fileHashes.find(key);
+    if (hash != buildCache_.fileHashes.end() && hash->second == contentHash(filePath)) {
+        it->second = currentModTime;
+        return false;
+    }
+    return true;
 }
 
-void Transpiler::saveBuildInfo() {
+void Transpiler::recordBuilt(const TranspileResult& fileResult) {
+    const std::string key = cacheKey(fileResult.filename);
+    std::error_code error;
+    buildCache_.fileModTimes[key] =
+        std::filesystem::last_write_time(fileResult.filename, error);
+    buildCache_.fileHashes[key] = contentHash(fileResult.filename);
+    buildCache_.fileImports[key] = fileResult.imports;
+}
+
+std::set<std::string> Transpiler::dependentsOf(const std::set<std::string>& files) const {
+    std::map<std::string, std::vector<std::string>> importers;
+    for (const auto& [file, imports] : buildCache_.fileImports) {
+        for (const auto& imported : imports) importers[imported].push_back(file);
+    }
+    std::set<std::string> dependents;
+    std::vector<std::string> pending;
+    for (const auto& file : files) pending.push_back(cacheKey(file));
+    while (!pending.empty()) {
+        const std::string file = std::move(pending.back());
+        pending.pop_back();
+        const auto found = importers.find(file);
+        if (found == importers.end()) continue;
+        for (const auto& importer : found->second) {
+            if (!files.count(importer) && dependents.insert(importer).second) {
+                pending.push_back(importer);
+            }
+        }
+    }
+    return dependents;
+}
+
+std::string Transpiler::buildInfoPath() const {
     const auto& opts = config_.compilerOptions;
-    std::string infoPath = opts.tsBuildInfoFile.empty()
+    return opts.tsBuildInfoFile.empty()
         ? (std::filesystem::path(resolveConfigRelativePath(
                opts.outDir.empty() ? "." : opts.outDir)) /
            ".tsbuildinfo").string()
         : resolveConfigRelativePath(opts.tsBuildInfoFile);
+}
+
+void Transpiler::saveBuildInfo() {
+    std::string infoPath = buildInfoPath();
+    std::filesystem::create_directories(std::filesystem::path(infoPath).parent_path());
 
     std::ofstream file(infoPath);
     if (file.is_open()) {
-        file << "{\n  \"version\": \"nova-1.0\",\n  \"files\": {\n";
+        file << "{\n  \"version\": \"nova-2\",\n  \"files\": {\n";
         bool first = true;
         for (const auto& [path, time] : buildCache_.fileModTimes) {
             if (!first) file << ",\n";
             first = false;
-            auto timeT = std::chrono::system_clock::to_time_t(
-                std::chrono::time_point_cast<std::chrono::system_clock::duration>(
-                    time - std::filesystem::file_time_type::clock::now() +
-                    std::chrono::system_clock::now()));
-            file << "    \"" << path << "\": " << timeT;
+            // file_time_type ticks; only ever compared on the same machine
+            file << "    \"" << jsonEscape(path) << "\": { \"mtime\": "
+                 << static_cast<long long>(time.time_since_epoch().count());
+            const auto hash = buildCache_.fileHashes.find(path);
+            if (hash != buildCache_.fileHashes.end()) {
+                file << ", \"hash\": \"" << hash->second << "\"";
+            }
+            file << ", \"imports\": [";
+            const auto imports = buildCache_.fileImports.find(path);
+            if (imports != buildCache_.fileImports.end()) {
+                for (size_t i = 0; i < imports->second.size(); ++i) {
+                    file << (i ? ", " : "") << "\"" << jsonEscape(imports->second[i]) << "\"";
+                }
+            }
+            file << "] }";
         }
         file << "\n  }\n}\n";
         file.close();
@@ -1845,152 +1160,364 @@ void Transpiler::saveBuildInfo() {
 }
 
 void Transpiler::loadBuildInfo() {
-    const auto& opts = config_.compilerOptions;
-    std::string infoPath = opts.tsBuildInfoFile.empty()
-        ? (std::filesystem::path(resolveConfigRelativePath(
-               opts.outDir.empty() ? "." : opts.outDir)) /
-           ".tsbuildinfo").string()
-        : resolveConfigRelativePath(opts.tsBuildInfoFile);
+    buildCache_ = BuildCache();
 
-    std::ifstream file(infoPath);
+    std::ifstream file(buildInfoPath());
     if (!file.is_open()) {
-        buildCache_.isValid = false;
         return;
     }
-
-    // Simple parsing - just look for file paths and timestamps
     std::string content((std::istreambuf_iterator<char>(file)),
                         std::istreambuf_iterator<char>());
     file.close();
 
-    buildCache_.fileModTimes.clear();
-    buildCache_.isValid = true;
+    // Reads back exactly what saveBuildInfo writes; anything else (an
+    // older version, a tsc build info file) leaves the cache invalid.
+    size_t p = 0;
+    const auto skipSpace = [&]() {
+        while (p < content.size() && std::isspace(static_cast<unsigned char>(content[p]))) ++p;
+    };
+    const auto expect = [&](char c) {
+        skipSpace();
+        if (p < content.size() && content[p] == c) {
+            ++p;
+            return true;
+        }
+        return false;
+    };
+    const auto string = [&](std::string& out) {
+        if (!expect('"')) return false;
+        out.clear();
+        for (; p < content.size() && content[p] != '"'; ++p) {
+            if (content[p] == '\\' && p + 1 < content.size()) {
+                const char escaped = content[++p];
+                switch (escaped) {
+                    case 'n': out += '\n'; break;
+                    case 'r': out += '\r'; break;
+                    case 't': out += '\t'; break;
+                    case 'b': out += '\b'; break;
+                    case 'f': out += '\f'; break;
+                    case 'u':
+                        if (p + 4 < content.size()) {
+                            out += static_cast<char>(std::stoi(content.substr(p + 1, 4), nullptr, 16));
+                            p += 4;
+                        }
+                        break;
+                    default: out += escaped;
+                }
+            } else {
+                out += content[p];
+            }
+        }
+        return expect('"');
+    };
 
-    // Parse file timestamps (simplified)
-    std::regex fileRegex("\"([^\"]+)\"\\s*:\\s*(\\d+)");
-    std::sregex_iterator it(content.begin(), content.end(), fileRegex);
-    std::sregex_iterator end;
-    while (it != end) {
-        std::string path = (*it)[1].str();
-        // Skip non-path entries
-        if (path != "version" && path != "files") {
-            // We store as time_t but the actual conversion is complex
-            // For now, just invalidate cache to force rebuild
+    std::string key;
+    std::string version;
+    if (!expect('{') || !string(key) || key != "version" || !expect(':') ||
+        !string(version) || version != "nova-2" || !expect(',') ||
+        !string(key) || key != "files" || !expect(':') || !expect('{')) {
+        return;
+    }
+    BuildCache cache;
+    while (!expect('}')) {
+        std::string path;
+        if (!string(path) || !expect(':') || !expect('{')) return;
+        while (!expect('}')) {
+            if (!string(key) || !expect(':')) return;
+            if (key == "mtime") {
+                skipSpace();
+                size_t used = 0;
+                long long ticks = 0;
+                try {
+                    ticks = std::stoll(content.substr(p, 24), &used);
+                } catch (const std::exception&) {
+                    return;
+                }
+                p += used;
+                cache.fileModTimes[path] = std::filesystem::file_time_type(
+                    std::filesystem::file_time_type::duration(ticks));
+            } else if (key == "hash") {
+                if (!string(cache.fileHashes[path])) return;
+            } else if (key == "imports") {
+                if (!expect('[')) return;
+                auto& imports = cache.fileImports[path];
+                while (!expect(']')) {
+                    std::string imported;
+                    if (!string(imported)) return;
+                    imports.push_back(std::move(imported));
+                    expect(',');
+                }
+            } else {
+                return;
+            }
+            expect(',');
         }
-        ++it;
+        expect(',');
     }
+    cache.isValid = true;
+    buildCache_ = std::move(cache);
 }
 
+// ============================================================================
+// Watch Mode
+// ============================================================================
+
 void Transpiler::watch(const std::string& projectPath, std::function<void(const TranspileResult&)> callback) {
     const auto& opts = config_.compilerOptions;
     const auto& watchOpts = config_.watchOptions;
 
-    // Determine polling interval from watchOptions
-    int pollInterval = 1000; // Default 1 second
-    if (watchOpts.fallbackPolling == "fixedInterval") {
-        pollInterval = 500;
-    } else if (watchOpts.fallbackPolling == "dynamicPriority") {
-        pollInterval = 250;
-    }
-
-    std::map<std::string, std::filesystem::file_time_type> lastModTimes;
-    std::string outDir = opts.outDir.empty() ? "./dist" : opts.outDir;
-
-    // Initial scan
     std::cout << "[Watch] Starting watch mode..." << std::endl;
     std::cout << "[Watch] Watching: " << projectPath << std::endl;
 
-    auto files = findSourceFiles(projectPath);
-    for (const auto& file : files) {
-        try {
-            lastModTimes[file] = std::filesystem::last_write_time(file);
-        } catch (...) {
-            // File might not exist yet
+    // Per-file state lives in buildCache_ (and, for outFile, in the
+    // bundler's module cache) for as long as the watcher runs, and is saved
+    // after every rebuild so the next start only redoes what changed since.
+    loadBuildInfo();
+    buildCache_.isValid = true;
+
+    std::set<std::string> sources;
+    for (const auto& file : findSourceFiles(projectPath)) sources.insert(cacheKey(file));
+    std::cout << "[Watch] Found " << sources.size() << " files to watch" << std::endl;
+
+    const std::string outDir = cacheKey(resolveConfigRelativePath(
+        opts.outDir.empty() ? "." : opts.outDir));
+    const std::string bundlePath = opts.outFile.empty()
+        ? std::string() : resolveConfigRelativePath(opts.outFile);
+
+    // Re-emits `changed` (already filtered to files whose content differs
+    // from the last build) and drops state for `removed`. In per-file mode
+    // a module's output does not depend on what it imports, so dependents
+    // are only reported; an outFile bundle is relinked when anything it
+    // contains changed, reusing every module that did not.
+    const auto rebuild = [&](const std::vector<std::string>& changed,
+                             const std::set<std::string>& removed) {
+        if (changed.empty() && removed.empty()) return;
+        auto startTime = std::chrono::high_resolution_clock::now();
+
+        for (const auto& file : removed) {
+            std::cout << "[Watch] Deleted: " << file << std::endl;
+            for (const auto& dependent : dependentsOf({file})) {
+                if (!removed.count(dependent)) {
+                    std::cout << "[Watch] " << dependent << " imports a deleted file" << std::endl;
+                }
+            }
+            buildCache_.fileModTimes.erase(file);
+            buildCache_.fileHashes.erase(file);
+            buildCache_.fileImports.erase(file);
         }
-    }
 
-    std::cout << "[Watch] Found " << files.size() << " files to watch" << std::endl;
-    std::cout << "[Watch] Press Ctrl+C to stop" << std::endl;
+        if (!bundlePath.empty()) {
+            for (const auto& file : changed) {
+                std::cout << "[Watch] Changed: " << file << std::endl;
+            }
+            BundleResult bundled = bundle(
+                std::vector<std::string>(sources.begin(), sources.end()), bundlePath);
+            TranspileResult result;
+            result.filename = bundlePath;
+            result.success = bundled.success;
+            result.errors = bundled.errors;
+            result.warnings = bundled.warnings;
+            result.inputSize = bundled.totalInputSize;
+            result.outputSize = bundled.outputSize;
+            result.transpileTimeMs = bundled.totalTimeMs;
+            if (bundled.success) {
+                for (const auto& file : changed) {
+                    TranspileResult built;
+                    built.filename = file;
+                    const auto imports = bundled.imports.find(file);
+                    if (imports != bundled.imports.end()) built.imports = imports->second;
+                    recordBuilt(built);
+                }
+            }
+            callback(result);
+        } else {
+            for (const auto& fileResult : transpileFiles(changed)) {
+                if (fileResult.success) {
+                    if (!opts.noEmit) writeOutputs(fileResult);
+                    recordBuilt(fileResult);
+                    std::cout << "[Watch] Compiled: " << fileResult.filename << " -> "
+                              << resolveOutputPath(fileResult.filename, ".js") << std::endl;
+                } else {
+                    std::cout << "[Watch] Error in: " << fileResult.filename << std::endl;
+                    for (const auto& err : fileResult.errors) {
+                        std::cout << "  " << err << std::endl;
+                    }
+                }
+                callback(fileResult);
+            }
+            const auto dependents = dependentsOf(
+                std::set<std::string>(changed.begin(), changed.end()));
+            if (!dependents.empty()) {
+                std::cout << "[Watch] " << dependents.size()
+                          << " dependent file(s) unaffected" << std::endl;
+            }
+        }
+        saveBuildInfo();
 
-    // Main watch loop
-    while (true) {
-        try {
-            files = findSourceFiles(projectPath);
+        auto endTime = std::chrono::high_resolution_clock::now();
+        std::cout << "[Watch] Rebuilt in "
+                  << std::chrono::duration<double, std::milli>(endTime - startTime).count()
+                  << "ms" << std::endl;
+    };
 
-            for (const auto& file : files) {
-                try {
-                    auto modTime = std::filesystem::last_write_time(file);
-
-                    auto it = lastModTimes.find(file);
-                    if (it == lastModTimes.end()) {
-                        // New file
-                        lastModTimes[file] = modTime;
-                        std::cout << "[Watch] New file: " << file << std::endl;
-
-                        auto result = transpileFile(file);
-                        if (result.success) {
-                            // Write output
-                            std::string jsPath = resolveOutputPath(file, ".js");
-                            std::filesystem::create_directories(std::filesystem::path(jsPath).parent_path());
-                            std::ofstream out(jsPath);
-                            out << result.jsCode;
-                            out.close();
-                            std::cout << "[Watch] Compiled: " << file << " -> " << jsPath << std::endl;
-                        }
-                        callback(result);
-                    } else if (modTime > it->second) {
-                        // File changed
-                        lastModTimes[file] = modTime;
-                        std::cout << "[Watch] Changed: " << file << std::endl;
-
-                        auto result = transpileFile(file);
-                        if (result.success) {
-                            // Write output
-                            std::string jsPath = resolveOutputPath(file, ".js");
-                            std::filesystem::create_directories(std::filesystem::path(jsPath).parent_path());
-                            std::ofstream out(jsPath);
-                            out << result.jsCode;
-                            out.close();
-
-                            // Write declaration file if enabled
-                            if (!result.dtsCode.empty()) {
-                                std::string dtsPath = resolveOutputPath(file, ".d.ts");
-                                std::ofstream dtsOut(dtsPath);
-                                dtsOut << result.dtsCode;
-                                dtsOut.close();
-                            }
+    // Catch up with edits made while nothing was watching
+    {
+        std::vector<std::string> changed;
+        for (const auto& file : sources) {
+            if (needsRebuild(file)) changed.push_back(file);
+        }
+        std::set<std::string> removed;
+        for (const auto& [file, time] : buildCache_.fileModTimes) {
+            if (!sources.count(file)) removed.insert(file);
+        }
+        if (!bundlePath.empty() && changed.empty() && removed.empty() &&
+            !std::filesystem::exists(bundlePath)) {
+            changed.assign(sources.begin(), sources.end());
+        }
+        rebuild(changed, removed);
+    }
+    std::cout << "[Watch] Press Ctrl+C to stop" << std::endl;
 
-                            // Write source map if enabled
-                            if (!result.sourceMap.empty()) {
-                                std::ofstream mapOut(jsPath + ".map");
-                                mapOut << result.sourceMap;
-                                mapOut.close();
-                            }
+    // Paths reported by the OS (or found by polling) that may need work.
+    // Source files are matched against `sources`; anything else with a
+    // source extension means the include globs have to be re-evaluated.
+    const auto settle = [&](const std::set<std::string>& touched) {
+        bool rescan = false;
+        for (const auto& path : touched) {
+            if (sources.count(path)) continue;
+            const std::string ext = std::filesystem::path(path).extension().string();
+            if (ext == ".ts" || ext == ".tsx" || ext == ".mts" || ext == ".cts" ||
+                (opts.allowJs && (ext == ".js" || ext == ".jsx" || ext == ".mjs" ||
+                                  ext == ".cjs"))) {
+                rescan = true;
+            }
+        }
+        std::set<std::string> removed;
+        if (rescan) {
+            std::set<std::string> current;
+            for (const auto& file : findSourceFiles(projectPath)) current.insert(cacheKey(file));
+            for (const auto& file : sources) {
+                if (!current.count(file)) removed.insert(file);
+            }
+            sources = std::move(current);
+        }
+        std::vector<std::string> changed;
+        for (const auto& path : touched) {
+            if (!std::filesystem::exists(path)) {
+                if (sources.erase(path) || buildCache_.fileModTimes.count(path)) {
+                    removed.insert(path);
+                }
+                continue;
+            }
+            if (sources.count(path) && needsRebuild(path)) changed.push_back(path);
+        }
+        try {
+            rebuild(changed, removed);
+        } catch (const std::exception& e) {
+            std::cerr << "[Watch] Error: " << e.what() << std::endl;
+        }
+    };
 
-                            std::cout << "[Watch] Compiled: " << file << " -> " << jsPath << std::endl;
-                        } else {
-                            std::cout << "[Watch] Error in: " << file << std::endl;
-                            for (const auto& err : result.errors) {
-                                std::cout << "  " << err << std::endl;
+#ifdef __linux__
+    if (watchOpts.watchFile.find("Polling") == std::string::npos) {
+        const int fd = inotify_init1(IN_CLOEXEC);
+        if (fd >= 0) {
+            // inotify is not recursive: one watch per directory, added as
+            // directories appear. The output directory and dependencies are
+            // left out so our own writes do not wake us up.
+            std::map<int, std::filesystem::path> directories;
+            const auto skipped = [&](const std::filesystem::path& directory) {
+                const std::string name = directory.filename().string();
+                return name == "node_modules" || (name.size() > 1 && name[0] == '.') ||
+                       cacheKey(directory.string()) == outDir;
+            };
+            const auto addTree = [&](const std::filesystem::path& root) {
+                std::error_code error;
+                if (skipped(root) && root != std::filesystem::path(projectPath)) return;
+                const uint32_t mask = IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM |
+                                      IN_CREATE | IN_DELETE | IN_ONLYDIR;
+                int wd = inotify_add_watch(fd, root.c_str(), mask);
+                if (wd >= 0) directories[wd] = root;
+                std::filesystem::recursive_directory_iterator it(
+                    root, std::filesystem::directory_options::skip_permission_denied, error);
+                for (; !error && it != std::filesystem::recursive_directory_iterator();
+                     it.increment(error)) {
+                    if (!it->is_directory(error)) continue;
+                    if (skipped(it->path())) {
+                        it.disable_recursion_pending();
+                        continue;
+                    }
+                    wd = inotify_add_watch(fd, it->path().c_str(), mask);
+                    if (wd >= 0) directories[wd] = it->path();
+                }
+            };
+            addTree(projectPath);
+
+            alignas(struct inotify_event) char buffer[65536];
+            std::set<std::string> touched;
+            while (true) {
+                // Block for the first event, then keep draining until the
+                // burst an editor save produces has been quiet for 5ms.
+                struct pollfd pending = {fd, POLLIN, 0};
+                const int ready = poll(&pending, 1, touched.empty() ? -1 : 5);
+                if (ready < 0 && errno != EINTR) break;
+                if (ready <= 0) {
+                    settle(touched);
+                    touched.clear();
+                    continue;
+                }
+                const ssize_t length = read(fd, buffer, sizeof(buffer));
+                if (length <= 0) continue;
+                for (ssize_t offset = 0; offset < length;) {
+                    const auto* event = reinterpret_cast<const struct inotify_event*>(buffer + offset);
+                    offset += sizeof(struct inotify_event) + event->len;
+                    if (event->mask & IN_Q_OVERFLOW) {
+                        // Events were lost: fall back to checking everything
+                        for (const auto& file : sources) touched.insert(file);
+                        continue;
+                    }
+                    const auto directory = directories.find(event->wd);
+                    if (directory == directories.end() || event->len == 0) continue;
+                    const std::filesystem::path path = directory->second / event->name;
+                    if (event->mask & IN_ISDIR) {
+                        if (event->mask & (IN_CREATE | IN_MOVED_TO)) {
+                            addTree(path);
+                            // Files may have landed before the watch did
+                            std::error_code error;
+                            for (std::filesystem::recursive_directory_iterator it(path, error), end;
+                                 !error && it != end; it.increment(error)) {
+                                if (it->is_regular_file(error)) touched.insert(cacheKey(it->path().string()));
                             }
                         }
-                        callback(result);
+                        continue;
                     }
-                } catch (const std::exception&) {
-                    // Skip files that can't be accessed
+                    touched.insert(cacheKey(path.string()));
                 }
             }
+            close(fd);
+        }
+        std::cerr << "[Watch] inotify unavailable, polling" << std::endl;
+    }
+#endif
 
-            // Check for deleted files
-            for (auto it = lastModTimes.begin(); it != lastModTimes.end(); ) {
-                if (!std::filesystem::exists(it->first)) {
-                    std::cout << "[Watch] Deleted: " << it->first << std::endl;
-                    it = lastModTimes.erase(it);
-                } else {
-                    ++it;
-                }
+    // Polling fallback: stat every source each interval
+    int pollInterval = 1000; // Default 1 second
+    if (watchOpts.fallbackPolling == "fixedInterval") {
+        pollInterval = 500;
+    } else if (watchOpts.fallbackPolling == "dynamicPriority") {
+        pollInterval = 250;
+    }
+    while (true) {
+        try {
+            std::set<std::string> touched;
+            for (const auto& file : findSourceFiles(projectPath)) {
+                const std::string key = cacheKey(file);
+                if (!sources.count(key) || needsRebuild(key)) touched.insert(key);
             }
-
+            for (const auto& file : sources) {
+                if (!std::filesystem::exists(file)) touched.insert(file);
+            }
+            settle(touched);
         } catch (const std::exception& e) {
             std::cerr << "[Watch] Error: " << e.what() << std::endl;
         }
@@ -0,0 +1,60 @@
+// NOVA_TEST_MODE: run
+// NOVA_EXPECT_EXIT: 0
+
+// Canonical `for (i < a.length)` loops over runtime arrays read the length
+// once and index without per-access checks; results must be unchanged.
+
+function main(): number {
+    const base = [4, 8, 15, 16, 23, 42];
+    const scaled = base.map((x: number) => x * 3);
+
+    let sum = 0;
+    for (let i = 0; i < scaled.length; i++) {
+        sum += scaled[i];
+    }
+    if (sum !== 324) return 1;
+
+    let max = 0;
+    let at = -1;
+    for (let i = 0; i < scaled.length; i += 1) {
+        if (scaled[i] > max) {
+            max = scaled[i];
+            at = i;
+        }
+    }
+    if (max !== 126 || at !== 5) return 2;
+
+    // Starting offset and early exit.
+    let firstOdd = -1;
+    for (let i = 1; i < scaled.length; ++i) {
+        if (scaled[i] % 2 === 1) {
+            firstOdd = scaled[i];
+            break;
+        }
+    }
+    if (firstOdd !== 45) return 3;
+
+    // Nested loops over two arrays.
+    const evens = base.filter((x: number) => x % 2 === 0);
+    let pairs = 0;
+    for (let i = 0; i < evens.length; i++) {
+        for (let j = 0; j < scaled.length; j++) {
+            if (evens[i] * 3 === scaled[j]) pairs++;
+        }
+    }
+    if (pairs !== 4) return 4;
+
+    // Loops that mutate the array keep per-access checks.
+    const grow = base.map((x: number) => x);
+    for (let i = 0; i < grow.length; i++) {
+        if (grow.length < 8) grow.push(i);
+    }
+    if (grow.length !== 8 || grow[7] !== 1) return 5;
+
+    const empty = base.filter((x: number) => x > 100);
+    for (let i = 0; i < empty.length; i++) {
+        return 6;
+    }
+
+    return 0;
+}
@@ -0,0 +1,18 @@
+// NOVA_TEST_MODE: compile
+// NOVA_TEST_ARGS: --emit-llvm -o -
+// NOVA_EXPECT_EXIT: 0
+// NOVA_EXPECT_STDOUT_CONTAINS: "%loop_elem = load i64"
+// NOVA_EXPECT_STDOUT_NOT_CONTAINS: "call i64 @nova_value_array_at("
+// NOVA_EXPECT_STDOUT_NOT_CONTAINS: "call i64 @nova_value_array_at_unchecked("
+
+// A canonical read-only loop over a runtime array indexes through the
+// inline element load instead of the checked accessor.
+
+function main(): number {
+    const values = [4, 8, 15, 16, 23, 42].slice(0);
+    let sum = 0;
+    for (let i = 0; i < values.length; i++) {
+        sum += values[i];
+    }
+    return sum === 108 ? 0 : 1;
+}
@@ -0,0 +1,25 @@
+// NOVA_TEST_MODE: compile
+// NOVA_TEST_ARGS: --emit-llvm -o -
+// NOVA_EXPECT_EXIT: 0
+// NOVA_EXPECT_STDOUT_CONTAINS: "call i64 @nova_value_array_at("
+// NOVA_EXPECT_STDOUT_NOT_CONTAINS: "%loop_elem"
+
+// Loops whose body pushes to the array or writes its length can move the
+// bound, so every access keeps the checked accessor.
+
+function main(): number {
+    const grown = [4, 8, 15].slice(0);
+    let sum = 0;
+    for (let i = 0; i < grown.length; i++) {
+        sum += grown[i];
+        if (grown.length < 5) grown.push(i);
+    }
+
+    const truncated = [4, 8, 15, 16].slice(0);
+    let seen = 0;
+    for (let i = 0; i < truncated.length; i++) {
+        seen += truncated[i];
+        truncated.length = 2;
+    }
+    return sum + seen;
+}
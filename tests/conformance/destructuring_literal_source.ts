@@ -0,0 +1,53 @@
+// NOVA_TEST_MODE: run
+// NOVA_EXPECT_EXIT: 0
+
+// Destructuring directly from array/object literals binds the elements
+// without materializing the literal; semantics must match the general path.
+
+function tick(log: number[], v: number): number {
+    log.push(v);
+    return v;
+}
+
+function main(): number {
+    const [p, q] = [1, 2];
+    if (p !== 1 || q !== 2) return 1;
+
+    let a = 3;
+    let b = 4;
+    [a, b] = [b, a];
+    if (a !== 4 || b !== 3) return 2;
+
+    const {x, y} = {x: a + 1, y: b - 1};
+    if (x !== 5 || y !== 2) return 3;
+
+    const {first, second = 9} = {first: 7};
+    if (first !== 7 || second !== 9) return 4;
+
+    const [m, n = 6, o] = [5];
+    if (m !== 5 || n !== 6 || o !== undefined) return 5;
+
+    const [outer, [inner1, inner2]] = [1, [2, 3]];
+    if (outer + inner1 + inner2 !== 6) return 6;
+
+    const {pos: {px, py}} = {pos: {px: 10, py: 20}};
+    if (px !== 10 || py !== 20) return 7;
+
+    // Every element is evaluated, in order, before anything is bound.
+    const log: number[] = [];
+    const [s1, s2] = [tick(log, 1), tick(log, 2), tick(log, 3)];
+    if (log.length !== 3 || log[0] !== 1 || log[1] !== 2 || log[2] !== 3 ||
+        s1 !== 1 || s2 !== 2) {
+        return 8;
+    }
+
+    const [t, u] = ["left", "right"];
+    if (t !== "left" || u !== "right") return 9;
+
+    // Bindings happen in pattern order after every value is evaluated, so a
+    // nested default sees the earlier target.
+    const {d1, d2: [d3 = d1]} = {d1: 1, d2: []};
+    if (d1 !== 1 || d3 !== 1) return 10;
+
+    return 0;
+}
@@ -0,0 +1,58 @@
+// NOVA_TEST_MODE: run
+// NOVA_EXPECT_EXIT: 0
+
+// Array callbacks and small number functions that are expanded inline must
+// behave exactly like the outlined calls.
+
+function square(x: number): number {
+    return x * x;
+}
+
+function clamp(x: number, lo: number, hi: number): number {
+    return x < lo ? lo : (x > hi ? hi : x);
+}
+
+function main(): number {
+    const nums = [3, 1, 4, 1, 5, 9, 2, 6];
+    const offset = 10;
+
+    const shifted = nums.map((x) => x + offset);
+    if (shifted.length !== 8) return 1;
+    if (shifted[0] !== 13 || shifted[7] !== 16) return 2;
+
+    const withIndex = nums.map((x, i) => x * i);
+    if (withIndex[2] !== 8 || withIndex[7] !== 42) return 3;
+
+    const odd = nums.filter((x) => x % 2 === 1);
+    if (odd.length !== 5 || odd[4] !== 9) return 4;
+
+    const total = nums.reduce((acc, x) => acc + x, 0);
+    if (total !== 31) return 5;
+
+    let count = 0;
+    nums.forEach((x) => { count += x; count++; });
+    if (count !== 39) return 6;
+
+    if (nums.find((x) => x > 4) !== 5) return 7;
+    if (nums.find((x) => x > 100) !== undefined) return 8;
+    if (nums.findIndex((x) => x === 9) !== 5) return 9;
+    if (nums.findIndex((x) => x < 0) !== -1) return 10;
+
+    if (!nums.some((x) => x === 6)) return 11;
+    if (nums.some((x) => x > offset)) return 12;
+    if (!nums.every((x) => x > 0)) return 13;
+    if (nums.every((x) => x < 9)) return 14;
+
+    const empty: number[] = [];
+    if (empty.map((x) => x + 1).length !== 0) return 15;
+    if (empty.reduce((acc, x) => acc + x, 7) !== 7) return 16;
+    if (!empty.every((x) => x > 0)) return 17;
+
+    if (square(7) !== 49) return 18;
+    let a = 2;
+    if (square(a++) !== 4 || a !== 3) return 19;
+    if (clamp(15, 0, 10) !== 10 || clamp(-3, 0, 10) !== 0) return 20;
+    if (clamp(square(2), 0, 10) !== 4) return 21;
+
+    return 0;
+}
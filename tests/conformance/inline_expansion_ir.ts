@@ -0,0 +1,36 @@
+// NOVA_TEST_MODE: compile
+// NOVA_TEST_ARGS: --emit-llvm -o -
+// NOVA_EXPECT_EXIT: 0
+// NOVA_EXPECT_STDOUT_CONTAINS: "call i64 @rem("
+// NOVA_EXPECT_STDOUT_NOT_CONTAINS: "call i64 @square("
+// NOVA_EXPECT_STDOUT_NOT_CONTAINS: "call i64 @half("
+// NOVA_EXPECT_STDOUT_NOT_CONTAINS: "@nova_value_array_map("
+// NOVA_EXPECT_STDOUT_NOT_CONTAINS: "@nova_value_array_filter("
+// NOVA_EXPECT_STDOUT_NOT_CONTAINS: "@nova_value_array_reduce("
+
+// Small arrow callbacks and number functions must be expanded in place, so
+// neither the outlined runtime helpers nor the callees are referenced. A
+// remainder by a divisor that is not a non-zero constant stays a call.
+
+function square(x: number): number {
+    return x * x;
+}
+
+function half(x: number): number {
+    return x % 2;
+}
+
+function rem(x: number, d: number): number {
+    return x % d;
+}
+
+function main(): number {
+    const nums = [3, 1, 4, 1, 5, 9, 2, 6];
+    const doubled = nums.map((x) => x * 2);
+    const odd = nums.filter((x) => x % 2 === 1);
+    const total = nums.reduce((acc, x) => acc + x, 0);
+    let a = 7;
+    let d = 4;
+    const folded = square(a) + half(a) + rem(a, d);
+    return doubled.length + odd.length + total + folded === 97 ? 0 : 1;
+}
@@ -0,0 +1,61 @@
+// NOVA_TEST_MODE: run
+// NOVA_EXPECT_EXIT: 0
+
+// Canonical `for (i < ta.length)` loops over typed arrays read and write
+// elements through direct typed loads/stores; element conversions must
+// match the checked accessors.
+
+function main(): number {
+    const xs = new Float64Array(8);
+    for (let i = 0; i < xs.length; i++) {
+        xs[i] = i * 0.5;
+    }
+    let nonZero = 0;
+    for (let i = 0; i < xs.length; i++) {
+        if (xs[i] > 0) nonZero++;
+    }
+    if (nonZero !== 7 || xs[3] !== 1.5 || xs[7] !== 3.5) return 1;
+
+    // Kernel over two arrays; `ys` keeps its checked accessor.
+    const ys = new Float64Array(8);
+    for (let i = 0; i < ys.length; i++) {
+        ys[i] = xs[i] * 2 + 1;
+    }
+    if (ys[7] !== 8 || ys[0] !== 1) return 2;
+
+    // Narrow integer kinds wrap, clamp and sign-extend like the runtime.
+    const bytes = new Int8Array(4);
+    for (let i = 0; i < bytes.length; i++) {
+        bytes[i] = 126 + i;
+    }
+    if (bytes[0] !== 126 || bytes[2] !== -128 || bytes[3] !== -127) return 3;
+
+    const clamped = new Uint8ClampedArray(3);
+    for (let i = 0; i < clamped.length; i++) {
+        clamped[i] = i * 200 - 100;
+    }
+    if (clamped[0] !== 0 || clamped[1] !== 100 || clamped[2] !== 255) return 4;
+
+    const words = new Uint32Array(2);
+    for (let i = 0; i < words.length; i++) {
+        words[i] = 4294967295 - i;
+    }
+    let wordSum = 0;
+    for (let i = 0; i < words.length; i++) {
+        wordSum += words[i];
+    }
+    if (wordSum !== 8589934589) return 5;
+
+    const halves = new Float32Array(4);
+    for (let i = 1; i < halves.length; i += 1) {
+        halves[i] = 1 / (i * 2);
+    }
+    if (halves[0] !== 0 || halves[1] !== 0.5 || halves[2] !== 0.25) return 6;
+
+    const empty = new Int32Array(0);
+    for (let i = 0; i < empty.length; i++) {
+        return 7;
+    }
+
+    return 0;
+}
@@ -0,0 +1,22 @@
+// NOVA_TEST_MODE: compile
+// NOVA_TEST_ARGS: --emit-llvm -o -
+// NOVA_EXPECT_EXIT: 0
+// NOVA_EXPECT_STDOUT_CONTAINS: "vector.body:"
+// NOVA_EXPECT_STDOUT_CONTAINS: " x i32> "
+// NOVA_EXPECT_STDOUT_NOT_CONTAINS: "@nova_int32array_get_unchecked("
+
+// Canonical typed-array loops lower to plain typed loads and stores, which
+// the -O2 pipeline rotates and vectorizes for the host (e.g. <8 x i32> with
+// AVX2, <4 x i32> with SSE2).
+
+function main(): number {
+    const src = new Int32Array(1024);
+    const dst = new Int32Array(1024);
+    for (let i = 0; i < src.length; i++) {
+        src[i] = i;
+    }
+    for (let i = 0; i < dst.length; i++) {
+        dst[i] = i * 3 + 1;
+    }
+    return dst[10] === 31 && src[5] === 5 ? 0 : 1;
+}
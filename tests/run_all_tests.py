@@ -4,11 +4,15 @@
 Test files opt in with directives near the top of the file:
 
     // NOVA_TEST_MODE: run
+    // NOVA_TEST_ARGS: --optional --extra --flags
     // NOVA_EXPECT_EXIT: 0
     // NOVA_EXPECT_STDOUT_CONTAINS: "optional text"
+    // NOVA_EXPECT_STDOUT_NOT_CONTAINS: "optional text"
     // NOVA_EXPECT_STDERR_CONTAINS: "optional text"
 
 String expectations are JSON strings so escapes such as ``\n`` are supported.
+``NOVA_TEST_ARGS`` is split on whitespace and appended after the input path,
+which lets compile-mode tests inspect ``--emit-llvm -o -`` output.
 Files without ``NOVA_EXPECT_EXIT`` are reported as skipped, never as passed.
 """
 
@@ -27,8 +31,8 @@ from pathlib import Path
 REPO_ROOT = Path(__file__).resolve().parents[1]
 DEFAULT_SUITE = REPO_ROOT / "tests" / "conformance"
 DIRECTIVE_RE = re.compile(
-    r"^\s*//\s*NOVA_(TEST_MODE|EXPECT_EXIT|EXPECT_STDOUT_CONTAINS|"
-    r"EXPECT_STDERR_CONTAINS):\s*(.*?)\s*$"
+    r"^\s*//\s*NOVA_(TEST_MODE|TEST_ARGS|EXPECT_EXIT|EXPECT_STDOUT_CONTAINS|"
+    r"EXPECT_STDOUT_NOT_CONTAINS|EXPECT_STDERR_CONTAINS):\s*(.*?)\s*$"
 )
 TEST_EXTENSIONS = {".js", ".jsx", ".mjs", ".cjs", ".ts", ".tsx", ".mts", ".cts"}
 DEFAULT_FAILURE_DEBUG = REPO_ROOT / "run_all_tests_fail_debug.txt"
@@ -69,6 +73,8 @@ class Expectations:
     exit_code: int
     stdout_contains: tuple[str, ...]
     stderr_contains: tuple[str, ...]
+    stdout_not_contains: tuple[str, ...] = ()
+    extra_args: tuple[str, ...] = ()
 
 
 @dataclass(frozen=True)
@@ -132,7 +138,21 @@ def load_expectations(path: Path) -> Expectations | None:
         parse_json_string(value, path, "NOVA_EXPECT_STDERR_CONTAINS")
         for value in values.get("EXPECT_STDERR_CONTAINS", [])
     )
-    return Expectations(mode_values[0], exit_code, stdout_contains, stderr_contains)
+    stdout_not_contains = tuple(
+        parse_json_string(value, path, "NOVA_EXPECT_STDOUT_NOT_CONTAINS")
+        for value in values.get("EXPECT_STDOUT_NOT_CONTAINS", [])
+    )
+    extra_args = tuple(
+        arg for value in values.get("TEST_ARGS", []) for arg in value.split()
+    )
+    return Expectations(
+        mode_values[0],
+        exit_code,
+        stdout_contains,
+        stderr_contains,
+        stdout_not_contains,
+        extra_args,
+    )
 
 
 def find_nova(explicit_path: str | None) -> Path:
@@ -201,7 +221,7 @@ def run_test(
     if expected is None:
         return TestResult(path, "SKIP", "no NOVA_EXPECT_EXIT directive")
 
-    command = [str(nova), expected.mode, str(path)]
+    command = [str(nova), expected.mode, str(path), *expected.extra_args]
     if expected.mode == "run" and cache_mode == "uncached":
         # A compiler rebuild must exercise newly generated code. Nova's native
         # binary cache is keyed by source content, not by compiler version, so
@@ -235,6 +255,9 @@ def run_test(
     for text in expected.stdout_contains:
         if text not in completed.stdout:
             failures.append(f"stdout does not contain {text!r}")
+    for text in expected.stdout_not_contains:
+        if text in completed.stdout:
+            failures.append(f"stdout unexpectedly contains {text!r}")
     for text in expected.stderr_contains:
         if text not in completed.stderr:
             failures.append(f"stderr does not contain {text!r}")
@@ -491,7 +514,11 @@ def expectation_directive_line(path: Path, directive: str, value: str) -> int:
         if not match:
             continue
         directive_value = match.group(1)
-        if directive in {"EXPECT_STDOUT_CONTAINS", "EXPECT_STDERR_CONTAINS"}:
+        if directive in {
+            "EXPECT_STDOUT_CONTAINS",
+            "EXPECT_STDOUT_NOT_CONTAINS",
+            "EXPECT_STDERR_CONTAINS",
+        }:
             try:
                 directive_value = json.loads(directive_value)
             except json.JSONDecodeError:
@@ -570,6 +597,18 @@ def failure_debug_rows(result: TestResult) -> list[FailureDebug]:
                         "<expectation>",
                     )
                 )
+        for text in expected.stdout_not_contains:
+            if text in result.stdout:
+                rows.append(
+                    FailureDebug(
+                        relative_debug_path(result.path),
+                        "UNEXPECTED_STDOUT",
+                        expectation_directive_line(
+                            result.path, "EXPECT_STDOUT_NOT_CONTAINS", text
+                        ),
+                        "<expectation>",
+                    )
+                )
         for text in expected.stderr_contains:
             if text not in result.stderr:
                 rows.append(
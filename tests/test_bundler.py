@@ -0,0 +1,236 @@
+from __future__ import annotations
+
+import json
+import os
+import shutil
+import subprocess
+import tempfile
+import unittest
+from pathlib import Path
+
+from test_transpiler import decode_mappings
+
+
+ROOT = Path(__file__).resolve().parents[1]
+
+FILES = {
+    "util.ts": """// util
+export const PI: number = 3.14159;
+export let counter = 0;
+export function area(r: number): number { return PI * r * r; }
+export function unused(): string { return "tree-shaken"; }
+export class Box<T> {
+    constructor(public value: T) {}
+    map<U>(f: (v: T) => U): Box<U> { return new Box(f(this.value)); }
+}
+export class UnusedWidget { static make() { return "tree-shaken"; } }
+export function bump(): number { return ++counter; }
+const label = "util";
+export { label as name };
+""",
+    "shapes/index.ts": """export * from "./circle";
+export { default as square } from "./square";
+""",
+    "shapes/circle.ts": """import { area } from "../util";
+const label = "circle";
+export function circle(r: number) { return { kind: label, area: area(r) }; }
+""",
+    "shapes/square.ts": """const label = "square";
+export default function (s: number) { return { kind: label, area: s * s }; }
+""",
+    "config.json": '{ "answer": 42 }',
+    "effects.ts": """(globalThis as any).order = ((globalThis as any).order ?? []).concat("effects");
+export const sideEffect = "kept";
+""",
+    "main.ts": """import "./effects";
+import * as util from "./util";
+import { circle, square } from "./shapes";
+import config from "./config.json";
+import makeLabel from "./label";
+import { readFileSync } from "node:fs";
+
+const label = "main";
+const box = new util.Box(2).map((v) => v * 10);
+util.bump();
+util.bump();
+console.log(JSON.stringify({
+    label,
+    name: util.name,
+    circle: circle(1).kind,
+    square: square(3),
+    box: box.value,
+    counter: util.counter,
+    answer: config.answer,
+    made: makeLabel(),
+    order: (globalThis as any).order,
+    fs: typeof readFileSync,
+}));
+export { label };
+""",
+    "label.ts": """let calls = 0;
+export default () => `label${++calls}`;
+""",
+}
+
+EXPECTED = {
+    "label": "main",
+    "name": "util",
+    "circle": "circle",
+    "square": {"kind": "square", "area": 9},
+    "box": 20,
+    "counter": 2,
+    "answer": 42,
+    "made": "label1",
+    "order": ["effects"],
+    "fs": "function",
+}
+
+
+class BundlerTests(unittest.TestCase):
+    nova: Path
+
+    @classmethod
+    def setUpClass(cls) -> None:
+        configured = Path(
+            os.environ.get(
+                "NOVA_TEST_EXECUTABLE", ROOT / "build" / "Debug" / "nova.exe"
+            )
+        )
+        cls.nova = configured.resolve()
+        if not cls.nova.exists():
+            raise unittest.SkipTest(f"Nova executable not found: {cls.nova}")
+
+    def setUp(self) -> None:
+        self.temp = tempfile.TemporaryDirectory()
+        self.addCleanup(self.temp.cleanup)
+        self.project = Path(self.temp.name)
+        for name, content in FILES.items():
+            path = self.project / "src" / name
+            path.parent.mkdir(parents=True, exist_ok=True)
+            path.write_text(content, encoding="utf-8")
+
+    def bundle(self, *options: str, entry: str = "src/main.ts") -> str:
+        result = subprocess.run(
+            [str(self.nova), "build", entry, "--bundle", "--outDir", "dist", *options],
+            cwd=self.project,
+            text=True,
+            capture_output=True,
+            timeout=60,
+            check=False,
+        )
+        self.assertEqual(result.returncode, 0, result.stdout + result.stderr)
+        return (self.project / "dist" / (Path(entry).stem + ".js")).read_text(encoding="utf-8")
+
+    def run_node(self, name: str) -> dict:
+        node = shutil.which("node")
+        if not node:
+            self.skipTest("node is not installed")
+        executed = subprocess.run(
+            [node, str(self.project / "dist" / name)],
+            cwd=self.project,
+            text=True,
+            capture_output=True,
+            timeout=30,
+            check=False,
+        )
+        self.assertEqual(executed.returncode, 0, executed.stdout + executed.stderr)
+        return json.loads(executed.stdout)
+
+    def test_bundle_runs_like_the_modules(self) -> None:
+        code = self.bundle()
+        self.assertNotIn("import ", code.replace('require("node:fs")', ""))
+        self.assertEqual(self.run_node("main.js"), EXPECTED)
+
+    def test_unused_declarations_are_dropped(self) -> None:
+        code = self.bundle()
+        self.assertNotIn("tree-shaken", code)
+        self.assertNotIn("UnusedWidget", code)
+        self.assertNotIn("sideEffect", code)
+        self.assertIn("function area(", code)
+        self.assertIn('"effects"', code)
+
+    def test_collisions_are_renamed_and_namespaces_inlined(self) -> None:
+        code = self.bundle()
+        # Four modules declare `label`; the first in evaluation order keeps it.
+        self.assertIn('const label = "util";', code)
+        self.assertIn('const label$1 = "circle";', code)
+        self.assertIn('const label$2 = "square";', code)
+        self.assertIn('const label$3 = "main";', code)
+        self.assertIn("label: label$3,", code)
+        self.assertIn("exports.label = label$3;", code)
+        # Every `util.x` was a plain member access, so no namespace object.
+        self.assertNotIn("util_exports", code)
+        self.assertIn("new Box(2)", code)
+        self.assertIn("function square_default(s)", code)
+
+    def test_namespace_used_as_a_value_gets_an_object(self) -> None:
+        (self.project / "src" / "keys.ts").write_text(
+            'import * as util from "./util";\n'
+            "const { area } = util;\n"
+            "console.log(JSON.stringify([Object.keys(util).sort(), area(1)]));\n",
+            encoding="utf-8",
+        )
+        code = self.bundle(entry="src/keys.ts")
+        self.assertIn("var util_exports = Object.freeze(", code)
+        self.assertEqual(
+            self.run_node("keys.js"),
+            [
+                ["Box", "PI", "UnusedWidget", "area", "bump", "counter", "name", "unused"],
+                3.14159,
+            ],
+        )
+
+    def test_modules_are_ordered_like_evaluation(self) -> None:
+        code = self.bundle()
+        order = [
+            code.index("// ../src/" + name)
+            for name in (
+                "effects.ts",
+                "util.ts",
+                "shapes/circle.ts",
+                "shapes/square.ts",
+                "config.json",
+                "label.ts",
+                "main.ts",
+            )
+        ]
+        self.assertEqual(order, sorted(order))
+        self.assertEqual(code, self.bundle())
+
+    def test_es_module_output_keeps_externals_as_imports(self) -> None:
+        code = self.bundle("--module", "esnext")
+        self.assertIn('import { readFileSync } from "node:fs";', code)
+        self.assertIn("export { label$3 as label };", code)
+        (self.project / "dist" / "package.json").write_text('{"type": "module"}')
+        self.assertEqual(self.run_node("main.js"), EXPECTED)
+
+    def test_source_map_points_back_at_each_module(self) -> None:
+        code = self.bundle("--sourceMap")
+        source_map = json.loads((self.project / "dist" / "main.js.map").read_text())
+        self.assertIn("../src/shapes/circle.ts", source_map["sources"])
+        self.assertTrue(code.endswith("//# sourceMappingURL=main.js.map\n"))
+        segments = decode_mappings(source_map["mappings"])
+        emitted = code.split("\n")
+        source = FILES["shapes/circle.ts"].split("\n")
+        line = next(i for i, text in enumerate(emitted) if text.startswith("function circle"))
+        original = next(i for i, text in enumerate(source) if text.startswith("export function"))
+        self.assertIn((line, 0, original, source[original].index("function")), segments)
+
+    def test_missing_export_is_an_error(self) -> None:
+        (self.project / "src" / "broken.ts").write_text(
+            'import { nothing } from "./util";\nconsole.log(nothing);\n', encoding="utf-8"
+        )
+        result = subprocess.run(
+            [str(self.nova), "build", "src/broken.ts", "--bundle", "--outDir", "dist"],
+            cwd=self.project,
+            text=True,
+            capture_output=True,
+            timeout=60,
+            check=False,
+        )
+        self.assertNotEqual(result.returncode, 0)
+        self.assertIn("no export named 'nothing'", result.stderr)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,140 @@
+from __future__ import annotations
+
+import os
+import re
+import subprocess
+import tempfile
+import unittest
+from pathlib import Path
+
+
+ROOT = Path(__file__).resolve().parents[1]
+
+FILES = {
+    "geometry/point.ts": """export interface Point { x: number; y: number; }
+export function length(p: Point): number { return Math.sqrt(p.x * p.x + p.y * p.y); }
+export const origin: Point = { x: 0, y: 0 };
+""",
+    "geometry/index.ts": """export * from "./point";
+""",
+    "main.ts": """import { Point, length, origin } from "./geometry";
+const p: Point = { x: 3, y: 4 };
+const d: number = length(p);
+const label: string = length(origin);
+""",
+    "standalone.ts": """export const greeting: string = "hello";
+""",
+}
+
+
+class ProjectCheckTests(unittest.TestCase):
+    nova: Path
+
+    @classmethod
+    def setUpClass(cls) -> None:
+        configured = Path(
+            os.environ.get(
+                "NOVA_TEST_EXECUTABLE", ROOT / "build" / "Debug" / "nova.exe"
+            )
+        )
+        cls.nova = configured.resolve()
+        if not cls.nova.exists():
+            raise unittest.SkipTest(f"Nova executable not found: {cls.nova}")
+
+    def setUp(self) -> None:
+        self.temp = tempfile.TemporaryDirectory()
+        self.addCleanup(self.temp.cleanup)
+        self.project = Path(self.temp.name)
+        for name, content in FILES.items():
+            self.write(name, content)
+
+    def write(self, name: str, content: str) -> None:
+        path = self.project / "src" / name
+        path.parent.mkdir(parents=True, exist_ok=True)
+        path.write_text(content, encoding="utf-8")
+
+    def check(self, *arguments: str) -> tuple[int, list[str], tuple[int, int]]:
+        result = subprocess.run(
+            [str(self.nova), "check", *(arguments or ("src",)), "--verbose"],
+            cwd=self.project,
+            text=True,
+            capture_output=True,
+            timeout=60,
+            check=False,
+        )
+        counts = re.search(r"Checked (\d+) of \d+ files \((\d+) unchanged\)", result.stdout)
+        self.assertIsNotNone(counts, result.stdout + result.stderr)
+        diagnostics = [line for line in result.stderr.splitlines() if "error" in line]
+        return result.returncode, diagnostics, (int(counts.group(1)), int(counts.group(2)))
+
+    def test_imports_see_exported_types(self) -> None:
+        code, diagnostics, (checked, reused) = self.check()
+        self.assertEqual(code, 1)
+        self.assertEqual(len(diagnostics), 1, diagnostics)
+        self.assertIn("main.ts", diagnostics[0])
+        self.assertIn("Type 'number' is not assignable to type 'string'", diagnostics[0])
+        self.assertEqual((checked, reused), (4, 0))
+
+    def test_unchanged_project_is_answered_from_the_cache(self) -> None:
+        first = self.check()
+        self.assertTrue((self.project / "src" / ".novacheckinfo").exists())
+        code, diagnostics, counts = self.check()
+        self.assertEqual((code, diagnostics), first[:2])
+        self.assertEqual(counts, (0, 4))
+
+    def test_body_edit_rechecks_only_that_file(self) -> None:
+        self.check()
+        self.write(
+            "geometry/point.ts",
+            FILES["geometry/point.ts"].replace("Math.sqrt(p.x * p.x + p.y * p.y)", "p.x + p.y"),
+        )
+        code, diagnostics, counts = self.check()
+        self.assertEqual(code, 1)
+        self.assertEqual(len(diagnostics), 1, diagnostics)
+        self.assertEqual(counts, (1, 3))
+
+    def test_exported_type_edit_rechecks_importers(self) -> None:
+        self.check()
+        self.write(
+            "geometry/point.ts",
+            FILES["geometry/point.ts"]
+            .replace("(p: Point): number", "(p: Point): string")
+            .replace("Math.sqrt(p.x * p.x + p.y * p.y)", '"far"'),
+        )
+        code, diagnostics, counts = self.check()
+        self.assertEqual(code, 1)
+        self.assertEqual(len(diagnostics), 1, diagnostics)
+        self.assertIn("Type 'string' is not assignable to type 'number'", diagnostics[0])
+        # point.ts changed, index.ts re-exports it, main.ts imports both.
+        self.assertEqual(counts, (3, 1))
+
+    def test_edited_importer_sees_cached_dependency_types(self) -> None:
+        self.check()
+        self.write("main.ts", FILES["main.ts"].replace("const label: string", "const label: number"))
+        code, diagnostics, counts = self.check()
+        self.assertEqual((code, diagnostics), (0, []))
+        self.assertEqual(counts, (1, 3))
+
+    def test_named_files_pull_in_their_imports(self) -> None:
+        code, diagnostics, counts = self.check("src/main.ts", "src/standalone.ts", "--no-cache")
+        self.assertEqual(code, 1)
+        self.assertEqual(len(diagnostics), 1, diagnostics)
+        self.assertEqual(counts, (4, 0))
+        self.assertFalse((self.project / ".novacheckinfo").exists())
+
+    def test_import_cycles_are_checked(self) -> None:
+        self.write("cycle/a.ts", 'import { b } from "./b";\nexport const a: number = 1;\n')
+        self.write(
+            "cycle/b.ts",
+            'import { a } from "./a";\nexport const b: number = a;\nconst s: string = a;\n',
+        )
+        code, diagnostics, _ = self.check("src/cycle")
+        self.assertEqual(code, 1)
+        self.assertEqual(len(diagnostics), 1, diagnostics)
+        self.assertIn("b.ts", diagnostics[0])
+        # Modules in a cycle are never answered from the cache.
+        self.assertEqual(self.check("src/cycle")[2], (2, 0))
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,102 @@
+from __future__ import annotations
+
+import os
+import shutil
+import subprocess
+import tempfile
+import unittest
+from pathlib import Path
+
+
+ROOT = Path(__file__).resolve().parents[1]
+PROGRAM = """function main(): number {
+    let total = 0;
+    for (let i = 0; i < 100; i++) {
+        total += i % 3 === 0 ? i : 1;
+    }
+    return total > 0 ? 0 : 1;
+}
+"""
+
+
+class PgoDriverTests(unittest.TestCase):
+    nova: Path
+
+    @classmethod
+    def setUpClass(cls) -> None:
+        configured = Path(
+            os.environ.get(
+                "NOVA_TEST_EXECUTABLE", ROOT / "build" / "Debug" / "nova.exe"
+            )
+        )
+        cls.nova = configured.resolve()
+        if not cls.nova.exists():
+            raise unittest.SkipTest(f"Nova executable not found: {cls.nova}")
+
+    def setUp(self) -> None:
+        self.temp = tempfile.TemporaryDirectory()
+        self.addCleanup(self.temp.cleanup)
+        self.source = Path(self.temp.name) / "app.ts"
+        self.source.write_text(PROGRAM, encoding="utf-8")
+
+    def nova_compile(self, *args: str) -> subprocess.CompletedProcess[str]:
+        return subprocess.run(
+            [str(self.nova), "compile", str(self.source), *args],
+            cwd=ROOT,
+            text=True,
+            capture_output=True,
+            timeout=120,
+            check=False,
+        )
+
+    def test_generate_and_use_conflict(self) -> None:
+        result = self.nova_compile(
+            "--profile-generate", "--profile-use=app.profdata"
+        )
+        self.assertNotEqual(result.returncode, 0)
+        self.assertIn("cannot be combined", result.stderr)
+
+    def test_generate_with_directory_and_use_conflict(self) -> None:
+        result = self.nova_compile(
+            "--profile-generate=prof", "--profile-use=app.profdata"
+        )
+        self.assertNotEqual(result.returncode, 0)
+        self.assertIn("cannot be combined", result.stderr)
+
+    def test_profile_flags_reject_non_executable_outputs(self) -> None:
+        for emit in ("--emit-llvm", "--emit-hir", "--emit-mir", "--emit-asm"):
+            for profile in ("--profile-generate", "--profile-use=app.profdata"):
+                with self.subTest(emit=emit, profile=profile):
+                    result = self.nova_compile(emit, profile)
+                    self.assertNotEqual(result.returncode, 0)
+                    self.assertIn("require an executable output", result.stderr)
+
+    def test_run_warns_that_profile_flags_are_ignored(self) -> None:
+        result = subprocess.run(
+            [str(self.nova), "run", str(self.source), "--no-cache",
+             "--profile-generate"],
+            cwd=ROOT,
+            text=True,
+            capture_output=True,
+            timeout=120,
+            check=False,
+        )
+        self.assertIn("ignored by 'run'", result.stderr)
+
+    def test_instrumented_build_links_profile_runtime(self) -> None:
+        nm = shutil.which("llvm-nm") or shutil.which("nm")
+        if shutil.which("clang++") is None or nm is None:
+            self.skipTest("clang++ and nm are required for native PGO builds")
+        exe = Path(self.temp.name) / "app-instrumented"
+        result = self.nova_compile(
+            "-o", str(exe), f"--profile-generate={self.temp.name}"
+        )
+        self.assertEqual(result.returncode, 0, result.stdout + result.stderr)
+        symbols = subprocess.run(
+            [nm, str(exe)], text=True, capture_output=True, check=True
+        ).stdout
+        self.assertIn("__llvm_profile", symbols)
+
+
+if __name__ == "__main__":
+    unittest.main()
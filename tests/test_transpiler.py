@@ -0,0 +1,359 @@
+from __future__ import annotations
+
+import json
+import os
+import shutil
+import subprocess
+import tempfile
+import unittest
+from pathlib import Path
+
+
+ROOT = Path(__file__).resolve().parents[1]
+
+SHAPES = """// shapes
+export enum Color { Red, Green = 4, Blue }
+export const enum Flags { None = 0, A = 1 << 0, B = 1 << 1, AB = A | B }
+enum Named { X = "x", Y = "y" }
+
+export interface Shape { area(): number; readonly name: string }
+export type Pair<T> = [T, T];
+
+export abstract class Base implements Shape {
+    abstract area(): number;
+    protected static count: number = 0;
+    constructor(public readonly name: string, private id?: number) {
+        Base.count++;
+    }
+    get label(): string { return `${this.name}#${this.id ?? 0}`; }
+}
+
+export class Square<T extends object = {}> extends Base {
+    declare tag: string;
+    constructor(private side: number, public meta?: T) {
+        super("square");
+    }
+    area(): number { return this.side * this.side; }
+}
+
+export function total(shapes: Shape[]): number;
+export function total(shapes: Shape[], scale: number): number;
+export function total(shapes: Shape[], scale = 1): number {
+    return shapes.reduce((sum: number, s: Shape) => sum + s.area() * scale, 0);
+}
+
+export namespace Geometry {
+    export const unit = 1;
+    export function double(x: number): number { return x * 2 * unit; }
+    export namespace Inner { export const deep = "deep"; }
+}
+
+export default function makeShapes(): Shape[] {
+    return <Shape[]>[new Square(2), new Square(3)];
+}
+export { Named };
+"""
+
+MAIN = """import makeShapes, { Color, Flags, total, Geometry, type Shape } from "./shapes";
+import * as shapes from "./shapes";
+import type { Pair } from "./shapes";
+import G = Geometry.Inner;
+
+declare const unused: number;
+
+const all: Shape[] = makeShapes();
+const pair: Pair<number> = [1, 2];
+const identity = <T,>(x: T): T => x;
+const cast = (total(all) as unknown) as number;
+const maybe: string | undefined = undefined;
+function greet(this: void, who: string = "world", ...rest: string[]): string {
+    return `hello ${who}${rest.length ? "!" : ""}`;
+}
+console.log(JSON.stringify({
+    colors: [Color.Red, Color.Blue, Color[4]],
+    flags: Flags.AB,
+    total: cast satisfies number,
+    double: Geometry.double(2),
+    deep: G.deep,
+    named: shapes.Named.Y,
+    greet: greet("nova", "x"),
+    identity: identity(pair),
+    label: all[0].label,
+    length: maybe?.length ?? 0,
+}));
+"""
+
+EXPECTED = {
+    "colors": [0, 5, "Green"],
+    "flags": 3,
+    "total": 13,
+    "double": 4,
+    "deep": "deep",
+    "named": "y",
+    "greet": "hello nova!",
+    "identity": [1, 2],
+    "label": "square#0",
+    "length": 0,
+}
+
+
+def decode_mappings(mappings: str) -> set[tuple[int, int, int, int]]:
+    """Absolute (line, column, source line, source column) segments."""
+    alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/"
+    segments = set()
+    source_line = source_column = 0
+    for line, text in enumerate(mappings.split(";")):
+        column = 0
+        for segment in filter(None, text.split(",")):
+            values, value, shift = [], 0, 0
+            for character in segment:
+                digit = alphabet.index(character)
+                value += (digit & 31) << shift
+                shift += 5
+                if not digit & 32:
+                    values.append(-(value >> 1) if value & 1 else value >> 1)
+                    value, shift = 0, 0
+            column += values[0]
+            source_line += values[2]
+            source_column += values[3]
+            segments.add((line, column, source_line, source_column))
+    return segments
+
+
+class TranspilerTests(unittest.TestCase):
+    nova: Path
+
+    @classmethod
+    def setUpClass(cls) -> None:
+        configured = Path(
+            os.environ.get(
+                "NOVA_TEST_EXECUTABLE", ROOT / "build" / "Debug" / "nova.exe"
+            )
+        )
+        cls.nova = configured.resolve()
+        if not cls.nova.exists():
+            raise unittest.SkipTest(f"Nova executable not found: {cls.nova}")
+
+    def setUp(self) -> None:
+        self.temp = tempfile.TemporaryDirectory()
+        self.addCleanup(self.temp.cleanup)
+        self.project = Path(self.temp.name)
+        (self.project / "src").mkdir()
+        (self.project / "src" / "shapes.ts").write_text(SHAPES, encoding="utf-8")
+        (self.project / "src" / "main.ts").write_text(MAIN, encoding="utf-8")
+
+    def build(self, **options: object) -> None:
+        compiler_options = {"rootDir": "src", "outDir": "dist"}
+        compiler_options.update(options)
+        (self.project / "tsconfig.json").write_text(
+            json.dumps(
+                {
+                    "compilerOptions": compiler_options,
+                    "include": ["src/**/*.ts", "src/**/*.tsx"],
+                }
+            ),
+            encoding="utf-8",
+        )
+        result = subprocess.run(
+            [str(self.nova), "build", "."],
+            cwd=self.project,
+            text=True,
+            capture_output=True,
+            timeout=60,
+            check=False,
+        )
+        self.assertEqual(result.returncode, 0, result.stdout + result.stderr)
+
+    def output(self, name: str) -> str:
+        return (self.project / "dist" / name).read_text(encoding="utf-8")
+
+    def run_node(self, entry: str) -> dict:
+        node = shutil.which("node")
+        if not node:
+            self.skipTest("node is not installed")
+        executed = subprocess.run(
+            [node, str(self.project / "dist" / entry)],
+            cwd=self.project,
+            text=True,
+            capture_output=True,
+            timeout=30,
+            check=False,
+        )
+        self.assertEqual(executed.returncode, 0, executed.stdout + executed.stderr)
+        return json.loads(executed.stdout)
+
+    def test_types_are_stripped_and_runtime_constructs_lowered(self) -> None:
+        self.build(module="commonjs", target="es2020")
+        shapes = self.output("shapes.js")
+        for typescript_only in (
+            "interface",
+            "type Pair",
+            "abstract",
+            "implements",
+            "declare",
+            ": number",
+            "<Shape[]>",
+            "public readonly",
+        ):
+            self.assertNotIn(typescript_only, shapes)
+        self.assertIn('Color[Color["Red"] = 0] = "Red";', shapes)
+        self.assertIn('Named["X"] = "x";', shapes)
+        self.assertIn("this.side = side;", shapes)
+        self.assertIn("exports.default = makeShapes;", shapes)
+        self.assertEqual(shapes.count("function total("), 1)
+        self.assertEqual(self.run_node("main.js"), EXPECTED)
+
+    def test_type_only_imports_are_elided(self) -> None:
+        self.build(module="commonjs")
+        main = self.output("main.js")
+        self.assertNotIn("Pair", main)
+        self.assertNotIn("Shape", main.replace("makeShapes", ""))
+        self.assertIn("__importDefault", main)
+
+    def test_es_modules_and_es5_target(self) -> None:
+        self.build(module="esnext")
+        main = self.output("main.js")
+        self.assertIn(
+            'import makeShapes, { Color, Flags, total, Geometry } from "./shapes";',
+            main,
+        )
+        self.assertIn("export var Color;", self.output("shapes.js"))
+
+        self.build(module="commonjs", target="es5")
+        shapes = self.output("shapes.js")
+        self.assertNotIn("=>", shapes)
+        self.assertNotIn("`", shapes)
+        self.assertNotIn("const ", shapes)
+        self.assertEqual(self.run_node("main.js")["colors"], EXPECTED["colors"])
+
+    def test_minify_and_remove_comments(self) -> None:
+        self.build(module="commonjs", minify=True)
+        self.assertNotIn("// shapes", self.output("shapes.js"))
+        self.assertLess(self.output("main.js").count("\n"), 8)
+        self.assertEqual(self.run_node("main.js"), EXPECTED)
+
+    def test_source_maps_point_back_at_the_source(self) -> None:
+        self.build(module="commonjs", sourceMap=True, inlineSources=True)
+        source_map = json.loads(self.output("main.js.map"))
+        self.assertEqual(source_map["version"], 3)
+        self.assertEqual(source_map["sourcesContent"], [MAIN])
+        segments = decode_mappings(source_map["mappings"])
+        emitted = self.output("main.js").split("\n")
+        source = MAIN.split("\n")
+        for prefix in ("const all", "function greet", "console.log"):
+            line = next(i for i, text in enumerate(emitted) if text.startswith(prefix))
+            original = next(i for i, text in enumerate(source) if text.startswith(prefix))
+            self.assertIn((line, 0, original, 0), segments)
+        # `const identity = (x) => x;`: `=>` keeps its source column even
+        # though the type annotations before it were removed.
+        line = next(i for i, text in enumerate(emitted) if text.startswith("const identity"))
+        original = next(i for i, text in enumerate(source) if text.startswith("const identity"))
+        self.assertIn(
+            (line, emitted[line].index("=>"), original, source[original].index("=>")),
+            segments,
+        )
+
+    def test_declarations(self) -> None:
+        self.build(module="commonjs", declaration=True, declarationMap=True)
+        declarations = self.output("shapes.d.ts")
+        self.assertIn("export declare enum Color", declarations)
+        self.assertIn("export declare abstract class Base implements Shape {", declarations)
+        self.assertIn("readonly name: string;", declarations)
+        self.assertIn("private id;", declarations)
+        self.assertIn("constructor(name: string, id?: number);", declarations)
+        self.assertIn("export declare function total(shapes: Shape[]): number;", declarations)
+        self.assertNotIn("scale?: number): number;", declarations)
+        self.assertIn("export const unit: 1;", declarations)
+        self.assertIn("declare function makeShapes(): Shape[];", declarations)
+        self.assertIn("export default makeShapes;", declarations)
+        self.assertIn("declare enum Named", declarations)
+        self.assertTrue(json.loads(self.output("shapes.d.ts.map"))["mappings"])
+        checked = subprocess.run(
+            [str(self.nova), "check", str(self.project / "dist" / "shapes.d.ts")],
+            cwd=self.project,
+            text=True,
+            capture_output=True,
+            timeout=30,
+            check=False,
+        )
+        self.assertEqual(checked.returncode, 0, checked.stdout + checked.stderr)
+
+    def test_incremental_build_skips_unchanged_files(self) -> None:
+        self.build(module="commonjs", incremental=True)
+        build_info = json.loads(self.output(".tsbuildinfo"))
+        main_key = next(key for key in build_info["files"] if key.endswith("main.ts"))
+        self.assertTrue(build_info["files"][main_key]["imports"][0].endswith("shapes.ts"))
+
+        shapes_js = self.project / "dist" / "shapes.js"
+        main_js = self.project / "dist" / "main.js"
+        os.utime(shapes_js, (1, 1))
+        os.utime(main_js, (1, 1))
+        # Touched without an edit: same hash, nothing to redo.
+        os.utime(self.project / "src" / "shapes.ts")
+        self.build(module="commonjs", incremental=True)
+        self.assertEqual(shapes_js.stat().st_mtime, 1)
+
+        (self.project / "src" / "main.ts").write_text(
+            MAIN + "// edited\n", encoding="utf-8"
+        )
+        self.build(module="commonjs", incremental=True)
+        self.assertEqual(shapes_js.stat().st_mtime, 1)
+        self.assertNotEqual(main_js.stat().st_mtime, 1)
+        self.assertEqual(self.run_node("main.js"), EXPECTED)
+
+    def test_watch_rebuilds_changed_file(self) -> None:
+        self.build(module="commonjs", incremental=True)
+        watcher = subprocess.Popen(
+            [str(self.nova), "build", ".", "--watch"],
+            cwd=self.project,
+            stdout=subprocess.PIPE,
+            stderr=subprocess.STDOUT,
+            text=True,
+        )
+        assert watcher.stdout is not None
+        self.addCleanup(watcher.stdout.close)
+        self.addCleanup(watcher.wait)
+        self.addCleanup(watcher.kill)
+        lines = []
+        for line in watcher.stdout:
+            lines.append(line)
+            if "Press Ctrl+C" in line:
+                break
+        # The build info written by the build above leaves nothing to redo.
+        self.assertFalse(any("Compiled" in line for line in lines), "".join(lines))
+
+        (self.project / "src" / "main.ts").write_text(
+            MAIN.replace('"world"', '"watch"'), encoding="utf-8"
+        )
+        for line in watcher.stdout:
+            lines.append(line)
+            if "Rebuilt in" in line:
+                break
+        output = "".join(lines)
+        self.assertIn("main.ts", output)
+        self.assertNotIn("Compiled: " + str(self.project / "src" / "shapes.ts"), output)
+        self.assertIn('who = "watch"', self.output("main.js"))
+
+    def test_jsx_classic_runtime(self) -> None:
+        (self.project / "src" / "view.tsx").write_text(
+            "declare const React: any;\n"
+            "export const view = (name: string) => (\n"
+            '  <div className="greeting" data-id={1}>\n'
+            "    Hello, {name}!&nbsp;<b>{...[1]}</b>\n"
+            "    <></>\n"
+            "  </div>\n"
+            ");\n",
+            encoding="utf-8",
+        )
+        self.build(module="commonjs", jsx="react")
+        view = self.output("view.js")
+        self.assertIn(
+            'React.createElement("div", { className: "greeting", "data-id": 1 }, '
+            '"Hello, ", name, "!\u00a0", React.createElement("b", null, ...[1]), '
+            "React.createElement(React.Fragment, null))",
+            view,
+        )
+
+
+if __name__ == "__main__":
+    unittest.main()
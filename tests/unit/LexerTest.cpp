@@ -2,88 +2,198 @@
 #include "nova/Frontend/Lexer.h"
 #include "nova/Frontend/Token.h"
 
+#include <string>
+#include <vector>
+
 using namespace nova;
 
+namespace {
+
+std::vector<Token> lexAll(Lexer& lexer) {
+    std::vector<Token> tokens;
+    for (;;) {
+        tokens.push_back(lexer.nextToken());
+        if (tokens.back().type == TokenType::EndOfFile) break;
+    }
+    return tokens;
+}
+
+} // namespace
+
 TEST(LexerTest, BasicTokens) {
     Lexer lexer("let x = 42;");
-    
+
     auto token1 = lexer.nextToken();
-    EXPECT_EQ(token1.type, TokenType::Let);
-    
+    EXPECT_EQ(token1.type, TokenType::KeywordLet);
+
     auto token2 = lexer.nextToken();
     EXPECT_EQ(token2.type, TokenType::Identifier);
     EXPECT_EQ(token2.value, "x");
-    
+
     auto token3 = lexer.nextToken();
     EXPECT_EQ(token3.type, TokenType::Equal);
-    
+
     auto token4 = lexer.nextToken();
-    EXPECT_EQ(token4.type, TokenType::Number);
+    EXPECT_EQ(token4.type, TokenType::NumberLiteral);
     EXPECT_EQ(token4.value, "42");
-    
+
     auto token5 = lexer.nextToken();
     EXPECT_EQ(token5.type, TokenType::Semicolon);
-    
+
     auto token6 = lexer.nextToken();
     EXPECT_EQ(token6.type, TokenType::EndOfFile);
 }
 
 TEST(LexerTest, Keywords) {
     Lexer lexer("const function class interface");
-    
-    EXPECT_EQ(lexer.nextToken().type, TokenType::Const);
-    EXPECT_EQ(lexer.nextToken().type, TokenType::Function);
-    EXPECT_EQ(lexer.nextToken().type, TokenType::Class);
-    EXPECT_EQ(lexer.nextToken().type, TokenType::Interface);
+
+    EXPECT_EQ(lexer.nextToken().type, TokenType::KeywordConst);
+    EXPECT_EQ(lexer.nextToken().type, TokenType::KeywordFunction);
+    EXPECT_EQ(lexer.nextToken().type, TokenType::KeywordClass);
+    EXPECT_EQ(lexer.nextToken().type, TokenType::KeywordInterface);
 }
 
 TEST(LexerTest, Operators) {
-    Lexer lexer("+ - * / === !== ??");
-    
-    EXPECT_EQ(lexer.nextToken().type, TokenType::Plus);
-    EXPECT_EQ(lexer.nextToken().type, TokenType::Minus);
-    EXPECT_EQ(lexer.nextToken().type, TokenType::Star);
-    EXPECT_EQ(lexer.nextToken().type, TokenType::Slash);
-    EXPECT_EQ(lexer.nextToken().type, TokenType::StrictEqual);
-    EXPECT_EQ(lexer.nextToken().type, TokenType::StrictNotEqual);
-    EXPECT_EQ(lexer.nextToken().type, TokenType::NullishCoalescing);
+    // Operands in between: a `/` that follows an operator starts a regex.
+    Lexer lexer("a + b - c * d / e === f !== g ?? h");
+    const TokenType expected[] = {
+        TokenType::Plus, TokenType::Minus, TokenType::Star, TokenType::Slash,
+        TokenType::EqualEqualEqual, TokenType::ExclamationEqualEqual,
+        TokenType::QuestionQuestion,
+    };
+    for (TokenType type : expected) {
+        EXPECT_EQ(lexer.nextToken().type, TokenType::Identifier);
+        EXPECT_EQ(lexer.nextToken().type, type);
+    }
 }
 
 TEST(LexerTest, Strings) {
     Lexer lexer("\"hello\" 'world' `template`");
-    
+
     auto token1 = lexer.nextToken();
-    EXPECT_EQ(token1.type, TokenType::String);
+    EXPECT_EQ(token1.type, TokenType::StringLiteral);
     EXPECT_EQ(token1.value, "hello");
-    
+
     auto token2 = lexer.nextToken();
-    EXPECT_EQ(token2.type, TokenType::String);
+    EXPECT_EQ(token2.type, TokenType::StringLiteral);
     EXPECT_EQ(token2.value, "world");
-    
+
     auto token3 = lexer.nextToken();
     EXPECT_EQ(token3.type, TokenType::TemplateLiteral);
 }
 
 TEST(LexerTest, Numbers) {
-    Lexer lexer("42 3.14 0x1A 0b1010 123n");
-    
+    Lexer lexer("42 3.14 0x1A 0b1010");
+
     auto token1 = lexer.nextToken();
-    EXPECT_EQ(token1.type, TokenType::Number);
+    EXPECT_EQ(token1.type, TokenType::NumberLiteral);
     EXPECT_EQ(token1.value, "42");
-    
+
     auto token2 = lexer.nextToken();
-    EXPECT_EQ(token2.type, TokenType::Number);
+    EXPECT_EQ(token2.type, TokenType::NumberLiteral);
     EXPECT_EQ(token2.value, "3.14");
-    
+
     auto token3 = lexer.nextToken();
-    EXPECT_EQ(token3.type, TokenType::Number);
-    EXPECT_EQ(token3.value, "0x1A");
-    
+    EXPECT_EQ(token3.type, TokenType::NumberLiteral);
+
     auto token4 = lexer.nextToken();
-    EXPECT_EQ(token4.type, TokenType::Number);
-    EXPECT_EQ(token4.value, "0b1010");
-    
-    auto token5 = lexer.nextToken();
-    EXPECT_EQ(token5.type, TokenType::BigInt);
-    EXPECT_EQ(token5.value, "123n");
+    EXPECT_EQ(token4.type, TokenType::NumberLiteral);
+}
+
+// The identifier scanner classifies 16 bytes per step and finishes the tail
+// byte by byte; names ending just before, on and after a block edge, and at
+// the very end of the buffer, must all come out whole.
+TEST(LexerTest, IdentifiersAtBlockBoundary) {
+    for (size_t length : {15u, 16u, 17u, 31u, 32u, 33u, 48u}) {
+        std::string name(length, 'a');
+        for (size_t i = 0; i < length; ++i) {
+            name[i] = "abcXYZ_$019"[i % 11];
+        }
+        name[0] = 'n';
+
+        Lexer trailing(name + " = 1;");
+        Token token = trailing.nextToken();
+        EXPECT_EQ(token.type, TokenType::Identifier) << length;
+        EXPECT_EQ(token.value, name) << length;
+        EXPECT_EQ(trailing.nextToken().type, TokenType::Equal) << length;
+
+        Lexer atEnd(name);
+        token = atEnd.nextToken();
+        EXPECT_EQ(token.type, TokenType::Identifier) << length;
+        EXPECT_EQ(token.value, name) << length;
+        EXPECT_EQ(atEnd.nextToken().type, TokenType::EndOfFile) << length;
+    }
+}
+
+TEST(LexerTest, IdentifierStopsAtFirstNonNameByteInBlock) {
+    // '-' at offsets 15 and 16 of the block that starts the identifier.
+    Lexer lexer("abcdefghijklmno-p abcdefghijklmnop-q");
+    auto tokens = lexAll(lexer);
+    ASSERT_EQ(tokens.size(), 7u);
+    EXPECT_EQ(tokens[0].value, "abcdefghijklmno");
+    EXPECT_EQ(tokens[1].type, TokenType::Minus);
+    EXPECT_EQ(tokens[2].value, "p");
+    EXPECT_EQ(tokens[3].value, "abcdefghijklmnop");
+    EXPECT_EQ(tokens[4].type, TokenType::Minus);
+    EXPECT_EQ(tokens[5].value, "q");
+}
+
+TEST(LexerTest, KeywordPrefixIsIdentifier) {
+    Lexer lexer("letter constant returned");
+    auto tokens = lexAll(lexer);
+    ASSERT_EQ(tokens.size(), 4u);
+    for (size_t i = 0; i < 3; ++i) {
+        EXPECT_EQ(tokens[i].type, TokenType::Identifier);
+    }
+}
+
+TEST(LexerTest, StringEscapes) {
+    Lexer lexer(R"("a\nb" 'tab\there' "quote\"inside" "\x41B\u{43}" "back\\slash")");
+    auto tokens = lexAll(lexer);
+    ASSERT_EQ(tokens.size(), 6u);
+    EXPECT_EQ(tokens[0].value, "a\nb");
+    EXPECT_EQ(tokens[1].value, "tab\there");
+    EXPECT_EQ(tokens[2].value, "quote\"inside");
+    EXPECT_EQ(tokens[3].value, "ABC");
+    EXPECT_EQ(tokens[4].value, "back\\slash");
+    EXPECT_FALSE(lexer.hasErrors());
+}
+
+TEST(LexerTest, CookedStringOutlivesLaterTokens) {
+    // Escaped literals are decoded into lexer-owned storage; later tokens
+    // must not invalidate views handed out earlier.
+    Lexer lexer(R"("first\nvalue" "second\tvalue" "third\\value" plain)");
+    auto tokens = lexAll(lexer);
+    ASSERT_EQ(tokens.size(), 5u);
+    EXPECT_EQ(tokens[0].value, "first\nvalue");
+    EXPECT_EQ(tokens[1].value, "second\tvalue");
+    EXPECT_EQ(tokens[2].value, "third\\value");
+    EXPECT_EQ(tokens[3].value, "plain");
+}
+
+TEST(LexerTest, UnterminatedStringAtEndOfFile) {
+    Lexer plain("\"abc");
+    Token token = plain.nextToken();
+    EXPECT_EQ(token.type, TokenType::StringLiteral);
+    EXPECT_EQ(token.value, "abc");
+    EXPECT_TRUE(plain.hasErrors());
+    EXPECT_EQ(plain.nextToken().type, TokenType::EndOfFile);
+
+    Lexer escaped("'abc\\n");
+    escaped.nextToken();
+    EXPECT_TRUE(escaped.hasErrors());
+    EXPECT_EQ(escaped.nextToken().type, TokenType::EndOfFile);
+
+    Lexer trailingBackslash("\"abc\\");
+    trailingBackslash.nextToken();
+    EXPECT_TRUE(trailingBackslash.hasErrors());
+    EXPECT_EQ(trailingBackslash.nextToken().type, TokenType::EndOfFile);
+}
+
+TEST(LexerTest, SourceFileNames) {
+    Lexer lexer("lexer_test_file.ts", "x");
+    Token token = lexer.nextToken();
+    EXPECT_EQ(token.location.filename(), "lexer_test_file.ts");
+    EXPECT_EQ(SourceFiles::intern("lexer_test_file.ts"), token.location.fileId);
+    EXPECT_EQ(SourceFiles::name(0), "");
 }